@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Noise.cpp" "CMakeFiles/noise_pack.dir/src/Noise.cpp.o" "gcc" "CMakeFiles/noise_pack.dir/src/Noise.cpp.o.d"
+  "/root/repo/src/Timing.cpp" "CMakeFiles/noise_pack.dir/src/Timing.cpp.o" "gcc" "CMakeFiles/noise_pack.dir/src/Timing.cpp.o.d"
+  "/root/repo/src/cpu/Scheduler.cpp" "CMakeFiles/noise_pack.dir/src/cpu/Scheduler.cpp.o" "gcc" "CMakeFiles/noise_pack.dir/src/cpu/Scheduler.cpp.o.d"
+  "/root/repo/tools/NoisePack.cpp" "CMakeFiles/noise_pack.dir/tools/NoisePack.cpp.o" "gcc" "CMakeFiles/noise_pack.dir/tools/NoisePack.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
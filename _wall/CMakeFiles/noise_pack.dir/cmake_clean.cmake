@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/noise_pack.dir/src/Noise.cpp.o"
+  "CMakeFiles/noise_pack.dir/src/Noise.cpp.o.d"
+  "CMakeFiles/noise_pack.dir/src/Timing.cpp.o"
+  "CMakeFiles/noise_pack.dir/src/Timing.cpp.o.d"
+  "CMakeFiles/noise_pack.dir/src/cpu/Scheduler.cpp.o"
+  "CMakeFiles/noise_pack.dir/src/cpu/Scheduler.cpp.o.d"
+  "CMakeFiles/noise_pack.dir/tools/NoisePack.cpp.o"
+  "CMakeFiles/noise_pack.dir/tools/NoisePack.cpp.o.d"
+  "noise_pack"
+  "noise_pack.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/noise_pack.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,66 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/lib/imgui/imgui/imgui.cpp" "CMakeFiles/rayproj.dir/lib/imgui/imgui/imgui.cpp.o" "gcc" "CMakeFiles/rayproj.dir/lib/imgui/imgui/imgui.cpp.o.d"
+  "/root/repo/lib/imgui/imgui/imgui_demo.cpp" "CMakeFiles/rayproj.dir/lib/imgui/imgui/imgui_demo.cpp.o" "gcc" "CMakeFiles/rayproj.dir/lib/imgui/imgui/imgui_demo.cpp.o.d"
+  "/root/repo/lib/imgui/imgui/imgui_draw.cpp" "CMakeFiles/rayproj.dir/lib/imgui/imgui/imgui_draw.cpp.o" "gcc" "CMakeFiles/rayproj.dir/lib/imgui/imgui/imgui_draw.cpp.o.d"
+  "/root/repo/lib/imgui/imgui/imgui_widgets.cpp" "CMakeFiles/rayproj.dir/lib/imgui/imgui/imgui_widgets.cpp.o" "gcc" "CMakeFiles/rayproj.dir/lib/imgui/imgui/imgui_widgets.cpp.o.d"
+  "/root/repo/src/Animation.cpp" "CMakeFiles/rayproj.dir/src/Animation.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/Animation.cpp.o.d"
+  "/root/repo/src/Application.cpp" "CMakeFiles/rayproj.dir/src/Application.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/Application.cpp.o.d"
+  "/root/repo/src/Camera.cpp" "CMakeFiles/rayproj.dir/src/Camera.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/Camera.cpp.o.d"
+  "/root/repo/src/Context.cpp" "CMakeFiles/rayproj.dir/src/Context.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/Context.cpp.o.d"
+  "/root/repo/src/Entities.cpp" "CMakeFiles/rayproj.dir/src/Entities.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/Entities.cpp.o.d"
+  "/root/repo/src/File.cpp" "CMakeFiles/rayproj.dir/src/File.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/File.cpp.o.d"
+  "/root/repo/src/Generator.cpp" "CMakeFiles/rayproj.dir/src/Generator.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/Generator.cpp.o.d"
+  "/root/repo/src/Import.cpp" "CMakeFiles/rayproj.dir/src/Import.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/Import.cpp.o.d"
+  "/root/repo/src/Input.cpp" "CMakeFiles/rayproj.dir/src/Input.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/Input.cpp.o.d"
+  "/root/repo/src/MappedFile.cpp" "CMakeFiles/rayproj.dir/src/MappedFile.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/MappedFile.cpp.o.d"
+  "/root/repo/src/Meshes.cpp" "CMakeFiles/rayproj.dir/src/Meshes.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/Meshes.cpp.o.d"
+  "/root/repo/src/Noise.cpp" "CMakeFiles/rayproj.dir/src/Noise.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/Noise.cpp.o.d"
+  "/root/repo/src/NoiseCache.cpp" "CMakeFiles/rayproj.dir/src/NoiseCache.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/NoiseCache.cpp.o.d"
+  "/root/repo/src/NoiseStream.cpp" "CMakeFiles/rayproj.dir/src/NoiseStream.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/NoiseStream.cpp.o.d"
+  "/root/repo/src/SceneFile.cpp" "CMakeFiles/rayproj.dir/src/SceneFile.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/SceneFile.cpp.o.d"
+  "/root/repo/src/Timing.cpp" "CMakeFiles/rayproj.dir/src/Timing.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/Timing.cpp.o.d"
+  "/root/repo/src/TopLevelPolicy.cpp" "CMakeFiles/rayproj.dir/src/TopLevelPolicy.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/TopLevelPolicy.cpp.o.d"
+  "/root/repo/src/UpdateStage.cpp" "CMakeFiles/rayproj.dir/src/UpdateStage.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/UpdateStage.cpp.o.d"
+  "/root/repo/src/bench/Benchmarks.cpp" "CMakeFiles/rayproj.dir/src/bench/Benchmarks.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/bench/Benchmarks.cpp.o.d"
+  "/root/repo/src/cpu/Context.cpp" "CMakeFiles/rayproj.dir/src/cpu/Context.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/cpu/Context.cpp.o.d"
+  "/root/repo/src/cpu/Image.cpp" "CMakeFiles/rayproj.dir/src/cpu/Image.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/cpu/Image.cpp.o.d"
+  "/root/repo/src/cpu/Main.cpp" "CMakeFiles/rayproj.dir/src/cpu/Main.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/cpu/Main.cpp.o.d"
+  "/root/repo/src/cpu/Options.cpp" "CMakeFiles/rayproj.dir/src/cpu/Options.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/cpu/Options.cpp.o.d"
+  "/root/repo/src/cpu/Renderer.cpp" "CMakeFiles/rayproj.dir/src/cpu/Renderer.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/cpu/Renderer.cpp.o.d"
+  "/root/repo/src/cpu/Scene.cpp" "CMakeFiles/rayproj.dir/src/cpu/Scene.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/cpu/Scene.cpp.o.d"
+  "/root/repo/src/cpu/Scheduler.cpp" "CMakeFiles/rayproj.dir/src/cpu/Scheduler.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/cpu/Scheduler.cpp.o.d"
+  "/root/repo/src/cpu/raytracing/BottomStructure.cpp" "CMakeFiles/rayproj.dir/src/cpu/raytracing/BottomStructure.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/cpu/raytracing/BottomStructure.cpp.o.d"
+  "/root/repo/src/cpu/raytracing/Bvh.cpp" "CMakeFiles/rayproj.dir/src/cpu/raytracing/Bvh.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/cpu/raytracing/Bvh.cpp.o.d"
+  "/root/repo/src/cpu/raytracing/Packet.cpp" "CMakeFiles/rayproj.dir/src/cpu/raytracing/Packet.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/cpu/raytracing/Packet.cpp.o.d"
+  "/root/repo/src/cpu/raytracing/Ray.cpp" "CMakeFiles/rayproj.dir/src/cpu/raytracing/Ray.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/cpu/raytracing/Ray.cpp.o.d"
+  "/root/repo/src/cpu/raytracing/TopStructure.cpp" "CMakeFiles/rayproj.dir/src/cpu/raytracing/TopStructure.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/cpu/raytracing/TopStructure.cpp.o.d"
+  "/root/repo/src/interfaces/IApplication.cpp" "CMakeFiles/rayproj.dir/src/interfaces/IApplication.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/interfaces/IApplication.cpp.o.d"
+  "/root/repo/src/interfaces/IRenderer.cpp" "CMakeFiles/rayproj.dir/src/interfaces/IRenderer.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/interfaces/IRenderer.cpp.o.d"
+  "/root/repo/src/math/Angles.cpp" "CMakeFiles/rayproj.dir/src/math/Angles.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/math/Angles.cpp.o.d"
+  "/root/repo/src/math/Math.cpp" "CMakeFiles/rayproj.dir/src/math/Math.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/math/Math.cpp.o.d"
+  "/root/repo/src/math/Random.cpp" "CMakeFiles/rayproj.dir/src/math/Random.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/math/Random.cpp.o.d"
+  "/root/repo/src/math/Transform.cpp" "CMakeFiles/rayproj.dir/src/math/Transform.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/math/Transform.cpp.o.d"
+  "/root/repo/src/properties/Easing.cpp" "CMakeFiles/rayproj.dir/src/properties/Easing.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/properties/Easing.cpp.o.d"
+  "/root/repo/src/properties/Engine.cpp" "CMakeFiles/rayproj.dir/src/properties/Engine.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/properties/Engine.cpp.o.d"
+  "/root/repo/src/properties/IProperty.cpp" "CMakeFiles/rayproj.dir/src/properties/IProperty.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/properties/IProperty.cpp.o.d"
+  "/root/repo/src/properties/Interpolate.cpp" "CMakeFiles/rayproj.dir/src/properties/Interpolate.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/properties/Interpolate.cpp.o.d"
+  "/root/repo/src/properties/Interpolator.cpp" "CMakeFiles/rayproj.dir/src/properties/Interpolator.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/properties/Interpolator.cpp.o.d"
+  "/root/repo/src/properties/Manager.cpp" "CMakeFiles/rayproj.dir/src/properties/Manager.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/properties/Manager.cpp.o.d"
+  "/root/repo/src/properties/Property.cpp" "CMakeFiles/rayproj.dir/src/properties/Property.cpp.o" "gcc" "CMakeFiles/rayproj.dir/src/properties/Property.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,105 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rayproj.dir/lib/imgui/imgui/imgui.cpp.o"
+  "CMakeFiles/rayproj.dir/lib/imgui/imgui/imgui.cpp.o.d"
+  "CMakeFiles/rayproj.dir/lib/imgui/imgui/imgui_demo.cpp.o"
+  "CMakeFiles/rayproj.dir/lib/imgui/imgui/imgui_demo.cpp.o.d"
+  "CMakeFiles/rayproj.dir/lib/imgui/imgui/imgui_draw.cpp.o"
+  "CMakeFiles/rayproj.dir/lib/imgui/imgui/imgui_draw.cpp.o.d"
+  "CMakeFiles/rayproj.dir/lib/imgui/imgui/imgui_widgets.cpp.o"
+  "CMakeFiles/rayproj.dir/lib/imgui/imgui/imgui_widgets.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/Animation.cpp.o"
+  "CMakeFiles/rayproj.dir/src/Animation.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/Application.cpp.o"
+  "CMakeFiles/rayproj.dir/src/Application.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/Camera.cpp.o"
+  "CMakeFiles/rayproj.dir/src/Camera.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/Context.cpp.o"
+  "CMakeFiles/rayproj.dir/src/Context.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/Entities.cpp.o"
+  "CMakeFiles/rayproj.dir/src/Entities.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/File.cpp.o"
+  "CMakeFiles/rayproj.dir/src/File.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/Generator.cpp.o"
+  "CMakeFiles/rayproj.dir/src/Generator.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/Import.cpp.o"
+  "CMakeFiles/rayproj.dir/src/Import.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/Input.cpp.o"
+  "CMakeFiles/rayproj.dir/src/Input.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/MappedFile.cpp.o"
+  "CMakeFiles/rayproj.dir/src/MappedFile.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/Meshes.cpp.o"
+  "CMakeFiles/rayproj.dir/src/Meshes.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/Noise.cpp.o"
+  "CMakeFiles/rayproj.dir/src/Noise.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/NoiseCache.cpp.o"
+  "CMakeFiles/rayproj.dir/src/NoiseCache.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/NoiseStream.cpp.o"
+  "CMakeFiles/rayproj.dir/src/NoiseStream.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/SceneFile.cpp.o"
+  "CMakeFiles/rayproj.dir/src/SceneFile.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/Timing.cpp.o"
+  "CMakeFiles/rayproj.dir/src/Timing.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/TopLevelPolicy.cpp.o"
+  "CMakeFiles/rayproj.dir/src/TopLevelPolicy.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/UpdateStage.cpp.o"
+  "CMakeFiles/rayproj.dir/src/UpdateStage.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/bench/Benchmarks.cpp.o"
+  "CMakeFiles/rayproj.dir/src/bench/Benchmarks.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/cpu/Context.cpp.o"
+  "CMakeFiles/rayproj.dir/src/cpu/Context.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/cpu/Image.cpp.o"
+  "CMakeFiles/rayproj.dir/src/cpu/Image.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/cpu/Main.cpp.o"
+  "CMakeFiles/rayproj.dir/src/cpu/Main.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/cpu/Options.cpp.o"
+  "CMakeFiles/rayproj.dir/src/cpu/Options.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/cpu/Renderer.cpp.o"
+  "CMakeFiles/rayproj.dir/src/cpu/Renderer.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/cpu/Scene.cpp.o"
+  "CMakeFiles/rayproj.dir/src/cpu/Scene.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/cpu/Scheduler.cpp.o"
+  "CMakeFiles/rayproj.dir/src/cpu/Scheduler.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/cpu/raytracing/BottomStructure.cpp.o"
+  "CMakeFiles/rayproj.dir/src/cpu/raytracing/BottomStructure.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/cpu/raytracing/Bvh.cpp.o"
+  "CMakeFiles/rayproj.dir/src/cpu/raytracing/Bvh.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/cpu/raytracing/Packet.cpp.o"
+  "CMakeFiles/rayproj.dir/src/cpu/raytracing/Packet.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/cpu/raytracing/Ray.cpp.o"
+  "CMakeFiles/rayproj.dir/src/cpu/raytracing/Ray.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/cpu/raytracing/TopStructure.cpp.o"
+  "CMakeFiles/rayproj.dir/src/cpu/raytracing/TopStructure.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/interfaces/IApplication.cpp.o"
+  "CMakeFiles/rayproj.dir/src/interfaces/IApplication.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/interfaces/IRenderer.cpp.o"
+  "CMakeFiles/rayproj.dir/src/interfaces/IRenderer.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/math/Angles.cpp.o"
+  "CMakeFiles/rayproj.dir/src/math/Angles.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/math/Math.cpp.o"
+  "CMakeFiles/rayproj.dir/src/math/Math.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/math/Random.cpp.o"
+  "CMakeFiles/rayproj.dir/src/math/Random.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/math/Transform.cpp.o"
+  "CMakeFiles/rayproj.dir/src/math/Transform.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/properties/Easing.cpp.o"
+  "CMakeFiles/rayproj.dir/src/properties/Easing.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/properties/Engine.cpp.o"
+  "CMakeFiles/rayproj.dir/src/properties/Engine.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/properties/IProperty.cpp.o"
+  "CMakeFiles/rayproj.dir/src/properties/IProperty.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/properties/Interpolate.cpp.o"
+  "CMakeFiles/rayproj.dir/src/properties/Interpolate.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/properties/Interpolator.cpp.o"
+  "CMakeFiles/rayproj.dir/src/properties/Interpolator.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/properties/Manager.cpp.o"
+  "CMakeFiles/rayproj.dir/src/properties/Manager.cpp.o.d"
+  "CMakeFiles/rayproj.dir/src/properties/Property.cpp.o"
+  "CMakeFiles/rayproj.dir/src/properties/Property.cpp.o.d"
+  "rayproj"
+  "rayproj.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rayproj.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
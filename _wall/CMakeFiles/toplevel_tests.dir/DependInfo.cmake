@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/Entities.cpp" "CMakeFiles/toplevel_tests.dir/src/Entities.cpp.o" "gcc" "CMakeFiles/toplevel_tests.dir/src/Entities.cpp.o.d"
+  "/root/repo/src/Timing.cpp" "CMakeFiles/toplevel_tests.dir/src/Timing.cpp.o" "gcc" "CMakeFiles/toplevel_tests.dir/src/Timing.cpp.o.d"
+  "/root/repo/src/TopLevelPolicy.cpp" "CMakeFiles/toplevel_tests.dir/src/TopLevelPolicy.cpp.o" "gcc" "CMakeFiles/toplevel_tests.dir/src/TopLevelPolicy.cpp.o.d"
+  "/root/repo/src/cpu/Scheduler.cpp" "CMakeFiles/toplevel_tests.dir/src/cpu/Scheduler.cpp.o" "gcc" "CMakeFiles/toplevel_tests.dir/src/cpu/Scheduler.cpp.o.d"
+  "/root/repo/src/math/Transform.cpp" "CMakeFiles/toplevel_tests.dir/src/math/Transform.cpp.o" "gcc" "CMakeFiles/toplevel_tests.dir/src/math/Transform.cpp.o.d"
+  "/root/repo/tools/TopLevelTests.cpp" "CMakeFiles/toplevel_tests.dir/tools/TopLevelTests.cpp.o" "gcc" "CMakeFiles/toplevel_tests.dir/tools/TopLevelTests.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
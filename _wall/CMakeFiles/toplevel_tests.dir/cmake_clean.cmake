@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/toplevel_tests.dir/src/Entities.cpp.o"
+  "CMakeFiles/toplevel_tests.dir/src/Entities.cpp.o.d"
+  "CMakeFiles/toplevel_tests.dir/src/Timing.cpp.o"
+  "CMakeFiles/toplevel_tests.dir/src/Timing.cpp.o.d"
+  "CMakeFiles/toplevel_tests.dir/src/TopLevelPolicy.cpp.o"
+  "CMakeFiles/toplevel_tests.dir/src/TopLevelPolicy.cpp.o.d"
+  "CMakeFiles/toplevel_tests.dir/src/cpu/Scheduler.cpp.o"
+  "CMakeFiles/toplevel_tests.dir/src/cpu/Scheduler.cpp.o.d"
+  "CMakeFiles/toplevel_tests.dir/src/math/Transform.cpp.o"
+  "CMakeFiles/toplevel_tests.dir/src/math/Transform.cpp.o.d"
+  "CMakeFiles/toplevel_tests.dir/tools/TopLevelTests.cpp.o"
+  "CMakeFiles/toplevel_tests.dir/tools/TopLevelTests.cpp.o.d"
+  "toplevel_tests"
+  "toplevel_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/toplevel_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
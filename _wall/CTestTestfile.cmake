@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_wall
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(toplevel_tests "/root/repo/_wall/toplevel_tests")
+set_tests_properties(toplevel_tests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;344;add_test;/root/repo/CMakeLists.txt;0;")
@@ -0,0 +1,6152 @@
+#pragma once
+
+// Generated by tools/NoisePack.cpp from samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_256spp.h, do not edit.
+
+#include <cstdint>
+
+static const uint8_t scramblingTile_256spp_u8[128*128*8] = {
+    146,125,75,111,225,108,198,173,137,86,150,147,245,174,93,52,130,151,179,115,250,204,112,253,109,71,81,246,6,183,110,83,
+    164,113,125,159,146,6,68,22,37,94,69,187,28,108,18,133,73,3,216,240,158,27,96,198,196,98,249,220,77,188,30,176,
+    221,245,30,130,59,179,44,250,208,104,29,151,65,72,135,116,34,198,66,106,6,187,111,116,44,201,42,159,167,134,151,61,
+    87,194,35,155,28,77,235,174,107,105,122,143,166,247,157,73,35,182,115,156,155,4,136,152,210,75,163,38,45,99,97,36,
+    34,69,227,104,44,46,31,126,165,107,53,142,56,51,130,232,135,112,141,21,134,238,22,115,157,115,144,194,226,168,32,135,
+    214,71,238,226,230,141,1,253,37,102,81,235,238,224,20,241,241,240,143,42,29,61,35,177,31,207,3,24,193,233,123,36,
+    115,244,21,253,231,32,58,225,239,78,22,24,128,34,66,6,104,233,4,207,203,241,56,196,101,201,45,161,238,121,6,73,
+    142,41,133,95,251,121,42,173,113,106,155,200,211,12,224,234,180,158,173,219,16,210,117,186,182,176,46,130,198,50,118,32,
+    251,56,104,67,176,63,102,47,22,4,233,114,107,74,110,237,59,58,120,14,251,134,93,230,250,166,77,41,191,223,217,26,
+    59,83,99,5,161,249,8,226,75,0,108,17,214,243,236,18,219,152,97,69,109,223,179,135,14,75,34,188,111,176,176,34,
+    109,251,88,99,37,117,6,142,253,235,25,164,7,219,108,230,224,241,232,101,85,253,98,221,64,168,219,74,217,186,142,98,
+    17,215,206,148,194,77,222,23,187,146,194,130,116,95,181,115,212,180,5,246,138,115,67,112,195,212,253,10,112,27,183,154,
+    22,85,241,74,102,205,169,224,24,57,239,144,41,216,94,241,196,116,252,234,60,37,192,47,109,107,90,154,236,250,103,126,
+    89,189,14,189,57,92,240,180,181,185,146,110,70,62,180,62,115,225,90,61,39,233,235,113,115,160,52,42,40,77,173,61,
+    187,154,180,153,69,234,114,184,172,193,39,137,84,49,62,225,125,201,203,80,84,134,189,47,126,211,55,35,20,82,229,78,
+    47,106,170,157,1,135,193,30,67,69,12,114,206,19,187,218,42,239,204,42,113,154,244,119,96,235,242,96,248,64,227,232,
+    59,139,36,25,96,155,53,253,52,135,52,26,45,159,77,105,74,252,197,103,251,196,1,18,68,245,136,170,109,225,48,159,
+    66,236,119,141,92,175,27,162,101,8,43,93,126,211,78,155,137,142,111,89,105,195,162,175,161,103,40,203,26,29,180,164,
+    161,158,98,231,16,167,108,64,95,242,102,117,21,25,81,33,111,160,227,186,36,153,65,27,16,28,57,99,40,143,176,99,
+    23,12,246,51,51,81,36,171,165,226,183,56,175,151,254,195,247,10,148,59,62,55,246,115,66,154,129,123,55,157,216,11,
+    65,216,112,248,230,128,18,9,80,14,51,246,216,58,71,238,219,179,156,33,68,226,186,64,190,119,157,48,110,68,223,133,
+    227,152,237,133,157,23,0,194,249,157,29,149,128,204,9,253,227,202,13,215,124,118,16,246,57,13,192,100,52,102,3,124,
+    207,61,17,100,189,31,102,110,239,22,31,125,135,109,181,36,176,18,121,116,175,208,73,120,119,38,219,19,6,208,99,117,
+    42,162,179,105,133,179,130,109,124,128,19,192,222,236,190,40,98,157,205,164,152,207,240,239,250,37,38,48,238,120,184,124,
+    241,115,205,180,52,153,125,124,193,115,32,35,102,41,185,73,172,235,192,174,110,168,83,153,31,185,24,60,237,124,33,183,
+    254,163,220,212,34,122,243,115,122,14,82,183,226,251,60,80,173,219,117,27,129,15,237,126,151,59,48,123,152,95,115,226,
+    114,191,21,244,129,102,148,136,114,77,111,157,255,112,44,110,50,15,151,220,79,103,30,225,134,109,137,215,152,93,25,235,
+    239,137,30,92,141,171,168,140,238,152,189,95,108,16,232,114,83,5,225,104,232,106,27,50,64,226,16,17,157,209,132,19,
+    79,143,14,224,142,0,234,104,116,226,4,205,218,172,240,112,223,73,161,225,135,127,91,102,15,116,185,239,154,73,231,215,
+    243,111,246,155,240,119,86,108,129,63,11,164,87,153,153,114,165,82,168,25,18,225,156,35,89,215,33,219,15,27,171,13,
+    126,176,172,148,124,220,35,53,209,241,217,142,46,16,45,50,149,218,212,148,103,196,219,135,77,165,209,95,179,3,104,34,
+    77,159,187,233,128,123,182,93,165,19,55,184,142,201,99,160,154,159,106,110,137,101,52,30,37,113,31,171,243,215,237,178,
+    151,81,173,238,34,107,77,149,251,114,161,39,37,81,38,223,119,64,157,47,90,140,90,101,132,140,179,255,25,114,20,144,
+    37,243,77,117,5,83,67,0,52,136,125,135,184,35,190,197,157,143,139,190,131,49,47,174,58,137,79,125,46,25,7,226,
+    135,236,73,109,58,63,31,144,67,127,69,174,73,40,242,145,169,240,48,147,14,218,101,234,89,45,55,63,14,188,48,53,
+    92,230,13,49,160,216,241,163,42,100,255,208,133,51,157,31,206,191,202,99,41,193,107,140,219,204,167,50,42,83,16,136,
+    44,252,112,201,252,211,166,227,170,198,86,82,185,207,249,241,169,212,76,134,243,124,36,45,159,208,32,247,144,3,206,44,
+    110,86,16,248,233,40,176,145,212,110,141,96,246,27,187,156,73,14,125,210,15,37,22,208,71,122,143,18,8,3,68,152,
+    69,60,156,16,243,255,165,127,246,53,14,150,179,91,21,6,65,215,173,52,139,195,50,64,3,154,183,203,75,250,156,146,
+    103,223,57,167,7,233,155,196,150,189,180,220,86,160,96,194,4,146,35,170,75,191,45,248,182,165,98,131,202,82,209,176,
+    52,60,74,205,154,212,88,190,230,87,101,3,96,55,203,15,239,88,42,229,244,193,211,110,83,80,9,76,141,138,212,210,
+    51,88,229,146,237,252,68,221,147,167,243,240,156,144,64,192,146,88,236,46,22,128,96,165,28,50,83,174,132,189,49,153,
+    14,184,28,101,202,172,100,37,106,247,224,221,19,210,162,119,179,216,253,186,89,158,142,32,177,205,19,33,178,111,10,220,
+    66,184,123,187,185,101,213,26,185,135,101,105,118,50,199,149,181,213,161,63,109,223,17,145,223,183,163,203,242,142,70,215,
+    31,33,126,182,232,171,125,35,133,41,178,227,230,186,22,115,209,159,175,236,231,232,221,37,192,153,184,57,236,168,69,114,
+    147,190,135,104,82,137,9,70,2,177,169,105,111,50,110,101,154,184,5,211,122,209,131,167,114,241,64,51,95,52,72,120,
+    144,111,78,195,206,69,158,123,125,109,65,130,219,132,225,206,115,54,194,157,3,77,102,208,98,214,135,61,117,76,237,12,
+    184,205,231,239,120,17,252,131,82,65,190,76,27,70,75,89,139,209,39,13,13,171,89,143,244,112,243,112,246,51,145,140,
+    142,129,183,177,9,211,56,77,189,190,24,218,52,73,147,41,188,174,197,128,226,241,63,183,68,248,133,189,81,161,6,5,
+    136,3,122,148,67,92,193,159,148,26,86,101,37,134,134,13,46,61,75,98,138,171,7,52,20,167,182,206,137,215,3,203,
+    222,136,116,235,147,19,188,173,21,238,224,177,125,225,211,21,24,230,227,120,60,115,134,214,41,65,36,190,248,138,237,214,
+    241,3,227,190,58,88,239,60,25,7,176,45,38,147,117,90,42,152,147,163,168,33,50,250,97,247,113,9,59,23,131,244,
+    160,247,44,19,212,92,9,14,132,247,131,43,159,43,162,6,180,247,35,218,68,130,144,154,255,112,15,104,203,78,144,160,
+    231,105,100,99,193,16,42,92,46,158,1,77,113,106,11,100,226,219,211,177,127,197,0,104,58,166,23,213,143,10,193,50,
+    28,5,149,173,169,5,154,164,198,190,113,181,174,32,191,107,100,25,106,106,176,15,209,229,140,31,121,183,9,213,228,108,
+    32,126,28,85,146,164,1,203,45,250,124,118,146,147,6,182,255,117,171,101,153,234,188,123,111,146,210,215,32,153,226,215,
+    163,156,61,221,247,115,177,125,22,248,5,238,40,95,84,74,19,236,13,17,96,44,193,151,40,49,1,14,87,53,107,37,
+    38,57,95,123,114,157,118,87,167,25,237,232,226,168,247,232,168,17,101,202,226,214,229,177,194,16,62,106,151,195,126,82,
+    147,73,60,134,157,121,238,104,153,210,5,34,201,233,251,138,149,229,90,53,12,189,224,108,233,0,112,230,7,30,151,90,
+    228,231,99,236,198,39,37,184,243,78,163,87,153,100,111,210,24,106,225,126,124,49,34,20,27,79,26,11,191,1,186,58,
+    159,9,88,35,6,204,172,30,203,196,64,21,14,79,58,68,6,126,35,141,219,224,199,194,225,8,249,128,1,240,219,179,
+    165,60,165,226,20,51,69,144,177,61,57,75,30,137,249,225,251,127,31,155,59,147,200,9,95,196,150,192,237,27,244,136,
+    151,228,238,162,51,211,143,78,222,255,239,184,90,206,78,37,221,202,166,128,127,224,144,18,76,188,161,146,212,220,203,223,
+    184,61,180,81,15,60,68,89,81,21,207,123,214,95,178,12,84,140,32,190,240,92,20,115,33,141,100,200,47,31,214,29,
+    168,186,132,231,47,252,247,107,153,88,131,250,36,238,182,110,100,67,158,245,92,219,192,223,66,28,186,229,80,32,82,109,
+    132,38,109,62,200,45,57,194,33,228,149,111,82,164,188,210,159,151,126,64,161,221,34,166,144,220,91,196,49,51,4,122,
+    179,237,79,18,27,174,57,199,246,139,240,120,22,53,118,107,8,182,11,154,139,41,136,239,249,129,241,187,155,224,3,254,
+    65,107,252,193,76,27,0,45,90,25,10,246,167,111,207,180,208,26,211,109,150,238,14,38,163,177,242,111,4,128,211,198,
+    212,184,48,121,240,84,158,86,61,105,114,217,56,140,85,251,61,170,193,146,226,175,190,105,189,176,218,60,61,171,27,79,
+    165,163,25,227,9,237,78,176,103,98,160,16,18,208,70,255,166,86,233,97,172,12,4,250,69,82,136,55,36,17,104,57,
+    239,47,133,42,181,241,157,117,218,65,176,224,6,77,222,115,108,76,115,251,139,70,121,67,188,137,187,11,248,95,156,205,
+    183,227,234,51,171,61,56,54,132,187,156,91,6,153,131,243,106,176,96,151,23,76,130,232,63,5,52,169,159,94,188,20,
+    18,82,89,20,213,136,162,9,20,64,91,119,86,50,222,178,108,66,45,245,129,8,255,59,227,90,30,148,189,129,253,245,
+    79,18,232,128,172,133,107,255,164,164,238,244,147,134,98,206,22,15,241,32,10,105,59,162,148,72,38,216,136,168,70,159,
+    128,76,43,24,140,213,25,79,183,214,239,193,70,189,62,103,22,92,249,169,4,5,39,111,223,126,24,225,165,104,26,154,
+    226,188,8,75,80,101,50,144,225,82,1,141,105,240,25,174,180,163,74,215,127,63,188,50,121,124,162,217,167,233,157,56,
+    113,114,102,99,139,216,83,114,134,28,229,76,226,195,21,33,140,128,140,211,126,84,168,159,131,143,146,15,231,65,240,153,
+    243,163,142,170,234,6,251,47,218,171,16,179,84,51,177,218,119,216,178,110,89,149,225,255,112,215,244,27,108,30,251,240,
+    88,108,251,63,95,4,171,212,215,179,191,171,91,156,125,107,116,59,18,5,174,156,7,154,101,205,48,38,183,113,191,123,
+    180,166,221,16,168,66,21,119,176,48,47,193,196,187,42,88,9,23,229,175,46,108,36,29,145,152,42,8,73,72,168,22,
+    129,5,201,70,21,57,55,67,7,245,187,117,172,70,178,224,169,156,10,4,189,154,170,48,160,146,176,181,245,192,95,221,
+    70,218,183,112,73,81,231,151,159,243,167,119,66,42,193,139,49,16,87,212,55,128,133,27,140,218,163,202,155,29,30,196,
+    148,40,157,113,131,211,215,192,146,52,108,176,101,211,184,190,157,177,216,176,27,134,31,176,46,83,70,6,248,218,107,194,
+    243,22,69,124,120,119,235,44,156,174,66,106,206,252,88,32,244,0,115,245,50,174,209,85,136,36,112,238,221,249,1,9,
+    93,53,158,250,138,211,167,226,198,67,169,243,155,24,60,239,245,247,181,42,134,209,155,161,101,14,114,103,138,216,119,55,
+    99,28,55,14,179,16,14,240,234,80,147,200,174,13,12,170,56,175,123,177,85,120,180,251,48,171,18,238,154,211,189,41,
+    197,174,23,197,163,88,180,152,74,52,137,164,28,100,214,51,21,49,119,188,17,6,173,229,26,63,199,201,3,93,6,196,
+    120,149,191,215,6,253,96,26,58,248,16,69,4,124,44,211,159,130,175,118,249,151,164,41,191,103,41,13,228,99,133,224,
+    164,3,239,204,148,98,217,72,8,235,171,178,39,9,93,204,17,243,188,176,71,195,126,68,231,45,150,218,121,243,5,145,
+    58,231,184,3,56,95,6,179,196,172,237,243,99,230,49,61,201,146,246,236,111,114,132,237,214,115,228,239,97,205,49,82,
+    59,2,55,75,101,153,125,150,251,144,234,250,247,219,16,82,161,12,77,57,213,217,118,162,85,97,233,43,224,150,85,89,
+    90,111,255,240,242,159,157,206,254,65,78,7,21,52,149,66,56,254,69,3,175,3,153,119,83,205,90,7,139,188,18,48,
+    140,156,10,13,233,226,21,39,29,188,86,197,252,242,105,212,15,157,31,87,52,44,55,242,93,172,60,85,5,84,164,251,
+    118,167,162,240,26,89,67,10,116,138,26,95,50,141,115,1,248,110,139,24,36,184,182,139,108,136,59,93,242,225,203,105,
+    24,136,234,144,35,9,10,174,155,238,77,238,56,201,29,178,122,40,24,12,196,222,155,215,108,20,31,9,18,9,219,212,
+    66,23,17,21,170,63,68,126,135,115,102,240,37,175,15,1,213,3,116,47,167,89,70,229,220,130,116,198,181,161,1,140,
+    127,59,158,67,75,20,211,121,16,175,218,163,57,20,74,229,168,169,221,186,76,215,175,36,178,170,172,163,156,248,40,220,
+    131,149,184,42,203,162,73,195,133,128,68,203,79,154,87,190,154,134,188,34,95,40,225,203,142,216,10,246,32,195,168,116,
+    71,233,240,51,26,155,199,14,26,236,6,197,42,204,68,3,6,137,240,104,231,3,247,128,16,211,249,112,248,43,113,144,
+    35,3,54,46,79,162,141,181,47,118,215,253,242,152,205,95,31,16,22,36,159,67,89,166,251,2,250,119,185,90,216,63,
+    110,108,58,133,26,90,128,177,72,108,57,102,38,170,112,150,46,170,217,242,127,175,207,155,22,170,128,189,35,145,190,69,
+    188,185,144,96,153,182,194,18,104,185,146,45,143,188,38,35,162,66,232,169,184,232,145,129,39,18,220,119,35,103,254,66,
+    36,44,203,171,159,33,92,3,75,87,229,250,63,60,76,73,170,67,103,248,9,15,155,222,166,151,126,13,88,43,203,250,
+    16,155,225,41,206,254,120,6,221,25,168,8,204,84,188,249,223,9,230,52,161,77,199,203,48,229,241,13,11,91,173,139,
+    236,175,48,45,167,48,37,179,224,163,154,171,148,10,166,222,48,90,212,164,71,33,124,31,134,19,167,212,174,191,13,228,
+    233,221,24,8,237,76,148,65,20,22,95,180,141,128,211,139,8,8,50,63,226,77,84,157,12,17,199,214,242,128,30,153,
+    54,206,157,254,226,169,131,6,46,214,180,129,8,103,79,73,39,106,235,239,81,190,37,136,107,74,239,39,53,88,182,163,
+    69,114,78,170,74,110,189,146,227,67,79,97,199,61,236,192,62,167,13,206,180,56,222,135,126,11,2,222,250,4,147,52,
+    233,246,8,180,163,174,14,130,133,134,227,94,254,172,189,136,118,124,109,132,63,11,115,87,194,160,170,125,40,206,35,42,
+    222,80,160,176,230,2,118,51,20,190,10,42,124,244,160,52,86,3,12,178,160,155,55,9,39,243,252,134,229,165,49,2,
+    154,146,248,45,118,59,208,102,248,226,248,121,135,204,86,126,245,50,5,214,128,127,43,206,241,39,221,218,177,161,219,45,
+    100,216,49,55,201,13,5,0,0,64,236,84,66,188,253,2,136,13,244,126,194,129,49,130,78,70,130,38,80,176,141,3,
+    152,25,135,50,78,163,155,232,4,155,151,52,74,25,212,3,3,129,225,152,251,14,17,219,240,136,242,46,97,127,15,11,
+    141,20,237,243,231,195,246,156,84,218,37,232,166,35,226,144,39,17,35,248,174,95,124,129,129,208,83,198,39,73,28,18,
+    11,222,155,222,100,162,26,20,171,139,129,215,188,140,186,83,242,64,57,107,168,154,165,53,41,153,166,102,230,252,93,166,
+    241,97,191,105,120,237,22,53,54,227,120,235,94,91,245,51,120,140,92,99,85,250,161,52,156,234,110,230,13,157,69,156,
+    151,90,242,125,104,111,50,232,238,218,181,103,122,101,45,171,247,236,59,8,64,203,188,227,253,230,24,108,147,8,35,110,
+    163,239,185,180,160,22,138,160,235,114,38,1,65,162,74,50,29,35,125,162,237,149,255,63,78,169,146,190,251,83,45,244,
+    193,52,100,248,57,124,24,250,172,250,36,197,55,18,138,244,97,248,143,176,183,185,66,169,113,248,132,160,184,213,131,168,
+    137,130,135,177,151,12,155,24,102,116,35,106,203,19,99,63,206,146,212,27,211,34,103,41,202,156,19,238,74,227,105,157,
+    170,102,126,199,70,120,184,158,130,126,247,201,156,37,55,205,237,29,149,201,133,11,161,113,0,147,45,98,27,136,251,216,
+    23,174,174,223,31,62,12,158,55,235,229,51,44,81,6,106,24,164,237,151,44,30,54,48,39,206,232,131,139,30,45,228,
+    37,127,248,180,157,207,37,145,100,123,242,44,18,132,144,201,227,84,100,219,3,174,245,63,163,25,3,219,82,132,226,201,
+    89,177,93,216,132,162,115,185,63,238,102,246,27,159,221,30,88,162,72,191,132,206,206,21,188,196,169,9,200,165,165,26,
+    120,196,177,215,27,49,177,191,212,135,74,22,207,55,122,25,16,180,16,157,122,48,217,207,251,71,189,131,193,140,69,81,
+    136,243,187,147,126,181,50,14,131,253,108,160,214,141,56,6,242,126,105,102,0,183,113,150,191,216,179,203,212,199,203,241,
+    192,156,243,152,203,46,19,124,47,165,57,233,215,28,52,52,28,126,3,211,147,238,192,159,105,0,54,246,145,166,250,230,
+    240,113,127,43,142,91,41,75,92,87,178,176,39,8,255,246,197,6,176,251,145,119,35,205,196,155,232,143,98,216,204,71,
+    2,245,249,232,135,177,255,88,165,166,217,190,90,253,228,128,144,136,158,52,135,51,207,37,202,92,238,173,131,30,163,33,
+    128,109,221,42,189,229,194,38,253,180,176,230,83,186,225,217,244,187,55,11,114,132,168,95,73,72,31,151,14,187,176,204,
+    75,131,0,77,43,68,73,1,75,119,18,145,252,240,52,144,106,9,19,254,216,13,77,13,254,74,101,194,33,34,17,75,
+    250,67,102,144,69,26,15,166,121,215,224,161,83,206,142,91,165,26,182,104,248,12,46,12,42,144,177,120,137,138,185,207,
+    32,151,38,82,179,221,232,35,104,124,18,143,160,252,23,139,156,123,175,237,32,2,236,48,101,70,234,151,102,148,84,231,
+    199,160,203,17,101,215,168,22,41,176,216,207,6,98,228,154,162,185,144,61,167,27,247,78,44,29,52,25,147,115,88,23,
+    143,93,36,16,53,110,117,129,191,148,79,104,150,61,8,4,165,79,114,194,60,175,200,90,173,145,245,252,145,105,121,35,
+    223,92,224,251,94,113,237,232,143,225,166,26,21,242,222,231,143,246,226,45,24,106,0,178,210,12,47,174,6,65,44,203,
+    136,178,156,103,2,57,188,70,60,80,16,227,183,32,166,142,90,92,204,121,209,251,173,28,137,26,201,131,76,78,189,123,
+    68,91,165,131,142,166,202,21,74,235,69,98,158,155,53,141,55,232,214,5,243,166,28,122,42,127,192,122,250,193,133,24,
+    22,104,170,81,88,84,106,111,12,231,149,229,249,111,140,120,103,64,97,117,62,54,101,147,85,9,108,188,215,69,28,58,
+    138,24,223,84,205,169,10,193,185,18,19,22,253,111,58,111,190,99,81,249,68,132,156,12,118,2,66,39,85,108,174,135,
+    59,69,47,84,61,178,10,146,179,251,58,86,190,74,55,228,220,121,31,157,238,120,62,86,200,29,203,33,208,142,218,229,
+    89,9,244,123,103,5,108,232,198,178,31,254,224,183,236,112,249,79,182,195,243,179,189,108,244,67,242,156,56,157,13,99,
+    144,159,127,48,53,13,95,6,18,132,50,75,134,173,118,204,219,190,203,12,73,180,3,235,201,39,51,242,158,67,42,117,
+    112,43,230,63,66,33,71,176,109,219,225,242,115,61,166,181,10,78,232,78,220,182,50,81,173,53,220,152,118,116,10,228,
+    161,211,40,202,60,163,221,245,164,192,239,135,232,12,221,116,1,31,46,133,82,63,133,7,120,28,240,203,169,106,3,0,
+    176,74,246,218,109,24,199,128,154,129,42,251,145,106,29,151,135,167,86,204,25,165,132,131,136,210,76,24,26,236,244,101,
+    134,220,150,182,230,21,74,16,123,154,37,102,97,249,155,175,39,174,191,184,100,157,129,207,105,111,64,206,174,50,47,61,
+    182,223,155,106,199,67,180,80,55,245,44,18,191,133,53,244,28,120,67,101,167,184,242,23,0,125,174,99,167,116,2,230,
+    251,83,254,102,179,183,117,204,247,254,77,192,5,11,126,195,138,155,176,114,62,85,182,228,129,205,205,125,93,24,255,17,
+    169,9,13,182,82,89,71,0,162,2,40,196,170,119,98,100,36,170,175,178,254,136,38,241,228,52,135,111,92,225,189,145,
+    97,192,55,192,245,60,182,229,66,192,103,13,16,204,109,91,171,142,99,18,133,225,98,85,65,210,17,15,220,90,128,76,
+    67,165,32,115,171,237,75,3,101,103,164,8,140,243,80,34,205,132,6,57,111,26,157,225,196,233,156,33,0,43,118,226,
+    204,111,230,3,202,22,65,55,69,121,176,108,205,163,66,33,218,250,250,211,167,201,252,113,4,137,34,114,175,140,35,84,
+    54,16,246,73,216,5,149,204,53,54,190,219,3,216,248,176,58,60,233,252,35,67,20,150,35,221,116,38,102,167,242,190,
+    29,185,126,227,123,165,102,251,56,66,252,171,254,78,148,88,160,60,206,122,70,154,112,247,25,12,76,209,26,87,158,245,
+    52,130,242,247,121,77,71,134,150,8,246,231,197,51,78,143,129,177,113,32,6,185,115,220,161,234,102,141,180,1,119,68,
+    12,118,125,136,175,43,82,49,169,118,33,194,25,163,0,31,183,114,43,3,127,127,111,171,68,238,66,151,118,62,106,51,
+    75,237,95,69,170,205,98,126,109,237,101,75,166,161,119,159,246,106,165,205,31,136,14,192,109,152,47,89,82,40,55,69,
+    23,78,92,234,237,37,234,182,21,117,47,234,240,25,164,117,59,119,63,236,161,97,1,111,106,72,111,240,163,191,196,108,
+    121,73,201,154,175,20,76,151,169,32,178,165,19,89,119,79,167,44,160,196,31,238,123,201,44,235,247,249,7,205,114,74,
+    195,239,245,75,188,75,224,83,190,7,47,209,122,8,50,168,187,114,223,166,82,253,75,30,224,80,143,231,153,231,207,78,
+    237,94,181,45,94,182,224,248,123,106,93,197,186,129,250,132,233,74,57,204,109,132,252,89,86,190,31,100,27,121,236,191,
+    73,88,17,124,229,222,171,188,89,15,34,34,28,54,41,159,102,137,36,147,197,215,144,54,126,67,0,243,63,53,31,64,
+    98,64,96,93,9,233,154,62,214,53,251,165,67,40,134,222,210,39,137,20,17,133,255,98,38,154,9,138,97,207,202,20,
+    86,25,162,193,184,215,114,40,47,155,27,77,6,77,224,26,208,56,220,192,62,198,72,57,100,86,97,17,34,52,166,231,
+    35,13,252,144,41,86,168,155,48,60,195,21,31,87,161,30,150,67,225,64,229,181,80,150,52,24,143,75,54,94,56,22,
+    90,86,15,129,48,55,58,55,114,79,75,125,149,113,251,51,244,42,120,4,221,168,250,100,22,141,125,197,216,53,11,38,
+    141,197,121,119,149,235,102,163,140,212,229,120,49,121,124,20,58,10,5,0,40,161,229,176,115,12,4,24,108,219,168,18,
+    137,160,63,117,112,39,7,26,19,18,17,35,159,29,184,18,73,98,23,238,131,42,199,29,113,245,160,18,163,250,238,125,
+    125,252,13,219,88,93,11,22,0,15,231,166,201,91,119,141,79,252,229,103,204,202,216,126,110,77,208,27,85,208,20,78,
+    21,154,192,190,46,60,104,124,202,110,197,117,168,21,98,245,203,146,133,224,67,67,235,210,241,92,28,228,87,88,178,92,
+    136,129,151,58,150,187,44,194,203,65,223,148,143,93,26,91,89,12,24,14,81,70,10,100,32,66,205,212,77,108,194,204,
+    41,69,137,153,118,139,254,127,99,16,124,250,166,168,213,61,50,167,126,141,196,141,22,124,233,114,192,63,201,158,107,53,
+    94,148,201,91,222,131,208,81,73,240,232,162,81,218,114,170,135,183,160,20,190,174,142,66,110,152,244,167,75,146,196,156,
+    154,67,230,167,161,201,175,216,163,162,126,195,73,200,25,35,11,224,21,100,35,251,37,188,58,46,5,183,41,74,246,202,
+    173,201,209,156,145,2,114,217,132,221,238,219,120,114,166,237,70,26,234,23,119,123,25,209,213,39,223,81,112,10,209,254,
+    210,50,33,72,31,117,12,49,110,242,62,18,42,108,50,58,26,215,32,146,82,193,58,103,209,33,168,231,72,31,130,20,
+    101,125,205,242,160,2,179,109,60,15,197,233,36,155,116,230,59,150,48,34,33,20,143,96,32,238,2,214,145,230,112,168,
+    65,43,150,122,233,100,29,180,64,111,43,120,224,121,242,154,40,168,40,188,35,215,239,58,109,144,114,191,188,52,161,9,
+    121,107,135,108,118,70,90,14,124,241,62,22,213,161,48,121,74,4,43,29,193,166,194,240,28,98,185,188,0,40,252,28,
+    241,239,181,0,13,87,48,181,250,216,163,6,205,25,56,64,131,242,74,9,210,193,178,125,241,143,30,96,230,147,180,20,
+    244,21,39,221,247,80,149,242,80,19,161,116,237,123,101,242,44,52,47,207,89,126,185,121,253,41,104,72,187,99,127,198,
+    158,225,115,208,175,162,219,188,101,215,125,41,214,229,60,54,44,173,226,182,19,74,18,56,34,167,10,9,228,46,230,115,
+    187,141,133,57,199,172,70,73,64,109,151,225,212,74,215,65,45,117,2,25,118,42,194,211,185,99,117,3,161,216,59,121,
+    223,18,31,194,191,17,33,49,74,79,241,106,119,137,31,170,211,123,8,128,96,139,55,34,63,27,232,211,115,100,147,222,
+    88,53,238,68,201,212,188,245,31,63,169,221,11,164,85,243,31,152,225,58,48,180,22,253,138,149,121,234,134,75,159,244,
+    30,201,74,196,70,54,132,188,52,197,154,221,112,92,136,8,16,3,109,196,247,235,169,186,22,238,139,63,135,242,135,144,
+    126,234,127,123,124,30,219,148,145,123,138,96,139,106,216,180,61,21,243,131,99,70,199,251,5,124,135,120,6,21,41,130,
+    220,138,43,8,118,142,189,178,101,117,230,0,246,122,208,80,105,193,228,205,136,30,104,176,119,116,141,78,153,3,38,152,
+    89,233,227,214,30,124,239,113,216,106,255,218,28,46,202,34,212,102,96,134,236,233,78,55,101,154,70,59,245,6,221,140,
+    28,64,51,83,75,202,234,159,51,148,229,68,162,245,95,2,182,166,84,49,229,90,4,186,89,159,35,151,238,40,118,40,
+    84,64,64,226,105,48,121,239,121,139,202,141,220,86,29,74,169,214,189,28,181,167,178,78,136,233,226,65,174,159,235,91,
+    87,41,130,153,238,92,154,29,199,241,204,0,241,109,247,89,152,139,56,106,82,178,201,175,151,128,51,164,104,46,49,39,
+    45,75,129,242,104,187,64,212,47,210,85,212,116,86,79,24,228,29,36,101,161,71,141,88,162,154,158,186,254,204,130,80,
+    109,209,223,155,4,208,95,14,66,130,60,240,207,207,94,31,90,42,231,84,197,165,38,217,209,41,124,143,77,125,240,49,
+    217,124,24,240,8,73,150,213,219,109,132,223,42,238,229,60,248,54,188,161,220,252,109,24,151,93,176,31,9,80,233,112,
+    41,148,27,141,175,45,196,31,140,240,189,27,124,39,181,30,141,192,158,177,192,98,187,42,25,17,120,21,205,0,42,37,
+    192,182,135,108,66,29,38,150,185,183,218,27,248,95,250,177,178,189,196,50,181,134,73,49,38,25,25,135,166,134,43,151,
+    207,84,237,94,208,45,124,140,141,62,211,19,5,193,122,2,222,21,147,17,12,113,146,101,218,7,167,119,218,153,124,168,
+    192,248,191,219,38,181,6,167,232,63,179,24,135,63,131,94,103,57,163,120,127,3,175,75,35,113,139,249,89,9,14,67,
+    39,28,245,202,91,186,33,81,62,198,234,197,64,121,177,40,69,12,71,191,67,95,203,41,194,203,125,127,173,135,194,17,
+    191,168,99,167,205,237,115,42,89,10,31,216,23,221,3,40,148,3,158,68,29,173,78,68,69,9,214,211,161,208,148,64,
+    67,27,119,189,181,197,91,115,128,103,119,163,253,197,162,247,97,55,235,171,49,66,47,253,97,77,28,187,244,121,254,28,
+    116,48,10,63,232,100,31,69,200,217,19,123,115,188,47,161,88,30,25,98,99,130,145,127,45,120,213,12,45,153,230,218,
+    117,155,133,132,206,72,53,56,79,232,102,245,218,69,248,209,235,238,28,84,106,83,14,91,93,6,121,189,86,29,105,22,
+    189,28,103,109,91,133,74,201,94,245,72,151,91,173,238,205,124,153,113,41,8,189,141,170,160,50,64,13,176,5,14,51,
+    172,62,165,15,180,40,237,221,24,88,121,5,69,217,19,204,160,80,10,179,94,214,139,234,160,32,25,97,29,200,114,41,
+    124,30,218,86,150,173,143,114,238,107,211,80,110,79,105,198,252,162,221,75,206,78,244,209,87,30,158,181,215,110,43,239,
+    130,32,38,93,243,231,187,111,133,190,240,195,2,174,238,179,152,197,101,148,32,10,103,185,202,63,98,139,34,163,206,177,
+    127,4,167,33,243,37,206,21,54,94,248,222,149,201,166,21,48,145,57,66,182,44,30,153,27,242,62,134,209,11,97,181,
+    2,239,1,18,241,70,250,166,63,205,53,119,48,1,176,84,107,157,38,121,75,54,70,80,7,145,251,26,87,204,228,131,
+    8,116,130,69,44,130,80,125,166,104,139,91,45,43,190,207,176,13,116,234,155,51,130,159,240,108,103,59,199,6,233,108,
+    131,109,108,248,2,90,240,36,90,161,216,72,198,153,43,77,90,63,229,126,210,152,113,16,83,130,234,100,0,101,12,42,
+    81,51,230,166,238,133,31,180,43,40,252,116,75,109,199,69,193,83,95,245,163,101,33,25,231,224,97,142,185,89,148,36,
+    232,233,178,253,166,164,143,42,1,138,57,217,205,216,103,33,138,141,172,206,226,136,25,137,137,248,233,113,18,40,255,187,
+    69,72,22,217,202,170,52,118,93,76,71,226,19,125,206,113,176,107,66,197,117,181,6,69,21,89,120,198,18,62,148,226,
+    212,46,70,220,108,22,149,160,186,92,5,211,100,183,57,100,112,9,21,209,84,156,153,43,191,82,21,80,16,166,202,236,
+    189,69,212,231,9,136,201,226,134,154,114,76,11,228,252,206,179,212,98,72,152,145,171,245,129,144,59,229,74,77,21,202,
+    225,120,69,222,106,164,109,246,229,111,146,193,8,178,144,6,23,252,77,199,10,7,102,188,186,39,54,15,7,139,45,169,
+    125,38,140,44,113,95,93,172,249,13,148,38,193,177,41,179,221,12,213,97,2,148,218,135,62,33,79,5,74,145,208,130,
+    167,125,86,11,72,218,49,84,230,9,125,74,208,164,45,158,120,112,139,88,225,151,92,23,88,195,190,141,28,51,53,18,
+    76,2,10,33,28,88,183,31,245,152,253,50,98,147,236,70,12,95,232,63,141,160,109,87,97,139,226,255,84,18,54,79,
+    234,18,84,85,65,216,22,1,59,164,49,7,75,187,247,22,76,227,252,77,135,163,200,86,77,70,37,80,94,112,182,43,
+    69,68,142,112,148,131,190,233,173,117,217,134,46,11,226,72,97,245,14,106,211,254,181,95,159,239,1,124,175,169,191,16,
+    42,96,101,73,55,36,50,186,135,123,114,186,81,136,56,178,158,100,116,34,79,70,59,222,152,164,118,51,240,6,33,28,
+    192,162,157,253,229,240,36,188,100,199,27,53,14,104,40,119,160,57,40,162,230,192,94,228,163,187,142,106,175,11,45,226,
+    32,101,50,234,95,9,86,227,99,222,211,133,70,235,168,116,43,129,249,134,120,154,193,135,121,13,97,84,104,154,209,186,
+    238,165,139,198,45,116,132,159,85,114,75,210,5,71,159,151,145,146,60,140,227,229,251,127,63,158,107,149,199,228,49,119,
+    32,159,162,156,10,51,156,237,244,56,162,202,52,255,129,167,135,201,28,161,39,51,150,172,222,58,7,118,83,254,129,8,
+    42,2,155,182,89,226,154,236,72,1,69,12,252,218,102,102,242,209,202,249,73,108,97,185,248,84,118,87,243,185,233,180,
+    187,85,250,81,27,224,159,104,77,187,103,125,131,96,255,21,13,233,202,20,24,168,214,80,239,44,199,71,0,151,34,175,
+    196,141,153,140,58,127,66,88,33,109,168,182,152,236,147,158,112,174,179,93,100,44,46,147,37,190,13,93,86,181,0,143,
+    155,242,153,43,32,202,152,49,63,215,161,237,88,65,209,188,212,65,94,178,83,169,228,122,119,32,144,174,237,151,161,124,
+    84,15,151,177,238,33,9,175,74,23,155,83,207,96,193,242,77,15,116,120,174,175,49,215,115,250,26,115,76,101,93,105,
+    114,233,235,187,78,34,58,26,12,123,250,27,52,27,220,46,121,51,37,222,76,76,104,107,44,112,35,202,45,101,203,213,
+    23,212,60,195,254,127,125,243,2,214,98,23,233,81,2,76,126,242,102,3,123,161,226,124,220,79,157,163,127,46,244,228,
+    107,18,237,92,112,100,33,38,176,122,237,76,207,209,75,130,52,190,244,214,111,59,210,32,171,0,98,98,92,169,29,15,
+    109,29,118,191,40,161,16,57,107,16,223,231,213,41,219,175,242,201,24,195,3,20,169,200,248,167,66,198,26,46,173,58,
+    192,106,115,232,170,32,105,207,111,45,124,39,176,204,242,23,175,228,24,76,174,215,238,182,182,253,26,132,16,109,129,47,
+    244,168,169,34,157,24,130,54,229,97,166,229,233,86,118,116,125,15,217,101,109,30,246,235,85,7,155,4,30,216,43,205,
+    69,4,118,97,240,167,3,61,109,88,107,25,242,211,224,57,129,86,140,53,251,93,2,208,143,100,88,42,231,43,61,116,
+    85,153,74,251,32,217,220,2,207,198,226,208,239,61,213,8,61,153,189,33,150,79,50,204,113,141,191,58,240,15,42,111,
+    60,190,83,94,131,24,138,121,126,8,236,189,11,174,134,47,124,33,108,193,7,232,227,7,70,39,244,4,32,32,112,116,
+    57,188,238,2,2,95,170,119,9,170,141,118,42,186,214,112,155,186,235,153,236,145,13,110,167,11,173,107,202,135,96,101,
+    45,2,228,150,28,84,3,102,84,29,228,100,13,149,186,179,37,10,149,74,20,89,114,53,133,86,47,8,243,184,121,207,
+    24,25,213,145,146,79,159,201,104,243,162,17,152,227,27,213,80,239,42,233,221,140,137,44,78,157,169,251,201,144,180,77,
+    73,237,26,171,95,238,19,64,111,237,157,147,152,25,125,46,225,232,48,199,0,16,44,20,226,254,179,249,19,12,206,183,
+    64,91,2,12,204,44,94,252,77,29,30,221,78,197,46,111,229,83,126,0,79,72,149,70,199,47,159,174,110,182,142,79,
+    206,115,141,116,222,180,30,29,108,119,229,105,217,239,154,22,186,77,107,96,68,64,87,60,21,98,213,253,116,59,192,220,
+    91,46,14,95,76,102,140,61,8,152,135,94,9,193,140,220,161,212,46,161,9,72,250,219,252,187,119,78,107,150,248,202,
+    98,209,58,250,120,64,205,213,213,239,105,237,14,61,214,145,227,96,91,29,120,167,83,252,245,199,102,114,121,239,109,179,
+    238,217,53,30,67,111,86,156,157,36,48,84,83,142,133,134,135,27,93,208,18,151,235,243,152,0,9,149,42,169,249,137,
+    235,7,103,155,54,174,115,237,35,59,96,13,193,111,249,152,96,63,231,150,146,84,183,79,67,9,209,127,232,229,192,103,
+    73,242,215,213,231,167,53,71,76,221,77,165,120,118,117,91,106,114,84,163,187,251,8,211,99,116,103,49,146,70,26,55,
+    90,28,54,40,35,26,16,13,158,55,92,34,191,193,109,54,164,155,198,205,158,135,108,41,156,118,200,211,76,106,103,95,
+    252,250,34,103,228,134,65,154,242,245,10,235,48,234,56,152,170,235,5,113,66,58,0,144,173,242,6,109,67,171,161,76,
+    44,109,24,246,170,43,161,171,36,100,112,173,48,126,189,114,143,22,165,99,226,247,30,209,67,21,165,75,122,20,184,122,
+    67,0,119,202,109,242,223,42,170,60,249,35,248,4,71,79,238,17,14,57,30,155,45,5,49,97,212,139,191,231,239,4,
+    193,171,223,68,27,238,90,17,110,230,241,69,25,221,107,119,96,237,250,137,45,25,29,212,104,235,175,42,2,228,186,47,
+    70,117,181,36,113,130,221,117,111,227,83,14,5,203,234,211,39,252,56,157,242,211,219,117,23,167,190,221,61,27,248,166,
+    105,134,161,210,82,12,222,174,108,245,108,91,45,35,225,166,255,48,111,151,59,237,40,74,222,166,155,126,70,61,41,167,
+    43,17,148,194,86,147,72,164,124,2,84,216,30,3,13,98,45,22,208,222,22,106,101,172,31,41,120,64,70,237,187,156,
+    18,251,75,154,230,178,120,113,21,247,86,145,154,134,70,90,145,2,115,167,116,24,90,86,190,222,208,31,104,243,23,199,
+    195,156,202,192,3,12,34,207,58,17,44,197,236,232,153,194,11,101,165,89,165,20,157,147,199,3,7,154,232,146,57,134,
+    149,251,37,35,75,136,174,63,201,90,101,132,45,67,143,245,1,251,117,130,90,48,252,178,142,252,15,155,4,180,42,249,
+    74,10,131,80,140,109,120,169,53,12,97,230,245,22,175,246,75,25,124,238,248,122,157,217,79,209,218,49,17,209,149,105,
+    190,245,219,249,7,207,180,46,11,111,236,199,238,242,213,148,204,250,9,201,242,220,126,158,205,238,232,241,253,70,240,218,
+    62,112,32,17,49,129,43,169,246,240,99,19,64,28,220,79,209,73,120,19,79,118,138,79,140,82,131,171,200,78,149,1,
+    80,151,226,74,77,82,184,13,239,33,238,8,75,244,187,47,8,213,117,116,98,159,74,28,63,94,212,83,94,11,160,51,
+    249,41,74,212,46,193,118,12,110,133,197,235,133,107,153,12,97,25,28,209,201,5,231,253,103,19,179,245,139,24,72,211,
+    113,18,174,46,155,28,107,245,56,10,113,154,199,223,175,16,63,24,174,198,166,40,4,182,119,16,146,89,169,86,64,244,
+    121,18,166,60,14,84,86,166,224,18,171,249,246,114,220,88,127,29,202,108,120,29,214,95,186,81,136,213,21,179,122,81,
+    191,34,103,233,255,187,136,198,130,24,113,168,246,243,239,228,135,15,239,38,131,16,83,64,134,16,158,237,237,188,221,224,
+    201,176,135,229,61,250,180,225,140,149,145,226,233,96,152,182,167,200,217,189,25,235,33,80,7,201,211,217,138,182,75,37,
+    221,239,76,81,136,141,129,72,127,49,233,23,12,56,32,178,205,140,181,201,174,208,43,116,75,44,179,218,212,228,152,6,
+    11,186,174,249,17,145,123,4,166,18,132,75,180,230,47,197,182,23,33,62,68,89,73,106,204,89,234,83,71,58,136,26,
+    90,125,229,86,71,92,3,188,77,120,151,93,236,103,55,51,133,77,141,69,248,179,90,115,157,78,45,24,231,149,24,21,
+    158,110,212,81,103,202,6,104,21,243,51,56,102,134,175,100,26,250,181,198,45,92,118,153,74,85,73,251,81,112,181,18,
+    30,245,79,235,239,251,186,156,111,201,23,181,152,84,121,119,234,66,132,149,184,64,221,125,187,108,165,42,170,78,42,178,
+    158,159,92,105,236,172,42,255,248,117,91,175,227,25,238,104,245,83,51,200,173,74,31,10,246,118,183,211,7,63,99,252,
+    231,114,64,126,174,55,0,171,39,95,227,126,5,94,188,250,191,93,97,171,131,120,21,27,5,96,208,68,112,87,86,84,
+    94,59,142,155,77,192,207,27,132,1,229,141,10,130,216,82,0,175,112,86,98,255,116,171,207,16,59,163,16,79,59,57,
+    228,15,2,187,215,96,45,200,231,35,78,145,2,182,12,149,255,36,95,159,116,247,141,167,43,216,113,170,102,222,216,246,
+    245,44,61,76,43,204,131,157,180,40,64,212,213,168,140,245,78,235,18,154,38,206,183,32,168,49,90,173,15,162,233,11,
+    128,139,84,25,36,186,255,151,100,44,103,24,148,205,110,226,184,226,250,156,67,140,161,114,231,17,202,11,83,116,157,144,
+    75,233,198,170,84,85,111,253,73,65,185,41,76,165,62,207,79,255,181,57,183,130,49,195,102,34,106,244,63,25,206,136,
+    85,41,89,107,36,91,95,135,179,24,73,97,84,130,80,141,150,53,57,220,129,140,188,188,147,34,109,26,243,91,236,15,
+    192,37,39,224,40,63,25,90,91,57,45,46,65,248,249,46,0,208,10,251,75,172,252,79,255,17,97,80,57,105,234,23,
+    35,109,59,135,185,47,196,149,251,108,101,166,25,61,186,145,245,101,124,82,22,157,28,55,114,246,96,181,90,66,83,157,
+    215,242,190,65,73,68,132,155,208,251,121,7,118,223,90,154,187,58,229,36,149,194,62,76,183,72,255,43,207,100,145,14,
+    192,133,232,218,240,18,1,4,202,6,208,224,118,45,114,26,197,82,92,150,8,249,212,23,157,68,248,127,167,117,208,2,
+    41,44,231,175,190,130,233,232,33,202,137,221,109,160,62,65,39,209,151,12,21,43,151,33,29,171,14,68,6,224,13,188,
+    216,139,3,134,17,237,43,32,220,152,222,195,80,74,36,37,74,15,198,205,203,56,161,43,243,205,80,16,88,210,218,96,
+    45,4,28,139,110,223,13,247,30,68,25,157,171,118,100,246,119,109,81,173,167,193,146,114,27,90,215,18,161,107,116,9,
+    23,234,246,23,92,243,197,220,112,30,70,65,250,90,79,171,43,67,151,168,98,237,26,60,212,223,199,132,205,77,181,164,
+    99,211,127,87,50,211,49,117,102,202,105,21,226,157,205,29,8,17,162,49,166,182,22,27,82,151,42,237,117,10,60,153,
+    92,157,170,128,237,197,148,52,127,93,173,38,252,206,234,198,37,88,88,206,21,52,233,88,40,80,1,95,12,23,100,167,
+    119,141,135,106,149,140,192,79,23,152,166,83,168,108,170,32,77,19,21,146,189,146,114,151,103,8,183,128,119,10,226,171,
+    104,5,220,55,100,196,16,7,32,246,189,73,64,37,136,22,147,254,174,176,32,250,108,58,145,237,240,42,242,245,23,116,
+    246,205,29,74,41,91,168,15,238,208,120,194,64,158,208,61,238,143,177,18,208,122,160,55,145,141,250,159,83,140,90,49,
+    218,71,149,165,8,119,201,140,251,239,214,92,141,115,110,40,147,84,220,150,196,93,239,59,134,42,106,165,204,59,225,50,
+    234,41,94,11,128,60,55,127,111,149,200,35,244,96,104,15,105,23,113,129,131,12,111,103,192,126,36,48,151,10,108,218,
+    137,216,244,46,130,240,209,253,216,192,160,230,205,66,208,234,117,0,115,84,197,231,158,47,134,141,160,217,207,131,75,64,
+    129,151,179,220,159,86,73,107,231,1,231,27,76,168,124,86,89,73,226,172,145,148,118,101,187,98,20,3,237,171,60,98,
+    199,115,96,249,220,179,228,174,231,14,10,66,204,165,132,173,120,224,238,234,128,118,189,204,236,128,77,40,246,88,69,252,
+    229,139,17,79,231,187,224,115,205,165,215,167,239,241,149,100,170,164,3,122,30,121,50,108,23,200,207,223,93,246,39,203,
+    219,161,249,97,122,40,44,195,225,176,250,27,8,159,163,95,241,183,99,222,186,37,136,125,135,149,105,196,14,66,166,197,
+    196,186,233,251,208,180,3,207,155,136,51,235,201,154,253,199,143,3,136,80,121,44,87,28,28,0,177,187,72,70,243,26,
+    82,194,5,137,75,48,94,163,160,85,248,142,186,131,109,241,178,83,22,65,30,105,6,112,93,200,209,159,166,77,31,114,
+    90,219,153,144,23,193,50,51,249,155,156,216,109,60,186,170,246,151,170,115,48,163,127,147,44,244,162,189,20,90,241,34,
+    72,27,244,90,209,119,104,155,230,75,238,90,171,144,156,30,88,202,157,66,179,87,28,153,147,146,177,247,115,236,170,191,
+    123,75,45,114,188,83,104,253,243,122,37,176,209,208,167,77,218,82,45,19,13,70,120,99,57,73,78,100,116,152,57,151,
+    118,101,236,27,176,209,120,254,133,91,168,238,7,203,136,108,135,127,153,79,128,240,144,103,4,118,230,103,71,213,3,190,
+    143,15,210,84,9,184,11,180,155,30,135,91,0,210,62,82,206,1,99,178,2,157,223,183,74,96,133,152,194,179,167,176,
+    1,254,3,113,184,157,160,188,0,213,171,46,43,147,93,146,38,213,181,40,178,241,163,169,206,232,79,205,202,178,46,176,
+    147,237,83,181,252,54,132,184,154,61,63,86,38,99,11,103,78,248,160,228,236,8,7,43,163,137,100,86,27,159,163,11,
+    128,248,79,198,119,93,100,186,99,137,70,218,221,103,37,214,109,177,230,199,128,40,189,73,231,57,84,19,134,142,148,152,
+    168,143,175,242,65,183,52,124,172,152,252,40,47,204,203,123,33,25,143,166,76,7,86,42,75,189,158,164,86,244,4,26,
+    204,27,118,42,59,121,36,144,185,46,112,61,164,35,56,52,146,56,101,58,69,118,106,164,150,45,113,206,71,209,235,123,
+    202,36,201,83,38,185,123,77,78,66,208,95,80,26,79,177,237,63,69,141,75,46,175,23,225,11,37,139,57,59,67,113,
+    200,194,175,82,200,152,64,94,11,5,166,147,251,201,164,207,36,119,20,57,231,198,62,104,157,186,17,43,233,85,93,10,
+    147,181,51,40,225,242,221,137,11,1,69,230,210,46,59,154,15,12,244,193,129,20,25,12,177,63,228,204,197,57,23,4,
+    17,21,158,59,125,127,172,155,144,14,130,234,171,113,249,123,49,239,144,147,172,37,144,125,129,10,138,158,19,2,188,115,
+    64,197,223,203,48,87,25,7,5,222,241,163,188,6,233,131,14,210,155,204,180,108,177,128,5,180,122,212,41,24,136,117,
+    27,211,124,108,110,163,138,24,156,81,142,255,126,180,204,37,92,41,61,185,21,162,189,139,44,126,204,4,188,82,72,197,
+    169,65,228,199,114,244,120,27,11,68,240,17,183,175,57,196,241,231,91,101,10,131,110,5,214,228,230,19,229,39,141,242,
+    199,104,25,95,148,43,196,247,153,7,9,138,137,35,36,193,137,0,37,10,192,236,33,91,106,78,113,148,120,214,115,49,
+    45,78,123,94,17,38,56,142,91,44,179,235,88,59,25,22,176,69,107,229,91,234,205,117,179,87,60,142,69,222,230,154,
+    125,77,50,73,101,27,151,57,217,99,169,157,65,245,9,224,250,175,76,20,249,92,75,225,208,23,21,92,19,115,105,123,
+    199,247,234,91,199,102,205,114,124,19,8,146,201,34,2,145,80,244,48,113,187,161,22,57,193,227,56,182,169,82,143,25,
+    216,114,214,252,11,57,145,33,115,175,232,174,14,125,48,11,52,204,225,176,82,55,57,49,73,209,16,29,15,88,119,54,
+    243,213,16,82,21,185,33,137,232,201,113,15,215,2,60,168,239,155,185,220,67,63,89,240,200,141,115,140,188,97,86,133,
+    146,250,145,22,23,176,105,56,196,130,129,207,103,176,166,46,118,45,75,134,150,157,2,0,33,22,54,72,98,227,236,0,
+    194,147,61,83,148,245,22,118,212,5,107,95,74,42,42,15,139,107,9,44,250,49,68,49,207,120,21,130,115,104,246,172,
+    4,90,64,172,96,184,120,39,150,198,245,232,246,46,121,188,250,241,143,119,59,65,10,212,7,97,193,186,44,83,84,186,
+    125,10,235,171,89,81,78,8,250,246,252,19,148,214,113,21,108,108,240,115,148,240,19,13,25,65,158,54,126,165,115,13,
+    27,102,28,17,35,229,150,201,52,243,20,146,161,101,4,193,233,142,124,187,188,92,213,244,139,1,60,235,189,227,175,64,
+    218,227,73,18,44,215,70,54,33,33,200,119,114,152,130,111,55,168,10,194,40,250,150,190,14,220,3,185,94,143,145,176,
+    5,33,255,175,145,130,56,186,2,50,244,228,100,195,88,91,13,194,16,229,253,222,29,200,9,172,18,46,97,190,112,2,
+    237,136,250,42,123,157,150,48,91,9,33,59,70,210,172,173,211,54,134,85,104,243,198,212,29,165,235,14,29,255,19,64,
+    240,26,253,9,170,128,129,28,97,83,5,68,60,252,111,111,156,73,219,143,61,96,80,252,141,74,231,95,169,15,160,232,
+    136,94,155,197,100,180,60,201,208,132,30,34,198,124,53,35,219,140,220,158,196,252,161,87,222,103,103,51,191,99,67,61,
+    147,131,105,88,5,79,222,29,19,130,7,129,194,163,150,17,69,209,23,128,124,136,17,146,122,89,17,55,251,177,171,211,
+    198,164,199,21,219,104,99,191,47,121,71,107,170,125,18,45,39,118,64,116,217,188,68,206,50,67,52,145,236,120,45,14,
+    101,98,76,133,112,55,72,11,33,147,246,29,27,50,17,8,39,131,181,231,82,219,109,69,251,100,210,226,28,169,189,233,
+    111,26,219,46,102,130,45,69,138,122,212,231,103,200,108,91,223,209,218,253,121,59,38,6,222,125,27,163,215,109,255,145,
+    218,194,135,131,108,216,12,66,178,195,216,177,53,123,25,36,160,192,232,107,124,162,247,169,195,226,153,112,104,168,226,35,
+    110,250,77,177,239,43,223,40,144,48,225,217,98,45,237,210,249,211,188,57,169,133,63,215,202,4,110,145,114,14,216,64,
+    53,23,30,175,234,163,182,151,144,139,76,22,246,76,148,41,92,138,142,26,211,227,1,156,64,167,95,160,37,61,37,255,
+    138,55,77,31,62,206,7,144,125,182,96,32,223,136,7,8,96,174,159,112,218,165,146,238,106,47,115,16,204,168,56,90,
+    38,132,137,173,50,118,63,72,219,159,141,187,179,215,36,10,17,53,162,77,159,184,178,55,229,106,209,128,129,93,54,126,
+    213,62,90,176,221,15,33,87,120,206,83,115,215,181,252,186,30,90,190,247,70,177,176,119,39,199,173,43,182,174,201,197,
+    143,81,123,22,176,229,239,78,244,104,169,223,215,175,155,100,102,127,68,71,205,90,51,107,183,50,73,225,71,70,175,56,
+    5,8,88,75,198,44,79,105,17,218,212,193,113,134,143,5,201,128,82,62,200,58,2,249,166,70,64,234,255,83,162,97,
+    179,18,248,156,173,42,69,59,54,253,48,54,202,98,61,86,156,87,36,48,179,99,173,187,74,196,22,180,168,89,184,36,
+    78,203,3,178,56,224,206,227,185,193,209,7,120,126,173,11,138,180,147,4,154,189,96,11,236,246,117,206,154,23,33,125,
+    36,2,98,102,141,18,63,170,34,22,149,109,126,159,158,165,68,3,135,49,7,104,152,134,155,119,56,171,166,183,76,95,
+    119,54,169,44,179,211,89,86,122,108,75,103,21,186,23,28,27,111,76,220,149,143,83,42,21,7,27,173,226,149,205,50,
+    26,165,81,149,241,14,50,50,163,243,65,226,218,197,141,235,180,242,38,192,164,130,39,225,192,100,116,156,179,91,34,239,
+    39,143,47,190,142,183,215,67,60,148,22,189,148,176,166,66,19,10,13,22,71,253,120,121,213,189,9,178,67,164,145,157,
+    7,107,32,110,65,142,160,121,14,97,195,43,41,201,180,91,249,191,163,199,136,53,186,82,251,62,229,149,133,71,110,82,
+    114,146,141,170,39,183,55,191,211,141,30,68,20,8,148,152,87,226,130,90,160,71,155,70,32,93,135,75,73,129,150,72,
+    217,96,22,29,109,203,13,57,210,37,176,41,100,89,149,43,31,99,0,201,53,58,30,221,5,70,72,28,21,146,78,117,
+    76,16,117,148,27,207,75,41,152,195,111,148,167,53,98,137,148,206,93,37,165,89,26,98,102,28,116,71,92,56,150,232,
+    157,241,51,46,107,60,148,201,111,167,120,161,51,129,135,224,105,162,118,213,129,145,178,178,43,31,82,89,244,135,120,116,
+    197,132,39,175,250,228,107,199,75,133,112,90,89,241,253,13,25,124,31,32,229,200,137,17,89,129,13,140,104,185,14,197,
+    227,210,93,116,246,143,246,191,123,223,8,88,127,93,14,189,244,253,197,123,45,134,191,190,7,67,144,112,47,5,205,171,
+    105,106,20,35,83,36,4,9,89,180,11,41,94,103,176,22,46,191,23,252,152,141,17,224,147,242,191,42,118,205,198,225,
+    116,87,171,244,228,211,77,146,232,89,245,231,239,97,27,140,101,92,106,96,55,228,4,73,224,110,95,191,102,167,197,209,
+    173,131,73,107,106,168,96,58,182,110,162,79,38,174,19,182,173,154,22,147,152,248,159,184,8,205,0,223,243,205,30,177,
+    5,56,67,64,226,43,168,10,29,199,216,40,202,224,203,19,22,193,143,249,210,3,190,1,178,208,23,21,87,60,21,42,
+    152,160,193,222,9,214,29,173,142,52,61,237,232,14,166,167,95,207,135,64,203,214,220,233,72,189,177,244,253,184,118,133,
+    236,142,198,81,217,29,51,122,37,141,179,62,237,189,61,254,37,18,102,210,229,197,246,112,224,109,153,178,223,111,3,32,
+    10,147,158,3,176,35,21,29,74,152,18,113,87,40,18,19,48,176,81,139,69,61,249,18,216,112,163,173,253,8,112,160,
+    231,101,68,215,253,91,50,39,240,51,79,23,29,119,137,28,37,229,79,210,168,114,246,141,31,142,15,218,251,43,179,28,
+    222,222,204,222,139,61,176,204,138,222,38,98,206,170,172,187,122,46,48,109,172,26,66,40,117,32,173,218,250,83,37,253,
+    22,3,65,150,98,17,230,248,200,19,210,216,134,152,118,194,121,130,221,19,52,12,4,193,123,148,228,37,46,231,9,118,
+    254,10,253,245,193,109,246,131,105,221,131,144,1,77,214,65,217,203,88,136,6,10,53,94,216,217,88,79,143,6,51,145,
+    221,220,223,171,236,63,202,12,189,241,75,4,101,177,174,253,39,152,239,114,229,92,209,27,165,9,135,161,218,180,94,161,
+    221,253,60,55,86,237,132,254,127,249,30,53,228,66,6,105,169,202,16,34,10,138,163,30,217,7,79,223,174,44,21,110,
+    53,3,13,127,1,133,205,248,143,203,233,58,165,138,17,60,156,183,137,220,67,198,58,167,138,34,156,46,223,187,3,240,
+    225,54,84,104,100,151,207,96,6,115,93,119,214,233,54,226,102,180,97,213,234,188,44,217,101,42,117,5,58,232,131,210,
+    207,131,152,193,212,116,130,247,7,51,133,28,12,155,62,47,219,5,98,159,7,206,59,57,218,132,224,130,26,222,194,185,
+    231,123,252,82,16,99,210,177,196,14,20,139,101,189,219,253,255,70,69,167,85,143,3,127,245,69,117,5,61,138,230,202,
+    140,245,251,20,34,106,90,63,241,125,39,52,179,74,161,72,150,11,35,242,87,94,181,15,17,18,247,79,167,145,217,92,
+    67,227,241,52,117,119,128,51,29,213,187,199,112,57,254,176,178,41,181,3,197,108,162,183,148,63,67,36,204,15,40,188,
+    144,45,233,152,13,36,47,175,228,80,207,169,182,27,46,25,244,84,79,176,12,76,50,33,68,24,230,147,131,123,96,144,
+    9,216,240,76,128,49,205,180,41,211,62,8,133,93,116,208,153,66,55,205,64,101,48,229,28,145,9,110,61,12,51,167,
+    228,252,202,131,106,160,204,65,142,86,89,84,110,152,155,180,164,67,154,164,124,215,152,172,107,43,139,166,176,78,9,37,
+    78,39,60,146,10,126,1,209,230,62,59,130,227,202,142,218,22,103,86,7,34,252,28,42,23,255,64,157,60,0,149,213,
+    156,84,28,106,201,254,50,219,130,76,84,58,154,60,1,218,116,6,119,80,176,131,37,254,20,100,176,150,172,133,45,28,
+    211,102,36,125,119,190,78,148,222,10,91,108,24,115,138,148,145,96,18,29,237,245,17,65,152,227,36,169,242,54,48,76,
+    197,26,142,153,70,36,77,122,94,26,216,45,207,220,173,12,32,75,180,150,63,206,133,93,253,165,160,213,50,69,250,201,
+    147,136,176,86,47,176,39,151,164,62,43,26,58,72,22,116,211,66,5,147,28,176,148,1,147,104,29,77,160,2,25,23,
+    217,43,244,204,76,200,145,51,93,210,215,5,37,35,93,166,223,148,209,206,73,29,195,131,152,27,118,120,170,213,33,43,
+    85,111,99,146,179,241,225,85,238,238,231,179,98,21,234,174,108,192,37,169,99,115,152,195,107,213,62,167,251,141,227,164,
+    108,17,208,20,241,58,172,188,100,174,110,115,111,169,53,236,120,31,38,98,128,242,148,188,69,97,52,182,62,194,99,253,
+    30,145,39,181,40,205,128,46,47,174,191,113,36,171,243,12,82,7,174,175,106,7,115,21,189,247,249,128,230,188,148,38,
+    191,234,24,139,154,133,140,24,251,162,77,134,144,61,129,16,111,103,228,49,20,208,97,191,103,111,243,173,19,105,149,168,
+    195,81,241,227,230,198,156,237,175,6,233,230,234,131,179,55,13,70,234,242,112,255,181,136,112,70,243,189,247,105,235,100,
+    44,10,53,13,33,119,81,152,214,163,67,202,42,29,57,244,211,179,73,0,66,188,111,78,203,227,184,207,120,144,149,19,
+    191,129,167,199,122,160,5,226,46,161,13,149,162,219,115,200,102,184,31,146,150,173,63,102,81,140,14,67,242,65,77,129,
+    11,55,95,144,70,67,29,90,90,130,131,141,75,9,47,16,11,217,202,34,9,51,41,181,154,167,145,35,18,58,226,207,
+    137,165,16,222,122,205,198,3,150,207,209,212,223,62,109,55,146,50,68,211,226,131,171,2,90,186,147,72,40,134,165,54,
+    43,117,129,78,63,65,156,131,172,86,200,71,205,227,177,227,46,100,50,35,221,54,188,44,227,123,7,181,49,8,194,31,
+    30,3,11,3,173,226,105,110,139,132,7,164,40,203,116,57,74,179,22,75,238,238,97,246,53,125,77,80,27,146,85,194,
+    224,249,67,115,29,46,124,245,69,251,68,189,183,92,111,148,45,181,251,50,142,249,165,187,28,252,207,78,175,56,2,33,
+    216,160,42,219,149,27,2,126,187,221,40,33,166,117,51,134,20,69,64,82,61,124,216,52,245,61,248,18,161,7,12,244,
+    184,33,179,1,109,125,100,23,46,3,234,194,157,177,135,123,35,7,226,12,206,72,243,156,33,114,228,175,66,13,74,146,
+    249,158,253,168,209,118,126,29,44,66,147,195,123,89,156,70,51,157,129,197,39,50,175,10,153,238,65,41,76,141,74,214,
+    212,208,1,40,136,187,148,38,222,213,155,115,68,21,195,255,211,58,86,211,111,34,84,20,221,54,228,176,221,32,88,178,
+    125,35,34,231,65,33,206,172,156,56,51,34,24,167,158,242,131,234,64,194,243,151,21,202,222,25,16,50,241,118,230,88,
+    133,199,222,179,228,167,166,240,135,5,237,46,88,34,9,252,142,108,111,162,164,202,25,6,33,233,100,104,83,223,210,1,
+    239,181,146,229,116,156,23,240,54,60,240,133,9,189,42,148,66,61,248,158,254,162,45,243,1,102,65,82,222,242,107,246,
+    250,35,64,68,106,68,196,96,21,126,120,20,101,217,73,169,124,176,119,13,14,209,86,81,234,99,100,175,18,217,237,180,
+    24,113,9,118,117,27,208,240,235,153,19,146,97,204,151,203,252,154,113,16,103,229,242,126,143,68,255,13,41,96,25,72,
+    188,86,60,234,50,103,137,112,102,105,53,84,144,236,195,222,218,115,74,43,135,21,170,181,203,189,241,95,76,76,199,83,
+    65,243,96,72,68,229,218,167,204,64,242,36,84,229,105,245,5,65,46,240,114,228,63,152,70,29,55,201,122,161,121,247,
+    246,18,35,120,126,234,190,91,229,18,141,43,157,254,68,158,85,184,85,179,158,67,220,140,148,164,11,243,14,248,16,204,
+    4,211,109,91,237,183,74,205,39,229,112,129,6,129,69,72,151,149,252,148,93,98,123,44,152,84,15,121,84,112,145,134,
+    198,212,208,95,123,70,219,183,163,68,74,83,147,0,135,153,170,73,3,253,101,50,183,150,44,15,143,3,49,0,135,163,
+    76,41,69,32,26,101,46,46,18,109,23,13,254,14,36,107,223,251,73,38,251,41,107,28,74,216,6,102,234,250,126,50,
+    193,143,217,178,209,2,207,21,207,106,59,1,132,213,107,222,122,8,50,16,111,64,49,17,239,166,174,157,149,125,80,12,
+    96,57,158,234,198,191,167,46,97,42,103,33,15,181,195,200,240,224,23,218,99,63,172,203,244,151,73,186,127,222,53,215,
+    194,10,138,138,204,171,10,6,128,198,191,247,204,29,211,139,177,177,11,166,201,130,245,128,176,71,108,249,158,213,16,222,
+    233,195,106,239,130,50,18,204,125,165,2,90,36,205,35,76,206,180,3,150,39,75,178,70,70,106,112,168,225,255,28,8,
+    65,127,98,123,237,146,155,52,198,74,74,1,93,17,31,70,215,158,34,8,109,36,91,174,239,255,106,126,213,191,118,88,
+    151,156,100,133,84,249,223,14,107,201,228,162,91,83,114,129,240,194,215,184,213,133,117,110,162,210,172,231,192,111,180,107,
+    31,252,50,104,28,192,245,46,126,23,63,227,245,226,139,45,123,10,118,129,213,149,227,47,198,108,52,83,216,218,211,240,
+    203,102,102,136,25,9,140,156,239,111,155,69,51,188,143,98,1,140,242,158,21,108,32,75,189,229,205,225,64,33,37,212,
+    186,250,93,53,28,237,23,113,224,41,85,46,18,166,2,41,242,170,74,157,25,171,94,233,195,68,76,91,151,121,97,62,
+    233,110,66,154,199,103,104,50,14,86,231,229,2,70,122,102,0,127,121,76,98,250,97,108,125,29,243,122,232,112,62,63,
+    40,24,208,34,212,238,54,248,47,244,192,39,222,159,254,254,2,206,200,100,69,241,175,250,3,223,197,115,112,37,85,12,
+    209,187,42,119,36,50,22,68,210,168,196,44,167,143,36,201,43,179,189,153,236,128,108,67,25,118,122,40,88,124,5,134,
+    84,148,124,59,154,19,189,216,84,182,71,53,122,29,71,222,142,163,156,59,6,163,205,218,144,161,155,142,7,157,47,77,
+    189,84,230,70,97,0,109,85,156,207,227,87,204,9,212,91,245,205,91,7,210,49,79,96,127,182,91,87,191,210,207,4,
+    35,146,47,59,168,58,38,99,39,184,63,62,73,13,112,103,186,177,169,229,161,100,80,23,192,247,24,233,33,40,237,125,
+    25,149,23,243,201,31,2,48,9,139,28,235,55,230,147,59,134,138,2,151,85,20,65,205,51,144,115,53,19,245,77,254,
+    51,132,65,38,187,22,119,121,251,58,228,58,239,91,218,115,169,242,109,51,61,244,228,209,180,124,218,72,146,218,227,204,
+    167,78,17,3,232,41,65,124,45,50,191,124,237,110,228,60,58,54,64,149,36,159,79,10,241,173,165,223,188,212,190,22,
+    253,199,148,173,209,94,120,243,114,2,198,213,97,49,41,153,51,125,203,201,105,50,120,154,45,167,182,195,99,116,121,72,
+    50,105,180,44,90,228,252,81,5,228,169,47,48,6,255,64,203,83,154,33,83,187,8,179,133,27,194,198,237,154,36,211,
+    202,175,208,202,14,85,222,33,61,133,159,185,155,121,226,71,8,93,79,158,68,88,87,5,118,190,129,176,14,94,243,13,
+    126,63,156,84,117,118,88,17,108,62,153,125,116,246,198,29,151,238,143,173,127,104,6,19,108,231,8,77,233,178,130,190,
+    67,38,103,214,11,13,133,110,70,229,117,212,26,59,38,157,108,59,14,21,78,52,116,7,151,60,173,154,133,46,212,231,
+    99,186,116,104,194,132,27,248,234,166,204,196,16,131,64,27,113,225,184,167,71,217,162,29,214,231,103,109,158,1,162,75,
+    109,4,96,96,90,50,226,52,121,127,115,179,48,22,147,190,109,124,123,115,64,11,19,36,117,191,56,96,42,4,225,186,
+    5,107,195,136,124,69,117,160,104,119,214,93,121,29,44,86,188,123,103,206,80,231,142,121,176,129,221,197,127,51,180,69,
+    168,22,95,198,189,181,204,70,201,12,83,217,161,151,204,36,137,134,125,53,177,125,156,124,65,134,108,224,173,133,88,241,
+    215,68,106,85,182,186,190,145,213,87,119,69,183,45,158,99,4,123,51,252,229,66,245,159,38,66,43,183,124,153,176,171,
+    76,30,161,92,91,36,194,60,8,10,165,69,20,227,160,11,28,39,138,238,21,128,31,142,21,42,83,51,237,240,250,207,
+    23,100,45,88,156,138,171,146,32,121,196,58,255,73,169,205,157,158,215,56,76,82,86,201,119,50,225,145,50,133,214,242,
+    206,223,213,242,147,135,56,30,203,21,4,55,144,161,58,247,184,122,87,245,44,53,131,11,180,219,217,51,55,166,158,4,
+    68,35,52,60,68,164,158,35,37,43,215,46,248,104,111,252,215,120,69,49,176,47,57,233,244,123,25,111,90,27,143,224,
+    228,1,198,85,65,40,115,60,107,5,7,116,80,33,223,68,94,215,196,236,144,37,82,79,78,48,135,236,215,122,81,43,
+    238,87,164,133,195,22,168,15,252,84,179,80,120,48,229,42,40,133,141,59,9,199,135,227,179,112,87,137,28,6,104,230,
+    154,123,83,152,249,111,79,99,91,0,185,58,208,227,143,99,151,193,31,127,243,244,146,148,226,63,78,86,200,166,9,210,
+    239,211,212,32,193,199,232,200,119,6,115,229,29,45,255,229,116,206,161,13,45,45,139,253,93,19,253,110,201,39,252,8,
+    94,34,240,115,209,124,4,59,203,127,139,211,219,54,83,219,96,60,253,252,123,54,70,214,138,178,51,214,59,195,173,21,
+    137,162,195,107,35,233,29,158,192,187,209,189,223,21,47,132,241,212,202,109,171,140,117,32,170,79,163,253,184,66,251,158,
+    170,2,62,242,13,193,250,169,31,233,45,67,126,181,155,177,236,121,1,64,233,216,58,118,223,109,37,137,129,127,239,40,
+    52,183,201,120,24,113,5,81,206,24,234,64,209,119,36,89,135,11,133,146,98,122,228,102,137,48,124,210,26,206,192,194,
+    136,33,120,28,84,241,195,225,122,241,51,172,25,123,139,232,96,85,235,147,18,244,64,68,2,91,175,31,157,234,32,57,
+    127,15,235,47,144,65,163,102,18,70,235,164,192,213,189,54,229,100,51,187,230,51,223,53,90,169,216,221,143,84,213,63,
+    229,16,61,9,221,166,78,255,44,229,40,209,126,61,232,168,201,67,85,113,127,71,238,187,26,65,35,111,109,52,154,86,
+    28,84,219,36,122,61,187,223,131,255,161,146,240,190,159,66,34,236,246,0,75,117,90,100,176,135,254,203,135,191,50,25,
+    36,30,73,44,139,5,1,146,59,0,236,227,107,216,135,13,45,218,242,225,12,14,132,222,80,240,155,70,15,205,212,37,
+    191,126,159,223,196,8,218,89,198,156,97,249,208,19,102,87,255,195,113,36,221,80,96,255,161,11,140,99,212,1,91,114,
+    59,6,87,68,163,60,188,175,191,160,248,100,102,86,154,98,92,166,79,104,95,56,103,42,2,0,217,222,41,50,224,201,
+    40,79,210,197,204,116,99,47,13,155,120,0,163,94,14,4,78,100,110,7,73,232,0,14,74,17,4,91,8,29,82,137,
+    155,25,115,254,28,4,38,72,148,17,110,38,254,141,80,76,34,186,7,130,40,32,79,196,60,207,151,134,239,105,228,178,
+    46,204,2,4,236,253,144,33,215,245,163,160,155,173,254,23,20,171,111,240,61,88,186,12,216,248,99,148,201,102,185,234,
+    10,245,149,110,160,253,25,109,185,195,221,66,151,39,231,209,117,194,225,191,98,80,109,178,71,165,183,219,132,29,90,46,
+    2,114,166,42,148,8,138,80,3,98,132,46,27,78,83,34,56,28,172,61,81,60,168,211,209,43,245,42,121,8,138,232,
+    0,155,149,118,250,156,3,23,67,159,21,22,37,78,40,183,7,86,74,143,111,100,254,180,229,181,157,69,215,139,96,189,
+    180,98,77,218,17,160,92,118,200,77,54,48,15,169,197,125,86,67,253,129,151,68,130,115,225,229,14,187,250,103,115,231,
+    239,237,243,32,219,28,83,47,215,154,10,1,223,174,183,97,233,254,198,97,8,199,94,152,23,230,182,72,158,31,117,87,
+    116,240,203,209,74,33,108,200,216,228,170,114,195,226,160,80,217,210,128,93,155,132,108,86,117,25,136,26,41,246,60,155,
+    245,8,124,181,122,223,184,134,237,238,54,24,59,138,146,30,228,105,35,205,3,121,145,252,183,202,48,163,183,14,115,55,
+    2,246,4,180,168,233,139,52,78,125,114,231,4,204,48,94,107,111,108,50,20,19,4,183,222,99,124,224,191,24,31,155,
+    105,246,126,82,85,153,18,150,167,112,111,234,61,178,166,195,176,157,104,231,3,33,49,5,88,169,124,235,9,64,247,2,
+    133,162,112,91,106,182,177,158,131,209,35,20,188,85,4,52,72,54,89,214,180,171,109,59,103,175,68,14,246,81,9,80,
+    152,116,59,136,93,110,147,184,65,23,166,114,202,32,99,164,204,255,61,54,18,187,220,152,47,73,44,135,27,49,61,154,
+    18,195,55,95,235,89,169,45,235,201,16,170,139,91,195,70,1,193,186,115,27,181,169,241,12,245,154,34,53,215,166,230,
+    209,130,26,87,49,148,160,49,153,73,87,138,32,175,127,153,180,200,230,228,255,192,161,35,169,40,71,43,227,245,218,39,
+    220,141,69,56,235,100,205,93,218,21,207,251,77,16,103,0,177,203,21,121,30,244,58,8,191,193,21,105,248,240,105,12,
+    232,8,216,92,158,44,228,186,226,242,27,127,27,246,116,108,189,159,60,133,156,165,133,218,66,181,52,158,207,185,179,185,
+    56,54,157,60,124,167,170,40,54,183,54,73,63,83,235,153,63,224,211,215,254,40,244,144,0,66,82,179,30,55,172,144,
+    241,123,191,28,4,254,180,155,94,22,19,120,203,39,83,207,240,57,6,120,175,84,189,152,226,148,81,93,181,109,184,206,
+    226,225,35,200,48,89,196,150,55,198,59,18,36,113,235,236,126,86,172,204,13,206,81,177,90,11,95,0,203,110,81,40,
+    217,15,50,209,245,191,53,180,220,124,240,61,212,66,14,186,105,48,129,31,124,115,18,41,178,20,156,152,200,120,205,43,
+    102,172,43,222,127,233,45,151,115,181,48,8,22,7,71,46,216,197,73,205,122,140,168,108,62,212,88,252,208,174,61,93,
+    174,10,48,120,234,5,179,15,96,200,98,144,154,19,48,6,102,12,77,148,151,113,139,188,254,122,204,178,144,68,65,255,
+    221,123,35,161,182,170,207,80,233,25,220,163,236,22,166,86,41,174,60,113,57,12,20,128,32,46,131,91,219,236,167,247,
+    185,243,54,180,222,188,157,72,117,251,147,250,173,167,226,45,1,74,255,75,56,159,240,73,117,141,162,14,58,33,135,108,
+    28,75,51,182,251,162,9,242,113,86,244,124,236,86,248,53,118,23,40,177,134,238,181,13,200,161,200,208,170,55,48,104,
+    83,240,16,161,193,136,64,200,102,224,13,138,0,10,10,56,100,244,32,175,16,16,8,21,140,198,85,178,67,167,1,156,
+    234,240,79,107,42,86,189,138,227,252,74,121,226,83,146,18,129,233,85,160,104,116,180,82,96,232,71,238,138,32,76,47,
+    97,240,53,32,185,86,73,146,175,198,62,68,36,65,173,189,137,223,43,151,22,251,166,124,236,254,254,119,230,57,136,0,
+    106,134,168,146,180,249,73,220,181,157,6,121,24,197,60,177,162,160,19,125,108,92,124,243,185,165,146,107,188,241,115,122,
+    187,179,199,99,211,92,164,151,52,186,250,174,109,59,221,96,132,179,77,161,35,120,220,197,58,185,226,234,72,237,243,39,
+    58,148,237,39,35,67,252,197,96,35,178,28,191,178,87,137,105,45,65,247,46,19,102,135,190,199,65,55,239,130,35,224,
+    166,73,23,81,64,3,77,223,172,76,227,38,87,213,178,149,174,57,243,17,57,61,57,52,36,91,255,60,35,38,150,57,
+    90,167,99,116,210,160,57,216,6,156,111,185,45,94,237,176,213,118,102,115,179,131,208,244,23,86,100,220,178,198,26,102,
+    207,119,91,64,157,138,209,233,143,45,84,83,8,34,118,168,72,173,255,9,1,123,105,162,93,47,150,165,104,33,176,41,
+    3,42,147,183,116,200,139,52,243,36,51,47,23,245,176,178,195,89,133,75,106,196,208,235,192,45,46,36,218,34,7,245,
+    212,93,47,207,233,92,203,245,219,86,234,18,133,94,164,3,105,137,238,214,106,35,211,3,244,179,135,28,202,157,24,116,
+    179,156,148,254,208,179,87,30,76,128,83,223,48,171,132,27,224,252,4,235,196,121,205,116,77,238,21,181,214,186,219,99,
+    99,5,144,161,149,222,95,127,210,87,252,57,157,64,183,114,211,129,247,39,16,36,130,194,23,245,161,65,84,216,255,147,
+    103,245,204,125,74,162,99,194,23,178,171,11,255,182,171,225,214,85,239,12,26,33,179,80,8,149,137,9,103,228,195,64,
+    236,58,83,163,33,83,54,46,229,12,176,135,210,239,86,62,125,151,60,231,101,239,251,250,120,142,14,114,56,30,252,108,
+    122,229,227,18,79,151,4,151,69,74,90,245,49,4,71,172,56,92,55,138,68,56,236,180,254,111,73,194,83,194,98,49,
+    202,125,233,209,58,147,227,146,101,159,252,5,59,35,225,192,187,148,209,74,151,234,132,211,136,150,118,237,105,219,135,30,
+    191,90,182,61,45,75,97,9,76,58,60,26,53,80,47,57,75,33,187,43,183,7,30,183,143,168,178,231,134,37,210,77,
+    132,75,42,143,32,50,239,210,51,225,187,160,251,37,35,163,135,12,48,137,68,111,36,170,230,232,115,7,34,13,33,161,
+    236,223,121,206,35,94,85,162,46,122,22,187,23,71,34,202,56,30,186,179,8,165,72,227,30,82,128,33,83,10,74,49,
+    92,92,94,229,43,181,185,204,166,230,58,126,158,30,102,99,37,32,67,137,100,102,103,44,182,131,241,62,210,100,161,41,
+    175,62,142,204,121,67,228,86,42,33,206,156,93,177,143,5,53,6,214,64,87,63,41,22,43,25,176,40,1,202,169,147,
+    233,26,176,232,170,235,163,154,105,17,123,84,183,198,238,8,230,154,109,128,68,10,135,66,72,143,237,158,64,81,131,30,
+    55,186,63,81,36,67,250,45,53,170,124,214,122,217,250,10,75,225,200,221,96,252,99,20,50,96,176,4,13,253,23,15,
+    71,91,17,178,30,21,87,155,208,20,92,121,174,9,71,135,95,64,255,178,192,40,44,250,214,227,5,55,118,55,202,153,
+    47,208,247,163,32,70,178,193,56,203,162,106,66,189,194,197,217,116,163,126,255,222,187,236,156,45,255,176,4,104,215,37,
+    93,103,234,226,197,127,42,231,145,35,140,60,230,124,26,175,177,3,87,176,208,46,88,227,50,78,151,130,195,37,33,229,
+    246,109,23,183,3,12,201,33,118,168,236,213,100,161,196,17,106,170,82,229,253,191,100,110,117,130,65,139,229,134,110,95,
+    119,206,241,69,119,186,188,124,63,171,37,160,99,191,45,168,60,187,87,73,251,213,35,25,62,154,179,35,249,175,247,243,
+    48,118,193,123,160,76,8,83,174,46,42,149,246,2,76,251,48,169,110,153,45,46,252,245,178,79,103,3,106,195,233,235,
+    72,19,136,227,118,42,106,84,73,60,149,238,175,228,70,93,201,118,135,252,212,170,232,209,12,76,129,66,63,9,253,244,
+    57,79,144,150,41,4,2,53,218,77,75,115,216,201,55,110,116,3,88,169,215,174,25,150,181,183,201,23,141,224,168,207,
+    199,69,116,212,155,251,69,92,227,2,113,192,115,68,50,90,225,171,15,152,122,9,69,59,83,136,250,179,65,55,111,50,
+    93,81,163,80,73,47,179,255,63,241,170,149,106,47,145,245,9,81,125,128,185,103,129,126,5,61,113,113,99,59,117,82,
+    116,150,1,190,186,38,193,105,123,169,61,234,56,191,113,9,133,208,34,144,208,145,120,126,232,236,166,81,225,115,11,10,
+    9,144,241,189,219,247,50,180,137,139,225,49,31,147,196,179,160,49,110,255,186,153,204,134,190,189,121,3,118,156,194,248,
+    48,166,208,177,111,112,36,251,51,182,104,146,154,69,195,205,6,171,128,117,130,105,241,105,14,67,130,157,222,211,18,122,
+    34,67,12,89,55,96,2,196,47,74,150,232,43,88,161,47,179,201,186,211,80,54,219,181,195,133,161,10,34,79,219,211,
+    117,242,166,34,81,19,36,158,120,253,253,22,151,228,53,240,42,13,253,218,12,252,171,237,66,84,251,250,147,74,107,238,
+    205,98,179,78,129,131,144,238,4,199,206,167,194,103,9,241,111,100,133,62,207,241,220,184,10,228,255,160,11,184,24,7,
+    78,236,158,21,113,163,160,63,131,34,245,98,7,53,240,13,250,160,225,211,50,172,12,71,52,38,150,255,144,211,194,69,
+    249,44,141,245,128,203,131,57,140,115,228,121,222,101,182,166,214,131,249,119,228,161,34,28,145,143,41,4,255,164,37,4,
+    92,132,94,144,146,93,244,2,106,22,235,249,1,96,64,196,142,38,233,59,44,221,15,199,192,75,164,221,160,184,253,217,
+    210,189,33,123,35,98,49,190,134,187,52,124,164,242,54,238,157,222,7,39,26,189,137,35,110,8,154,102,238,160,193,54,
+    212,0,91,205,8,103,18,184,221,59,165,128,4,9,238,113,39,43,160,43,207,143,133,151,19,161,233,252,73,20,218,195,
+    237,10,253,39,68,30,94,214,227,61,246,55,218,10,128,71,235,53,183,238,6,42,186,37,157,61,182,137,233,132,201,8,
+    241,32,188,153,18,145,171,12,127,3,40,226,216,141,12,102,120,203,87,181,166,120,217,99,102,149,92,210,54,174,57,196,
+    120,147,247,30,67,14,237,160,16,152,67,163,57,91,100,147,252,33,220,87,87,187,120,184,253,125,222,153,90,199,224,139,
+    99,199,166,193,101,66,68,220,101,208,111,31,87,216,110,214,160,1,253,195,132,26,196,88,143,134,217,143,172,44,25,8,
+    219,40,127,240,73,58,43,134,194,103,119,149,177,215,147,77,129,66,206,69,252,211,50,185,159,96,220,154,145,44,76,103,
+    137,76,16,181,228,22,198,42,54,241,41,197,53,220,234,121,43,225,42,5,204,104,224,114,233,218,17,32,111,87,166,181,
+    224,211,82,33,31,229,231,220,230,121,150,37,79,181,185,255,53,21,83,248,68,202,43,194,205,112,202,210,60,147,220,58,
+    183,105,204,194,65,228,177,138,46,48,53,191,219,49,232,33,34,55,59,51,160,150,174,38,60,108,137,107,87,14,98,78,
+    45,83,146,198,105,136,226,70,220,250,122,245,174,47,142,29,113,220,181,115,79,83,236,25,114,202,222,248,78,229,223,120,
+    184,140,210,25,70,64,5,248,169,6,203,29,134,241,87,183,189,139,246,55,51,240,111,41,179,154,246,207,61,122,190,15,
+    175,183,63,160,195,61,187,245,174,166,87,118,109,227,45,248,76,125,101,219,154,212,53,194,78,80,104,19,128,42,215,25,
+    72,47,80,103,237,35,13,88,68,150,155,26,174,119,77,11,109,254,129,21,194,182,14,10,216,103,9,251,123,147,187,1,
+    185,97,133,185,49,104,100,137,42,250,169,121,12,144,103,144,209,10,208,76,254,156,184,206,220,102,47,238,211,161,13,243,
+    171,175,223,45,169,118,240,243,174,188,74,100,175,231,235,158,99,130,150,49,44,196,193,174,253,137,94,126,193,11,33,170,
+    30,71,71,173,27,215,177,34,20,195,244,216,103,35,234,183,107,205,72,154,23,141,148,244,56,180,23,162,84,98,167,107,
+    233,51,193,145,119,235,36,103,146,206,95,83,83,226,225,97,225,178,55,126,253,147,237,106,211,135,178,50,250,234,38,76,
+    57,165,87,128,12,137,113,80,75,83,212,166,238,147,3,109,83,78,99,131,247,103,121,19,66,73,116,209,95,133,212,93,
+    71,69,250,111,60,44,184,233,98,32,182,103,54,79,222,130,152,111,144,254,19,18,175,93,203,96,255,95,6,23,109,180,
+    46,114,237,133,39,17,12,99,184,3,155,223,32,64,25,124,148,114,153,63,28,168,172,198,54,38,128,50,7,69,13,52,
+    229,69,216,16,127,53,245,51,120,84,210,244,134,194,244,169,250,123,116,195,130,129,96,52,95,229,233,21,51,120,161,217,
+    8,73,155,178,83,220,249,249,110,189,157,168,170,96,92,39,11,116,126,79,55,125,70,127,181,137,149,110,192,249,78,242,
+    108,170,154,115,215,49,169,198,156,3,21,97,51,58,110,127,125,216,205,231,99,69,174,120,178,45,209,56,170,58,175,109,
+    152,137,131,155,228,89,88,141,138,124,243,225,242,162,243,243,209,122,98,233,133,98,197,192,210,225,114,103,180,255,111,141,
+    142,119,110,216,75,111,94,117,143,59,119,149,199,141,116,13,145,181,112,187,87,221,65,123,75,69,151,146,199,235,196,161,
+    25,66,120,160,170,164,172,162,206,80,140,231,24,234,192,47,235,95,122,108,82,154,137,116,161,65,7,63,50,142,120,228,
+    236,204,55,251,150,64,27,248,254,66,17,69,69,45,29,231,109,54,114,43,186,126,81,142,67,32,252,215,16,3,245,192,
+    181,45,185,94,18,60,40,142,13,205,218,127,18,154,63,70,125,95,100,60,36,68,59,230,108,34,152,59,34,245,195,31,
+    131,3,89,145,104,77,13,155,59,218,252,96,6,178,83,171,212,214,235,178,50,208,134,108,197,54,161,5,186,6,253,106,
+    195,45,11,207,206,124,192,100,60,179,55,236,231,62,12,159,171,194,138,94,232,176,254,51,142,7,46,55,57,244,135,54,
+    76,72,241,47,38,203,188,144,88,76,64,66,25,94,75,179,238,199,52,70,165,152,37,176,215,146,252,156,175,3,66,213,
+    198,90,169,95,20,54,217,207,212,32,204,129,165,128,221,236,149,190,215,85,20,224,94,16,119,175,172,69,83,141,93,61,
+    64,58,75,106,95,7,138,210,212,74,186,205,195,226,24,128,219,48,223,238,3,197,244,144,39,183,205,48,67,90,84,46,
+    210,187,202,253,209,146,213,203,158,22,36,161,174,211,104,181,51,130,200,99,186,6,158,233,61,58,30,172,3,113,132,154,
+    246,48,67,119,14,121,83,155,248,175,31,184,253,109,164,39,116,115,77,221,186,148,12,116,68,6,78,188,179,141,50,207,
+    78,14,83,53,186,244,151,54,243,30,115,20,163,239,136,84,18,139,138,220,182,250,232,67,241,42,93,174,126,118,247,134,
+    124,222,162,209,247,126,5,165,131,192,99,212,76,235,66,12,133,213,20,180,117,6,131,156,43,135,18,160,120,111,153,88,
+    112,88,212,153,113,20,109,12,205,109,104,32,95,253,147,95,165,74,96,155,109,26,49,101,103,85,192,54,121,24,140,135,
+    157,41,0,108,240,38,134,141,132,165,226,14,126,107,125,229,34,234,29,57,213,158,20,173,203,221,61,136,91,86,52,184,
+    66,75,157,229,28,205,173,117,227,171,81,50,195,124,87,58,231,191,147,129,42,185,27,17,194,170,121,238,63,170,216,84,
+    159,173,119,37,82,50,115,49,62,53,55,202,147,93,231,90,49,103,22,111,166,12,204,37,168,45,142,161,104,230,65,103,
+    51,244,223,139,28,54,160,102,207,253,122,60,170,110,148,86,251,252,213,58,78,99,95,81,48,9,186,107,76,198,46,9,
+    48,24,139,52,117,243,104,112,178,135,7,234,109,209,187,115,181,140,6,37,157,25,188,102,178,139,135,210,122,26,228,182,
+    169,174,27,124,159,109,238,184,50,165,69,162,243,179,167,201,35,219,83,124,29,57,7,51,63,37,185,17,113,43,249,51,
+    66,36,11,244,105,7,112,22,82,144,254,26,230,177,183,11,103,242,3,62,32,180,64,13,65,104,157,29,52,91,0,103,
+    178,103,130,121,37,154,7,136,194,210,199,124,69,233,14,120,56,114,211,138,2,254,3,113,230,221,4,138,170,36,108,92,
+    225,64,222,231,33,160,244,251,82,213,104,81,180,28,22,155,61,36,125,141,232,0,46,227,70,130,155,36,15,31,177,242,
+    71,144,162,58,213,196,159,252,4,39,106,175,218,136,98,139,26,169,243,244,80,59,82,44,150,120,252,51,116,97,68,49,
+    252,53,195,94,183,22,154,179,159,199,177,66,103,227,196,29,246,183,200,221,22,178,16,212,222,143,74,94,0,222,233,75,
+    56,234,45,0,255,144,143,97,8,210,44,90,104,223,1,122,167,34,64,130,223,210,213,126,162,54,107,221,106,65,213,199,
+    159,82,139,89,123,136,3,18,237,116,108,232,168,81,218,75,227,127,182,162,4,59,61,147,195,230,49,83,6,81,50,132,
+    62,86,60,151,154,85,37,180,131,116,136,219,146,17,139,117,73,232,192,59,118,74,214,216,167,225,83,48,43,251,160,112,
+    63,80,31,189,105,48,215,129,180,84,208,11,59,225,215,145,49,153,115,209,17,139,131,210,224,247,250,194,77,68,147,1,
+    17,195,236,136,41,144,3,249,249,242,237,79,53,127,125,40,41,32,193,176,39,108,33,44,112,63,200,117,130,113,168,34,
+    158,21,80,60,159,165,202,220,122,202,113,61,134,146,254,240,106,59,96,50,69,191,245,157,133,160,172,153,134,80,6,247,
+    108,53,136,141,174,153,225,128,93,126,202,181,64,251,139,245,47,52,186,57,214,81,190,192,188,35,196,195,146,117,45,248,
+    65,251,110,180,83,191,188,40,190,21,29,100,86,134,123,4,146,144,23,163,125,190,0,252,148,128,165,158,96,165,81,84,
+    225,89,236,229,166,202,48,7,58,67,128,115,4,209,197,2,228,85,158,230,129,141,86,47,164,81,46,153,15,195,250,131,
+    134,197,36,34,21,6,225,142,104,30,112,56,164,74,253,132,96,113,131,103,20,94,212,202,183,5,120,63,160,158,151,211,
+    169,123,241,195,187,85,3,221,164,73,61,242,166,154,31,42,121,193,19,67,175,228,162,252,142,8,120,50,182,197,9,232,
+    79,162,39,203,156,212,3,28,203,140,113,115,7,211,187,39,213,161,78,247,196,101,17,16,214,193,65,235,208,186,162,26,
+    177,53,0,1,249,49,146,188,2,58,138,52,232,34,26,1,57,195,38,157,152,49,144,207,161,70,195,36,151,58,111,203,
+    166,17,105,119,34,176,58,216,34,178,122,173,97,224,34,215,229,204,33,148,160,17,109,18,210,131,55,203,103,65,66,71,
+    149,18,136,129,122,156,251,75,33,27,144,94,9,199,20,200,115,189,154,122,252,183,52,20,157,180,72,122,246,202,15,78,
+    117,11,187,9,210,200,133,58,104,91,229,125,83,127,84,184,213,57,226,104,16,218,0,191,128,225,219,254,246,200,149,129,
+    223,61,44,97,182,82,201,194,211,73,197,115,175,191,119,187,87,51,138,160,160,221,22,188,82,71,179,3,191,95,21,24,
+    74,204,176,197,26,157,17,23,70,240,100,215,114,238,78,100,153,129,6,181,165,67,230,112,240,80,123,2,223,119,159,70,
+    248,56,88,252,57,34,94,7,213,108,100,202,206,185,103,157,249,23,155,221,63,9,232,82,255,25,115,130,249,55,2,114,
+    57,210,128,21,219,61,101,115,216,25,89,190,82,249,160,168,96,1,140,117,238,162,139,166,53,254,110,42,75,152,125,108,
+    46,117,116,37,255,131,115,92,138,143,123,0,225,52,107,92,86,133,216,18,163,23,48,141,5,172,178,21,167,218,136,211,
+    152,218,187,73,101,95,131,220,116,82,232,19,64,82,84,195,40,222,203,215,222,251,172,14,233,130,36,135,69,96,8,1,
+    193,232,59,16,29,75,188,120,153,91,14,87,236,92,179,57,75,50,1,55,201,205,170,14,217,213,104,69,38,89,29,5,
+    91,52,55,219,184,27,39,128,79,74,76,172,159,38,228,133,75,92,22,127,163,166,125,191,167,169,53,214,92,77,242,65,
+    195,62,169,73,20,80,224,224,200,52,209,144,94,158,245,85,101,210,192,63,155,42,224,200,116,212,12,255,126,121,7,30,
+    167,222,3,230,232,93,139,16,228,217,233,50,23,1,87,227,66,129,143,19,224,215,232,97,0,128,76,189,42,121,139,6,
+    210,45,7,175,51,76,31,60,196,163,244,25,11,208,43,73,53,184,98,17,254,208,6,211,53,240,110,12,245,215,57,68,
+    95,73,14,56,146,230,179,1,70,52,229,20,145,163,113,130,92,160,52,171,163,193,94,136,65,46,136,27,161,102,113,145,
+    168,24,175,228,92,231,33,104,130,101,252,216,189,143,146,45,147,96,215,69,190,192,151,35,34,255,224,0,41,199,36,107,
+    229,51,220,254,225,35,246,234,247,22,197,21,240,232,53,235,248,24,72,126,82,254,10,252,153,17,81,122,27,221,162,44,
+    65,183,183,228,68,201,164,52,42,227,237,87,247,200,180,25,16,64,113,161,233,239,0,184,236,209,245,70,118,56,242,37,
+    15,215,73,12,182,82,39,167,49,189,207,207,24,216,144,243,226,186,251,4,74,10,167,109,254,185,234,222,9,67,29,221,
+    228,192,38,6,103,4,170,168,17,246,61,9,113,254,210,174,199,173,100,199,194,25,74,29,156,168,20,65,100,75,187,193,
+    76,167,151,84,121,181,29,236,97,50,49,39,101,142,169,20,131,72,52,235,176,67,241,145,193,202,57,159,56,74,115,133,
+    47,96,148,160,40,93,125,88,181,227,19,31,102,116,84,147,179,43,247,207,125,95,155,18,173,50,12,176,115,18,157,179,
+    63,38,127,78,48,245,78,158,43,35,116,87,50,147,209,139,47,130,52,112,87,172,87,159,249,186,127,241,186,172,146,154,
+    155,5,34,164,161,153,132,32,66,198,205,76,247,26,163,81,65,213,210,144,56,108,113,221,42,50,68,16,42,187,201,213,
+    231,39,73,9,223,246,206,248,140,40,183,232,215,164,220,250,55,8,222,220,93,187,117,6,98,12,208,188,133,6,119,185,
+    115,106,206,221,113,154,206,182,100,58,207,172,69,132,199,214,122,35,185,40,74,141,73,144,40,249,196,174,196,72,176,33,
+    79,240,217,24,66,115,241,61,105,140,213,6,221,117,93,164,107,155,217,206,36,221,81,173,118,115,164,86,152,243,28,184,
+    205,104,254,231,128,54,31,83,147,40,146,253,185,242,27,66,251,19,135,189,0,122,86,141,240,21,211,45,32,129,123,207,
+    111,181,140,127,164,243,81,157,67,3,167,82,84,233,227,194,115,144,122,42,163,54,222,139,58,98,126,59,63,42,225,225,
+    59,114,49,54,183,46,194,66,27,152,48,64,182,140,232,218,215,24,63,139,212,91,100,43,148,156,49,205,109,210,157,226,
+    90,254,105,61,155,134,59,42,226,36,92,47,22,196,141,83,47,152,84,90,211,128,130,88,39,151,204,2,67,123,51,146,
+    149,23,30,136,148,34,207,107,79,40,148,233,132,226,107,1,145,0,48,77,129,202,109,24,172,30,207,56,53,188,239,73,
+    106,253,68,108,218,55,235,130,7,253,87,184,156,144,105,21,14,150,33,197,168,151,174,18,96,151,67,202,103,100,172,131,
+    36,9,94,204,122,187,48,72,8,94,13,73,99,103,254,86,5,14,24,76,38,241,246,21,25,93,202,101,202,237,199,75,
+    110,74,33,215,224,201,21,55,49,95,11,133,81,207,230,209,247,177,45,203,229,204,101,218,36,221,41,210,54,204,144,137,
+    240,250,216,234,178,60,195,169,123,218,21,183,122,67,147,172,105,51,26,139,97,159,241,170,160,3,22,158,163,188,154,32,
+    51,207,176,204,120,124,218,224,117,135,184,5,167,16,153,113,252,95,2,15,166,119,158,97,247,166,187,0,220,47,225,165,
+    211,43,179,199,65,102,46,109,223,96,158,213,37,13,105,111,250,10,155,199,213,92,132,106,63,160,97,135,119,159,163,182,
+    118,235,0,15,15,162,238,6,244,62,178,226,95,179,189,169,231,58,58,97,70,148,245,174,103,41,149,198,81,82,112,126,
+    120,82,162,160,32,176,68,62,54,153,106,219,244,240,65,97,126,156,137,57,178,16,104,191,15,46,189,140,178,218,148,133,
+    9,198,239,12,104,11,218,13,51,75,206,37,79,29,90,176,118,71,27,200,68,3,133,181,150,154,32,73,208,77,187,166,
+    235,45,61,214,168,62,158,64,59,133,53,112,245,115,133,21,146,44,10,243,46,193,136,27,51,86,100,131,41,82,128,25,
+    32,40,102,110,190,183,145,74,225,59,80,125,179,15,210,223,61,147,51,222,178,172,199,250,172,41,59,204,80,20,182,214,
+    187,46,179,77,90,14,185,230,179,166,152,160,182,9,172,228,168,222,131,6,161,195,31,233,184,196,222,90,252,132,41,36,
+    185,223,202,131,106,180,228,37,86,59,160,133,12,221,234,47,92,135,61,27,40,202,139,135,204,201,142,2,134,228,32,9,
+    57,167,137,21,213,209,33,50,111,178,65,174,24,214,36,41,35,194,232,232,62,198,46,85,100,55,77,14,30,113,65,42,
+    130,195,174,31,19,192,50,128,191,190,85,127,244,103,177,23,184,177,27,54,20,121,109,199,229,86,61,177,21,41,191,58,
+    79,96,189,62,5,14,141,167,217,36,57,154,79,28,149,197,89,235,255,203,12,142,23,102,94,225,255,223,95,4,22,207,
+    133,250,211,110,65,56,244,200,11,249,201,97,40,89,229,199,95,186,221,26,33,244,47,122,46,26,173,71,141,216,138,246,
+    173,176,214,80,59,217,113,48,243,68,199,136,78,34,44,73,36,235,231,78,83,201,208,4,243,199,74,30,56,142,4,104,
+    188,30,207,61,57,197,114,251,182,20,5,135,34,49,219,91,180,222,180,88,52,197,49,87,33,119,154,121,112,42,131,32,
+    48,59,255,9,102,43,193,34,2,6,81,199,182,205,65,166,65,99,67,196,110,187,60,90,138,84,163,165,116,143,13,138,
+    75,162,176,175,125,130,121,211,69,170,32,102,239,68,205,167,68,133,55,190,9,106,99,174,135,57,135,117,0,3,228,121,
+    89,93,45,147,143,67,77,12,81,222,30,211,114,12,123,196,79,196,229,17,60,222,211,225,135,239,192,47,42,219,45,154,
+    201,32,3,11,229,52,205,128,197,40,22,218,163,127,116,143,230,184,54,33,9,88,229,254,116,184,95,79,62,150,76,178,
+    156,20,107,33,235,244,67,36,250,4,54,124,180,232,147,88,159,61,217,139,176,94,118,180,28,92,188,48,139,123,203,185,
+    13,93,174,50,116,13,219,215,234,72,253,164,53,166,130,184,216,190,142,198,114,88,59,233,120,91,156,195,210,19,241,237,
+    247,70,217,169,242,17,216,157,153,185,39,58,240,122,166,178,196,51,47,78,81,92,94,119,181,245,170,95,93,84,29,119,
+    169,125,85,116,168,195,108,109,216,137,252,183,189,33,180,124,77,92,242,167,159,77,210,165,77,117,185,17,63,12,130,223,
+    216,226,55,110,159,20,175,64,151,212,95,181,46,30,30,79,244,30,146,132,179,142,75,131,108,239,212,230,236,145,163,211,
+    108,164,167,166,185,196,4,156,233,23,173,180,39,28,207,12,77,134,59,52,69,50,242,134,45,97,191,128,49,87,214,214,
+    46,147,141,8,123,46,159,208,216,23,159,7,56,82,154,134,40,199,56,49,38,135,199,16,38,200,144,33,99,165,255,114,
+    117,208,39,55,91,23,198,83,226,238,85,157,80,104,181,105,165,186,95,219,122,91,34,15,153,147,84,149,104,87,190,106,
+    5,219,17,67,201,185,179,182,202,217,60,41,212,124,60,193,253,35,105,205,202,84,107,85,67,238,61,59,202,219,232,158,
+    160,255,88,191,135,180,201,30,62,79,74,182,41,240,211,140,251,158,117,156,110,53,207,144,59,8,68,249,174,8,206,129,
+    107,151,8,95,70,216,168,232,172,213,31,101,110,248,48,103,91,171,221,255,40,178,40,196,147,92,233,99,152,198,62,72,
+    81,79,22,141,236,186,67,52,90,36,153,199,137,253,97,197,130,218,249,176,91,101,135,164,243,222,145,223,48,121,85,167,
+    243,234,221,43,14,233,159,114,99,216,110,121,179,152,198,113,42,169,26,121,209,158,198,202,38,69,7,162,63,243,50,80,
+    20,77,133,109,41,210,121,84,226,169,23,211,250,52,10,140,105,168,123,114,163,36,28,19,253,146,120,98,196,195,10,30,
+    235,57,87,3,194,73,25,120,8,63,84,72,153,223,213,59,1,188,178,70,7,201,33,229,21,252,232,165,115,219,212,21,
+    113,22,81,154,68,69,47,20,223,17,190,249,198,165,29,161,8,35,141,205,68,24,49,170,102,16,24,175,162,133,120,112,
+    200,189,197,77,178,137,120,160,109,158,222,234,192,54,112,239,215,8,2,242,218,52,3,237,4,188,115,128,158,216,3,137,
+    13,60,235,192,161,31,218,105,53,93,42,76,182,233,178,109,158,122,3,16,76,128,94,166,137,187,153,68,202,166,240,101,
+    150,163,166,174,166,190,25,218,96,118,187,17,22,195,31,191,156,25,145,185,200,89,113,101,223,83,128,188,236,88,149,239,
+    209,129,106,126,240,125,141,224,45,148,40,7,251,6,215,75,243,178,75,165,144,185,136,218,184,170,56,27,94,181,230,242,
+    177,147,51,208,117,150,231,16,245,87,149,180,117,45,227,137,100,95,251,54,175,66,217,52,64,89,236,61,128,45,168,233,
+    14,250,55,41,199,8,252,132,247,235,190,131,24,213,194,181,208,3,143,107,48,228,57,27,239,233,91,190,237,90,214,47,
+    50,115,66,99,200,50,45,3,49,72,237,250,133,95,22,203,140,32,236,35,61,134,114,165,14,242,76,27,247,68,231,23,
+    177,231,85,107,155,243,101,62,64,56,181,193,113,7,90,34,68,43,97,127,107,58,29,35,154,229,24,243,29,62,236,61,
+    224,71,237,160,114,239,217,248,230,50,51,91,10,220,191,232,102,138,229,178,76,127,16,58,97,159,34,167,229,86,180,51,
+    85,55,63,253,255,6,224,36,95,63,59,74,214,21,41,39,95,255,42,70,50,10,44,105,55,189,60,75,147,251,1,113,
+    65,190,15,101,65,88,237,223,194,70,47,238,42,199,172,24,231,149,45,36,177,200,66,15,73,212,28,38,92,162,7,166,
+    91,215,24,173,90,134,237,232,106,103,30,137,91,212,180,89,75,250,214,22,4,25,49,53,83,117,146,180,207,122,248,53,
+    45,69,11,127,164,213,51,141,48,207,216,177,13,14,95,2,47,109,248,24,113,72,89,170,101,22,118,165,9,185,79,77,
+    184,203,42,162,117,200,122,246,8,187,127,180,242,89,132,139,27,104,204,153,93,93,213,213,242,70,178,133,120,146,152,127,
+    142,51,186,159,159,67,62,190,112,37,202,231,53,116,228,44,57,41,224,55,246,78,221,37,244,132,132,42,181,210,22,149,
+    85,221,62,55,255,22,219,176,252,145,251,160,189,72,216,147,212,163,120,213,41,133,70,64,227,173,106,208,25,134,68,130,
+    116,143,39,47,16,12,242,185,127,138,254,114,187,152,147,23,223,27,51,100,44,82,66,187,222,57,14,155,148,143,124,176,
+    5,191,7,87,99,214,223,218,239,91,201,164,62,209,190,252,77,78,217,162,122,250,104,191,47,240,24,167,35,204,249,182,
+    133,78,7,171,223,154,169,142,181,174,44,33,5,210,7,132,176,101,53,71,13,144,84,4,121,99,180,88,178,223,131,147,
+    41,11,83,98,161,197,3,168,163,118,129,42,157,227,220,19,202,98,94,56,231,55,189,86,138,186,242,254,224,126,185,212,
+    168,47,45,193,38,147,145,79,185,21,159,55,251,146,167,69,170,54,136,50,39,170,122,214,253,27,139,88,52,99,173,16,
+    253,16,249,243,224,27,45,29,42,244,89,66,47,126,255,26,58,31,42,50,87,22,249,3,93,95,203,69,137,110,155,214,
+    105,109,44,61,133,12,210,125,77,204,96,10,104,6,40,75,35,207,104,194,39,21,43,46,169,42,57,4,149,26,19,90,
+    56,58,155,59,254,71,15,166,26,175,108,45,244,13,196,107,28,228,95,95,64,252,21,169,11,213,199,230,45,29,18,185,
+    101,152,215,48,208,84,89,228,127,16,195,188,125,185,110,235,255,13,216,186,18,18,228,93,64,254,46,54,123,49,229,191,
+    68,231,36,145,244,232,132,55,70,192,70,75,62,242,52,62,77,154,110,231,67,255,53,30,35,115,76,229,92,37,243,94,
+    130,145,192,249,187,196,235,199,168,163,197,114,143,194,192,101,129,94,31,125,83,7,2,211,13,96,248,185,91,165,77,196,
+    61,50,177,153,69,159,87,201,221,129,175,156,133,123,191,192,248,142,239,181,187,254,73,146,129,124,202,193,169,0,202,139,
+    113,223,145,193,93,24,150,79,79,117,107,189,95,93,104,50,82,226,38,98,37,210,196,87,228,10,44,126,161,154,182,14,
+    16,89,57,236,134,69,19,121,166,241,59,39,254,105,179,44,22,226,61,237,177,33,180,114,228,49,158,214,128,59,6,110,
+    1,221,128,216,187,251,17,252,211,108,153,210,82,104,123,109,117,223,156,73,64,110,134,10,210,25,66,5,83,178,121,9,
+    12,254,236,151,75,77,148,218,2,44,178,62,192,33,200,8,104,35,96,24,95,55,92,190,181,192,164,96,76,22,114,174,
+    215,167,20,178,59,69,121,21,151,50,51,86,250,66,243,194,166,218,159,235,245,224,96,7,1,170,22,129,232,220,242,36,
+    220,61,74,191,141,195,118,67,71,110,44,130,127,24,92,5,92,202,146,88,206,16,93,111,164,150,57,196,122,179,46,190,
+    164,87,160,191,50,196,76,186,9,76,40,170,24,130,154,35,15,71,209,192,40,233,198,108,97,101,56,188,34,74,119,255,
+    111,90,206,40,250,144,211,30,174,213,32,23,134,176,240,117,125,179,75,200,171,103,108,252,122,73,229,0,183,177,73,245,
+    240,196,66,111,141,82,40,244,143,125,86,108,154,177,60,125,103,76,185,52,169,199,94,232,39,109,150,210,223,223,46,240,
+    44,98,242,232,154,196,115,138,32,15,250,251,106,215,104,246,166,251,142,166,142,37,159,234,6,12,87,24,224,1,193,171,
+    48,88,64,31,30,132,222,110,91,34,240,249,134,60,114,145,14,54,43,74,197,35,248,28,33,56,48,69,135,3,68,49,
+    5,37,127,171,116,191,11,162,200,105,238,225,254,224,217,131,11,218,163,26,134,219,155,65,14,241,60,160,76,91,217,90,
+    9,228,100,103,116,175,237,85,212,130,252,187,12,92,206,169,204,134,98,160,87,76,224,100,188,10,35,250,252,109,233,45,
+    135,124,19,125,208,71,65,94,131,111,105,81,62,82,112,136,191,25,46,196,245,68,220,130,186,12,21,106,205,232,64,190,
+    217,182,86,114,91,191,196,28,29,44,38,104,161,223,70,82,193,80,148,105,113,132,14,33,174,145,14,170,83,249,176,236,
+    229,156,184,229,91,229,186,236,172,129,232,64,176,27,51,170,64,253,220,222,20,7,54,253,3,25,253,230,203,3,95,140,
+    13,23,78,225,31,247,160,135,51,188,26,168,42,243,226,13,38,188,212,10,113,224,218,204,103,97,247,189,37,102,153,77,
+    99,143,241,173,54,109,110,140,0,176,196,174,5,219,23,93,106,197,240,126,75,89,96,74,128,245,222,159,117,254,74,125,
+    19,111,3,188,182,157,83,192,224,105,168,154,180,25,226,215,124,44,240,229,249,215,183,188,92,180,38,57,104,236,146,179,
+    242,151,162,179,115,216,91,217,249,135,215,142,90,253,92,74,219,248,255,176,212,104,228,171,122,129,106,238,19,157,38,183,
+    67,202,11,135,47,0,156,40,220,14,53,115,176,156,156,230,103,241,188,242,173,109,226,34,218,19,160,252,57,164,69,188,
+    219,46,182,36,38,73,68,109,17,185,184,48,115,255,217,61,82,188,219,239,154,107,180,6,39,255,227,55,149,214,176,15,
+    116,178,216,185,58,8,180,91,201,121,134,26,32,202,191,241,189,50,217,69,123,102,109,223,125,117,67,69,20,115,207,61,
+    66,96,95,74,111,65,1,253,154,3,91,35,147,66,245,254,200,45,138,232,157,199,12,91,126,220,68,203,154,167,92,53,
+    165,37,218,230,190,104,202,63,254,43,211,255,160,157,203,84,173,162,21,184,26,58,176,145,143,34,6,44,26,84,212,2,
+    118,27,240,233,227,145,13,145,52,18,69,150,143,10,35,88,63,93,46,144,82,136,187,117,46,92,43,44,229,45,253,112,
+    178,220,89,175,252,51,56,90,187,15,156,120,51,19,182,104,105,26,132,113,243,52,156,82,186,44,213,243,153,165,81,91,
+    29,216,202,32,227,149,255,163,138,205,13,248,74,67,198,122,123,4,93,50,212,236,186,100,15,5,65,236,107,127,36,114,
+    4,132,195,241,55,32,100,112,188,77,216,43,131,133,244,48,173,78,105,219,155,127,143,68,71,243,246,16,6,25,84,178,
+    64,233,246,219,234,0,79,5,126,198,62,64,84,60,69,177,116,203,118,234,130,215,11,6,82,201,79,139,131,129,92,30,
+    81,227,131,219,114,194,246,62,86,167,193,182,142,135,87,209,189,42,8,211,243,252,210,178,224,102,80,21,26,204,43,183,
+    51,107,72,206,23,179,140,161,219,36,15,138,8,128,128,212,192,39,151,218,180,184,66,156,165,0,25,78,192,9,195,8,
+    86,11,212,68,190,3,1,13,21,15,123,135,194,83,51,68,40,22,60,89,171,204,6,220,254,118,220,17,123,179,4,2,
+    16,145,204,192,157,189,22,162,247,92,26,21,218,89,33,168,98,18,107,34,143,179,151,34,247,44,94,27,170,255,212,236,
+    69,65,133,215,167,241,116,107,145,29,144,127,178,235,242,13,105,130,147,143,66,88,121,63,3,19,89,2,76,234,151,63,
+    113,217,251,149,166,149,210,192,206,76,106,212,95,184,214,78,13,82,185,180,203,194,151,230,123,210,185,81,220,24,48,186,
+    177,178,13,59,100,40,18,130,133,50,60,74,114,51,67,46,157,54,16,160,7,50,107,9,153,202,18,65,3,162,1,168,
+    223,40,22,251,238,151,172,48,137,111,31,48,126,140,46,26,130,182,50,218,132,134,86,93,177,145,73,248,133,211,13,89,
+    47,187,241,130,178,70,76,223,4,67,44,186,95,116,195,32,78,22,221,221,206,250,151,181,233,101,60,117,198,190,125,242,
+    251,206,201,49,98,90,188,224,96,181,162,12,108,45,197,19,26,227,95,31,194,88,254,49,158,47,96,112,208,150,228,98,
+    127,82,113,172,135,234,71,6,130,115,173,232,132,79,211,57,128,75,194,215,169,108,177,85,31,230,220,6,99,227,194,126,
+    51,77,229,28,112,253,230,244,234,5,249,27,82,228,39,245,163,233,136,185,78,194,19,224,193,30,233,89,56,69,35,174,
+    182,209,245,135,138,92,13,195,114,229,175,130,22,47,86,158,9,245,161,96,180,94,250,58,240,227,169,153,221,226,127,163,
+    10,47,221,233,115,218,9,75,218,107,75,229,200,37,67,224,248,87,73,38,236,35,213,31,10,203,238,189,143,167,119,43,
+    28,205,224,184,114,44,107,90,31,219,14,253,5,57,112,49,164,132,49,34,89,65,187,188,167,159,121,163,65,90,114,18,
+    20,27,102,83,100,80,92,81,211,8,121,80,203,167,148,164,60,120,212,113,215,185,166,58,212,254,76,168,233,188,231,228,
+    209,235,43,113,213,197,22,44,58,181,95,149,114,205,165,80,50,61,67,127,133,215,10,112,228,133,86,154,125,195,81,182,
+    255,82,161,53,68,238,68,54,252,19,250,159,163,24,172,10,179,206,253,139,118,72,160,191,19,24,239,214,141,236,135,53,
+    176,97,235,31,7,200,242,132,112,124,220,160,138,92,135,36,124,255,99,210,102,208,34,62,113,246,216,246,230,93,27,29,
+    220,186,197,253,131,116,97,129,216,170,239,115,210,229,112,112,98,145,27,99,219,101,177,191,119,28,130,102,8,217,247,200,
+    119,242,170,136,3,64,214,149,2,202,28,180,197,243,37,182,151,227,99,156,174,237,238,229,3,104,133,48,182,254,237,43,
+    246,140,168,124,154,192,3,219,110,19,222,146,128,252,47,193,139,53,222,236,203,130,56,19,133,58,188,177,57,49,48,187,
+    22,129,21,44,32,71,206,115,135,67,45,73,62,77,189,25,140,46,180,49,156,17,96,119,134,41,134,154,215,139,255,42,
+    23,33,130,141,1,99,97,194,209,121,114,123,114,113,252,149,241,70,225,252,46,21,52,237,218,50,220,34,104,33,249,147,
+    44,145,34,233,63,41,84,156,200,49,128,220,248,241,119,90,163,206,202,149,129,85,131,221,161,98,50,253,61,224,10,250,
+    247,147,152,184,55,112,139,169,79,106,135,100,151,127,230,173,190,186,79,27,38,145,117,172,224,183,80,207,46,211,217,102,
+    88,223,78,81,204,191,245,119,253,58,80,93,215,86,9,70,14,198,6,104,73,193,43,76,72,194,20,241,90,198,46,194,
+    48,4,164,144,16,80,14,64,248,26,186,9,9,147,174,158,231,102,138,103,230,12,243,169,64,64,145,98,240,62,107,94,
+    184,28,83,103,223,16,43,126,134,97,168,70,7,130,84,123,208,109,67,32,237,235,185,36,194,60,232,58,150,22,170,210,
+    54,53,245,50,227,20,72,208,119,231,222,147,84,138,211,118,49,219,224,221,208,178,87,102,53,195,242,216,105,21,37,17,
+    26,244,246,192,214,41,102,19,136,157,104,34,140,11,178,90,143,237,9,220,131,69,250,65,209,210,3,34,124,171,181,1,
+    66,248,154,36,130,151,169,143,32,10,47,69,56,180,157,178,248,236,21,171,91,140,78,60,246,231,92,141,89,228,168,60,
+    87,142,21,221,124,102,67,79,251,102,147,14,185,143,31,174,250,42,206,15,113,23,92,170,200,78,193,22,72,50,18,169,
+    224,46,167,156,72,98,198,122,222,54,214,188,1,214,131,189,144,190,187,72,66,50,201,185,196,53,9,73,66,235,140,187,
+    204,131,160,66,193,111,86,253,236,26,215,189,206,43,142,163,229,46,39,84,165,162,190,212,254,52,134,220,112,1,30,230,
+    195,20,223,197,173,50,54,46,238,196,234,7,178,230,154,77,228,201,126,246,194,116,157,166,86,224,57,24,164,177,126,228,
+    94,212,48,4,244,135,109,166,165,130,140,39,184,149,249,243,34,17,135,124,143,195,73,145,171,133,106,30,139,93,246,118,
+    169,179,201,217,196,65,70,200,27,209,197,194,175,3,156,218,171,83,187,120,93,12,191,123,166,85,33,178,54,44,167,61,
+    162,254,58,108,209,135,135,49,132,252,25,63,212,201,243,93,254,7,130,89,209,173,25,101,148,192,134,72,224,195,162,252,
+    57,51,31,120,75,187,79,216,154,109,54,49,25,151,55,93,68,122,241,238,31,53,103,28,43,175,242,251,125,252,202,230,
+    247,69,224,93,43,14,74,210,127,71,143,55,252,159,149,224,231,69,247,43,137,21,22,74,230,109,177,212,70,74,24,69,
+    253,222,164,147,238,129,84,104,140,170,190,149,249,116,196,136,100,165,77,240,221,147,214,239,16,233,49,18,170,217,229,61,
+    47,40,53,53,205,95,14,129,218,113,158,114,181,227,181,62,91,94,195,192,182,88,251,81,130,236,197,211,198,236,10,125,
+    142,230,80,10,149,97,70,212,41,100,202,149,223,60,27,231,224,128,135,165,152,41,36,107,194,14,61,2,144,179,195,199,
+    111,249,32,12,233,129,59,192,183,192,183,179,32,114,35,205,66,229,209,20,160,137,236,212,241,145,7,84,2,218,190,214,
+    235,89,207,224,158,207,16,110,236,217,60,156,121,191,145,116,201,154,250,157,145,74,211,183,55,134,100,21,23,163,131,220,
+    209,205,124,27,208,221,114,14,52,144,203,78,2,130,97,83,4,192,32,45,12,57,246,111,21,10,26,188,65,151,179,53,
+    68,158,102,124,85,75,151,63,64,140,81,240,117,139,121,30,199,15,214,97,161,187,114,239,108,217,43,74,91,183,3,199,
+    51,238,142,97,89,25,116,47,47,177,41,136,156,244,18,92,48,37,88,143,53,208,26,82,58,75,23,225,123,131,120,85,
+    157,255,182,112,34,46,137,1,251,208,171,172,59,193,83,189,213,59,237,83,133,145,241,148,16,10,232,127,3,241,93,51,
+    95,104,133,95,10,189,203,196,172,100,131,77,158,142,138,44,190,33,178,251,97,127,236,2,6,204,180,211,145,14,220,29,
+    69,54,187,227,130,22,171,176,160,145,28,112,200,37,180,204,235,168,86,244,207,106,183,222,236,184,118,73,3,96,121,198,
+    137,226,140,112,4,214,98,132,9,78,202,166,206,181,85,93,10,103,8,182,119,225,172,190,142,251,164,245,166,228,44,215,
+    0,71,132,244,223,248,173,21,202,50,180,121,122,136,229,22,85,58,131,58,8,123,56,207,24,55,245,43,48,148,230,79,
+    181,206,30,49,222,120,155,140,186,193,34,80,38,122,88,141,15,115,67,25,153,68,98,232,168,21,169,60,201,102,246,32,
+    189,8,46,21,35,32,98,160,192,124,104,121,7,52,80,94,31,141,66,141,88,139,45,149,65,102,200,244,135,200,109,238,
+    38,47,170,124,45,11,241,150,221,73,36,38,108,108,81,13,24,195,57,136,142,254,32,230,245,213,44,111,11,141,214,78,
+    194,135,56,105,118,66,198,251,234,136,137,35,139,86,140,194,124,22,49,56,193,57,248,29,234,186,58,42,17,225,170,113,
+    66,167,80,46,21,103,175,230,70,139,86,228,176,157,142,84,90,30,240,217,56,118,208,15,43,204,27,237,242,114,69,1,
+    151,182,186,67,153,228,28,147,25,245,206,126,133,14,105,182,31,108,205,189,156,36,236,160,239,99,182,19,218,94,230,213,
+    181,171,80,40,4,24,108,253,137,107,69,37,237,213,155,200,199,159,65,58,193,206,106,39,216,111,136,179,210,193,82,47,
+    212,171,94,41,219,78,218,36,245,33,111,206,89,40,168,48,225,33,186,151,235,73,179,102,75,6,162,152,94,23,119,246,
+    195,6,113,103,92,95,70,78,24,227,100,102,197,52,188,227,173,238,111,172,51,72,157,236,81,254,126,44,151,153,49,166,
+    66,211,150,224,34,71,47,236,19,211,88,230,230,169,152,60,123,237,4,165,112,6,130,219,232,43,21,29,34,175,45,255,
+    7,29,100,58,73,46,129,142,15,16,98,190,188,243,78,66,69,23,118,128,79,163,210,217,64,7,141,158,202,158,111,209,
+    216,144,0,94,10,176,207,112,154,177,5,75,182,230,226,250,151,46,140,65,69,102,53,13,191,181,158,152,73,116,48,17,
+    58,35,198,253,9,171,205,186,50,23,24,26,108,34,86,96,45,8,99,138,173,24,162,219,206,145,59,176,168,174,177,38,
+    37,232,32,107,112,183,85,79,113,255,58,110,97,99,124,11,119,228,96,78,37,72,192,120,95,238,78,28,10,121,205,177,
+    242,207,100,249,226,141,100,230,89,243,106,61,186,237,241,125,3,131,142,52,190,188,44,191,169,146,235,156,219,96,155,56,
+    178,120,53,163,156,67,82,199,24,192,55,111,168,134,117,219,180,107,156,91,114,86,112,147,207,219,95,94,97,135,126,158,
+    105,254,20,195,38,8,97,144,224,165,15,194,51,14,207,83,223,53,52,82,174,243,66,160,249,163,8,173,182,226,236,20,
+    29,41,155,120,225,139,67,213,19,37,139,125,88,97,196,27,105,142,42,208,237,36,211,201,187,216,73,218,30,136,174,253,
+    105,18,134,253,245,34,109,238,230,153,66,191,144,248,236,72,161,217,234,248,146,197,252,116,163,200,178,155,140,49,226,142,
+    128,162,244,70,53,251,241,129,174,36,236,64,44,196,220,103,151,37,79,61,25,96,33,123,42,58,28,107,67,241,214,106,
+    76,50,46,49,246,234,229,13,53,119,172,250,81,48,214,129,231,117,97,223,3,88,170,19,191,112,180,108,85,67,137,25,
+    195,37,85,26,155,6,182,66,200,47,192,136,211,95,83,114,142,29,164,7,29,165,127,106,60,24,191,14,25,211,29,206,
+    27,252,198,208,255,89,187,237,199,48,220,14,156,66,28,224,127,38,4,75,143,172,49,238,54,82,192,183,3,93,44,13,
+    226,233,216,185,27,99,53,241,221,45,208,237,3,142,87,224,167,212,195,56,243,203,87,243,125,146,244,190,240,111,252,9,
+    199,204,168,3,10,135,156,9,85,142,211,64,196,39,149,8,55,132,15,212,0,171,73,100,2,102,17,14,202,132,187,56,
+    14,11,97,241,223,137,157,53,250,210,80,49,207,79,228,224,18,245,67,237,189,76,56,27,29,72,197,72,88,47,57,189,
+    56,225,219,157,160,0,32,165,54,193,70,108,183,8,147,140,53,209,20,166,50,184,174,237,42,171,27,180,211,165,33,155,
+    114,166,245,216,133,186,36,96,87,38,242,140,131,224,168,147,231,213,181,124,192,104,109,58,219,53,244,160,43,199,247,185,
+    209,63,110,239,231,165,160,213,177,23,113,227,233,192,247,212,187,48,130,92,174,57,225,10,65,38,190,204,180,195,38,54,
+    176,246,11,124,141,19,75,244,65,45,214,2,168,231,79,99,115,31,79,253,181,211,189,247,121,16,137,229,132,118,211,246,
+    65,15,218,140,146,111,250,87,203,8,202,87,100,9,129,148,147,252,200,191,120,87,25,112,225,62,149,186,110,122,44,195,
+    198,11,23,244,210,80,77,19,0,8,30,62,219,77,98,161,1,46,65,252,127,197,150,203,48,113,157,49,23,72,16,220,
+    7,197,232,46,208,50,149,10,213,129,42,156,55,68,178,3,212,247,73,214,123,101,198,172,215,86,45,219,175,130,98,201,
+    123,193,6,102,230,23,205,198,176,236,164,123,50,39,81,255,82,209,141,35,227,188,237,242,196,42,94,131,129,178,174,41,
+    206,45,161,177,255,135,131,178,221,231,66,87,233,146,0,12,20,202,59,148,251,74,144,120,221,132,144,39,9,175,217,142,
+    171,63,44,246,26,108,237,192,199,26,53,47,125,20,17,226,104,10,85,230,127,72,15,147,124,8,97,144,237,148,5,237,
+    93,5,107,142,226,56,151,97,142,164,189,229,181,230,233,223,75,27,245,205,56,242,50,134,133,118,182,95,125,108,36,155,
+    91,240,153,245,235,75,41,32,152,190,196,187,129,35,62,4,247,76,58,44,216,35,193,78,22,107,220,111,157,161,232,100,
+    17,127,186,222,153,6,210,95,139,207,236,148,148,181,94,117,119,220,79,39,251,228,240,247,220,172,82,26,170,243,89,162,
+    109,223,71,28,70,201,59,81,5,51,101,221,240,101,125,244,163,18,168,173,80,141,90,41,76,21,170,252,5,183,76,13,
+    203,2,108,180,85,28,193,204,201,9,116,6,12,246,163,101,178,122,0,21,227,210,19,158,142,99,6,60,56,173,154,229,
+    95,21,247,8,45,182,190,66,76,222,229,209,20,9,43,247,119,128,167,115,239,253,41,230,18,3,179,119,121,170,90,151,
+    242,188,227,107,50,99,185,100,207,242,233,168,60,124,200,75,202,225,175,240,48,249,197,185,30,78,191,41,222,177,4,184,
+    208,76,144,150,2,228,11,177,10,195,70,211,137,223,142,184,36,192,82,2,183,132,71,188,154,32,43,34,58,150,104,211,
+    237,43,5,130,61,206,155,190,226,206,6,207,6,33,13,89,52,10,26,99,44,30,170,145,244,137,136,102,32,74,210,144,
+    250,131,36,98,163,57,35,11,54,137,146,74,8,134,152,103,112,238,135,155,82,252,250,28,118,249,142,34,24,178,145,36,
+    86,237,230,248,14,236,142,114,92,227,103,177,25,55,102,118,83,228,66,15,142,102,193,186,4,151,151,59,125,18,57,69,
+    13,33,145,176,122,187,53,75,197,208,157,56,161,22,47,198,166,182,113,228,213,200,209,229,144,189,154,149,212,113,74,74,
+    226,138,150,141,179,125,50,72,12,234,30,36,163,170,186,164,83,190,38,140,146,24,165,16,13,42,37,36,211,252,38,49,
+    123,42,49,34,220,135,58,58,122,58,43,153,67,96,142,207,59,171,70,202,118,211,132,204,191,203,28,66,101,25,145,240,
+    205,95,67,83,57,34,240,180,246,39,152,38,5,162,39,179,124,83,158,61,147,135,10,51,160,196,145,155,134,153,133,63,
+    165,222,17,92,103,136,99,75,74,108,3,88,233,5,223,159,107,236,2,75,90,5,178,156,105,248,42,169,16,249,235,14,
+    17,54,28,125,229,36,236,5,145,113,174,183,26,158,228,79,143,12,4,117,253,42,36,158,148,100,175,96,246,135,61,75,
+    243,113,177,65,78,181,141,12,226,113,135,78,138,26,177,147,158,92,40,9,76,247,80,203,179,1,137,40,119,94,231,56,
+    28,140,159,34,108,103,2,227,180,82,21,41,130,100,14,170,252,39,17,172,134,16,101,99,214,50,201,197,8,66,141,225,
+    15,37,43,73,207,244,151,144,43,81,216,235,195,127,42,217,46,69,229,237,205,53,232,220,134,188,241,134,167,73,225,220,
+    7,11,155,36,183,78,249,104,67,138,4,27,13,255,234,97,166,140,235,210,9,175,213,8,103,157,110,30,11,212,190,71,
+    136,147,99,145,219,70,200,180,116,104,110,232,221,111,18,60,232,183,106,246,54,148,97,76,210,175,76,247,94,139,113,43,
+    216,169,21,75,45,121,116,123,52,234,126,206,142,245,19,168,155,198,215,218,222,207,174,151,204,191,20,242,58,221,169,12,
+    97,52,106,221,205,126,180,109,140,51,226,90,198,213,107,177,201,68,4,165,238,244,237,236,204,222,186,100,120,0,50,107,
+    220,107,242,100,103,218,188,101,184,150,167,39,131,132,43,159,184,26,152,126,225,142,105,53,99,37,7,22,121,112,44,243,
+    3,248,35,20,145,218,78,35,10,145,195,219,222,252,72,109,21,63,153,231,244,55,1,209,18,41,156,226,33,116,5,119,
+    127,26,112,138,127,237,135,111,123,12,121,146,50,153,24,80,207,5,208,1,198,198,236,194,197,62,205,13,223,202,71,160,
+    39,73,143,191,96,222,41,162,3,23,84,202,117,60,69,28,6,103,84,7,57,158,24,54,1,18,110,117,116,109,59,3,
+    7,7,131,157,41,104,71,40,21,196,178,210,254,143,221,51,116,101,72,155,105,112,193,180,100,241,85,77,168,211,126,190,
+    120,233,7,116,248,240,205,237,88,86,183,15,75,138,107,235,148,52,137,236,196,86,94,62,118,239,86,217,25,195,136,123,
+    16,228,101,46,195,205,96,28,110,63,35,46,104,230,98,34,102,50,57,252,134,117,46,146,214,138,95,207,19,115,249,132,
+    186,56,129,37,160,167,35,173,210,206,159,35,199,151,157,166,85,133,88,253,146,177,195,144,94,0,90,22,152,217,176,108,
+    165,23,66,162,133,206,95,84,128,28,174,224,138,110,138,195,40,221,64,224,130,212,16,145,61,216,185,190,156,43,119,237,
+    103,231,217,97,123,34,56,42,27,198,232,234,244,94,106,139,25,215,70,145,149,227,52,143,18,103,144,176,208,190,221,158,
+    210,125,144,162,113,99,173,244,223,117,255,112,44,245,208,125,65,165,76,63,36,182,255,253,105,200,204,186,188,226,213,117,
+    75,192,85,234,77,71,86,82,195,193,158,39,231,91,79,36,248,34,187,127,243,84,109,254,26,188,202,123,3,238,254,1,
+    81,54,192,12,4,159,151,147,93,56,43,218,49,43,208,43,192,12,45,23,241,7,60,251,195,24,18,56,111,28,177,60,
+    208,53,65,186,148,28,105,81,222,210,46,191,157,0,34,253,120,3,8,190,13,55,137,85,80,184,21,53,85,34,83,80,
+    171,219,99,40,65,46,116,13,241,31,19,186,46,188,0,237,49,14,103,163,120,144,123,182,254,152,59,88,242,148,86,178,
+    198,196,179,195,42,210,243,184,62,153,88,94,145,44,3,252,41,158,77,91,80,131,97,179,233,198,50,246,155,149,226,222,
+    113,197,2,135,9,250,159,96,154,84,215,151,0,165,136,193,37,80,115,140,208,83,24,8,63,82,150,186,99,168,207,48,
+    39,74,13,157,38,30,173,95,218,215,151,246,18,191,119,12,171,237,185,245,204,219,155,25,191,238,225,233,206,121,247,25,
+    57,190,111,119,133,97,105,181,136,238,26,53,133,50,141,159,48,202,0,61,205,162,192,129,152,223,67,194,204,23,154,19,
+    90,234,143,100,106,124,116,254,116,220,132,230,22,138,105,242,161,90,42,255,8,185,11,226,166,74,8,142,166,110,32,200,
+    89,157,91,78,182,176,199,162,135,235,89,24,69,178,203,243,127,150,76,200,132,13,186,29,154,132,91,3,22,221,13,15,
+    34,42,89,197,23,93,18,175,86,137,107,4,31,203,195,201,87,152,61,150,255,219,67,20,32,104,24,81,33,244,150,149,
+    21,112,106,250,1,32,133,156,110,216,137,110,216,69,43,126,189,219,85,106,74,171,245,51,146,165,108,107,64,36,52,78,
+    103,153,139,158,99,215,173,154,178,145,151,152,250,213,77,179,250,129,24,248,251,243,216,127,118,223,8,46,104,211,170,61,
+    72,59,238,214,120,50,56,77,42,106,236,16,208,153,117,21,212,124,167,125,222,231,158,44,151,124,111,194,86,101,59,144,
+    177,119,118,27,236,184,195,45,100,83,130,141,153,22,76,83,10,184,169,203,85,28,209,137,39,51,106,70,130,232,129,187,
+    189,56,99,128,52,117,117,5,123,48,26,231,60,49,58,233,27,36,85,252,99,111,14,79,153,235,38,128,6,238,14,47,
+    236,176,118,9,214,198,141,10,115,218,202,4,36,131,127,101,129,32,38,197,138,190,57,247,115,243,224,89,166,215,134,222,
+    165,12,16,193,229,174,124,37,116,129,121,17,242,181,115,44,38,113,195,56,185,1,33,103,73,6,213,55,189,75,178,75,
+    132,81,107,84,211,26,71,2,54,5,85,171,246,168,123,12,226,94,70,117,74,228,112,64,164,48,84,245,65,104,147,145,
+    161,39,24,138,54,191,203,145,227,223,90,183,62,237,140,55,249,132,83,144,55,129,145,73,206,57,1,38,100,190,157,40,
+    56,61,65,255,59,118,206,186,112,40,74,225,39,67,48,126,99,47,26,118,96,240,120,226,239,13,167,15,113,20,241,39,
+    69,128,173,29,155,150,11,140,98,109,213,227,128,242,188,18,182,154,144,184,209,90,156,109,100,41,19,25,13,33,59,145,
+    29,55,53,200,15,106,68,41,81,113,215,13,234,48,96,184,214,41,119,100,124,28,148,87,239,3,115,216,47,42,116,113,
+    204,50,138,57,115,165,221,139,150,55,0,140,61,204,120,252,54,49,196,233,112,221,103,43,126,55,103,71,193,52,129,200,
+    255,181,21,205,222,239,74,88,46,203,197,241,113,80,138,157,6,168,79,53,50,204,24,146,121,244,103,104,14,95,183,193,
+    102,124,118,6,156,242,17,44,33,164,85,4,234,143,160,90,103,89,187,189,96,222,180,71,105,198,234,145,103,106,41,233,
+    217,63,208,62,115,136,69,1,123,137,205,52,204,36,69,231,115,119,213,5,119,0,152,115,174,127,194,211,29,141,157,100,
+    18,147,102,57,217,247,154,110,123,60,50,218,114,211,84,43,81,49,178,204,207,51,22,50,201,182,73,207,131,45,142,178,
+    122,189,180,10,183,102,176,235,103,197,182,203,133,170,129,77,58,191,205,27,212,136,132,24,51,181,69,31,147,205,10,23,
+    89,17,183,78,199,181,125,107,162,98,232,179,140,209,74,241,164,118,190,121,152,2,151,247,155,254,95,236,196,241,79,229,
+    6,246,201,233,142,43,103,113,189,243,60,206,242,26,141,11,126,77,50,219,255,3,171,157,94,133,94,154,253,87,208,153,
+    53,82,1,114,106,131,139,13,52,66,243,106,228,58,181,107,97,164,3,236,62,211,32,161,205,146,5,40,37,224,79,233,
+    64,203,82,34,191,57,59,181,219,192,150,232,180,97,230,113,216,223,207,22,72,116,49,105,155,100,211,127,95,111,120,157,
+    87,60,150,217,240,151,93,151,202,54,28,199,62,158,34,47,6,56,177,173,237,44,191,197,253,55,11,168,127,220,108,56,
+    45,36,84,188,141,20,132,139,71,210,14,164,139,210,70,211,243,211,59,102,248,11,19,209,67,188,15,50,225,63,36,220,
+    189,222,19,120,241,47,161,12,139,3,31,191,30,221,147,255,91,3,2,98,103,113,40,36,20,174,235,224,225,144,220,10,
+    128,81,204,7,184,8,110,194,186,218,24,38,53,40,253,206,108,212,90,38,77,104,13,177,188,193,77,32,137,67,217,86,
+    241,11,7,151,197,240,74,19,107,11,118,188,219,220,248,28,4,239,144,124,209,202,254,9,186,175,112,60,41,190,27,42,
+    48,232,110,238,44,145,223,202,88,56,87,210,235,6,146,38,249,46,93,23,245,237,39,236,155,236,115,168,1,149,221,236,
+    245,22,123,232,199,220,231,76,157,233,71,161,65,249,160,150,240,222,91,168,90,214,237,7,86,223,68,208,205,47,140,245,
+    219,173,146,59,120,103,78,242,47,233,58,39,242,224,99,195,19,149,99,216,188,184,142,239,96,141,3,79,173,174,250,202,
+    112,144,15,134,82,181,196,61,190,141,79,29,139,80,6,238,132,207,83,198,67,255,59,5,114,15,0,187,130,45,227,7,
+    149,232,40,254,173,96,113,13,80,41,77,139,175,19,29,167,12,192,105,204,228,55,156,122,32,122,109,236,57,4,16,114,
+    224,127,212,20,1,149,253,240,86,245,135,161,201,138,131,135,103,142,105,31,74,194,158,49,192,161,65,102,74,148,14,49,
+    50,117,113,108,235,14,46,207,233,21,0,47,107,155,181,125,138,128,24,32,65,84,175,69,158,77,16,249,121,13,185,219,
+    65,187,158,130,109,252,70,116,103,164,249,140,252,242,92,140,101,180,249,157,42,229,59,227,217,119,122,181,240,68,7,122,
+    185,125,103,191,116,187,23,42,209,124,125,157,208,199,92,135,156,146,171,223,125,227,211,75,44,230,139,145,115,233,131,222,
+    96,210,165,220,97,246,237,11,47,43,95,117,101,216,238,40,144,12,86,52,61,184,137,40,145,227,79,8,5,90,193,45,
+    236,156,219,242,34,217,120,248,86,112,55,26,236,147,243,110,237,211,203,87,147,82,179,207,161,240,199,71,142,140,159,231,
+    185,163,156,56,163,77,78,225,43,237,62,246,8,14,28,63,34,111,41,38,228,143,54,153,141,85,125,83,215,173,234,123,
+    235,20,237,54,190,199,230,58,224,77,233,47,81,41,136,17,46,25,248,46,253,49,72,7,126,134,67,244,198,158,176,69,
+    190,86,234,179,220,161,127,117,255,147,25,78,104,179,132,0,11,149,104,31,125,191,196,159,9,220,70,212,66,72,202,235,
+    6,238,93,220,12,188,218,160,164,178,129,7,95,116,245,172,233,28,42,85,233,144,20,118,96,96,10,22,139,158,23,19,
+    189,125,153,247,155,193,70,156,107,57,12,11,21,198,50,161,38,32,13,240,244,157,10,31,146,13,204,202,223,194,119,148,
+    26,94,11,28,108,95,40,206,128,55,176,13,216,69,181,90,80,6,111,107,123,96,184,125,138,22,127,198,56,240,182,114,
+    87,26,26,82,116,249,212,133,250,87,202,213,48,81,97,182,77,1,216,48,78,111,190,111,110,51,202,175,42,142,98,164,
+    245,191,198,190,179,135,114,227,170,248,25,7,70,49,25,163,33,251,75,177,251,3,253,190,199,60,139,143,142,200,35,206,
+    206,102,182,115,128,215,247,4,131,228,77,138,48,159,190,195,103,201,69,4,172,176,72,65,119,41,69,39,157,44,54,106,
+    120,35,165,101,70,43,141,189,10,182,234,85,205,171,214,235,160,116,155,231,214,146,140,233,80,158,194,198,26,230,246,167,
+    152,56,82,158,108,44,227,185,116,231,43,210,51,159,24,2,93,62,164,21,85,95,45,12,228,183,87,201,196,114,188,170,
+    203,185,84,6,207,7,229,34,222,100,253,26,192,165,134,9,120,61,129,173,222,133,88,8,245,58,201,3,130,247,90,61,
+    207,161,172,154,23,193,127,7,193,29,165,117,7,30,169,229,166,138,89,222,160,92,66,247,134,9,75,9,213,33,72,63,
+    232,173,35,74,25,37,208,43,112,65,43,86,145,53,195,121,227,167,91,148,253,118,142,212,81,136,82,134,186,13,147,73,
+    220,194,87,43,235,121,38,89,214,206,5,100,91,14,46,238,234,222,249,14,188,109,83,51,205,221,224,3,8,6,121,20,
+    47,199,204,166,31,6,161,16,161,118,139,69,1,25,221,171,4,112,60,41,85,106,246,127,102,115,141,124,197,235,30,125,
+    180,47,109,131,226,80,126,60,195,0,103,75,15,47,218,40,205,58,102,188,120,137,167,100,201,42,1,110,242,21,151,3,
+    246,61,53,94,76,37,148,80,205,210,53,154,134,143,196,150,15,193,44,111,14,72,38,144,69,246,150,102,245,24,243,8,
+    81,221,140,96,239,203,199,74,80,234,243,194,1,250,220,176,218,150,57,72,198,134,14,220,27,129,99,179,74,94,123,75,
+    28,70,251,235,187,80,151,8,229,44,12,247,47,7,6,7,103,219,90,193,138,14,163,216,38,88,90,47,215,41,236,91,
+    241,1,60,145,173,1,86,100,112,172,111,188,221,104,209,123,168,131,219,89,175,114,28,10,162,235,150,104,127,155,55,126,
+    48,255,187,43,41,234,113,175,73,179,162,244,124,187,132,202,95,43,109,119,135,12,19,47,172,171,108,51,118,199,39,139,
+    14,42,245,212,173,167,194,188,204,0,244,147,188,190,84,65,46,236,108,175,231,244,6,128,168,141,117,160,13,202,232,16,
+    154,221,37,32,78,40,121,114,196,183,153,154,242,110,246,232,35,226,128,68,243,212,52,10,0,145,43,182,246,72,242,61,
+    124,244,156,223,13,162,91,42,179,131,44,127,52,248,2,61,127,224,125,183,78,116,103,28,135,223,3,119,52,133,83,213,
+    199,237,58,40,170,42,39,162,154,111,91,85,189,212,118,236,30,12,118,230,137,17,3,154,25,121,145,109,159,200,68,231,
+    171,21,215,193,12,231,78,232,187,241,194,24,27,242,39,127,192,181,97,12,11,223,234,122,107,211,121,8,143,41,127,54,
+    53,96,101,7,250,247,188,121,36,16,4,17,76,16,28,68,76,244,146,20,137,39,182,230,132,98,5,243,242,85,117,241,
+    158,59,135,131,139,229,198,81,180,36,243,202,141,143,36,197,214,116,11,179,50,252,138,60,152,75,65,189,229,127,255,249,
+    158,214,214,51,196,199,254,215,21,229,104,65,52,219,122,90,25,237,0,19,43,209,113,235,25,75,169,30,43,141,168,250,
+    228,229,162,210,188,79,138,89,5,26,165,24,125,53,113,91,44,57,91,184,50,249,58,70,60,1,76,199,55,46,68,62,
+    157,5,199,250,249,137,85,156,80,97,5,250,164,64,120,96,222,178,29,246,185,108,180,196,49,22,34,108,162,113,44,104,
+    54,28,65,25,190,72,178,162,177,114,132,224,14,79,141,3,132,112,122,78,182,177,196,125,136,69,239,206,201,70,202,241,
+    201,201,97,133,100,161,200,105,224,100,24,84,4,124,98,167,33,78,29,154,51,195,118,58,124,148,127,236,243,158,137,217,
+    177,91,242,191,247,49,120,110,54,75,30,86,125,103,139,250,48,62,132,62,255,148,133,157,19,74,153,52,73,17,71,0,
+    2,252,130,17,30,147,241,9,193,116,131,225,67,101,200,221,42,177,146,236,157,145,139,181,107,107,63,94,71,73,160,174,
+    188,53,142,168,84,96,42,30,171,37,147,120,20,150,153,175,47,21,48,7,134,196,45,22,84,159,33,109,237,109,185,21,
+    157,121,37,126,128,80,124,89,49,181,162,215,137,233,154,199,143,4,202,164,57,165,47,96,74,29,217,142,124,65,166,88,
+    139,12,85,121,234,25,129,132,96,90,166,6,113,11,218,187,145,32,212,149,114,130,22,101,53,198,212,92,122,21,157,229,
+    60,201,217,74,160,138,171,189,51,250,198,231,70,134,14,228,7,141,72,169,127,28,74,167,158,44,203,43,240,154,33,229,
+    163,212,212,112,133,150,76,227,72,229,115,43,183,102,44,227,188,165,121,239,165,182,59,29,185,74,90,243,136,250,36,151,
+    15,161,89,41,163,204,59,216,149,139,223,27,204,244,30,32,97,20,145,45,219,198,109,77,166,126,67,4,2,209,141,164,
+    117,247,69,30,193,227,234,181,157,47,31,41,206,119,178,60,59,12,222,93,54,42,170,166,226,163,80,8,11,66,32,122,
+    186,19,69,11,202,38,114,223,129,240,234,197,202,187,142,74,16,183,105,166,217,163,80,61,55,76,221,132,217,48,212,48,
+    167,33,160,217,159,201,248,16,206,35,161,177,243,221,218,138,71,65,190,63,31,243,208,205,119,75,95,82,15,234,161,63,
+    252,75,83,240,246,116,73,133,15,249,65,37,225,93,48,56,182,57,216,146,132,50,78,202,83,173,223,131,169,18,135,40,
+    91,107,116,8,236,84,221,128,184,119,221,26,242,178,191,20,146,108,217,170,85,166,223,61,243,155,199,161,47,228,27,189,
+    171,156,214,172,222,32,238,162,41,90,132,128,195,194,230,211,57,99,155,126,103,238,26,32,111,126,9,196,75,163,175,46,
+    131,159,123,128,212,242,172,60,17,129,206,30,23,210,62,114,128,136,215,28,153,102,63,107,15,49,185,194,242,156,243,137,
+    38,248,235,49,137,159,249,197,200,192,190,202,141,31,79,103,29,236,169,19,231,219,81,52,16,226,35,123,1,209,69,203,
+    155,138,231,190,17,53,120,3,82,207,51,160,61,111,159,141,202,198,247,210,106,0,89,160,100,30,61,132,202,15,122,25,
+    59,71,122,217,68,8,79,12,172,83,97,223,73,184,126,0,33,81,91,220,82,155,12,23,42,94,70,244,80,168,144,148,
+    181,73,117,163,168,77,117,255,251,12,55,140,174,5,141,122,247,1,230,11,142,7,62,112,164,6,207,94,157,16,148,49,
+    253,188,129,52,125,207,198,166,218,165,141,254,114,3,40,232,155,161,119,59,137,143,25,224,129,40,228,78,133,128,238,189,
+    158,170,237,39,214,220,79,240,6,38,226,70,4,40,210,218,38,225,210,64,15,178,9,53,214,31,137,60,15,108,150,234,
+    153,207,194,160,116,2,240,19,131,172,176,69,94,60,103,166,204,227,240,115,23,73,20,130,17,190,209,115,63,78,50,223,
+    123,231,138,14,129,16,253,53,106,228,211,110,71,113,196,36,180,19,120,117,24,162,39,141,201,230,66,249,172,184,240,217,
+    81,135,15,182,139,173,206,15,8,12,6,42,4,229,52,252,25,37,161,228,47,223,166,204,99,141,129,109,167,28,254,107,
+    163,27,199,19,153,167,87,11,52,148,215,16,128,94,235,238,52,178,215,3,53,190,198,225,30,190,15,187,139,133,24,229,
+    60,10,214,66,81,204,185,239,123,125,15,15,226,204,118,210,138,111,25,255,141,190,10,153,166,192,142,197,218,157,148,102,
+    179,49,128,58,165,58,51,142,63,183,142,79,195,137,12,165,51,82,16,108,130,252,204,177,120,226,65,173,145,57,222,0,
+    125,243,140,252,41,236,69,86,32,103,129,184,60,39,7,109,239,212,184,50,96,196,2,243,11,74,7,216,176,52,3,126,
+    27,98,86,99,124,229,118,110,201,202,85,112,112,128,113,123,39,196,125,121,161,87,141,73,88,114,233,77,226,89,208,185,
+    164,31,157,255,61,142,50,12,196,177,45,195,160,29,76,205,199,203,33,167,93,139,187,200,55,12,29,58,47,222,171,56,
+    149,102,121,167,159,186,180,246,152,228,196,15,191,229,77,179,174,101,102,151,240,70,21,125,165,51,114,107,198,224,138,238,
+    235,12,94,105,125,75,206,238,163,70,101,67,30,136,245,22,36,58,105,21,55,173,81,35,99,247,107,232,57,201,134,211,
+    20,125,129,249,127,245,189,49,13,208,104,228,20,150,234,167,4,217,115,232,2,137,231,224,30,126,60,195,14,234,251,115,
+    87,220,44,142,99,233,164,45,94,211,63,137,16,255,181,44,33,111,230,242,27,184,71,131,37,122,47,93,50,75,161,19,
+    166,40,58,87,42,129,40,12,46,47,21,224,139,160,191,211,69,254,33,0,13,132,177,31,193,207,25,37,128,254,82,89,
+    183,102,23,237,130,104,92,80,161,239,19,33,68,243,33,30,156,244,29,232,23,146,216,96,58,146,214,79,3,159,93,50,
+    56,178,128,6,236,156,216,88,144,80,155,222,77,247,80,176,67,52,194,148,125,136,203,227,22,48,175,28,113,17,55,198,
+    183,49,70,193,125,81,57,55,232,99,196,14,134,121,245,55,230,143,142,216,126,121,49,235,146,38,170,120,37,124,190,105,
+    202,248,211,176,172,168,234,31,189,0,35,89,202,147,33,148,177,173,61,133,188,151,24,170,6,94,69,75,247,79,227,220,
+    2,146,82,48,167,143,96,195,98,57,17,30,183,85,209,202,69,226,215,94,228,228,30,97,16,173,40,83,185,232,248,64,
+    209,208,11,242,135,13,6,141,41,118,14,95,7,107,137,129,149,144,208,151,9,55,167,222,174,235,33,35,11,0,155,210,
+    151,159,37,52,9,121,254,214,135,158,121,171,22,191,139,145,142,152,123,250,88,165,49,70,182,88,192,139,77,98,55,16,
+    40,192,33,234,79,24,55,88,194,41,51,62,171,254,251,116,201,153,95,54,230,15,13,227,97,73,68,89,218,139,87,36,
+    233,72,66,76,235,79,16,38,233,135,80,148,243,69,35,92,31,77,95,12,178,224,90,209,17,160,209,72,109,33,135,12,
+    205,174,122,18,113,20,84,226,196,22,20,106,184,28,105,123,247,232,196,22,101,252,25,18,74,241,94,232,221,99,254,187,
+    84,210,193,176,53,214,50,82,136,91,12,194,208,219,4,211,249,214,3,5,148,59,188,90,128,18,107,142,125,2,251,23,
+    222,203,21,153,231,2,127,29,208,198,118,155,225,152,67,4,241,37,6,156,129,191,172,121,89,131,173,203,92,68,171,98,
+    239,170,252,229,71,130,121,110,94,248,57,24,82,24,249,255,86,246,61,213,162,43,58,73,45,58,103,193,168,95,61,94,
+    131,147,61,163,249,249,67,168,87,197,105,198,130,215,155,230,215,79,249,193,123,221,219,225,97,14,238,231,79,9,117,173,
+    226,48,234,76,65,165,222,238,14,64,233,131,226,219,90,18,229,60,235,67,15,238,30,247,179,66,29,218,91,226,145,179,
+    179,81,24,19,156,208,5,164,178,178,118,177,172,151,146,60,101,0,249,220,21,188,5,137,236,3,236,58,237,218,102,29,
+    228,119,155,154,229,122,156,118,96,143,250,198,122,142,15,124,247,170,253,213,150,164,108,145,60,137,247,67,148,149,40,1,
+    143,37,252,195,1,102,115,179,244,48,253,148,192,222,119,209,224,21,201,69,134,212,28,90,128,218,191,90,13,49,139,226,
+    208,203,59,252,12,95,66,26,224,138,157,245,108,235,204,107,38,144,138,243,231,142,225,29,202,242,231,115,42,130,82,217,
+    163,133,125,19,158,20,121,36,225,231,105,207,154,45,57,159,228,150,0,145,17,244,199,10,175,16,13,86,151,121,91,208,
+    20,236,10,151,179,142,162,169,25,10,28,39,35,101,79,187,60,4,27,177,4,116,65,202,60,71,160,40,162,73,41,125,
+    36,7,178,11,157,0,254,74,195,199,32,49,150,160,105,214,28,33,33,245,44,138,98,239,9,253,2,170,191,195,153,105,
+    2,196,79,58,76,239,11,206,133,105,138,83,6,129,112,200,79,229,139,154,16,68,215,158,162,102,138,245,239,82,94,42,
+    227,21,251,10,17,252,65,32,136,172,139,129,172,94,159,110,0,36,14,103,170,202,108,185,67,44,13,114,144,187,89,10,
+    57,101,240,65,149,17,161,142,230,222,35,125,127,19,198,175,39,117,185,41,252,170,239,53,26,194,192,38,52,131,122,11,
+    126,111,210,33,57,2,122,174,44,207,104,166,190,136,152,172,127,241,161,66,57,78,20,97,92,101,126,47,143,146,79,179,
+    172,16,88,191,40,130,210,24,88,142,61,195,95,232,53,26,229,148,245,151,237,243,95,232,194,220,204,165,234,127,188,53,
+    159,104,248,81,42,164,58,40,241,184,213,218,136,171,250,245,164,220,99,90,248,1,221,126,176,239,127,167,201,163,233,82,
+    238,240,80,112,193,194,179,81,186,231,121,174,230,114,12,122,32,43,207,5,92,195,9,203,155,231,12,213,225,230,89,44,
+    116,166,120,229,124,78,123,124,1,166,135,230,237,100,152,145,194,8,185,71,203,145,9,103,15,127,55,6,103,120,93,124,
+    201,2,0,192,26,235,186,38,70,129,12,214,231,200,189,218,90,154,254,245,65,1,45,18,105,74,63,202,65,167,253,169,
+    161,237,151,249,8,98,98,210,166,248,112,130,20,186,239,214,158,191,76,220,232,82,13,200,57,187,158,93,249,90,244,14,
+    213,203,147,153,79,112,20,19,142,207,173,248,3,176,108,106,237,99,201,204,129,12,23,118,153,96,34,18,130,173,13,126,
+    131,97,162,142,225,148,46,49,136,99,173,145,230,10,143,201,191,70,185,124,125,13,56,116,23,34,167,162,118,93,101,51,
+    35,71,222,2,126,50,175,176,247,122,89,24,145,135,187,163,190,44,74,206,228,134,37,5,184,36,140,176,183,112,66,20,
+    210,83,148,9,231,123,44,102,161,97,137,10,107,152,140,187,196,126,75,39,223,149,31,181,137,228,68,52,236,79,99,225,
+    142,241,3,24,152,56,223,178,29,62,3,154,109,52,221,122,87,116,47,155,104,133,219,96,138,216,107,204,127,125,99,164,
+    29,166,166,52,179,106,171,183,16,205,34,201,148,41,127,97,165,228,16,138,179,23,47,227,239,225,50,146,165,253,5,26,
+    138,255,219,42,142,193,166,71,171,206,231,172,157,209,42,76,205,35,98,40,125,173,54,79,121,81,165,29,98,64,52,218,
+    105,253,14,254,68,138,18,83,119,250,60,59,79,229,157,92,108,226,43,235,41,11,119,170,209,64,112,80,211,28,241,191,
+    219,78,112,22,253,59,83,34,236,31,70,210,233,62,226,56,182,197,196,76,5,136,133,147,183,14,86,8,170,205,128,210,
+    187,4,84,108,211,229,228,236,87,238,126,33,81,133,151,31,160,219,1,100,60,190,16,251,3,110,200,147,182,126,96,162,
+    123,206,94,33,165,132,198,195,109,200,231,141,49,69,52,86,150,119,226,145,134,48,228,243,167,91,26,137,55,32,252,181,
+    161,72,166,57,157,245,117,47,215,89,123,85,147,136,64,23,169,126,83,97,126,83,83,164,94,144,67,98,130,5,89,99,
+    210,177,36,135,229,96,252,100,135,171,54,3,78,32,146,255,95,142,56,22,149,175,117,34,91,159,236,234,233,59,157,178,
+    52,43,115,196,152,47,153,168,218,63,184,191,50,23,82,220,209,178,32,114,130,66,53,217,224,69,225,41,99,11,221,48,
+    172,35,191,173,120,31,159,43,1,77,234,86,247,205,185,137,202,250,3,92,21,193,222,245,230,240,26,95,115,192,108,217,
+    227,229,161,76,250,23,111,253,161,183,213,20,3,185,126,240,105,132,252,42,201,174,227,255,165,240,196,37,14,80,0,235,
+    212,37,237,247,196,240,99,0,125,145,236,226,236,10,66,34,224,219,227,242,250,29,193,246,32,71,96,232,230,0,193,109,
+    39,139,66,235,223,45,13,12,101,229,225,77,149,252,6,177,247,35,240,40,222,4,121,111,219,196,207,107,0,46,10,197,
+    122,135,26,130,41,7,29,234,208,225,72,60,36,122,54,216,124,16,201,92,255,102,239,135,143,82,217,137,57,156,240,20,
+    136,38,52,109,89,70,121,64,119,84,211,20,143,20,43,253,43,85,157,192,76,112,134,14,161,37,13,25,99,175,18,200,
+    251,233,57,52,102,199,173,166,51,50,26,53,201,239,170,186,36,69,44,69,212,201,62,113,173,205,136,173,58,2,253,213,
+    58,85,185,36,244,15,35,141,43,235,35,33,185,114,71,174,31,51,168,2,48,66,222,186,22,216,174,18,44,71,70,133,
+    114,171,215,139,14,202,20,20,72,168,208,181,240,95,227,179,23,134,160,1,235,190,196,48,215,145,176,223,198,114,96,57,
+    139,188,228,251,62,49,86,160,207,187,239,54,220,71,165,62,3,54,48,141,186,12,188,101,243,66,60,157,10,169,140,22,
+    248,147,237,157,19,83,81,127,156,98,60,236,252,254,10,155,134,120,246,188,156,121,235,38,123,116,148,101,129,130,15,125,
+    192,240,183,159,245,28,215,126,113,253,109,252,168,147,218,113,45,103,177,148,57,120,60,109,160,24,226,129,45,66,55,29,
+    6,138,81,120,173,81,39,206,59,212,254,85,146,184,132,90,202,219,224,164,219,118,98,94,241,151,209,124,52,93,142,222,
+    11,242,121,201,237,30,168,32,242,157,251,172,68,171,197,145,219,246,115,190,96,119,226,208,203,241,160,214,100,14,132,123,
+    187,164,186,209,237,21,195,122,131,197,37,232,119,20,203,75,41,234,125,102,90,132,1,196,142,229,8,97,123,240,46,9,
+    139,176,23,177,169,225,14,31,18,14,131,45,176,245,85,102,218,157,184,15,193,228,72,219,38,0,93,15,238,45,92,147,
+    96,65,185,85,8,208,188,137,144,83,236,150,229,132,157,235,140,9,235,82,200,184,86,167,246,121,61,219,217,143,242,162,
+    61,167,16,217,158,97,162,209,219,11,0,0,133,176,250,11,19,49,112,149,77,82,23,15,50,215,168,11,80,146,230,200,
+    145,179,239,255,191,13,221,104,210,227,47,196,207,200,70,242,244,244,157,85,221,17,182,53,127,193,193,10,14,10,183,173,
+    35,26,54,201,251,111,41,110,15,149,61,139,86,30,172,74,6,150,63,74,253,31,205,135,171,69,174,102,179,152,69,63,
+    50,71,35,69,237,13,182,231,191,59,140,28,195,24,104,117,50,9,130,26,233,47,83,240,57,15,147,180,239,4,85,235,
+    217,91,75,249,9,83,19,42,202,10,68,58,115,66,11,33,202,117,33,137,237,57,123,96,153,63,90,159,151,177,140,155,
+    51,186,142,211,226,178,126,67,53,37,138,248,127,63,122,212,84,52,25,69,10,126,11,201,67,77,140,30,23,123,216,198,
+    30,146,203,81,250,4,226,60,136,119,215,128,236,200,150,42,155,113,32,148,237,231,135,97,72,227,169,208,248,209,148,21,
+    40,135,254,122,186,215,168,132,146,208,8,61,226,241,212,46,43,29,8,249,208,80,9,64,203,239,161,5,227,71,3,65,
+    102,146,11,232,70,174,131,156,106,82,82,33,174,142,9,148,111,68,185,196,96,25,5,230,97,103,121,69,185,203,207,49,
+    173,103,121,12,169,219,51,248,7,242,31,166,141,80,64,205,164,99,42,166,4,226,52,39,182,98,221,78,178,240,103,146,
+    254,174,80,192,132,72,104,226,187,104,64,101,70,107,130,77,161,207,139,91,59,240,22,243,85,226,202,132,250,199,154,166,
+    73,202,47,222,99,178,213,61,126,201,49,8,131,189,170,245,255,103,58,24,131,138,179,135,242,107,229,161,133,56,39,48,
+    174,110,181,235,36,213,147,60,223,84,86,121,38,136,5,51,25,207,48,93,114,223,20,161,12,206,32,128,109,83,108,54,
+    151,194,250,72,124,130,104,110,82,246,54,85,142,82,58,52,95,116,193,176,115,13,184,163,51,150,241,57,1,110,200,118,
+    48,57,178,175,124,17,206,34,222,44,46,39,48,160,60,219,131,203,44,53,171,7,199,220,6,190,46,254,206,200,191,154,
+    20,50,172,171,215,35,122,47,47,62,164,180,139,63,5,132,180,61,179,96,77,27,216,166,126,64,169,141,106,61,127,212,
+    124,103,243,218,61,169,53,41,252,247,249,25,188,131,123,31,106,145,228,35,193,247,112,127,237,172,211,42,196,179,119,135,
+    133,167,92,104,1,214,77,43,215,98,129,144,210,57,213,155,237,215,146,79,154,221,98,151,162,252,167,17,195,30,244,100,
+    179,230,78,242,138,203,27,90,187,235,220,233,221,138,224,128,26,150,228,244,212,1,27,250,29,132,29,145,209,142,243,179,
+    163,120,228,145,188,49,53,205,168,252,74,251,195,6,113,100,108,155,187,65,4,131,29,68,237,206,249,77,244,224,237,25,
+    152,198,61,138,76,80,249,106,151,68,57,174,252,73,70,189,192,96,200,16,84,139,188,48,1,23,141,198,103,252,44,198,
+    59,121,57,37,102,150,172,28,63,106,167,52,63,152,69,219,244,173,170,43,89,85,1,123,11,205,139,191,95,37,89,8,
+    40,115,132,193,250,126,83,75,17,102,158,197,55,119,231,164,127,171,156,3,199,132,110,176,25,209,71,244,192,189,107,231,
+    167,166,210,155,16,251,28,47,185,221,213,117,228,161,140,176,71,43,16,9,18,218,225,150,135,179,16,202,251,83,232,3,
+    119,240,239,7,61,126,219,240,99,149,115,45,191,77,14,54,109,18,116,54,16,127,143,7,227,65,217,23,101,117,153,9,
+    243,16,61,161,237,60,98,72,238,52,243,172,108,218,213,153,252,50,47,57,7,138,108,191,27,9,132,219,198,253,218,69,
+    104,117,183,89,202,91,140,231,195,224,147,168,234,56,99,17,249,100,138,116,235,106,219,28,253,160,143,68,195,68,238,155,
+    56,198,49,167,208,122,40,194,24,197,22,136,36,4,16,77,16,203,230,107,57,254,131,67,25,146,182,205,193,94,252,78,
+    22,215,160,23,160,102,22,187,192,242,103,205,191,95,81,154,255,26,188,219,31,66,221,106,190,178,164,220,231,143,43,228,
+    197,248,6,86,239,154,47,127,192,238,62,231,99,46,126,215,141,206,250,7,120,125,180,121,141,186,131,112,116,228,41,220,
+    103,109,73,241,253,62,228,27,6,134,53,62,157,37,47,241,174,2,181,31,122,141,117,208,104,71,201,173,195,116,155,22,
+    100,49,29,138,196,193,187,151,135,80,163,89,254,43,190,65,246,83,189,93,243,174,48,75,92,213,64,192,101,52,149,160,
+    160,194,31,246,18,138,112,130,187,52,197,237,66,46,244,122,156,53,248,5,212,160,181,77,208,139,190,212,214,31,176,163,
+    99,128,228,71,252,142,230,161,209,243,44,11,253,240,169,139,83,242,105,130,240,244,25,207,96,227,145,77,1,147,121,90,
+    111,234,86,34,220,141,250,240,58,143,88,59,187,243,198,76,96,179,186,104,69,51,199,27,173,75,62,240,77,108,99,249,
+    248,119,60,50,160,110,105,54,119,106,127,83,206,107,252,74,124,106,139,7,45,3,22,201,55,1,68,228,229,80,47,159,
+    58,4,93,211,9,25,178,13,150,185,69,221,31,179,228,15,192,151,91,224,236,124,130,102,156,151,129,27,68,100,192,216,
+    63,141,83,38,148,220,111,21,158,78,203,252,151,120,13,208,65,13,148,46,224,198,165,121,184,147,196,232,227,118,120,88,
+    26,80,30,201,25,229,2,32,186,83,123,204,233,133,47,60,250,90,13,28,93,153,138,160,152,106,31,64,95,219,202,96,
+    118,1,100,143,28,53,35,191,170,23,187,210,166,234,160,28,52,122,117,93,130,48,191,16,167,66,115,70,202,121,240,47,
+    182,66,76,35,61,28,129,187,37,65,81,117,71,255,53,183,96,86,172,26,175,2,98,206,97,19,202,117,105,122,192,178,
+    114,73,218,171,222,98,32,53,84,23,27,182,123,139,217,107,121,20,48,161,133,29,246,125,170,179,196,158,124,63,141,41,
+    145,205,6,179,12,106,236,155,187,67,28,185,62,194,65,82,174,24,135,65,40,201,176,252,164,20,234,171,116,73,16,211,
+    193,141,232,184,7,149,109,160,42,0,119,11,28,187,110,64,14,153,50,209,131,1,95,6,29,16,210,210,63,172,144,27,
+    19,30,252,116,63,82,14,4,18,53,71,160,135,123,59,9,110,197,141,241,128,64,98,15,112,129,143,51,108,231,101,174,
+    181,169,125,129,130,36,109,148,184,175,35,247,85,31,251,162,183,161,204,120,78,243,126,247,61,156,165,171,116,98,111,201,
+    126,223,113,138,115,70,116,46,224,223,43,178,17,151,135,50,166,174,51,245,151,110,184,149,109,172,69,116,31,52,195,66,
+    73,186,93,122,185,61,163,55,66,142,192,195,151,216,5,148,36,49,223,155,79,107,131,225,38,35,170,75,42,167,87,220,
+    231,79,136,43,37,64,26,176,250,110,130,237,189,206,221,131,232,66,218,211,13,221,142,120,22,82,92,120,9,98,124,120,
+    21,249,140,74,194,36,66,220,8,119,159,77,102,171,218,208,219,55,159,43,133,248,210,68,204,247,178,22,150,42,9,70,
+    165,110,202,48,209,217,217,183,183,224,79,49,216,190,39,181,167,147,226,119,156,74,113,39,52,88,228,94,191,92,60,36,
+    163,14,44,253,188,107,60,62,106,128,45,197,213,55,109,80,25,123,210,4,210,1,170,15,72,52,250,136,23,186,157,26,
+    203,158,196,79,17,136,81,14,217,157,198,87,22,243,136,189,21,19,32,86,235,173,197,221,114,110,150,111,77,88,224,209,
+    204,117,171,249,82,131,231,40,195,112,217,180,90,18,161,119,196,205,28,155,7,229,156,216,247,188,174,63,24,220,94,2,
+    112,119,90,12,95,127,4,225,16,66,173,242,38,186,96,200,107,207,148,117,206,226,125,2,76,44,182,253,197,249,52,141,
+    66,146,134,211,17,108,144,130,180,138,211,82,157,238,138,52,55,223,214,24,17,134,235,155,177,82,63,224,40,101,227,204,
+    214,93,57,85,75,148,214,193,218,219,21,155,86,156,33,99,230,76,214,10,115,102,137,16,225,84,216,195,2,103,221,103,
+    242,82,192,24,193,146,35,77,162,197,225,249,214,102,40,73,122,214,230,222,205,149,105,222,104,208,175,81,13,248,104,56,
+    27,28,133,203,26,243,85,120,190,196,195,178,58,13,160,235,186,212,195,127,36,39,55,100,1,28,134,129,178,151,18,110,
+    24,139,37,174,110,174,129,242,43,19,30,151,151,224,102,212,14,31,220,201,188,0,48,159,8,208,19,161,190,156,8,149,
+    71,113,180,196,191,192,72,145,29,227,169,37,1,154,200,113,72,115,135,90,3,177,225,77,185,185,141,75,241,88,76,188,
+    194,253,92,197,245,120,118,146,80,237,24,90,96,130,163,30,38,100,245,31,18,61,181,225,128,83,137,137,247,102,240,77,
+    101,75,253,237,188,191,134,147,84,252,83,39,219,113,134,207,107,1,153,66,152,149,146,195,169,70,199,170,192,70,18,237,
+    191,204,218,174,27,241,163,224,11,80,9,175,251,116,99,144,246,65,243,202,83,88,154,147,113,192,118,140,74,139,250,74,
+    118,201,68,211,154,255,194,209,150,142,222,226,151,102,128,123,137,140,230,218,213,45,171,71,131,16,246,252,157,238,57,132,
+    13,242,232,84,36,19,133,94,248,178,107,72,126,203,239,38,147,54,250,88,249,107,141,240,252,14,166,121,147,11,254,227,
+    254,30,90,96,220,193,170,77,227,54,85,123,145,39,93,111,199,182,36,248,136,54,178,77,173,182,128,105,56,49,250,227,
+    252,98,133,173,41,40,195,120,112,96,122,69,33,76,207,204,175,172,36,1,230,105,229,69,234,234,44,201,61,204,28,233,
+    130,95,39,10,224,25,180,5,145,171,197,70,6,95,46,212,39,121,219,159,33,53,107,93,136,234,26,203,248,69,246,208,
+    145,68,98,151,179,100,74,234,60,168,101,86,50,48,127,139,146,115,251,119,49,157,167,155,156,31,237,165,61,34,128,40,
+    95,86,248,160,240,108,63,22,252,112,103,196,134,118,55,172,133,114,143,105,140,15,183,192,7,211,134,173,3,8,23,232,
+    165,138,244,178,190,84,19,3,38,235,175,210,180,207,255,2,49,100,183,129,155,2,139,40,247,247,181,76,225,156,51,219,
+    244,230,70,112,233,47,98,172,203,252,33,246,33,61,21,121,203,214,55,240,166,130,59,181,137,46,209,216,154,202,95,21,
+    132,66,99,148,192,66,2,57,174,93,102,136,136,249,199,96,240,19,182,41,149,218,242,43,183,68,162,248,250,184,206,168,
+    141,178,177,37,236,191,46,152,176,72,92,182,4,233,168,80,130,107,206,254,227,216,121,220,104,7,109,218,61,150,114,32,
+    168,29,48,220,33,168,236,187,83,22,163,209,187,185,7,125,81,3,185,216,91,134,58,114,211,23,32,221,32,65,9,214,
+    44,160,224,238,39,100,60,23,37,168,255,57,155,93,252,212,30,11,199,184,198,216,247,239,96,204,211,188,76,82,147,171,
+    125,140,36,55,70,0,254,194,50,229,202,226,3,136,21,45,57,96,125,150,8,233,246,164,129,154,240,92,42,243,154,96,
+    0,62,100,90,6,243,189,203,104,180,252,41,26,227,114,54,105,190,59,181,155,26,216,33,37,136,192,153,13,39,186,53,
+    53,142,201,220,52,36,0,60,175,98,89,176,163,193,167,238,162,108,204,216,190,232,34,158,234,34,214,128,63,112,85,65,
+    235,9,195,26,104,85,82,69,218,57,193,11,35,238,157,115,2,46,91,248,142,156,129,7,93,145,192,1,136,228,67,104,
+    23,99,164,63,207,93,23,43,201,239,237,53,106,244,216,68,214,63,159,89,188,0,173,65,201,88,178,89,245,21,228,107,
+    110,155,101,33,230,41,130,0,35,188,99,51,168,241,53,145,36,254,111,34,151,196,23,92,230,231,243,168,176,36,57,197,
+    253,118,45,13,72,162,239,195,212,121,181,89,197,56,241,204,86,81,208,206,219,171,131,38,6,71,236,26,30,202,192,247,
+    29,69,235,10,215,213,220,24,132,15,175,162,203,234,246,20,97,105,91,68,83,103,45,76,169,14,82,189,241,99,5,57,
+    155,13,195,97,200,150,109,219,210,21,17,82,223,82,28,82,197,222,71,154,145,198,124,193,67,113,95,151,128,223,17,157,
+    24,116,82,22,73,111,203,228,86,93,2,238,30,151,14,16,71,88,77,55,3,163,148,204,189,250,78,63,53,126,28,245,
+    160,54,209,20,103,16,14,36,65,129,216,209,1,131,204,178,211,29,222,75,251,172,198,50,216,83,73,251,240,211,109,254,
+    41,70,33,87,66,145,163,119,47,87,17,138,89,154,173,120,227,71,10,225,65,111,213,101,226,98,238,225,30,166,84,105,
+    49,70,22,231,165,141,174,179,125,207,5,160,4,148,86,73,97,215,9,42,95,107,10,125,129,30,182,85,78,100,227,122,
+    67,50,247,213,90,134,242,117,184,6,145,206,88,212,229,25,63,7,248,202,188,40,105,16,239,122,196,21,123,154,172,9,
+    29,27,151,62,217,114,22,207,188,230,76,131,222,44,226,223,143,89,85,132,113,143,158,38,39,173,14,166,152,141,42,2,
+    228,113,38,105,130,99,72,215,75,71,61,9,5,231,91,41,71,66,41,208,233,103,162,215,240,163,177,138,128,88,239,68,
+    67,209,155,178,147,152,166,4,199,185,10,136,237,78,93,233,84,71,101,30,64,148,166,20,201,11,135,98,90,180,130,54,
+    210,200,246,24,166,87,166,49,205,168,131,69,54,39,207,53,131,136,192,101,57,96,145,30,70,170,34,238,26,161,254,44,
+    120,5,38,255,41,124,171,229,126,20,4,176,56,88,172,239,8,71,151,192,139,52,24,89,120,205,13,17,228,86,251,6,
+    246,75,108,136,41,253,134,229,106,70,176,54,9,181,129,66,152,141,161,12,234,91,77,71,141,25,235,39,143,33,249,45,
+    250,17,92,87,249,173,130,87,28,67,52,90,62,36,181,142,230,253,170,98,126,139,10,33,191,248,225,87,146,67,241,39,
+    185,246,71,16,104,216,71,14,236,181,12,198,44,127,72,100,210,183,197,6,60,139,89,143,181,39,36,62,139,66,73,130,
+    211,241,121,81,81,134,148,164,166,163,122,29,205,8,248,251,145,169,94,115,234,30,102,217,149,215,223,20,9,66,69,233,
+    149,57,173,41,26,106,242,215,177,223,99,175,225,156,113,243,85,249,155,97,40,89,129,81,143,33,29,218,76,48,100,80,
+    145,238,159,175,197,245,165,147,4,53,96,198,185,236,96,163,29,160,227,161,121,94,179,38,198,118,214,21,51,172,138,26,
+    27,96,76,176,70,96,251,70,214,83,69,124,135,24,168,117,0,72,206,84,14,90,0,167,72,29,238,73,117,79,18,56,
+    92,27,230,137,85,129,206,45,24,253,254,118,224,23,16,40,45,223,60,212,208,202,35,37,8,101,34,218,220,191,146,71,
+    9,254,81,78,180,66,207,205,238,229,246,163,72,162,85,81,116,81,91,47,71,210,84,183,170,254,229,118,94,3,106,54,
+    63,193,216,25,70,219,171,53,37,196,3,61,201,19,133,46,202,148,230,109,100,218,247,57,124,142,236,172,151,24,205,50,
+    207,128,237,106,45,158,45,75,140,96,74,230,37,243,175,174,118,214,65,30,34,78,173,135,97,212,95,67,80,70,151,76,
+    15,27,85,90,175,186,169,131,192,77,49,207,129,187,255,123,85,156,206,223,68,74,148,120,91,21,49,4,153,27,123,244,
+    210,6,116,59,52,87,175,102,177,56,209,205,175,190,240,226,169,34,131,185,165,31,254,234,201,96,85,243,213,28,25,237,
+    170,171,177,230,188,250,104,174,61,13,161,231,174,237,228,69,22,247,242,157,218,233,232,75,7,42,115,93,51,220,21,52,
+    30,204,240,144,8,248,145,83,54,50,86,206,26,195,175,153,97,184,78,196,105,104,227,15,75,200,193,101,153,126,103,42,
+    66,186,144,84,60,66,198,148,146,183,198,31,22,199,204,158,167,69,109,251,16,129,155,67,182,35,213,236,58,28,186,250,
+    226,142,192,236,154,207,102,79,253,143,97,46,115,97,145,8,19,137,123,130,130,29,38,111,18,153,210,212,141,180,168,162,
+    228,161,150,67,97,155,183,171,35,96,4,145,179,104,181,183,165,172,179,159,30,226,63,255,199,229,130,129,9,20,119,149,
+    109,138,67,241,101,188,116,130,33,172,174,129,111,234,16,181,40,247,7,15,164,110,165,23,250,96,21,7,96,148,75,33,
+    243,218,37,15,77,244,187,151,252,103,43,203,96,32,203,94,80,64,35,11,127,231,26,242,34,11,26,47,100,225,74,15,
+    24,86,195,129,53,201,2,64,203,85,191,119,38,201,34,131,173,28,93,136,174,197,15,26,134,32,90,172,84,234,225,80,
+    209,8,42,241,133,220,220,58,33,28,236,246,69,240,235,121,47,18,105,29,95,219,207,116,132,218,122,45,50,165,20,225,
+    149,246,191,233,61,2,205,12,81,77,177,251,134,46,110,10,152,251,86,228,138,79,166,29,57,216,11,254,54,209,59,196,
+    65,74,92,225,107,147,89,126,165,46,73,62,128,211,43,254,167,3,26,245,173,182,35,143,70,62,3,251,106,241,8,105,
+    152,200,198,224,110,92,130,182,121,186,200,246,159,149,253,146,147,202,222,242,146,229,89,104,190,64,232,42,165,39,102,100,
+    43,92,20,36,136,12,251,183,207,175,19,112,147,253,124,104,10,32,18,45,254,118,159,118,123,37,167,135,232,105,109,34,
+    85,49,201,160,187,103,146,236,175,5,87,177,27,107,202,42,58,23,88,168,131,199,20,222,180,5,210,19,140,161,93,220,
+    71,3,19,246,130,253,171,41,155,94,214,188,120,216,204,12,78,44,22,132,240,26,221,2,82,47,194,27,80,115,218,168,
+    66,34,78,138,240,157,65,217,187,117,252,79,228,120,69,209,65,76,225,145,236,216,83,34,51,119,73,193,255,217,144,205,
+    205,182,153,114,64,253,98,174,79,110,19,89,77,145,97,141,87,229,19,186,114,152,53,99,112,35,117,27,27,122,249,48,
+    211,216,243,212,182,76,168,153,200,225,217,246,194,145,105,105,36,147,146,24,211,161,251,43,142,130,135,42,215,46,117,33,
+    234,122,227,21,196,225,70,89,184,5,224,68,153,3,26,183,98,159,240,155,35,167,146,189,182,65,3,1,42,161,75,115,
+    253,76,85,147,234,248,130,234,179,187,77,150,61,20,209,233,86,46,91,213,60,184,43,26,157,152,75,9,15,206,164,117,
+    19,43,152,169,31,10,133,71,151,205,117,162,236,178,126,211,245,131,217,226,54,84,16,69,244,216,228,225,103,117,227,42,
+    194,216,87,199,237,88,135,14,248,208,15,210,58,187,48,212,215,46,134,199,153,153,85,60,183,80,193,19,195,15,50,173,
+    215,224,122,75,81,211,145,207,129,172,103,31,201,187,210,214,106,76,85,177,222,9,189,107,102,68,180,240,129,153,233,3,
+    4,127,69,40,249,255,232,167,249,193,131,68,232,19,101,225,249,109,105,180,237,125,157,94,99,155,233,204,223,24,93,235,
+    108,147,139,173,126,13,188,121,129,147,96,7,180,81,229,168,21,204,87,228,125,198,191,46,24,78,202,201,69,210,86,184,
+    233,107,208,26,28,124,254,177,15,168,203,190,123,92,13,208,78,83,146,55,141,100,70,185,151,71,129,57,168,144,24,188,
+    150,111,242,169,101,151,131,93,155,98,250,111,234,111,205,8,6,104,50,64,80,11,65,128,76,213,42,147,91,184,222,106,
+    68,217,72,151,156,137,221,213,255,182,51,213,243,147,171,249,107,199,68,40,249,237,163,70,173,98,247,147,85,217,53,75,
+    51,194,252,94,132,177,217,28,30,4,80,32,138,210,131,118,31,20,6,37,220,17,161,209,122,158,89,56,248,36,139,40,
+    131,103,152,212,145,66,134,209,138,105,7,215,95,193,171,119,199,59,2,17,87,169,114,17,30,125,127,6,91,232,236,114,
+    86,103,74,56,65,119,35,140,24,142,124,254,86,130,159,125,153,33,165,85,152,159,48,119,147,154,180,88,168,136,42,48,
+    211,46,112,42,168,24,30,169,177,26,220,221,55,18,196,129,230,66,144,185,147,66,122,189,181,90,93,63,220,165,179,184,
+    100,213,117,145,159,18,246,73,106,220,243,87,187,23,5,34,38,170,223,92,211,105,219,62,235,113,226,162,129,58,162,170,
+    52,32,193,157,38,37,183,200,147,42,206,133,45,153,171,141,155,38,99,168,61,62,12,253,67,207,137,137,122,103,94,192,
+    171,200,185,136,55,79,14,10,165,194,170,135,58,200,123,175,113,227,102,231,62,79,7,242,35,1,118,64,171,59,108,254,
+    101,162,103,158,139,13,79,102,172,166,168,69,185,35,251,107,56,35,102,91,184,121,148,22,139,47,196,8,162,29,24,208,
+    122,246,150,142,191,228,43,222,106,245,21,67,171,131,49,189,164,90,209,141,161,129,146,198,111,156,213,171,168,30,154,206,
+    200,24,68,50,204,234,187,14,171,125,174,145,218,243,56,103,70,196,240,206,43,50,143,106,237,220,219,146,58,55,214,56,
+    212,107,71,123,201,140,88,147,133,132,165,140,73,139,216,76,72,85,226,67,219,17,18,76,53,133,19,52,115,224,25,202,
+    148,12,203,76,119,35,253,144,109,186,97,142,101,53,80,93,198,89,122,136,170,129,117,31,114,117,124,7,27,149,96,75,
+    236,93,114,207,61,131,254,88,230,84,59,244,43,87,213,251,173,8,48,15,197,99,20,133,134,172,81,113,197,203,80,47,
+    148,231,101,250,33,41,237,34,132,224,53,183,59,193,115,243,33,192,7,214,49,106,158,206,203,173,139,160,105,191,242,88,
+    13,110,159,116,118,157,89,83,172,255,118,17,63,248,51,53,163,145,183,188,173,196,203,137,121,238,160,233,164,188,251,112,
+    117,177,119,55,177,89,169,140,157,194,218,90,85,129,164,253,188,114,220,238,75,99,250,137,189,98,18,63,189,204,252,89,
+    187,79,102,193,201,5,207,84,124,185,93,121,248,201,130,76,5,47,222,166,56,32,27,197,66,11,237,140,55,175,115,192,
+    58,196,169,151,32,105,101,133,175,20,2,114,13,116,16,193,176,21,30,120,132,163,225,196,73,9,2,40,27,70,131,169,
+    143,181,140,239,8,154,6,77,166,7,132,42,232,19,194,124,91,165,203,107,76,120,160,166,162,35,195,78,210,131,98,163,
+    223,106,232,76,208,30,133,241,172,118,34,170,33,98,89,145,72,75,44,155,35,192,135,137,165,88,56,9,159,133,248,164,
+    55,90,68,170,159,219,122,201,35,63,6,84,170,74,145,198,49,77,187,237,104,116,22,108,208,253,12,105,19,24,245,129,
+    81,166,6,214,188,41,189,233,254,189,152,211,52,22,25,104,55,145,205,36,60,147,181,224,23,118,152,248,8,108,2,237,
+    29,125,26,13,49,44,9,88,146,156,191,1,43,193,24,127,15,137,191,16,56,105,68,120,101,140,238,72,230,111,2,5,
+    241,174,172,235,179,215,162,97,96,255,221,12,32,249,87,242,134,176,16,12,44,177,159,121,226,250,162,28,145,208,44,123,
+    231,236,67,33,65,147,88,181,81,229,82,38,179,244,125,6,58,129,202,226,94,82,198,12,235,245,71,243,119,114,135,20,
+    229,37,90,32,32,81,127,16,38,36,1,129,107,144,139,74,112,177,156,17,114,117,217,110,116,45,132,32,101,96,33,208,
+    253,207,155,47,111,228,37,70,137,170,190,49,102,74,215,64,243,24,25,212,228,145,253,105,222,110,4,1,245,76,232,229,
+    117,28,89,241,159,177,8,211,128,217,137,139,239,32,24,77,35,213,216,56,49,181,88,135,165,219,128,106,77,182,247,143,
+    236,231,182,150,178,9,72,140,84,145,179,7,125,114,198,201,22,73,88,38,10,127,245,223,96,146,19,51,179,87,7,251,
+    98,230,4,53,190,57,133,37,12,3,219,108,119,201,14,234,8,159,236,152,139,84,157,216,15,146,212,232,253,147,253,205,
+    29,151,174,205,225,101,200,0,92,208,252,100,156,13,245,142,36,209,236,107,29,37,21,78,111,93,33,211,19,167,211,228,
+    123,92,62,242,59,136,85,235,102,90,100,122,33,184,118,31,48,173,170,243,113,131,141,243,60,154,98,114,81,110,171,181,
+    191,29,156,26,230,176,56,184,26,77,122,255,239,25,240,225,16,122,89,99,209,98,174,34,27,23,125,184,236,28,112,214,
+    71,177,126,120,242,42,108,14,84,108,61,120,231,9,113,2,131,178,29,32,11,175,113,42,204,55,123,48,23,139,152,44,
+    206,2,50,179,180,97,235,97,205,21,80,232,190,128,91,111,130,70,158,240,182,39,88,139,214,49,51,122,24,25,69,202,
+    24,2,100,71,19,163,86,194,19,7,212,197,35,19,180,84,169,97,21,209,152,61,133,135,79,199,197,238,96,148,77,134,
+    148,178,124,89,96,224,0,175,175,94,210,225,101,122,20,95,93,137,198,136,5,184,219,92,154,252,204,143,85,48,217,1,
+    228,122,227,103,147,192,180,216,51,63,202,30,52,35,156,240,98,207,221,192,59,131,100,253,144,194,185,72,122,83,110,8,
+    128,85,147,92,112,25,30,194,89,123,101,155,56,251,190,169,76,255,137,57,136,246,110,102,48,1,180,32,66,7,108,158,
+    138,18,174,255,23,17,111,70,221,11,244,191,8,54,242,42,112,210,87,162,28,118,67,33,192,214,86,182,19,6,70,126,
+    200,227,83,4,192,241,148,208,122,144,200,139,13,254,13,217,202,104,143,104,171,14,128,207,177,92,217,153,230,217,93,235,
+    161,16,160,190,184,27,79,60,122,152,176,108,126,239,216,9,64,86,208,142,107,13,37,61,208,168,89,115,223,74,26,32,
+    193,87,234,96,88,174,73,179,71,213,251,149,110,140,79,27,15,83,253,144,121,129,203,16,63,185,84,97,214,170,136,176,
+    107,168,77,100,67,63,134,188,1,249,94,94,91,14,10,203,236,79,64,82,42,73,128,185,143,115,60,142,93,153,122,66,
+    119,97,37,191,5,137,53,205,233,82,71,236,18,174,162,138,8,91,32,0,207,206,210,225,3,216,49,113,201,119,209,245,
+    128,164,81,189,251,46,36,11,44,70,114,247,96,211,251,255,62,68,23,2,160,90,23,246,200,214,116,192,253,77,10,249,
+    209,92,114,10,235,150,92,133,7,98,22,58,41,218,15,100,146,75,220,14,207,121,168,109,40,138,185,162,84,35,167,99,
+    34,211,96,48,108,31,74,170,213,175,197,84,116,219,65,234,189,89,45,105,227,140,13,90,2,33,10,47,196,109,245,95,
+    113,190,96,0,221,212,225,188,103,186,239,76,27,56,135,94,168,52,195,175,48,125,67,223,64,30,31,1,250,108,186,195,
+    44,105,103,68,219,140,136,201,59,106,172,131,223,208,23,21,76,22,177,26,4,155,220,77,183,28,225,201,22,184,71,221,
+    224,14,66,231,175,153,132,180,125,98,142,225,81,82,247,163,175,106,140,46,232,104,214,135,70,161,220,20,83,41,186,203,
+    23,177,42,73,43,246,44,251,6,68,54,79,143,29,40,160,173,84,182,101,153,248,126,50,93,75,73,13,216,133,75,90,
+    62,231,94,168,218,225,148,90,82,76,188,254,167,210,94,195,210,89,141,160,172,120,79,225,63,71,139,56,164,24,136,187,
+    95,163,196,34,198,13,160,88,89,94,216,255,171,253,72,111,227,165,158,164,141,150,200,90,97,136,57,234,23,83,129,210,
+    95,108,156,205,54,151,212,142,181,132,156,221,39,67,129,85,148,133,212,106,252,152,92,129,158,136,164,242,93,40,79,144,
+    4,17,207,9,172,233,214,139,11,24,30,9,145,132,152,174,150,241,19,204,36,200,171,113,222,236,233,18,92,178,217,156,
+    228,21,239,100,255,124,62,105,80,70,116,97,93,216,180,170,52,141,66,251,244,108,196,208,237,225,98,117,2,118,131,180,
+    180,241,91,214,30,97,194,29,153,5,18,91,67,118,202,36,192,134,152,212,152,200,216,120,183,249,176,224,89,65,69,92,
+    106,141,181,242,98,227,218,66,108,129,27,19,106,90,31,49,15,112,128,252,174,78,149,214,227,121,152,47,78,158,94,173,
+    254,29,211,35,236,105,158,175,147,217,9,167,79,0,143,134,229,226,231,221,128,191,193,135,47,218,223,45,51,56,90,23,
+    226,237,188,19,46,30,148,36,35,250,187,137,1,236,233,105,206,158,0,176,120,61,64,210,34,148,26,186,97,22,132,179,
+    142,64,230,5,19,27,14,246,210,70,180,191,233,101,130,191,92,110,236,85,217,236,131,218,164,53,210,42,153,134,33,252,
+    180,236,141,90,179,88,70,221,220,225,53,142,132,255,28,53,177,196,78,78,149,237,58,250,174,223,32,26,221,161,239,249,
+    116,90,141,243,91,123,223,20,230,166,130,3,102,131,109,180,228,175,113,125,90,63,107,169,57,139,143,196,135,150,95,137,
+    250,75,109,253,116,233,82,132,39,83,211,63,97,219,83,200,44,7,127,71,161,182,95,190,166,4,78,89,182,114,250,48,
+    200,248,38,119,188,219,248,38,195,245,150,149,90,78,12,122,130,163,105,55,116,66,5,241,253,236,20,232,232,161,173,100,
+    209,71,54,233,172,87,116,242,216,74,50,163,190,101,149,172,215,64,1,120,130,153,72,194,134,131,127,75,162,59,190,138,
+    141,133,125,48,153,165,43,203,207,6,233,132,86,16,86,177,33,0,17,193,211,229,41,245,103,101,115,76,251,108,65,244,
+    174,71,189,64,159,177,46,47,168,77,168,147,190,70,10,165,85,254,40,229,226,70,219,30,150,30,194,65,230,53,15,4,
+    219,92,162,154,241,56,4,252,57,48,228,125,44,239,182,16,42,208,119,122,1,113,134,87,184,167,183,143,124,8,43,165,
+    86,115,212,215,102,25,229,185,17,107,207,223,149,18,189,184,208,79,83,235,189,254,139,8,85,128,153,60,80,37,195,16,
+    64,206,241,170,158,237,45,154,218,30,162,137,83,250,250,229,195,12,163,146,78,246,96,249,196,25,224,52,219,198,99,224,
+    125,132,199,238,132,169,127,6,194,99,206,36,217,234,145,49,192,191,228,62,18,52,51,173,205,129,181,66,120,129,187,234,
+    151,15,94,154,243,196,220,50,241,153,174,202,119,129,50,14,187,158,241,210,214,60,106,8,212,219,244,106,65,128,38,235,
+    139,7,217,3,130,190,78,127,144,75,241,80,165,144,65,16,5,186,198,217,187,97,125,29,34,184,74,199,77,183,0,199,
+    87,186,23,221,198,174,69,232,133,83,56,41,162,134,19,180,252,78,55,52,187,114,73,18,147,204,248,243,55,121,38,110,
+    31,175,78,75,11,156,207,23,243,72,42,126,79,141,234,26,148,91,78,139,182,118,236,182,152,83,69,151,182,50,233,184,
+    15,68,68,97,189,111,11,226,25,70,214,42,106,73,203,220,201,242,220,231,245,81,255,39,100,143,8,1,189,109,67,41,
+    142,185,72,39,27,123,205,141,215,180,11,230,144,248,45,4,150,89,221,194,206,35,200,43,206,214,75,28,236,189,168,159,
+    61,78,123,68,92,179,72,139,37,218,174,116,89,219,242,249,5,54,190,163,241,169,9,136,218,163,99,199,217,140,210,21,
+    212,157,46,19,135,129,220,27,186,162,254,216,60,197,102,93,195,189,255,144,143,211,191,162,49,105,240,131,15,61,162,93,
+    57,81,114,13,120,50,108,90,59,64,165,67,36,54,213,8,76,7,183,210,51,52,227,174,76,49,251,196,254,226,151,77,
+    212,177,49,184,71,87,10,45,250,117,51,116,185,157,248,149,47,162,28,134,245,74,65,247,188,63,197,192,67,201,252,203,
+    222,121,156,112,176,246,135,173,18,164,175,109,38,78,17,23,204,205,174,155,102,208,181,244,35,65,52,31,50,164,19,64,
+    53,68,71,163,53,250,131,76,51,92,80,173,138,18,195,223,208,83,164,248,109,10,100,1,220,93,152,162,146,130,180,179,
+    214,253,66,51,140,187,126,242,90,79,137,127,131,7,206,15,113,136,79,135,161,69,128,128,84,136,178,133,232,59,66,134,
+    106,26,60,113,244,16,130,190,113,0,226,105,121,170,122,212,7,142,201,131,40,76,205,193,98,245,169,230,140,109,42,49,
+    100,230,13,173,93,149,196,92,98,45,2,149,48,29,78,45,145,57,6,133,65,181,35,52,218,244,32,240,52,38,16,8,
+    250,204,235,215,253,193,60,103,244,202,191,196,71,225,224,239,201,235,123,164,27,109,215,176,71,181,74,14,16,115,69,56,
+    183,218,39,60,12,115,200,19,145,10,211,95,189,30,238,98,191,251,222,73,47,63,58,210,185,241,134,8,46,166,21,235,
+    101,134,151,8,227,187,42,169,176,152,32,69,63,121,25,34,113,131,107,23,230,224,72,189,128,111,97,178,123,135,61,115,
+    191,246,7,180,107,141,157,75,206,193,194,37,203,141,76,174,152,220,231,202,202,54,197,39,175,218,202,33,39,189,158,148,
+    171,183,35,134,40,46,79,147,208,162,184,217,43,111,105,182,78,244,166,0,148,86,159,35,80,72,245,214,12,48,209,176,
+    126,75,6,79,153,25,90,7,15,79,0,139,242,120,205,237,188,252,190,127,192,214,36,106,102,72,106,22,226,168,34,102,
+    191,225,143,79,179,58,200,87,133,230,248,131,244,72,75,109,218,44,112,48,132,215,167,168,224,52,64,141,195,138,140,167,
+    209,91,128,239,116,129,237,186,225,181,136,202,88,11,161,199,156,104,49,73,176,203,146,176,60,112,8,73,184,161,143,171,
+    242,39,164,3,137,27,97,153,177,168,218,248,222,233,167,226,38,13,240,161,215,180,38,156,31,250,93,88,215,4,90,169,
+    106,184,130,7,25,13,229,133,1,229,187,168,8,195,170,152,155,181,90,109,10,160,43,114,47,140,94,171,251,120,148,109,
+    35,132,190,253,96,81,16,186,25,68,50,247,102,2,106,249,179,60,36,240,183,40,233,134,76,132,39,160,249,58,139,82,
+    184,224,123,252,237,206,174,195,207,165,237,71,83,191,97,97,154,190,188,40,226,191,147,176,252,191,191,56,230,144,6,21,
+    189,64,32,135,134,86,159,183,173,106,58,59,99,194,203,165,191,104,173,253,31,92,36,41,235,118,152,253,40,159,36,202,
+    216,78,158,50,210,52,33,158,143,90,115,202,37,137,173,247,61,92,225,180,11,229,145,69,208,248,0,230,70,225,60,77,
+    81,108,9,248,140,39,230,164,22,125,139,208,82,23,3,79,6,250,61,53,88,120,91,140,235,251,94,241,186,178,225,153,
+    152,20,48,33,139,197,183,211,193,7,205,166,107,102,78,156,204,8,219,60,1,159,1,228,122,141,23,26,218,185,101,243,
+    240,72,186,74,129,238,109,10,119,176,227,45,50,169,152,210,231,83,207,51,131,205,234,117,184,142,2,87,121,212,19,112,
+    145,144,180,129,27,129,173,52,156,70,76,70,14,90,167,185,100,2,55,90,119,53,64,125,145,4,108,218,95,108,195,196,
+    59,50,73,81,155,94,152,123,4,178,82,94,200,47,143,192,0,34,85,200,154,108,217,199,35,32,217,222,154,254,250,198,
+    149,82,63,163,173,128,91,231,160,135,237,51,241,36,237,228,20,114,245,54,146,4,103,6,247,135,177,89,101,168,102,161,
+    4,84,68,240,63,219,66,30,10,176,108,42,18,116,136,162,186,237,74,174,15,89,235,148,177,224,95,171,176,10,233,15,
+    71,135,64,88,185,71,76,203,66,242,1,95,48,76,73,211,206,227,68,15,206,174,106,231,156,42,69,169,219,162,72,236,
+    211,116,68,230,160,89,126,135,243,166,218,204,10,96,255,34,147,67,215,11,157,75,220,180,236,212,236,210,226,243,48,56,
+    193,93,107,66,93,137,219,246,225,87,80,88,247,148,86,11,109,60,165,19,237,130,180,11,57,18,38,215,165,168,4,5,
+    5,5,126,226,208,223,189,7,12,129,0,119,220,182,181,169,198,111,235,213,139,148,133,252,203,108,1,13,1,132,131,157,
+    57,102,138,151,103,6,184,26,34,86,156,74,185,244,65,136,57,74,128,148,131,212,202,65,66,179,53,114,14,154,230,148,
+    28,11,182,187,243,140,74,196,19,5,4,67,250,16,230,93,40,171,30,75,197,101,68,249,203,179,59,177,203,192,142,167,
+    134,31,158,99,188,70,30,42,75,181,155,121,63,160,70,18,222,200,148,96,110,86,15,88,42,69,171,140,59,245,38,250,
+    92,64,165,79,48,137,250,127,107,66,210,63,145,35,193,248,218,180,221,248,32,33,0,75,156,112,188,45,187,175,225,36,
+    210,239,112,1,168,169,29,36,92,177,126,25,193,94,85,107,203,235,65,78,206,212,169,93,102,46,175,141,173,213,168,255,
+    240,247,50,180,188,210,241,160,188,179,223,136,107,165,185,69,181,197,236,118,61,90,42,38,2,64,98,156,155,88,95,160,
+    207,209,4,102,207,45,218,152,104,121,13,131,210,19,144,45,29,244,53,41,185,53,195,45,193,235,28,140,48,108,234,9,
+    224,213,84,211,85,176,61,69,107,86,30,42,71,185,7,52,68,38,125,152,74,182,52,238,93,33,14,242,51,131,8,59,
+    102,227,26,37,33,155,109,31,104,213,52,51,161,239,242,69,133,106,54,76,137,204,161,202,123,225,35,76,128,154,248,202,
+    31,138,111,77,61,63,23,200,3,123,38,92,173,36,153,41,254,243,108,140,15,245,219,177,127,237,226,159,80,172,159,213,
+    108,127,172,79,154,197,16,109,110,111,180,79,68,75,119,52,160,138,214,158,12,21,188,67,179,243,4,39,30,193,39,39,
+    167,100,57,80,218,253,16,189,174,224,247,1,0,79,26,128,168,217,229,6,5,157,194,22,18,247,12,137,142,69,205,12,
+    112,68,163,184,151,140,94,231,141,91,92,73,159,134,237,42,148,66,67,79,145,246,185,116,188,143,84,113,212,252,129,137,
+    202,187,129,47,241,125,145,195,68,161,96,69,118,17,133,238,220,84,109,143,141,116,90,235,207,42,99,53,247,232,236,226,
+    238,186,157,16,94,62,1,186,31,177,23,148,95,174,37,212,230,188,39,149,85,168,50,72,102,206,145,200,198,29,144,159,
+    225,3,6,81,90,14,201,158,241,4,102,50,57,230,35,252,131,11,232,115,39,12,14,215,147,135,52,126,2,237,11,220,
+    103,176,173,114,69,97,171,189,173,89,91,158,238,85,147,176,212,166,219,85,237,209,110,240,149,46,108,0,225,174,222,29,
+    137,81,176,239,243,123,104,224,231,170,223,171,243,56,78,211,190,55,20,127,133,239,230,137,206,135,161,136,153,219,87,136,
+    190,241,133,65,56,71,6,94,132,243,16,215,61,242,108,106,112,185,6,219,191,198,158,53,179,174,143,84,175,60,74,54,
+    208,81,34,69,37,230,240,206,82,138,80,65,168,96,37,140,49,212,170,60,62,168,25,146,162,141,161,254,103,161,142,145,
+    76,181,165,95,17,214,83,207,114,52,159,252,206,200,79,80,116,248,225,227,46,36,37,253,67,250,123,218,52,5,199,131,
+    176,150,117,197,79,123,101,72,220,126,212,99,227,29,171,204,185,137,149,223,68,186,141,199,164,45,137,188,250,144,190,104,
+    167,56,207,106,237,141,79,7,190,22,195,54,1,30,135,3,189,5,193,108,126,173,37,156,76,63,153,169,105,168,29,61,
+    243,63,10,22,56,32,142,9,243,80,85,77,138,144,8,220,181,11,105,180,247,28,117,236,119,98,197,248,225,6,211,172,
+    95,151,23,137,194,85,208,54,86,156,45,84,220,108,45,3,138,136,115,14,48,223,36,15,71,55,213,30,56,88,44,121,
+    62,67,85,224,117,99,0,32,28,168,79,233,143,73,43,216,46,35,150,146,207,115,59,2,53,181,131,76,89,95,197,146,
+    94,226,185,182,190,157,206,235,220,65,37,174,159,133,111,57,161,148,19,47,168,70,25,79,165,158,95,250,99,60,198,109,
+    234,155,98,237,40,230,124,10,149,209,74,139,105,63,89,22,162,148,85,141,245,193,30,232,64,149,255,38,241,185,159,204,
+    166,129,253,234,165,144,227,132,55,67,235,130,200,206,171,8,185,71,242,88,33,77,107,9,117,71,131,230,204,125,208,67,
+    33,83,66,96,41,73,49,64,158,66,63,214,123,106,198,189,199,70,92,13,116,28,254,105,143,182,90,24,76,122,73,63,
+    131,190,235,207,133,127,232,45,208,86,166,8,142,29,38,195,201,87,232,88,168,248,75,196,104,73,47,24,209,98,10,79,
+    241,62,102,235,105,235,72,1,65,51,1,102,105,167,187,28,76,69,125,105,252,61,207,253,65,193,7,195,222,221,87,152,
+    114,127,89,36,209,103,117,26,219,254,33,15,191,160,240,3,165,124,38,200,142,178,248,72,219,186,116,58,36,101,19,6,
+    234,74,65,90,49,169,239,94,54,27,225,78,141,206,122,127,59,175,211,16,17,68,77,114,202,167,5,230,18,193,204,86,
+    133,111,10,254,20,121,88,94,242,47,148,101,204,171,63,20,250,40,138,110,221,191,138,151,245,92,251,151,194,72,14,125,
+    120,64,38,254,171,98,17,113,211,185,169,86,228,62,255,28,130,63,161,68,235,135,134,25,146,121,177,71,175,151,243,99,
+    158,125,175,148,202,2,50,57,164,234,168,128,183,91,243,180,201,207,44,72,232,150,108,56,252,36,11,228,217,198,40,132,
+    239,234,45,49,208,129,227,13,48,224,34,43,205,183,139,13,229,237,76,105,131,106,189,87,124,86,127,145,136,16,143,89,
+    1,110,21,197,61,140,67,1,42,115,5,157,12,131,122,116,214,215,163,77,3,31,229,124,59,33,75,220,4,147,113,6,
+    166,60,6,32,160,210,175,46,22,70,178,147,60,221,160,33,21,84,144,120,64,237,66,49,105,76,151,186,254,205,13,191,
+    115,231,76,147,41,157,28,25,103,75,79,138,205,74,183,131,164,104,142,129,116,238,196,216,117,237,111,130,50,122,67,212,
+    192,103,72,32,124,116,106,233,138,16,96,79,74,122,18,99,118,136,111,215,185,246,101,93,32,12,51,138,8,154,82,251,
+    17,213,251,70,156,112,93,140,201,93,211,249,230,92,52,143,227,108,214,126,57,12,116,147,210,137,215,109,34,34,19,148,
+    195,139,34,88,186,37,245,185,195,162,83,235,20,131,118,5,179,193,77,7,219,133,202,85,26,130,180,15,38,57,146,145,
+    67,115,178,31,53,229,163,159,17,104,166,173,156,232,167,190,14,19,177,10,223,251,146,237,204,5,84,59,222,171,117,52,
+    202,169,122,103,235,190,86,68,209,188,98,180,112,136,252,246,64,178,110,78,229,87,24,88,240,52,88,199,239,255,228,51,
+    186,189,239,101,218,86,3,90,115,62,230,160,137,107,213,194,19,186,183,25,220,56,215,36,141,57,162,192,92,54,230,239,
+    40,250,164,201,69,27,250,229,226,38,111,41,223,245,252,253,144,156,71,82,206,231,15,5,206,224,102,109,66,28,215,76,
+    147,235,117,97,231,8,22,170,155,88,246,202,150,28,172,165,144,52,254,9,235,188,219,15,141,43,216,159,121,124,14,241,
+    145,85,138,219,249,36,110,232,23,164,211,111,168,59,160,250,178,95,166,70,239,208,5,138,202,75,220,179,136,243,77,84,
+    217,73,109,242,56,217,222,94,125,188,185,128,52,91,229,132,37,46,51,169,244,125,49,85,29,174,219,169,193,104,19,95,
+    219,105,85,90,217,109,36,164,255,148,160,138,37,152,251,141,0,89,172,149,119,165,77,147,78,144,208,95,139,37,84,147,
+    235,1,165,150,113,154,189,148,125,56,139,255,178,32,86,55,214,97,238,249,171,29,55,46,105,225,38,190,146,11,248,146,
+    189,153,211,166,247,21,192,155,234,22,138,133,85,187,57,37,186,156,2,167,237,135,150,9,29,249,194,39,178,226,205,22,
+    242,251,192,112,20,221,161,6,86,34,159,32,251,254,216,107,175,220,215,127,247,136,181,104,253,48,196,124,117,160,142,232,
+    199,51,150,183,110,73,214,59,156,154,81,142,74,54,19,69,113,113,96,175,84,29,178,94,6,146,191,12,36,181,19,124,
+    9,165,69,198,215,107,33,242,139,159,89,17,216,229,162,0,71,156,69,27,244,216,99,75,148,24,12,22,83,40,206,122,
+    226,25,4,9,241,27,139,45,198,77,21,239,119,59,157,144,206,36,22,43,190,60,118,146,89,240,8,183,66,180,131,58,
+    214,194,186,120,152,216,195,153,75,242,25,227,64,46,22,1,91,246,49,120,94,0,4,170,2,152,37,171,164,56,207,88,
+    12,146,218,173,87,151,81,19,11,130,24,43,126,198,124,24,209,150,172,182,125,27,119,30,112,149,110,54,98,228,119,206,
+    51,69,122,51,104,89,125,186,54,72,223,207,222,217,42,191,163,150,11,2,194,208,189,134,130,165,131,33,48,132,161,192,
+    61,41,83,49,59,139,78,179,135,180,33,3,246,4,188,176,39,61,11,83,67,132,192,99,159,117,3,151,82,135,71,54,
+    159,185,61,240,233,112,7,101,148,211,172,16,248,157,241,212,68,85,198,198,166,148,246,76,215,76,228,155,175,212,13,87,
+    109,214,89,116,134,246,180,89,97,219,14,4,57,125,70,168,70,217,27,189,122,88,65,0,68,66,87,49,121,192,35,7,
+    117,107,9,192,223,48,117,167,104,122,30,125,102,110,142,161,110,97,29,105,224,76,224,133,186,137,115,240,70,168,236,143,
+    50,11,160,130,86,162,187,122,35,159,169,71,62,212,75,83,29,90,200,195,144,225,244,142,229,167,153,82,82,198,242,131,
+    172,111,107,34,153,184,216,62,135,205,126,251,153,26,113,161,132,238,12,54,216,159,137,8,246,31,99,211,202,86,33,111,
+    251,112,59,47,254,195,150,103,247,66,37,38,32,146,94,228,135,46,92,230,181,164,49,214,14,76,11,22,242,183,58,167,
+    21,75,50,197,71,161,49,92,136,122,71,143,238,20,209,204,149,149,132,140,180,237,243,94,181,234,4,40,117,150,134,32,
+    49,247,159,84,235,197,187,245,141,234,132,100,242,248,183,143,177,84,5,60,42,86,62,190,101,36,26,12,134,184,172,52,
+    196,214,29,231,63,229,124,109,117,93,26,99,94,204,191,34,14,32,0,134,120,230,0,238,133,227,252,90,158,165,21,140,
+    176,127,233,143,129,167,118,101,114,85,184,85,173,158,36,85,65,48,40,204,51,180,35,94,104,68,131,82,231,0,1,181,
+    99,66,134,76,52,116,38,53,240,255,71,116,135,112,138,83,106,126,86,123,38,116,199,56,18,95,187,6,66,121,69,195,
+    242,88,20,83,64,233,101,227,133,55,73,230,118,254,219,96,43,242,123,6,201,56,117,83,176,211,68,203,232,209,146,79,
+    180,152,233,65,241,200,177,162,188,151,60,171,237,246,161,62,62,132,193,65,88,149,151,131,94,125,174,154,200,186,109,177,
+    116,54,94,246,134,160,254,205,174,35,189,201,176,136,25,76,17,140,86,214,191,22,65,83,222,157,97,26,12,29,78,94,
+    90,19,162,129,26,203,85,152,1,21,20,124,246,192,80,254,24,108,149,9,228,46,10,13,217,208,159,198,153,69,8,107,
+    123,160,123,149,251,110,68,73,126,178,70,60,225,177,40,49,75,177,128,106,230,232,226,33,248,61,80,57,84,81,144,82,
+    115,75,96,72,129,60,119,57,215,54,239,143,128,31,87,205,104,33,35,127,38,251,107,2,126,89,216,186,110,54,227,9,
+    85,83,206,29,125,247,116,1,32,240,188,20,41,56,117,97,26,225,168,247,87,25,180,14,14,231,254,161,192,168,13,38,
+    203,244,215,109,3,144,42,24,10,226,153,184,28,114,250,181,156,225,213,174,244,93,166,101,35,82,204,160,106,163,146,33,
+    134,86,146,220,95,113,138,42,133,241,217,238,73,122,7,34,141,169,213,117,183,201,36,46,90,134,176,181,157,20,39,213,
+    149,135,112,139,225,118,30,128,135,79,53,105,191,123,221,188,110,55,144,169,156,112,222,117,81,250,62,11,211,119,92,144,
+    29,83,144,81,207,123,151,117,238,151,166,144,152,189,171,143,30,67,20,33,128,109,241,94,177,110,175,140,134,75,106,75,
+    141,175,163,147,223,15,74,71,59,162,212,149,10,3,82,219,215,23,203,66,141,33,68,57,111,245,41,161,120,120,76,123,
+    159,126,82,38,184,196,6,39,243,13,145,132,253,100,21,42,199,7,151,16,97,27,158,190,234,10,142,26,24,201,248,231,
+    247,57,145,57,18,175,238,46,18,26,18,176,231,196,208,109,26,19,15,190,181,98,179,112,7,164,40,254,238,177,114,40,
+    5,152,39,215,63,110,212,235,3,4,85,54,83,201,235,48,23,0,93,255,165,221,134,192,213,20,86,20,180,43,141,250,
+    180,26,212,82,63,165,225,5,147,23,18,4,60,150,227,28,128,227,1,2,54,230,167,36,228,108,193,222,247,137,146,24,
+    16,234,240,151,221,54,11,20,53,17,53,158,221,0,207,145,91,65,62,91,218,112,224,104,92,222,1,118,205,84,113,120,
+    66,240,241,93,245,203,233,169,93,235,236,136,122,10,204,116,156,160,176,166,118,113,156,112,144,245,168,46,171,126,207,24,
+    21,52,57,121,107,184,80,117,135,146,66,118,113,65,175,114,191,38,164,244,116,98,136,29,52,85,87,61,96,128,220,27,
+    250,173,95,241,189,184,182,102,48,82,236,146,216,175,45,159,161,209,209,35,239,16,186,27,48,32,237,253,233,125,222,197,
+    128,190,249,44,253,178,70,141,139,51,71,232,65,8,219,132,253,7,237,75,77,159,188,108,251,152,251,73,114,144,76,59,
+    28,162,238,76,80,84,201,82,57,160,32,251,69,183,251,221,159,65,79,80,128,154,197,84,38,222,218,204,135,216,51,245,
+    45,232,79,172,131,171,204,150,74,214,131,125,32,187,121,166,244,81,149,121,42,161,224,218,255,137,132,142,213,194,35,156,
+    80,125,133,162,216,162,83,159,133,125,27,199,172,78,202,206,102,128,209,224,166,51,191,19,34,78,51,87,208,245,247,22,
+    185,38,50,152,222,174,116,68,66,86,1,183,211,55,93,23,164,253,14,35,46,198,167,228,171,242,133,202,85,128,252,142,
+    137,193,201,154,44,175,255,50,241,60,145,159,205,132,123,17,241,9,156,132,43,14,30,53,86,111,113,8,251,157,98,158,
+    67,109,75,51,213,137,78,2,231,71,98,37,68,167,38,6,61,100,24,24,52,67,214,214,9,86,87,244,71,52,115,10,
+    7,123,11,95,66,29,215,110,207,83,52,214,229,96,236,80,194,104,135,222,241,100,191,28,94,92,153,213,243,245,253,194,
+    92,199,137,218,33,223,141,80,13,158,82,102,15,26,149,132,25,157,153,176,13,182,164,217,51,100,30,1,113,87,238,124,
+    40,103,23,28,125,201,188,1,255,160,8,225,80,66,50,111,239,159,162,189,106,194,84,32,141,99,43,229,8,249,67,105,
+    186,119,121,52,14,151,47,153,51,38,18,111,157,156,207,154,55,54,62,203,157,62,219,31,124,69,58,118,51,25,206,62,
+    120,86,47,8,139,50,30,58,108,253,6,206,212,163,166,95,185,160,122,0,251,63,231,89,3,231,29,148,134,16,194,43,
+    138,49,64,163,244,114,236,163,81,224,184,205,242,21,106,92,146,227,121,201,181,155,126,22,60,29,202,14,139,185,166,110,
+    167,134,52,180,197,134,214,190,177,117,3,157,75,129,199,182,106,159,208,194,221,189,205,202,37,215,194,22,46,128,129,94,
+    175,40,73,36,165,6,126,1,173,56,170,16,143,57,235,156,100,151,48,107,130,76,35,238,1,137,187,132,134,52,29,228,
+    61,212,100,220,159,216,29,68,151,249,106,191,152,154,96,53,79,243,66,49,220,116,150,48,131,99,5,142,206,111,151,1,
+    63,41,113,83,61,193,222,104,53,35,120,158,119,218,240,42,198,64,123,85,35,48,190,76,203,77,99,88,144,33,234,29,
+    204,83,30,234,88,25,141,180,108,80,243,138,168,105,91,254,219,229,111,165,81,132,107,155,0,100,192,188,131,162,199,204,
+    104,101,172,189,68,206,129,20,110,116,173,118,52,210,1,97,141,211,18,120,49,250,126,36,31,198,230,114,241,26,49,23,
+    13,247,241,221,215,107,148,8,231,46,135,181,10,112,160,153,199,248,20,208,90,170,24,111,73,12,203,152,65,81,166,85,
+    158,244,207,135,59,100,247,17,144,243,198,231,44,166,244,138,233,102,150,200,66,4,188,74,171,189,187,147,42,7,137,54,
+    147,148,115,64,254,116,173,10,56,236,46,103,133,75,206,38,107,249,48,96,228,85,14,188,106,234,50,205,152,41,180,248,
+    83,236,47,138,133,145,190,247,222,114,194,172,4,105,6,78,189,180,230,233,97,73,31,202,21,70,213,207,151,85,245,160,
+    181,101,104,181,207,220,216,171,99,161,169,130,126,196,45,217,146,177,68,42,12,174,221,114,81,173,106,63,216,10,16,126,
+    136,121,58,172,122,32,105,153,203,23,83,62,241,16,205,146,204,14,149,207,172,29,241,134,246,21,27,0,30,169,250,139,
+    238,65,25,23,8,176,175,249,151,94,101,39,202,16,247,114,2,106,23,49,183,46,176,154,32,218,20,37,203,184,166,191,
+    131,134,34,21,56,219,142,177,17,157,223,58,179,10,110,173,34,105,81,4,69,42,33,94,188,21,178,18,14,84,89,229,
+    145,58,205,93,47,69,15,137,194,114,181,21,152,207,224,37,134,242,239,146,89,168,108,210,170,204,57,93,203,23,173,213,
+    109,246,251,129,162,47,40,183,17,76,169,13,58,252,184,136,114,91,24,243,211,110,249,99,111,71,189,51,253,146,120,12,
+    107,93,199,139,111,7,90,250,159,186,174,118,199,213,45,12,109,121,214,141,91,61,43,29,36,23,169,62,244,10,215,120,
+    10,159,80,118,238,248,95,115,9,46,93,115,95,114,168,170,193,1,162,55,161,8,32,163,10,188,161,120,160,132,171,139,
+    62,89,234,82,96,195,227,101,65,162,222,61,214,214,182,132,203,139,161,12,239,69,213,156,21,61,13,201,245,178,208,134,
+    154,165,166,207,35,88,193,222,168,164,208,144,188,130,120,211,236,147,199,47,162,169,44,102,231,157,255,67,110,160,81,90,
+    14,164,109,111,67,138,199,153,151,78,121,99,73,2,137,219,34,217,157,153,143,62,206,243,119,198,13,138,74,204,5,86,
+    243,184,32,58,116,241,196,246,255,226,43,196,41,16,73,158,244,210,230,170,217,180,238,211,170,146,51,19,38,18,37,246,
+    189,97,132,76,9,89,8,254,217,66,206,57,102,30,39,12,170,4,16,13,163,75,201,165,42,158,47,117,16,55,98,171,
+    204,69,16,250,136,58,68,21,68,71,13,116,216,152,72,28,230,32,59,130,73,113,47,199,38,58,240,10,75,195,60,139,
+    89,205,251,151,65,128,245,195,238,29,78,114,197,224,76,141,160,108,78,186,163,137,163,77,51,113,117,163,225,107,235,29,
+    19,207,118,255,222,3,104,236,214,60,43,225,82,104,252,72,95,60,234,214,190,55,87,149,110,120,50,18,180,190,123,5,
+    47,84,81,112,75,188,170,250,210,106,129,181,34,78,202,68,189,92,134,37,71,232,114,72,170,90,164,127,79,79,110,64,
+    148,122,193,243,239,248,25,64,77,151,75,102,91,72,134,95,81,146,85,106,201,156,197,52,132,229,65,207,222,144,122,112,
+    39,99,146,157,180,102,207,48,194,2,161,161,169,186,36,68,216,30,70,237,224,207,60,17,36,184,126,45,170,255,156,7,
+    185,102,111,144,229,167,208,40,33,170,26,116,160,156,217,35,195,33,38,117,177,166,145,193,98,70,43,205,20,179,71,51,
+    228,249,169,170,5,189,60,125,4,245,146,151,129,67,127,198,96,171,109,4,243,117,250,140,48,115,13,7,241,203,171,190,
+    129,88,20,184,228,204,35,52,61,69,174,201,110,16,176,188,255,47,78,13,140,11,162,101,137,23,133,216,178,36,57,134,
+    26,186,43,179,204,250,191,213,129,152,50,191,76,13,53,173,228,38,2,111,42,222,250,59,167,47,123,152,108,177,128,203,
+    228,206,173,139,98,245,123,18,10,64,106,62,191,50,121,46,104,155,49,166,160,211,22,226,100,100,9,244,27,255,18,65,
+    158,211,14,229,239,222,2,75,159,251,89,233,149,156,99,22,156,126,155,202,149,224,83,222,163,39,6,77,33,252,110,6,
+    234,111,16,165,200,3,234,16,93,61,31,189,111,227,28,43,181,59,28,194,129,29,59,71,151,104,16,221,172,215,8,207,
+    137,109,13,238,6,233,185,40,7,45,106,129,163,255,185,250,234,43,120,161,203,230,75,68,123,69,5,31,76,175,237,76,
+    205,62,26,25,155,128,192,214,214,15,10,166,50,161,213,223,139,76,230,12,69,82,53,136,21,66,251,121,2,197,51,222,
+    255,69,234,8,48,155,2,3,242,41,14,218,148,82,71,197,61,128,255,205,165,89,104,158,78,25,248,217,137,138,108,139,
+    141,141,184,76,253,129,195,112,101,222,170,74,225,164,92,166,122,21,212,110,47,156,250,23,91,140,166,144,81,254,108,210,
+    87,182,186,68,182,14,43,228,72,80,73,90,155,65,156,0,73,34,147,108,148,78,107,43,65,208,129,104,209,233,121,184,
+    203,229,47,77,187,207,214,229,207,20,46,165,30,114,132,106,231,201,230,184,186,138,245,79,26,50,207,26,123,115,16,121,
+    113,83,125,107,115,125,219,140,183,117,90,40,101,63,233,132,29,97,218,53,120,0,80,123,21,131,67,98,136,66,34,158,
+    26,138,1,105,189,79,32,133,18,226,128,194,196,4,46,250,35,107,166,143,240,157,36,115,44,91,167,167,189,40,166,136,
+    244,201,58,2,217,220,7,88,232,94,201,75,208,210,153,131,61,44,211,75,130,235,90,129,40,130,164,9,195,4,139,217,
+    241,89,119,250,2,188,35,150,97,78,96,202,51,123,77,59,61,72,180,0,55,40,202,93,144,42,81,248,26,129,138,229,
+    86,12,211,96,57,146,82,229,34,192,198,220,102,53,54,230,48,196,202,197,146,182,8,34,172,222,174,205,80,250,1,45,
+    2,77,159,161,176,48,40,223,98,114,22,63,45,229,180,7,102,238,183,45,96,102,126,3,108,225,179,10,254,217,246,97,
+    80,216,81,83,132,48,105,199,67,82,18,46,244,132,193,165,38,80,21,61,80,148,119,58,126,123,111,215,220,58,147,125,
+    9,142,100,19,4,12,216,123,42,38,30,3,14,171,88,97,136,152,134,123,89,232,10,219,201,7,211,244,97,160,95,107,
+    85,217,98,250,163,166,80,100,200,159,122,249,218,131,163,72,17,44,120,167,183,183,70,150,63,219,158,114,173,67,192,20,
+    252,56,166,216,72,68,76,46,42,52,227,183,79,27,189,47,212,12,219,92,126,103,20,174,141,6,38,102,186,137,82,144,
+    159,26,205,224,247,223,117,43,28,103,82,142,204,80,95,146,71,121,140,158,133,89,71,61,46,91,14,158,64,112,63,241,
+    69,212,185,102,92,32,204,78,78,217,252,88,118,106,45,72,248,94,224,134,217,205,249,74,223,74,240,167,215,179,35,215,
+    221,95,219,57,12,54,132,217,183,180,141,178,180,113,15,94,216,81,95,192,10,12,232,158,181,25,44,102,224,53,37,155,
+    223,70,34,241,116,67,125,53,224,49,46,176,143,162,115,65,214,127,42,161,67,196,79,228,227,59,247,128,130,28,46,166,
+    229,153,241,206,109,206,74,11,219,42,63,110,254,72,54,142,199,29,116,184,214,233,36,43,172,188,93,149,185,96,66,76,
+    221,48,224,164,205,22,152,95,76,91,38,196,108,1,22,79,15,227,21,146,179,116,212,176,49,156,5,73,52,35,9,252,
+    35,94,64,157,177,215,143,241,82,221,170,76,61,109,174,232,213,115,184,173,222,115,38,190,96,124,122,134,173,207,198,202,
+    101,224,194,225,181,56,198,217,89,151,240,207,239,92,55,197,6,249,31,17,194,56,177,144,11,163,204,166,27,170,65,145,
+    74,2,157,129,232,18,240,173,102,60,155,188,243,8,192,71,35,163,99,0,86,195,71,50,46,213,172,58,84,190,25,29,
+    34,130,120,150,253,92,233,197,219,61,53,243,111,142,71,115,38,48,58,239,205,134,43,56,120,89,153,120,157,187,202,57,
+    123,67,162,97,63,133,47,116,243,118,151,86,255,126,53,197,52,238,105,185,56,206,172,29,51,0,111,170,61,120,21,64,
+    35,88,9,98,107,130,104,187,75,19,66,23,11,244,74,47,200,17,203,205,193,236,173,164,123,25,226,226,213,12,95,214,
+    231,49,85,231,42,249,209,43,169,176,72,236,108,26,152,160,12,189,23,191,163,19,94,48,63,137,237,24,186,47,235,29,
+    251,169,227,216,242,251,76,21,107,163,227,145,251,103,162,197,102,168,237,85,191,17,173,78,155,130,73,96,254,33,219,231,
+    159,148,82,35,145,212,242,30,114,102,35,102,100,94,131,148,156,90,35,174,83,232,5,132,48,6,82,117,250,206,195,27,
+    42,121,72,164,247,98,17,39,245,115,224,10,62,145,210,195,141,116,55,213,93,94,74,150,155,107,49,194,142,143,184,87,
+    181,20,99,157,186,195,69,98,139,157,202,21,29,205,47,99,107,68,161,96,221,247,56,94,206,46,168,175,191,250,73,217,
+    27,148,23,163,158,212,4,219,197,12,6,207,187,97,8,24,251,46,232,17,85,139,19,108,182,91,150,32,240,94,232,121,
+    1,79,247,157,143,167,200,114,50,161,159,36,184,158,31,128,49,136,247,14,3,242,155,141,191,137,254,31,246,45,157,158,
+    189,173,178,139,2,119,132,227,89,37,185,71,43,9,44,202,115,44,184,97,19,167,95,219,78,79,171,100,26,56,76,217,
+    72,57,75,157,230,254,66,47,91,196,178,99,169,60,173,41,66,190,188,168,153,240,252,173,68,192,190,71,198,253,60,61,
+    213,253,157,109,196,87,120,170,62,189,152,172,61,182,219,236,199,38,146,107,43,170,83,95,26,21,246,186,190,15,88,90,
+    242,203,97,2,108,65,206,84,164,206,239,249,203,27,248,27,5,40,209,45,121,117,2,150,253,249,193,197,133,252,183,179,
+    250,141,2,123,183,60,34,189,26,233,88,193,113,90,175,4,226,248,157,20,190,83,137,122,99,228,191,86,247,45,92,249,
+    226,204,191,168,224,39,92,2,166,82,171,162,194,8,85,12,230,88,189,2,114,18,84,64,52,158,127,7,150,238,53,70,
+    209,35,113,193,22,171,60,61,189,41,208,35,19,159,157,153,124,55,169,107,177,162,236,13,51,32,188,103,12,132,14,43,
+    219,90,75,32,49,19,199,47,10,53,236,104,110,162,142,70,23,189,236,153,194,103,199,250,26,177,151,103,86,172,172,186,
+    238,173,74,222,52,115,198,90,213,127,70,22,113,66,146,96,220,42,140,53,129,123,71,223,252,205,71,93,125,131,122,209,
+    174,169,35,70,123,227,108,107,181,202,140,90,208,248,23,249,84,85,177,61,221,144,117,27,218,32,181,86,84,34,62,150,
+    28,247,6,215,208,124,153,122,125,91,146,125,226,209,144,12,223,5,151,244,252,241,179,227,125,154,107,120,246,247,160,243,
+    37,159,96,183,125,151,143,156,93,140,114,176,200,129,36,149,5,149,169,21,35,139,119,222,50,209,132,122,39,221,36,128,
+    122,33,203,119,38,242,90,57,83,134,20,138,207,150,164,97,61,55,162,182,181,119,154,250,159,4,161,175,169,154,121,26,
+    155,19,216,9,246,66,217,16,19,107,241,29,73,250,83,153,92,2,225,24,210,127,132,40,112,207,30,186,70,50,67,44,
+    189,204,3,188,98,14,196,75,78,69,167,183,114,16,39,76,65,73,184,177,226,189,203,61,11,86,210,142,246,151,3,125,
+    121,104,223,151,56,243,208,52,85,63,214,133,37,237,27,55,228,77,82,7,52,238,151,10,185,44,141,235,88,127,37,1,
+    251,77,25,74,231,112,145,15,17,23,44,167,97,154,77,79,28,28,138,64,69,121,73,237,157,129,138,61,247,131,27,135,
+    70,18,241,142,250,232,142,157,77,24,107,96,243,246,95,29,211,147,146,12,77,58,200,18,73,125,88,89,191,230,214,90,
+    138,193,244,124,253,154,210,70,137,104,27,207,122,20,154,97,221,248,9,238,243,71,156,65,90,73,242,50,255,204,126,161,
+    86,203,73,131,43,40,132,4,204,214,189,152,73,112,143,112,16,33,141,144,203,75,193,41,27,46,202,248,59,60,153,201,
+    192,217,122,215,88,18,158,219,211,222,110,114,219,46,111,249,45,64,13,22,11,160,150,255,23,55,197,186,197,118,121,62,
+    198,56,253,31,45,49,5,182,11,136,113,62,40,139,35,44,247,248,98,196,66,111,25,193,159,196,96,153,80,148,145,113,
+    112,93,111,63,144,129,70,28,113,47,152,247,132,122,39,108,217,35,140,171,213,168,36,118,117,183,14,26,119,65,74,108,
+    97,106,10,208,167,186,54,121,120,117,227,108,251,238,215,210,179,249,180,103,159,194,140,230,163,250,25,1,149,103,88,117,
+    171,137,106,56,129,189,105,31,118,79,125,122,21,204,215,33,167,37,250,57,61,237,106,15,143,200,177,255,99,14,119,11,
+    137,218,128,180,123,53,67,108,122,179,249,226,12,45,90,162,127,190,239,117,60,20,158,243,93,131,255,242,69,122,151,249,
+    223,218,198,38,137,114,158,176,223,65,204,236,130,225,185,206,158,144,212,239,174,252,253,176,156,132,76,44,116,63,42,25,
+    139,213,216,45,126,157,60,244,34,123,138,23,119,155,17,153,28,131,58,217,68,228,170,30,187,91,137,111,144,184,148,242,
+    100,207,246,81,129,124,232,202,113,20,54,207,53,28,128,146,240,107,233,20,78,74,131,76,203,171,253,43,231,120,223,8,
+    238,118,154,111,239,209,241,251,102,112,22,168,192,30,119,233,178,14,209,29,164,16,94,187,171,94,16,25,32,244,108,90,
+    168,78,237,118,38,108,210,177,221,137,226,0,231,156,117,31,191,95,19,203,101,244,0,207,162,93,146,57,108,89,158,98,
+    184,92,234,68,2,160,28,194,147,246,248,31,150,97,162,240,156,248,242,0,43,66,131,28,176,15,160,255,166,14,134,2,
+    187,8,139,33,187,59,140,150,233,251,145,246,93,21,30,129,182,43,191,85,94,151,200,215,162,41,163,178,20,40,59,190,
+    163,106,87,159,26,109,169,181,207,94,194,133,209,134,39,218,81,199,121,40,98,240,245,223,119,187,191,82,28,134,19,174,
+    212,191,85,167,21,63,172,48,195,187,93,107,214,148,34,194,131,61,227,169,201,133,134,88,143,48,146,33,144,234,135,60,
+    248,195,238,176,234,219,245,17,81,31,241,241,250,204,194,17,2,56,72,44,125,230,114,27,175,254,71,55,135,76,100,205,
+    149,88,69,39,178,147,105,132,22,137,234,174,100,175,135,9,150,75,141,17,222,144,199,141,80,156,200,174,183,27,160,212,
+    183,239,185,46,6,21,206,246,75,89,179,228,163,201,136,187,64,53,50,246,99,20,62,65,173,191,151,11,215,30,157,209,
+    241,13,132,0,0,92,72,212,108,6,219,232,160,85,54,120,166,185,79,38,231,170,134,93,64,170,157,102,105,50,98,125,
+    150,123,239,2,49,171,140,90,161,69,144,196,207,56,63,80,218,15,224,164,195,61,63,203,234,191,242,159,38,100,194,43,
+    145,202,198,45,249,155,126,82,243,249,100,51,154,160,238,90,227,154,207,55,38,154,149,203,236,40,51,65,122,89,67,205,
+    236,240,109,28,58,99,237,63,178,214,172,91,244,46,204,231,234,30,167,67,220,161,11,213,87,20,188,79,217,251,251,190,
+    87,7,182,158,249,34,226,14,191,47,249,145,252,13,36,14,62,145,54,57,232,195,155,7,184,173,153,236,228,204,169,248,
+    161,179,183,102,176,158,238,197,20,148,145,23,102,186,19,234,20,222,93,215,179,246,126,104,8,40,126,182,184,81,40,73,
+    126,41,12,130,33,176,44,81,167,55,44,28,208,189,4,89,174,179,253,99,172,73,4,225,83,24,60,182,209,126,31,233,
+    107,251,223,51,204,108,183,150,95,18,206,129,57,72,91,235,179,12,27,175,71,93,131,63,20,208,160,29,79,55,48,54,
+    22,241,1,123,107,81,143,110,218,236,169,29,39,139,11,58,239,69,22,78,231,156,66,0,199,73,221,157,224,45,100,124,
+    229,209,66,53,47,44,192,203,85,167,84,187,69,46,212,217,219,242,44,124,67,65,36,43,200,245,186,19,157,79,101,210,
+    157,110,24,129,135,183,141,34,97,133,134,82,165,125,134,27,153,35,43,180,188,67,53,104,70,95,138,47,165,179,134,101,
+    243,28,39,70,1,224,129,149,237,6,176,172,156,241,11,66,77,106,135,208,243,65,242,232,143,234,36,195,79,108,51,218,
+    76,119,37,209,242,233,110,247,186,233,3,22,169,168,150,105,209,244,22,229,55,114,123,189,206,210,232,57,138,72,217,171,
+    221,213,136,193,58,63,106,88,80,211,143,199,207,241,218,1,113,56,146,201,68,30,67,163,31,194,126,19,87,163,227,169,
+    128,223,215,169,49,160,11,174,55,179,192,168,53,62,150,163,55,20,125,168,214,112,117,126,41,88,234,202,49,193,88,164,
+    238,39,205,67,41,22,47,185,224,44,99,52,14,224,46,170,135,135,217,155,162,93,157,165,158,14,98,255,70,86,118,174,
+    4,95,47,17,145,178,168,244,135,37,141,242,108,11,42,211,119,42,158,116,78,68,26,217,201,179,11,223,135,77,122,217,
+    114,164,177,242,68,234,189,92,92,118,226,169,191,129,64,93,190,163,162,145,88,252,53,254,174,158,102,172,157,113,159,73,
+    171,71,125,63,115,110,253,146,178,39,226,234,112,233,213,20,73,100,189,59,204,187,84,54,170,35,158,58,93,47,113,97,
+    187,171,186,226,73,222,170,13,24,167,237,189,6,131,116,60,194,247,145,32,33,243,155,254,213,73,158,231,124,227,149,245,
+    211,208,243,239,109,249,53,184,204,241,245,223,77,255,103,100,210,233,229,7,85,0,159,158,196,93,95,33,188,48,237,79,
+    9,114,167,14,147,254,43,251,234,16,221,135,132,0,42,184,187,73,135,13,9,168,240,12,82,63,163,13,227,25,39,15,
+    240,219,135,119,17,84,243,37,98,107,234,94,116,74,238,82,126,33,235,15,123,210,13,64,170,110,154,121,184,74,109,1,
+    144,162,251,51,72,14,16,65,231,161,116,54,74,197,94,215,171,112,211,216,83,24,141,190,28,159,131,224,80,97,104,78,
+    132,52,233,100,214,233,87,236,108,48,155,238,243,123,237,245,204,138,37,127,39,79,158,168,169,88,17,13,242,217,117,228,
+    156,95,59,199,191,23,185,215,159,74,127,23,92,228,88,242,246,62,92,244,163,97,131,17,247,158,184,247,45,8,98,4,
+    148,6,102,214,144,222,118,43,46,39,99,25,128,221,189,193,254,44,164,94,63,14,66,236,230,187,164,160,28,190,60,238,
+    207,172,245,141,225,66,156,184,195,83,197,79,201,97,43,156,62,179,103,37,106,109,31,223,93,253,199,12,38,220,193,128,
+    58,160,16,38,47,112,10,200,74,229,152,70,38,250,162,249,144,19,254,115,56,232,36,220,149,99,91,164,32,22,194,87,
+    71,25,240,182,139,199,241,181,68,15,218,40,223,13,168,37,78,2,213,49,107,4,127,86,108,3,67,132,73,115,31,98,
+    108,156,202,63,85,187,185,104,137,253,82,219,146,147,89,121,128,169,242,165,155,217,201,55,171,100,251,143,206,102,174,221,
+    177,228,143,117,8,65,214,191,114,183,157,122,178,26,130,139,121,190,32,39,211,88,138,131,175,150,95,87,66,172,19,33,
+    174,180,64,35,71,239,216,34,196,211,94,254,15,187,106,94,215,212,84,250,79,141,162,19,154,152,154,118,53,42,98,93,
+    201,123,234,17,201,67,92,46,90,123,91,159,255,27,105,211,70,6,41,4,207,102,103,32,156,28,224,156,72,134,113,81,
+    133,100,105,40,246,40,238,100,251,244,149,28,24,249,20,98,28,233,154,13,90,105,0,110,43,229,42,69,119,232,124,199,
+    109,232,77,136,59,244,217,181,118,205,74,155,233,238,148,219,247,80,136,225,134,194,5,230,226,86,166,73,101,213,226,33,
+    239,214,32,226,99,127,64,247,166,52,254,136,197,92,113,117,165,200,126,30,205,23,245,254,86,78,169,185,133,222,235,78,
+    132,232,149,32,155,29,202,69,52,252,137,29,219,134,142,119,29,208,93,195,101,204,240,200,23,190,127,171,9,232,66,84,
+    127,60,250,66,107,136,221,185,39,187,40,223,150,255,187,191,173,148,238,186,141,207,86,192,249,183,189,169,198,112,99,147,
+    168,229,216,33,214,73,94,251,111,60,209,86,41,111,236,100,31,7,235,76,73,87,143,124,190,0,233,156,55,248,105,143,
+    20,153,243,153,223,56,111,110,21,103,182,201,60,108,250,158,67,225,31,131,215,149,55,92,193,255,204,144,197,142,31,15,
+    197,96,82,53,255,4,246,8,73,234,84,171,46,189,244,174,76,230,166,24,47,230,29,39,85,72,132,254,76,72,9,236,
+    154,127,247,19,135,23,237,179,208,54,44,54,186,136,177,120,212,79,117,12,24,27,234,30,154,140,54,157,20,171,219,22,
+    155,150,232,90,11,151,10,84,114,8,46,6,206,215,118,60,139,251,45,23,153,169,228,119,26,113,48,25,190,178,205,248,
+    238,160,177,231,146,61,204,73,185,251,201,174,164,38,94,70,195,101,203,190,166,185,146,242,84,78,164,119,157,77,151,189,
+    215,210,148,195,131,245,45,92,249,16,148,66,179,99,46,124,33,190,193,84,93,63,66,139,96,58,203,148,93,29,156,239,
+    227,179,227,170,225,176,191,211,214,172,255,114,224,39,115,100,62,164,252,10,219,3,232,173,133,139,236,219,143,231,122,93,
+    21,151,11,96,154,246,161,200,217,149,105,51,65,55,134,36,210,156,102,251,21,3,111,46,19,68,185,115,168,55,97,96,
+    2,71,161,127,143,106,124,111,104,41,72,149,232,186,147,146,52,46,105,186,111,86,245,213,124,47,53,186,132,59,145,238,
+    103,42,168,46,190,167,157,234,227,217,26,208,166,159,49,228,176,36,147,206,71,211,106,249,113,48,186,158,36,174,156,47,
+    124,61,189,129,136,144,255,187,189,33,234,43,77,192,236,177,105,102,140,50,200,52,221,235,118,5,157,92,252,199,175,237,
+    126,186,27,74,232,217,124,232,125,168,187,180,115,152,121,65,234,134,170,188,7,225,195,74,149,71,163,162,18,248,217,113,
+    210,56,166,173,216,249,218,157,213,122,202,231,198,37,10,159,118,80,166,83,219,220,50,150,100,221,170,148,65,29,230,71,
+    23,221,180,1,222,114,87,185,69,139,199,90,193,132,176,151,171,27,66,47,232,126,187,157,50,196,6,196,237,84,44,251,
+    61,63,222,194,119,62,56,190,95,118,33,40,125,84,157,180,179,37,34,236,168,106,53,143,250,54,39,37,28,48,139,144,
+    177,35,255,244,89,13,21,16,225,56,221,34,85,243,193,245,80,98,96,236,79,229,210,254,10,22,240,114,89,240,217,173,
+    80,176,231,116,208,90,180,237,178,253,147,41,168,108,64,59,125,49,229,89,167,51,75,255,92,244,54,125,36,213,58,230,
+    62,108,154,161,47,175,3,221,150,254,158,111,47,59,69,170,181,188,92,225,186,139,42,169,182,144,117,209,72,252,128,45,
+    79,165,109,2,227,222,186,31,18,191,39,75,244,200,24,162,76,36,26,114,18,6,226,104,198,152,169,224,242,75,74,99,
+    82,176,211,31,48,99,84,170,40,110,222,3,38,68,77,115,149,183,162,197,211,75,255,222,55,142,188,22,213,25,103,137,
+    38,136,18,53,29,176,251,163,151,250,92,254,113,59,172,138,43,48,186,161,115,123,105,219,153,101,186,232,102,159,131,160,
+    60,140,254,238,1,14,231,184,54,59,253,3,154,255,104,202,49,42,240,192,108,126,215,32,152,81,204,39,14,144,92,2,
+    179,118,64,150,49,46,154,51,214,27,83,28,215,202,94,155,96,172,222,14,157,159,219,57,167,143,132,186,116,73,210,68,
+    190,233,129,163,8,25,98,75,67,221,42,10,14,114,169,192,59,168,123,58,78,242,43,203,58,104,127,252,105,113,58,199,
+    241,64,100,241,178,173,222,49,215,254,139,34,244,82,202,86,196,253,109,98,73,24,54,210,68,189,36,80,86,181,21,218,
+    143,193,47,75,113,24,124,35,84,204,151,221,231,224,202,219,57,253,35,196,222,143,94,12,186,198,195,62,4,226,240,94,
+    149,186,89,49,115,21,217,165,155,63,84,195,58,165,220,68,27,248,22,157,82,232,160,64,121,165,20,140,27,143,96,116,
+    235,97,49,76,171,206,73,127,155,200,21,218,31,165,45,199,188,44,130,146,151,198,91,40,3,62,239,233,145,127,233,232,
+    182,210,97,224,227,247,115,85,176,76,101,16,112,89,178,101,124,5,104,36,197,21,232,121,132,21,178,29,47,10,239,40,
+    82,94,199,11,35,183,218,35,93,109,118,124,222,227,95,116,36,251,121,177,114,195,69,2,61,161,211,13,70,169,134,120,
+    142,172,122,187,118,116,86,121,79,173,149,75,203,79,87,225,77,10,66,151,55,113,230,157,243,7,168,167,227,68,51,193,
+    115,254,97,71,229,39,180,253,250,23,109,80,23,230,171,99,129,12,244,158,57,119,173,118,13,214,26,125,246,12,2,127,
+    86,149,7,114,245,104,255,235,86,215,197,173,74,105,136,199,233,216,48,205,255,100,196,22,71,32,41,30,215,78,21,127,
+    252,224,195,177,32,204,114,143,86,123,34,96,48,208,241,164,94,66,63,123,149,211,118,105,216,53,159,250,65,229,15,69,
+    210,62,183,19,67,206,33,112,197,171,174,28,207,29,46,5,114,135,53,100,178,43,244,110,107,130,218,12,255,183,254,198,
+    117,149,199,10,196,92,41,107,144,248,96,212,93,9,109,142,89,38,231,65,102,120,187,225,13,135,163,49,94,65,254,103,
+    128,250,43,145,178,62,197,195,121,129,134,119,217,122,204,105,232,91,187,169,213,36,71,6,132,215,164,48,135,67,55,107,
+    13,116,120,188,248,101,109,2,2,141,125,164,191,203,255,12,35,165,2,74,58,46,254,64,100,35,129,72,48,128,130,180,
+    107,55,196,166,19,234,83,178,102,49,160,170,31,94,196,209,98,151,88,3,74,125,206,165,129,116,153,174,72,248,197,40,
+    50,34,129,169,2,168,174,50,108,105,100,244,71,147,198,207,106,122,26,103,14,207,46,42,129,126,212,91,12,233,183,60,
+    203,58,88,148,4,177,148,187,148,59,199,92,161,171,8,156,34,49,186,117,205,171,150,249,98,53,106,168,234,32,112,222,
+    121,101,42,96,75,252,79,67,75,100,227,186,71,155,61,106,72,77,9,7,34,228,65,78,197,68,118,204,43,231,159,124,
+    1,84,198,150,29,168,12,163,2,108,142,36,158,89,239,166,28,78,142,93,90,28,39,101,76,27,137,157,193,164,55,53,
+    159,152,164,111,173,93,89,49,110,98,71,169,131,57,63,6,251,133,161,191,246,33,175,119,213,45,121,189,217,169,29,34,
+    148,86,252,19,162,226,223,225,58,154,194,243,251,63,170,118,71,132,140,164,225,239,84,181,10,70,130,183,69,111,141,242,
+    65,157,255,13,164,233,192,207,14,141,210,132,170,105,246,196,203,190,74,227,238,19,120,3,125,52,57,254,134,173,139,3,
+    62,123,29,201,116,142,68,52,204,56,33,94,183,183,24,35,33,60,247,60,172,72,100,206,200,55,70,84,190,120,53,17,
+    58,37,223,61,135,38,49,244,153,93,217,49,170,87,81,103,160,168,244,229,91,137,41,123,176,215,247,244,166,203,215,163,
+    88,134,244,57,88,35,34,123,248,150,180,73,233,159,61,116,232,148,226,64,38,110,96,159,247,54,136,114,48,144,122,158,
+    146,238,178,84,155,178,215,97,45,44,147,118,136,168,143,47,41,62,104,227,166,135,57,18,121,241,114,234,65,159,185,3,
+    106,240,136,25,113,219,75,27,24,60,128,3,188,135,32,34,176,41,29,178,65,180,207,167,2,52,182,48,64,46,39,108,
+    87,160,167,71,111,238,230,124,157,191,101,137,52,74,199,211,20,227,201,77,39,120,111,79,6,182,206,94,27,7,179,73,
+    148,234,220,191,44,14,170,99,57,107,199,189,115,85,94,59,100,255,30,126,63,203,82,50,22,116,242,210,228,124,220,166,
+    31,120,255,19,24,253,86,31,157,200,246,241,106,241,82,155,33,5,159,162,148,131,248,252,60,117,156,87,63,41,51,255,
+    64,175,194,232,51,124,182,171,208,84,150,197,150,195,61,58,228,99,73,24,222,119,12,48,172,115,193,0,172,50,33,211,
+    142,142,64,170,140,49,107,52,167,155,51,15,211,208,52,77,132,168,99,84,207,216,49,91,194,66,98,158,106,208,78,174,
+    213,67,20,130,20,65,208,185,14,245,98,121,237,74,207,133,5,254,71,255,75,68,49,193,136,203,188,150,124,144,228,194,
+    88,192,186,81,80,254,14,7,227,34,37,87,109,23,55,12,239,114,101,109,5,147,130,179,243,174,102,122,102,7,111,5,
+    248,168,174,117,108,250,22,200,240,44,82,209,49,247,219,172,228,94,147,138,185,252,193,38,122,183,106,201,25,46,101,40,
+    57,223,19,149,108,232,58,45,238,18,193,189,189,39,202,252,220,33,194,172,11,190,133,253,206,71,205,204,140,186,28,234,
+    196,75,91,197,184,227,108,106,23,122,49,101,170,213,208,103,14,98,50,127,189,42,232,246,33,58,131,170,232,145,107,148,
+    105,228,66,206,92,128,229,14,103,86,30,149,93,28,145,160,24,133,24,93,73,40,81,123,213,155,11,39,67,43,108,232,
+    164,146,29,240,29,250,30,239,160,22,184,1,215,110,103,234,68,234,66,95,119,145,230,5,119,232,109,137,224,96,60,4,
+    173,70,110,66,232,56,57,131,27,202,196,142,15,37,46,165,184,201,45,108,57,227,2,235,203,71,135,46,99,177,12,54,
+    170,210,195,104,122,92,106,234,173,196,77,9,237,139,0,236,254,222,53,84,67,43,124,194,175,153,55,69,148,199,222,233,
+    38,122,217,102,149,175,0,219,92,188,61,185,128,201,154,143,94,115,124,36,185,137,149,249,64,223,40,146,68,166,115,195,
+    115,42,90,55,214,220,102,69,220,51,75,54,66,139,100,223,203,194,113,32,28,79,162,232,140,124,36,105,233,128,89,200,
+    209,74,56,90,142,173,195,20,118,157,90,172,20,118,214,249,114,129,92,3,98,40,106,158,5,130,249,146,88,205,44,27,
+    130,88,107,212,67,101,226,112,234,247,138,191,217,201,57,111,163,87,246,112,22,222,78,15,162,114,238,165,224,184,84,126,
+    41,117,238,182,73,147,126,31,50,111,207,2,176,189,234,19,57,243,203,154,88,109,194,218,38,178,173,5,213,26,198,122,
+    100,129,155,159,198,39,89,252,77,47,76,213,187,14,254,241,49,135,68,209,68,231,198,254,48,27,85,214,45,236,255,175,
+    106,39,214,199,125,35,172,202,217,33,25,228,102,20,42,59,30,115,23,119,143,62,5,53,9,167,133,217,191,234,252,184,
+    77,126,157,213,191,131,118,84,73,44,234,70,153,95,60,117,204,166,98,74,152,255,28,122,170,52,150,4,249,10,236,187,
+    174,171,151,22,238,0,231,124,81,26,32,166,84,45,206,104,194,79,37,182,33,67,134,56,21,182,75,228,152,136,107,127,
+    60,221,194,95,13,164,17,117,24,85,140,149,185,179,66,116,161,67,61,64,186,231,49,105,16,69,223,162,129,94,74,20,
+    230,132,172,165,178,189,70,84,110,119,44,164,50,48,163,123,188,90,161,121,133,188,2,115,49,161,109,191,226,0,160,78,
+    20,44,240,5,30,113,113,193,19,62,170,187,187,208,24,195,231,13,184,48,30,23,59,251,111,4,143,192,17,110,246,148,
+    118,24,157,255,205,104,61,148,25,240,134,248,218,117,97,183,87,82,59,160,154,132,195,160,121,44,49,97,50,190,214,61,
+    97,48,234,235,50,37,136,47,53,114,215,11,177,198,225,41,175,120,190,71,221,215,118,33,28,106,160,78,193,245,10,182,
+    196,89,93,91,2,8,135,103,244,182,244,41,141,168,19,13,243,186,74,197,117,228,54,113,87,141,81,206,210,237,39,8,
+    128,56,211,158,210,117,93,18,142,55,130,246,248,70,37,36,241,146,163,163,56,101,69,144,88,228,124,209,186,213,233,169,
+    69,148,28,176,59,54,217,165,228,147,179,73,210,17,110,7,200,85,47,119,245,19,113,20,40,244,119,254,123,190,70,106,
+    117,200,125,230,206,250,144,249,104,3,114,253,180,0,141,29,179,56,25,71,253,4,134,45,81,168,161,67,111,199,32,123,
+    80,186,185,79,120,216,1,20,89,245,122,86,70,179,36,9,95,230,60,10,83,105,220,131,13,228,255,236,41,61,75,70,
+    115,204,124,16,43,81,172,180,245,97,79,36,112,18,137,235,242,14,1,121,229,2,42,219,121,135,6,254,42,17,58,119,
+    41,179,213,238,198,142,42,125,233,112,68,177,222,174,85,129,215,12,145,70,131,119,85,196,43,10,241,218,125,197,117,206,
+    40,47,126,168,159,72,90,61,158,247,236,212,29,176,92,173,137,246,183,210,174,169,82,237,26,119,193,41,100,164,164,46,
+    140,163,92,161,142,86,32,248,72,110,202,229,248,49,198,206,32,129,92,121,90,8,189,115,54,128,85,188,65,24,134,253,
+    213,14,52,224,197,173,42,242,27,146,41,151,145,169,121,198,24,134,12,83,14,176,122,213,71,22,171,30,13,244,125,220,
+    119,219,188,197,107,74,83,50,98,218,96,116,247,242,18,51,242,132,223,55,252,102,50,186,156,6,6,36,104,136,220,9,
+    130,26,182,120,135,14,25,197,158,35,145,217,41,200,27,38,233,223,158,64,59,1,75,167,157,219,57,171,121,248,112,37,
+    209,157,47,77,50,7,215,43,129,93,94,9,250,209,141,255,145,91,195,215,75,85,151,97,193,144,225,251,10,57,113,60,
+    223,140,149,248,178,132,236,243,209,13,245,191,180,237,75,116,44,49,249,163,162,214,163,245,65,16,137,98,196,160,100,152,
+    251,39,65,13,240,163,132,109,96,149,78,38,113,77,125,106,131,222,237,102,37,40,78,9,161,154,254,99,40,160,135,19,
+    134,175,232,108,133,136,172,11,246,228,162,7,21,84,86,10,248,6,112,173,42,157,219,63,119,76,109,123,252,129,187,136,
+    211,202,230,246,117,41,59,168,118,202,33,207,58,66,252,113,117,102,60,107,16,192,68,156,85,193,222,142,211,188,28,57,
+    72,87,149,38,213,255,28,183,86,178,79,30,127,200,18,191,207,184,242,163,97,247,9,220,3,119,233,172,236,53,54,17,
+    55,120,247,204,134,99,173,68,227,246,246,7,247,249,216,151,234,255,104,45,228,47,159,6,90,98,60,73,170,159,215,90,
+    103,119,62,54,158,12,160,106,64,198,164,248,252,217,121,0,194,197,187,246,217,201,36,116,152,76,55,111,29,247,63,72,
+    138,230,220,180,129,25,146,10,109,228,67,4,54,10,167,224,230,228,33,137,63,165,190,197,237,234,112,217,71,45,128,22,
+    222,214,150,79,228,251,192,75,10,88,194,3,229,139,199,105,94,25,208,6,97,132,63,127,178,185,232,220,17,179,219,190,
+    186,239,184,230,83,182,160,31,184,252,18,149,161,94,20,88,54,249,185,0,211,35,34,84,152,114,200,132,206,38,28,234,
+    43,187,179,92,178,125,221,131,232,41,12,51,106,155,98,226,28,196,167,182,188,71,187,135,159,62,147,189,62,30,84,135,
+    132,35,144,169,119,93,189,170,206,154,24,247,153,226,186,67,5,213,151,51,122,227,141,189,53,107,166,54,98,5,62,81,
+    66,17,181,153,189,184,62,103,83,99,230,128,194,224,69,28,203,183,109,84,71,140,90,201,212,60,217,120,74,12,15,228,
+    179,62,158,46,57,121,166,239,199,63,227,219,94,182,35,33,194,54,155,230,112,198,6,33,161,130,139,236,129,162,78,113,
+    2,127,193,184,143,172,241,151,82,38,205,167,49,107,70,105,171,75,43,67,87,144,68,95,168,83,126,139,206,47,32,208,
+    234,91,121,74,148,177,57,83,190,77,184,125,49,94,78,151,50,109,96,118,0,145,13,126,12,87,93,19,6,171,24,65,
+    168,103,34,250,19,100,88,60,138,72,47,55,107,219,152,39,137,102,213,252,248,238,82,111,147,173,198,248,253,66,22,53,
+    20,250,107,158,176,158,140,232,22,204,24,85,191,57,240,125,0,178,150,27,186,114,98,145,232,211,25,159,120,219,137,97,
+    194,208,169,157,76,0,200,246,33,205,221,202,78,71,237,220,219,117,197,93,74,120,32,216,109,96,92,85,88,133,112,62,
+    135,61,199,59,28,35,210,98,40,173,1,67,90,205,35,148,155,57,152,44,62,66,156,7,187,208,159,2,102,224,80,24,
+    13,127,215,139,68,207,126,178,95,129,248,159,215,55,3,123,66,134,170,106,62,55,67,142,46,226,114,203,219,133,8,61,
+    158,81,15,190,142,181,158,52,88,48,86,3,248,123,8,37,221,87,64,221,129,5,11,239,124,50,59,24,93,114,98,150,
+    111,12,175,34,199,123,222,47,100,10,187,250,193,72,220,58,29,202,25,85,200,195,40,231,56,168,141,90,232,194,230,53,
+    145,86,130,64,203,171,185,234,144,240,123,23,193,44,69,13,222,0,53,193,203,123,43,202,181,225,97,203,199,8,249,76,
+    178,233,250,240,11,233,76,222,181,253,70,235,123,130,169,16,28,191,240,51,237,98,37,80,35,15,67,95,0,94,176,91,
+    52,169,113,226,41,109,6,197,129,243,80,107,99,152,136,119,218,0,146,240,122,86,24,122,81,57,231,212,90,61,61,115,
+    80,44,238,163,166,202,92,231,56,83,227,16,9,184,88,5,227,17,31,84,106,225,148,172,83,128,184,200,136,47,174,182,
+    227,140,239,159,122,84,171,164,66,90,135,213,237,58,28,236,19,12,153,4,85,23,90,220,3,12,83,233,105,73,234,29,
+    117,233,103,180,211,99,234,117,214,141,223,187,243,122,90,76,245,103,22,84,203,46,121,104,94,12,209,115,202,155,61,49,
+    188,249,102,120,43,44,185,73,191,3,121,166,55,23,29,194,171,231,124,129,86,189,227,192,190,108,111,245,149,16,2,45,
+    235,207,8,231,200,28,190,104,149,29,35,46,166,20,62,14,37,24,41,116,58,155,22,144,118,179,121,20,127,214,17,55,
+    113,161,36,52,103,235,79,133,128,134,55,54,34,197,40,168,5,166,170,171,238,195,249,241,212,23,48,110,124,40,99,165,
+    209,5,226,227,36,78,230,68,98,3,154,232,39,209,224,121,162,143,82,143,19,157,228,106,255,95,146,23,213,160,140,230,
+    239,36,154,229,201,34,62,254,134,142,85,34,119,3,153,155,118,139,53,110,159,161,28,126,116,124,241,100,42,40,16,28,
+    233,249,114,204,82,251,27,104,250,31,193,132,155,156,105,175,251,15,212,128,53,66,213,55,144,103,240,240,3,149,235,7,
+    80,247,254,45,13,30,56,1,84,103,36,208,101,255,180,119,149,204,140,135,152,27,213,148,102,94,138,43,27,185,29,16,
+    179,210,215,65,122,99,123,20,190,85,71,94,216,157,105,113,209,127,85,25,109,150,249,14,220,236,240,213,60,78,203,103,
+    124,171,3,149,172,48,255,109,8,5,88,48,176,9,16,139,14,145,102,55,167,192,50,3,201,4,19,217,141,197,137,155,
+    26,144,125,118,166,145,165,240,187,17,32,235,247,118,129,134,112,116,97,39,196,57,157,163,161,75,247,70,143,131,147,170,
+    149,37,239,147,91,85,151,163,173,36,193,184,85,227,54,233,32,208,18,23,195,195,36,28,226,119,127,200,231,189,94,236,
+    210,220,101,197,238,224,213,208,231,195,150,86,17,149,66,10,1,219,119,93,2,94,184,226,93,14,75,205,215,148,82,114,
+    217,175,203,136,79,166,135,145,115,92,196,25,90,165,151,196,138,78,175,231,87,41,236,196,224,216,194,157,101,48,146,19,
+    225,36,24,53,165,134,67,238,30,182,200,206,4,101,69,234,138,247,251,219,173,175,249,142,138,228,184,100,66,171,14,214,
+    115,37,129,202,112,242,126,208,114,83,156,189,240,177,114,229,207,139,166,38,2,101,189,74,216,109,152,122,121,217,38,174,
+    64,61,97,99,252,177,194,227,8,122,154,40,77,9,196,247,6,124,223,104,52,51,86,9,101,50,131,36,76,136,24,100,
+    226,231,244,133,12,252,174,45,235,226,227,143,97,17,102,59,172,137,247,221,99,59,254,34,220,47,159,115,237,187,203,121,
+    69,37,216,128,142,238,118,176,38,166,225,53,51,43,214,47,174,88,165,142,113,147,36,206,232,97,235,122,40,106,64,23,
+    246,95,15,6,245,109,232,136,250,92,91,202,135,60,83,234,196,109,64,24,25,129,106,36,37,106,105,177,93,166,65,152,
+    169,116,103,174,68,87,119,33,2,96,249,161,24,48,247,50,180,144,1,1,112,194,86,249,129,200,89,158,106,229,53,250,
+    19,222,18,74,68,194,174,39,138,197,106,82,231,188,119,147,18,234,124,143,117,160,38,146,30,224,130,206,174,67,198,240,
+    113,81,122,50,189,80,40,92,115,212,204,146,142,91,234,64,109,23,202,25,155,180,5,61,129,35,64,130,205,252,94,223,
+    156,39,209,18,215,196,205,107,15,172,1,92,54,198,10,156,129,179,207,251,158,90,146,1,80,214,152,196,135,174,247,3,
+    37,4,79,70,191,34,88,22,81,138,133,94,128,3,233,202,7,52,232,21,179,75,117,197,48,230,247,196,61,92,198,131,
+    53,251,90,20,179,2,7,171,89,98,58,114,184,133,39,167,52,80,65,19,57,186,171,228,89,35,40,17,206,193,211,35,
+    238,117,180,178,128,140,63,174,207,116,240,85,171,33,78,141,0,204,174,241,112,37,215,173,11,201,210,121,130,253,161,111,
+    149,79,168,55,237,160,242,238,121,74,82,217,65,72,185,199,132,151,70,210,47,131,5,121,222,158,109,61,47,23,53,128,
+    222,232,18,254,182,150,62,112,229,26,184,90,23,223,237,133,229,9,234,171,93,190,47,199,18,214,229,225,20,159,57,150,
+    41,6,123,251,41,59,56,92,54,149,137,248,180,139,37,11,64,225,151,93,189,253,127,155,51,80,227,99,187,110,167,199,
+    191,115,112,100,71,20,61,229,45,86,13,85,51,81,32,215,150,19,73,73,48,24,167,181,55,224,240,69,150,16,214,180,
+    222,13,84,31,143,148,11,136,211,85,171,127,151,164,138,173,218,177,107,123,73,53,203,44,238,104,67,181,105,55,102,22,
+    232,127,63,144,206,163,13,218,102,5,154,26,225,96,49,109,254,129,154,217,41,118,101,235,109,14,118,130,194,55,60,216,
+    219,209,252,238,216,1,188,65,192,209,100,139,98,55,211,184,89,208,217,183,94,24,209,157,254,211,52,182,86,21,224,142,
+    62,242,51,117,185,218,59,24,234,243,33,206,200,90,152,20,17,72,108,197,119,133,23,33,17,137,142,2,236,100,11,44,
+    223,151,4,19,140,112,64,139,74,135,173,189,47,146,146,188,145,65,50,172,252,237,29,234,194,129,59,171,105,204,141,101,
+    222,192,97,202,9,123,101,188,199,141,253,238,14,78,225,100,200,134,143,202,238,129,12,41,58,229,73,86,211,9,41,127,
+    128,114,146,38,69,138,184,178,74,173,42,176,93,65,51,129,103,141,53,159,72,175,216,126,6,16,223,8,139,144,108,53,
+    37,238,124,215,40,145,155,129,41,230,190,209,176,225,12,141,84,229,190,138,170,218,206,167,145,37,254,224,38,134,75,140,
+    29,207,87,124,38,28,239,159,69,240,142,233,245,39,200,111,157,199,137,68,150,112,105,9,179,199,246,111,122,245,32,136,
+    74,115,200,151,206,117,38,19,209,101,194,146,88,221,130,112,222,22,65,77,63,16,186,15,216,251,168,160,142,21,246,216,
+    116,164,248,44,65,1,127,246,6,15,105,254,113,74,131,129,172,157,15,88,238,209,250,7,240,24,16,140,252,5,133,148,
+    186,6,24,205,171,197,137,201,40,16,119,186,133,218,188,195,83,49,98,194,33,41,13,210,136,63,20,11,161,12,239,246,
+    128,50,21,108,17,131,143,168,172,49,46,182,45,203,181,52,149,51,39,146,27,32,0,33,130,176,178,9,119,214,205,224,
+    212,194,57,190,122,170,120,217,208,117,58,162,190,205,173,159,84,106,62,143,199,114,179,161,80,127,74,11,242,106,119,125,
+    219,129,78,149,189,167,129,152,230,196,80,74,105,217,131,188,82,203,0,65,104,146,101,189,251,94,189,64,238,130,78,149,
+    231,205,32,193,17,139,40,166,88,220,9,27,182,138,64,10,159,240,11,85,62,133,24,26,72,24,31,95,36,181,205,175,
+    151,16,179,120,49,122,126,234,100,249,129,15,61,57,118,227,116,254,129,186,28,151,220,236,20,106,44,126,0,81,48,166,
+    22,126,254,108,243,205,68,74,125,42,111,62,11,49,27,229,100,81,155,64,218,218,183,10,96,67,132,147,216,177,49,89,
+    224,242,179,209,27,17,138,33,26,127,190,137,108,176,248,49,177,6,191,76,89,101,96,47,70,114,151,151,65,101,120,113,
+    94,55,27,131,225,9,171,65,47,173,246,239,5,253,163,179,213,113,146,180,40,202,72,85,64,35,9,202,12,21,180,49,
+    232,35,108,122,41,3,32,83,44,35,127,126,159,22,206,69,216,20,121,84,169,158,211,185,32,45,238,170,189,137,234,50,
+    13,14,98,95,179,19,112,40,18,47,236,115,128,212,197,112,182,10,113,138,43,26,7,107,191,12,146,218,197,222,40,62,
+    221,39,132,119,191,246,179,47,182,235,146,128,89,42,103,193,181,118,152,124,84,162,226,90,65,10,81,10,182,84,70,84,
+    183,195,84,158,169,159,210,200,116,192,122,37,235,77,229,60,101,28,0,153,88,88,7,221,17,135,222,183,224,197,16,68,
+    156,14,130,56,151,71,40,146,151,180,131,47,245,46,74,119,43,167,208,252,248,141,87,127,200,222,213,49,242,17,45,146,
+    247,13,193,54,169,246,232,81,7,155,75,134,242,162,131,114,207,9,83,203,180,199,239,218,183,106,73,30,202,145,52,221,
+    87,120,242,217,56,13,43,7,82,109,45,169,241,15,47,101,52,229,16,92,42,167,127,164,59,239,4,92,76,179,248,240,
+    251,194,181,160,183,36,34,229,33,30,239,133,177,241,220,95,52,29,133,212,99,248,171,89,63,15,207,171,145,241,130,96,
+    185,101,134,199,240,68,148,204,121,102,112,218,95,174,78,52,43,104,59,13,4,160,192,130,43,123,85,218,184,33,154,154,
+    251,89,85,42,7,245,166,103,227,79,70,240,95,22,197,12,249,21,163,88,90,152,136,204,186,27,252,166,82,27,70,79,
+    114,133,255,177,59,15,53,33,86,134,4,237,4,58,219,186,22,25,37,45,235,0,209,177,61,227,21,64,243,250,208,84,
+    170,117,115,116,188,255,81,215,179,116,27,82,240,185,213,116,39,87,88,64,101,131,77,33,150,1,163,40,75,101,199,233,
+    246,239,174,227,159,182,87,225,239,244,170,109,112,219,210,175,161,41,80,176,126,96,62,115,193,166,82,255,122,40,11,184,
+    219,223,87,105,200,42,99,75,123,0,41,73,6,166,195,64,110,7,107,49,201,70,193,112,244,7,114,52,163,69,43,254,
+    249,107,194,13,34,46,244,100,188,207,253,243,91,163,201,217,229,120,218,248,108,72,109,249,255,247,223,168,70,36,67,238,
+    102,246,159,27,172,22,119,116,98,74,39,222,188,10,71,86,217,127,123,205,34,117,0,197,214,119,178,162,49,115,142,12,
+    19,157,183,179,232,243,29,181,83,155,9,11,144,171,29,141,144,133,32,116,114,63,233,203,49,133,100,222,167,204,78,24,
+    210,18,216,13,19,81,92,19,1,173,221,207,226,230,144,124,196,239,157,204,94,132,97,241,198,255,248,46,185,43,172,247,
+    211,104,240,235,70,176,141,140,71,166,142,205,89,113,206,26,128,159,249,38,112,158,212,133,240,161,196,220,26,32,235,28,
+    19,218,243,189,69,50,52,161,31,211,232,184,32,23,9,242,24,76,99,158,231,169,224,117,154,46,5,8,140,150,140,182,
+    27,184,13,206,155,102,55,55,80,161,67,127,149,233,124,74,14,167,207,17,231,234,77,245,94,112,207,2,221,233,212,16,
+    57,244,199,86,221,178,160,14,222,225,192,90,75,207,55,55,218,232,64,129,46,21,194,89,191,171,164,100,150,214,72,208,
+    89,154,105,150,134,217,34,155,255,39,116,158,132,134,137,7,53,147,138,26,114,223,255,2,51,136,101,24,102,20,30,104,
+    231,192,249,179,132,121,150,60,146,194,96,12,53,51,60,95,146,213,117,247,164,166,177,50,84,168,55,175,169,184,238,107,
+    215,220,21,172,11,153,153,237,141,225,49,178,61,23,198,236,157,227,41,184,221,31,26,204,140,184,167,8,164,187,106,163,
+    168,224,58,176,178,162,182,46,197,194,168,180,26,144,177,61,213,101,175,173,232,83,129,136,87,97,74,27,195,46,108,188,
+    146,150,120,132,185,213,233,176,103,67,202,214,108,231,226,191,249,77,23,153,104,167,144,45,64,36,185,94,243,99,157,45,
+    114,35,33,14,46,174,76,50,105,58,3,62,188,54,169,242,173,10,27,239,126,19,31,11,163,6,44,126,127,191,208,86,
+    66,25,33,181,232,83,69,115,208,218,162,168,196,6,104,163,221,178,79,161,54,162,21,165,41,95,146,184,76,248,0,169,
+    125,70,181,43,66,95,132,5,1,16,244,119,132,237,192,132,164,211,150,20,134,84,229,226,5,138,157,211,171,102,57,86,
+    229,190,107,28,160,37,103,25,58,235,212,238,108,223,7,25,242,197,204,203,50,43,66,34,215,124,158,133,52,127,140,78,
+    107,101,36,253,124,247,61,234,69,88,201,129,25,226,144,224,83,90,60,37,23,241,187,193,120,228,42,45,237,235,110,50,
+    233,48,114,171,226,127,165,51,245,166,119,100,224,91,161,212,40,107,59,86,76,90,133,74,2,2,56,188,160,242,205,145,
+    123,17,230,98,204,147,65,98,133,13,104,4,145,194,143,47,49,211,152,198,172,251,118,171,186,0,118,190,217,20,0,241,
+    32,185,152,22,211,16,122,101,176,8,149,74,235,239,175,243,193,118,87,192,89,15,171,80,138,134,84,45,123,18,218,57,
+    183,217,135,49,243,123,222,48,131,5,0,85,150,179,84,55,67,65,71,153,73,114,91,202,68,169,207,181,143,67,93,26,
+    22,159,220,225,137,123,16,221,216,246,132,40,248,48,34,158,249,99,167,54,34,235,186,73,251,119,209,133,3,11,140,65,
+    197,216,202,140,16,34,234,114,80,9,206,180,193,216,21,76,55,146,82,188,42,22,43,43,111,193,221,23,184,91,175,9,
+    145,177,21,229,178,53,41,23,243,55,251,195,43,243,161,197,204,194,202,241,241,129,9,25,147,198,208,243,244,205,32,204,
+    156,202,209,56,92,175,22,50,198,43,253,44,173,16,215,108,116,34,17,172,234,170,90,100,110,38,220,122,60,65,202,204,
+    87,104,107,221,255,251,246,151,15,105,165,36,187,17,179,198,57,162,43,232,171,240,165,118,56,91,154,33,185,139,181,217,
+    225,90,101,108,118,40,181,123,228,66,102,0,168,68,45,107,6,3,161,74,45,61,0,9,162,4,116,170,125,1,58,72,
+    243,105,104,115,98,249,94,35,237,164,10,246,25,198,73,77,38,22,42,49,190,39,243,16,59,89,244,183,70,139,137,76,
+    45,92,126,194,161,195,4,58,224,74,113,9,70,161,3,229,228,63,17,72,90,178,0,217,235,232,224,241,124,189,178,180,
+    242,240,113,88,143,190,222,27,2,156,124,73,188,25,55,119,1,142,17,156,179,109,208,48,177,5,70,179,93,230,161,32,
+    254,86,50,183,87,150,251,87,234,230,110,13,58,77,190,203,245,13,111,31,170,216,253,205,61,230,156,110,129,129,255,108,
+    5,116,215,220,37,171,225,250,10,122,164,235,39,145,125,34,9,83,172,254,68,171,244,157,130,224,166,186,114,163,216,1,
+    112,235,152,210,123,38,194,89,103,179,174,168,197,231,194,125,165,185,170,141,205,138,128,236,96,115,186,199,194,194,192,197,
+    159,121,10,193,154,78,165,169,113,28,192,208,135,117,165,253,24,30,211,176,239,221,169,54,211,96,174,43,232,110,251,51,
+    103,254,134,115,216,87,93,172,0,236,242,236,153,168,201,160,239,92,47,35,80,235,104,195,35,40,153,213,156,45,133,253,
+    221,234,147,206,157,180,166,240,102,250,174,216,29,26,79,77,41,9,165,204,29,177,84,228,220,205,255,1,4,203,80,149,
+    220,222,249,151,95,21,84,189,29,235,146,78,91,40,235,128,229,134,136,64,229,60,217,137,47,166,33,103,147,100,31,186,
+    38,169,74,74,159,21,249,135,39,217,88,144,238,12,236,26,25,161,243,112,142,14,105,151,49,163,210,130,217,129,206,137,
+    220,242,252,126,207,70,181,2,185,129,73,234,187,86,189,0,83,167,189,167,66,172,74,192,189,83,92,91,77,21,35,173,
+    119,131,99,140,89,21,226,175,231,92,131,240,1,121,4,123,228,71,9,119,17,106,124,159,175,87,145,22,168,95,31,247,
+    129,38,149,6,53,123,145,87,156,211,228,190,70,45,183,54,25,210,102,240,191,95,237,243,198,221,59,181,239,191,236,165,
+    160,105,77,107,244,108,46,227,135,102,236,230,197,239,0,63,139,14,43,210,27,128,172,53,99,180,190,14,46,246,189,85,
+    64,231,137,31,23,19,3,77,237,66,32,129,28,22,0,108,100,97,55,238,84,9,228,8,116,96,116,60,106,169,35,56,
+    144,187,119,242,64,195,40,76,117,144,105,94,73,179,122,116,18,253,7,83,97,4,107,40,33,139,6,55,25,62,119,237,
+    84,32,26,230,63,183,207,102,220,19,203,216,187,128,15,33,220,0,202,31,159,84,115,228,84,127,39,152,13,240,62,251,
+    88,248,214,196,232,228,76,122,83,142,61,146,202,139,237,168,53,153,91,167,115,74,78,76,45,156,181,251,61,244,156,251,
+    94,70,164,254,77,74,107,165,32,124,101,174,19,10,13,244,187,204,233,41,165,5,226,245,189,208,246,185,148,91,26,2,
+    189,187,241,132,21,162,23,13,56,196,208,34,16,240,5,0,162,216,138,25,166,17,180,209,79,188,0,50,58,46,47,117,
+    199,151,210,21,249,22,100,69,250,104,204,145,239,118,109,152,114,235,225,6,119,171,224,3,111,78,236,16,201,128,175,62,
+    98,126,161,7,33,121,178,217,223,129,151,34,238,210,54,65,219,96,41,91,182,45,122,177,18,182,221,60,235,102,24,236,
+    144,22,40,188,201,197,157,225,173,5,215,241,52,223,234,248,163,12,112,163,181,59,125,157,0,43,132,16,50,234,6,37,
+    160,164,183,17,205,13,81,245,206,67,149,137,244,220,178,4,7,63,154,26,75,234,29,180,122,121,78,253,140,149,248,103,
+    160,110,123,6,139,220,108,105,145,7,37,98,7,167,71,126,70,83,76,88,228,165,85,175,69,130,253,27,240,174,39,30,
+    25,233,8,244,145,106,25,208,200,247,3,54,177,70,160,200,240,100,145,134,247,81,187,88,227,129,84,65,195,62,139,80,
+    159,229,61,76,223,250,242,105,115,50,205,166,180,219,75,102,47,129,186,207,159,234,72,48,145,149,92,167,45,122,155,50,
+    94,78,210,253,0,36,175,5,133,176,234,253,194,29,125,196,202,181,252,243,200,101,160,111,255,60,200,145,250,192,14,221,
+    252,47,255,59,82,219,236,51,203,38,234,219,153,102,155,7,238,43,236,201,238,234,90,2,122,71,5,119,38,184,235,153,
+    110,186,126,14,94,234,71,156,220,177,34,214,10,231,155,200,20,91,51,229,240,3,61,68,61,181,154,210,224,14,47,248,
+    59,194,143,222,111,194,191,102,114,60,124,176,32,109,0,67,91,188,232,77,40,111,4,91,249,188,110,254,51,164,162,87,
+    152,253,96,50,23,214,158,72,247,125,116,237,9,54,188,39,152,2,230,139,67,199,73,28,58,241,231,179,75,194,217,79,
+    43,254,0,98,143,255,215,72,227,111,235,61,142,119,103,115,220,166,26,176,94,136,204,139,178,153,127,65,153,111,36,138,
+    25,131,232,58,70,245,57,142,11,12,141,226,64,164,234,225,169,30,216,164,155,72,63,236,17,26,215,31,91,108,164,53,
+    228,196,251,77,28,81,0,84,231,235,50,120,228,81,207,212,192,14,74,77,44,81,225,79,58,243,193,210,135,13,211,243,
+    15,23,159,118,29,17,145,78,9,0,42,79,48,78,198,47,136,236,201,46,135,82,104,0,6,234,48,255,129,9,235,83,
+    168,247,237,150,97,5,109,171,121,109,243,73,10,160,194,134,166,173,185,80,18,127,66,234,100,53,170,200,171,82,231,183,
+    106,203,116,211,161,46,80,57,107,136,197,69,177,20,40,205,131,184,206,87,228,112,23,247,215,168,172,58,231,201,196,101,
+    180,233,145,126,200,89,82,108,165,214,254,38,192,95,41,46,211,35,56,254,72,234,45,50,184,91,24,105,144,42,134,195,
+    16,41,11,177,166,33,89,226,163,181,107,106,113,59,147,150,142,42,77,117,24,142,120,236,44,24,187,29,2,126,26,76,
+    172,199,227,152,19,167,89,39,37,162,254,28,93,118,134,1,34,173,125,223,49,219,228,242,253,115,248,251,227,118,112,15,
+    249,216,208,20,24,98,142,10,52,57,108,254,16,236,102,208,229,58,142,253,241,228,170,143,42,83,224,113,217,172,172,145,
+    190,145,229,241,181,62,5,139,73,183,249,193,237,47,48,201,82,182,179,185,233,117,72,164,161,176,201,243,160,113,78,200,
+    209,177,214,36,254,21,163,126,241,95,120,48,232,15,37,113,34,134,128,224,161,213,208,100,168,57,99,78,129,214,247,75,
+    176,38,85,92,168,22,62,76,152,192,148,65,121,46,11,59,79,174,191,58,86,205,158,224,193,197,59,123,184,100,149,99,
+    211,197,179,241,236,132,186,237,187,123,168,137,240,184,108,59,57,185,229,249,178,141,164,56,212,186,121,114,56,204,104,61,
+    160,82,136,14,10,231,20,113,129,123,46,79,65,56,251,230,170,115,168,109,208,237,26,96,82,107,89,62,101,59,209,60,
+    82,126,112,49,213,47,156,130,76,111,27,88,213,147,153,44,16,239,154,228,28,104,158,55,78,122,132,239,210,109,55,232,
+    82,101,220,157,181,100,115,251,78,180,204,64,169,134,120,208,107,161,86,47,159,223,55,212,221,40,125,82,26,47,81,68,
+    169,128,199,241,207,16,125,160,40,105,59,134,39,79,194,248,40,113,171,43,108,91,84,70,253,179,141,29,42,53,200,172,
+    77,64,137,141,64,63,96,170,101,84,233,236,7,12,101,93,44,119,121,31,190,210,243,80,188,160,237,180,181,170,113,248,
+    176,216,81,251,58,107,86,125,244,221,77,43,180,38,205,30,252,182,15,39,23,156,80,215,246,184,134,212,57,112,82,63,
+    68,183,178,198,244,137,241,73,229,79,194,18,27,184,226,144,74,98,40,164,98,67,136,0,197,48,176,12,215,179,190,105,
+    203,88,4,45,254,199,87,135,129,65,137,251,185,68,184,246,137,221,220,44,238,253,233,185,254,177,202,214,203,97,196,171,
+    246,9,213,4,229,253,157,147,238,8,119,216,248,216,93,149,8,45,172,176,59,160,125,140,27,48,176,190,112,203,84,148,
+    174,146,182,0,123,79,134,15,176,160,157,210,254,107,89,138,127,104,158,11,226,177,120,129,58,246,99,52,75,103,247,221,
+    141,150,39,161,26,85,249,247,254,166,188,99,139,180,70,80,5,144,174,79,127,124,246,115,14,154,184,72,96,84,89,85,
+    35,232,237,194,70,77,191,13,255,251,8,252,175,125,176,83,230,97,158,248,91,173,91,10,184,231,75,78,208,242,81,129,
+    147,140,33,69,170,45,234,166,154,11,0,249,143,35,123,196,35,138,18,252,60,117,249,100,157,205,129,108,175,239,107,109,
+    74,73,227,4,31,241,210,122,179,68,28,24,198,195,163,125,38,191,50,178,163,211,172,242,1,49,202,92,240,191,248,223,
+    192,47,192,228,248,177,12,249,201,40,203,24,196,39,10,194,233,16,83,146,231,91,67,127,126,133,16,112,128,53,114,87,
+    49,191,179,223,238,250,254,148,204,106,248,84,28,241,238,248,31,85,232,92,54,233,184,139,92,83,192,115,158,222,137,174,
+    88,78,168,8,45,220,122,237,52,127,242,213,229,131,242,213,91,206,114,174,59,184,63,210,156,239,229,142,61,249,59,5,
+    203,15,215,133,190,58,27,129,156,17,179,26,182,147,138,30,254,40,252,88,113,166,18,188,63,227,113,186,68,172,39,161,
+    131,153,112,221,100,42,74,160,232,234,253,227,237,159,102,16,65,248,105,130,84,63,227,193,162,158,109,159,246,230,37,152,
+    87,74,182,223,235,6,129,129,185,186,215,111,182,124,39,224,169,12,254,145,166,179,79,239,29,21,72,160,138,156,81,200,
+    246,199,231,64,88,216,154,203,236,114,68,192,234,33,48,16,201,210,54,247,145,32,23,195,218,69,64,83,242,158,26,206,
+    140,3,151,107,11,203,113,146,135,224,41,95,10,234,90,10,129,238,255,45,50,207,249,61,21,140,21,97,56,98,99,160,
+    95,155,24,159,54,237,192,146,119,172,31,133,111,2,141,176,118,83,82,82,55,127,32,130,152,86,120,206,171,43,251,90,
+    131,240,203,31,193,102,231,160,140,177,198,83,113,32,180,238,121,246,218,87,112,118,146,230,104,241,254,98,8,160,250,4,
+    15,57,88,167,222,185,152,105,17,221,66,173,222,144,10,144,80,209,209,175,227,203,232,24,21,33,212,183,242,5,103,232,
+    179,104,58,82,237,206,66,193,164,160,59,67,190,251,137,193,135,35,72,99,9,110,10,175,60,159,40,192,105,203,51,204,
+    30,160,40,212,230,116,50,217,189,162,91,147,253,158,125,148,225,148,100,213,51,102,97,110,236,161,254,234,30,233,240,241,
+    8,178,208,6,183,88,234,251,181,160,109,51,102,75,101,241,46,70,173,169,125,117,213,163,254,88,140,57,202,99,135,216,
+    203,123,237,234,7,108,222,148,77,168,242,222,24,83,232,90,79,187,128,40,77,203,15,14,173,95,142,236,167,17,42,167,
+    167,77,157,177,92,250,213,16,169,154,113,243,138,171,40,134,80,178,131,180,171,72,251,65,130,51,175,64,108,160,216,20,
+    109,43,91,76,114,112,37,79,92,50,146,80,125,119,89,78,104,175,175,52,237,253,198,228,90,173,122,254,166,163,185,48,
+    49,192,190,233,46,165,169,62,53,63,58,6,54,70,75,10,196,200,178,136,187,57,63,8,161,4,36,241,8,183,251,198,
+    217,177,57,244,29,74,243,10,167,121,169,13,15,140,162,13,143,112,178,107,30,130,241,239,169,121,97,58,20,142,101,76,
+    225,115,71,233,22,196,92,132,143,47,68,253,212,181,253,131,216,84,54,221,218,57,251,152,6,37,51,237,198,186,253,193,
+    88,106,143,171,250,200,93,234,86,177,4,56,35,152,118,92,83,161,194,94,4,9,160,29,201,174,116,144,119,175,40,230,
+    169,144,116,183,37,46,56,234,34,99,99,178,16,41,90,119,45,100,82,224,192,83,159,41,247,191,148,137,196,22,89,166,
+    42,89,121,14,193,59,170,72,70,118,200,88,22,14,145,65,71,103,213,84,232,235,55,22,89,119,51,130,217,176,240,179,
+    62,223,116,126,136,130,251,247,5,68,11,54,50,109,55,234,146,133,135,161,156,154,102,129,145,151,255,23,2,144,184,59,
+    169,95,10,104,223,114,139,75,142,238,193,215,215,202,193,3,161,92,92,47,227,217,130,3,142,73,73,114,62,92,111,6,
+    108,94,197,247,122,118,138,210,98,226,198,141,246,207,147,248,221,146,150,242,212,77,126,65,235,32,144,104,55,147,84,166,
+    67,219,54,191,214,137,156,198,71,203,113,100,192,152,53,136,72,196,113,30,179,104,87,154,1,24,228,208,48,93,78,133,
+    170,85,235,200,245,247,2,221,113,103,134,211,31,153,198,182,11,93,239,70,65,239,31,103,63,128,127,60,7,96,249,210,
+    79,131,179,175,218,254,124,217,250,181,47,35,203,58,121,205,176,104,214,184,137,13,192,5,93,159,45,125,99,120,167,148,
+    93,182,14,237,96,221,43,191,187,246,180,106,89,115,29,176,33,169,171,180,88,233,125,170,74,117,132,95,157,56,141,132,
+    170,108,106,11,179,23,210,62,75,142,188,181,42,168,164,85,236,232,162,109,134,89,86,81,16,170,152,102,155,120,92,90,
+    157,33,48,24,188,50,164,109,92,55,87,176,212,210,246,244,60,196,68,250,184,243,234,250,14,175,63,124,249,238,208,6,
+    146,127,255,32,177,37,236,155,125,123,131,237,46,17,90,63,120,111,89,93,204,109,27,136,111,11,73,216,139,79,22,126,
+    110,255,140,72,37,230,30,135,49,39,235,231,214,179,157,223,1,107,250,60,203,75,82,30,182,76,200,180,128,247,83,62,
+    50,102,246,23,223,168,132,235,124,190,175,27,68,113,127,3,15,93,33,199,94,175,240,137,146,100,210,35,77,117,36,136,
+    200,27,198,142,142,238,16,58,186,112,216,199,111,181,193,23,136,145,245,69,120,233,32,183,6,0,4,125,197,218,175,19,
+    30,26,118,24,120,253,25,73,227,102,47,93,165,95,238,91,229,114,35,77,225,227,77,71,222,191,162,4,150,58,242,13,
+    178,183,65,145,199,115,200,41,74,223,226,154,207,211,39,249,5,214,249,0,251,105,33,236,84,1,64,213,250,216,99,55,
+    241,211,217,209,131,236,251,34,242,115,42,46,30,250,147,36,234,105,221,119,253,57,76,86,136,8,55,62,247,62,192,109,
+    87,185,38,61,23,23,122,39,140,217,123,224,240,1,123,92,68,243,155,30,8,191,32,15,185,244,25,121,121,3,34,144,
+    235,70,99,213,183,5,190,21,115,187,115,12,26,144,30,233,78,204,93,44,106,91,151,5,192,210,43,54,208,127,72,128,
+    141,253,211,86,30,195,22,165,13,124,196,10,23,175,114,142,215,90,241,164,166,82,81,135,208,193,128,65,171,219,221,249,
+    14,20,136,132,165,108,208,189,103,23,53,86,48,104,48,155,104,127,68,25,58,0,101,209,73,70,34,82,253,254,71,76,
+    192,70,97,174,142,244,131,197,187,2,63,87,8,227,246,232,244,160,87,24,191,139,159,166,94,111,157,231,137,198,141,68,
+    128,131,150,35,127,8,106,222,158,155,87,10,185,117,140,63,78,161,161,178,185,12,173,51,250,185,166,120,101,28,254,202,
+    77,210,184,238,169,98,190,64,177,28,190,117,212,72,7,162,106,172,120,54,122,95,178,244,208,28,128,39,116,216,85,216,
+    204,103,230,244,30,110,7,149,120,150,129,195,3,84,38,158,209,94,0,24,89,46,125,12,208,18,232,118,86,91,75,85,
+    167,237,45,32,153,69,171,61,158,237,246,149,155,98,160,190,179,10,177,115,215,191,132,234,188,140,160,89,120,117,142,39,
+    122,171,108,87,100,191,69,238,102,37,240,87,214,65,14,42,103,45,104,157,152,82,4,26,54,138,104,241,39,235,157,16,
+    166,8,134,116,193,144,135,39,160,31,127,75,211,88,71,9,178,35,107,148,177,157,112,79,6,49,237,122,176,188,156,75,
+    174,14,24,219,163,115,123,8,232,124,163,57,152,62,141,211,183,127,162,205,14,174,192,67,84,122,153,32,196,244,115,11,
+    88,116,166,106,172,106,91,146,144,73,52,197,164,219,89,141,97,156,199,70,169,94,12,60,3,48,37,57,252,80,182,39,
+    145,230,155,119,67,247,236,39,71,87,83,160,72,142,10,3,197,160,86,181,14,123,11,34,19,216,0,116,99,107,28,17,
+    21,21,114,139,8,2,29,132,226,32,85,32,70,115,194,238,13,144,85,245,9,220,17,25,35,144,251,242,67,17,90,7,
+    43,75,56,76,218,254,56,61,117,51,125,188,212,241,81,243,74,46,114,168,228,132,57,29,105,46,118,186,206,171,64,249,
+    155,36,9,243,142,206,146,254,132,95,159,116,47,82,123,254,124,89,222,180,39,64,55,180,134,119,248,215,187,163,174,169,
+    49,217,21,182,63,17,204,169,134,110,183,138,248,59,135,7,164,85,74,241,100,60,227,48,42,219,90,173,218,175,170,222,
+    153,213,144,169,112,238,218,225,150,220,144,101,158,190,43,189,144,218,205,241,156,40,37,196,134,216,151,214,28,92,207,127,
+    83,17,56,61,31,47,42,203,65,20,49,38,39,75,179,215,11,168,192,149,185,55,226,210,9,30,99,31,63,197,198,219,
+    137,168,92,75,56,70,172,234,142,186,4,41,30,39,133,64,56,140,239,81,92,12,206,13,56,152,196,111,37,109,153,10,
+    225,118,183,166,211,16,86,214,164,109,36,235,67,237,113,120,246,252,217,116,90,11,9,122,178,245,74,163,131,117,120,124,
+    177,112,0,255,240,169,95,167,163,245,123,183,237,123,215,15,82,113,104,176,78,108,78,148,217,233,107,199,239,146,152,61,
+    93,151,151,86,58,177,146,56,80,148,70,232,196,31,139,84,4,73,53,38,245,7,229,147,0,94,107,216,140,91,231,111,
+    188,72,52,218,135,13,144,89,56,89,79,61,137,96,84,111,6,78,66,98,175,252,7,29,7,167,95,183,79,230,10,22,
+    233,46,190,176,174,221,194,85,229,32,184,15,127,133,99,229,65,41,80,126,123,200,250,137,113,109,189,195,60,234,129,63,
+    131,155,158,149,102,19,137,8,50,55,184,201,97,164,9,136,22,63,248,238,206,96,99,172,123,119,235,58,108,228,181,237,
+    89,70,242,172,107,162,195,25,32,96,77,205,195,85,45,141,83,248,39,230,161,184,142,211,111,112,215,233,144,207,126,59,
+    67,71,212,139,120,164,124,69,174,114,102,167,197,156,179,189,238,40,123,172,249,143,106,56,222,244,7,190,119,158,97,75,
+    71,77,255,138,35,173,246,120,71,99,169,196,162,11,239,248,187,223,245,146,209,212,66,243,215,235,230,78,215,73,30,70,
+    21,137,254,65,212,97,131,96,9,2,87,149,130,205,113,38,240,166,250,23,218,222,0,33,27,161,74,179,98,60,241,98,
+    169,172,212,22,101,104,153,102,224,191,33,52,240,71,26,141,64,228,159,254,214,211,83,103,202,162,132,109,164,64,255,185,
+    135,1,29,60,123,134,74,129,85,170,183,23,232,62,37,132,173,247,100,234,182,149,179,136,128,215,13,154,19,156,51,216,
+    143,189,97,162,31,195,214,218,121,218,109,44,58,107,19,226,112,212,115,254,124,93,193,5,231,169,170,157,211,220,107,38,
+    70,204,205,141,37,173,23,177,11,118,71,126,214,80,150,253,221,199,69,180,184,168,153,54,10,138,79,120,1,229,233,194,
+    28,242,54,207,201,143,218,95,17,241,93,18,32,86,102,194,105,160,96,99,41,23,74,113,89,65,34,28,36,24,202,87,
+    198,86,100,156,24,25,37,86,194,47,225,56,153,45,151,88,44,21,80,0,65,107,66,230,236,189,131,235,147,61,77,69,
+    73,184,146,209,164,66,45,34,91,190,69,14,104,236,21,47,143,178,165,118,96,97,240,194,210,181,172,176,184,176,97,68,
+    76,199,29,3,191,154,92,53,182,13,145,110,102,180,221,83,172,179,65,46,116,93,126,35,175,31,159,208,122,202,224,240,
+    162,23,135,6,110,21,27,177,166,229,1,85,85,103,89,181,125,1,18,200,252,90,159,36,206,110,151,197,106,144,222,37,
+    54,175,44,230,185,177,85,202,169,232,233,158,141,116,248,82,147,223,186,182,202,144,46,167,93,186,181,176,1,36,167,105,
+    86,181,113,218,210,222,248,75,84,190,246,32,42,184,61,127,83,34,242,150,34,162,206,232,117,46,140,176,147,233,2,10,
+    175,217,222,239,237,191,54,119,250,235,130,177,146,190,191,120,39,230,185,233,228,222,96,53,5,205,43,48,246,229,181,14,
+    99,49,28,18,96,216,192,18,225,175,188,53,149,73,193,245,87,48,221,204,180,172,162,233,110,94,216,7,26,146,209,97,
+    70,74,132,248,153,232,145,101,35,238,89,49,131,204,215,143,110,151,154,187,242,31,109,62,178,114,81,240,194,192,137,154,
+    182,101,60,137,176,161,198,143,9,18,5,92,216,77,139,198,22,203,213,95,57,120,195,2,233,244,26,173,55,200,5,41,
+    224,132,195,132,77,231,73,22,14,132,90,63,255,19,24,22,160,77,253,231,242,187,172,165,42,156,101,44,7,126,141,6,
+    250,85,49,87,78,112,129,92,228,43,86,69,220,175,228,252,3,254,85,134,107,204,14,199,199,137,71,187,32,94,105,241,
+    15,246,196,124,165,33,74,251,82,121,206,176,51,182,155,249,77,103,24,190,214,42,124,236,135,101,24,116,207,211,33,166,
+    246,27,197,46,177,238,199,39,238,195,13,33,34,24,83,45,13,0,166,47,42,100,170,140,60,218,180,242,204,110,32,46,
+    5,12,190,11,27,2,75,236,20,199,200,235,199,164,120,81,157,214,29,195,104,97,164,161,158,166,150,163,96,24,52,141,
+    4,157,52,124,23,42,166,129,28,61,96,103,28,161,219,41,200,106,69,191,248,140,189,114,13,219,252,108,30,219,40,246,
+    203,121,92,133,51,14,38,13,33,86,29,47,6,0,55,1,218,127,118,131,89,51,149,224,12,45,216,100,46,236,180,206,
+    235,126,186,97,194,206,206,114,236,107,181,233,22,43,96,233,92,191,177,204,13,203,138,174,166,118,197,2,109,212,158,232,
+    145,30,182,33,97,103,108,168,93,25,169,38,86,181,212,42,50,204,152,143,255,124,70,37,209,238,123,198,40,105,108,61,
+    157,208,133,87,0,71,52,34,162,58,99,195,235,42,90,80,191,60,150,167,187,133,34,3,109,74,205,22,175,89,235,28,
+    195,74,36,0,172,242,85,91,47,65,160,24,168,209,158,107,45,184,62,176,161,71,32,77,81,87,161,101,221,107,178,64,
+    43,87,142,250,208,51,97,197,32,177,166,208,120,247,182,84,230,40,77,116,32,154,237,237,153,60,76,29,247,41,198,60,
+    135,93,234,209,227,251,94,18,55,33,184,9,210,112,10,170,23,74,33,206,241,250,74,239,9,56,169,102,213,92,209,124,
+    161,123,2,186,60,227,216,26,87,73,75,221,51,84,253,12,81,232,58,234,35,83,148,114,75,112,13,215,155,120,117,191,
+    242,76,26,110,221,89,8,130,200,133,160,76,129,155,251,163,205,151,191,64,228,187,98,191,219,136,200,167,60,163,84,179,
+    207,240,199,189,184,53,195,40,202,100,176,206,195,88,143,66,184,206,79,201,205,49,79,56,38,214,45,134,140,211,105,178,
+    9,28,227,249,193,72,79,149,170,29,231,53,45,9,190,53,102,71,56,182,126,41,82,154,30,171,253,7,107,50,31,242,
+    249,72,83,100,255,243,94,237,20,157,113,109,201,42,26,235,21,1,118,125,35,21,166,135,179,4,108,13,41,140,70,132,
+    245,162,117,7,106,149,93,143,87,129,191,8,192,15,85,119,158,25,152,245,172,189,44,169,90,142,167,160,174,32,98,105,
+    221,151,246,177,156,254,1,223,142,174,117,115,45,128,49,81,61,249,52,145,179,54,92,86,222,169,200,67,217,83,57,77,
+    52,246,48,58,155,11,130,240,84,131,129,32,39,51,104,251,95,141,155,43,23,245,230,127,234,199,17,191,179,237,217,180,
+    22,251,54,13,88,13,99,204,225,254,123,110,163,237,94,170,255,56,129,38,34,108,86,238,193,35,41,215,182,197,153,168,
+    26,71,125,153,24,147,61,160,57,23,248,61,155,110,56,1,149,1,162,168,94,88,130,10,165,177,182,123,215,198,132,27,
+    84,187,128,214,151,64,235,25,130,14,59,234,225,90,237,9,82,103,44,239,231,226,141,12,188,100,19,206,181,17,27,197,
+    209,46,17,184,134,28,175,165,179,181,151,124,216,11,37,32,167,13,28,119,111,190,202,67,117,65,250,213,127,178,221,239,
+    126,78,241,34,101,149,206,230,179,74,53,87,89,30,97,167,8,207,16,128,113,146,128,252,4,25,137,23,229,88,131,220,
+    53,49,110,159,114,170,205,108,153,215,249,155,189,8,162,38,188,238,47,206,116,200,169,45,205,154,191,173,108,251,25,101,
+    196,144,233,44,19,15,105,247,198,100,99,221,51,66,242,148,196,197,193,206,183,97,217,69,210,31,167,248,154,184,192,227,
+    220,22,130,121,157,230,28,53,248,201,231,185,255,135,45,113,144,217,175,236,161,103,57,53,124,78,121,253,147,116,83,250,
+    125,84,100,191,139,81,176,19,114,185,57,230,123,50,174,216,97,217,161,147,51,247,196,110,35,51,185,76,4,185,70,160,
+    240,110,162,195,59,147,188,165,143,78,148,126,253,126,47,139,40,229,146,0,226,16,108,219,0,122,149,18,219,226,238,107,
+    237,127,61,119,196,108,234,134,28,22,120,119,171,145,227,246,249,246,249,245,119,114,160,95,229,240,13,74,199,103,28,199,
+    63,206,222,90,66,84,88,1,249,244,81,147,9,146,241,130,113,195,102,226,184,248,175,130,96,10,231,144,164,206,181,196,
+    244,90,132,255,237,115,16,80,235,39,11,195,12,2,56,190,43,142,2,211,125,213,91,197,1,195,65,124,51,153,174,72,
+    90,231,172,6,150,228,240,105,92,45,236,73,177,46,8,45,69,135,215,73,44,196,209,85,241,34,214,91,97,201,66,220,
+    242,9,3,59,164,45,87,205,249,74,113,110,126,234,82,190,135,202,224,64,140,89,83,26,176,213,132,164,194,139,45,153,
+    177,198,237,22,218,135,206,186,6,194,110,10,158,125,59,150,124,218,5,25,31,131,62,57,76,55,114,6,215,152,95,59,
+    78,36,108,99,62,74,235,158,6,60,96,170,253,172,65,151,160,59,217,146,233,113,14,89,137,84,170,100,40,201,108,65,
+    170,96,170,166,113,240,98,241,56,36,3,97,191,34,69,96,77,89,116,117,80,163,30,33,81,32,112,247,107,23,127,226,
+    26,75,21,252,152,94,230,250,96,116,75,158,130,80,70,173,116,118,97,236,137,63,37,168,191,116,101,37,144,206,169,226,
+    209,16,5,227,137,11,233,219,254,199,4,175,95,194,61,221,119,197,148,64,40,50,76,95,52,215,23,144,17,71,124,86,
+    146,225,21,125,208,220,133,83,130,174,64,248,163,69,218,195,141,155,214,116,52,248,133,31,92,146,208,196,64,248,177,138,
+    192,184,53,41,45,1,130,67,91,32,181,193,176,239,200,69,17,188,28,250,63,60,155,135,4,185,114,198,194,101,13,193,
+    86,33,157,35,220,88,86,133,237,18,65,108,106,237,157,90,151,12,90,204,97,117,187,82,156,253,151,179,45,234,199,30,
+    41,39,227,83,107,48,153,6,45,55,154,28,104,190,234,27,180,54,34,222,246,160,104,226,182,32,177,188,206,91,111,8,
+    202,94,25,195,55,118,227,4,45,72,6,169,126,115,230,94,55,80,28,213,189,152,200,175,154,77,253,107,216,19,2,123,
+    156,137,108,6,11,74,152,28,155,154,102,17,209,86,10,227,27,154,219,208,18,104,2,80,115,154,86,173,1,174,40,120,
+    50,184,69,214,165,42,164,240,40,163,76,204,136,254,237,68,28,112,87,203,137,135,222,48,21,123,194,170,63,96,230,188,
+    1,160,96,176,43,111,165,175,0,3,124,102,144,50,222,158,29,48,52,171,179,179,242,122,115,4,101,110,150,9,42,129,
+    248,5,93,161,142,58,35,12,86,0,67,54,144,210,231,181,43,181,122,73,37,145,2,1,133,22,119,80,179,88,15,15,
+    140,121,149,180,135,242,237,235,242,51,200,68,152,219,69,171,98,139,177,136,107,217,44,53,26,136,231,188,110,185,83,103,
+    155,207,35,93,80,229,237,100,246,206,58,128,24,159,190,234,210,162,10,72,21,44,237,47,214,249,254,52,158,113,99,37,
+    144,253,43,237,223,208,154,250,141,228,29,26,29,137,211,113,197,143,17,220,29,184,219,112,223,206,10,183,142,237,223,162,
+    69,26,120,126,93,71,235,191,75,42,28,229,144,66,216,226,214,37,158,246,134,121,130,93,177,140,157,255,1,113,255,34,
+    155,69,151,233,134,134,125,42,146,15,121,46,189,77,120,131,144,17,170,226,18,116,152,47,55,23,163,47,220,127,37,34,
+    51,7,11,51,138,137,182,221,37,99,26,234,53,165,191,215,8,38,183,129,43,150,238,231,30,37,28,164,142,128,170,115,
+    211,60,96,53,131,130,68,54,126,98,19,102,192,243,150,236,238,126,199,71,117,181,83,35,181,165,214,76,91,126,196,146,
+    173,233,219,80,105,50,110,153,240,77,96,43,162,179,100,178,5,79,58,150,113,43,135,242,11,16,184,7,240,83,138,191,
+    49,67,192,35,105,174,127,164,217,159,220,245,123,83,223,120,120,54,250,107,212,133,97,47,115,56,62,28,2,129,61,104,
+    194,158,13,165,4,31,18,98,69,100,67,222,217,154,242,13,206,202,240,57,35,16,180,203,245,180,38,252,177,202,6,31,
+    240,164,217,196,240,155,153,16,134,98,244,101,225,173,152,60,171,127,161,203,145,229,90,135,71,125,121,231,11,185,8,102,
+    188,81,184,243,227,250,193,103,111,82,215,186,102,12,194,134,188,171,37,225,246,46,77,77,249,97,160,208,177,193,45,230,
+    151,224,168,148,87,61,29,7,70,239,137,162,233,120,91,211,169,68,71,75,232,91,246,140,171,87,171,199,197,11,148,229,
+    42,56,48,147,142,127,62,236,40,19,156,89,140,213,94,244,214,216,12,158,10,228,95,105,200,169,24,153,14,173,197,156,
+    48,199,195,84,90,98,223,83,204,180,101,21,70,149,254,134,42,15,65,66,86,102,6,57,114,10,236,127,17,129,170,116,
+    5,227,254,124,24,226,74,99,56,142,169,237,105,36,46,161,28,224,160,196,0,71,16,177,15,205,77,103,155,72,158,67,
+    79,109,199,10,202,203,228,81,251,164,229,132,55,61,157,85,243,161,91,51,113,30,10,0,84,113,229,234,245,82,196,191,
+    80,130,235,15,219,11,140,13,254,241,101,187,192,60,47,47,252,81,236,95,190,14,161,137,66,173,157,118,46,69,211,105,
+    77,162,182,18,113,88,253,202,55,154,108,255,140,183,204,132,22,37,221,104,2,122,249,140,30,34,50,11,157,94,214,223,
+    162,48,52,24,45,95,203,150,121,46,90,161,238,163,159,81,190,220,68,169,36,161,136,147,82,157,98,191,52,68,4,93,
+    136,127,24,102,83,236,54,26,64,8,113,179,176,134,53,133,77,98,72,16,126,156,207,89,221,104,66,221,104,93,59,45,
+    201,151,2,248,96,172,18,114,2,191,221,233,115,102,153,126,159,52,49,82,50,95,111,139,90,23,168,32,9,92,85,174,
+    49,12,22,59,62,18,140,67,85,30,1,99,216,177,80,15,169,11,9,55,92,247,0,124,36,212,26,140,78,211,177,226,
+    246,73,31,58,69,170,246,212,148,38,179,239,70,159,7,66,121,162,141,17,158,92,29,75,238,139,34,36,168,28,207,138,
+    123,254,238,32,88,14,139,241,215,190,17,224,15,21,104,172,126,230,233,58,22,224,57,169,126,42,96,196,199,87,31,96,
+    57,53,181,177,54,104,9,213,53,59,18,113,60,26,53,238,154,96,229,65,32,224,173,172,88,22,149,127,13,127,40,164,
+    63,49,115,131,15,205,238,241,236,51,149,3,99,35,89,4,167,234,89,24,36,248,95,39,242,120,227,120,62,205,167,35,
+    245,106,231,241,127,198,183,41,65,236,251,100,192,248,224,164,182,135,226,99,125,12,112,83,162,129,176,248,191,32,235,50,
+    224,79,218,39,20,171,10,187,170,135,108,246,207,108,127,115,184,254,200,215,217,80,118,76,187,185,125,224,8,181,125,124,
+    123,162,85,101,12,11,133,252,234,84,118,200,251,145,160,237,228,91,97,205,198,41,222,86,239,125,53,137,127,157,223,174,
+    181,123,20,215,107,104,38,20,2,21,14,217,163,118,234,228,201,95,50,7,44,84,188,138,125,131,11,98,151,106,174,34,
+    119,132,52,125,177,201,184,233,113,17,71,16,217,218,207,132,57,183,216,121,133,200,27,204,65,180,220,191,44,255,253,214,
+    114,108,216,155,144,221,165,64,116,31,237,115,143,246,0,72,25,159,101,101,199,100,38,66,212,158,190,119,131,11,126,105,
+    122,85,97,164,72,198,163,179,250,73,144,79,17,16,169,189,243,136,230,226,80,92,128,98,210,139,255,222,160,254,123,165,
+    128,53,230,10,169,105,172,54,135,90,11,195,252,153,156,228,38,247,28,22,25,4,229,123,51,242,97,123,26,60,115,195,
+    115,94,181,43,133,67,217,102,143,25,154,99,54,181,221,52,171,150,79,244,11,8,185,126,5,102,84,241,96,235,46,85,
+    198,200,1,97,152,145,144,19,155,86,123,61,175,76,129,28,174,32,178,236,12,76,141,111,163,45,132,206,224,101,29,189,
+    221,68,173,73,254,148,0,181,89,96,170,139,143,5,210,104,76,97,161,140,28,73,53,110,209,38,124,227,126,92,60,94,
+    137,56,14,59,154,146,70,30,117,14,112,54,58,119,172,136,225,112,241,47,74,127,69,143,254,200,253,230,81,126,145,209,
+    241,237,112,37,76,90,103,152,221,101,223,72,178,180,135,152,70,61,29,229,237,70,251,191,174,23,129,165,194,125,196,170,
+    226,181,236,29,207,21,236,100,133,120,230,0,162,241,248,112,247,213,235,186,210,250,230,32,241,206,29,29,1,194,237,28,
+    65,124,16,123,101,231,140,65,25,101,5,135,98,164,214,91,69,116,251,37,42,114,214,211,10,190,127,184,98,49,165,214,
+    170,104,48,39,178,138,72,104,86,99,161,10,107,118,95,151,149,172,224,179,150,220,194,47,234,228,190,233,158,133,123,33,
+    116,234,92,134,231,99,217,175,75,175,71,83,106,72,184,17,233,170,230,11,232,19,219,113,40,87,224,26,163,220,104,175,
+    95,219,163,135,39,187,93,198,186,206,99,117,213,79,71,148,23,64,137,103,208,13,156,239,41,41,67,80,86,62,176,230,
+    54,105,183,198,66,52,157,222,248,233,46,158,134,198,206,14,212,200,159,69,141,91,19,157,197,250,60,79,141,152,220,14,
+    79,251,28,1,158,66,253,213,80,11,109,210,58,164,2,209,176,183,75,134,214,77,196,81,72,130,157,42,217,49,58,180,
+    29,157,12,12,121,211,193,179,53,226,161,43,98,54,251,104,16,236,164,220,121,254,32,171,80,155,210,15,28,178,121,200,
+    244,174,14,32,102,202,122,220,252,242,148,40,60,198,38,10,94,247,235,217,39,42,52,166,93,239,229,201,242,219,1,7,
+    252,159,226,241,181,61,140,22,220,116,249,251,11,120,200,183,247,154,96,151,50,137,135,253,58,79,184,5,162,16,254,208,
+    252,168,21,231,100,84,107,221,112,91,193,187,255,136,247,142,98,195,123,255,50,155,202,146,121,221,127,73,210,56,82,129,
+    136,66,240,250,159,251,146,221,43,246,167,129,32,46,44,127,172,221,58,15,61,231,137,13,86,233,51,18,41,168,35,80,
+    130,113,108,67,163,114,143,23,173,112,21,4,159,92,3,139,211,110,74,225,152,11,4,144,219,98,157,128,1,124,20,174,
+    203,135,5,98,75,69,82,113,209,7,233,41,28,155,6,228,89,5,40,93,48,9,131,70,140,54,186,41,56,93,233,64,
+    189,55,77,112,24,152,46,101,180,56,19,190,3,97,180,17,167,181,78,28,203,122,87,210,221,53,19,231,215,125,183,65,
+    17,51,11,238,95,120,3,92,110,41,176,245,156,222,194,115,237,155,79,112,248,252,238,160,232,117,140,119,67,217,252,172,
+    186,150,72,94,165,76,223,133,166,48,84,88,124,147,20,168,67,215,140,237,112,57,58,249,251,52,141,44,221,191,15,76,
+    237,52,181,125,169,209,89,168,81,52,100,5,66,36,12,119,193,24,122,217,166,73,36,170,81,24,158,102,53,9,237,209,
+    30,0,122,193,192,198,174,141,165,250,237,30,175,79,147,175,170,129,80,220,155,223,135,162,195,131,249,39,135,234,171,225,
+    204,162,158,209,117,113,20,176,66,254,100,201,80,165,35,79,64,142,160,244,77,95,132,136,155,175,26,172,20,19,56,130,
+    139,168,177,107,20,136,254,60,31,86,114,80,178,157,235,185,199,138,102,225,233,18,116,138,151,146,16,29,162,99,124,69,
+    127,149,76,107,229,98,10,247,80,181,7,236,209,42,252,29,251,171,148,66,66,214,59,138,231,127,227,84,91,44,247,137,
+    103,123,237,158,175,250,71,129,165,121,5,119,110,36,37,11,212,172,199,207,194,203,0,213,84,18,232,14,51,150,34,42,
+    231,24,89,171,139,190,13,210,118,236,64,41,162,44,162,242,229,184,196,82,223,159,168,182,122,102,193,66,213,51,23,158,
+    116,12,142,151,54,215,189,120,115,150,19,146,184,49,0,28,248,138,38,145,221,189,177,4,121,71,166,113,70,87,13,11,
+    250,135,8,30,70,203,249,170,62,42,150,207,127,110,37,111,36,55,141,155,108,161,75,237,217,187,15,80,94,194,40,117,
+    100,188,101,41,177,64,43,102,101,33,55,50,248,3,71,184,109,191,22,146,29,113,182,196,103,209,191,185,177,157,227,110,
+    158,91,175,46,179,215,232,168,154,28,146,116,252,186,202,236,157,27,152,49,40,145,211,12,118,57,219,15,174,226,42,119,
+    223,204,31,190,213,24,98,3,150,33,244,171,35,219,9,245,149,4,8,136,19,179,154,237,142,197,243,14,20,30,153,202,
+    133,202,103,115,171,36,36,243,118,127,101,190,48,134,61,108,225,153,167,154,77,239,0,83,147,46,117,92,9,68,174,147,
+    136,41,27,63,109,77,107,66,141,1,130,104,97,44,22,194,253,221,158,187,49,250,245,83,149,162,178,23,153,109,98,193,
+    208,61,174,197,253,64,249,94,207,97,53,1,87,121,243,59,77,190,34,4,196,194,148,104,130,82,142,184,106,245,171,62,
+    238,185,211,238,186,21,46,100,153,243,205,61,169,141,216,175,49,47,71,158,69,173,226,255,76,114,19,136,80,112,136,242,
+    191,226,139,206,12,97,141,224,173,224,152,20,182,212,143,37,165,236,97,99,152,123,163,197,243,172,88,12,51,117,174,94,
+    82,253,162,200,56,199,68,97,211,247,79,149,254,250,83,227,79,121,72,86,103,19,32,255,255,114,174,107,136,9,234,87,
+    12,160,149,18,157,217,238,55,69,218,123,16,218,50,11,196,229,162,59,58,210,100,66,185,85,223,156,179,93,154,240,207,
+    91,202,39,28,94,37,90,150,86,145,43,15,93,80,85,89,43,140,120,170,52,163,250,194,110,185,234,35,247,68,198,11,
+    53,72,244,199,9,69,159,63,243,228,72,195,112,167,60,208,140,93,50,61,123,245,140,12,93,249,193,1,140,199,204,205,
+    251,27,24,23,50,230,197,15,176,158,222,49,114,112,206,7,179,143,197,232,105,99,73,89,150,76,151,227,108,37,216,33,
+    72,247,90,4,118,221,197,43,33,225,16,211,104,5,237,11,117,127,75,212,230,62,54,221,120,114,75,120,140,128,174,8,
+    224,244,8,53,198,65,56,78,10,126,89,247,0,145,11,171,69,237,151,231,28,103,53,207,179,101,100,200,185,146,175,129,
+    152,113,114,76,51,50,131,30,247,169,29,152,19,148,76,189,125,173,5,73,38,88,190,170,124,236,9,239,237,215,229,175,
+    72,222,51,13,254,8,203,102,77,66,42,8,235,143,79,153,98,95,10,10,51,220,203,130,169,98,117,30,219,87,59,131,
+    137,83,249,48,81,134,149,206,149,141,189,81,81,38,82,86,155,48,125,109,45,59,162,53,130,138,191,179,226,62,133,170,
+    135,105,172,176,191,85,219,33,12,40,255,159,232,90,16,153,108,178,89,61,214,208,125,56,108,169,147,153,222,160,92,255,
+    223,14,21,183,155,137,139,254,128,48,87,73,6,81,235,21,47,132,242,36,27,176,89,64,50,17,250,212,81,161,172,65,
+    190,18,132,203,0,85,233,99,24,19,69,184,119,35,37,29,29,7,79,213,143,93,130,215,228,145,155,245,207,162,29,120,
+    86,55,154,231,132,14,254,109,196,107,73,98,58,175,234,93,147,48,151,21,253,150,226,82,178,158,153,168,87,253,229,74,
+    120,234,186,9,209,86,227,232,50,146,197,194,180,75,235,224,69,45,247,229,100,248,163,91,64,205,81,100,21,176,94,141,
+    80,37,89,126,185,13,63,123,217,88,96,3,180,81,150,226,213,85,2,79,94,206,32,178,206,23,148,164,206,166,2,210,
+    173,61,38,26,184,165,65,62,170,167,6,167,121,229,219,210,100,132,44,51,25,136,174,68,186,248,79,223,13,186,4,79,
+    205,2,145,21,78,133,176,208,65,96,100,7,22,81,35,45,67,152,104,143,27,22,239,168,209,152,160,190,82,106,216,97,
+    198,155,43,53,54,102,123,104,95,51,50,51,15,91,231,241,225,34,200,135,4,203,171,215,128,142,124,157,8,123,116,164,
+    124,213,61,226,36,81,161,162,45,241,6,254,183,51,161,255,98,182,156,134,105,246,255,137,209,68,57,69,122,50,94,129,
+    223,161,66,207,246,246,73,138,102,15,28,113,225,245,118,166,143,223,211,21,124,242,203,212,154,223,42,213,200,126,133,44,
+    150,101,61,239,21,59,125,215,176,43,74,119,18,143,16,74,76,235,113,81,99,176,178,211,114,21,88,199,83,168,28,146,
+    225,203,135,135,89,196,91,123,247,200,80,0,177,168,65,117,248,145,190,221,15,135,234,30,255,156,116,1,26,164,168,140,
+    90,192,133,201,136,111,172,242,118,90,17,24,79,86,248,139,41,60,13,31,143,189,206,231,125,187,14,66,30,102,145,120,
+    198,199,51,34,22,223,122,242,221,6,69,52,179,62,234,181,198,0,64,252,206,212,104,229,141,130,186,119,203,29,209,163,
+    153,15,127,169,16,145,40,6,151,160,67,75,239,121,30,77,226,100,215,29,116,50,199,173,146,113,132,147,169,87,14,233,
+    25,129,226,170,215,112,56,106,18,141,127,143,167,179,10,19,163,220,60,2,48,20,166,249,145,210,132,233,58,119,161,230,
+    117,214,132,33,180,36,114,72,239,148,143,238,4,39,153,78,119,110,151,163,54,209,126,222,117,99,154,186,72,187,46,115,
+    114,114,61,89,130,188,127,79,183,150,210,204,20,187,113,54,101,112,127,255,99,161,231,208,154,173,232,33,157,213,74,133,
+    202,42,229,27,34,236,210,186,129,71,32,217,209,63,187,101,54,172,41,197,186,52,228,6,174,123,195,74,172,49,239,11,
+    154,82,35,81,168,2,140,229,171,56,90,66,78,29,197,101,69,46,131,234,189,143,164,62,82,250,171,204,160,112,252,244,
+    58,123,110,144,179,74,157,55,13,236,142,68,188,88,139,254,8,36,191,3,142,81,12,128,0,41,190,22,176,80,206,90,
+    67,132,225,228,168,97,204,195,74,129,180,101,237,248,148,227,201,144,12,102,46,29,145,244,195,18,22,106,142,34,171,219,
+    248,3,159,244,155,224,239,171,190,156,51,240,135,54,249,167,104,203,97,26,125,178,126,177,80,204,146,162,102,182,76,193,
+    37,1,156,196,114,180,80,26,46,14,150,15,237,61,34,3,70,148,28,44,252,205,233,116,105,170,7,41,31,152,94,89,
+    101,111,159,19,202,245,100,57,106,232,147,9,56,158,41,1,61,241,48,45,241,140,205,194,89,238,34,154,144,59,128,8,
+    242,159,172,189,52,168,98,175,88,230,232,103,104,87,73,25,143,190,101,213,127,118,103,250,138,74,108,203,153,26,122,153,
+    79,99,43,21,109,99,201,6,83,123,216,234,110,60,63,236,139,103,1,116,239,78,107,236,138,116,22,59,159,77,22,162,
+    81,143,92,6,56,173,17,112,12,109,56,180,186,171,188,238,238,243,58,162,160,95,29,185,23,233,145,244,16,53,15,137,
+    81,201,114,17,32,250,112,217,190,96,225,144,181,92,66,67,205,193,4,43,245,24,88,223,95,216,45,5,229,216,173,242,
+    71,44,218,241,163,64,191,204,69,86,48,3,202,143,172,186,15,235,217,48,118,102,38,9,37,71,114,86,52,173,105,205,
+    138,91,31,160,162,240,226,152,142,74,7,172,51,251,178,156,156,76,15,89,213,68,136,82,134,75,173,61,16,160,76,98,
+    248,148,184,57,14,65,254,169,94,147,144,65,240,53,116,55,109,163,146,81,254,79,133,208,211,2,36,44,64,171,237,209,
+    111,137,39,233,92,78,125,219,142,60,76,155,241,121,7,110,82,13,243,199,75,137,11,223,20,72,83,114,186,126,84,0,
+    31,38,133,221,125,93,5,211,48,227,83,100,179,206,80,209,199,41,25,206,18,175,120,239,175,128,56,113,219,103,170,112,
+    79,43,150,112,101,238,174,48,199,81,187,232,62,49,167,254,181,129,221,192,248,217,224,165,165,135,190,40,81,212,217,171,
+    121,158,159,71,76,207,36,75,200,1,213,198,223,219,194,133,39,218,123,45,119,231,221,111,229,40,46,121,14,140,78,76,
+    58,42,56,162,120,49,60,25,60,61,130,221,129,141,91,90,34,155,99,21,226,238,95,60,220,183,14,84,66,29,79,180,
+    224,24,192,95,108,61,40,62,105,81,196,76,24,55,232,167,194,164,17,160,19,142,73,221,178,247,93,155,87,123,9,54,
+    136,208,69,71,2,221,113,209,71,143,20,20,25,55,164,135,63,46,178,182,0,253,99,40,11,49,204,64,127,94,188,172,
+    217,154,218,76,106,87,92,199,190,42,213,138,35,184,1,218,238,251,246,202,170,101,150,188,74,248,248,229,45,237,7,0,
+    76,236,107,76,180,106,159,28,222,77,29,45,190,110,13,222,150,85,179,209,240,115,13,244,98,118,219,194,90,184,49,195,
+    157,96,67,4,31,226,27,163,109,0,83,158,7,251,206,178,39,165,129,209,37,248,249,42,59,100,160,152,124,116,228,12,
+    151,171,63,40,87,110,83,49,60,165,118,26,77,69,26,70,88,25,100,18,176,237,0,12,121,25,227,109,99,40,8,1,
+    80,242,132,109,29,103,213,113,110,233,134,126,11,92,203,123,253,129,30,143,46,185,211,120,107,149,178,200,51,71,36,58,
+    80,206,51,214,57,52,56,48,159,182,74,184,135,30,33,74,31,42,5,209,151,146,117,130,156,188,56,66,151,174,215,204,
+    188,129,141,207,154,3,159,116,209,15,42,153,205,111,69,87,201,62,11,157,203,92,252,97,181,151,71,108,208,51,109,105,
+    170,148,72,173,231,243,173,152,153,151,82,73,32,253,237,75,231,113,114,235,112,115,107,146,188,213,130,137,254,96,246,239,
+    193,176,38,188,65,80,5,63,166,207,44,222,163,39,7,26,100,179,24,128,107,218,44,97,154,217,251,200,53,54,11,52,
+    40,82,148,237,175,222,74,130,47,66,102,105,29,222,49,67,234,130,98,122,106,213,133,47,113,169,103,98,118,36,236,42,
+    123,198,45,95,179,18,97,56,88,167,221,214,204,99,147,212,183,71,249,48,15,77,69,25,176,185,229,59,195,51,51,44,
+    144,70,124,249,255,194,216,184,150,7,251,206,53,218,96,180,148,170,252,220,24,238,111,206,93,112,210,145,0,1,29,93,
+    146,63,192,155,89,192,167,161,68,63,43,69,28,63,65,119,78,191,150,53,2,7,158,154,66,67,181,25,46,236,29,147,
+    106,226,122,157,169,109,5,243,164,231,155,159,173,92,42,184,169,237,212,30,252,253,42,169,109,26,249,233,172,74,105,223,
+    97,22,74,189,178,123,100,86,72,136,86,102,58,252,176,198,96,4,27,177,131,196,94,52,48,2,205,136,138,170,75,181,
+    237,1,137,241,100,139,168,89,250,142,23,122,238,152,228,21,136,35,199,111,246,109,217,119,85,2,242,78,71,116,216,210,
+    159,174,229,188,74,235,33,156,148,119,53,163,248,239,192,19,192,98,126,131,5,77,109,125,96,121,31,198,23,139,62,153,
+    55,111,51,183,194,117,80,236,123,81,60,174,225,129,196,73,188,182,58,184,42,88,73,212,72,201,47,92,76,75,61,226,
+    86,211,47,34,95,82,217,20,146,188,178,104,189,217,55,109,119,19,240,97,167,227,179,8,159,252,222,227,139,232,148,92,
+    153,98,192,237,62,248,191,199,149,96,1,188,98,108,167,243,55,123,7,10,37,23,231,9,0,233,7,186,185,4,109,178,
+    42,62,160,198,61,252,157,235,227,117,87,207,45,152,233,254,10,247,103,150,13,206,238,236,44,238,3,35,245,118,24,233,
+    129,202,255,159,231,176,167,135,94,193,208,10,184,34,156,43,41,186,243,76,203,230,14,42,100,146,75,244,198,83,6,34,
+    68,57,48,216,209,93,54,156,72,133,29,168,180,132,38,131,46,78,251,11,202,220,37,27,106,3,219,245,193,107,238,44,
+    145,114,232,62,185,46,177,184,231,5,71,87,162,66,207,191,158,222,80,88,216,33,129,96,230,10,151,128,5,76,29,64,
+    94,189,99,151,166,181,128,93,124,195,204,208,59,238,83,215,77,145,211,223,92,91,239,69,222,132,242,18,91,106,230,243,
+    58,48,243,217,56,127,17,99,175,28,244,209,47,149,218,198,73,11,241,157,245,202,111,254,25,47,51,163,27,18,248,156,
+    27,61,57,187,8,253,179,247,124,100,237,3,123,61,76,174,37,57,225,26,110,250,47,232,189,131,61,177,190,97,222,233,
+    198,122,132,173,1,167,211,97,196,65,173,55,10,13,64,104,62,190,6,248,241,156,176,192,221,165,198,199,60,17,171,60,
+    91,157,167,242,35,223,30,128,217,5,128,64,41,210,67,78,252,8,167,1,59,232,117,179,5,28,181,6,102,12,211,235,
+    10,41,188,106,52,104,89,97,42,150,225,186,145,128,131,98,193,169,142,20,235,122,7,58,234,180,114,16,145,82,128,223,
+    227,52,79,204,203,202,126,168,100,7,82,22,80,210,84,114,6,224,238,153,151,56,95,194,71,188,17,83,1,180,26,57,
+    91,127,24,145,136,13,123,33,207,141,235,13,159,209,196,46,4,62,229,27,250,3,52,195,205,157,171,103,47,177,92,183,
+    63,63,179,110,95,242,1,127,127,51,137,159,88,90,70,9,229,245,15,95,174,218,81,7,73,207,9,105,82,216,72,77,
+    1,82,11,124,120,235,159,78,24,172,9,43,247,40,175,213,30,81,177,27,73,89,55,207,230,131,238,195,31,94,198,218,
+    7,130,219,5,213,233,126,85,55,246,146,11,18,236,115,189,56,64,181,157,52,45,79,169,247,144,196,65,23,157,69,222,
+    44,146,28,218,215,86,100,144,156,165,2,1,67,49,88,65,81,171,117,67,72,102,241,16,3,225,106,11,55,87,222,232,
+    97,162,11,73,13,177,83,167,96,238,28,156,92,84,206,113,246,131,250,241,5,31,192,114,174,91,241,229,53,119,121,32,
+    210,33,38,14,122,223,43,180,111,190,27,222,244,110,172,59,151,102,192,21,239,81,24,64,184,112,219,22,132,171,28,21,
+    181,143,153,20,145,100,110,224,41,126,153,67,216,163,237,6,222,91,14,82,224,39,188,160,143,137,37,136,246,43,64,70,
+    198,22,32,159,63,50,102,154,222,113,61,66,44,250,235,152,83,174,34,230,130,228,54,91,152,142,35,164,172,58,109,54,
+    157,157,111,84,88,159,160,167,170,185,39,194,219,121,119,160,106,188,112,82,118,246,17,197,79,9,51,207,193,134,46,135,
+    73,151,24,206,40,33,163,124,97,131,23,6,184,22,213,214,182,143,48,94,65,51,193,53,131,128,172,70,204,155,104,118,
+    164,141,205,252,192,218,183,216,52,150,163,179,189,183,56,47,81,174,8,37,124,144,166,218,3,73,65,122,206,187,59,139,
+    72,191,113,229,192,11,43,88,77,201,118,233,89,61,99,142,41,181,3,241,21,253,30,187,178,72,30,36,175,183,165,176,
+    117,219,248,110,113,16,229,166,178,97,64,198,116,136,229,178,106,195,75,223,240,47,203,187,191,81,78,124,49,31,29,118,
+    216,132,84,170,35,250,132,34,113,250,125,8,38,69,28,61,204,41,216,168,82,218,166,165,196,33,206,118,236,246,162,118,
+    68,10,56,253,57,163,52,160,91,15,60,217,240,220,51,166,88,132,172,96,138,150,53,66,79,151,165,161,253,150,21,35,
+    147,142,198,150,114,89,171,130,186,133,205,115,21,121,125,90,130,157,28,98,180,227,50,212,118,135,239,157,24,204,84,126,
+    147,152,67,83,22,187,32,120,129,129,65,155,181,93,146,241,147,102,121,158,62,196,43,252,47,251,133,186,201,8,161,120,
+    119,209,174,175,238,30,216,236,165,208,204,142,83,100,7,239,206,132,39,188,51,120,90,118,106,89,140,76,48,56,145,246,
+    98,82,140,141,42,4,185,178,186,33,144,91,206,8,86,152,94,89,60,240,208,53,63,106,112,2,50,52,45,237,190,96,
+    118,113,91,13,148,199,140,185,123,143,232,13,127,166,63,254,145,255,86,170,123,158,52,12,121,160,25,191,103,160,131,180,
+    203,33,178,18,56,207,52,33,237,35,114,148,57,141,142,249,7,208,108,106,13,152,0,122,2,250,30,243,230,138,148,114,
+    36,226,144,63,240,74,72,69,149,201,193,104,205,92,3,32,89,66,194,9,17,13,209,131,165,191,93,35,171,39,160,132,
+    163,33,197,196,201,187,162,144,58,73,17,102,170,177,255,130,10,26,255,59,194,217,28,174,188,49,116,113,98,104,151,135,
+    65,218,50,82,15,175,67,19,172,13,44,86,24,106,233,97,229,23,99,173,164,6,116,67,231,27,101,89,24,93,43,125,
+    26,0,0,218,86,37,2,85,110,198,1,190,59,160,1,64,108,143,77,108,91,39,36,203,69,153,158,27,67,131,199,144,
+    220,155,149,209,169,207,195,14,212,54,243,202,182,203,94,95,214,6,229,150,204,244,222,102,147,17,28,47,210,220,106,239,
+    159,30,19,53,27,40,158,121,120,119,40,55,126,2,176,110,40,54,57,224,126,86,249,39,202,131,107,22,55,122,200,45,
+    176,132,143,196,39,123,246,32,180,149,111,175,51,185,69,185,24,190,188,229,241,33,182,50,90,136,2,234,252,137,56,202,
+    59,177,193,246,249,45,108,103,55,190,193,55,60,194,194,45,174,201,144,158,94,60,154,221,144,129,36,50,74,243,119,209,
+    215,132,247,189,131,158,103,112,3,181,162,179,37,130,6,106,111,59,164,156,73,138,136,168,100,235,148,88,136,188,5,32,
+    253,44,101,23,108,66,8,46,103,33,125,193,201,173,243,162,14,232,248,77,138,43,208,204,111,171,119,218,37,163,140,249,
+    75,183,157,13,37,6,132,17,205,171,192,80,234,218,78,22,125,196,219,90,137,46,157,150,116,175,0,202,54,89,135,41,
+    0,153,129,120,127,233,166,178,125,249,133,80,147,40,160,229,217,215,18,90,181,58,18,104,134,206,58,193,107,37,152,216,
+    77,84,215,176,87,117,70,249,142,199,204,177,239,223,76,66,10,134,213,191,232,80,116,140,216,142,238,2,139,101,122,130,
+    233,132,210,120,193,230,124,139,235,3,210,191,0,219,3,249,140,12,204,176,251,60,7,170,38,70,192,87,25,19,6,102,
+    240,133,26,95,206,108,182,207,23,121,6,91,48,136,158,232,218,121,4,5,11,136,242,61,7,120,210,102,54,27,45,10,
+    5,233,229,251,0,16,82,143,2,35,77,242,84,60,213,175,142,233,247,247,5,80,246,236,227,196,221,182,117,135,195,82,
+    242,232,35,28,125,29,132,139,249,221,205,166,124,93,172,89,56,122,236,13,80,99,43,148,10,120,231,198,71,136,230,121,
+    144,108,56,190,217,108,201,0,23,111,134,69,120,32,201,65,108,141,9,103,109,227,221,165,7,223,202,25,218,151,148,64,
+    50,211,213,23,18,135,137,153,13,172,61,10,23,3,49,74,88,50,114,37,45,139,75,207,54,131,49,187,249,217,130,232,
+    221,206,186,104,16,93,204,84,162,179,16,213,16,63,118,244,98,176,154,205,22,115,146,41,94,11,144,170,124,242,144,225,
+    166,216,60,4,53,223,250,81,240,158,34,208,222,166,151,53,126,164,35,88,78,128,222,233,254,252,182,73,189,139,106,80,
+    94,169,129,176,99,216,204,206,85,164,246,118,175,100,172,211,44,140,180,110,111,80,225,68,77,176,14,52,21,102,98,107,
+    201,70,118,240,200,134,123,217,74,164,191,21,74,219,193,66,183,94,175,27,4,210,178,178,180,68,80,140,199,95,177,160,
+    189,106,255,120,210,92,122,50,187,214,94,225,41,28,3,159,86,68,150,81,60,233,19,150,109,12,75,153,225,254,255,220,
+    77,61,69,126,37,207,58,6,44,137,111,13,152,237,29,235,38,10,217,222,138,14,191,154,77,95,83,98,55,248,201,66,
+    87,63,228,191,55,176,63,172,91,144,111,227,68,198,94,201,11,255,80,209,148,205,98,214,78,135,127,230,143,60,195,179,
+    157,135,126,23,160,205,200,131,186,244,33,170,17,48,132,92,174,236,41,109,4,239,149,99,182,247,11,177,220,251,228,126,
+    21,173,170,55,199,254,70,54,247,102,181,227,241,191,77,115,202,212,248,99,49,104,225,126,126,101,149,189,48,66,73,229,
+    145,209,201,170,209,241,22,75,132,210,139,85,4,138,83,121,156,34,222,95,198,231,12,42,159,51,246,156,193,142,125,221,
+    43,60,154,176,3,47,44,72,185,23,146,171,98,213,156,64,90,75,135,93,63,3,251,182,23,130,72,220,160,126,73,189,
+    16,92,116,160,112,44,158,39,29,87,249,0,37,65,157,30,27,67,141,185,62,129,24,247,101,5,2,63,244,132,21,136,
+    98,20,10,250,51,130,73,125,227,77,28,154,200,17,48,129,21,210,127,104,198,83,24,70,222,2,121,230,20,177,209,238,
+    79,221,43,20,49,243,231,81,74,35,154,253,62,155,0,70,249,38,235,68,9,60,163,237,87,172,181,24,201,205,178,153,
+    57,45,190,213,211,139,225,248,90,163,22,230,212,2,146,145,24,248,236,208,216,16,64,129,12,248,100,124,101,37,150,148,
+    119,142,112,214,104,50,26,13,20,162,50,42,233,185,37,115,124,27,104,111,30,44,140,246,27,17,2,201,106,178,203,223,
+    82,9,32,189,171,92,52,150,94,233,149,249,79,42,113,144,120,0,155,49,231,119,127,161,64,117,145,252,233,43,235,95,
+    82,153,92,185,191,219,63,90,216,2,110,57,206,163,5,12,154,240,32,127,34,239,174,63,42,252,79,169,58,193,254,61,
+    231,202,79,186,90,3,229,51,102,215,64,244,62,58,10,133,203,115,34,108,75,232,133,80,31,60,98,218,123,18,51,125,
+    178,33,176,130,29,80,186,69,230,172,40,210,10,69,79,66,124,97,117,161,31,130,178,230,75,139,156,112,51,143,141,141,
+    170,208,232,6,198,240,46,47,183,146,48,99,26,208,2,41,177,139,63,126,63,6,191,210,179,224,246,172,46,8,179,159,
+    174,157,53,148,6,36,6,129,239,169,174,154,82,73,159,41,90,198,179,76,49,238,144,33,202,106,143,87,58,117,2,42,
+    87,164,164,128,35,156,59,164,26,100,225,236,188,192,30,236,127,68,195,67,102,230,240,146,177,251,137,232,175,37,235,46,
+    129,91,156,53,44,31,129,7,6,149,56,223,58,205,97,2,121,213,41,11,203,9,67,25,118,145,64,115,194,147,110,151,
+    132,123,16,29,97,193,196,213,157,103,17,213,218,245,232,119,184,228,181,239,217,169,3,189,120,231,181,37,181,232,16,11,
+    76,35,188,97,222,37,17,68,80,16,200,229,22,40,244,93,88,27,203,36,86,98,128,53,116,147,139,85,171,89,106,51,
+    84,66,169,17,116,156,57,53,229,4,143,159,20,0,207,70,153,131,150,68,243,154,202,39,58,135,194,175,117,253,93,57,
+    29,123,216,119,96,62,157,255,1,26,152,218,43,110,191,192,67,119,4,193,116,55,241,87,103,11,250,32,215,157,135,60,
+    5,110,91,243,26,37,106,14,12,73,180,142,80,84,35,138,97,253,171,137,0,38,214,138,239,203,193,190,227,77,54,82,
+    122,52,188,202,236,95,18,198,229,232,234,193,121,97,31,180,91,100,129,89,138,68,223,70,137,188,128,21,94,193,179,1,
+    196,112,34,33,217,43,234,128,27,234,25,91,200,50,127,75,51,177,189,188,192,181,184,2,153,180,181,139,19,220,145,238,
+    155,50,232,228,60,65,26,227,137,16,245,221,34,155,166,201,94,37,40,9,55,64,117,77,51,138,52,162,173,115,46,87,
+    24,162,191,121,147,211,202,69,121,243,210,218,223,216,205,228,193,57,123,116,121,135,90,41,38,148,229,216,124,172,10,206,
+    171,239,151,189,134,202,125,55,98,8,27,112,148,220,131,80,106,190,33,157,187,41,13,217,122,185,93,80,252,132,61,8,
+    227,177,25,212,235,108,54,200,43,137,3,218,162,105,117,138,43,154,96,251,154,59,1,24,206,168,104,58,80,46,167,104,
+    211,93,147,86,174,80,226,21,197,166,140,135,0,107,85,48,219,102,125,103,207,36,203,12,228,178,72,139,53,179,232,150,
+    42,212,232,24,246,77,123,21,177,86,72,231,140,233,111,170,82,51,90,75,54,110,140,240,214,184,88,175,58,239,252,233,
+    25,40,160,87,139,120,173,10,85,35,182,137,138,55,243,216,175,72,204,217,145,224,226,175,64,83,194,250,120,174,132,5,
+    240,79,121,4,66,90,131,213,252,70,109,137,132,226,61,207,31,255,127,142,120,247,210,2,73,41,90,147,107,204,228,12,
+    11,45,8,118,164,114,56,129,167,81,21,120,171,127,114,208,84,46,117,144,163,245,122,162,90,67,91,121,21,246,23,255,
+    254,51,119,254,200,246,251,59,69,111,127,48,223,21,159,119,251,200,232,179,40,150,14,141,244,196,206,173,46,166,240,223,
+    210,212,221,118,34,185,217,137,192,212,48,181,3,199,214,132,49,131,151,214,9,56,188,78,158,10,78,33,15,133,125,186,
+    185,48,74,235,204,152,12,8,177,137,137,202,13,162,103,71,91,182,155,109,98,155,164,118,29,137,119,96,102,230,39,40,
+    118,158,248,236,79,15,148,23,115,137,227,232,184,175,135,201,34,92,7,54,248,233,43,105,39,77,16,48,49,26,212,31,
+    155,142,15,75,162,49,145,99,140,167,63,215,151,148,218,135,132,89,42,211,247,141,209,115,196,0,98,53,8,161,216,94,
+    215,101,99,195,172,60,242,110,202,0,169,85,182,25,236,152,226,56,160,74,31,205,100,239,206,68,154,212,203,133,1,201,
+    62,34,29,38,115,232,10,197,62,56,64,242,29,22,21,128,12,226,235,238,25,71,166,154,147,123,96,200,103,146,28,50,
+    150,107,97,9,224,34,30,208,114,158,97,112,50,216,164,121,202,160,41,121,21,83,57,84,158,0,51,60,162,36,86,122,
+    208,112,187,227,98,30,57,237,217,122,179,43,171,17,62,231,99,30,246,42,118,206,163,165,52,52,176,86,111,36,167,178,
+    204,228,162,141,121,78,251,179,91,146,73,102,189,126,220,207,122,191,42,188,139,57,96,173,166,130,222,221,154,218,36,235,
+    168,136,79,227,66,239,49,189,102,193,91,191,50,145,99,77,182,221,62,96,83,199,185,92,127,137,86,109,186,54,44,224,
+    163,37,42,192,109,7,115,55,36,12,215,94,37,97,2,51,113,104,168,157,47,100,46,135,190,67,74,115,239,26,20,81,
+    65,130,235,204,233,78,86,228,178,133,215,243,247,124,250,47,47,10,150,77,22,168,1,150,94,234,144,142,10,65,191,86,
+    190,8,33,77,135,253,136,202,191,48,178,151,74,129,55,139,89,210,11,122,22,38,218,186,205,123,52,167,62,78,143,191,
+    109,110,178,93,191,234,72,43,205,115,241,223,163,17,53,150,7,186,221,147,189,225,84,194,147,29,246,203,99,75,249,90,
+    103,167,236,192,176,0,233,249,26,238,130,238,210,246,183,223,118,227,245,207,242,238,111,195,214,137,82,125,238,227,79,149,
+    239,147,137,105,201,227,60,145,192,95,162,236,158,141,167,69,134,106,137,172,165,48,89,175,178,226,255,178,164,23,235,9,
+    127,246,148,15,2,251,248,246,109,149,160,20,81,52,129,242,106,138,189,69,41,11,130,233,4,31,143,71,190,76,129,141,
+    113,134,229,228,144,124,79,38,95,74,42,167,235,246,191,35,50,234,241,51,27,179,237,34,49,220,172,248,155,249,197,163,
+    15,123,190,243,79,192,242,122,127,94,240,37,74,118,154,51,115,131,151,21,11,250,184,59,118,193,253,50,208,19,185,16,
+    163,83,3,83,105,36,45,42,13,102,212,64,85,20,235,44,16,97,78,48,247,148,55,29,226,192,69,43,241,187,50,206,
+    168,199,47,160,200,143,239,58,189,167,172,23,143,9,144,186,179,162,36,165,100,120,199,5,112,154,133,79,227,238,133,71,
+    41,232,17,157,78,21,225,26,56,238,236,39,25,129,238,215,251,250,190,78,195,83,108,234,50,152,254,57,215,121,144,87,
+    154,23,225,4,225,168,58,109,48,146,42,215,126,38,27,103,248,36,35,23,220,222,250,9,19,205,172,237,74,123,113,236,
+    26,132,162,32,17,217,67,252,245,134,255,216,153,186,141,228,228,130,110,115,218,135,222,96,193,2,219,115,43,11,223,117,
+    88,113,243,220,21,180,120,202,100,16,15,163,170,42,177,94,192,20,44,45,70,185,207,227,90,223,228,82,91,101,55,137,
+    217,241,149,179,140,237,253,203,168,19,160,75,161,33,226,91,124,125,29,210,195,117,239,100,193,174,103,120,202,207,232,27,
+    5,93,203,65,182,96,85,111,235,64,97,204,193,118,74,60,44,196,126,166,245,11,85,20,176,51,53,234,29,95,183,189,
+    104,61,253,202,45,151,143,189,122,2,171,191,128,143,158,177,209,206,143,143,16,160,176,110,30,56,184,100,3,103,172,237,
+    64,139,146,203,128,211,187,223,67,157,107,253,1,228,121,9,94,47,109,228,118,15,251,215,97,47,218,32,253,9,60,11,
+    99,93,223,40,237,138,2,179,222,69,65,13,254,107,65,177,206,15,126,193,144,247,172,125,193,4,16,201,227,121,128,21,
+    70,36,75,78,196,3,137,25,171,33,61,172,165,42,253,114,161,242,231,145,164,135,104,134,82,159,13,119,175,138,202,58,
+    69,156,13,23,133,241,63,175,87,8,52,194,219,46,223,119,129,7,111,208,214,113,213,138,141,11,58,86,11,235,213,159,
+    217,45,159,163,38,222,130,159,223,229,3,153,207,30,244,64,57,137,5,85,28,38,180,71,59,14,214,214,245,6,244,13,
+    2,133,147,205,175,66,118,218,232,15,33,211,214,126,176,235,18,51,212,49,165,14,149,0,203,202,210,40,8,17,59,211,
+    188,202,103,100,74,69,33,195,104,66,218,236,218,127,44,131,190,78,222,33,248,68,112,22,186,94,95,186,187,216,60,190,
+    168,171,32,216,231,124,112,61,185,79,46,223,45,169,71,123,140,138,36,193,224,66,170,232,119,194,51,129,19,134,193,102,
+    40,141,62,148,31,72,116,142,5,0,41,66,32,232,185,48,84,50,250,146,36,186,183,196,121,97,20,51,76,161,186,79,
+    60,52,76,54,115,92,180,248,161,42,104,197,54,161,198,46,58,96,125,21,32,187,204,156,196,123,156,44,107,47,77,7,
+    48,34,237,5,109,153,42,58,1,244,225,20,42,56,95,142,3,229,66,0,26,20,121,13,206,136,86,6,172,132,37,58,
+    30,25,224,33,221,71,107,147,32,8,21,107,61,188,1,4,71,31,242,19,38,157,154,71,50,40,228,23,175,66,161,144,
+    51,57,85,129,103,68,35,78,195,233,115,235,116,196,96,137,137,20,97,22,117,104,38,95,153,8,107,8,0,250,236,128,
+    3,243,241,203,12,126,175,219,7,229,13,143,5,201,33,75,111,203,65,184,230,179,51,99,126,155,230,199,36,203,188,233,
+    179,137,117,210,137,194,160,235,4,98,174,140,129,135,207,107,149,93,110,165,35,225,0,169,136,64,78,183,201,25,168,151,
+    184,139,247,205,211,36,160,158,213,71,201,42,20,28,92,83,62,131,78,211,30,191,88,3,134,20,83,222,13,121,17,51,
+    86,15,147,238,68,113,21,168,67,15,17,113,74,44,6,186,230,54,226,68,138,117,71,227,238,226,237,129,133,25,36,116,
+    81,110,40,172,161,43,190,106,201,98,155,245,12,224,153,228,247,180,64,163,174,226,225,37,3,125,46,95,81,4,250,72,
+    3,10,61,95,111,34,16,36,108,203,5,185,186,89,73,61,79,28,102,82,209,83,119,240,133,153,236,67,218,54,94,164,
+    98,132,162,41,142,78,44,122,170,229,127,194,51,249,149,19,242,226,122,221,190,251,96,10,232,231,248,171,112,244,238,160,
+    92,30,152,21,199,20,241,5,157,144,167,158,10,149,211,214,124,232,229,188,4,49,193,28,163,170,160,211,168,144,33,183,
+    76,174,61,122,113,229,92,183,113,159,116,209,116,188,234,187,14,197,231,117,240,199,17,214,11,236,246,174,95,196,192,46,
+    17,139,252,179,153,131,242,52,118,245,64,87,238,231,58,160,116,108,90,84,243,3,185,121,115,237,24,91,208,178,61,27,
+    123,19,139,248,209,50,94,136,84,238,144,253,108,114,10,79,93,225,195,150,224,191,85,149,162,64,172,146,214,110,65,48,
+    95,160,100,234,144,226,210,6,60,103,53,113,89,245,95,228,39,96,62,117,78,62,176,109,4,231,4,79,118,181,242,252,
+    126,145,29,170,233,174,125,79,10,232,150,206,216,114,200,47,78,139,224,49,193,101,110,56,143,245,208,154,250,138,191,136,
+    234,178,66,77,248,170,77,244,67,94,74,132,110,192,121,105,95,182,186,98,199,15,110,204,250,48,242,214,67,254,42,251,
+    92,255,249,20,38,157,220,191,31,242,101,190,29,134,28,44,244,118,36,206,23,232,52,103,88,83,209,186,30,164,49,117,
+    255,34,240,31,2,68,190,99,114,17,19,119,172,123,116,13,107,222,39,213,206,190,143,67,23,242,112,81,138,197,243,179,
+    22,229,19,161,145,245,251,196,175,97,254,87,204,232,246,193,123,110,134,188,19,33,165,241,200,164,111,177,191,31,53,203,
+    166,208,197,91,194,83,190,194,249,69,30,82,209,86,176,56,116,76,57,245,249,129,96,25,184,56,171,95,70,184,180,32,
+    109,79,139,160,81,98,209,136,103,120,188,254,6,184,244,222,59,56,178,225,217,15,250,155,62,20,139,67,206,255,178,171,
+    78,13,182,166,128,154,170,230,31,208,125,184,123,110,227,151,73,153,100,189,228,26,1,201,80,13,3,10,206,219,153,212,
+    124,64,217,54,31,208,92,248,173,67,85,11,57,196,20,221,209,213,175,68,251,67,10,117,28,177,109,194,85,126,159,193,
+    18,189,10,198,94,207,117,198,202,48,43,127,199,112,124,56,83,230,69,128,109,72,23,189,90,48,72,174,162,227,55,58,
+    49,182,47,20,131,82,86,171,227,40,142,189,224,145,166,170,112,179,136,164,33,219,168,167,193,55,195,146,22,200,190,179,
+    74,48,50,17,211,57,222,91,174,113,60,13,189,126,212,13,80,128,59,11,242,161,117,32,50,5,93,247,28,64,91,0,
+    118,49,6,195,243,103,35,150,64,54,85,144,2,197,82,6,21,38,69,74,161,35,83,70,27,52,154,167,189,25,171,25,
+    16,56,202,93,212,255,59,204,180,75,123,184,82,98,215,111,109,82,103,146,94,7,180,204,172,72,107,96,209,212,42,81,
+    161,44,12,63,225,215,194,80,107,193,37,207,144,195,75,6,114,216,218,89,48,170,222,9,169,67,245,108,105,39,28,228,
+    117,211,57,188,5,167,194,67,4,20,236,147,40,69,199,197,68,52,152,66,77,58,23,61,120,66,26,40,12,75,21,55,
+    53,111,117,81,214,162,215,33,155,219,102,210,144,183,213,248,199,107,38,85,99,125,75,147,48,108,226,30,189,247,132,219,
+    37,60,157,68,25,238,136,104,49,11,82,236,100,60,186,229,146,19,142,79,50,28,43,124,66,196,85,111,141,97,39,122,
+    204,152,72,14,199,176,174,163,204,120,69,103,187,6,19,79,155,250,28,113,61,145,148,47,148,245,202,170,7,138,214,99,
+    78,247,88,154,119,74,163,67,155,169,110,61,103,118,31,223,159,17,218,203,108,19,166,35,6,25,79,191,121,203,65,122,
+    220,208,234,20,213,77,57,215,60,75,1,157,250,138,35,107,20,111,147,62,14,69,214,237,110,229,241,31,61,220,83,150,
+    136,58,186,135,25,24,144,150,146,71,99,9,135,169,251,235,105,195,203,130,135,243,79,99,19,99,115,121,54,231,221,6,
+    8,131,81,101,34,211,246,24,48,80,115,2,193,196,139,160,166,39,104,209,81,127,247,161,7,8,54,196,76,159,16,115,
+    186,127,93,124,67,35,2,126,115,87,231,252,23,103,12,112,37,164,102,148,132,142,152,165,74,146,237,124,135,58,171,62,
+    228,238,198,237,190,229,4,127,202,87,140,250,174,47,138,182,204,75,238,37,31,35,142,157,177,120,126,248,65,25,44,76,
+    63,127,30,101,236,216,208,235,103,198,29,190,230,83,114,224,232,33,111,144,176,205,229,126,99,172,187,198,25,72,2,102,
+    163,227,217,50,231,211,235,125,169,239,195,81,241,202,6,29,56,33,255,184,25,31,246,6,95,8,137,199,196,122,190,151,
+    113,132,104,146,127,76,142,247,112,147,81,107,165,43,67,221,175,161,205,221,51,234,107,135,26,7,85,60,222,134,107,238,
+    114,141,190,4,1,167,230,0,101,61,112,200,176,178,217,209,203,152,106,160,78,230,86,115,228,169,234,188,40,153,250,66,
+    9,104,119,14,56,151,206,33,231,227,208,206,63,11,189,175,230,43,40,174,228,12,216,133,114,29,151,109,95,104,216,100,
+    205,143,39,225,99,35,109,104,137,225,51,82,196,47,88,159,116,26,254,67,199,134,129,211,41,72,254,106,204,57,78,9,
+    254,121,126,225,248,45,57,60,52,94,195,119,173,182,173,77,4,143,56,183,173,49,115,154,72,158,219,123,9,209,20,59,
+    203,233,42,136,237,235,24,120,255,238,112,156,9,93,154,81,30,234,118,87,4,41,233,142,14,142,41,227,227,175,59,92,
+    149,237,39,248,117,115,32,237,71,78,210,109,109,138,219,56,77,182,8,225,39,70,168,155,177,175,13,245,162,221,204,154,
+    190,107,120,178,63,108,67,144,50,190,18,185,102,175,237,114,42,146,2,107,178,111,234,96,179,160,32,223,238,34,231,146,
+    95,121,12,172,13,88,219,240,246,40,33,224,229,105,34,74,86,45,43,203,129,133,23,17,186,131,6,118,139,137,164,177,
+    87,130,127,67,90,45,167,175,250,154,122,87,148,83,173,198,255,151,134,228,86,181,144,174,252,11,91,171,180,73,60,250,
+    148,31,215,95,116,219,7,37,154,21,224,223,219,81,109,86,97,75,143,179,196,113,179,41,73,92,179,84,99,185,115,16,
+    86,71,183,201,99,209,146,117,100,69,164,29,210,112,238,66,3,81,33,131,137,45,80,112,60,47,45,159,247,102,226,7,
+    53,26,157,73,231,121,167,151,16,8,154,215,26,24,9,57,163,62,126,72,211,25,199,119,30,46,126,88,237,25,129,110,
+    162,79,194,50,225,151,77,250,212,198,143,37,38,236,225,88,16,84,139,58,242,9,9,109,25,91,45,255,245,83,223,159,
+    119,188,75,34,207,22,29,215,145,55,37,24,126,83,91,38,211,48,44,218,224,253,255,190,216,0,81,115,107,238,213,142,
+    183,61,73,124,21,66,107,5,104,43,83,170,241,65,11,110,66,55,247,80,212,88,34,79,181,53,198,129,54,48,165,229,
+    113,55,80,89,147,221,253,78,188,132,65,134,190,254,217,66,198,174,59,196,137,44,60,167,230,162,86,232,245,39,168,168,
+    231,139,3,219,19,42,116,0,250,146,208,193,187,233,162,90,227,146,198,196,16,34,151,170,214,106,146,104,34,96,166,164,
+    117,225,39,245,45,28,4,104,6,59,193,152,218,161,127,102,178,91,222,74,95,50,189,197,4,81,124,182,66,39,62,21,
+    43,42,43,125,105,149,90,191,8,66,174,241,96,198,199,177,74,67,207,94,32,73,168,218,185,69,127,173,104,163,57,222,
+    189,14,4,164,200,183,192,219,184,31,140,147,32,193,163,71,116,189,36,98,28,136,23,41,120,56,32,175,20,140,151,37,
+    121,43,126,74,6,94,35,13,138,130,51,132,16,90,35,108,34,248,136,159,160,37,65,157,72,250,216,149,144,45,8,65,
+    41,14,224,238,146,104,124,118,43,54,80,36,18,109,246,23,151,3,21,135,68,15,230,30,213,136,10,140,67,181,146,70,
+    19,112,93,3,154,167,177,115,200,108,89,190,171,7,172,127,230,198,210,115,52,248,252,44,128,246,133,125,10,7,217,107,
+    247,136,149,122,46,2,106,144,55,2,45,63,45,112,228,223,246,28,193,198,182,97,192,95,11,18,80,100,130,183,42,43,
+    174,249,165,180,151,98,104,110,164,175,159,38,25,152,47,149,22,151,114,96,194,82,146,135,161,186,175,90,166,50,144,213,
+    37,150,97,68,5,229,174,220,3,17,148,25,244,241,204,204,113,218,50,198,95,226,78,117,30,15,195,66,151,88,108,8,
+    30,134,198,230,205,74,156,176,157,149,200,32,156,238,19,138,160,52,205,149,163,30,139,150,152,134,54,2,230,167,42,184,
+    13,74,87,102,243,122,33,137,218,38,238,236,84,213,158,182,185,104,106,139,150,148,50,122,237,49,96,142,96,204,90,237,
+    142,138,254,125,188,192,173,233,136,149,215,225,85,20,46,188,2,150,77,60,189,39,239,152,179,106,39,100,167,108,18,67,
+    107,243,62,182,171,52,166,5,151,215,10,187,8,55,218,92,104,205,178,3,19,227,121,219,189,134,104,199,42,221,176,38,
+    253,185,248,60,109,95,130,53,241,120,207,55,142,63,230,178,240,168,141,254,65,148,75,184,195,137,139,55,67,50,237,176,
+    149,167,89,173,15,16,95,175,194,153,225,164,186,21,195,137,231,2,202,203,189,143,205,34,34,24,206,94,213,233,243,191,
+    84,173,248,123,10,202,185,6,97,45,92,41,119,157,218,183,199,147,120,162,175,170,104,78,245,171,160,223,50,138,239,19,
+    19,116,106,223,178,90,103,57,162,241,101,95,162,146,223,242,172,249,58,173,39,233,34,134,207,250,53,238,87,3,146,96,
+    33,253,135,106,214,102,35,109,125,21,54,153,206,134,244,116,1,81,251,81,171,90,112,184,31,72,211,137,250,176,236,81,
+    139,120,64,104,249,141,224,57,2,144,197,97,164,184,232,72,42,71,201,114,17,241,142,102,137,251,106,39,32,240,28,53,
+    52,102,106,225,140,46,108,209,217,238,47,156,26,182,111,196,107,218,236,145,86,21,28,175,175,165,232,86,12,139,93,201,
+    49,107,65,159,109,164,123,174,132,235,148,136,116,64,228,51,171,25,202,101,213,27,140,92,181,6,114,244,174,64,94,33,
+    15,24,114,57,98,25,117,111,147,129,91,68,157,244,107,219,148,35,89,82,181,56,173,146,16,177,236,63,235,102,41,237,
+    72,138,33,204,18,81,48,240,186,243,59,31,244,68,74,124,105,251,24,224,211,170,247,6,80,62,201,253,159,85,122,10,
+    41,145,204,244,209,143,99,180,85,27,211,43,210,223,223,173,245,145,97,139,91,13,32,166,246,5,107,231,199,204,178,99,
+    158,248,62,122,219,193,93,94,110,241,9,84,187,223,188,90,147,160,145,182,116,135,35,99,88,47,166,90,216,120,239,91,
+    157,107,76,239,86,23,16,121,238,221,35,220,204,114,38,128,243,86,74,81,69,34,81,16,130,245,201,35,90,59,115,74,
+    45,139,193,72,26,84,90,61,80,42,78,205,137,6,86,206,93,34,182,54,243,243,20,46,17,25,192,42,6,46,54,249,
+    154,59,143,61,0,230,232,213,107,51,237,208,155,190,168,212,113,167,18,33,233,37,13,10,118,180,108,190,253,21,47,52,
+    152,50,118,98,220,247,79,47,138,43,80,133,255,254,156,250,137,53,130,223,119,40,20,124,246,43,140,205,31,64,57,141,
+    88,144,111,29,17,235,200,252,67,59,31,68,151,102,124,64,209,45,240,75,199,93,245,75,96,2,19,81,6,37,34,88,
+    100,39,16,224,82,110,100,139,114,64,26,75,23,51,24,16,36,139,18,242,119,164,213,45,127,72,106,142,132,179,88,99,
+    249,185,102,233,60,89,129,165,218,94,176,194,161,40,206,9,212,242,170,54,228,142,200,90,127,126,14,195,240,147,10,39,
+    45,213,14,170,179,162,147,100,233,81,188,19,230,145,162,142,99,80,28,12,36,187,252,137,36,237,110,101,45,31,74,18,
+    44,63,50,127,215,168,75,193,3,75,161,228,138,245,66,206,1,87,40,10,41,20,82,219,198,30,211,251,34,124,205,4,
+    126,212,20,116,208,103,63,24,148,105,126,250,16,215,128,127,223,6,102,252,91,31,131,74,119,31,131,69,92,45,161,30,
+    122,227,129,142,103,75,183,2,158,203,219,130,116,122,80,107,141,144,33,89,185,193,160,22,188,244,25,12,167,29,229,103,
+    0,148,25,23,43,1,61,245,120,6,144,1,201,97,26,220,86,146,104,145,199,2,188,117,235,159,173,201,191,138,127,254,
+    252,131,121,68,175,181,26,104,205,235,41,210,207,13,169,46,206,113,110,8,211,239,209,168,231,136,111,194,216,122,191,106,
+    61,8,5,172,34,158,205,105,234,24,62,49,50,90,120,67,223,196,59,187,157,156,91,5,113,189,119,57,172,142,111,9,
+    167,156,187,184,127,96,31,157,181,155,102,186,4,164,145,239,61,97,24,2,124,214,211,252,0,44,213,51,177,26,63,155,
+    12,39,195,236,237,204,12,252,37,224,105,93,75,198,152,39,240,82,85,182,8,231,245,37,166,148,32,17,147,238,107,108,
+    60,232,82,122,225,140,75,123,46,239,63,28,170,154,182,159,68,224,217,148,169,160,131,221,150,211,248,184,245,189,103,195,
+    174,66,247,114,206,147,86,206,211,160,34,233,241,20,50,94,171,162,107,144,122,9,165,86,180,191,103,169,230,238,20,47,
+    109,46,134,83,245,235,194,191,147,4,234,113,183,127,246,235,115,239,177,57,186,120,47,220,10,153,43,78,222,158,54,136,
+    100,27,148,149,225,119,226,148,52,116,14,239,234,237,115,67,158,134,94,198,225,240,218,79,101,187,96,60,55,241,203,67,
+    249,127,238,50,127,136,42,237,100,171,196,245,205,132,128,73,245,177,96,44,147,194,21,129,100,185,39,204,142,137,241,43,
+    97,161,182,203,142,43,104,166,115,162,185,217,199,227,250,41,38,2,183,188,63,123,252,58,103,6,222,91,123,207,177,139,
+    110,208,230,112,35,244,122,142,194,49,86,233,252,86,41,69,236,133,125,182,107,146,45,227,152,248,122,70,54,179,188,21,
+    233,186,118,94,47,64,34,57,236,170,109,70,168,148,143,52,242,138,61,194,44,125,152,236,238,30,162,231,107,236,194,235,
+    247,148,163,243,109,75,25,227,0,119,161,180,169,103,5,55,29,104,239,180,179,101,19,85,190,152,216,150,254,0,67,111,
+    141,119,78,125,185,182,118,100,77,131,248,93,186,151,126,150,42,102,207,214,212,121,99,100,134,241,197,18,186,53,237,239,
+    242,134,13,24,56,203,169,122,83,105,201,247,17,255,44,42,80,120,14,139,92,90,29,140,118,149,24,46,243,102,221,52,
+    169,182,147,149,54,178,212,134,50,65,225,50,156,148,120,136,33,106,78,204,212,172,232,112,171,6,209,97,152,44,142,254,
+    211,52,143,20,142,211,20,78,32,207,243,122,251,210,216,186,132,33,242,138,242,119,103,237,154,182,229,39,210,23,67,231,
+    0,92,78,50,192,254,107,237,159,43,10,49,101,253,207,116,88,141,209,37,97,182,193,185,197,231,8,106,196,179,105,177,
+    202,237,96,71,117,171,222,188,202,200,175,174,75,209,134,175,186,37,73,126,235,140,170,95,255,73,98,34,100,240,211,98,
+    225,147,35,119,32,40,183,50,144,25,116,235,7,250,191,191,173,14,170,144,1,133,97,96,57,129,219,110,167,0,103,59,
+    56,147,89,232,93,66,30,141,249,218,177,0,89,4,198,217,129,9,176,203,89,107,59,55,56,63,196,239,141,158,178,74,
+    188,157,199,88,26,207,235,96,88,136,156,207,78,46,114,111,87,119,64,9,238,198,87,236,159,73,177,39,21,234,31,97,
+    198,44,240,223,26,229,210,36,184,82,12,252,151,37,147,20,112,121,71,84,56,188,253,156,78,1,242,142,43,85,187,243,
+    137,51,92,157,5,1,151,62,126,52,240,64,235,41,132,198,142,63,10,43,12,159,198,127,15,135,1,207,252,60,25,4,
+    13,149,201,95,39,99,76,230,203,52,120,249,253,160,159,91,193,230,108,246,239,84,151,87,239,70,23,253,71,121,99,90,
+    186,106,19,148,205,62,193,132,146,27,18,134,175,23,118,23,132,47,24,225,116,5,18,42,100,160,123,138,222,172,16,246,
+    220,75,118,229,54,238,233,145,55,102,182,208,115,0,113,155,126,108,164,43,104,33,102,151,20,118,13,111,149,68,112,137,
+    51,169,133,63,160,140,209,36,145,174,26,31,244,88,11,121,34,128,167,16,72,49,41,3,230,250,174,11,92,30,188,184,
+    46,225,80,165,218,22,235,173,236,245,245,203,157,227,94,232,170,158,180,167,35,30,26,69,165,144,196,165,192,82,62,125,
+    115,19,203,42,45,132,27,244,158,99,148,242,65,59,146,131,196,169,150,153,74,62,136,114,105,218,197,106,123,110,179,208,
+    84,38,3,157,234,225,62,18,165,152,212,63,244,207,12,24,160,141,231,61,196,2,45,84,208,197,229,44,205,77,87,193,
+    27,55,136,6,50,24,79,222,3,137,75,31,58,2,146,253,6,159,113,148,39,11,7,142,169,153,100,148,14,198,175,62,
+    181,112,122,12,1,180,250,118,226,150,50,220,253,209,126,104,36,223,32,208,234,15,82,166,47,9,63,15,213,46,60,114,
+    232,10,7,186,203,23,196,230,115,39,55,118,240,106,118,14,253,69,230,208,158,173,233,229,236,68,184,205,133,158,231,100,
+    233,140,99,51,126,224,208,67,104,147,110,113,181,175,203,246,104,13,196,235,161,169,55,114,193,172,216,4,253,208,52,149,
+    128,106,223,53,61,171,101,178,32,245,155,218,86,226,101,18,181,146,49,159,1,153,65,15,135,161,142,8,72,11,239,25,
+    116,17,129,27,226,237,239,112,122,29,46,81,191,94,214,220,34,223,36,159,101,115,169,231,72,221,249,83,102,33,0,237,
+    195,118,212,81,218,150,112,245,206,123,246,153,247,49,89,252,55,201,180,217,235,226,169,230,215,236,243,226,144,196,142,50,
+    211,249,147,129,183,194,140,126,207,254,252,162,81,129,49,209,37,131,173,52,39,131,134,252,58,193,148,134,44,248,36,218,
+    25,154,113,134,215,218,23,98,39,21,19,57,219,220,31,92,177,54,78,194,196,63,183,129,101,148,188,36,246,61,178,192,
+    232,239,114,154,159,219,233,74,111,204,96,74,245,23,178,119,169,2,208,36,134,40,246,132,214,197,54,20,58,131,197,208,
+    219,202,182,169,81,228,203,35,218,225,153,0,80,214,194,36,117,172,251,1,58,50,164,17,97,17,92,62,125,124,191,125,
+    117,158,92,240,46,117,80,104,235,147,235,110,235,121,31,76,198,34,180,210,46,74,206,230,137,79,149,66,79,64,70,237,
+    37,52,111,178,95,66,248,165,46,58,145,141,182,107,26,203,234,236,84,125,172,175,136,39,60,85,67,114,182,166,225,34,
+    50,90,176,106,146,18,86,199,55,64,180,23,57,44,47,235,229,65,66,97,32,16,130,216,132,117,86,185,158,79,201,176,
+    252,109,10,57,166,98,76,163,197,138,225,137,193,108,174,203,57,134,112,47,208,84,205,169,94,134,181,21,198,64,195,155,
+    48,222,24,34,166,237,175,170,65,221,217,246,57,85,242,92,189,117,27,233,248,35,46,48,149,110,25,91,5,17,186,238,
+    184,64,26,49,52,202,88,234,20,128,246,62,233,129,141,71,196,121,88,24,39,18,6,118,237,105,96,232,41,81,145,197,
+    162,10,83,93,51,104,138,90,39,221,76,142,103,69,187,108,23,66,196,121,169,52,75,177,3,69,201,106,167,160,123,124,
+    105,83,20,112,203,132,223,118,110,175,240,115,174,236,239,72,104,94,207,241,200,175,24,19,91,238,251,26,219,85,6,141,
+    224,51,55,247,162,240,19,145,148,49,80,120,239,61,33,14,225,234,175,190,124,209,164,232,185,51,113,88,93,201,132,96,
+    243,149,111,236,79,210,228,54,152,18,26,87,88,129,237,136,185,10,172,141,77,150,193,198,91,7,196,108,15,248,242,50,
+    55,167,177,81,186,250,85,209,62,19,246,223,243,43,18,229,54,194,237,218,225,42,108,137,55,211,202,75,136,216,36,202,
+    70,140,30,105,44,136,168,58,136,5,6,104,80,4,13,66,104,178,118,43,22,71,36,127,18,45,190,58,232,179,1,3,
+    190,74,72,75,113,189,217,148,178,89,214,240,199,2,8,5,154,40,234,80,207,97,208,17,165,5,65,68,126,235,178,48,
+    17,216,50,105,211,178,215,246,36,217,249,40,204,87,101,82,215,11,13,225,211,131,0,79,190,130,203,152,234,1,54,10,
+    221,82,108,255,55,114,190,14,202,81,125,243,44,102,76,153,208,228,165,86,149,203,70,147,236,54,175,240,216,222,88,81,
+    234,174,120,155,163,113,26,80,184,114,215,100,150,127,236,139,149,15,121,195,204,96,208,113,99,105,84,193,202,67,239,244,
+    99,78,169,218,41,225,183,56,130,80,10,221,56,17,2,142,54,116,17,104,139,174,146,207,44,179,158,55,151,28,85,62,
+    146,219,223,231,130,240,160,230,246,162,69,27,150,43,159,60,40,85,70,9,32,32,167,179,237,122,78,202,128,41,177,114,
+    228,116,60,208,51,58,122,160,220,233,231,205,219,167,205,206,211,229,211,174,247,151,213,192,250,237,184,184,237,165,21,77,
+    91,138,222,171,81,239,21,1,145,9,219,42,106,214,222,246,64,122,221,188,96,126,174,209,172,165,215,184,235,219,86,145,
+    39,105,13,47,255,197,39,167,54,106,213,232,83,101,58,4,105,54,219,45,90,7,162,88,80,47,122,223,17,3,93,32,
+    111,56,126,197,193,59,179,218,144,50,239,137,164,119,252,27,178,58,187,15,246,78,188,235,174,135,172,209,144,44,35,135,
+    50,252,64,15,115,105,63,53,69,162,89,160,107,154,179,202,133,185,221,110,45,160,55,196,132,137,144,176,45,59,153,38,
+    34,61,127,230,85,22,158,225,128,253,237,26,73,47,209,247,212,205,145,13,69,162,209,105,45,162,159,30,225,65,16,227,
+    83,198,162,31,13,97,35,236,85,212,125,112,26,99,146,205,144,225,199,10,118,153,10,22,155,213,103,99,160,20,237,179,
+    131,78,219,23,75,201,121,191,112,180,181,59,0,181,192,194,143,67,32,70,157,251,218,1,161,161,120,7,143,39,223,18,
+    148,161,58,85,107,62,196,18,186,100,126,147,206,222,14,236,180,96,99,69,25,166,255,190,68,211,110,130,108,57,106,131,
+    91,194,34,196,52,168,88,179,199,125,52,194,253,112,89,211,187,64,54,49,179,34,169,58,73,69,255,251,251,224,235,172,
+    169,62,176,77,163,17,139,174,164,11,180,83,90,244,123,137,213,141,137,82,106,255,147,247,54,205,132,196,14,63,147,214,
+    36,189,103,188,117,10,10,108,214,19,196,34,108,214,131,87,184,59,246,53,148,96,115,83,84,224,83,197,38,235,78,134,
+    97,12,66,25,229,39,210,155,162,208,188,51,101,177,2,231,110,219,167,229,215,167,147,236,212,233,56,121,57,27,54,32,
+    219,134,63,234,77,217,25,143,216,172,55,41,35,28,236,34,121,76,22,131,77,250,61,39,116,67,185,3,11,108,142,66,
+    97,154,131,30,163,188,167,118,70,207,162,5,52,120,61,107,102,236,25,24,50,65,25,44,100,72,77,10,74,205,200,53,
+    98,62,101,130,74,130,198,63,109,51,174,186,54,66,201,88,237,32,62,158,111,95,80,33,226,44,41,73,50,152,132,35,
+    148,68,216,187,67,202,165,168,79,88,176,1,234,152,166,154,150,176,234,114,238,224,243,233,104,144,5,41,155,55,42,150,
+    135,193,153,2,213,125,66,103,118,93,112,213,242,222,135,100,100,90,230,36,159,155,88,31,85,139,26,229,159,200,18,53,
+    253,97,243,117,20,78,192,184,190,100,231,160,247,74,7,57,5,247,20,206,193,35,33,203,197,129,43,76,9,153,14,16,
+    121,223,161,129,152,231,188,246,18,151,184,45,138,233,75,70,178,147,167,33,245,142,16,136,235,151,89,214,45,137,16,233,
+    54,41,120,232,178,217,0,97,78,222,188,166,117,150,166,65,128,220,182,106,101,65,51,79,139,226,62,27,112,174,79,209,
+    158,33,41,29,202,21,253,218,157,50,168,144,204,57,64,212,97,80,186,148,97,20,244,213,118,12,226,29,50,58,221,146,
+    238,230,42,254,105,67,35,44,61,30,56,59,111,47,204,232,3,37,49,37,164,80,176,195,37,201,227,9,189,118,137,169,
+    253,202,120,72,74,191,241,172,182,213,129,167,236,46,169,142,185,211,153,126,233,156,42,193,92,16,7,82,250,142,143,51,
+    59,27,183,88,168,7,246,231,72,107,184,148,20,63,3,63,251,214,187,127,73,176,200,132,239,192,97,54,9,221,18,194,
+    64,150,110,45,209,113,148,219,112,151,46,126,38,27,25,53,133,181,119,233,1,159,81,212,186,89,16,2,133,7,90,234,
+    115,89,64,131,126,43,14,9,72,164,221,55,22,85,9,32,75,125,132,181,3,112,34,5,140,45,83,37,10,156,68,31,
+    96,30,50,126,5,61,4,8,13,46,47,51,2,133,210,21,212,26,11,80,1,221,40,65,123,100,42,41,111,254,106,177,
+    122,252,36,150,231,145,25,173,213,132,35,56,143,226,34,164,18,35,220,135,63,101,126,44,81,82,169,73,207,207,253,9,
+    85,86,219,126,57,95,97,127,129,58,121,117,45,80,130,121,127,107,221,2,136,89,80,127,96,182,107,25,106,199,81,83,
+    134,64,57,138,143,195,163,43,210,64,96,2,194,13,161,20,213,197,247,155,216,54,162,180,193,194,241,135,130,212,28,62,
+    43,160,27,13,173,62,53,27,34,174,211,240,169,73,31,159,15,94,68,218,183,160,16,163,5,88,223,179,160,183,167,123,
+    84,154,208,120,5,160,64,70,68,113,206,172,179,87,204,230,47,243,209,164,89,181,180,46,186,142,202,161,20,83,154,198,
+    48,141,186,170,184,217,253,5,180,116,225,139,96,85,91,23,11,7,250,82,107,250,54,129,2,8,171,153,90,206,81,132,
+    35,121,187,189,32,115,181,135,228,187,178,173,47,193,166,10,43,110,29,248,223,255,176,195,166,26,149,216,171,111,228,197,
+    171,19,52,231,188,157,19,158,191,51,239,154,229,68,136,136,181,34,75,8,236,12,30,199,50,84,79,27,224,128,30,226,
+    136,155,159,128,155,80,127,73,108,189,197,105,152,36,175,178,250,148,139,100,183,95,151,149,23,156,123,32,242,246,161,184,
+    22,59,246,27,50,199,124,136,210,218,52,105,166,192,228,147,94,156,180,23,46,94,125,131,142,151,172,24,241,138,65,60,
+    215,1,176,17,142,58,71,55,91,150,144,122,177,73,138,95,95,130,223,15,172,99,157,27,134,153,104,127,224,253,125,207,
+    126,189,182,241,120,145,159,235,18,28,72,18,60,234,22,21,10,95,104,149,9,61,69,163,210,120,116,203,125,36,85,234,
+    177,109,58,156,248,16,197,56,53,86,103,210,197,97,44,21,244,214,123,221,63,200,233,97,126,208,222,71,1,108,56,41,
+    91,209,129,89,5,54,231,205,200,113,234,155,152,126,213,75,36,41,233,34,65,72,215,119,0,6,178,253,11,66,216,14,
+    214,175,110,213,212,17,208,103,161,100,183,71,196,17,41,161,219,154,14,217,5,91,185,221,104,150,141,68,54,209,216,202,
+    61,198,127,179,26,241,184,201,170,140,249,44,190,201,86,130,213,11,167,46,145,242,146,129,83,19,160,228,53,254,121,93,
+    197,199,209,88,235,42,188,95,106,53,224,187,131,246,15,237,103,210,193,4,118,183,178,41,203,133,59,109,197,174,15,191,
+    197,146,218,50,81,4,214,189,218,188,167,32,47,113,167,115,12,197,6,131,28,168,194,9,31,64,74,226,166,26,30,121,
+    110,30,109,45,101,152,31,81,71,221,149,21,111,236,24,75,190,52,26,211,49,227,152,29,107,63,164,8,3,139,146,164,
+    157,89,92,151,31,190,200,14,109,57,22,158,33,78,174,77,237,248,176,18,113,119,217,144,142,94,177,15,74,181,209,220,
+    147,90,191,23,246,86,125,159,151,72,80,231,238,163,103,104,144,167,113,10,129,19,41,248,129,182,145,102,13,180,154,233,
+    245,89,128,223,224,227,235,108,254,85,232,56,209,214,26,253,136,15,191,0,229,220,90,204,101,19,8,26,192,197,191,176,
+    121,23,17,36,22,3,204,81,96,9,119,153,249,209,192,29,227,215,106,74,178,242,4,25,17,223,8,18,201,107,189,199,
+    119,63,19,240,94,185,239,247,176,221,161,146,69,86,76,99,241,67,216,190,138,71,92,49,97,166,202,185,188,77,137,153,
+    240,186,177,101,177,94,114,27,32,68,254,17,23,218,21,116,181,48,88,154,31,202,36,127,253,255,127,121,6,18,54,236,
+    32,152,178,65,172,192,205,233,99,110,228,165,191,43,59,239,94,69,168,74,202,162,213,160,111,89,238,26,44,5,219,132,
+    18,232,244,31,241,199,221,141,19,172,48,249,192,7,166,206,49,19,252,12,26,50,253,173,40,196,114,63,74,23,5,110,
+    177,59,118,80,63,222,36,138,183,40,253,219,41,218,53,133,232,206,13,183,7,177,253,26,221,192,146,8,133,112,51,25,
+    169,181,181,108,14,36,61,36,67,100,181,151,11,31,145,50,248,198,168,67,52,149,75,231,51,25,85,235,71,29,242,218,
+    184,54,64,168,213,220,189,108,4,169,129,250,42,143,246,196,181,109,56,164,89,138,116,202,13,121,22,203,118,117,156,203,
+    66,217,53,229,74,81,235,230,77,179,61,244,3,87,200,157,77,109,211,142,23,119,116,3,45,204,148,178,125,112,243,104,
+    143,111,243,225,205,106,0,168,130,1,144,53,188,15,125,243,60,38,171,63,54,199,184,76,161,19,171,244,42,235,130,130,
+    211,143,33,48,151,197,54,180,216,134,44,42,60,235,234,238,217,236,193,81,132,72,64,77,88,88,209,128,121,209,72,1,
+    125,66,97,118,178,93,106,242,50,28,167,17,103,22,137,124,51,227,183,201,118,254,212,109,28,42,183,52,70,84,157,104,
+    29,58,199,75,115,31,181,37,215,80,30,12,60,61,251,0,218,144,203,242,45,63,129,193,198,211,222,244,107,195,84,87,
+    137,25,106,27,110,122,234,28,128,22,199,245,241,66,250,158,151,112,94,10,34,67,47,72,16,91,111,143,62,82,184,112,
+    188,188,122,85,160,5,112,77,190,174,173,150,174,111,247,43,241,155,49,153,10,121,128,147,222,35,162,115,86,193,154,229,
+    184,66,206,62,232,231,54,25,234,161,196,34,171,209,103,24,169,209,170,220,232,151,111,29,225,125,193,179,150,102,97,20,
+    67,13,163,133,194,44,180,149,46,126,167,169,114,222,187,32,183,118,30,180,106,33,67,95,139,165,232,145,172,37,215,31,
+    219,252,242,156,94,99,189,106,220,88,232,159,70,81,253,105,161,120,143,113,200,115,103,125,150,153,1,4,220,120,63,125,
+    153,157,78,78,57,25,48,142,106,32,107,76,56,85,253,178,143,226,13,226,172,81,191,8,97,225,17,50,79,215,128,70,
+    47,29,6,225,188,0,37,238,20,185,81,241,59,84,31,74,253,193,77,91,126,57,212,73,162,247,182,160,227,76,56,199,
+    151,234,199,100,130,130,191,166,172,160,207,167,191,227,185,193,160,29,183,223,32,56,95,0,26,213,146,191,126,26,200,16,
+    30,193,105,158,115,29,203,49,172,236,124,64,249,196,98,58,163,183,56,152,56,78,129,101,54,7,40,146,28,2,244,103,
+    26,32,73,28,238,204,156,80,205,25,71,4,40,37,162,99,230,175,7,185,121,53,144,34,69,125,133,229,246,240,13,200,
+    73,123,233,80,129,90,167,120,71,255,113,241,176,66,41,112,112,58,79,80,77,206,212,144,57,43,197,225,105,216,221,168,
+    7,23,108,197,19,142,172,58,37,79,110,170,126,202,155,136,49,126,23,212,17,87,64,108,59,112,132,213,34,14,56,33,
+    44,188,57,166,15,195,253,243,213,147,56,97,174,6,251,231,198,55,203,56,198,255,127,251,213,48,208,67,221,37,220,171,
+    194,222,169,182,255,57,191,190,98,59,206,191,149,41,27,35,99,193,254,109,185,21,191,91,35,176,93,220,188,173,53,249,
+    199,129,90,24,213,85,48,125,213,183,179,38,43,95,76,3,24,114,56,140,39,47,18,127,27,84,76,46,98,195,114,54,
+    24,22,244,96,166,254,169,159,184,168,234,140,10,60,219,74,45,16,132,168,114,25,106,177,155,192,75,153,254,221,203,42,
+    109,40,211,90,249,67,221,76,106,34,183,182,181,128,124,1,99,85,197,87,169,83,103,230,152,132,109,165,227,89,243,213,
+    237,141,98,190,68,4,125,167,231,135,77,62,76,118,244,175,149,181,76,198,114,137,63,52,249,153,115,26,9,222,202,148,
+    55,24,225,76,252,11,41,83,216,28,226,46,7,84,110,9,95,4,241,242,242,22,6,154,190,11,233,253,7,23,44,191,
+    140,17,238,55,218,59,57,83,253,111,43,153,78,27,247,177,230,254,208,106,89,216,71,22,16,124,48,75,190,126,23,72,
+    183,205,8,245,162,85,145,205,240,130,191,188,151,176,222,34,58,254,123,187,77,221,113,40,110,172,191,193,179,33,177,52,
+    73,204,162,100,8,226,249,51,68,197,234,207,136,35,242,130,175,195,67,78,141,113,193,29,255,234,67,53,134,41,18,118,
+    23,211,118,182,73,33,241,174,36,142,76,20,105,67,63,136,25,217,229,176,124,160,147,21,83,72,242,22,46,168,46,162,
+    0,239,8,205,42,63,212,9,99,178,31,18,209,208,130,198,165,199,111,50,31,117,226,51,135,136,231,0,85,237,59,237,
+    18,203,250,41,251,242,87,150,61,174,1,96,213,182,113,154,52,155,4,170,8,206,124,49,191,182,243,157,12,170,35,12,
+    41,155,246,60,161,154,30,170,81,252,233,230,6,109,144,17,60,246,93,44,33,113,72,121,188,24,185,108,6,96,41,100,
+    45,27,130,3,61,131,43,253,46,0,14,198,130,174,253,105,21,95,176,183,67,188,242,221,70,173,22,176,99,189,140,91,
+    3,169,180,119,51,135,36,81,176,162,58,88,81,97,199,82,46,222,200,91,43,79,15,48,67,144,55,148,61,95,104,241,
+    167,247,40,245,221,111,120,160,166,14,158,245,73,73,222,63,37,176,157,141,69,200,54,247,46,182,183,162,11,164,183,126,
+    46,125,49,157,118,62,248,111,97,128,167,118,218,8,115,38,10,141,189,125,151,168,114,64,220,36,104,150,194,94,73,230,
+    54,216,201,140,186,43,178,186,172,21,134,185,184,20,198,83,175,140,24,1,175,1,218,89,140,191,217,155,177,250,206,36,
+    106,41,173,232,115,114,19,111,218,130,45,216,6,163,24,31,218,207,30,114,36,201,243,198,66,175,97,29,32,169,8,244,
+    101,250,114,31,90,31,150,83,2,208,183,229,239,76,45,153,110,220,185,44,227,118,138,150,36,178,195,101,164,68,57,32,
+    140,87,172,110,20,175,80,79,190,63,188,150,28,113,50,144,185,43,46,77,183,79,180,155,176,44,42,227,164,74,3,203,
+    49,69,242,250,47,133,77,227,171,169,244,127,224,123,99,152,102,80,160,18,226,248,206,144,227,104,194,161,154,200,43,243,
+    41,123,177,161,221,221,142,86,33,197,29,117,163,63,220,83,183,92,164,204,178,56,10,186,130,170,77,127,171,95,196,76,
+    217,93,95,153,245,90,155,24,153,121,32,3,19,99,208,10,191,26,156,122,254,195,6,97,131,122,95,108,239,59,94,184,
+    107,80,31,219,255,224,81,74,99,22,206,169,213,126,240,65,103,1,120,79,239,209,198,205,102,27,10,205,181,119,4,90,
+    123,6,23,24,64,120,22,141,230,218,91,228,20,214,183,164,212,212,84,84,114,191,28,95,90,225,102,65,249,121,80,90,
+    96,230,183,248,230,102,58,173,149,116,179,99,209,44,17,147,175,143,69,51,87,210,114,56,175,154,142,78,145,32,114,29,
+    103,163,207,76,59,193,101,236,40,136,212,147,122,80,135,254,35,209,92,23,244,84,5,171,79,6,36,208,250,244,97,109,
+    95,7,138,166,47,105,93,98,228,136,10,145,117,104,155,66,226,13,12,162,237,30,103,201,83,124,116,35,155,99,219,130,
+    248,112,9,135,173,107,12,135,114,46,101,241,171,25,197,158,77,246,80,88,176,50,164,76,35,201,59,165,206,219,17,28,
+    59,52,120,162,215,42,95,252,36,83,34,166,111,25,149,132,59,77,143,17,235,98,216,182,215,135,105,103,8,137,57,175,
+    209,155,221,41,226,53,61,114,43,196,53,36,252,14,125,218,204,213,196,255,21,40,169,60,128,45,218,134,125,202,80,24,
+    70,184,211,150,176,219,1,222,134,210,196,172,184,186,152,4,29,221,104,250,11,187,153,84,174,210,63,148,27,69,215,111,
+    162,214,59,181,47,32,53,173,216,46,37,176,31,155,237,121,30,189,45,246,22,212,75,100,211,41,111,53,179,40,100,210,
+    23,30,246,115,181,9,76,193,41,183,242,91,3,107,112,81,43,4,187,226,254,122,216,89,182,120,139,98,107,227,166,171,
+    233,196,172,75,94,43,103,114,239,177,172,18,102,95,172,219,138,211,87,243,95,97,10,211,55,45,154,66,69,175,214,160,
+    60,32,89,214,103,206,76,174,248,8,84,21,120,45,66,144,247,2,84,204,203,80,197,153,241,148,132,106,103,124,232,83,
+    11,113,173,152,248,108,124,210,17,109,119,39,158,190,141,225,27,3,234,90,147,40,185,202,184,25,29,205,254,191,143,28,
+    253,157,121,94,245,174,174,20,98,170,148,167,185,140,117,147,84,99,220,170,84,162,200,188,82,115,59,128,89,173,3,240,
+    89,121,61,0,207,2,209,241,249,137,191,19,210,47,220,255,45,227,190,208,70,73,237,177,99,197,62,209,29,24,60,183,
+    153,43,224,31,69,133,217,39,146,77,245,193,128,124,0,49,72,245,116,110,29,89,21,101,70,248,82,73,21,17,102,167,
+    175,250,14,232,108,37,16,241,110,177,0,242,70,130,45,108,36,156,75,4,108,120,170,113,96,199,183,23,42,136,45,122,
+    57,71,65,196,215,21,108,235,178,197,72,223,219,131,113,6,148,136,96,40,59,131,114,157,202,60,247,3,79,241,54,90,
+    2,200,89,35,210,243,246,128,36,198,73,37,232,18,112,140,52,192,242,136,133,201,108,76,35,157,173,32,5,61,3,53,
+    62,157,246,138,115,97,48,190,100,115,104,26,101,86,231,154,179,31,120,30,67,138,233,90,32,243,190,125,2,243,181,95,
+    55,124,10,5,42,180,141,241,24,0,182,164,47,198,90,208,23,168,10,105,158,64,22,197,196,219,177,83,59,62,99,174,
+    182,187,6,136,26,168,216,162,10,215,170,95,122,150,240,18,61,86,50,61,208,76,7,14,73,154,21,162,110,119,15,88,
+    164,197,48,243,37,67,119,109,165,212,218,82,165,29,17,252,248,89,192,80,215,0,104,122,63,180,56,87,8,27,63,248,
+    101,120,106,157,153,160,175,171,186,225,99,137,99,48,152,109,174,132,160,122,210,146,149,33,4,129,113,13,117,92,212,174,
+    62,211,126,114,178,108,22,168,111,34,207,152,116,223,30,216,85,251,228,206,127,150,36,32,253,227,226,132,119,216,227,107,
+    106,91,247,95,2,19,238,8,237,130,211,252,238,145,232,31,250,179,19,183,20,103,253,244,89,237,195,44,22,223,238,68,
+    98,232,30,94,81,106,243,78,108,90,193,145,249,76,251,142,140,23,183,1,186,110,44,240,133,30,222,42,26,49,104,4,
+    84,57,173,47,17,54,216,102,92,59,188,254,112,114,179,77,203,129,175,247,115,204,135,242,187,35,63,55,163,48,231,220,
+    129,15,249,102,56,183,97,201,96,37,232,253,34,139,65,24,194,85,255,254,53,84,114,19,49,125,236,94,181,61,131,34,
+    62,120,254,233,135,220,76,35,55,98,188,188,152,234,211,83,78,27,184,23,221,161,32,217,51,30,185,212,188,72,179,37,
+    212,82,191,17,250,235,130,122,198,18,47,200,4,117,125,71,181,17,87,125,161,102,49,134,157,236,148,93,237,6,61,186,
+    235,195,216,175,207,153,77,136,255,192,8,215,234,248,87,155,231,239,169,223,243,231,139,90,238,74,239,65,29,221,14,80,
+    232,36,80,68,20,179,45,132,239,55,229,131,29,182,91,31,178,76,22,214,72,237,55,66,213,225,52,45,134,243,74,199,
+    197,227,189,228,214,167,232,239,16,117,19,94,232,0,214,138,24,199,87,227,35,106,124,52,175,206,233,159,236,109,246,224,
+    57,251,246,144,147,144,64,253,36,133,149,213,127,115,24,162,193,146,112,3,51,127,13,155,37,74,1,199,118,43,100,35,
+    34,90,161,53,36,109,153,147,162,229,157,115,62,110,17,58,106,238,12,83,232,111,99,149,217,17,21,94,67,34,223,155,
+    31,186,111,245,77,103,133,241,186,200,115,44,125,117,79,218,122,233,110,172,19,51,116,190,118,58,101,179,207,244,209,217,
+    21,35,0,151,208,235,219,148,29,76,108,242,22,45,191,253,146,119,116,111,29,81,255,58,206,157,132,10,106,66,129,190,
+    23,108,82,226,231,10,228,224,83,217,67,61,27,79,187,34,122,91,49,76,80,154,123,59,196,39,164,104,194,122,79,21,
+    203,40,181,189,124,87,247,136,122,114,219,166,220,150,224,237,207,62,41,147,181,240,15,88,7,55,102,224,7,91,131,29,
+    140,246,125,148,182,198,221,172,156,242,70,7,135,218,238,84,205,87,36,52,160,222,206,219,68,108,124,145,80,124,197,109,
+    68,1,97,46,170,224,50,197,68,201,102,61,189,64,29,164,35,9,228,129,171,84,191,130,46,13,254,129,52,157,94,23,
+    222,199,94,60,91,150,162,119,215,157,175,90,229,177,172,227,88,81,25,142,226,230,0,146,25,126,213,51,221,153,42,159,
+    28,109,87,186,71,200,132,148,158,147,69,86,67,144,17,170,0,157,95,236,18,61,9,83,23,112,66,204,126,154,206,219,
+    13,138,103,189,172,162,145,233,79,177,115,130,176,133,151,178,27,173,213,143,62,252,173,121,50,173,9,207,236,146,132,26,
+    115,169,149,104,233,170,135,118,89,182,65,214,78,95,121,114,240,102,68,31,80,49,224,152,249,223,36,88,11,45,2,210,
+    125,24,44,5,90,42,164,182,175,19,93,148,98,50,0,188,60,224,53,1,114,57,51,163,111,67,36,223,123,180,170,246,
+    128,78,116,136,123,58,220,53,207,41,17,221,78,17,30,108,196,47,22,207,228,184,167,55,127,85,113,127,77,157,45,58,
+    165,247,205,253,129,248,139,161,109,195,84,210,94,122,217,231,223,184,51,178,54,152,209,142,37,182,43,181,110,41,82,16,
+    251,69,106,40,79,242,214,215,55,68,244,136,80,47,197,114,17,74,249,150,236,248,191,157,1,196,208,88,87,214,238,65,
+    11,207,0,150,92,137,138,190,247,192,3,135,81,233,63,177,12,104,242,68,9,98,50,142,3,92,190,38,7,5,57,76,
+    26,13,199,119,3,121,229,187,61,2,83,204,218,116,62,212,182,9,86,232,29,138,57,141,29,194,2,194,21,250,62,237,
+    31,55,190,101,28,123,131,255,26,44,31,111,222,107,61,228,188,2,168,141,196,92,89,129,201,212,154,46,86,180,207,188,
+    72,161,11,76,90,203,208,221,4,87,15,100,16,14,76,26,124,111,37,58,47,35,225,90,139,101,4,165,200,107,73,202,
+    22,26,149,228,57,96,5,235,189,13,87,123,131,175,29,75,182,1,229,171,202,30,200,117,61,125,224,179,251,209,121,173,
+    113,142,228,43,27,205,84,9,126,130,224,171,154,237,33,163,178,235,169,185,106,188,198,160,12,132,120,198,179,195,133,177,
+    44,182,246,205,180,90,193,181,124,36,133,219,179,248,65,77,140,209,133,201,70,102,85,11,138,199,131,226,168,48,169,10,
+    220,214,201,65,200,239,65,36,69,195,16,90,235,236,184,136,234,216,21,153,239,205,23,195,21,193,47,207,144,33,189,88,
+    20,213,88,228,131,229,61,19,228,127,254,214,63,129,148,136,110,72,214,239,30,153,81,38,36,125,183,20,40,65,58,74,
+    245,41,252,173,192,209,221,112,114,27,188,35,4,242,195,215,28,14,109,230,181,235,211,77,150,133,35,49,17,49,2,255,
+    15,15,204,249,248,243,247,214,48,52,97,145,253,81,153,227,61,64,219,164,176,99,30,92,39,239,255,38,240,192,139,81,
+    35,126,106,67,219,235,144,83,253,30,112,237,177,0,90,163,56,86,65,233,59,110,161,251,57,25,34,166,139,234,110,105,
+    104,206,65,77,46,11,134,227,38,54,142,128,36,129,1,66,50,52,94,96,118,1,211,101,253,216,54,12,112,183,254,130,
+    166,92,135,89,231,125,87,185,74,202,62,105,30,148,220,5,255,237,190,9,180,10,107,125,226,125,71,156,237,66,2,36,
+    246,50,36,95,245,143,135,122,30,226,82,43,241,197,102,130,35,38,107,149,232,239,87,215,33,48,120,155,137,121,68,130,
+    173,210,14,0,203,133,118,206,157,166,177,114,236,139,55,49,3,79,22,152,220,150,118,50,170,223,234,88,53,171,119,97,
+    162,164,238,151,239,211,71,237,188,95,225,147,110,104,108,185,183,84,131,217,232,74,105,28,183,149,105,4,82,106,115,43,
+    185,158,16,125,160,224,223,32,53,128,165,251,88,0,40,48,165,242,147,80,218,103,183,149,59,62,241,91,140,95,237,151,
+    21,179,41,182,136,209,69,242,19,230,61,108,115,245,227,210,127,250,195,111,15,199,77,176,117,43,192,166,211,20,176,187,
+    91,50,13,141,196,44,146,146,134,253,106,224,94,47,36,182,153,119,51,229,64,200,40,240,137,112,190,172,203,212,138,250,
+    176,99,91,64,206,170,19,246,23,77,153,115,22,23,189,252,21,235,159,221,204,12,100,253,202,31,60,142,72,107,29,60,
+    191,134,118,97,54,164,78,119,183,183,197,116,131,186,77,173,187,210,238,24,20,138,196,230,8,61,118,89,148,15,117,232,
+    210,250,217,174,188,101,173,192,59,250,69,16,212,3,4,84,7,198,98,67,205,227,140,85,78,192,200,233,74,188,37,18,
+    202,204,204,231,161,188,241,17,85,207,189,74,230,135,165,126,178,191,222,60,185,150,204,69,247,32,31,96,35,155,174,6,
+    192,159,174,151,152,186,19,98,184,233,0,92,101,42,46,125,166,242,159,89,227,209,76,139,101,126,223,243,68,139,101,134,
+    146,158,65,74,78,23,214,226,236,96,73,180,44,222,103,56,224,107,86,243,218,128,34,117,4,115,167,134,8,200,142,123,
+    131,84,102,83,122,204,218,30,133,69,110,163,38,20,149,171,194,185,204,129,150,3,209,237,11,57,66,34,137,248,150,16,
+    223,174,202,20,254,68,216,39,222,180,200,214,163,182,84,42,255,212,129,221,83,112,52,50,255,204,62,222,153,58,205,49,
+    177,165,184,11,43,54,131,199,16,178,185,29,244,31,69,49,92,106,172,88,81,155,224,101,116,68,166,67,148,196,5,144,
+    169,93,60,129,158,158,35,15,117,180,97,94,105,55,27,203,26,181,177,253,228,35,28,181,25,189,185,53,137,168,155,160,
+    19,128,28,220,188,199,28,169,55,157,246,98,81,37,158,123,72,135,230,222,87,103,228,131,222,154,248,11,203,53,92,237,
+    108,240,103,233,81,24,47,170,146,65,146,98,249,253,56,84,14,106,134,105,57,205,203,74,205,72,132,47,72,17,149,217,
+    141,220,222,62,79,133,98,79,18,209,132,120,194,58,96,2,247,202,219,197,123,191,78,178,218,200,159,165,239,141,202,126,
+    232,71,217,115,240,167,190,237,108,31,217,160,49,79,123,208,131,211,95,9,83,73,214,187,134,194,19,158,18,219,214,26,
+    112,32,167,47,218,47,16,88,24,32,186,162,23,32,5,97,117,9,162,167,92,241,140,47,2,241,138,241,211,123,166,6,
+    3,179,15,94,6,92,213,54,48,87,13,52,27,102,51,53,26,115,220,175,65,45,43,4,173,120,197,168,44,125,168,200,
+    166,117,242,187,129,194,165,117,18,8,84,155,95,96,66,119,252,252,255,42,254,145,189,115,238,96,142,107,228,74,147,174,
+    236,153,235,176,249,105,38,8,95,177,160,47,109,200,132,46,191,56,31,103,66,150,221,148,81,60,107,194,230,123,43,206,
+    220,144,105,210,253,88,212,27,69,181,101,159,112,124,164,12,59,108,137,249,242,27,162,252,14,111,219,159,187,39,219,8,
+    223,195,225,4,220,39,90,46,32,157,224,206,240,12,119,196,46,144,213,149,244,42,62,114,250,223,58,28,129,12,113,229,
+    111,215,90,253,59,221,144,151,102,212,230,7,80,232,22,36,98,164,190,50,83,137,97,77,166,96,153,166,95,235,211,241,
+    124,41,240,177,45,220,66,253,22,181,188,9,202,161,81,233,82,165,152,120,223,110,13,48,95,173,223,7,241,238,251,105,
+    60,57,62,236,251,102,123,74,193,60,27,130,177,56,194,245,164,248,1,190,223,84,170,200,50,123,4,135,235,238,195,86,
+    138,174,4,148,212,142,139,120,75,94,114,149,180,189,45,52,32,179,124,32,148,34,162,231,63,16,193,218,41,108,110,142,
+    50,202,63,92,153,226,5,238,151,127,35,8,235,37,154,88,145,228,133,73,228,181,212,112,242,238,153,19,253,155,47,119,
+    92,205,55,25,221,155,4,121,44,215,117,192,202,89,212,178,107,255,246,147,250,153,110,231,104,236,45,185,162,232,122,39,
+    242,253,61,82,226,49,163,114,86,249,37,51,222,102,237,133,122,23,127,67,0,184,202,73,2,14,127,168,139,236,9,239,
+    168,161,121,91,152,248,133,103,146,171,239,97,224,12,170,30,231,183,239,212,122,110,145,17,47,229,29,87,113,213,63,48,
+    169,204,69,101,222,7,58,45,175,231,79,8,98,206,80,226,187,229,67,200,232,4,34,143,224,13,181,233,89,17,172,116,
+    144,134,172,226,170,173,137,39,121,48,142,85,217,192,146,20,62,209,100,98,217,241,163,178,164,225,242,64,138,118,238,128,
+    51,236,212,24,131,192,2,191,221,227,19,230,135,181,121,184,87,175,176,144,8,97,133,235,44,187,177,91,143,59,235,208,
+    232,59,151,253,28,163,198,47,245,36,53,90,0,159,29,42,246,128,41,142,85,63,143,16,205,137,170,114,177,137,156,25,
+    142,96,13,61,240,48,23,230,23,96,141,163,101,27,1,129,196,191,52,106,201,59,230,174,74,191,115,114,197,125,27,45,
+    183,139,80,129,157,96,49,240,8,203,243,16,154,85,224,10,183,162,169,160,153,141,233,165,176,190,112,227,186,87,89,115,
+    51,42,67,209,149,153,182,255,27,223,208,105,145,244,94,80,130,130,206,238,122,36,66,60,148,10,220,61,112,83,213,167,
+    66,204,223,234,250,168,157,203,229,128,197,248,185,206,183,196,233,137,207,63,236,31,81,235,206,149,2,176,124,239,147,251,
+    240,49,111,85,150,244,44,154,200,72,116,134,155,241,56,108,15,101,100,128,216,6,211,171,84,94,125,129,240,62,219,165,
+    21,159,108,134,214,20,165,98,97,70,71,33,52,202,103,45,109,113,44,26,157,114,34,226,8,154,169,72,148,18,79,32,
+    207,109,150,192,113,107,131,29,205,126,164,110,112,192,131,12,6,93,178,107,125,119,150,54,14,50,157,227,192,91,47,30,
+    12,34,156,203,129,250,246,117,102,93,82,103,154,23,159,225,98,76,149,11,140,8,255,32,30,149,57,193,42,64,17,94,
+    56,205,52,100,0,161,226,195,176,180,90,97,241,166,5,164,92,163,166,152,16,109,65,86,92,124,168,95,118,184,248,163,
+    167,190,17,151,6,138,185,214,130,13,88,129,251,11,22,192,17,186,90,67,235,217,142,189,10,132,180,101,113,192,205,32,
+    245,159,236,200,61,201,214,216,1,252,171,189,39,233,169,222,2,233,153,157,8,28,85,237,39,162,236,105,5,157,203,139,
+    163,237,91,184,144,89,113,91,160,113,128,99,41,14,156,95,15,194,136,165,54,192,172,149,206,213,142,108,39,245,98,183,
+    139,147,131,64,232,155,32,7,21,201,198,231,92,184,72,230,254,196,245,199,239,207,83,235,36,26,205,193,96,74,110,187,
+    132,154,76,20,75,101,120,9,32,182,205,118,82,122,120,233,171,233,86,201,74,107,69,177,43,98,227,44,144,238,206,134,
+    62,97,11,144,26,84,107,152,35,103,137,70,124,54,201,139,115,25,175,190,41,147,211,230,19,243,61,32,53,151,95,234,
+    216,55,139,163,20,124,95,3,20,86,42,34,130,8,248,89,30,103,208,153,135,161,94,85,12,101,196,222,75,168,185,125,
+    18,241,232,190,186,20,181,118,152,22,82,81,69,85,157,84,76,241,235,104,223,33,124,101,249,102,238,146,147,227,74,255,
+    70,252,229,115,133,36,78,155,22,173,192,100,92,123,38,32,111,134,106,19,61,177,222,94,73,181,27,114,124,48,208,9,
+    214,153,146,133,87,112,228,91,57,159,108,197,255,188,107,20,11,161,88,62,244,32,254,104,6,215,252,220,240,174,234,148,
+    54,141,185,66,112,76,119,255,59,189,228,10,205,211,209,136,148,184,112,60,98,255,245,40,82,163,33,201,233,225,7,187,
+    97,222,195,153,247,201,253,151,127,204,136,209,136,140,138,11,99,205,184,163,84,161,15,1,54,115,245,163,31,24,36,28,
+    102,190,157,182,43,111,39,15,2,183,43,11,140,72,107,53,90,119,159,101,252,138,229,184,166,238,212,204,140,128,47,124,
+    192,73,3,138,202,113,45,94,61,77,135,187,214,89,24,199,144,20,5,172,210,6,137,242,134,162,83,216,99,143,137,85,
+    112,200,62,221,125,185,167,117,56,170,76,242,140,194,251,131,85,235,13,87,8,56,212,156,108,11,24,142,0,153,126,149,
+    220,98,54,154,221,4,161,126,26,125,139,12,195,245,29,87,134,150,135,204,138,51,20,81,250,229,133,27,190,176,219,251,
+    16,148,49,175,133,98,0,105,124,250,187,17,141,254,151,91,76,216,236,148,17,238,154,34,134,76,103,82,246,192,191,225,
+    254,207,124,86,162,91,228,118,251,221,53,55,203,187,128,217,185,157,39,117,25,148,131,20,25,152,124,107,44,81,17,227,
+    237,4,232,124,148,127,80,102,199,163,218,119,101,174,122,199,205,39,231,29,115,96,191,23,165,54,69,119,109,4,234,132,
+    252,89,91,15,206,224,239,109,193,32,140,105,114,219,53,104,174,79,160,228,59,221,98,235,222,144,118,50,43,213,25,235,
+    186,144,117,243,64,48,162,12,110,85,45,171,173,150,165,40,89,179,38,79,213,98,144,126,93,196,136,83,99,193,242,208,
+    197,45,26,38,125,236,37,43,116,198,215,12,221,245,201,236,82,82,120,139,130,148,129,139,125,159,211,37,77,134,131,66,
+    242,34,199,40,226,90,6,155,240,54,42,240,77,250,14,146,151,150,56,42,181,21,38,126,207,64,18,203,108,192,131,102,
+    205,202,24,48,145,111,32,154,204,219,42,101,121,45,225,162,4,234,8,170,135,70,236,41,15,102,28,119,65,233,29,255,
+    216,162,236,168,64,115,8,245,7,74,13,220,149,202,35,13,218,182,111,63,45,149,65,242,215,232,174,21,128,190,66,34,
+    68,229,180,26,162,106,226,233,202,142,67,32,201,38,210,143,186,227,68,210,214,1,177,143,206,235,137,255,136,12,58,131,
+    148,175,137,163,132,153,145,97,174,214,221,42,241,223,153,108,163,218,12,5,120,70,253,107,65,241,27,217,114,80,182,67,
+    105,56,214,133,232,72,180,99,159,84,225,56,152,131,31,218,210,112,236,33,193,43,145,175,5,158,45,153,210,142,151,227,
+    223,95,5,253,69,180,102,186,115,69,238,254,34,221,210,39,115,104,224,229,158,12,97,64,12,239,44,90,135,29,108,79,
+    21,168,107,103,176,213,3,253,142,141,150,218,192,23,2,89,155,225,207,123,5,58,51,98,145,232,239,2,147,204,147,237,
+    16,36,147,248,194,17,34,111,155,163,78,191,45,13,139,251,22,147,195,179,100,42,92,108,27,229,203,174,122,214,167,194,
+    207,183,193,170,190,147,168,198,60,215,90,170,166,121,40,33,82,171,88,105,117,236,227,124,162,172,88,163,78,142,210,174,
+    140,60,17,89,237,232,103,248,85,13,22,171,246,196,119,210,119,119,252,200,21,132,162,33,154,115,14,83,116,132,193,146,
+    87,250,9,72,15,158,171,224,235,109,106,182,71,223,117,63,112,98,63,121,74,154,62,239,46,169,147,94,56,245,8,189,
+    175,239,54,178,196,176,198,63,170,152,108,38,217,136,7,77,183,128,89,121,157,22,39,156,139,182,154,149,193,132,44,178,
+    31,197,199,198,12,141,224,232,19,193,206,9,86,227,229,67,213,164,136,85,17,165,250,191,61,139,226,193,68,195,4,187,
+    59,144,250,195,63,241,11,121,219,240,83,102,64,96,122,195,8,15,72,191,85,78,66,74,118,46,93,221,128,242,24,223,
+    118,15,76,14,245,241,6,153,53,100,173,162,124,110,157,139,133,142,129,132,49,166,106,246,16,114,25,232,55,24,169,244,
+    16,0,154,119,151,31,111,102,199,85,58,40,251,97,189,223,161,204,203,73,128,45,74,19,167,199,52,251,161,219,237,217,
+    18,134,209,209,50,73,127,45,56,145,87,102,250,227,124,68,211,114,80,144,218,101,40,12,229,218,65,148,91,75,28,48,
+    70,182,238,132,81,52,217,242,191,194,195,168,33,173,76,80,182,198,105,212,32,153,250,35,176,208,158,154,201,69,181,92,
+    132,5,121,58,180,101,54,152,170,10,75,57,86,12,198,11,14,63,97,5,1,202,197,41,229,125,103,182,123,230,17,25,
+    123,112,187,84,126,70,184,74,28,89,23,180,122,208,238,176,64,25,16,127,116,219,133,28,190,167,98,60,63,83,204,125,
+    113,164,139,52,232,194,107,158,91,177,219,72,255,217,223,11,85,100,170,213,225,62,205,26,182,132,176,214,30,113,249,80,
+    136,185,157,221,46,91,238,177,73,146,53,159,0,146,205,57,9,225,45,17,152,135,142,108,118,224,38,77,152,68,44,224,
+    74,158,78,237,234,131,100,1,74,140,109,192,54,138,18,6,27,196,91,117,8,52,34,81,83,149,67,126,3,145,191,254,
+    84,134,86,113,18,77,186,243,79,77,15,18,6,187,79,230,90,229,214,4,188,58,212,143,227,190,47,73,65,190,105,156,
+    48,143,250,130,78,55,14,230,102,150,226,140,93,38,2,88,34,169,123,140,222,195,155,201,24,111,141,4,177,48,53,117,
+    76,193,52,105,233,147,44,203,75,212,180,13,243,96,53,87,90,80,54,188,31,110,119,78,185,132,152,80,135,182,127,136,
+    94,90,156,144,200,188,218,22,128,167,179,69,198,211,133,59,139,151,46,111,38,31,199,75,227,11,195,246,142,177,60,233,
+    198,133,212,46,121,138,111,31,47,6,147,7,115,158,25,27,179,51,212,107,111,163,141,111,55,46,193,104,96,172,166,103,
+    81,89,222,28,105,234,130,178,173,92,226,116,136,217,90,41,226,31,128,117,110,211,216,250,210,27,210,251,120,57,68,156,
+    141,239,250,236,87,8,67,253,130,226,41,179,184,141,119,98,162,222,236,238,249,192,33,226,161,153,228,152,242,183,5,71,
+    93,90,245,73,193,214,247,43,195,176,26,92,167,161,39,131,223,240,127,71,50,4,19,3,122,139,200,219,68,228,51,9,
+    223,139,195,19,205,159,35,109,131,140,136,33,69,140,208,108,153,152,1,18,187,150,9,131,90,61,38,99,48,135,32,25,
+    207,228,52,48,174,153,38,250,242,145,40,120,164,227,5,151,4,248,233,161,238,214,107,45,178,70,52,20,252,216,129,40,
+    215,176,248,118,183,198,139,228,220,191,54,88,162,21,55,24,128,17,125,20,54,173,41,120,229,212,131,54,166,91,48,177,
+    108,25,133,46,133,254,53,97,130,30,192,55,70,160,180,39,19,118,96,143,173,233,21,47,148,189,133,228,139,117,83,43,
+    207,205,230,16,131,25,136,51,55,254,254,196,249,113,201,195,169,59,221,101,254,35,78,175,161,6,222,174,123,210,253,201,
+    132,49,222,67,231,194,75,13,115,206,225,145,20,22,9,206,30,123,39,121,193,155,166,121,8,124,35,106,71,220,148,249,
+    214,219,42,88,199,92,220,36,207,31,181,172,90,73,194,46,24,174,183,104,132,194,124,149,17,162,38,148,161,216,99,114,
+    42,189,155,158,193,125,201,163,173,187,18,5,120,158,234,88,128,228,9,1,141,37,208,141,29,30,66,68,18,35,227,239,
+    152,230,237,176,110,154,228,50,25,45,224,121,102,24,76,254,101,242,236,92,104,177,255,73,40,59,204,170,155,30,211,40,
+    200,199,206,183,159,83,216,39,53,217,217,116,127,149,76,5,87,198,91,186,183,155,196,231,84,215,170,214,82,183,230,90,
+    67,63,166,29,108,75,100,103,150,23,254,4,138,56,62,14,124,120,230,189,12,172,108,39,214,28,255,178,31,143,249,155,
+    37,155,89,192,122,237,27,134,215,189,82,219,110,237,82,54,112,15,54,104,132,153,175,182,163,231,60,112,94,151,174,20,
+    198,230,43,37,137,121,104,79,197,17,244,99,150,98,72,120,176,16,97,239,151,86,223,112,61,184,237,134,15,46,97,172,
+    195,174,234,148,87,220,102,164,224,158,183,122,67,245,84,229,230,150,139,68,19,220,22,114,60,131,143,83,65,152,238,176,
+    180,8,22,219,157,15,1,177,176,241,25,220,133,192,154,70,133,174,3,219,144,198,202,64,167,89,4,249,123,95,91,207,
+    243,43,116,61,121,243,103,158,248,33,173,81,248,180,253,146,134,132,136,10,248,10,110,46,29,118,7,229,12,123,137,128,
+    201,184,181,132,94,163,29,137,117,205,246,185,54,183,26,146,172,194,56,59,153,230,45,17,33,113,250,165,165,165,169,130,
+    38,103,128,101,60,197,174,43,72,171,142,167,241,87,21,95,198,168,132,89,151,19,35,100,245,219,136,150,135,3,223,40,
+    213,234,52,10,35,225,62,114,182,243,51,26,139,160,94,111,15,212,125,246,36,56,240,90,136,10,33,194,205,51,54,250,
+    3,218,36,208,154,164,249,25,56,149,209,203,39,13,145,41,11,211,167,145,61,63,160,21,245,194,160,129,34,225,124,74,
+    207,53,98,126,136,59,27,150,69,93,39,240,25,14,137,152,230,28,86,9,71,33,199,118,255,104,125,231,118,151,145,9,
+    64,33,125,20,245,240,129,242,167,59,134,44,253,145,74,0,175,184,160,113,241,206,186,85,175,119,232,75,41,57,183,149,
+    139,170,237,203,153,75,8,230,112,240,149,174,52,144,104,230,9,246,49,138,25,180,115,107,75,169,211,213,141,89,149,43,
+    85,181,56,149,38,132,159,236,201,30,72,39,15,97,158,9,2,83,107,218,124,172,192,252,91,40,110,146,125,58,91,83,
+    88,111,30,23,202,47,70,238,51,192,90,190,104,46,241,116,36,195,64,235,104,98,175,230,208,142,208,17,215,28,25,241,
+    193,136,0,223,216,78,132,29,156,0,225,222,198,63,160,128,222,147,99,142,176,125,150,126,63,102,230,5,184,53,175,80,
+    254,155,228,202,148,253,32,196,208,48,152,44,165,49,155,75,245,78,144,209,109,120,217,180,136,175,113,211,150,184,177,25,
+    191,151,151,116,215,152,203,24,138,161,51,178,188,122,94,130,200,171,164,76,206,153,188,79,78,225,246,127,148,137,115,94,
+    67,7,81,46,112,219,133,30,217,12,77,34,252,187,51,62,83,192,150,21,172,152,111,142,52,4,225,97,105,32,124,113,
+    188,7,219,229,76,252,164,230,95,85,232,177,83,4,122,39,107,186,205,44,162,195,38,198,197,31,253,242,67,30,29,14,
+    168,166,162,245,123,97,106,19,57,213,52,78,37,118,164,17,78,226,76,88,107,67,170,232,188,216,138,50,219,40,75,158,
+    47,207,1,128,112,83,48,125,170,8,143,157,188,156,176,212,170,40,242,92,52,152,170,236,155,42,255,76,210,152,109,70,
+    162,204,144,248,209,186,180,200,92,152,227,252,253,119,36,0,99,243,1,168,79,57,62,105,79,62,143,5,112,206,171,185,
+    245,117,157,6,59,243,39,51,190,133,95,232,138,227,3,247,65,159,10,206,189,44,144,213,105,114,43,16,171,226,107,189,
+    107,99,60,152,97,141,199,225,255,92,28,4,186,77,57,229,243,180,116,14,175,67,199,68,165,28,39,61,17,103,0,197,
+    226,200,163,241,172,215,242,18,81,219,212,227,82,115,78,197,147,31,73,113,173,118,51,105,34,117,108,77,233,114,27,83,
+    207,50,132,26,172,142,83,123,162,104,213,253,163,0,233,162,234,124,206,45,180,87,99,113,96,29,4,2,160,124,117,103,
+    90,217,249,183,89,140,204,155,50,159,40,70,67,178,70,4,53,237,19,106,69,159,35,110,120,198,128,121,105,188,213,250,
+    17,196,151,174,51,194,177,139,230,118,188,105,80,197,110,72,247,113,166,109,201,198,113,154,50,240,52,202,156,45,219,212,
+    1,168,49,73,161,82,65,172,150,242,205,105,108,77,210,85,131,247,89,150,55,85,173,139,134,254,82,67,134,78,89,145,
+    12,26,151,148,35,70,93,168,82,146,113,182,203,165,16,145,5,194,123,120,218,187,189,21,33,50,161,87,118,151,244,64,
+    160,199,161,189,150,19,178,203,99,55,52,221,156,100,167,4,73,39,64,182,83,28,112,149,153,38,120,30,244,18,180,72,
+    87,64,115,223,247,189,163,144,158,200,148,143,206,61,220,84,114,33,95,137,197,111,0,211,198,134,214,254,51,117,200,104,
+    145,121,85,214,219,93,62,106,146,106,52,35,146,159,58,137,73,62,250,255,102,128,209,19,73,214,44,206,140,227,174,72,
+    86,168,56,200,107,154,94,79,45,33,43,63,147,8,252,71,208,226,203,10,21,51,213,78,166,226,136,45,110,171,185,204,
+    140,195,151,44,35,172,99,8,180,89,86,167,45,246,158,163,57,132,179,95,35,135,44,32,63,149,170,83,85,145,6,91,
+    127,124,43,144,49,134,111,91,142,16,28,192,148,97,7,18,42,21,30,208,207,7,54,181,46,5,121,247,211,253,167,184,
+    41,212,161,158,201,62,207,198,47,196,219,209,244,187,65,209,7,129,100,228,30,166,245,79,159,118,212,202,75,158,155,101,
+    203,35,207,204,150,167,195,50,28,95,68,178,245,231,26,45,183,58,168,96,178,179,24,241,72,219,117,164,24,149,74,134,
+    139,20,127,109,13,134,48,180,9,160,45,21,90,120,186,124,200,22,243,181,28,139,17,71,240,171,33,14,18,50,60,111,
+    236,125,149,215,83,235,144,122,232,119,124,59,38,134,112,9,233,104,189,178,79,237,29,92,138,28,76,92,95,7,0,137,
+    3,175,231,55,135,178,5,238,159,29,125,215,129,138,148,117,105,20,75,206,55,210,127,0,204,33,78,222,1,179,197,12,
+    237,113,114,165,150,31,225,92,145,27,23,141,18,76,34,88,115,125,3,91,81,40,128,144,251,121,109,67,3,194,33,178,
+    109,102,13,150,198,233,232,113,109,116,170,84,204,93,116,96,105,139,246,151,236,53,62,30,108,133,4,46,165,164,10,170,
+    235,213,53,45,30,238,24,182,126,253,130,121,149,45,157,165,232,155,216,89,52,195,6,171,127,168,143,56,62,77,204,65,
+    127,185,235,55,174,146,229,100,3,31,102,90,186,142,107,239,50,48,88,132,12,14,154,234,45,199,51,90,75,249,73,93,
+    67,46,89,241,104,240,245,237,198,78,81,235,212,215,35,238,24,58,135,127,108,87,72,151,12,62,140,102,120,65,214,241,
+    56,231,2,206,48,107,18,123,131,28,86,212,200,65,11,105,76,142,89,109,205,51,43,192,50,154,179,194,150,169,237,31,
+    247,244,27,105,114,159,6,90,60,126,154,211,163,169,46,115,204,78,152,193,110,55,83,117,233,44,62,163,30,254,142,91,
+    129,174,154,182,27,212,143,63,102,183,238,167,31,107,181,55,125,119,174,24,41,176,18,68,20,142,253,99,87,96,102,25,
+    45,41,189,74,88,231,220,237,197,192,169,126,181,97,92,62,205,207,251,107,234,101,56,126,80,133,159,120,87,215,150,116,
+    83,74,160,186,148,53,145,160,66,78,215,253,116,204,38,92,247,24,168,246,24,114,163,56,93,28,75,70,167,76,236,171,
+    88,104,168,55,51,104,236,10,92,120,47,54,72,219,155,120,200,220,50,229,102,0,32,115,188,154,157,52,105,113,69,148,
+    46,139,62,159,204,192,42,112,185,107,51,128,221,7,225,214,133,195,62,69,52,37,160,214,146,33,5,130,210,19,246,212,
+    191,212,253,45,142,190,60,193,51,213,12,103,198,111,227,3,94,100,35,73,208,179,106,110,13,85,48,64,113,136,99,233,
+    148,94,60,202,92,250,2,237,245,138,93,44,151,59,6,14,148,147,6,142,144,224,132,42,246,153,149,95,149,131,229,202,
+    150,219,25,23,116,153,102,182,182,179,141,254,162,74,136,69,72,163,118,251,185,105,87,194,246,173,125,230,4,105,25,18,
+    137,28,35,41,196,85,55,193,11,107,160,7,22,253,251,84,177,31,78,107,20,80,112,106,44,202,164,195,177,160,221,128,
+    56,56,13,11,229,233,123,97,9,169,107,123,169,89,231,105,132,70,31,221,168,99,174,118,33,20,237,176,189,82,142,241,
+    73,128,114,130,36,123,3,177,52,113,28,123,212,144,174,187,55,202,38,90,91,188,173,174,135,71,65,94,156,232,122,171,
+    136,206,225,109,96,8,202,26,253,72,246,104,13,55,219,138,155,92,227,179,43,48,30,143,127,202,35,19,121,59,172,12,
+    249,160,134,64,127,84,71,9,11,193,122,148,190,170,213,49,129,236,85,136,174,185,192,121,1,201,82,185,119,136,212,157,
+    197,180,151,83,149,66,55,157,10,170,122,168,117,30,171,142,48,138,119,130,14,190,231,20,138,66,138,86,15,59,162,69,
+    102,59,222,79,212,99,152,29,54,97,69,16,69,255,179,211,57,109,156,206,206,172,188,127,92,69,131,28,153,5,114,124,
+    101,131,135,138,94,146,181,235,97,98,231,93,126,154,238,233,172,104,243,143,128,118,116,250,180,13,214,51,38,126,117,97,
+    179,6,89,73,199,68,17,201,196,56,71,11,251,46,180,41,195,43,231,42,140,147,132,36,102,135,213,164,242,166,184,156,
+    193,62,254,127,111,198,56,127,35,47,44,24,86,45,91,19,117,239,151,218,107,7,230,67,205,16,253,213,194,40,47,159,
+    79,132,181,205,220,5,5,194,61,91,87,180,92,254,189,212,63,119,17,80,87,81,35,43,217,65,170,171,72,126,36,139,
+    112,243,226,58,255,10,28,46,161,245,232,242,158,32,115,204,34,80,42,142,234,53,225,192,34,34,117,239,245,207,97,97,
+    32,215,163,135,218,249,205,211,42,206,117,228,11,86,207,238,181,62,96,93,237,103,129,125,237,57,10,25,230,36,245,217,
+    87,42,117,172,9,3,159,48,19,80,237,109,16,252,204,6,205,44,126,180,177,31,198,119,89,63,199,253,81,47,154,113,
+    154,17,118,174,155,199,143,251,70,92,5,101,137,204,98,177,240,128,228,104,66,87,129,219,235,107,155,200,81,76,156,119,
+    84,120,75,185,179,160,92,240,74,104,65,122,191,255,24,126,92,171,166,96,88,58,115,34,225,140,77,147,70,229,209,45,
+    135,24,250,51,143,210,112,203,17,132,46,205,176,59,71,247,130,7,202,111,32,7,227,117,17,16,253,108,55,228,184,119,
+    252,22,235,154,192,155,125,160,140,232,223,108,64,247,24,137,4,141,142,67,225,138,26,70,18,126,105,192,228,55,112,235,
+    181,87,24,178,16,235,249,35,193,111,20,160,247,39,77,110,169,4,155,255,175,201,87,181,98,101,38,179,3,21,174,49,
+    214,109,59,52,225,81,10,55,224,42,27,38,178,239,197,50,148,248,63,55,104,49,89,218,251,156,201,220,3,100,171,140,
+    249,51,233,90,246,163,205,225,227,15,145,76,20,90,47,114,225,29,78,131,18,217,25,191,250,196,34,91,77,165,121,187,
+    12,6,194,1,97,83,118,189,4,11,238,174,20,243,50,100,41,206,139,61,205,42,2,149,123,181,238,188,144,50,5,134,
+    120,26,150,204,59,4,162,99,121,53,110,74,128,47,225,232,175,243,73,100,128,113,37,203,165,116,191,223,107,79,203,16,
+    162,97,1,100,177,171,69,24,173,252,238,0,165,152,148,64,228,235,19,163,54,97,90,90,97,194,192,61,43,105,190,113,
+    244,53,214,235,83,72,127,43,119,165,255,167,70,157,248,33,99,166,127,223,151,19,30,51,19,155,166,5,35,8,101,136,
+    24,220,95,109,181,34,98,115,195,201,168,146,175,38,42,26,244,35,209,164,83,103,91,51,88,139,138,126,208,78,146,110,
+    105,84,58,134,197,84,250,111,230,140,60,148,3,118,46,195,131,36,165,49,234,216,199,70,138,41,86,78,16,44,5,215,
+    139,39,118,62,89,234,65,225,171,42,77,189,130,125,20,254,28,154,114,202,123,28,204,123,207,75,106,201,123,65,112,116,
+    195,124,203,83,34,252,74,217,26,107,213,130,110,190,171,217,46,104,30,80,163,184,161,225,205,101,20,17,139,240,161,67,
+    144,126,57,80,174,32,253,163,97,108,59,65,150,138,76,117,197,213,119,168,160,120,144,2,209,215,105,118,48,170,119,186,
+    131,93,62,216,94,166,228,133,144,154,74,128,202,188,48,117,146,138,66,69,158,133,85,25,250,25,24,80,31,243,66,195,
+    32,180,4,90,19,165,114,190,47,188,156,40,75,176,81,63,99,87,244,201,97,105,93,51,222,221,152,23,19,160,28,237,
+    132,173,18,167,223,176,173,229,158,169,146,12,18,193,24,98,36,240,96,74,169,159,29,249,62,232,119,78,117,154,8,129,
+    12,48,118,161,116,221,215,116,181,179,47,150,241,35,126,241,158,56,34,139,132,180,9,238,183,36,235,174,176,178,173,137,
+    74,185,104,130,155,71,62,11,55,101,60,239,114,134,191,66,55,79,60,244,109,167,157,201,135,2,54,128,6,216,146,129,
+    14,6,94,135,130,49,189,72,179,168,135,25,24,234,182,192,180,180,133,12,76,47,58,245,101,139,12,109,187,104,108,26,
+    102,171,230,27,49,221,240,130,239,222,98,158,227,189,239,129,44,174,164,198,250,150,253,136,34,161,74,187,80,246,224,114,
+    213,245,158,145,9,56,225,82,200,103,115,74,134,184,170,177,147,61,181,134,116,132,76,136,198,222,143,65,136,238,103,69,
+    114,179,30,82,202,100,187,208,174,58,146,54,245,153,164,223,147,79,70,122,221,112,102,202,141,102,11,28,145,122,83,199,
+    106,132,166,140,67,105,181,241,130,45,94,226,238,91,95,242,196,158,88,36,101,140,96,228,196,137,76,242,162,190,10,86,
+    114,196,44,246,106,26,216,102,178,22,93,133,249,162,30,247,192,245,22,62,178,193,170,63,245,75,231,173,63,179,211,59,
+    198,130,221,186,247,204,59,151,101,236,230,199,74,19,221,1,177,206,135,0,54,42,174,184,164,17,200,194,44,18,163,207,
+    168,27,55,211,243,58,146,239,114,123,216,21,111,107,248,234,56,124,19,148,98,5,232,185,116,110,170,104,249,131,165,18,
+    56,172,223,108,35,75,18,167,175,253,40,193,247,1,235,45,197,255,28,17,228,52,214,38,237,183,56,89,138,249,83,195,
+    39,195,40,232,22,170,4,211,10,3,56,236,192,50,2,195,44,216,111,67,203,100,132,217,183,17,2,214,154,188,173,247,
+    190,30,238,127,144,246,44,223,240,105,32,235,162,239,80,100,224,16,153,147,191,16,226,245,172,58,194,62,59,40,73,251,
+    164,56,91,122,40,196,70,243,184,34,90,42,167,53,117,251,74,123,216,138,163,137,132,122,70,151,27,134,134,111,135,116,
+    207,150,25,145,138,246,140,244,83,111,31,39,128,21,1,11,84,162,7,46,223,195,212,53,151,27,157,227,197,213,125,83,
+    137,132,49,196,223,234,46,10,1,130,28,165,93,203,124,14,101,173,225,189,87,132,209,253,210,133,222,212,218,132,198,47,
+    214,149,218,70,87,241,235,175,22,138,174,194,25,47,14,129,13,99,234,107,16,115,134,236,241,234,125,20,99,162,166,187,
+    168,75,141,237,98,224,88,191,178,27,136,246,125,38,71,45,110,107,41,127,108,230,194,213,96,93,164,13,253,182,198,53,
+    19,166,114,83,151,31,63,252,229,93,23,55,158,177,180,27,153,245,58,37,174,206,132,130,115,193,29,53,247,194,230,193,
+    125,202,12,56,104,126,61,115,68,252,47,14,69,193,189,124,13,19,141,159,72,151,131,94,66,231,203,192,210,226,247,69,
+    134,84,57,120,192,59,99,182,82,96,48,100,8,204,120,129,45,134,159,232,120,109,200,101,194,91,224,218,91,73,71,167,
+    255,126,175,106,77,156,229,21,212,96,147,222,119,225,220,178,201,125,210,3,1,70,2,178,160,115,234,8,2,1,244,231,
+    175,209,239,26,3,73,36,188,163,127,1,50,132,99,84,215,245,236,167,40,24,165,175,154,41,125,0,119,191,189,72,114,
+    254,229,48,215,164,182,49,249,105,112,118,22,17,161,100,249,59,214,192,185,135,225,171,14,62,45,124,133,160,50,41,60,
+    9,226,224,179,156,206,24,53,16,6,205,127,159,97,244,126,0,5,201,244,161,78,44,245,113,73,204,55,239,27,142,79,
+    139,82,200,251,21,101,223,218,102,83,253,185,0,228,71,136,26,25,232,130,242,249,71,186,132,42,156,147,8,126,184,183,
+    145,63,171,41,12,38,243,239,219,73,76,114,147,117,46,245,138,11,118,68,57,74,182,206,146,25,214,201,33,104,11,119,
+    9,106,205,25,106,241,65,112,111,223,26,76,70,219,228,127,200,115,18,216,153,32,45,121,53,175,202,1,12,2,251,107,
+    4,76,216,146,16,253,229,215,193,222,20,212,137,169,171,228,12,67,90,42,38,140,56,67,152,144,87,51,205,253,203,158,
+    221,81,103,107,241,25,242,25,187,71,136,20,194,25,235,181,246,195,192,26,131,177,237,184,240,216,56,43,236,89,169,137,
+    254,208,57,231,177,231,38,56,153,10,249,219,77,2,39,229,248,120,244,45,8,119,90,102,211,210,242,235,180,201,26,242,
+    146,175,11,112,163,216,90,243,143,171,146,4,30,142,39,44,189,255,157,193,84,198,14,122,151,56,60,135,95,84,1,244,
+    109,166,51,155,80,229,149,119,190,219,80,114,179,104,141,23,24,169,230,246,168,159,132,91,239,248,1,41,14,135,46,87,
+    236,237,26,96,62,147,85,65,76,171,123,130,78,127,43,78,153,40,39,80,244,76,170,55,128,73,102,137,82,45,146,28,
+    137,74,104,150,153,215,149,207,4,48,111,25,248,232,142,25,82,53,85,151,231,250,39,253,178,164,11,114,248,217,133,41,
+    77,42,9,107,165,141,172,59,146,221,74,107,37,236,228,187,251,219,184,24,71,44,14,191,123,173,64,124,243,202,33,238,
+    234,86,94,152,23,22,43,85,248,82,135,244,143,182,87,237,138,61,168,233,133,247,238,177,95,52,31,154,107,144,7,91,
+    84,60,145,39,19,242,236,34,6,181,222,84,249,217,73,44,133,44,202,128,129,119,96,111,134,50,18,192,134,94,152,251,
+    127,129,24,36,152,122,88,132,155,55,18,49,254,173,33,118,115,142,36,243,179,189,129,74,174,202,52,249,186,185,253,131,
+    40,143,11,0,196,235,43,207,82,244,134,149,254,25,231,127,223,87,15,57,50,59,13,124,108,183,152,124,161,200,82,154,
+    67,102,156,184,209,189,71,167,133,146,233,8,141,244,79,121,216,18,196,61,148,43,72,165,46,36,170,25,138,203,165,182,
+    81,117,163,51,237,5,167,131,34,28,40,7,89,90,34,150,160,173,48,183,208,93,154,236,51,127,198,102,114,18,36,171,
+    61,188,35,216,106,30,145,46,23,44,215,68,39,14,114,70,177,170,106,176,41,78,54,28,205,196,106,114,136,164,60,21,
+    53,248,105,224,12,148,246,203,61,195,169,51,145,145,101,198,45,153,233,140,151,46,223,196,94,170,201,206,194,4,239,244,
+    53,77,215,199,24,49,213,177,255,191,144,84,112,253,208,161,238,26,78,162,117,143,159,98,147,179,219,27,232,1,28,2,
+    147,196,196,242,228,166,37,31,68,203,64,39,72,245,191,133,85,175,185,225,106,48,237,84,68,175,71,167,119,232,218,89,
+    73,118,122,200,186,179,91,67,41,214,196,59,148,198,182,90,188,58,104,244,205,209,34,198,175,61,46,168,27,26,89,174,
+    100,157,16,191,22,126,103,71,117,253,249,187,99,35,57,65,75,187,204,215,83,175,213,133,102,102,174,208,94,240,211,211,
+    189,201,215,94,206,151,69,37,211,158,151,198,197,244,166,72,208,140,134,16,119,164,168,138,245,255,227,160,107,74,123,29,
+    225,143,167,120,120,80,197,89,235,139,185,161,112,57,31,94,93,228,79,136,191,41,29,66,195,249,166,29,234,156,79,233,
+    47,151,20,88,182,112,180,89,147,86,47,50,34,11,12,195,152,189,74,113,168,118,202,28,161,189,231,69,238,228,100,151,
+    123,104,97,37,114,151,229,88,182,123,123,34,102,205,55,249,168,192,48,13,122,226,21,232,81,231,81,88,175,219,84,149,
+    86,255,53,105,188,215,117,138,33,137,255,75,200,97,122,71,174,105,238,68,158,56,73,77,208,106,107,194,147,153,216,171,
+    239,77,190,180,193,251,168,51,32,187,212,204,120,145,48,16,22,219,117,217,134,164,190,247,59,156,132,240,182,216,35,29,
+    44,159,43,86,10,21,129,187,167,111,197,191,139,3,175,137,112,38,161,57,26,46,7,151,117,228,24,161,172,178,45,245,
+    43,131,35,11,216,17,173,40,234,128,189,153,164,244,169,35,121,41,220,178,15,74,37,246,189,233,124,154,50,16,174,7,
+    20,132,41,75,177,224,76,245,200,163,83,22,159,250,191,247,34,72,56,150,208,233,70,245,202,112,4,102,108,49,214,35,
+    115,100,25,106,8,172,72,51,219,146,248,132,12,140,201,57,222,88,233,111,156,191,68,128,150,42,156,130,10,16,168,189,
+    209,183,104,147,50,17,250,38,223,48,252,165,236,37,57,111,147,11,14,108,248,250,167,126,136,30,80,1,130,116,236,94,
+    150,97,62,210,111,75,150,18,207,105,66,177,130,49,189,196,23,199,95,100,91,59,61,205,25,243,23,203,82,38,111,102,
+    228,224,202,78,184,16,105,130,26,15,232,243,169,209,162,167,199,207,126,78,60,178,128,153,9,134,99,103,236,54,222,21,
+    167,177,122,109,223,40,53,172,188,221,154,27,117,128,3,124,0,203,116,245,3,60,122,1,246,17,62,223,236,209,45,2,
+    132,159,205,74,188,99,123,57,150,63,69,100,28,188,12,87,246,117,60,141,36,33,159,92,96,68,149,171,215,19,205,89,
+    148,212,104,49,203,236,15,183,101,219,57,146,199,148,178,74,240,214,137,218,5,173,85,122,240,244,190,135,30,125,215,226,
+    90,181,189,144,20,248,52,81,231,247,200,95,75,253,25,153,0,181,80,186,147,100,209,8,30,178,89,41,21,85,216,198,
+    151,116,31,241,121,249,45,173,34,230,47,78,95,66,180,70,45,142,97,50,228,67,34,187,140,203,124,239,94,98,75,188,
+    136,213,51,62,158,84,38,199,124,58,196,160,174,215,99,28,4,34,122,30,189,2,190,33,55,180,114,63,228,195,228,63,
+    45,61,135,247,181,110,233,139,210,118,134,48,246,79,14,91,210,95,35,121,241,248,254,233,184,180,63,118,244,162,253,240,
+    45,111,46,174,78,140,231,14,34,142,145,241,80,115,99,110,19,228,192,146,119,174,212,145,215,34,165,243,132,172,145,86,
+    123,54,211,39,235,169,209,131,18,176,199,254,4,35,147,128,130,20,71,107,142,23,126,102,127,146,25,54,66,179,159,243,
+    80,100,241,196,138,174,147,250,131,53,240,147,171,71,47,132,133,171,234,203,80,111,53,93,77,56,237,218,152,113,82,203,
+    77,243,86,71,216,27,65,0,71,35,28,234,63,120,247,132,210,81,147,153,25,244,46,129,65,79,69,182,50,23,45,163,
+    65,94,150,45,54,180,8,156,64,114,90,173,201,86,114,159,19,60,93,108,148,57,85,66,2,89,166,62,128,47,214,220,
+    166,95,161,40,96,234,77,132,221,115,54,164,156,194,84,177,141,105,56,214,213,26,247,146,50,217,207,254,6,19,137,137,
+    56,177,198,50,143,60,13,10,199,37,201,65,129,115,44,172,198,245,139,184,56,80,89,195,149,195,151,182,51,214,31,195,
+    59,102,170,244,9,36,218,16,58,204,114,68,195,191,139,32,134,128,24,223,134,142,12,198,43,192,43,33,144,177,197,16,
+    242,176,218,192,23,183,199,57,57,155,194,31,242,211,26,58,1,163,254,167,149,148,28,51,141,122,51,60,43,237,31,36,
+    140,107,218,86,242,177,19,8,199,103,222,70,51,206,118,134,26,171,162,237,73,107,106,53,104,64,66,107,0,107,14,139,
+    187,166,109,199,188,247,109,75,103,31,212,50,152,125,110,155,172,90,47,243,86,250,78,186,166,107,77,137,90,165,203,62,
+    164,123,115,104,226,237,145,168,50,171,204,175,169,36,39,52,77,173,204,98,106,78,236,199,122,235,183,6,48,230,214,29,
+    127,25,65,133,53,120,251,145,177,25,36,30,114,225,20,146,41,67,37,15,125,125,157,178,32,65,3,128,19,171,145,117,
+    64,121,56,237,14,83,180,4,226,133,148,130,133,86,102,95,219,17,131,131,149,183,234,92,79,230,27,66,53,70,221,86,
+    219,167,103,87,85,80,16,120,176,249,49,56,37,141,31,147,153,175,226,176,176,64,177,141,250,231,231,128,52,236,200,10,
+    116,133,99,68,87,149,100,132,99,249,182,54,69,68,246,253,123,123,176,17,195,198,27,102,171,225,170,203,188,228,109,10,
+    20,16,63,114,103,223,207,241,153,45,97,98,109,121,12,68,131,43,132,91,73,88,51,76,252,117,133,158,210,207,76,20,
+    113,78,206,207,236,55,202,50,237,119,174,59,113,7,47,153,182,157,175,43,218,57,142,250,26,27,153,135,141,48,191,18,
+    16,201,34,77,22,41,185,175,9,141,27,223,78,60,133,160,131,186,192,171,78,111,154,181,75,106,179,52,6,107,161,229,
+    77,112,208,225,62,6,77,103,66,117,193,55,49,103,86,32,73,4,191,131,41,138,34,253,29,143,57,67,63,137,41,164,
+    253,87,155,31,166,25,180,9,75,137,83,164,196,49,165,124,200,138,87,50,96,35,254,143,106,97,236,218,16,74,193,128,
+    223,131,36,145,110,191,221,44,218,75,14,20,44,92,247,36,31,129,138,191,137,95,67,141,30,168,75,144,62,70,255,170,
+    12,171,189,138,16,207,249,191,83,11,164,129,155,198,178,97,12,54,5,163,198,223,177,219,6,227,68,5,223,225,39,31,
+    131,217,98,165,75,68,172,89,97,111,61,6,140,35,0,14,232,180,45,1,154,19,175,119,245,227,208,171,69,233,10,126,
+    95,164,194,116,29,141,217,230,27,86,126,92,152,88,54,168,18,89,176,205,205,165,80,182,213,104,120,85,126,75,166,87,
+    187,173,9,207,97,130,240,235,184,178,37,236,210,151,209,77,163,175,247,86,211,43,189,135,197,101,231,88,12,185,148,72,
+    42,6,78,118,169,174,40,145,225,224,55,7,102,216,151,232,108,161,37,139,211,67,50,128,27,34,157,16,57,221,234,148,
+    130,207,98,40,57,112,188,131,135,215,130,251,209,76,186,139,98,212,135,201,219,93,146,208,102,160,215,169,245,114,80,96,
+    94,167,217,111,20,127,77,173,160,87,192,155,254,236,166,11,121,195,167,163,235,240,44,130,72,166,81,233,77,66,51,87,
+    52,108,33,130,40,129,165,93,21,109,205,130,75,154,235,156,127,172,72,221,178,98,105,1,43,231,45,49,181,34,153,169,
+    10,91,67,196,46,217,230,154,113,53,40,165,61,255,155,184,190,211,110,230,33,28,213,239,233,162,55,214,184,101,105,226,
+    24,228,183,22,227,129,102,130,193,200,192,238,175,78,9,63,220,228,45,201,13,161,209,112,144,47,91,170,13,228,35,244,
+    174,227,137,251,109,91,225,24,30,237,218,144,202,202,132,26,164,189,197,159,29,137,137,18,68,187,7,74,1,125,188,148,
+    198,33,208,149,245,106,190,182,86,155,167,113,235,17,46,190,139,32,176,116,22,224,77,172,93,104,127,25,81,157,247,223,
+    130,38,107,100,130,194,184,194,168,220,244,81,91,245,253,108,7,133,207,253,132,150,153,252,99,41,64,210,12,242,40,130,
+    226,6,28,35,162,159,37,253,238,48,64,157,105,153,33,246,68,49,159,60,113,112,237,10,142,220,157,88,3,213,112,148,
+    163,21,93,188,180,33,125,223,18,76,236,131,63,232,51,69,94,190,243,137,37,58,103,214,134,38,43,164,124,219,106,95,
+    85,91,205,39,81,61,181,241,48,116,100,73,149,79,34,131,58,141,198,76,31,236,219,184,150,253,197,133,1,39,170,160,
+    59,152,192,188,31,0,77,10,148,217,223,98,53,207,53,182,16,38,195,134,223,243,233,219,158,70,207,36,213,168,11,187,
+    83,84,222,130,192,17,216,199,248,252,107,74,127,154,29,202,134,184,99,150,158,185,131,19,227,227,251,223,128,178,107,21,
+    29,241,47,49,19,51,189,19,19,249,94,128,232,39,140,67,22,163,241,183,146,199,2,10,195,168,53,252,96,198,41,241,
+    136,117,38,246,88,153,21,22,83,178,90,250,114,52,246,168,12,212,252,12,119,182,211,101,60,176,88,150,22,115,117,141,
+    157,130,90,86,180,118,69,190,160,221,36,120,32,91,226,177,173,33,45,184,56,112,4,124,208,25,159,151,161,47,66,122,
+    193,27,125,123,165,135,43,59,254,221,254,246,63,129,188,81,84,88,7,61,219,89,137,112,206,88,171,211,196,109,137,29,
+    102,24,37,251,207,25,162,243,180,79,131,225,146,101,27,215,189,22,3,212,204,104,222,145,2,40,37,238,129,110,131,207,
+    230,206,5,30,145,142,242,147,48,65,99,22,140,187,161,18,91,244,125,31,41,97,161,94,88,225,233,20,77,139,122,172,
+    192,237,26,107,240,164,254,2,177,233,15,98,178,49,24,132,116,94,206,75,90,20,177,204,244,238,204,89,38,56,104,212,
+    123,131,104,132,194,49,206,137,243,230,188,244,213,61,185,21,66,234,228,89,90,153,140,224,73,230,78,62,72,74,239,17,
+    1,104,115,226,179,80,220,239,154,52,104,162,228,175,75,226,252,67,195,213,251,89,140,21,90,69,102,12,77,37,111,162,
+    255,215,108,232,248,40,241,246,205,179,113,52,205,52,62,103,22,207,116,132,199,84,168,3,196,79,228,151,196,206,249,170,
+    212,228,152,109,216,252,97,191,111,145,23,199,143,79,214,34,23,144,111,144,25,123,219,160,68,127,102,85,233,76,129,232,
+    73,120,211,113,217,84,224,104,168,245,223,229,130,157,231,115,117,197,107,71,145,186,93,177,25,98,69,219,2,28,199,160,
+    249,71,146,5,27,55,29,193,134,6,73,229,220,25,251,80,221,3,37,95,125,3,24,214,79,152,110,16,210,78,190,113,
+    11,151,252,221,218,52,71,210,9,188,202,144,215,123,80,45,231,36,207,18,215,60,212,14,44,168,141,170,153,156,192,161,
+    89,7,72,215,145,217,179,75,85,125,68,24,146,135,132,16,77,123,121,105,217,212,39,94,188,199,196,164,212,140,58,210,
+    246,218,61,199,171,184,136,4,242,32,193,102,158,202,185,216,225,226,204,119,232,205,133,160,160,222,205,178,89,126,252,36,
+    143,148,16,116,87,251,75,237,254,165,31,189,84,87,233,175,254,130,98,131,210,71,118,191,220,110,180,223,86,125,237,85,
+    224,23,58,16,75,95,102,45,226,0,253,71,250,73,27,87,211,98,244,34,243,195,32,0,39,129,25,33,133,210,177,202,
+    126,167,61,196,155,242,38,158,74,160,123,91,230,144,252,235,224,166,104,93,123,254,105,216,14,72,146,0,219,17,108,132,
+    8,89,21,251,103,212,43,204,147,210,3,42,119,202,151,5,228,215,27,254,198,79,94,213,234,211,151,44,241,58,25,100,
+    210,243,3,245,169,215,252,86,160,250,209,55,2,110,160,138,159,218,203,59,171,65,135,179,157,171,218,77,154,226,171,141,
+    15,171,194,66,90,150,51,198,221,109,177,162,23,31,136,131,116,161,36,251,27,9,65,69,240,242,164,249,116,71,42,187,
+    42,44,87,197,107,78,99,185,244,249,98,199,53,225,96,125,251,189,32,190,3,81,113,227,105,53,45,218,22,141,47,165,
+    220,247,163,22,161,141,194,239,217,61,214,226,184,69,31,220,46,103,63,30,193,115,173,67,43,173,246,80,157,1,0,119,
+    44,94,141,111,140,196,151,252,45,190,144,100,101,251,173,247,235,164,204,128,201,124,153,249,14,163,215,128,139,60,41,92,
+    87,52,27,153,227,124,33,159,22,160,29,84,77,94,9,61,87,29,219,91,17,120,239,215,149,32,108,31,103,149,83,184,
+    82,215,14,72,117,181,192,69,184,236,217,218,139,155,183,50,139,153,223,251,151,123,236,43,88,199,31,51,87,255,40,28,
+    81,249,92,15,7,140,44,5,92,241,56,14,101,51,98,240,245,143,88,71,90,191,222,51,21,28,224,150,98,152,211,69,
+    213,150,155,152,182,98,106,154,144,40,151,186,72,95,31,169,90,204,138,179,216,103,130,88,131,86,143,160,75,254,139,22,
+    180,93,222,36,111,3,230,243,82,26,158,143,228,88,125,17,181,67,155,176,228,221,4,255,153,122,187,93,225,249,72,160,
+    211,193,214,97,253,26,41,184,22,51,222,138,183,62,115,150,157,82,192,102,163,226,61,223,174,136,221,32,213,235,133,239,
+    139,9,72,201,32,14,123,82,85,237,125,148,226,252,185,194,88,0,140,223,123,51,111,14,72,103,157,4,204,40,72,2,
+    75,75,237,2,206,96,218,198,236,139,207,27,242,11,59,194,218,169,78,133,130,203,42,220,208,175,252,115,211,177,93,9,
+    30,167,201,102,231,185,139,61,7,230,193,172,76,88,65,23,173,42,196,170,86,90,121,252,101,78,241,22,29,230,240,176,
+    155,148,130,74,66,188,0,33,214,241,137,86,131,88,222,83,223,248,38,3,189,202,96,156,191,37,136,144,228,116,86,7,
+    235,218,109,7,58,46,144,53,91,221,127,2,219,229,78,112,81,80,216,114,100,203,195,103,95,96,15,23,116,207,185,75,
+    221,96,62,46,136,94,12,13,63,202,141,250,79,180,80,229,15,202,41,203,47,162,191,148,239,200,42,8,36,7,73,230,
+    224,193,139,232,220,139,134,85,83,30,133,44,149,74,245,133,48,85,22,16,143,121,118,21,59,208,24,10,245,192,250,167,
+    120,180,246,27,123,92,241,14,80,95,175,7,102,105,166,15,81,29,183,1,71,56,35,195,156,216,114,138,18,176,82,45,
+    245,27,188,231,111,255,151,29,70,174,253,82,107,128,232,246,170,160,204,125,126,94,78,227,70,226,220,123,179,236,219,62,
+    89,212,97,51,185,86,37,188,23,142,216,220,182,8,74,186,124,75,105,205,93,137,139,187,226,213,26,185,69,67,57,78,
+    4,45,253,122,189,174,112,223,233,215,157,163,65,200,44,26,192,189,116,157,93,219,160,0,213,25,232,15,66,251,18,159,
+    100,21,155,170,156,66,187,126,207,153,17,106,212,69,137,208,112,123,108,81,241,173,134,73,2,27,104,150,199,166,213,246,
+    123,156,72,1,129,248,48,226,210,237,124,66,93,223,44,177,25,42,20,206,164,0,239,59,208,246,102,231,67,254,234,35,
+    31,116,34,69,195,1,177,203,46,22,74,17,216,245,161,80,219,34,68,9,178,19,245,211,193,90,22,133,78,92,156,125,
+    193,149,105,1,185,69,148,214,210,150,47,20,11,88,150,8,11,174,216,72,26,74,3,190,45,106,129,249,41,135,46,113,
+    54,209,72,138,137,69,11,138,184,208,108,86,89,41,22,71,253,213,184,176,89,156,114,91,9,25,115,160,253,94,115,127,
+    205,185,193,110,237,141,203,119,62,176,193,169,111,156,33,14,90,184,81,118,151,102,35,215,172,208,64,210,250,221,245,161,
+    77,215,175,114,184,144,102,41,54,71,189,140,11,150,101,120,53,105,187,9,86,35,146,127,103,131,127,93,19,153,52,100,
+    238,252,106,133,252,43,139,217,230,144,45,17,237,38,186,106,222,177,24,77,154,48,95,104,211,191,25,48,176,210,201,204,
+    113,75,27,91,174,49,91,197,67,200,54,183,248,179,251,228,150,245,178,112,220,34,69,93,180,205,79,226,207,16,254,14,
+    187,196,198,99,148,29,111,184,80,39,200,126,138,53,153,13,166,252,236,105,99,16,172,192,170,241,229,169,179,26,96,244,
+    241,181,114,242,66,194,122,8,66,123,84,33,85,205,40,184,71,109,84,230,249,233,4,208,68,29,160,10,133,196,49,103,
+    229,251,181,8,71,64,113,198,235,101,13,173,22,138,252,77,25,238,93,15,1,22,190,196,4,197,21,166,188,58,77,168,
+    7,233,126,235,160,251,111,186,54,15,111,216,154,0,114,177,123,50,77,86,207,214,160,236,244,109,4,87,233,206,100,102,
+    176,188,248,200,5,114,56,247,174,149,55,89,160,202,29,251,62,90,204,77,179,206,120,117,2,121,240,153,209,110,167,199,
+    58,173,210,94,119,126,180,86,123,204,48,39,105,125,187,100,42,183,54,229,147,201,255,86,15,183,133,24,192,253,234,205,
+    234,61,52,168,95,167,54,146,92,73,65,243,74,177,60,55,84,176,45,250,102,106,63,225,120,177,63,39,117,153,83,217,
+    212,251,17,147,111,156,202,127,202,137,216,201,170,11,202,158,172,151,194,161,88,127,69,39,86,171,138,55,8,220,44,188,
+    95,221,62,185,15,144,41,12,129,210,4,133,13,22,165,242,2,139,247,66,80,32,241,59,208,134,114,72,45,1,12,112,
+    20,92,156,62,113,66,243,93,158,36,148,252,94,131,23,167,195,195,58,92,69,189,91,48,201,204,6,188,73,210,228,231,
+    172,69,159,76,252,150,21,48,181,3,100,137,117,193,93,237,105,28,247,52,134,106,150,246,148,108,173,142,252,39,144,39,
+    151,202,150,74,187,134,141,164,119,153,155,84,226,10,120,218,58,110,78,102,205,212,143,148,12,136,223,204,73,244,1,8,
+    105,244,168,153,250,1,42,195,140,205,166,59,118,194,34,178,73,176,180,239,114,147,9,164,76,77,3,151,96,229,3,62,
+    65,66,70,139,124,32,175,52,120,173,67,155,103,34,109,134,160,191,117,39,127,44,59,130,201,172,246,187,220,59,219,234,
+    4,164,167,151,232,245,213,227,232,150,36,62,74,104,84,234,239,156,198,102,94,67,209,64,171,50,55,57,117,12,35,236,
+    125,210,134,81,31,162,22,82,218,59,56,218,71,55,146,45,136,73,49,133,188,141,48,110,155,194,59,157,209,11,29,168,
+    244,25,222,198,202,250,65,197,161,95,222,177,180,87,30,134,28,56,2,51,182,45,145,29,211,252,3,242,16,27,139,227,
+    63,250,112,247,25,100,55,221,209,102,47,13,84,142,25,198,220,200,87,192,221,255,228,237,102,216,150,50,20,11,165,230,
+    193,58,142,227,41,123,0,247,87,16,213,13,194,177,99,114,41,156,208,198,10,57,54,132,52,218,207,138,121,245,46,225,
+    101,168,188,150,211,187,252,78,53,45,177,141,217,39,213,176,140,152,44,103,224,200,180,166,140,223,117,4,226,118,223,160,
+    253,152,29,94,236,24,189,165,235,203,3,84,158,249,162,172,242,165,85,49,99,130,155,100,74,210,64,94,193,253,100,188,
+    71,247,78,251,57,64,72,10,254,55,211,204,176,73,254,144,128,47,50,235,84,232,104,35,73,174,231,168,165,159,10,183,
+    225,196,30,170,80,156,6,50,159,39,61,137,85,32,233,52,228,220,149,185,108,4,180,131,40,219,186,168,237,22,19,63,
+    153,182,93,235,157,20,247,237,207,176,144,75,116,87,33,41,117,18,26,171,30,94,154,242,143,0,70,228,15,167,149,251,
+    22,29,75,24,133,161,240,60,174,102,107,228,247,240,93,40,201,240,122,233,179,252,124,48,182,188,117,238,230,248,124,21,
+    7,255,111,33,242,238,172,18,17,249,144,75,195,38,240,100,63,216,73,87,175,250,113,7,59,202,184,220,85,109,243,122,
+    54,250,40,5,131,142,22,206,94,200,68,205,175,73,165,195,85,198,102,7,208,87,226,23,44,123,130,179,191,66,236,27,
+    62,11,109,149,154,97,154,133,188,16,69,74,170,64,177,27,79,218,121,14,63,224,194,114,206,101,62,125,122,30,66,175,
+    202,119,189,126,112,131,77,161,195,183,37,112,203,121,5,71,87,219,95,179,119,90,149,75,91,213,92,213,154,48,140,102,
+    19,72,172,142,161,186,124,205,12,225,189,194,199,154,18,106,21,224,175,99,167,131,225,105,20,83,40,22,152,249,130,107,
+    98,26,222,0,145,116,24,138,196,242,35,9,196,19,51,44,9,192,229,243,193,176,215,219,214,183,12,50,166,47,80,42,
+    112,182,47,103,226,180,214,142,95,241,252,135,184,192,250,133,211,172,230,129,79,177,213,110,148,254,90,221,128,50,57,33,
+    122,133,84,201,253,219,26,45,187,10,125,180,231,5,140,160,31,52,203,159,147,219,254,182,215,186,115,77,76,76,221,164,
+    38,180,180,22,0,248,105,6,218,119,1,57,195,68,143,181,55,112,166,207,239,42,8,221,46,248,165,38,151,22,47,107,
+    88,2,31,162,13,81,123,67,205,230,57,24,69,229,249,227,8,180,118,210,69,114,189,228,21,232,56,9,216,205,222,86,
+    14,45,0,171,58,157,192,178,242,59,0,94,135,5,111,5,56,7,19,143,195,149,207,237,214,250,221,165,242,254,42,179,
+    162,147,8,157,209,92,68,142,186,183,10,140,64,118,82,178,189,145,27,136,73,51,86,149,18,120,40,24,102,115,185,45,
+    220,5,219,154,10,69,128,95,225,198,20,157,165,118,145,167,222,36,92,11,208,236,148,176,216,48,59,34,67,92,234,222,
+    69,79,33,166,125,98,251,192,91,82,80,246,214,170,10,216,69,176,253,249,143,192,85,75,192,154,114,199,102,2,192,11,
+    2,164,229,9,125,35,205,116,8,147,81,240,172,163,36,252,190,242,199,178,100,187,212,149,89,174,163,57,82,219,225,42,
+    157,64,38,186,18,43,59,237,152,170,91,182,7,19,160,250,12,53,227,47,11,186,174,245,180,177,37,113,141,240,6,68,
+    190,230,37,100,59,237,212,102,207,197,62,98,100,167,177,93,197,206,49,155,98,205,83,69,61,114,187,96,81,198,211,123,
+    49,242,189,122,96,0,211,236,92,219,154,5,238,136,132,234,103,20,101,155,186,18,206,157,54,185,157,61,252,160,132,219,
+    61,27,144,245,91,102,231,136,58,179,171,64,100,26,11,183,237,24,90,99,120,42,175,170,93,0,166,93,91,37,239,58,
+    206,245,192,85,101,15,154,149,214,5,32,194,197,141,152,138,158,113,202,114,103,195,177,188,149,127,28,155,162,128,153,36,
+    14,28,170,161,112,45,239,254,79,118,191,165,157,216,66,138,175,176,127,57,99,21,98,132,183,172,232,182,211,125,160,165,
+    25,184,181,68,80,92,169,157,20,230,242,26,136,23,82,191,232,129,249,1,144,5,41,215,126,245,141,73,106,231,17,71,
+    204,61,59,255,10,76,191,74,5,74,212,85,134,15,28,34,42,202,197,80,132,160,179,75,164,25,54,221,177,221,27,64,
+    230,31,221,215,21,57,49,79,36,206,50,105,27,167,27,215,193,164,133,247,53,164,25,238,209,233,116,227,183,17,138,210,
+    61,237,13,13,67,112,254,140,10,34,143,60,208,164,18,191,170,123,55,61,153,223,190,183,209,236,66,204,8,48,224,144,
+    223,226,184,194,212,143,126,240,58,29,166,16,65,85,232,242,37,148,244,181,16,25,234,199,49,21,46,83,246,161,153,211,
+    56,26,177,194,19,105,53,234,54,31,56,186,195,119,169,75,172,244,176,78,199,10,179,118,40,217,135,32,21,3,89,136,
+    167,255,232,41,138,233,86,119,224,194,72,15,81,254,54,110,234,184,179,49,213,252,245,232,204,187,92,82,56,6,144,210,
+    180,33,72,59,62,222,38,151,107,24,70,91,213,28,27,11,92,36,77,64,36,106,153,185,97,190,33,230,36,232,13,178,
+    144,184,6,167,7,55,26,163,150,164,170,80,164,85,130,186,18,114,34,91,65,34,60,51,20,176,185,104,65,156,63,40,
+    206,246,118,151,239,83,182,124,96,123,175,31,22,228,5,217,185,16,171,221,245,110,184,181,50,21,82,58,231,162,233,216,
+    32,17,169,18,168,175,90,39,176,124,120,142,174,23,155,246,194,72,11,30,15,204,190,251,217,131,121,37,15,139,132,55,
+    78,183,229,61,208,241,113,157,79,166,42,93,236,211,254,252,140,237,30,129,251,192,32,161,137,196,6,91,46,64,188,18,
+    134,72,100,204,141,251,237,205,47,110,45,134,199,161,222,56,42,112,154,180,39,22,39,234,238,108,99,247,98,44,190,207,
+    37,116,116,248,217,88,203,68,224,99,136,1,199,185,186,155,247,226,139,204,51,150,119,68,244,242,152,133,180,184,231,123,
+    14,89,110,147,157,128,27,250,100,227,121,147,222,120,179,3,79,84,175,62,91,23,58,166,75,150,183,3,124,35,221,244,
+    26,69,86,81,96,27,62,40,17,251,56,120,222,152,98,143,1,51,56,182,173,15,22,69,98,51,239,197,24,16,30,17,
+    29,101,198,216,153,220,56,93,93,168,210,118,158,104,198,209,92,185,50,237,239,97,205,169,83,255,177,239,238,32,123,148,
+    217,185,88,208,251,35,96,37,70,84,65,219,230,225,217,96,146,233,157,180,101,6,182,41,180,0,189,180,108,172,8,16,
+    172,139,227,164,157,35,84,131,17,110,111,106,89,188,51,169,208,195,89,202,148,120,4,181,57,193,99,65,209,91,209,215,
+    63,138,127,49,44,203,152,88,107,143,107,226,14,65,204,217,104,152,98,96,41,167,39,85,44,224,177,32,226,167,101,76,
+    82,15,139,53,77,16,251,109,125,193,117,195,82,56,244,102,127,181,66,215,229,44,25,247,106,209,127,40,32,65,110,227,
+    178,239,59,21,207,238,204,52,7,175,220,176,216,13,166,93,185,216,217,185,150,6,213,11,61,255,227,197,16,97,205,132,
+    191,173,221,43,183,23,84,34,190,185,26,196,69,64,180,204,53,245,125,189,188,64,126,44,252,196,100,106,110,36,101,154,
+    241,201,133,252,219,55,139,170,223,62,87,26,200,203,86,26,30,212,20,215,201,239,199,211,129,101,223,10,222,229,111,201,
+    21,207,174,117,81,87,70,233,124,156,178,123,98,73,207,228,119,72,228,247,153,233,138,190,176,155,62,207,198,158,201,5,
+    174,191,212,8,106,217,71,26,0,11,142,12,161,28,138,200,13,130,156,4,112,176,92,21,33,175,237,206,221,149,104,211,
+    155,80,165,33,74,212,250,217,108,175,66,187,131,21,56,62,108,220,233,72,138,76,209,11,133,236,64,228,168,128,10,11,
+    38,236,65,244,188,140,14,73,55,212,221,73,4,195,137,82,57,104,245,74,7,78,119,222,56,121,3,120,15,62,227,116,
+    49,186,80,238,120,57,140,30,60,182,76,54,39,248,208,246,172,180,87,153,112,100,207,176,19,174,249,158,85,62,113,202,
+    179,205,239,155,110,101,61,215,190,200,198,222,230,69,36,182,236,9,199,205,167,184,207,179,169,201,157,69,135,87,76,146,
+    168,219,221,80,83,160,209,6,142,219,37,122,126,196,105,210,154,117,230,194,4,109,176,69,70,5,255,22,103,175,98,39,
+    71,199,168,169,54,231,4,251,79,206,86,166,119,97,67,79,59,44,80,111,109,157,109,69,189,194,70,133,28,40,247,197,
+    23,11,65,148,5,7,131,195,29,2,174,73,162,5,36,100,141,242,119,37,179,197,113,37,197,110,101,33,13,241,89,213,
+    119,254,83,166,13,100,16,91,172,97,69,170,15,220,148,64,252,126,52,31,98,224,127,253,78,103,167,38,129,12,123,88,
+    218,100,220,50,85,48,50,31,45,195,160,28,83,121,111,66,199,181,177,52,39,101,246,232,15,59,38,109,183,88,167,143,
+    35,57,107,5,83,177,165,91,7,41,35,236,142,195,113,90,134,63,45,244,44,51,191,95,149,60,55,47,168,170,234,152,
+    175,84,223,197,171,36,29,244,64,234,153,225,91,131,16,245,228,210,232,102,227,167,235,215,59,94,47,145,101,13,178,194,
+    57,16,255,246,6,167,187,89,103,232,227,46,236,82,115,241,162,249,141,71,56,247,70,204,46,200,59,94,155,28,247,216,
+    99,184,178,40,144,103,107,110,181,31,67,204,27,110,89,190,104,187,79,54,28,16,3,189,141,183,19,20,44,205,108,225,
+    132,84,25,223,133,226,109,64,161,34,73,241,153,199,69,189,71,57,210,157,173,130,145,190,249,66,234,176,186,102,31,7,
+    141,189,14,186,24,2,21,57,159,129,183,137,168,2,31,178,87,163,177,161,190,30,42,39,150,186,46,147,101,101,240,89,
+    102,106,34,129,92,81,149,119,171,244,212,208,135,44,2,89,176,243,80,40,239,167,4,138,190,255,110,97,28,184,153,63,
+    9,103,122,181,245,65,46,11,19,122,106,137,73,114,242,15,237,15,25,207,174,120,44,73,211,79,238,35,172,37,213,4,
+    64,92,184,206,0,152,134,214,65,132,51,139,13,192,241,254,79,140,3,237,249,116,38,4,139,253,238,230,54,121,141,25,
+    213,90,62,84,199,246,82,55,104,157,15,21,129,79,116,160,235,157,209,252,158,92,199,241,63,115,228,119,122,13,195,123,
+    238,85,255,122,5,47,185,120,175,65,65,138,30,213,1,209,195,106,23,161,101,249,217,188,192,67,157,159,187,34,176,204,
+    66,98,23,223,139,83,58,193,64,112,9,209,40,56,77,144,91,102,178,50,60,204,114,166,91,77,169,123,32,57,145,204,
+    60,151,86,67,35,188,17,37,20,241,38,19,155,157,109,128,55,220,43,14,130,89,254,66,28,81,227,216,131,14,117,19,
+    122,77,154,62,10,0,151,210,21,47,208,186,144,206,167,80,20,8,218,119,181,198,52,170,93,123,3,100,61,8,133,203,
+    168,80,107,207,33,36,254,128,70,70,129,102,220,85,243,190,96,152,99,30,215,251,222,117,167,137,100,13,25,178,189,46,
+    183,140,33,55,25,49,227,236,171,192,245,161,94,218,177,236,244,207,203,90,224,137,0,231,242,195,177,239,228,204,121,247,
+    142,107,218,232,254,240,186,102,42,139,213,195,37,187,131,195,41,34,123,217,20,151,117,28,243,116,99,175,63,118,171,88,
+    186,42,147,234,122,83,171,255,177,33,76,202,103,110,52,226,185,218,104,46,234,183,149,203,107,216,122,34,58,121,182,83,
+    99,236,140,189,198,232,99,147,112,236,196,189,3,48,200,229,203,46,250,26,24,210,195,105,143,126,253,131,135,218,126,40,
+    140,135,225,141,77,26,179,222,66,246,6,22,116,75,103,146,53,231,205,65,102,93,104,159,244,193,142,210,34,68,7,152,
+    19,57,124,27,33,255,123,220,100,202,28,23,29,87,161,138,143,11,123,52,134,255,3,201,124,139,221,135,161,10,117,182,
+    29,193,190,92,227,87,244,21,118,146,200,162,121,133,127,47,99,72,212,126,204,134,245,5,34,190,195,219,199,10,6,1,
+    17,101,230,204,167,87,246,20,6,26,28,138,92,89,248,167,182,31,22,151,204,131,66,30,15,1,212,100,45,195,246,42,
+    32,189,221,145,50,226,132,5,9,27,180,142,38,30,142,8,243,236,170,85,252,76,127,12,154,121,176,129,179,157,120,25,
+    32,35,231,52,229,92,8,29,120,178,217,138,237,62,4,135,125,174,241,138,178,201,193,249,133,97,10,102,4,108,23,204,
+    62,111,143,161,196,25,175,192,60,66,143,102,46,104,99,146,13,180,76,76,213,37,231,48,57,218,212,99,84,132,73,18,
+    46,217,213,160,108,1,11,79,29,115,217,165,8,101,241,198,25,96,138,66,172,221,164,148,120,92,218,196,135,23,91,10,
+    49,78,40,96,94,245,93,219,42,77,202,139,13,219,63,148,76,185,174,44,146,221,226,24,247,14,168,233,101,20,212,165,
+    96,27,189,121,128,255,161,78,247,91,81,53,53,130,98,55,133,2,75,234,193,247,47,4,247,47,97,55,218,221,108,145,
+    154,71,165,232,94,44,108,13,196,61,188,225,39,1,242,128,198,144,155,144,132,22,82,98,78,239,154,223,136,152,127,92,
+    170,246,180,241,103,66,114,246,133,216,52,237,214,30,246,95,198,99,174,31,171,57,241,141,217,68,178,194,108,143,190,34,
+    73,116,171,54,147,218,54,16,194,166,34,177,209,207,172,64,8,7,242,112,193,3,160,221,12,20,210,210,93,193,22,42,
+    3,87,213,192,243,175,53,23,47,51,111,77,65,184,120,110,32,7,118,64,37,167,102,155,211,214,82,28,144,72,129,55,
+    216,86,205,25,144,194,244,240,236,82,106,215,65,175,127,159,93,242,138,129,2,206,233,29,46,113,111,16,0,142,16,31,
+    214,238,113,103,25,135,80,214,216,225,185,10,247,122,44,209,99,255,51,159,128,218,50,220,66,80,131,131,144,25,110,199,
+    127,194,240,43,145,166,58,219,244,16,59,11,150,207,13,186,133,188,104,125,72,16,236,121,139,95,107,184,84,217,217,83,
+    36,128,124,229,86,87,175,255,175,131,107,238,230,87,26,106,3,162,183,166,169,218,132,154,219,3,214,83,175,165,190,62,
+    242,20,147,14,37,199,46,49,106,84,140,3,35,177,233,181,161,125,48,9,186,168,202,181,119,162,56,15,118,102,1,56,
+    176,218,33,214,149,214,135,240,113,228,208,203,247,72,80,92,40,1,93,59,157,51,93,27,42,164,194,15,90,2,39,88,
+    160,174,219,213,88,67,41,29,249,11,46,240,67,61,111,217,27,117,145,122,199,137,102,185,25,103,235,59,207,238,214,37,
+    81,59,233,110,182,220,25,198,28,19,181,216,183,105,224,121,142,133,47,88,247,58,110,240,158,133,17,48,159,252,45,120,
+    129,68,50,183,144,111,155,22,159,217,200,240,138,83,4,164,145,95,116,127,53,109,149,215,130,118,123,106,37,97,23,246,
+    231,91,181,203,35,69,6,40,223,252,10,16,37,52,209,187,196,135,231,207,193,198,3,187,69,32,60,110,224,164,186,185,
+    81,1,242,5,240,180,76,117,215,67,239,2,118,221,157,178,10,97,187,169,144,94,11,185,39,240,169,55,92,83,123,229,
+    58,81,202,218,152,13,61,196,52,206,223,9,188,175,191,184,52,172,61,218,180,214,31,177,18,184,15,94,78,31,184,173,
+    26,38,152,45,203,39,22,185,83,42,65,175,26,251,136,176,206,201,33,57,30,107,49,230,165,93,123,30,60,168,146,102,
+    93,84,128,113,158,2,16,199,223,173,118,26,109,76,1,166,228,173,132,213,16,164,9,169,190,142,163,109,138,153,8,134,
+    105,25,41,240,155,76,71,132,166,204,113,102,218,183,227,197,242,215,93,3,236,51,49,198,76,105,235,69,3,78,48,67,
+    90,84,245,148,217,241,103,180,255,173,76,22,226,12,217,215,246,127,238,213,23,209,230,157,243,99,10,168,27,144,12,245,
+    56,94,123,171,226,42,227,89,122,221,102,200,3,195,10,153,186,194,86,98,86,110,129,247,190,208,176,47,73,160,183,248,
+    101,182,156,185,44,88,29,227,104,238,153,126,38,244,135,255,194,172,146,111,18,41,125,56,197,188,196,36,172,15,25,30,
+    230,65,7,58,147,33,87,27,248,229,20,192,144,82,30,58,94,137,3,19,54,89,63,2,82,3,112,228,223,120,68,214,
+    6,203,81,132,245,122,114,169,139,203,124,247,101,238,103,254,253,151,221,79,126,0,2,238,60,89,210,31,224,211,113,215,
+    106,64,162,133,180,20,155,210,42,27,215,173,0,189,21,168,235,14,202,115,35,167,14,222,62,76,88,199,226,1,39,203,
+    144,222,195,54,96,125,10,194,154,215,55,251,71,137,10,165,25,182,226,5,120,218,129,159,146,9,221,125,150,245,38,40,
+    160,166,174,184,142,211,238,22,150,20,215,82,147,245,175,128,64,28,170,138,60,196,221,168,226,27,166,239,187,3,51,155,
+    225,236,230,244,250,252,106,10,98,168,244,1,155,54,141,252,96,88,226,5,241,25,11,245,140,231,5,240,96,5,200,77,
+    120,36,25,247,100,187,245,40,221,34,68,78,106,27,102,153,1,132,66,91,196,45,240,31,167,178,104,62,118,46,5,64,
+    19,16,110,36,66,167,60,241,6,116,219,191,181,231,23,152,235,26,65,76,12,208,218,95,168,138,67,52,144,229,240,144,
+    248,28,212,59,95,161,94,253,245,19,215,80,30,10,43,210,248,59,226,208,144,190,118,212,111,46,168,157,63,131,128,30,
+    7,189,152,53,111,168,188,49,0,183,254,5,53,42,15,250,81,118,132,233,217,6,91,175,113,162,10,242,214,110,218,55,
+    9,48,16,255,52,4,106,151,26,163,151,84,16,8,62,160,227,115,105,240,240,252,199,26,232,122,173,46,147,225,42,92,
+    23,52,81,208,130,61,120,130,139,220,7,51,218,97,81,82,159,221,199,136,160,128,16,237,159,207,196,156,185,106,18,185,
+    97,187,205,227,168,150,216,149,169,207,60,107,166,242,160,144,38,203,140,215,135,228,148,37,40,75,226,165,145,199,76,164,
+    109,205,73,162,239,65,196,18,108,198,78,105,81,115,102,205,49,209,114,202,199,78,97,165,96,209,101,29,42,15,255,5,
+    121,183,111,231,54,199,222,117,112,208,106,198,79,0,213,125,84,37,107,42,82,34,102,218,204,148,130,152,103,90,178,187,
+    126,119,48,75,38,165,114,159,102,228,43,65,46,244,208,6,168,255,26,196,45,198,166,209,163,193,255,148,111,148,135,178,
+    117,4,143,37,115,172,184,0,89,40,149,243,103,173,243,7,80,69,102,205,148,227,231,113,52,15,145,234,84,107,48,195,
+    205,7,154,32,85,247,212,104,24,48,180,177,134,240,183,57,193,138,60,226,140,105,103,76,28,219,196,221,138,50,236,170,
+    24,27,198,28,93,121,117,108,90,17,217,85,80,217,5,180,235,220,37,208,168,160,92,85,14,206,102,225,105,87,130,239,
+    62,175,102,47,201,223,108,59,84,4,195,100,136,42,186,203,126,233,210,189,99,114,177,244,4,3,72,66,98,63,152,30,
+    162,191,60,106,119,43,187,133,205,224,63,35,70,127,4,21,218,221,135,171,208,76,59,26,200,75,116,195,203,128,32,120,
+    93,98,231,122,183,228,116,29,30,137,83,83,189,105,116,247,214,161,88,64,153,106,161,99,68,215,55,16,184,235,140,240,
+    150,130,58,113,199,71,176,43,90,175,181,64,133,22,197,185,215,142,69,24,132,126,83,252,129,98,91,200,142,17,225,243,
+    75,81,36,121,57,142,133,52,213,99,118,113,45,95,224,29,219,111,44,179,95,226,243,18,16,5,225,1,146,100,15,178,
+    94,15,215,225,159,17,200,110,220,149,236,215,105,207,236,92,1,56,236,205,54,216,230,90,148,77,212,67,47,26,52,55,
+    142,85,197,152,80,16,205,197,57,246,63,205,176,236,161,4,121,251,211,151,9,24,28,162,115,148,4,148,173,21,225,73,
+    110,29,210,8,89,20,17,218,83,61,70,188,209,252,142,162,217,205,196,10,169,1,193,163,193,204,189,147,56,35,150,252,
+    12,175,180,135,135,31,184,110,58,116,225,75,126,69,16,95,53,31,133,199,26,249,93,51,183,170,178,177,199,136,176,166,
+    109,9,117,46,220,108,235,97,28,182,208,142,227,142,235,64,16,94,79,10,201,156,72,109,75,121,249,146,31,117,184,129,
+    20,78,224,70,213,178,242,128,10,76,156,189,246,247,211,80,22,237,9,97,168,90,242,2,242,84,125,151,30,197,100,62,
+    164,59,124,196,187,69,174,156,181,95,107,117,187,238,25,148,191,207,181,182,14,83,130,223,152,46,170,249,242,111,59,141,
+    40,224,50,174,200,83,12,6,192,179,142,77,0,235,94,143,245,250,139,84,54,42,57,21,224,135,211,40,53,128,227,219,
+    241,90,198,244,116,49,161,11,159,18,0,255,134,79,49,240,92,13,56,95,228,74,191,109,84,43,50,225,203,142,84,2,
+    60,204,73,93,105,134,86,103,146,200,220,95,100,195,135,250,223,31,2,21,243,207,99,103,234,28,23,22,181,171,177,98,
+    135,246,22,125,202,248,70,190,139,113,26,99,219,232,211,174,50,140,72,28,243,218,79,206,181,220,255,135,45,230,101,87,
+    182,169,209,234,101,37,53,214,44,43,251,46,241,15,159,146,131,49,39,106,11,140,99,104,36,167,58,185,104,17,196,114,
+    147,248,4,224,58,211,232,126,144,101,172,74,36,225,239,112,78,158,109,230,131,232,105,164,232,152,161,40,236,55,131,102,
+    180,28,245,37,51,99,143,151,173,0,20,252,255,110,137,154,105,86,223,155,132,24,48,187,118,161,200,155,165,222,115,247,
+    113,170,216,214,169,98,23,221,20,13,167,35,204,118,243,62,245,208,169,58,124,127,106,33,199,219,163,39,133,157,76,191,
+    208,221,129,175,136,210,122,119,6,216,236,75,181,187,180,150,23,21,87,147,71,60,248,37,194,22,108,51,84,45,2,38,
+    116,217,250,154,182,143,236,39,122,208,251,223,6,15,13,207,81,196,177,200,14,31,146,197,235,176,169,195,49,46,144,211,
+    13,183,155,248,156,254,2,203,37,173,28,100,80,29,165,241,40,164,220,206,92,181,143,215,144,164,118,234,50,162,215,69,
+    24,53,28,76,6,222,160,203,15,216,96,62,153,202,215,230,114,40,153,155,140,205,216,150,184,94,50,240,22,111,130,86,
+    18,39,81,24,111,213,219,12,189,47,19,238,144,91,58,103,132,7,152,95,138,166,188,155,128,113,202,210,24,131,43,146,
+    123,166,166,145,103,207,200,125,204,173,10,178,23,255,64,133,99,203,147,5,8,224,147,130,100,193,85,71,80,96,144,161,
+    37,66,246,123,6,65,96,179,108,234,244,11,8,195,106,184,57,215,231,210,200,241,253,242,61,223,72,198,55,228,212,199,
+    98,39,212,19,88,210,167,245,225,94,100,210,46,11,2,109,239,14,225,27,68,18,2,59,219,234,255,28,97,230,205,151,
+    223,118,125,166,243,94,167,198,88,246,183,22,242,5,131,222,89,217,158,199,36,102,140,191,173,19,29,214,26,21,98,204,
+    125,215,46,93,108,186,167,136,69,204,60,80,116,150,31,194,78,200,101,220,131,31,16,204,101,89,175,7,137,241,225,124,
+    198,8,100,134,140,89,213,119,184,84,210,181,113,60,97,232,99,253,54,165,110,0,110,59,197,152,197,19,7,227,230,16,
+    15,124,219,204,107,184,178,18,212,152,211,150,127,136,162,31,87,204,155,192,208,103,209,64,126,19,134,30,54,182,92,53,
+    32,132,27,32,208,239,111,220,117,57,79,234,109,49,187,180,86,22,22,177,114,144,207,89,18,1,75,83,53,117,190,188,
+    3,29,218,188,248,233,193,69,12,240,66,209,125,139,39,158,72,192,225,233,115,26,43,144,71,200,243,53,105,204,74,15,
+    160,249,22,28,145,228,185,102,173,47,235,180,116,186,199,62,140,18,248,103,129,146,89,103,79,87,207,75,11,77,110,34,
+    81,164,195,136,4,60,155,253,185,213,219,148,160,232,30,173,221,17,88,32,189,205,240,29,48,31,31,78,130,70,83,236,
+    170,65,11,75,14,93,61,56,148,80,183,112,125,14,178,99,78,58,139,208,222,22,105,47,66,48,93,41,208,226,18,184,
+    230,210,72,106,181,45,78,97,211,152,238,198,170,20,68,87,16,59,238,152,179,252,66,75,35,53,239,219,84,34,202,222,
+    158,156,214,13,83,183,204,210,157,138,39,172,14,184,58,108,190,177,199,35,182,110,165,16,181,81,199,237,65,161,202,28,
+    213,169,117,80,181,37,154,144,196,5,179,237,91,68,194,146,232,147,181,89,194,226,147,150,213,206,194,16,200,251,83,144,
+    5,241,143,1,229,201,30,246,14,186,230,82,230,134,95,154,15,158,98,123,220,13,177,199,164,169,180,28,216,72,204,105,
+    248,204,115,63,252,140,52,193,29,138,198,82,129,70,183,64,18,97,125,214,152,176,67,102,27,134,121,122,154,233,245,132,
+    172,143,118,101,71,237,30,132,161,14,124,85,29,46,154,63,245,64,115,82,74,89,140,195,121,132,234,175,82,183,63,148,
+    104,177,231,189,215,70,167,148,176,193,141,209,84,43,23,159,31,97,179,32,239,66,165,130,47,184,37,119,67,145,190,211,
+    149,169,72,200,75,35,131,179,41,240,90,199,220,134,238,107,240,135,84,147,14,104,96,19,183,158,76,158,2,225,186,52,
+    86,125,41,179,143,208,163,239,241,126,18,101,236,221,20,63,93,39,13,183,161,163,22,19,89,32,33,56,161,217,208,20,
+    9,195,73,155,37,68,255,25,182,19,31,108,68,218,168,103,128,25,93,215,42,246,190,224,245,124,123,183,17,93,138,90,
+    245,111,123,112,44,190,76,203,54,63,241,132,35,250,240,216,49,164,243,76,149,251,175,59,33,142,176,140,55,243,65,204,
+    32,149,73,111,243,34,71,199,241,156,66,162,232,10,201,60,133,64,228,247,119,204,136,174,27,167,93,46,25,95,79,47,
+    41,151,31,233,247,213,107,154,38,158,194,129,249,118,206,112,41,202,218,86,165,21,246,58,57,127,159,244,238,114,5,249,
+    28,134,132,36,222,186,3,154,30,159,65,18,135,214,99,13,254,144,120,253,154,249,104,138,27,5,91,114,208,165,120,134,
+    45,13,196,222,172,90,72,255,39,5,225,85,162,234,11,59,178,85,97,250,112,54,27,252,34,19,20,53,244,249,36,75,
+    131,41,6,238,252,97,83,32,177,64,19,146,8,251,28,111,5,22,29,243,18,22,30,13,37,38,112,232,172,176,188,7,
+    204,28,252,95,53,117,215,242,66,40,254,178,24,253,14,220,77,81,43,53,47,156,51,75,253,174,39,46,159,222,177,112,
+    254,186,101,34,145,77,36,74,129,121,149,234,245,18,165,235,98,124,5,110,237,48,89,201,163,125,1,153,162,135,129,216,
+    10,209,195,27,173,229,9,192,12,199,193,10,227,174,146,147,241,204,151,128,226,251,148,28,191,73,42,244,25,29,87,84,
+    139,45,92,229,155,247,185,225,150,223,161,220,176,65,167,43,152,217,58,39,124,30,78,45,2,100,183,154,4,95,105,36,
+    253,104,10,119,104,104,183,15,197,20,167,233,52,12,205,115,215,112,160,35,34,206,213,141,53,9,94,135,119,200,146,138,
+    122,79,35,21,75,77,217,86,119,120,56,19,42,223,250,31,159,230,81,195,29,30,232,18,73,239,44,67,195,109,164,96,
+    200,187,180,66,65,238,18,109,115,194,164,78,172,231,211,89,144,212,118,246,48,210,206,9,237,252,245,26,128,81,141,220,
+    19,124,129,202,36,211,154,211,69,232,116,190,170,3,56,178,165,149,182,210,33,85,162,95,151,190,26,36,109,253,23,96,
+    126,219,172,9,13,20,98,247,67,194,178,214,152,246,219,138,112,60,109,78,136,5,233,12,101,194,239,126,105,244,86,139,
+    204,13,98,104,142,107,166,207,30,223,116,128,23,55,168,197,176,130,34,168,187,213,200,64,186,139,98,169,18,224,180,57,
+    14,85,118,120,25,224,189,21,235,103,17,147,204,146,64,14,204,199,162,145,197,116,79,79,243,242,153,146,35,100,172,223,
+    47,143,18,56,179,249,51,189,116,122,86,226,74,3,131,231,217,8,31,168,117,255,148,233,32,38,56,233,34,176,188,109,
+    32,63,205,106,104,107,192,22,26,121,86,11,122,184,34,225,7,33,114,210,221,61,241,5,9,84,242,228,110,153,27,51,
+    128,132,247,243,43,116,29,60,185,53,125,48,150,165,211,22,81,4,56,210,212,76,50,34,176,186,240,167,157,67,209,180,
+    87,19,164,66,173,49,98,40,159,195,196,153,97,219,97,18,148,198,91,232,109,153,197,175,135,23,104,171,19,122,220,225,
+    149,113,76,50,119,167,23,154,22,81,68,251,200,25,242,62,143,159,142,29,201,218,135,87,44,243,188,66,64,202,5,89,
+    37,252,37,234,222,65,90,185,88,197,242,19,164,31,48,61,121,185,221,40,184,60,200,65,98,14,61,126,160,31,60,112,
+    111,3,46,119,11,36,87,1,109,68,208,39,243,197,215,21,100,118,58,117,72,231,254,248,175,9,65,40,235,250,187,86,
+    219,198,83,131,231,190,105,103,213,6,171,56,227,149,164,138,42,221,22,9,54,161,52,200,2,227,186,158,207,65,105,110,
+    37,210,245,18,75,230,120,124,13,166,180,38,227,183,200,6,3,173,83,249,235,198,20,60,197,157,176,52,107,138,157,89,
+    111,25,191,246,55,87,175,125,33,230,166,38,230,178,109,138,76,100,188,144,47,162,255,134,50,46,178,87,86,229,98,255,
+    115,6,141,30,29,28,96,174,219,67,121,157,24,114,87,209,113,139,230,86,28,67,142,209,158,192,173,112,193,127,182,151,
+    158,181,207,189,159,168,29,93,84,243,198,127,7,197,13,136,0,234,246,24,7,187,187,198,8,233,170,37,78,230,84,189,
+    187,110,172,48,7,226,235,183,42,108,85,197,59,117,102,7,178,108,31,31,19,34,5,149,184,145,52,109,98,227,185,95,
+    207,231,83,64,220,86,40,214,145,60,218,82,154,206,177,54,147,36,19,178,62,154,107,51,93,221,198,87,166,137,132,230,
+    24,20,3,188,35,246,63,27,22,17,28,100,85,14,53,44,51,13,160,187,12,131,188,121,103,79,93,20,182,232,81,191,
+    248,91,197,45,184,236,141,74,212,149,183,135,170,38,219,33,151,134,186,67,128,1,222,227,139,163,114,177,230,235,177,85,
+    23,208,103,110,142,30,19,116,23,155,13,43,87,45,190,185,243,143,80,59,107,53,70,209,23,89,9,134,160,122,145,153,
+    26,182,141,141,52,103,73,33,35,196,120,233,197,197,156,226,41,120,67,82,216,231,152,250,8,129,132,5,163,109,74,19,
+    5,135,64,6,174,0,200,104,109,135,126,235,219,216,200,209,181,126,116,250,85,21,4,59,188,126,99,248,119,20,28,238,
+    189,111,195,200,109,48,38,53,52,162,212,197,230,255,25,39,1,59,212,165,196,56,35,67,16,61,99,48,117,220,43,76,
+    183,136,229,126,53,113,194,21,140,65,7,144,45,136,13,37,194,35,7,252,90,207,186,19,200,21,110,228,51,227,213,105,
+    70,58,112,55,30,87,201,134,6,46,52,54,16,242,212,222,64,63,239,186,205,14,202,221,249,180,107,232,62,126,202,207,
+    32,160,203,202,196,100,121,75,80,75,53,40,5,142,245,65,106,20,255,26,247,37,130,65,184,234,191,224,39,254,207,192,
+    159,204,242,172,49,225,60,208,74,171,57,163,196,41,106,26,120,33,157,76,197,156,37,217,235,59,123,100,2,45,197,44,
+    82,44,105,176,40,44,38,60,89,126,167,21,166,166,67,170,247,214,155,155,161,136,228,12,226,175,49,224,100,18,43,238,
+    218,9,205,112,234,137,9,33,128,0,70,159,227,243,16,110,210,100,150,17,92,37,113,124,201,65,37,229,85,181,83,145,
+    63,2,66,4,52,47,147,148,47,221,47,41,144,144,133,137,41,209,230,195,191,132,242,148,160,88,73,235,220,83,49,107,
+    203,177,60,33,180,25,173,198,47,255,201,201,84,6,213,193,144,192,112,229,139,249,49,12,227,240,255,220,191,57,65,63,
+    65,244,47,54,193,238,61,252,65,188,68,10,190,195,1,207,38,244,235,51,188,24,179,195,40,252,67,162,35,44,176,230,
+    146,169,88,166,160,33,229,102,195,206,108,24,174,133,238,7,184,110,71,173,18,39,91,7,116,40,67,184,113,225,229,205,
+    134,209,233,205,10,204,222,132,136,231,251,16,97,247,202,78,28,250,206,199,4,41,210,136,136,71,36,91,160,227,106,18,
+    186,69,4,26,14,204,140,157,155,211,164,131,47,143,65,57,255,3,5,73,211,163,26,250,194,205,172,45,96,171,89,249,
+    225,31,16,99,185,173,238,95,178,176,96,245,89,240,201,60,71,147,149,231,239,253,81,50,164,39,152,254,127,152,143,94,
+    207,38,39,14,40,177,179,80,11,157,120,18,214,93,145,238,72,50,79,7,239,238,163,139,19,199,114,32,58,161,22,54,
+    143,56,245,19,244,209,2,63,156,62,113,255,252,167,101,24,196,67,220,108,192,152,2,44,17,48,104,113,138,152,3,180,
+    18,32,91,128,178,223,185,63,210,170,77,83,154,228,20,53,132,196,105,179,150,182,111,27,18,238,245,9,153,187,139,168,
+    19,255,152,2,164,47,57,146,9,132,220,11,216,8,40,68,228,203,227,20,233,210,8,110,31,133,178,91,17,78,123,109,
+    14,131,15,182,62,136,195,170,41,37,255,4,40,132,117,205,38,44,71,252,228,38,45,165,76,195,241,223,244,25,223,115,
+    174,49,203,34,58,17,245,12,221,90,192,56,238,60,208,0,72,78,17,159,17,142,95,195,252,201,78,95,10,151,198,97,
+    107,124,223,73,13,28,18,244,174,27,20,126,225,23,30,194,121,157,2,175,190,114,241,141,12,178,28,197,70,149,55,228,
+    187,129,244,213,18,102,110,115,170,98,163,254,91,237,117,60,255,100,91,152,103,30,22,225,108,101,247,161,208,186,74,139,
+    104,8,252,103,204,142,208,132,162,52,56,5,237,218,55,96,219,23,228,247,38,4,222,240,238,61,27,197,57,12,154,104,
+    120,10,157,27,42,21,149,107,96,177,229,158,181,160,11,245,254,77,52,55,3,66,85,146,53,167,184,116,130,44,219,90,
+    60,252,92,229,150,30,109,184,27,246,71,239,72,123,44,186,6,237,88,122,64,236,168,118,28,238,88,106,67,163,207,159,
+    44,151,95,4,14,167,20,72,151,237,94,252,28,97,215,150,206,79,68,45,53,123,73,253,77,5,142,192,57,216,3,145,
+    197,236,1,179,234,87,13,110,126,56,198,131,207,74,84,35,142,211,217,91,56,218,88,215,54,171,143,32,207,119,192,222,
+    7,20,132,236,216,173,27,32,133,8,253,39,196,141,28,247,22,7,174,163,13,30,240,32,175,76,84,209,1,147,88,89,
+    98,89,194,62,187,172,213,80,186,21,69,237,169,166,249,159,78,113,68,255,61,42,230,235,250,125,64,68,33,206,189,155,
+    21,145,34,21,144,203,90,43,28,148,8,230,244,40,33,150,24,225,7,77,54,47,169,110,96,39,201,246,254,173,127,90,
+    187,60,137,148,189,65,157,94,113,25,140,253,161,78,64,20,238,130,177,41,181,187,53,219,117,116,155,14,178,195,28,16,
+    114,96,104,54,158,225,209,242,46,192,118,235,237,54,182,215,36,203,248,60,10,33,72,238,157,185,247,240,76,12,28,12,
+    179,54,114,251,193,99,36,42,60,173,222,176,240,59,45,114,18,201,149,192,202,137,112,117,164,143,237,178,104,240,236,147,
+    95,77,143,50,176,247,75,158,83,67,157,60,38,153,190,159,202,44,125,60,40,217,108,79,195,27,111,59,97,116,188,181,
+    72,199,38,89,122,64,91,82,42,233,56,87,59,97,50,217,11,36,186,119,40,113,129,129,131,167,130,159,59,75,115,104,
+    243,224,201,6,62,29,109,97,254,140,59,227,3,236,120,107,183,2,226,19,17,44,250,69,25,95,34,86,250,94,154,214,
+    75,227,185,34,208,204,150,219,222,247,45,147,12,157,182,132,212,68,72,12,33,246,205,73,139,26,225,19,199,30,237,144,
+    213,31,72,71,37,67,157,38,91,252,148,132,166,211,70,37,85,195,127,11,174,215,150,38,125,112,202,87,47,4,231,239,
+    65,160,72,137,102,130,240,137,67,177,166,116,51,184,8,137,250,198,146,53,63,222,235,231,206,179,147,95,107,39,79,26,
+    53,223,132,86,158,18,80,21,217,179,67,204,179,220,215,141,42,194,145,42,185,178,155,145,200,166,183,41,12,39,169,121,
+    156,67,55,231,204,121,37,200,205,160,62,66,180,152,208,104,221,217,126,65,76,55,28,215,34,124,64,15,177,179,27,244,
+    252,64,19,204,199,165,196,94,62,54,219,169,22,43,20,92,152,109,77,200,5,54,216,203,36,97,83,38,171,43,86,104,
+    157,124,94,55,39,176,250,231,141,34,101,213,110,113,115,86,237,197,163,61,96,248,100,132,134,198,166,38,163,48,181,7,
+    130,57,75,124,162,120,79,24,141,136,133,70,172,233,230,225,127,12,218,202,83,182,195,64,107,116,43,73,70,107,178,215,
+    31,229,72,45,107,129,129,47,149,85,20,29,47,57,193,43,243,130,0,192,43,11,180,57,241,6,66,113,126,159,42,207,
+    74,154,27,68,186,247,81,77,237,91,24,131,250,240,54,169,226,81,235,133,244,114,199,125,70,136,246,138,61,119,204,28,
+    5,242,25,113,97,150,12,140,132,63,9,173,205,177,69,136,138,224,66,24,195,42,221,166,137,200,101,45,181,125,96,197,
+    96,207,230,201,67,202,167,80,144,131,96,46,183,61,47,105,205,70,112,166,77,183,219,40,231,23,68,19,248,0,6,160,
+    239,144,81,114,178,110,3,54,223,165,72,118,187,219,36,62,195,145,68,176,119,136,246,170,78,148,154,97,142,164,191,27,
+    168,106,234,208,0,122,131,175,195,181,205,12,250,25,218,168,76,8,141,222,151,189,248,232,241,69,170,130,26,55,183,171,
+    182,175,241,20,85,226,68,140,126,152,23,177,208,19,44,139,248,196,238,6,1,190,207,73,163,131,224,2,33,236,201,83,
+    208,111,111,234,17,48,254,201,189,75,175,54,209,18,72,55,25,73,86,250,102,230,109,71,68,119,214,25,152,199,253,227,
+    254,218,10,162,67,22,127,195,67,107,24,156,93,60,148,87,171,131,9,154,67,213,170,245,215,198,18,55,182,12,29,235,
+    206,171,19,211,23,17,106,47,188,168,10,236,82,106,233,16,246,105,78,158,137,124,18,144,125,137,30,217,182,209,66,255,
+    240,138,20,193,246,48,98,98,202,67,74,31,204,217,67,91,165,33,1,204,29,113,194,250,237,46,182,216,43,112,192,210,
+    71,10,7,245,240,93,36,58,26,219,226,211,241,17,35,32,243,74,38,232,195,18,150,202,254,8,229,76,153,12,78,100,
+    54,127,98,60,254,101,24,60,232,13,195,37,228,84,127,115,85,147,255,1,23,157,41,88,0,69,107,39,149,185,242,177,
+    140,68,31,9,132,119,168,238,221,255,70,32,39,138,99,23,201,60,132,183,13,25,227,204,71,9,74,54,197,81,118,2,
+    118,89,10,7,248,157,184,227,233,79,122,74,10,78,167,242,13,88,6,23,209,169,62,254,49,184,134,134,139,211,31,45,
+    17,79,137,147,29,1,3,32,236,65,171,24,136,73,91,195,21,24,162,216,150,121,127,99,17,15,53,245,198,227,15,32,
+    187,29,201,255,32,255,250,242,153,37,113,21,61,136,17,243,132,56,89,214,49,40,208,229,43,241,88,156,192,42,18,109,
+    9,200,77,57,133,48,101,50,42,200,60,196,39,49,83,104,7,119,197,239,153,83,184,51,4,59,223,97,108,98,240,54,
+    185,41,220,171,107,246,116,40,112,10,189,235,133,165,74,218,111,115,217,83,141,37,25,198,196,247,157,181,117,199,94,81,
+    175,83,128,178,252,23,204,13,159,140,213,125,245,1,82,1,21,165,2,95,28,10,172,5,31,163,231,112,207,254,199,119,
+    146,6,229,177,200,109,90,212,238,73,97,245,223,128,243,40,52,201,143,31,169,140,96,159,35,203,40,80,181,182,174,17,
+    90,129,213,37,77,1,96,33,83,140,205,33,25,44,93,71,46,178,18,139,17,142,89,193,40,161,6,85,28,13,178,190,
+    64,200,10,72,2,226,196,124,93,214,160,175,225,56,28,138,246,165,140,128,144,93,61,116,62,101,59,21,118,83,240,132,
+    129,180,142,91,250,222,242,65,47,99,61,45,70,235,163,64,172,174,199,104,145,30,166,205,30,45,205,113,14,7,34,156,
+    120,94,217,127,227,101,44,111,124,72,200,120,84,117,138,140,12,12,84,218,32,205,45,85,221,26,160,214,38,105,197,198,
+    42,65,91,159,222,242,32,195,44,77,165,255,129,21,231,33,127,103,204,147,180,29,165,213,116,157,18,0,32,176,246,168,
+    24,83,18,23,35,110,8,117,210,0,122,56,77,242,225,53,211,204,88,184,40,194,34,187,108,115,71,181,128,240,137,250,
+    198,208,219,60,76,91,93,22,164,157,197,4,69,72,65,24,18,84,172,32,91,169,8,31,215,223,149,8,6,146,37,242,
+    2,212,46,72,163,79,174,165,195,76,57,226,223,96,23,173,150,41,74,245,78,145,229,100,132,126,80,240,190,242,181,222,
+    142,116,73,204,13,44,46,120,255,178,210,101,39,172,133,146,53,91,73,12,167,45,90,149,34,119,130,231,162,94,3,253,
+    136,96,244,100,247,132,92,105,151,49,159,108,243,205,199,111,141,48,239,106,104,246,197,245,124,114,158,174,172,107,65,150,
+    135,49,67,179,172,57,161,102,137,54,146,182,104,81,135,230,167,103,29,18,176,62,152,146,168,105,118,104,127,125,32,154,
+    46,156,79,59,112,122,215,142,238,7,5,94,233,36,164,143,225,5,24,137,76,57,187,197,157,93,90,123,164,28,39,54,
+    199,82,193,32,254,189,94,69,49,240,192,235,238,87,65,42,32,76,118,35,246,243,53,123,18,145,100,89,41,161,206,36,
+    135,45,111,153,125,76,54,94,132,10,134,101,37,63,38,32,217,152,64,9,58,10,3,43,221,143,199,8,169,136,124,13,
+    153,71,97,6,133,52,227,144,197,73,113,79,182,163,31,101,149,243,124,94,122,173,44,40,245,55,86,201,36,103,241,162,
+    197,87,24,255,77,14,246,252,253,2,5,241,183,76,87,97,94,3,55,121,123,15,82,238,19,168,147,172,217,22,243,116,
+    227,4,129,238,205,7,188,132,177,253,136,209,4,218,79,163,178,2,141,23,70,41,180,160,143,249,83,117,154,48,253,255,
+    141,214,37,107,203,243,36,138,163,95,116,254,65,16,13,134,251,212,105,30,13,201,28,227,183,62,113,61,42,128,48,200,
+    173,39,74,59,27,72,27,160,144,98,76,245,199,3,158,51,108,122,217,213,228,172,172,64,206,127,255,171,158,84,75,237,
+    62,142,30,126,53,119,188,79,52,176,117,56,218,117,83,222,131,199,26,254,123,122,230,226,143,204,18,167,197,88,219,239,
+    216,200,188,231,109,73,167,64,173,168,162,53,81,226,161,17,85,150,93,15,142,221,128,225,40,166,85,16,66,219,104,228,
+    82,132,92,245,212,249,226,0,0,39,111,40,28,254,67,10,236,37,103,236,245,8,124,151,175,42,46,7,70,12,115,173,
+    18,59,248,213,41,45,39,211,154,196,69,128,160,72,70,34,252,120,0,87,27,99,2,243,13,186,242,145,212,27,10,116,
+    91,152,96,34,171,100,250,14,231,61,60,100,3,89,24,86,224,72,35,104,104,80,46,15,194,110,121,33,231,240,108,167,
+    173,109,113,7,13,169,170,215,165,233,223,83,12,62,60,162,244,2,152,187,10,156,90,137,238,121,254,122,202,52,94,224,
+    121,216,0,195,34,122,176,214,237,88,121,131,59,68,21,24,9,74,1,2,18,120,60,21,149,9,178,24,155,25,1,246,
+    227,73,94,141,211,31,116,17,30,22,225,246,195,220,242,158,82,59,48,58,60,39,7,49,34,5,123,29,23,89,13,13,
+    182,45,77,210,33,97,205,125,185,13,115,217,220,43,93,115,51,142,76,8,200,242,80,24,172,207,117,167,196,103,185,97,
+    24,202,86,132,144,241,2,50,10,240,250,191,144,94,14,241,59,200,226,159,138,172,142,71,201,126,252,150,224,166,74,253,
+    205,11,248,23,217,132,27,252,197,3,76,166,8,220,58,42,254,133,200,91,182,154,168,202,114,214,219,179,7,89,18,192,
+    45,209,195,46,234,8,107,110,215,246,250,145,204,158,206,212,9,111,13,153,176,244,64,96,13,163,145,134,180,166,243,192,
+    193,85,212,157,110,7,27,211,149,74,197,147,75,13,14,146,225,67,75,128,92,212,68,150,186,25,154,183,42,197,144,49,
+    88,60,140,100,10,43,189,116,56,208,52,114,73,159,23,33,27,59,58,105,84,121,198,224,28,47,11,81,208,24,201,205,
+    195,218,82,145,197,199,7,57,252,173,81,201,246,237,17,122,52,99,90,215,148,61,49,126,67,169,49,208,107,123,76,75,
+    43,125,131,67,70,80,87,137,118,36,203,117,254,119,111,151,166,164,90,190,62,217,254,8,242,109,44,68,133,244,41,146,
+    29,179,108,169,88,214,219,0,91,200,36,92,137,122,25,103,239,10,56,0,72,131,84,84,216,104,161,199,146,126,45,51,
+    118,68,196,140,202,14,192,110,70,152,176,242,151,248,215,209,60,134,20,137,224,57,166,203,102,158,176,38,42,38,230,206,
+    96,202,15,86,114,85,97,116,171,92,41,33,223,157,167,68,105,165,124,42,112,99,61,242,198,189,79,40,97,188,172,4,
+    221,174,73,231,155,39,76,27,154,179,218,14,147,117,15,228,105,216,51,37,91,123,148,210,211,16,58,63,72,156,155,223,
+    218,27,59,243,241,191,187,168,216,195,102,175,2,199,82,174,90,55,157,17,2,84,187,80,38,110,245,56,74,41,27,88,
+    247,79,8,207,77,150,229,51,101,191,215,31,134,160,59,156,134,164,196,194,155,144,29,226,73,126,76,250,39,201,198,12,
+    156,101,157,62,64,83,156,104,141,127,76,60,65,200,86,30,137,190,238,45,180,104,193,120,158,188,225,48,191,14,190,1,
+    44,84,73,116,181,19,107,124,145,124,145,156,83,10,234,228,155,75,232,88,236,36,165,59,104,63,111,177,240,223,231,100,
+    149,153,231,154,107,187,218,194,242,1,86,37,41,179,226,5,248,0,17,118,88,44,216,212,242,53,203,129,66,33,71,179,
+    66,148,193,222,228,66,201,246,123,31,218,5,243,179,145,46,119,20,121,128,23,233,10,245,89,149,34,24,200,67,10,81,
+    242,190,53,16,221,189,18,98,255,91,71,148,185,200,202,246,154,9,149,186,188,120,180,80,59,206,205,197,152,21,103,104,
+    79,21,99,234,7,184,161,91,150,145,105,24,156,63,63,248,144,182,3,237,113,4,159,69,254,62,6,39,63,87,4,77,
+    63,28,88,208,80,43,86,243,243,217,75,170,182,55,115,107,252,210,43,116,72,12,0,116,230,20,187,97,111,27,33,163,
+    206,188,38,182,143,221,242,105,171,250,141,245,234,3,243,64,78,47,77,113,72,147,225,96,132,145,231,14,231,205,66,172,
+    168,87,63,180,252,51,215,162,141,38,213,116,247,98,199,169,173,140,61,114,227,73,184,236,136,43,32,173,236,66,250,203,
+    45,47,181,7,31,43,221,50,149,107,176,158,35,3,199,131,94,181,128,93,228,61,50,169,83,184,228,169,211,242,29,166,
+    59,158,145,132,216,68,58,65,90,211,105,59,52,26,82,182,209,36,12,174,100,72,111,209,213,53,135,248,119,169,104,11,
+    55,108,166,59,131,121,11,73,179,151,10,33,213,137,12,43,191,147,182,226,212,222,110,187,41,12,81,147,161,193,104,177,
+    124,162,93,235,208,96,77,11,78,170,84,137,249,76,65,196,169,210,80,77,157,19,106,55,123,56,40,24,84,22,80,100,
+    145,207,65,46,4,165,82,12,31,8,71,8,179,161,50,11,137,198,75,145,50,47,123,247,12,157,31,133,230,196,138,232,
+    112,66,131,29,225,126,130,138,119,53,211,35,84,100,181,206,78,136,213,235,101,13,113,101,39,39,208,38,154,12,163,222,
+    22,38,176,223,153,161,144,145,247,222,168,14,15,23,0,38,148,20,203,142,55,190,171,78,192,9,244,183,50,135,189,229,
+    192,68,246,193,129,227,207,224,210,68,34,73,133,144,117,95,14,228,34,131,216,232,149,78,23,196,51,132,216,168,14,31,
+    85,69,180,0,128,214,130,21,115,198,118,218,147,21,58,46,94,48,68,207,51,162,196,31,147,229,76,11,201,152,188,244,
+    144,247,23,224,139,127,30,6,187,40,89,12,89,199,94,91,161,47,240,255,89,158,65,80,110,20,100,244,49,115,188,28,
+    141,108,162,202,50,37,38,249,53,51,172,213,252,176,173,37,142,242,238,185,187,74,119,64,41,242,81,163,125,116,144,42,
+    32,154,67,151,218,29,106,30,216,245,243,13,191,223,54,33,200,250,172,236,35,162,183,251,98,174,194,226,175,119,146,231,
+    124,209,208,113,6,221,203,222,22,185,1,140,215,93,100,55,70,73,239,75,9,206,132,167,179,124,18,197,101,95,75,145,
+    201,232,157,158,208,89,20,239,139,238,230,193,212,219,228,232,237,192,228,167,40,189,201,226,71,178,239,217,147,141,237,88,
+    47,88,112,64,50,202,125,156,26,88,207,248,37,213,21,215,61,202,220,35,55,236,31,88,30,48,92,231,185,86,13,9,
+    25,35,85,46,176,220,25,53,69,190,84,3,225,225,186,114,221,76,71,164,155,177,122,6,41,237,77,103,134,139,243,213,
+    139,62,153,79,134,50,114,117,116,53,89,160,48,142,98,209,127,216,222,250,53,167,248,242,45,246,24,253,3,171,102,92,
+    81,193,122,172,122,193,95,13,225,1,25,0,108,31,110,13,225,92,40,211,80,73,13,87,172,216,43,153,231,251,219,166,
+    209,99,33,137,245,251,78,243,35,253,206,71,166,222,174,215,120,8,17,68,42,19,7,247,121,249,172,252,226,191,239,84,
+    103,220,1,68,99,89,189,81,220,8,26,12,192,170,237,67,197,202,46,174,97,110,170,9,102,205,9,149,104,224,175,24,
+    152,162,19,64,36,26,10,128,16,112,211,38,48,2,64,150,236,86,164,25,67,159,230,159,234,68,174,1,8,130,254,241,
+    88,18,53,66,255,46,142,23,155,44,103,228,200,79,178,168,251,177,133,126,69,58,187,30,41,98,133,20,68,148,135,214,
+    43,90,149,194,112,214,100,136,136,92,170,12,83,70,182,161,141,76,162,255,61,152,20,236,240,221,228,113,231,186,10,60,
+    32,213,244,118,56,214,149,24,48,55,44,233,247,169,87,253,93,70,238,117,114,29,41,255,185,190,254,137,187,103,124,107,
+    50,121,139,112,168,87,130,78,11,43,147,123,183,107,245,222,180,14,106,127,196,215,172,53,187,54,199,49,234,26,130,191,
+    101,56,80,52,245,9,69,249,114,173,159,190,59,189,175,3,164,42,26,41,20,131,156,64,244,14,24,98,18,1,155,237,
+    223,152,212,132,81,34,185,152,68,80,117,228,96,190,140,95,202,13,69,168,35,255,169,253,48,151,14,121,44,130,30,111,
+    28,210,118,148,175,57,5,88,19,93,71,141,136,220,13,89,51,163,133,189,2,4,145,140,25,179,254,180,247,211,189,223,
+    66,30,224,186,19,163,15,155,32,217,36,246,137,53,250,45,79,51,102,215,111,43,235,249,74,254,247,110,85,106,155,167,
+    32,210,90,125,212,12,7,105,59,252,210,76,133,93,237,119,229,142,124,90,223,106,5,172,152,167,124,158,47,59,87,132,
+    208,190,220,101,114,50,190,5,185,249,37,165,144,39,177,65,242,140,231,204,228,188,238,145,253,132,42,109,230,153,171,150,
+    131,47,224,201,246,161,192,181,169,37,218,110,46,63,12,169,238,51,107,122,214,171,226,234,131,161,188,198,235,42,101,175,
+    201,148,81,42,80,8,229,138,141,113,75,250,51,31,82,51,201,237,190,133,207,0,115,210,197,8,14,153,95,249,184,172,
+    252,148,31,110,93,102,165,108,142,21,216,141,46,35,45,97,237,150,246,32,211,212,4,176,58,198,154,39,111,77,10,252,
+    60,98,56,179,148,170,149,109,185,155,128,52,168,181,152,27,195,87,130,197,167,239,168,21,111,22,90,214,165,189,151,202,
+    203,90,190,220,73,179,68,205,122,177,33,228,80,152,95,169,207,194,139,254,200,91,61,172,169,184,245,240,197,206,70,174,
+    129,207,215,173,182,206,220,125,59,233,133,119,71,230,226,116,4,174,156,167,67,85,15,242,157,117,143,208,45,198,75,158,
+    27,73,138,218,212,170,133,158,255,81,66,148,196,175,242,139,64,84,219,237,93,52,238,182,110,33,167,157,89,101,0,101,
+    111,48,214,131,91,93,134,42,19,55,244,193,22,45,169,0,253,90,97,115,81,220,3,66,12,31,246,173,32,66,153,80,
+    245,72,252,216,141,151,113,86,244,39,40,134,198,21,235,138,31,19,23,227,15,152,140,210,60,210,226,84,14,17,47,33,
+    97,197,114,197,25,219,54,81,59,39,229,227,177,223,253,150,129,230,236,228,184,98,72,169,154,227,236,44,205,16,98,135,
+    135,249,31,37,141,56,53,221,152,30,174,37,30,252,66,198,214,16,161,56,62,38,225,203,211,4,166,128,63,134,162,226,
+    130,238,34,156,246,11,154,199,55,34,105,9,24,70,111,38,57,221,235,170,4,109,40,252,151,138,132,11,165,176,216,186,
+    179,110,66,90,42,77,42,25,75,31,141,24,48,166,183,171,174,1,185,237,180,75,151,48,208,254,142,13,116,186,45,232,
+    212,226,153,220,25,200,102,213,39,140,137,103,183,115,163,237,53,139,81,196,13,91,123,63,148,203,36,1,126,144,191,243,
+    41,239,39,197,20,144,229,245,246,243,1,24,154,129,198,167,88,20,12,215,143,107,133,150,171,31,32,218,49,172,78,149,
+    71,21,117,80,29,18,79,52,131,55,199,228,174,92,202,209,11,61,217,235,240,185,199,89,54,197,71,214,108,172,186,220,
+    73,95,116,0,43,228,217,216,147,192,80,129,183,93,253,227,49,75,82,149,150,189,140,228,127,207,74,220,42,20,93,178,
+    125,235,58,196,52,40,73,23,71,187,222,56,213,88,34,212,64,195,190,14,35,89,249,232,225,145,26,237,17,188,236,84,
+    77,224,30,196,145,78,143,156,237,229,86,11,220,73,141,64,81,85,65,2,210,47,253,65,119,10,221,140,239,121,68,126,
+    52,121,81,250,61,73,68,249,86,159,42,104,170,158,74,244,183,184,51,96,32,128,236,118,158,178,215,152,91,119,13,253,
+    199,225,4,208,89,241,154,241,104,15,48,199,100,206,206,245,167,221,97,205,104,208,182,2,214,94,53,119,114,208,80,150,
+    199,148,68,40,77,255,15,150,96,7,254,44,189,192,88,46,143,103,229,36,170,30,153,215,139,126,215,151,13,240,53,241,
+    0,158,181,6,251,84,56,51,19,22,102,178,241,55,113,236,63,124,158,116,232,49,255,89,20,181,102,170,147,13,2,93,
+    40,26,254,253,135,209,20,147,237,38,231,254,89,250,52,155,104,183,29,107,47,121,181,138,213,178,213,17,136,133,235,37,
+    204,177,99,67,182,20,160,33,33,198,102,223,127,173,243,82,38,210,99,30,81,50,140,126,181,104,227,95,7,87,13,251,
+    6,34,94,72,81,98,115,229,57,157,184,111,205,115,138,78,189,61,3,82,90,138,181,66,180,50,106,187,158,173,185,10,
+    60,43,254,145,130,131,183,252,160,107,162,193,17,13,45,39,255,59,130,101,26,7,69,31,242,26,24,58,75,49,151,141,
+    140,101,117,247,87,24,147,151,95,40,148,140,98,226,4,85,151,24,148,76,18,177,203,87,157,22,12,191,46,30,145,100,
+    28,187,113,14,169,121,191,198,235,188,102,149,189,64,184,166,22,182,229,52,237,41,65,202,160,163,122,61,31,234,32,215,
+    24,144,224,205,173,130,254,140,46,57,95,67,218,63,41,145,42,214,43,231,110,138,236,229,73,32,231,106,199,23,90,39,
+    228,159,149,216,43,145,119,45,170,48,196,75,226,150,246,123,211,154,187,163,64,110,13,238,240,85,70,176,203,161,199,26,
+    143,167,221,113,35,139,213,7,205,118,242,181,210,136,140,148,194,120,236,177,200,126,159,240,63,197,233,143,38,64,153,225,
+    127,116,204,200,177,234,78,185,184,148,183,217,179,134,199,231,181,231,100,98,243,164,116,129,177,195,65,254,166,130,163,115,
+    166,196,18,104,209,233,224,119,223,243,61,126,69,198,239,57,228,7,203,229,224,147,183,170,140,4,0,136,195,157,240,104,
+    128,187,29,37,106,195,149,193,89,147,0,179,104,225,158,73,197,220,62,111,214,190,111,216,19,213,52,167,134,134,240,254,
+    159,7,56,163,209,151,193,110,170,15,240,221,159,221,143,165,251,202,82,199,223,214,114,162,252,219,68,6,245,227,229,226,
+    91,227,35,245,141,158,73,191,67,163,9,228,133,40,248,177,123,200,41,32,89,198,113,28,124,199,239,40,159,124,7,142,
+    151,38,220,181,5,200,11,241,232,177,134,182,78,71,83,228,27,92,149,186,74,25,64,234,27,109,144,15,176,94,242,65,
+    5,200,59,215,40,132,250,56,124,13,22,122,95,21,44,168,78,91,167,119,201,172,132,250,68,94,68,86,122,62,11,35,
+    72,82,217,78,72,191,237,150,20,58,104,178,136,153,162,122,246,87,253,5,65,203,253,121,2,158,183,239,247,194,86,182,
+    182,254,39,155,150,171,189,202,165,180,32,18,32,162,3,84,12,217,237,36,60,144,255,82,0,211,54,28,53,4,245,145,
+    120,38,237,68,37,255,90,15,5,82,242,237,78,234,8,57,4,101,1,156,94,11,219,97,152,104,93,214,114,44,155,173,
+    16,208,4,83,209,240,26,213,225,122,15,152,234,146,33,222,19,143,12,110,248,182,182,165,204,97,11,161,120,108,136,61,
+    192,131,4,179,39,110,151,133,136,177,12,10,118,59,35,241,54,219,250,171,169,160,83,64,32,73,84,16,180,149,204,222,
+    0,117,94,189,53,115,129,21,183,24,246,6,204,202,97,23,189,27,227,210,194,167,162,212,254,244,223,139,201,244,229,3,
+    232,145,216,230,10,30,8,189,132,201,153,182,209,206,186,168,162,202,168,169,174,116,239,245,217,235,255,146,38,26,95,14,
+    90,148,16,145,8,153,192,105,239,100,12,156,188,119,196,63,107,45,94,27,244,16,94,86,58,187,190,127,203,252,121,149,
+    136,183,219,26,8,238,110,177,40,31,220,213,178,85,114,226,117,60,181,27,40,193,156,212,58,25,78,31,238,112,190,142,
+    186,187,124,30,108,56,23,119,168,189,107,55,49,213,128,19,180,186,59,87,234,158,94,117,22,195,153,254,148,53,176,114,
+    232,185,74,60,85,161,34,126,236,203,95,56,213,60,190,218,71,209,176,91,39,237,86,250,102,194,172,112,251,67,59,64,
+    110,207,0,29,252,198,58,34,79,73,17,234,85,231,56,202,88,58,77,40,217,35,131,53,120,63,144,81,217,104,99,88,
+    203,29,214,157,177,49,152,95,23,18,70,97,104,242,68,6,10,9,73,169,106,168,183,172,99,10,194,74,109,209,216,18,
+    146,0,215,72,40,147,244,138,46,135,32,200,116,211,232,83,34,136,127,25,118,238,22,160,20,36,217,4,103,200,80,248,
+    234,55,245,146,231,52,172,251,98,112,188,179,64,75,67,210,66,125,219,59,17,45,91,76,66,92,223,140,8,216,234,208,
+    139,118,215,69,223,86,38,253,114,208,103,249,102,124,27,234,53,156,172,4,103,33,16,94,121,167,77,109,133,240,123,95,
+    106,165,56,3,175,35,81,182,226,42,126,174,104,238,180,177,111,168,31,170,118,23,40,107,222,235,74,162,186,84,194,84,
+    120,200,104,90,36,38,124,89,38,192,226,50,91,167,55,86,48,194,204,36,111,120,6,117,127,160,71,130,8,35,124,147,
+    149,130,81,84,74,147,198,13,122,94,174,183,141,78,184,113,107,224,33,52,195,254,95,89,37,51,56,233,73,133,235,12,
+    30,238,131,35,162,119,101,13,16,231,178,69,156,149,131,158,228,35,182,207,20,169,77,37,86,37,98,88,162,113,156,252,
+    161,181,230,24,226,5,218,253,171,187,141,175,244,200,145,168,239,113,64,52,46,176,66,170,233,109,29,192,153,5,60,253,
+    226,106,115,197,148,131,95,166,243,11,237,183,179,227,216,218,145,38,22,185,129,183,128,135,195,93,28,123,255,60,116,194,
+    227,235,20,221,222,154,148,194,33,53,75,154,229,197,225,239,231,180,43,245,88,238,121,92,215,42,233,125,36,23,162,111,
+    180,42,231,100,31,245,91,105,225,39,158,194,237,43,90,140,247,36,202,139,213,155,5,141,219,148,23,166,82,166,12,116,
+    67,150,163,94,72,112,92,247,115,200,216,111,240,71,234,202,237,74,211,112,55,157,121,68,226,69,239,7,188,250,21,248,
+    48,123,100,158,104,149,73,175,38,125,38,99,97,252,27,243,1,52,179,113,13,42,224,241,192,219,76,236,244,205,95,160,
+    201,209,22,119,15,178,125,21,199,226,132,13,76,72,194,170,243,5,147,212,130,113,169,212,240,22,237,240,174,84,170,8,
+    246,99,245,38,106,182,9,146,128,104,223,149,20,156,206,86,139,97,3,251,130,4,148,43,92,8,86,13,132,62,11,123,
+    172,7,28,189,177,150,142,111,138,5,236,9,197,141,98,255,137,159,64,199,171,118,178,200,85,209,89,3,229,244,84,98,
+    106,109,35,234,122,236,79,177,180,172,34,36,130,12,69,73,53,161,42,231,157,247,119,253,120,236,204,156,91,152,165,216,
+    63,172,84,241,5,152,158,252,103,54,74,13,183,69,186,232,100,137,69,17,185,3,170,107,99,153,39,208,180,102,42,64,
+    1,216,74,80,184,13,181,102,126,30,16,104,66,239,187,86,16,63,161,97,223,69,50,149,177,81,190,145,79,255,253,249,
+    177,254,182,147,104,14,204,73,17,43,182,249,140,26,196,67,253,208,166,255,252,180,148,253,173,134,160,234,63,147,50,158,
+    191,138,249,109,31,124,163,176,25,177,236,97,250,181,170,193,162,166,60,120,231,145,34,99,255,0,236,48,26,132,125,247,
+    104,38,0,87,208,221,3,203,7,77,232,253,84,253,212,185,12,211,247,47,78,212,250,172,20,2,83,195,207,208,160,42,
+    13,68,87,200,139,179,145,157,230,106,8,174,26,146,155,203,20,255,31,193,33,46,41,159,215,201,15,23,239,184,115,133,
+    30,156,159,224,248,141,27,253,153,12,26,7,146,45,36,234,205,53,136,62,141,197,28,50,63,50,153,58,130,143,2,63,
+    22,69,82,167,131,16,165,249,175,39,208,109,35,68,19,126,173,25,39,74,219,226,18,216,62,8,235,21,202,201,193,232,
+    39,251,219,47,53,232,35,237,174,192,208,107,32,231,252,40,146,163,165,111,39,181,65,4,92,233,254,84,71,195,161,1,
+    94,159,65,202,7,240,127,147,92,143,131,121,44,145,120,142,172,230,140,134,247,149,203,88,161,232,189,100,214,4,209,154,
+    39,161,200,244,186,237,250,189,95,17,201,3,90,67,120,130,210,77,42,19,41,88,114,142,77,38,175,29,125,89,177,249,
+    86,90,28,85,105,141,181,237,68,99,113,58,73,53,129,173,16,120,23,156,238,45,135,68,104,172,59,158,86,12,180,217,
+    111,212,249,254,236,152,139,33,5,250,235,24,187,131,74,74,76,139,188,64,169,109,223,65,221,67,96,118,94,19,200,90,
+    240,252,28,250,66,246,209,181,238,207,179,251,133,77,56,222,74,60,81,47,0,242,50,210,11,63,87,12,247,90,52,193,
+    31,30,151,156,165,228,80,153,149,125,12,231,191,74,74,255,147,111,21,233,249,171,4,206,58,91,244,96,247,193,214,237,
+    152,55,194,156,57,153,0,194,154,15,83,144,230,204,35,141,151,4,99,74,150,198,23,63,171,212,97,134,244,253,167,252,
+    104,210,229,150,52,219,221,248,107,12,82,19,51,80,248,180,105,197,64,194,226,134,10,201,109,180,192,227,244,76,90,130,
+    82,88,119,187,102,251,143,63,13,152,252,141,0,159,29,246,113,27,252,152,0,2,224,10,123,187,176,219,150,42,150,217,
+    98,162,190,153,181,241,89,141,63,85,77,161,89,188,103,106,88,200,66,187,68,145,202,117,183,206,66,178,53,255,173,45,
+    30,215,76,27,66,161,247,106,123,216,111,103,249,252,249,86,80,189,201,149,227,222,116,85,141,172,212,247,10,96,134,125,
+    151,168,128,192,11,225,62,10,61,142,71,4,133,223,120,87,50,134,39,169,210,255,174,76,163,195,203,34,117,237,127,77,
+    49,158,171,125,178,112,100,92,49,237,71,126,16,134,227,192,56,228,69,184,157,16,47,224,254,108,111,66,141,225,150,180,
+    64,147,152,8,128,153,115,6,95,99,149,168,108,184,206,9,236,100,89,56,155,119,157,34,229,102,16,14,4,165,60,208,
+    167,22,17,108,146,7,209,214,218,238,239,115,248,32,178,101,66,42,73,106,86,149,142,75,208,231,44,59,85,194,169,27,
+    70,126,7,114,205,114,230,248,115,156,55,40,251,43,50,70,53,212,81,149,156,202,125,64,226,88,103,163,46,124,51,93,
+    212,51,116,164,9,207,142,188,115,48,200,217,45,217,189,186,77,148,235,35,205,90,74,224,20,134,7,160,88,37,40,247,
+    194,141,162,77,78,42,189,50,109,65,71,224,253,192,163,134,111,81,128,99,171,4,250,53,138,86,65,66,214,72,13,91,
+    127,81,95,149,159,208,100,253,119,210,188,110,172,242,41,135,12,59,50,110,182,3,233,243,49,214,32,125,17,215,192,113,
+    0,13,36,148,24,166,221,140,7,30,96,107,51,158,51,202,212,116,81,136,178,96,73,55,65,68,112,107,143,8,89,56,
+    71,155,205,149,27,42,164,112,161,156,68,93,169,48,246,145,187,23,11,237,144,194,19,60,191,4,255,235,255,82,171,144,
+    173,22,217,204,76,130,108,5,137,244,110,56,232,128,254,215,1,246,99,40,219,105,87,89,81,163,28,58,87,246,94,233,
+    114,23,147,108,85,75,81,128,83,169,206,214,104,7,37,183,88,161,198,134,145,240,37,252,31,151,92,224,13,129,45,255,
+    214,150,55,2,23,87,35,242,102,38,77,196,254,249,154,228,251,183,76,10,2,182,69,193,87,126,161,40,2,36,46,81,
+    190,252,151,156,238,44,184,92,188,235,75,40,55,72,231,10,86,212,71,0,83,10,222,149,176,66,71,196,166,218,231,137,
+    182,87,70,212,196,218,239,176,109,93,177,233,253,45,142,26,123,248,28,7,115,49,124,15,121,137,236,13,75,174,236,70,
+    14,209,68,48,178,156,41,185,6,212,103,66,23,50,214,174,11,180,4,158,61,29,208,10,36,21,254,91,27,223,71,203,
+    17,224,250,74,100,110,151,186,0,231,251,42,212,114,7,96,27,42,59,164,96,235,107,239,30,181,80,208,136,38,23,148,
+    246,143,51,79,132,168,21,3,251,227,122,203,252,128,189,86,19,224,133,110,144,82,76,207,13,250,165,93,179,79,40,5,
+    78,114,190,82,147,143,161,11,10,20,115,60,117,106,235,232,194,58,122,84,187,119,239,158,135,89,96,76,244,145,133,240,
+    24,250,248,98,126,143,161,91,6,178,208,173,17,141,218,73,3,112,62,102,27,196,172,217,23,8,58,67,183,245,246,172,
+    27,11,241,16,163,22,183,175,168,85,34,10,219,212,182,190,164,95,204,186,199,254,101,57,154,171,21,8,89,240,88,106,
+    232,213,78,214,3,79,88,245,91,132,143,106,37,36,251,53,196,228,184,202,214,125,95,44,36,37,4,37,126,76,18,185,
+    33,88,245,27,80,237,215,136,57,130,110,234,191,163,115,96,79,128,115,226,215,75,0,242,134,219,44,1,54,73,208,67,
+    195,39,254,140,216,51,115,233,174,45,39,132,67,80,139,24,19,105,57,143,223,79,217,169,204,36,196,58,83,72,135,229,
+    120,175,184,255,159,145,183,232,117,169,165,45,250,102,233,250,52,164,248,74,46,148,126,246,249,43,255,90,59,192,37,64,
+    236,190,19,193,2,67,59,49,4,6,170,254,122,10,95,1,236,218,86,21,74,82,240,79,200,136,160,99,188,223,80,136,
+    223,28,29,1,233,172,26,139,80,105,73,186,167,105,127,136,197,185,226,190,20,119,78,112,240,191,87,105,30,193,246,168,
+    64,172,80,114,42,91,231,162,168,115,116,146,160,73,45,127,117,37,66,73,147,147,148,112,156,11,160,98,50,155,161,87,
+    231,95,158,58,61,222,211,58,98,1,53,137,217,223,191,237,107,118,205,222,28,111,155,196,234,249,220,209,220,112,138,93,
+    166,108,119,119,210,250,142,84,118,61,55,49,96,68,150,188,116,20,190,36,132,59,100,47,118,213,73,164,231,157,93,1,
+    65,152,53,132,161,233,144,139,154,209,176,135,189,238,40,64,145,116,248,2,54,154,102,240,179,218,39,184,94,116,198,64,
+    86,193,68,7,147,126,81,98,132,19,121,107,82,205,50,145,170,173,192,143,64,195,122,1,142,177,240,86,240,222,63,151,
+    10,14,141,217,2,101,195,89,8,121,73,134,192,239,122,74,49,49,53,116,97,255,139,72,20,41,227,203,146,47,171,12,
+    23,56,186,12,27,15,74,85,199,238,165,103,26,43,214,120,194,255,161,148,184,116,41,127,18,159,178,221,64,118,159,54,
+    31,155,221,176,242,3,168,73,173,159,209,171,99,53,118,32,11,155,64,225,48,141,10,232,172,125,241,170,0,2,165,8,
+    58,125,6,107,225,4,181,49,155,7,115,67,154,141,61,132,79,32,89,111,226,219,58,140,231,248,39,111,149,4,188,253,
+    66,111,52,63,142,41,180,252,59,221,172,224,15,243,85,117,191,159,174,15,122,52,135,115,242,57,187,223,17,250,193,185,
+    253,62,180,28,54,58,205,229,103,53,234,121,158,96,59,34,27,140,239,227,61,56,26,35,70,80,166,85,172,36,61,153,
+    179,222,122,56,190,51,186,149,5,19,92,230,10,195,253,223,13,28,222,98,23,58,195,147,143,70,21,83,223,32,230,168,
+    254,230,27,144,136,24,143,138,218,231,43,75,183,41,168,57,249,49,123,96,130,98,38,51,161,128,52,70,129,15,206,234,
+    163,112,58,122,93,73,136,200,188,224,230,206,194,61,228,201,187,254,237,221,188,10,228,162,13,141,79,92,155,7,145,227,
+    65,137,76,181,61,29,105,227,171,121,87,82,244,7,61,225,172,2,15,106,167,186,2,233,4,109,239,230,91,79,82,232,
+    129,43,219,13,250,196,88,202,22,60,112,41,251,155,198,87,72,224,178,244,225,130,21,234,194,191,224,80,246,185,45,244,
+    130,168,198,161,237,107,192,7,165,171,209,208,134,47,90,13,92,174,198,237,114,242,248,229,151,172,219,173,187,245,164,227,
+    28,173,231,237,254,92,33,153,89,103,243,49,135,113,172,123,97,40,35,96,135,221,51,222,107,174,2,252,149,20,46,78,
+    129,212,151,93,148,89,17,158,159,95,94,254,117,183,83,48,210,145,14,244,98,123,218,134,244,146,233,194,162,158,62,147,
+    97,189,161,75,197,104,187,35,129,185,172,229,8,110,185,135,147,185,94,14,30,181,7,87,182,231,19,29,17,14,226,76,
+    9,197,219,51,176,215,40,29,9,162,110,135,26,183,189,229,13,191,4,92,108,218,110,7,33,162,39,157,48,105,240,225,
+    54,160,167,95,236,153,31,106,18,170,180,132,246,119,24,121,30,104,33,124,194,121,106,144,155,125,0,239,227,112,99,150,
+    1,115,39,73,174,56,18,227,146,231,232,86,7,116,62,206,153,233,105,197,249,31,77,219,15,80,136,119,139,112,74,213,
+    92,115,203,252,169,169,174,8,9,51,108,236,165,90,110,252,13,56,31,197,107,144,150,109,171,38,119,146,244,245,141,11,
+    176,94,112,154,21,51,227,90,25,212,34,87,245,51,58,76,83,55,43,178,242,87,18,107,70,195,130,37,52,125,205,198,
+    13,9,192,36,14,47,69,204,229,195,53,217,197,36,39,130,237,201,7,48,200,84,8,178,237,71,7,9,73,239,240,182,
+    229,72,50,143,27,106,42,236,234,78,166,36,25,208,186,190,128,195,143,149,27,108,184,88,213,231,43,236,230,67,174,68,
+    37,85,1,50,97,171,222,134,129,2,111,31,234,206,185,41,151,216,199,59,38,81,0,56,161,214,104,63,152,134,7,236,
+    128,161,137,117,191,60,112,252,139,215,58,137,71,120,97,216,225,6,225,82,42,140,15,23,200,83,201,250,46,206,85,120,
+    18,78,252,82,142,177,163,121,248,173,172,53,76,142,116,51,250,60,234,117,51,171,169,79,17,81,138,170,44,29,40,70,
+    230,176,20,5,7,33,243,64,212,237,170,9,78,37,106,153,149,158,38,238,3,131,62,93,150,141,8,225,128,43,63,75,
+    205,30,29,203,155,199,241,58,76,86,79,15,175,230,43,81,227,185,226,114,69,221,119,251,67,57,203,82,89,50,69,241,
+    146,69,161,236,170,204,93,49,154,78,121,80,198,104,86,62,122,44,235,143,219,151,203,82,252,25,160,116,70,129,153,116,
+    79,31,186,24,69,253,144,188,75,77,33,88,1,133,86,45,235,82,172,107,47,174,186,201,167,43,178,249,32,239,232,251,
+    54,238,40,64,31,38,130,106,12,143,42,53,41,231,158,176,122,146,129,45,63,227,19,30,119,154,52,74,1,86,215,176,
+    75,144,252,8,250,174,151,129,130,18,38,175,78,176,133,224,163,168,233,221,162,214,117,212,217,147,181,152,161,139,168,156,
+    172,44,38,126,173,34,205,10,142,30,125,121,244,167,98,0,168,135,108,127,99,239,51,242,152,169,31,208,100,162,43,92,
+    11,51,27,22,46,250,168,105,33,167,2,17,88,233,54,162,36,111,207,50,90,73,14,173,170,202,70,180,142,198,251,182,
+    181,211,232,175,10,48,164,237,94,44,129,148,92,145,177,81,160,143,146,69,162,111,242,8,62,235,165,15,116,50,176,68,
+    130,74,110,116,72,210,24,182,164,245,103,129,248,94,193,176,0,241,190,75,69,154,4,96,152,28,189,89,94,171,14,110,
+    142,120,116,142,246,220,16,56,63,105,133,14,19,0,175,244,177,234,33,123,149,44,55,136,106,153,86,126,143,25,59,105,
+    166,152,177,48,150,213,10,241,244,98,155,113,117,69,63,202,164,101,157,155,140,245,215,94,185,130,147,222,74,117,62,154,
+    10,109,77,27,36,61,143,146,8,127,204,97,140,137,15,115,73,90,206,114,128,142,192,35,80,67,106,63,26,205,193,22,
+    185,214,158,80,194,0,249,69,157,213,32,247,245,152,213,213,40,50,214,126,212,16,193,129,61,49,43,89,1,216,215,75,
+    54,231,73,139,217,91,30,21,8,96,65,76,0,154,221,35,255,170,95,44,184,89,41,6,7,163,111,190,67,187,134,201,
+    85,179,98,123,217,3,210,205,70,214,241,23,46,144,173,5,8,157,83,223,0,81,8,14,69,198,126,6,191,112,247,243,
+    68,220,72,118,39,53,132,125,199,194,234,237,160,144,209,32,104,99,13,174,66,154,219,23,43,79,110,211,205,148,38,20,
+    41,92,119,10,205,6,176,70,64,0,150,154,46,159,35,204,52,1,42,151,205,87,52,139,138,243,229,153,145,50,61,252,
+    88,190,202,104,84,219,48,6,195,31,194,213,185,114,203,201,200,255,14,10,250,127,171,224,254,143,219,106,117,100,247,226,
+    209,119,162,57,178,163,209,124,221,171,60,189,188,220,106,55,90,117,137,136,218,221,39,189,66,5,18,241,147,199,130,178,
+    139,57,204,145,194,234,96,222,241,209,147,241,44,121,77,171,58,216,8,55,198,166,74,187,207,239,229,208,159,25,66,149,
+    228,24,176,76,24,167,61,118,66,105,99,214,6,118,142,87,208,200,125,225,144,38,81,84,2,194,239,19,44,109,23,79,
+    7,207,222,34,81,212,41,95,51,19,86,153,21,62,52,170,151,34,178,34,87,113,31,51,214,205,37,95,96,78,236,154,
+    85,161,17,95,178,128,199,125,50,98,14,135,120,181,242,244,5,208,56,113,168,172,34,30,66,136,4,33,122,216,161,130,
+    156,109,48,64,187,47,158,81,105,226,39,34,20,102,132,233,147,98,209,213,58,38,71,81,135,83,114,205,120,197,233,34,
+    254,22,19,166,113,178,85,12,172,55,180,194,189,164,199,93,160,227,7,206,8,245,112,79,150,233,227,108,186,245,57,35,
+    16,206,119,92,252,91,166,93,21,218,12,192,18,186,147,114,129,60,65,174,45,132,1,198,11,166,37,79,130,104,233,195,
+    12,25,142,56,3,66,66,104,176,46,152,142,132,29,40,251,253,138,193,225,143,188,214,197,252,177,15,254,106,161,33,104,
+    48,179,73,205,123,179,171,200,239,66,187,37,155,18,139,228,214,105,223,207,94,35,237,205,218,138,192,199,109,190,92,214,
+    47,95,30,177,170,102,132,185,141,15,17,173,39,56,143,181,103,63,49,184,116,187,131,224,180,214,237,34,141,158,40,162,
+    255,217,130,176,186,144,13,105,253,244,158,238,66,47,155,219,216,165,252,132,126,163,104,171,60,18,197,236,147,151,209,100,
+    205,67,248,65,237,241,181,49,250,191,148,122,67,243,115,35,249,125,46,156,58,1,105,43,76,83,4,250,54,143,154,68,
+    88,85,9,172,55,19,108,149,211,254,34,33,106,210,104,132,11,11,6,97,37,205,115,121,11,199,21,187,52,63,124,76,
+    153,94,14,35,176,194,99,48,111,104,2,186,47,198,165,163,72,49,252,125,150,178,0,91,149,223,251,250,120,55,21,117,
+    232,203,205,220,65,252,219,213,222,122,207,29,178,41,148,60,206,32,35,109,130,153,106,112,198,96,57,104,209,5,225,200,
+    95,30,174,24,113,234,30,250,65,71,54,253,117,130,77,16,97,242,189,189,35,211,151,251,237,243,65,148,13,219,152,12,
+    182,153,179,60,48,231,10,231,168,110,136,107,1,196,17,124,238,62,72,105,78,158,68,156,182,109,53,143,68,31,157,133,
+    230,6,164,86,171,137,145,32,187,135,107,66,55,209,135,3,201,181,247,70,251,194,145,191,203,144,253,128,110,124,162,239,
+    79,54,163,77,45,36,69,168,122,250,237,163,87,79,74,233,160,136,236,103,22,163,251,99,156,179,231,46,100,34,202,253,
+    8,175,241,45,36,134,80,227,135,213,204,35,212,251,56,226,111,123,95,87,100,250,154,87,179,16,95,186,110,76,249,87,
+    249,249,232,101,66,126,84,185,165,254,160,117,200,6,40,78,69,184,118,170,101,210,36,10,172,132,135,162,154,56,71,50,
+    144,197,130,15,156,126,103,205,3,210,121,142,52,89,78,49,95,252,105,245,44,125,34,51,78,105,156,148,172,231,5,222,
+    71,191,130,152,168,213,178,209,99,91,140,22,191,207,214,57,105,223,129,5,200,179,20,100,175,175,157,56,193,219,114,141,
+    214,72,173,58,241,206,30,99,10,115,149,191,14,116,222,95,190,121,144,23,213,177,216,80,104,149,83,207,252,56,134,148,
+    167,21,155,24,75,193,5,186,163,100,23,40,184,203,13,187,84,74,202,65,143,230,137,19,183,83,172,238,13,210,181,36,
+    94,204,142,87,118,230,191,46,200,252,87,194,191,34,10,210,104,231,95,218,87,255,198,154,207,217,46,232,71,42,199,162,
+    125,238,226,82,247,51,221,15,17,99,236,71,247,174,189,87,0,186,171,228,55,25,132,13,4,183,68,87,220,103,191,157,
+    171,227,75,73,49,101,45,205,220,158,35,223,139,67,176,220,10,238,56,3,25,166,238,16,106,147,206,222,147,173,81,9,
+    150,208,119,195,43,32,53,220,207,19,227,34,46,150,239,46,235,120,15,187,190,185,229,96,45,176,188,243,128,172,9,163,
+    84,117,187,227,57,77,33,194,86,100,183,1,91,46,219,196,157,247,37,141,92,158,121,201,140,110,30,29,97,110,75,161,
+    188,112,23,7,124,70,189,11,17,82,43,234,176,1,166,204,204,19,45,41,252,4,244,5,255,159,41,61,74,127,176,5,
+    136,180,183,59,108,127,210,92,216,198,132,150,52,10,202,60,211,199,36,240,254,57,223,62,160,201,196,136,132,4,22,62,
+    218,13,17,224,33,21,99,255,123,212,224,180,145,6,75,246,49,128,231,158,129,6,161,2,236,23,81,26,204,215,222,115,
+    175,109,76,207,161,232,14,8,3,235,121,218,153,159,95,82,29,13,104,63,19,178,55,178,21,5,244,196,84,71,86,78,
+    242,3,171,227,106,82,41,127,249,15,191,51,123,84,9,101,213,17,187,56,128,6,114,55,95,174,182,42,93,234,94,150,
+    123,175,140,109,129,155,250,2,220,28,42,161,149,144,197,106,18,101,144,178,74,183,199,14,14,219,32,230,163,204,83,244,
+    7,89,6,41,102,56,43,244,137,18,51,41,241,105,69,244,146,21,217,205,63,103,182,240,135,157,205,51,31,215,172,151,
+    255,139,224,109,244,31,194,4,244,140,171,18,226,213,5,72,252,228,227,168,16,20,251,78,141,71,122,216,237,174,46,189,
+    153,205,149,45,190,122,175,236,81,194,92,170,13,121,210,177,1,198,163,169,171,118,155,216,152,58,141,124,156,139,102,46,
+    10,128,144,53,131,162,134,168,177,89,133,94,45,40,216,254,118,183,209,229,253,45,29,51,234,143,235,236,226,32,209,107,
+    60,229,187,242,150,96,89,184,175,240,128,138,33,98,139,246,141,248,55,225,85,70,27,13,156,193,4,188,229,21,61,205,
+    194,29,56,230,107,45,163,209,217,101,36,188,152,118,183,236,101,47,224,48,164,203,89,132,81,202,140,29,165,89,249,49,
+    87,216,74,85,112,45,39,23,47,32,232,16,236,149,63,204,8,43,142,53,49,108,106,201,63,237,242,25,148,231,51,58,
+    54,163,172,127,235,98,198,44,48,234,145,99,59,207,173,45,240,249,51,79,175,239,36,50,160,224,15,52,178,50,216,124,
+    175,187,128,185,186,159,65,106,171,181,175,132,11,35,26,123,185,15,167,68,45,214,62,199,247,210,79,200,189,156,84,194,
+    252,0,117,203,11,224,103,151,81,115,28,29,127,116,91,11,31,74,55,77,143,168,32,191,243,18,233,42,59,11,151,37,
+    52,220,252,8,109,48,214,33,142,194,228,222,46,53,92,221,236,195,162,44,63,44,94,17,95,208,129,229,68,180,133,16,
+    198,121,148,63,210,157,121,196,202,254,246,107,91,68,94,251,236,226,50,83,66,79,131,197,78,147,56,233,87,158,75,15,
+    163,81,59,249,55,199,73,153,226,131,156,185,62,104,78,227,51,27,112,196,24,235,125,233,37,29,202,127,30,117,106,150,
+    167,133,17,140,117,156,118,22,161,151,77,255,50,103,145,60,174,68,73,51,55,231,132,91,75,38,152,139,32,56,8,85,
+    46,136,166,92,34,177,127,164,241,118,36,231,88,43,255,114,130,65,50,58,192,45,37,150,136,241,67,84,197,171,180,62,
+    133,255,148,41,170,143,149,82,139,218,144,230,126,204,5,94,91,232,250,232,147,229,247,167,187,121,168,119,146,204,127,175,
+    58,87,166,108,202,164,67,217,172,146,104,121,29,224,12,231,157,172,105,67,27,135,86,141,68,172,128,102,183,179,206,223,
+    24,247,223,193,55,229,39,49,138,234,108,236,22,243,158,120,135,227,180,251,9,249,40,119,128,255,179,230,188,230,51,137,
+    87,242,178,94,81,169,85,156,90,113,163,88,78,115,148,131,136,101,131,236,64,98,205,247,191,215,91,194,3,252,110,162,
+    140,251,71,30,250,187,27,141,152,48,76,3,143,113,98,100,117,79,202,130,28,166,208,86,109,130,134,74,242,81,51,159,
+    235,253,0,248,174,245,225,20,93,67,133,193,216,77,229,187,116,73,194,89,208,219,236,184,153,68,188,235,2,149,201,235,
+    122,64,128,76,123,166,97,229,100,238,190,96,190,81,37,54,138,36,166,181,74,207,248,5,126,255,233,209,110,211,82,86,
+    93,207,236,85,79,140,49,11,76,207,188,224,23,165,222,60,48,204,35,97,49,74,96,223,251,64,38,167,70,10,45,174,
+    203,223,33,168,157,85,205,113,223,217,62,164,45,174,173,99,1,109,76,101,159,182,161,214,70,96,245,210,135,72,6,11,
+    187,202,205,200,70,195,225,237,68,144,227,231,85,200,120,248,173,173,242,11,145,134,163,99,177,226,249,20,73,195,14,63,
+    104,36,110,31,53,28,127,80,100,76,52,130,47,235,12,16,155,105,155,95,9,236,71,174,187,96,205,252,78,71,162,4,
+    95,95,5,28,65,192,174,9,6,82,0,14,15,220,122,13,61,22,68,238,27,9,162,236,130,188,95,55,72,225,172,228,
+    198,12,5,243,35,225,188,71,170,196,141,134,145,229,106,30,193,199,32,226,249,121,143,26,26,30,195,153,145,238,127,11,
+    110,211,157,139,48,23,82,1,234,205,145,173,60,153,165,92,113,199,13,12,63,59,128,87,228,243,224,132,159,39,4,119,
+    158,13,111,3,88,180,32,122,130,251,186,83,75,167,63,184,20,97,122,208,196,151,48,186,25,9,107,214,52,70,85,94,
+    238,182,121,85,136,159,115,44,203,165,173,123,219,88,113,100,58,41,163,108,214,251,14,13,130,201,191,54,5,253,109,11,
+    130,220,101,181,90,102,95,206,152,172,134,246,93,75,74,219,217,129,136,188,92,205,142,240,87,94,220,233,18,217,132,72,
+    63,249,37,41,74,228,39,11,23,90,23,42,7,88,43,170,152,255,9,57,3,243,47,186,103,132,121,224,158,250,44,251,
+    228,57,94,159,24,231,90,205,245,157,56,19,26,182,0,90,224,155,100,15,102,30,188,180,9,190,133,240,100,171,255,91,
+    138,240,9,255,142,49,79,239,86,89,0,6,144,212,194,42,242,91,173,111,249,62,217,182,1,54,142,109,196,136,210,5,
+    62,220,145,241,107,70,86,72,218,80,196,233,43,125,153,84,109,37,27,249,222,2,93,102,129,149,237,152,173,131,192,206,
+    233,160,132,156,184,141,226,179,34,242,167,35,114,240,59,6,47,252,153,94,111,19,131,148,209,180,9,160,247,8,229,201,
+    194,178,30,25,153,55,124,209,106,178,7,20,1,50,163,134,36,114,173,133,70,209,170,128,57,111,187,192,9,104,52,192,
+    32,37,179,4,89,242,110,151,165,102,185,20,199,161,220,23,37,246,89,86,213,120,56,53,255,248,0,74,238,207,68,118,
+    32,236,163,100,111,132,83,109,89,152,253,13,100,229,74,47,229,254,48,184,218,215,42,127,164,136,90,180,188,53,102,40,
+    13,107,179,85,210,108,253,33,20,105,68,93,6,170,159,39,16,119,73,73,4,54,181,132,121,211,246,170,59,38,118,29,
+    153,208,252,177,10,69,13,87,143,215,14,119,11,103,143,30,67,252,38,155,151,131,9,14,98,201,107,151,51,93,238,161,
+    97,220,0,45,171,23,227,41,227,23,236,223,115,205,90,5,156,197,232,194,128,11,251,208,82,40,90,191,53,69,98,12,
+    218,125,90,123,90,102,145,58,50,129,246,33,106,209,154,249,126,120,240,234,28,199,213,251,121,79,42,90,105,117,143,15,
+    124,92,13,106,110,202,175,155,88,28,70,151,71,137,5,157,28,25,109,22,77,4,27,197,23,22,165,151,120,153,151,206,
+    107,7,27,79,100,129,46,52,87,230,147,69,233,44,114,176,158,88,143,101,245,220,243,42,11,230,210,118,249,190,57,13,
+    229,88,206,166,99,198,27,115,59,127,88,75,188,198,109,11,61,106,232,13,197,255,255,149,229,170,73,147,55,150,129,163,
+    121,69,148,237,176,189,188,50,96,95,175,215,218,64,244,73,53,203,245,243,133,59,118,175,95,152,231,136,152,182,123,166,
+    169,90,30,196,178,139,230,143,44,165,21,215,186,18,165,141,8,65,110,82,107,158,164,233,167,211,245,192,44,53,132,218,
+    252,233,211,218,94,39,125,135,235,215,122,65,74,15,228,193,226,83,106,216,46,18,152,104,189,103,196,52,228,225,83,146,
+    1,226,202,243,31,8,79,33,139,114,204,97,5,59,208,70,167,244,148,169,86,149,130,159,13,222,111,93,241,253,62,7,
+    141,52,198,68,129,246,139,86,73,156,65,139,230,47,34,204,93,11,67,65,207,141,91,252,53,65,128,89,182,45,222,90,
+    15,90,1,219,123,151,73,190,202,206,120,134,214,75,220,177,199,193,160,19,218,209,226,181,45,255,97,44,45,149,216,23,
+    208,0,157,71,180,43,234,26,26,82,37,70,91,213,153,236,92,236,95,178,115,247,213,68,204,92,69,183,7,140,169,42,
+    192,220,72,72,134,138,85,93,108,206,232,206,36,123,217,85,182,232,229,212,110,0,137,96,12,185,14,134,212,38,23,253,
+    199,215,12,68,79,187,43,222,147,81,72,167,140,138,76,61,68,105,239,223,35,203,74,96,141,161,55,227,34,152,130,31,
+    196,28,47,229,136,93,149,128,93,247,248,236,165,203,6,186,76,146,9,25,166,72,220,99,178,241,20,200,61,74,216,128,
+    173,123,208,153,53,38,164,116,68,77,39,133,32,228,165,84,248,231,199,56,0,106,208,104,250,243,57,255,246,114,2,153,
+    174,80,55,60,215,108,47,151,83,86,109,14,83,39,7,69,65,18,215,44,229,40,112,203,70,14,189,41,124,96,68,194,
+    197,34,43,44,233,80,84,68,27,204,21,243,147,120,71,18,31,220,5,47,229,251,100,232,160,27,169,238,253,7,225,26,
+    162,8,167,153,190,134,197,189,137,195,186,75,150,161,6,104,124,204,26,212,248,180,108,105,34,180,224,204,35,21,206,8,
+    122,196,168,225,131,13,176,182,116,170,189,231,190,224,188,117,159,165,163,91,19,37,62,234,236,167,147,86,47,96,213,127,
+    199,170,115,152,222,233,119,51,126,175,29,25,24,188,109,136,56,226,231,243,223,144,100,61,17,193,220,159,14,73,229,194,
+    9,223,101,159,86,233,9,87,156,220,137,239,1,127,228,40,189,236,131,138,8,36,75,244,149,65,222,251,1,34,149,62,
+    13,37,121,60,1,102,75,78,5,42,27,229,10,250,195,57,140,254,102,237,139,1,101,95,247,132,77,156,134,29,10,92,
+    88,172,103,54,28,159,29,179,235,51,102,243,211,164,90,153,250,248,190,107,206,112,229,177,24,80,30,252,82,255,77,80,
+    61,251,26,83,67,33,130,129,117,88,44,33,72,142,49,179,190,111,240,239,220,190,234,229,242,101,234,226,226,25,253,179,
+    253,83,216,61,98,57,173,51,43,223,194,227,152,142,143,57,143,156,29,226,145,29,92,195,249,81,226,253,53,139,153,202,
+    215,202,232,138,91,25,220,90,237,80,154,79,215,118,57,236,97,250,156,244,166,105,22,140,99,103,8,193,91,218,16,152,
+    247,179,44,53,4,123,128,225,105,104,36,173,82,223,166,139,99,99,173,144,238,136,28,206,184,117,1,219,226,204,75,132,
+    21,56,186,1,70,24,171,146,42,46,117,140,182,201,242,1,25,15,58,80,164,18,121,162,20,139,11,252,240,252,155,116,
+    78,178,9,143,17,231,218,101,90,179,255,198,3,230,71,39,174,13,44,111,208,77,158,218,172,227,144,232,44,25,157,58,
+    7,111,68,176,211,60,67,237,66,140,154,181,50,33,253,245,34,228,255,18,189,255,60,28,145,88,129,188,141,40,123,220,
+    21,215,123,208,54,163,200,208,122,239,5,194,1,251,32,88,120,254,113,96,37,146,33,110,94,222,111,82,213,69,28,162,
+    1,223,171,53,169,183,157,247,188,38,24,254,123,85,96,143,94,33,31,235,57,199,135,140,123,243,15,233,73,168,26,52,
+    125,224,16,75,71,77,253,253,222,135,112,63,254,114,246,61,122,96,47,151,239,76,204,247,243,128,33,95,168,215,167,92,
+    236,17,71,96,111,71,84,156,23,43,38,151,128,105,235,158,85,16,137,177,120,52,130,148,140,26,177,152,242,49,184,57,
+    62,75,147,181,135,102,30,182,58,92,159,142,162,230,17,71,235,182,116,42,175,157,101,206,219,142,242,119,0,248,44,146,
+    219,123,151,75,160,236,207,57,77,232,62,216,222,230,105,24,242,95,37,88,223,197,78,17,244,76,73,193,63,238,77,69,
+    118,67,202,14,169,157,212,50,98,68,151,253,113,119,98,69,145,199,161,91,199,110,51,25,226,198,96,171,204,225,123,71,
+    250,79,125,78,38,4,57,28,186,75,105,73,184,220,191,133,184,89,255,14,58,250,162,142,35,21,105,218,213,176,95,133,
+    46,148,123,13,235,41,204,141,200,229,104,67,72,43,131,85,9,109,28,38,243,1,103,213,3,116,111,202,94,27,199,222,
+    24,255,250,240,142,250,71,229,130,124,205,115,148,27,65,249,0,214,144,32,16,230,143,252,168,250,119,249,31,233,19,103,
+    104,89,36,204,232,177,25,160,108,73,49,24,220,1,26,107,127,37,200,100,241,61,47,14,239,191,48,8,122,35,43,23,
+    238,174,32,218,253,168,63,150,6,72,164,50,220,249,20,155,165,205,196,103,54,179,137,131,6,193,171,210,115,28,90,135,
+    184,8,128,158,219,67,58,148,88,253,155,72,192,101,24,40,33,91,49,151,222,80,167,32,202,154,64,47,135,209,162,38,
+    195,151,88,156,252,185,128,146,29,129,30,155,131,247,25,171,41,3,182,86,243,218,26,53,239,0,65,91,202,29,179,238,
+    60,238,75,65,77,249,247,232,217,207,229,24,50,152,1,57,74,102,135,71,233,75,133,0,62,168,39,122,229,57,71,178,
+    12,150,61,161,154,67,20,148,106,120,170,169,100,113,150,177,167,122,212,26,121,145,142,197,160,21,209,128,151,4,122,195,
+    187,160,192,188,232,176,122,10,135,190,157,165,228,174,57,234,85,240,131,123,50,225,34,109,254,233,214,52,74,211,113,13,
+    226,244,125,82,233,137,113,45,3,160,123,214,198,175,21,75,81,22,17,219,121,48,235,2,11,30,89,48,200,251,117,47,
+    210,14,104,214,238,240,208,138,196,11,120,14,250,232,231,135,110,16,74,230,212,214,96,136,140,181,83,233,160,114,192,240,
+    93,193,162,40,194,237,139,46,253,13,82,39,195,112,103,115,241,232,34,221,112,236,248,93,245,241,239,221,138,11,24,76,
+    44,193,167,210,198,201,250,79,107,36,0,210,138,93,134,9,133,222,169,182,26,142,146,36,167,189,130,89,211,138,182,104,
+    141,164,172,187,175,224,205,106,16,150,6,21,19,11,238,178,26,157,193,78,25,102,86,17,33,255,203,206,9,105,9,153,
+    1,1,195,208,23,98,5,216,72,255,126,145,176,31,74,37,187,152,185,168,34,118,133,51,69,31,193,29,35,20,53,93,
+    84,24,150,241,219,168,206,118,233,54,6,150,224,76,46,112,233,158,106,220,131,146,148,211,242,153,119,0,214,80,49,223,
+    226,156,27,12,252,96,156,100,89,185,63,215,55,135,230,151,254,107,49,229,99,33,213,97,88,227,16,76,88,187,25,96,
+    198,234,59,253,103,157,101,21,191,125,13,199,185,80,46,224,161,126,241,164,182,213,79,247,31,111,64,119,248,21,140,178,
+    208,89,37,69,29,23,119,130,51,219,42,90,94,126,1,247,92,149,42,75,197,58,128,86,20,216,151,163,73,41,230,59,
+    253,241,251,242,56,42,246,164,4,220,251,138,200,105,250,86,111,246,184,241,187,182,244,90,87,4,60,227,95,141,128,128,
+    229,176,245,38,82,140,172,138,49,40,243,231,228,28,28,238,100,109,208,192,89,148,241,203,51,231,193,20,73,151,202,81,
+    34,225,17,208,152,17,9,149,91,115,96,85,173,3,255,58,199,126,27,41,183,16,195,107,192,42,10,133,27,98,28,33,
+    198,177,17,136,62,111,180,220,90,242,199,197,233,9,13,214,163,139,52,177,251,208,23,241,196,225,129,51,34,146,107,100,
+    216,253,134,186,188,154,182,233,119,94,214,90,60,163,176,246,154,202,211,147,52,190,214,91,63,150,245,226,131,180,177,105,
+    129,119,110,63,50,60,51,100,141,66,178,71,23,63,199,175,169,230,233,7,54,154,166,2,125,230,224,31,57,216,62,62,
+    127,238,185,49,46,219,243,170,178,47,211,127,145,226,77,12,217,10,76,109,65,246,132,21,224,156,15,46,198,108,230,16,
+    125,63,30,87,83,100,3,60,112,12,124,33,6,57,221,141,1,135,198,233,191,12,185,83,250,137,223,53,217,215,29,241,
+    19,178,34,22,108,234,21,48,179,99,34,3,237,250,146,225,232,208,245,125,139,240,32,157,53,40,234,164,132,81,88,38,
+    39,53,11,102,11,96,25,74,111,159,13,121,157,85,4,187,175,139,110,241,28,193,18,115,1,224,236,124,197,201,119,229,
+    220,135,63,195,202,8,237,178,70,230,63,138,34,60,97,77,162,73,56,77,49,253,81,48,27,190,38,147,167,137,94,62,
+    2,221,152,57,151,35,60,211,168,113,190,132,44,229,149,214,162,123,102,11,48,221,107,136,68,178,122,116,163,254,237,130,
+    233,193,109,147,54,13,106,31,150,98,114,160,149,254,23,161,159,87,233,126,175,206,180,168,168,191,239,176,243,12,52,131,
+    45,30,228,179,200,108,107,220,36,153,232,163,61,7,238,9,11,124,254,209,84,3,119,221,153,126,248,192,87,136,151,144,
+    29,230,166,30,104,188,1,62,88,218,200,99,125,173,155,225,83,211,186,194,2,52,106,223,157,19,46,86,238,227,126,98,
+    79,10,52,82,126,145,134,99,162,46,134,218,202,238,38,175,95,199,199,167,199,243,84,10,188,146,54,13,137,169,197,153,
+    50,73,224,229,146,162,46,155,11,66,198,124,226,138,54,100,176,244,167,43,201,45,169,66,187,252,186,166,138,140,190,73,
+    171,13,141,237,125,80,18,154,196,149,206,237,94,162,181,136,108,184,45,155,87,199,61,69,110,164,208,231,144,255,95,39,
+    189,148,87,32,54,189,18,29,230,243,196,139,211,61,148,75,195,51,177,249,113,33,236,219,206,58,199,56,214,196,33,45,
+    8,68,41,228,240,187,97,41,32,235,62,59,55,196,159,31,169,148,156,146,41,125,206,5,5,163,113,130,91,124,205,139,
+    8,230,105,138,102,54,208,58,14,254,164,98,84,234,38,101,70,236,161,43,148,75,83,223,217,180,162,97,235,54,126,209,
+    16,31,196,167,9,254,26,213,226,19,104,150,234,238,16,224,83,225,109,133,46,4,40,96,29,180,200,230,77,108,174,126,
+    5,177,107,140,239,214,237,32,167,215,237,92,251,44,89,234,108,39,13,14,133,13,234,77,107,61,164,244,193,131,3,0,
+    233,224,91,214,232,212,83,39,75,194,32,157,228,155,107,5,44,210,78,210,187,137,205,11,111,0,124,253,229,4,141,244,
+    225,209,18,36,225,158,34,141,174,124,208,155,69,135,158,112,38,157,146,153,153,213,251,87,247,225,4,222,108,28,151,52,
+    34,205,188,10,13,189,131,92,251,225,30,5,8,9,41,73,110,52,34,118,20,219,198,153,142,208,176,108,135,192,201,61,
+    237,60,155,143,64,234,182,254,233,53,218,71,195,29,204,129,4,206,140,130,198,113,79,140,216,220,8,65,134,207,73,152,
+    215,32,31,206,147,217,93,218,202,56,216,136,39,58,21,57,62,253,12,24,177,113,195,12,166,29,165,164,199,161,187,82,
+    9,53,147,231,71,64,92,189,9,251,28,72,247,67,41,18,164,76,31,23,112,147,72,108,184,87,45,64,58,83,220,100,
+    179,93,24,25,33,100,173,187,253,123,63,26,185,130,150,97,84,10,21,206,110,144,53,65,199,25,143,190,128,47,74,64,
+    193,225,154,69,132,191,159,251,180,121,20,195,179,237,41,241,70,104,236,117,235,20,130,191,229,74,76,102,168,227,89,53,
+    223,51,50,46,76,138,113,98,180,194,62,158,9,52,135,132,80,123,167,225,67,143,24,187,163,50,228,64,79,108,121,188,
+    14,41,132,166,13,67,134,187,33,220,242,73,3,48,127,168,31,29,169,248,139,60,54,170,39,6,160,219,88,242,57,165,
+    50,3,198,84,229,33,239,122,59,227,110,76,240,217,211,221,161,9,146,236,206,56,245,208,188,109,151,251,213,13,60,255,
+    83,69,14,12,136,31,27,159,80,92,205,79,244,246,108,181,61,111,68,103,254,115,216,208,7,220,196,14,3,90,112,32,
+    110,142,158,106,247,121,20,215,197,165,132,59,247,59,104,89,142,160,144,61,16,248,158,200,211,164,240,137,38,46,104,70,
+    242,97,253,155,41,87,25,64,208,137,227,50,35,81,122,235,110,64,88,37,203,206,35,203,221,118,80,220,128,63,200,85,
+    35,101,169,127,1,10,53,177,182,113,179,170,16,28,160,188,137,137,158,250,136,167,229,166,77,196,153,107,159,88,153,153,
+    76,208,131,178,111,140,152,73,217,38,223,102,153,109,58,157,233,76,89,109,210,182,61,204,228,141,252,57,157,10,197,91,
+    126,45,218,230,31,232,243,87,60,145,168,71,141,39,215,135,43,210,255,55,159,63,20,6,73,42,51,20,222,68,32,13,
+    247,58,33,31,108,184,30,177,126,197,18,238,231,188,229,48,253,21,20,45,105,222,229,113,122,83,76,68,141,220,112,134,
+    197,76,238,222,25,98,128,179,141,88,171,65,28,177,129,95,112,230,79,197,205,64,147,8,127,227,70,3,77,252,213,45,
+    163,224,234,211,48,221,109,125,165,65,54,84,62,176,139,136,27,217,159,59,175,250,229,118,9,218,142,63,234,79,163,113,
+    166,186,125,0,237,218,165,220,138,166,123,140,133,208,159,146,140,226,124,12,211,2,117,147,68,164,105,84,40,42,232,154,
+    151,115,188,9,185,8,121,78,250,193,29,50,251,82,107,112,252,92,7,229,131,10,16,1,114,121,255,198,50,74,181,11,
+    177,167,69,52,52,3,89,208,56,112,40,230,60,171,248,86,136,124,222,91,100,2,239,92,39,177,221,149,110,102,206,144,
+    40,191,236,19,106,16,252,60,144,78,54,25,97,1,159,238,154,65,63,217,111,120,99,214,158,3,149,65,107,74,22,16,
+    64,5,135,25,212,13,56,24,169,39,217,248,151,152,141,161,191,15,220,236,64,107,173,38,1,165,105,111,131,92,64,78,
+    18,64,193,111,150,136,194,212,34,74,227,242,144,252,179,78,20,244,96,233,248,122,2,1,178,203,202,184,220,32,4,250,
+    133,148,168,170,145,94,49,68,179,149,174,187,130,70,35,78,121,188,211,61,229,137,11,23,41,184,221,39,95,175,245,9,
+    186,87,241,230,56,204,216,168,76,156,120,45,148,208,211,29,236,251,187,146,194,205,73,211,168,50,210,106,97,198,28,39,
+    96,144,229,12,241,13,197,74,233,84,198,109,115,32,98,214,162,116,117,181,101,236,246,24,8,150,87,74,48,149,200,22,
+    17,46,106,96,124,214,196,115,236,135,167,166,64,231,118,23,86,234,184,249,140,144,198,27,223,162,158,182,6,189,9,157,
+    248,115,173,114,157,79,16,99,62,12,198,192,80,83,10,223,4,203,143,224,173,242,6,107,94,103,213,101,217,90,0,13,
+    171,177,113,83,227,208,197,211,122,27,53,176,199,229,223,148,165,14,231,147,151,21,163,148,162,199,70,9,32,15,142,125,
+    67,19,248,176,52,21,73,31,230,209,102,43,145,240,241,234,226,194,33,142,60,220,174,8,110,194,100,65,40,215,91,73,
+    21,221,70,203,36,70,220,66,43,148,91,171,154,115,89,188,189,120,187,120,95,134,199,216,54,37,82,110,21,83,159,63,
+    249,241,148,132,205,137,222,229,226,50,138,216,53,238,20,173,228,155,146,4,51,97,219,180,237,144,151,149,95,1,200,19,
+    87,85,140,3,184,252,14,152,154,73,194,223,196,69,169,163,110,138,234,50,121,35,90,162,191,16,180,9,111,45,84,46,
+    202,192,31,158,60,30,239,63,227,158,147,131,16,56,245,214,43,248,207,91,128,22,167,98,49,44,237,21,82,99,106,4,
+    167,0,35,24,128,94,246,150,196,36,245,102,137,43,181,139,39,84,231,215,121,255,157,85,109,99,43,89,247,55,139,108,
+    216,56,40,25,86,170,47,27,118,123,8,26,83,59,190,77,10,197,63,85,253,45,165,209,195,243,10,66,253,167,104,101,
+    164,127,170,33,99,222,136,237,144,106,241,169,151,184,142,138,159,143,226,112,170,196,8,129,184,198,100,222,167,116,18,103,
+    232,69,76,63,116,25,42,37,163,31,40,144,101,213,123,171,186,125,181,230,67,203,170,212,199,95,236,238,248,108,77,214,
+    200,80,244,228,236,97,250,57,38,91,168,61,202,44,237,54,44,80,32,55,141,123,54,75,18,20,78,150,38,6,118,84,
+    54,237,102,80,41,162,140,207,204,47,46,230,108,197,53,107,201,58,190,24,118,242,19,21,173,215,52,57,9,111,160,99,
+    163,75,183,8,51,41,102,191,85,77,200,85,153,15,220,198,203,79,94,110,182,178,167,35,3,204,228,146,237,106,128,34,
+    110,253,129,177,30,178,220,245,183,240,223,208,55,12,187,221,84,246,203,1,21,175,237,76,250,81,24,29,155,189,18,75,
+    89,75,49,51,40,48,247,225,241,117,52,33,197,66,226,71,247,101,207,241,137,164,42,198,130,59,200,50,206,82,35,172,
+    18,197,206,32,168,61,81,112,74,110,186,194,189,50,172,13,130,132,149,55,187,25,161,145,165,96,73,42,125,132,2,28,
+    225,239,68,53,167,204,22,254,232,92,30,179,109,222,14,67,122,39,71,32,90,48,144,77,163,89,250,240,2,25,58,108,
+    232,86,4,106,199,90,43,58,8,238,168,80,116,221,185,48,52,71,31,103,32,14,82,128,61,35,237,53,153,127,94,49,
+    40,194,213,148,27,57,175,184,183,250,197,77,247,106,168,95,238,21,8,70,101,84,109,136,120,208,229,206,78,87,123,95,
+    155,188,254,229,78,100,133,47,252,5,170,131,100,135,246,158,130,232,140,1,16,36,104,14,199,17,188,217,64,140,206,92,
+    16,198,175,8,220,42,236,170,26,200,57,70,192,5,19,172,75,56,180,6,24,179,161,218,70,48,231,241,26,227,39,209,
+    158,114,98,221,226,84,42,95,110,42,250,132,50,210,250,163,137,45,238,142,199,201,184,162,67,182,140,194,237,250,157,109,
+    240,199,149,118,251,252,67,126,255,203,170,213,240,240,172,61,106,215,65,182,210,237,84,110,224,214,64,173,211,134,147,110,
+    248,203,86,238,253,81,191,120,207,28,39,76,236,125,10,69,221,31,52,230,167,167,86,67,74,221,221,17,209,226,158,218,
+    156,59,111,240,106,138,157,207,146,83,153,171,114,171,89,46,71,222,148,176,111,76,35,45,78,214,197,140,102,234,7,207,
+    76,249,171,22,5,126,186,139,65,246,57,104,141,174,148,156,234,193,61,192,93,158,21,184,36,35,104,164,211,208,80,159,
+    177,201,194,159,146,45,91,74,7,241,114,217,157,139,63,152,241,98,124,192,226,171,136,138,32,94,43,111,78,28,22,21,
+    167,65,116,184,30,88,203,136,89,91,26,197,145,148,204,106,190,155,1,28,251,178,1,107,135,68,250,249,77,189,121,3,
+    207,87,31,42,95,94,81,146,107,180,165,36,85,228,227,22,99,191,118,55,134,56,205,249,169,151,204,104,246,145,172,139,
+    185,76,227,29,110,9,140,16,41,128,221,108,16,253,150,27,167,99,101,101,1,57,234,24,169,100,99,114,121,67,121,43,
+    245,129,83,87,213,246,209,35,139,70,167,100,218,94,20,132,93,179,213,162,215,223,29,136,243,124,199,123,223,182,200,208,
+    45,128,198,177,78,113,122,95,249,130,245,178,65,99,221,78,235,132,205,221,168,166,165,125,237,21,201,176,80,138,89,250,
+    70,40,38,99,201,136,94,246,89,43,252,70,252,22,196,15,182,54,105,219,140,113,133,10,225,201,254,160,154,108,147,244,
+    233,165,97,152,42,109,201,186,148,150,115,77,36,254,136,167,96,169,114,46,179,13,247,9,153,159,126,230,41,231,176,125,
+    20,120,107,89,190,31,219,91,30,112,105,188,3,152,58,134,82,1,75,13,167,243,56,167,125,221,85,118,87,240,226,205,
+    49,50,123,248,128,24,250,233,63,60,220,232,215,155,104,175,75,219,176,125,13,95,222,223,84,196,216,45,141,88,161,219,
+    91,59,192,32,194,127,82,216,236,72,205,196,195,203,37,101,17,168,63,227,65,138,128,236,40,189,185,31,7,123,240,123,
+    220,197,245,55,112,38,100,74,9,248,249,23,190,243,110,64,29,255,98,148,134,126,239,96,24,50,212,183,194,232,202,14,
+    200,197,75,98,21,139,41,40,162,16,250,127,171,33,32,47,204,42,206,213,169,86,45,90,152,53,60,123,115,153,97,29,
+    222,43,59,189,199,149,174,97,22,41,163,66,239,2,180,67,71,13,26,76,165,72,176,74,146,2,81,131,245,37,98,84,
+    29,111,189,248,133,154,175,119,163,189,230,198,150,153,45,226,29,146,241,194,238,172,251,145,208,58,121,0,232,37,3,5,
+    62,245,238,105,109,200,202,56,174,246,219,54,196,93,227,22,51,175,218,37,132,248,30,173,83,186,221,61,129,136,170,245,
+    201,116,179,56,194,175,52,87,201,100,58,237,8,44,86,63,0,90,30,192,92,160,111,224,137,167,1,205,146,135,228,200,
+    8,215,32,121,196,60,251,90,10,82,179,7,188,134,211,249,206,49,22,158,43,241,176,115,164,217,25,139,5,229,2,80,
+    181,76,218,232,52,149,35,89,184,120,177,25,164,64,186,198,127,46,208,126,25,103,222,35,126,142,247,77,84,173,166,238,
+    120,152,174,178,75,96,61,247,171,88,178,191,15,159,202,175,85,230,166,241,92,231,193,103,131,249,30,13,170,160,238,220,
+    129,235,159,192,148,2,235,134,86,200,158,208,132,9,127,123,148,142,201,116,197,219,114,192,221,62,74,117,136,135,218,170,
+    26,206,192,51,114,45,158,114,134,54,167,22,126,148,183,173,151,82,56,156,118,11,57,34,111,238,61,83,68,115,41,55,
+    62,23,93,27,68,17,189,77,231,80,21,173,179,27,159,53,85,21,204,224,64,57,115,75,84,80,0,118,18,224,46,101,
+    226,92,197,59,207,230,62,249,150,86,193,11,77,84,216,251,78,57,214,218,125,116,79,139,252,61,12,103,59,201,122,207,
+    233,18,128,57,27,189,171,162,229,30,128,241,126,178,52,29,193,253,18,148,166,9,178,49,149,176,82,71,94,74,65,104,
+    241,178,245,43,87,83,61,106,154,27,181,137,106,251,3,60,163,0,176,47,175,131,73,63,36,77,175,251,132,112,234,83,
+    180,228,141,230,16,190,238,137,3,198,156,230,28,219,207,24,15,201,51,19,176,6,202,20,14,53,49,215,212,38,86,246,
+    137,114,243,154,216,78,114,171,180,135,28,49,33,218,147,168,133,36,162,131,211,204,113,207,160,202,74,29,184,250,91,128,
+    253,194,188,47,190,96,213,193,242,247,202,9,137,165,125,207,36,249,203,208,189,60,44,236,136,215,219,213,90,41,108,235,
+    234,116,225,184,67,202,142,99,178,141,209,23,171,31,189,107,237,102,223,208,101,227,140,82,153,187,31,16,213,171,211,218,
+    31,164,98,236,253,124,238,202,140,142,123,22,229,67,39,252,117,113,117,211,81,170,35,3,172,241,204,71,245,175,201,122,
+    197,118,83,212,254,42,80,99,3,85,74,210,28,141,178,128,225,206,42,179,19,240,49,176,0,33,126,123,148,75,126,128,
+    235,163,214,76,246,42,117,116,46,195,198,168,240,118,56,228,38,204,189,106,61,125,53,236,194,64,223,50,87,49,201,213,
+    87,138,201,232,208,166,165,31,190,164,119,126,7,160,243,135,193,50,242,113,69,94,9,181,207,98,159,166,87,93,135,57,
+    52,74,178,134,99,67,55,5,127,90,191,243,24,62,79,49,81,191,86,136,31,99,35,255,114,221,91,153,27,7,111,194,
+    185,239,236,250,125,197,111,225,67,121,150,93,195,50,199,208,197,104,244,40,121,5,70,77,152,225,81,51,210,210,183,76,
+    154,246,86,34,213,85,76,76,230,128,88,70,99,2,44,224,85,189,29,187,105,86,99,53,153,177,29,113,224,72,96,85,
+    248,170,174,25,36,184,74,128,208,167,146,184,90,141,99,10,110,163,80,85,95,32,143,204,227,29,235,177,14,122,71,121,
+    183,39,111,74,25,98,223,107,118,105,118,70,157,130,73,96,83,36,67,152,238,6,185,57,117,39,103,197,255,24,125,182,
+    79,65,212,6,36,206,189,24,153,65,195,1,62,11,150,155,38,14,51,109,165,53,3,18,130,9,132,86,185,179,189,116,
+    174,205,121,99,33,114,36,177,168,159,80,183,206,95,110,177,169,235,87,135,208,98,239,9,115,210,73,205,141,101,233,17,
+    127,228,119,229,15,150,172,164,55,56,223,33,24,159,152,193,69,223,182,203,21,113,49,223,225,150,163,22,125,71,171,129,
+    171,77,160,206,197,234,81,123,3,148,166,174,69,205,26,123,198,186,23,127,194,101,58,106,87,151,38,59,8,18,40,99,
+    86,77,135,249,71,89,93,183,91,27,247,250,63,86,166,86,87,107,254,7,43,85,130,95,91,96,99,31,40,206,197,2,
+    217,150,76,115,220,20,138,19,36,161,38,169,31,33,30,33,35,76,35,5,104,124,170,5,150,201,76,29,87,22,145,8,
+    208,114,246,8,250,44,115,31,193,113,167,141,201,240,173,71,85,44,151,83,252,143,43,150,126,34,74,136,124,169,113,89,
+    132,103,243,31,251,93,113,107,81,107,34,70,122,45,166,123,46,247,232,17,136,135,54,254,216,188,122,68,230,174,188,98,
+    183,27,235,112,125,12,94,121,160,252,1,100,214,190,94,48,156,48,125,114,114,53,216,169,230,72,111,19,164,27,110,6,
+    16,35,72,67,190,47,29,211,119,184,248,199,82,10,21,227,12,81,66,131,12,131,151,65,147,186,78,192,135,132,129,200,
+    7,219,45,178,207,68,143,172,144,215,77,128,181,230,181,165,248,92,184,23,203,195,210,98,213,211,195,228,63,13,162,142,
+    138,80,101,152,137,24,149,88,54,85,210,40,13,151,92,93,197,90,137,25,253,78,77,22,61,244,51,59,156,170,220,27,
+    162,85,61,253,187,119,25,230,197,115,126,127,67,31,29,242,130,213,114,100,243,189,116,139,129,37,140,233,186,121,131,57,
+    6,172,149,51,249,43,115,143,208,30,165,227,237,46,122,248,146,59,177,109,189,250,62,66,157,13,73,177,145,172,204,178,
+    186,31,195,38,81,222,222,191,146,244,176,235,86,73,250,182,239,59,89,5,188,114,158,96,235,47,33,8,115,98,65,79,
+    7,19,47,31,112,40,113,54,125,7,198,64,87,194,142,129,245,222,62,26,121,7,56,214,83,234,200,243,15,22,66,213,
+    214,128,104,140,126,82,73,147,145,200,107,209,77,244,222,155,94,56,116,89,250,67,63,83,83,223,112,114,252,251,34,93,
+    8,243,96,122,52,111,52,57,94,178,99,42,84,105,182,20,13,113,218,72,90,245,85,161,191,69,246,207,180,195,83,184,
+    50,179,249,238,144,223,41,229,182,79,174,136,158,92,38,152,176,102,202,224,164,251,176,233,93,48,152,217,228,83,236,50,
+    82,57,15,77,214,79,228,128,15,38,172,134,198,95,245,154,217,40,236,3,22,184,197,160,100,104,255,209,27,57,147,195,
+    119,87,234,56,215,93,43,124,135,145,10,229,215,252,184,206,170,154,135,28,56,204,193,36,188,210,154,30,156,243,46,20,
+    175,232,130,164,137,46,239,61,15,238,223,216,22,186,71,98,232,243,97,173,179,84,62,101,192,105,145,28,16,11,94,245,
+    24,28,182,72,59,51,101,81,154,102,229,0,239,238,17,120,231,217,27,28,122,42,152,119,157,163,5,200,81,83,237,230,
+    158,177,135,16,67,160,241,177,237,158,159,195,178,115,32,99,112,233,196,86,2,141,89,114,96,32,221,98,21,105,73,41,
+    5,236,217,172,151,90,162,121,24,218,221,135,138,137,37,112,14,128,145,160,144,146,183,215,241,41,70,190,76,151,177,133,
+    0,185,38,250,211,160,198,165,33,134,166,100,142,106,191,102,249,104,26,97,201,128,77,88,232,228,166,186,108,140,220,85,
+    176,79,195,130,118,189,234,216,101,64,218,92,91,168,147,17,191,237,234,127,25,158,48,185,232,157,56,64,72,81,15,29,
+    180,22,37,144,226,121,182,17,171,106,90,29,213,181,202,34,100,13,2,39,220,45,226,57,183,228,154,226,118,57,192,124,
+    150,197,176,224,8,209,177,212,108,87,157,79,106,28,78,67,16,86,129,126,33,231,78,13,49,154,149,120,46,182,13,13,
+    160,229,143,113,127,233,64,63,226,144,17,223,229,239,54,121,111,182,14,208,60,108,101,176,7,185,190,117,59,67,107,186,
+    207,162,178,206,207,142,107,93,103,154,164,125,52,166,133,158,156,140,85,64,128,95,137,155,3,135,229,161,153,184,81,240,
+    223,39,237,191,130,103,79,204,205,249,225,172,4,133,159,202,80,102,203,220,36,73,104,255,167,233,14,234,236,64,194,78,
+    149,121,3,47,254,90,152,255,91,38,164,57,139,230,30,168,136,7,56,172,185,255,142,102,205,48,46,169,154,217,185,106,
+    170,221,249,94,233,129,216,119,170,214,249,67,227,252,242,77,168,197,211,19,64,252,118,24,132,61,91,148,172,130,142,8,
+    92,194,117,32,184,132,128,58,220,180,203,35,74,3,153,93,139,109,220,36,29,203,248,173,165,68,172,11,155,171,239,132,
+    140,79,213,7,16,220,30,183,16,147,164,102,198,92,151,186,162,152,222,199,241,143,58,1,231,124,133,5,73,2,124,67,
+    227,9,75,141,204,240,180,70,10,234,146,46,120,189,140,88,215,164,232,219,121,228,43,85,227,161,102,2,62,22,223,228,
+    222,188,85,66,250,209,38,82,250,187,73,234,86,161,242,22,17,165,48,221,145,52,233,243,23,222,235,212,61,23,169,25,
+    15,190,191,130,100,195,191,73,10,172,134,140,59,185,187,111,103,145,59,222,113,210,67,147,127,7,58,16,231,165,22,104,
+    243,93,236,74,33,138,126,87,75,231,50,158,176,249,98,78,212,144,240,26,208,212,166,198,213,94,111,150,121,80,164,98,
+    72,217,57,66,242,85,2,185,175,197,242,8,117,82,239,45,4,171,113,205,50,98,206,255,232,205,113,186,43,168,200,103,
+    13,79,225,207,19,249,56,63,21,81,137,192,48,225,218,208,240,75,87,26,141,220,225,223,38,232,81,141,68,80,18,78,
+    192,40,74,3,141,230,249,185,213,42,184,93,199,171,176,190,99,35,83,90,186,112,124,244,220,219,95,158,116,160,107,109,
+    131,91,111,82,194,181,83,217,242,45,166,98,136,176,12,186,0,242,221,55,233,100,56,134,71,235,142,3,186,254,52,249,
+    171,81,75,93,66,127,111,17,216,50,84,85,116,202,156,253,194,97,157,202,237,107,121,125,145,93,144,4,209,154,143,127,
+    135,58,129,74,47,48,94,57,147,240,151,74,71,23,128,255,24,141,186,238,184,119,21,78,194,154,244,177,145,150,14,241,
+    180,255,167,187,158,204,156,111,56,8,162,60,88,77,223,23,42,8,80,30,76,124,178,221,205,244,35,25,76,7,20,19,
+    134,228,95,2,86,255,10,142,33,2,197,87,105,4,239,23,125,160,202,43,17,55,162,108,85,119,210,36,31,148,177,243,
+    58,131,128,86,82,7,82,216,56,38,109,28,126,32,108,196,56,206,107,132,9,130,12,109,213,192,244,124,185,11,119,37,
+    242,220,123,116,162,221,174,48,12,90,110,54,25,230,96,240,10,84,221,142,207,110,248,106,248,140,22,183,197,18,97,178,
+    238,204,24,171,165,204,188,89,104,215,172,200,175,93,190,149,170,190,174,216,28,42,62,10,196,81,210,212,46,79,226,127,
+    162,135,18,67,42,245,110,115,142,77,226,73,225,46,224,144,136,89,160,76,183,40,90,193,99,122,126,195,160,19,62,113,
+    248,176,254,131,137,89,74,107,31,172,96,130,138,208,45,88,33,144,143,225,98,169,149,73,28,214,157,51,122,71,167,26,
+    86,56,182,59,28,18,159,58,160,230,217,111,167,89,0,119,28,53,130,192,173,68,225,58,234,224,176,140,135,9,89,150,
+    72,105,138,193,43,38,255,141,71,100,182,167,230,96,138,149,208,172,220,40,112,72,5,225,158,234,133,141,252,154,211,131,
+    155,244,192,243,254,241,188,95,254,21,83,144,254,163,115,17,52,225,82,81,175,70,137,170,212,9,160,140,130,118,233,7,
+    40,21,210,72,165,228,220,120,41,4,56,83,122,149,75,69,246,209,71,229,134,129,108,93,99,43,78,251,93,66,108,61,
+    248,122,183,181,222,177,237,211,44,1,26,166,55,201,197,97,248,31,179,189,154,67,222,183,47,31,216,177,203,44,246,157,
+    107,113,37,52,196,67,241,200,90,13,5,128,36,67,63,115,76,13,15,67,34,31,191,182,185,127,168,249,1,80,200,57,
+    31,241,133,113,253,83,105,3,206,10,91,8,20,142,182,38,162,110,7,224,17,41,53,104,121,155,148,167,2,62,184,97,
+    155,157,157,47,29,196,59,138,123,87,184,251,215,70,89,125,25,63,201,71,212,34,197,88,60,243,204,87,47,255,118,220,
+    175,53,211,191,242,52,57,114,197,245,137,189,43,176,69,191,12,220,186,99,153,160,67,215,120,170,81,23,57,22,204,73,
+    200,219,149,24,147,52,200,28,240,140,151,116,216,64,77,33,99,147,62,146,147,175,127,159,61,119,59,86,5,192,156,136,
+    182,191,190,145,91,220,253,139,112,101,10,105,234,61,73,64,204,233,24,105,251,46,125,109,173,229,88,148,203,72,3,106,
+    144,105,255,90,147,17,83,157,224,97,178,175,20,244,201,59,41,97,197,182,85,221,90,168,186,50,145,143,92,73,74,54,
+    40,255,152,52,59,134,39,72,15,224,151,244,93,195,76,17,101,233,164,169,18,173,87,46,111,224,201,121,228,91,233,32,
+    82,196,54,159,249,110,228,83,85,203,60,95,159,102,237,163,134,53,79,88,131,78,36,207,140,59,90,84,6,54,21,195,
+    128,192,219,194,122,106,189,14,106,14,221,211,207,241,186,18,40,108,36,35,243,58,191,24,230,110,132,193,204,192,205,211,
+    47,77,195,57,210,21,194,100,39,65,238,198,219,26,107,156,246,251,91,248,90,66,6,225,200,191,78,246,245,107,84,80,
+    113,187,76,159,94,198,254,166,76,160,236,36,155,176,77,26,185,188,226,192,64,74,25,24,117,186,166,128,115,202,203,196,
+    30,93,54,6,75,38,0,244,94,122,48,23,38,128,94,76,3,193,130,158,211,196,94,108,143,104,74,147,56,111,252,159,
+    138,249,73,128,179,163,144,122,79,154,215,129,224,9,105,189,66,161,233,94,207,219,100,65,166,195,50,132,33,30,2,110,
+    249,239,129,202,224,148,237,62,244,228,61,96,183,27,220,126,1,191,245,21,219,230,57,80,188,67,92,77,208,150,52,4,
+    185,81,251,173,44,8,97,176,239,103,147,44,15,193,208,214,186,62,25,20,67,205,206,150,62,246,67,21,105,107,99,33,
+    4,104,40,122,221,112,238,243,74,246,173,98,132,136,81,251,105,167,210,143,171,114,92,96,128,27,199,242,212,163,129,194,
+    56,200,184,178,137,110,237,212,175,50,221,108,140,50,133,207,80,34,206,177,111,128,210,200,25,235,19,123,149,60,174,1,
+    148,226,201,74,230,245,173,20,57,20,202,14,112,165,24,237,198,112,134,188,177,237,203,130,194,122,134,120,199,173,45,173,
+    150,231,125,221,66,75,223,168,147,117,213,233,63,59,132,175,82,238,157,90,155,61,4,87,87,252,229,182,9,116,48,134,
+    103,253,4,245,31,191,235,24,212,18,169,123,38,152,147,164,192,19,70,21,55,128,35,215,159,226,194,248,102,171,70,82,
+    67,244,137,214,44,165,212,34,60,235,209,46,106,214,82,70,42,133,245,87,120,194,188,253,94,126,137,16,123,151,146,103,
+    7,108,131,154,71,13,13,251,141,80,219,190,35,198,9,232,56,0,203,134,6,210,107,28,238,140,240,102,51,197,72,90,
+    161,184,40,61,30,70,197,132,30,89,38,180,163,103,113,254,243,255,70,254,231,130,15,253,143,212,88,42,224,169,218,189,
+    168,194,201,204,88,42,140,232,98,220,138,210,61,252,35,185,205,81,192,211,14,32,46,111,27,240,215,236,52,74,29,229,
+    195,95,77,186,44,112,173,71,197,151,246,153,90,76,89,172,209,149,90,178,227,125,62,74,108,197,117,13,12,30,249,221,
+    123,62,125,142,176,253,253,241,166,170,228,199,139,125,254,203,2,171,153,3,44,2,190,26,73,67,156,57,46,36,112,0,
+    28,36,133,55,12,37,116,223,98,224,205,103,177,99,224,25,56,233,250,170,57,67,90,157,239,25,58,165,42,124,223,132,
+    198,21,39,174,159,45,245,81,199,4,38,231,156,152,16,194,87,208,167,168,219,128,242,138,168,1,140,69,246,228,216,51,
+    58,237,13,44,184,203,51,51,170,17,2,228,118,50,188,255,118,35,200,159,250,210,189,65,51,36,97,223,75,193,181,54,
+    78,5,118,33,236,60,103,30,243,193,168,4,198,0,213,75,94,237,172,42,120,36,215,134,14,176,194,173,203,133,18,168,
+    255,14,225,34,60,163,127,93,180,65,98,148,194,135,249,58,224,188,121,71,180,131,126,185,231,146,215,117,158,109,160,201,
+    74,8,233,51,138,154,246,220,184,0,29,141,222,181,148,8,117,23,146,98,89,52,158,75,115,0,147,114,31,153,62,212,
+    69,107,224,246,94,65,100,123,98,24,145,117,11,71,111,9,65,155,239,238,101,226,113,1,68,136,209,33,32,40,166,238,
+    247,157,151,191,201,118,85,249,152,246,26,116,219,74,199,97,136,61,148,85,62,7,197,197,203,246,18,104,127,107,153,153,
+    75,244,206,154,148,54,235,157,38,79,76,20,242,106,205,112,38,92,142,174,103,36,66,236,143,145,161,106,13,221,63,140,
+    109,32,155,219,110,221,74,108,201,37,246,66,90,18,78,11,61,83,104,216,66,34,99,45,32,18,93,95,31,37,154,152,
+    204,22,84,75,234,171,20,45,82,20,82,88,132,217,214,43,117,121,132,80,228,217,11,109,245,233,24,48,209,71,123,125,
+    248,224,7,63,176,227,33,184,237,85,239,90,190,86,19,219,213,28,215,141,26,134,82,165,250,29,206,120,116,213,69,60,
+    104,92,47,99,122,81,196,194,45,236,170,178,126,201,81,32,148,239,204,106,5,80,78,200,77,218,65,232,155,34,194,43,
+    58,210,203,229,93,2,118,94,50,221,201,246,246,44,16,13,141,200,236,65,239,196,152,5,215,2,10,121,99,86,23,7,
+    233,253,191,143,250,47,188,235,102,2,179,155,244,182,93,44,172,202,63,255,108,37,186,66,108,211,24,194,164,255,67,29,
+    254,18,207,39,171,116,35,14,59,19,89,108,233,145,2,152,62,1,89,173,69,119,14,40,6,160,157,200,206,26,237,152,
+    215,45,234,53,120,186,222,134,88,164,174,183,234,208,214,63,248,64,239,225,233,153,53,22,55,42,36,60,250,102,180,197,
+    98,189,212,10,71,72,200,127,54,119,130,71,160,102,224,66,176,10,145,157,217,154,158,77,178,29,32,193,162,184,243,216,
+    159,108,203,25,230,160,115,208,133,244,218,73,39,33,9,47,73,148,249,240,218,215,215,152,77,252,128,0,42,141,73,185,
+    213,34,16,225,234,11,80,55,62,201,54,160,230,173,60,8,183,46,110,197,230,30,56,7,20,188,189,36,44,134,125,4,
+    19,162,244,177,39,15,237,114,180,102,141,82,0,168,103,74,162,43,82,25,137,114,119,159,162,91,194,8,114,94,22,75,
+    74,40,175,2,201,98,152,35,70,251,166,121,189,168,138,214,51,198,34,101,197,159,132,103,60,193,243,30,152,120,236,136,
+    170,46,12,2,205,66,184,139,56,3,222,33,198,55,144,87,57,46,20,102,202,223,170,91,17,130,14,142,203,159,75,148,
+    159,139,230,208,160,3,193,169,37,15,216,218,235,82,13,242,79,17,208,153,222,147,93,246,69,102,127,18,167,52,151,115,
+    134,116,211,91,68,59,200,58,72,141,156,16,34,254,65,115,109,85,122,254,49,234,200,19,111,124,115,54,161,66,105,222,
+    80,212,48,181,24,213,108,196,150,64,57,169,22,90,129,133,157,75,223,43,23,192,194,207,56,84,177,67,39,72,135,145,
+    62,64,133,205,44,53,160,56,74,65,254,28,161,222,24,179,56,117,120,146,167,176,94,253,32,131,32,47,122,254,155,229,
+    125,229,51,245,127,181,113,101,215,102,220,174,37,186,86,21,215,111,201,66,17,40,105,248,160,171,209,30,160,37,11,117,
+    166,160,44,46,59,74,22,174,244,70,32,167,250,99,186,125,247,88,114,189,232,228,215,126,2,94,104,190,227,12,140,184,
+    164,203,128,195,83,178,169,73,74,90,100,38,32,24,179,182,193,88,120,42,165,247,76,117,17,253,137,186,61,84,41,222,
+    46,181,4,76,87,53,204,220,114,177,176,224,173,7,18,43,199,251,250,143,8,154,189,217,117,163,245,148,106,44,174,193,
+    135,245,82,78,161,46,168,218,214,38,200,218,128,222,252,218,196,84,234,230,38,89,8,100,54,215,230,32,202,9,57,110,
+    22,47,224,153,33,176,90,138,251,139,82,73,38,131,134,27,233,139,232,165,62,115,93,119,245,5,179,25,36,19,142,235,
+    232,3,43,251,24,126,195,91,255,4,78,206,64,112,107,198,206,12,185,113,179,169,57,136,88,55,9,149,205,142,91,24,
+    251,50,158,145,152,23,99,5,228,164,156,95,118,117,102,159,236,162,28,95,138,198,69,210,233,56,105,20,81,4,141,120,
+    233,226,96,243,138,241,79,34,35,171,25,177,90,197,92,12,65,238,82,62,210,16,250,172,25,180,166,236,171,146,71,0,
+    71,244,227,55,39,64,81,222,177,0,194,177,211,67,106,179,56,5,217,100,167,75,2,59,115,248,46,189,53,99,167,216,
+    104,129,242,53,178,88,22,0,56,119,0,138,75,31,151,178,127,159,119,82,13,130,138,46,196,102,88,142,25,178,138,123,
+    192,11,247,68,204,99,172,205,64,26,137,174,91,2,149,173,126,0,219,236,205,34,25,160,96,228,7,96,59,1,26,59,
+    129,157,8,122,72,136,176,32,233,190,182,57,66,49,165,134,246,196,185,179,139,117,199,255,206,236,145,113,147,135,198,65,
+    210,245,142,127,250,206,2,114,69,167,146,220,99,74,69,59,75,127,134,10,32,254,124,224,6,100,169,118,28,28,59,23,
+    87,86,71,16,200,216,82,243,91,88,151,19,114,232,212,225,206,54,254,171,121,142,114,233,34,84,137,37,99,102,101,49,
+    178,8,169,208,146,206,161,238,214,59,104,136,24,106,24,165,92,22,138,79,59,100,249,251,72,16,130,124,40,166,108,3,
+    90,248,220,12,252,230,53,35,232,38,0,174,78,240,142,68,45,19,31,125,167,189,48,204,15,34,167,114,64,212,201,112,
+    2,39,45,167,186,120,108,73,120,59,60,231,114,87,84,70,156,230,55,109,45,79,201,216,37,108,67,252,23,134,171,47,
+    134,231,78,214,21,36,231,10,13,51,82,6,81,150,238,4,132,204,168,42,206,46,42,121,193,229,15,97,235,230,54,73,
+    241,229,164,43,185,194,33,113,216,254,208,51,169,22,135,188,211,148,214,33,160,132,74,195,114,152,63,222,49,109,135,196,
+    11,105,236,39,231,16,224,158,187,102,245,43,114,225,159,49,0,99,187,211,121,153,252,45,163,56,135,22,124,5,254,2,
+    165,40,228,39,39,66,217,226,251,44,245,150,42,192,168,58,251,0,188,188,65,240,191,199,93,42,52,125,97,19,50,206,
+    33,195,207,4,224,91,109,113,37,204,9,112,174,10,119,59,63,146,10,178,255,167,11,67,62,254,181,92,183,103,93,247,
+    54,150,129,126,192,109,247,84,34,240,175,136,208,109,204,178,39,31,239,253,51,49,146,38,218,88,216,4,102,159,20,40,
+    222,47,10,62,183,112,128,88,76,202,55,233,34,231,52,125,139,59,50,106,45,162,43,77,160,78,171,245,12,83,197,137,
+    173,64,58,72,14,220,251,16,73,97,61,89,8,229,165,6,45,170,208,0,145,82,176,8,172,185,248,181,172,178,172,1,
+    55,176,170,17,201,24,240,36,124,167,56,109,189,24,114,191,128,189,153,128,211,145,93,11,31,119,133,81,179,65,180,200,
+    192,128,131,58,90,124,66,150,252,106,22,129,229,49,88,11,252,42,27,223,109,221,171,12,252,134,242,215,120,219,158,101,
+    239,178,246,73,138,219,15,175,231,179,232,156,229,39,9,124,9,20,198,156,193,135,132,247,93,117,31,228,164,173,15,214,
+    148,252,214,150,87,52,55,63,125,80,151,10,27,90,201,123,154,232,112,132,206,120,53,49,83,28,55,172,91,197,80,213,
+    205,188,197,165,77,214,106,60,197,178,28,191,82,6,250,129,192,192,21,165,235,60,209,186,192,49,180,142,231,182,208,150,
+    110,141,114,208,40,28,235,175,200,57,213,60,47,133,218,168,83,119,131,12,244,145,223,0,107,49,110,144,132,11,81,12,
+    99,60,243,175,236,164,114,114,122,245,202,174,224,8,118,107,175,117,217,167,88,44,127,28,223,105,223,8,253,34,78,83,
+    255,78,249,168,240,157,87,173,84,92,59,40,244,49,17,8,95,82,94,37,161,54,142,4,193,121,27,165,50,192,163,127,
+    221,241,84,236,142,228,82,75,50,246,211,56,133,149,55,156,77,75,216,42,175,191,68,195,25,151,149,104,55,12,35,46,
+    17,158,19,72,169,132,16,32,212,88,169,54,172,72,34,39,204,242,66,152,121,21,41,215,106,95,86,115,225,42,113,152,
+    142,255,219,219,232,60,163,91,237,77,94,83,71,233,171,21,208,51,81,65,66,172,95,15,205,90,120,13,46,15,84,20,
+    18,91,218,96,219,212,84,67,188,227,69,70,23,201,186,10,168,133,18,128,45,144,61,174,181,199,3,134,63,61,183,112,
+    248,234,184,14,8,101,201,233,254,255,9,59,64,206,153,92,5,121,62,71,190,55,117,229,172,27,18,157,126,19,109,20,
+    183,6,25,233,51,193,3,5,74,58,13,90,113,174,224,238,225,168,82,181,143,141,233,230,230,53,103,235,222,198,221,234,
+    232,241,30,112,236,82,230,5,38,135,157,51,65,38,120,167,78,213,171,100,211,176,198,43,234,49,174,124,107,6,192,83,
+    87,241,46,208,57,95,57,221,237,178,181,123,178,101,113,248,59,21,53,103,51,91,7,238,178,52,205,249,33,188,216,176,
+    97,134,199,60,160,191,104,61,73,31,16,218,199,141,157,57,166,30,176,141,212,66,253,235,123,98,140,12,156,136,253,186,
+    192,78,224,144,136,81,130,194,194,241,135,207,107,144,128,188,119,253,135,9,74,201,79,255,112,94,241,138,211,225,177,55,
+    143,122,243,78,209,136,20,62,224,185,184,126,99,159,163,145,36,175,11,132,204,82,148,40,15,236,70,135,9,104,13,67,
+    12,253,14,104,79,223,175,126,13,177,218,177,80,245,34,227,219,217,145,121,240,170,51,63,1,112,27,12,240,21,172,221,
+    217,243,235,74,180,236,161,240,83,180,74,218,201,129,223,162,241,176,111,192,249,128,122,174,232,178,153,41,21,121,113,250,
+    212,40,171,194,24,17,220,40,237,187,134,251,82,145,217,32,237,169,67,212,74,110,30,38,85,244,99,116,27,41,127,37,
+    254,33,150,122,92,252,15,171,75,156,152,222,162,26,199,66,35,44,161,245,83,251,225,34,246,161,47,201,95,235,235,237,
+    127,215,32,226,250,247,106,92,229,54,57,116,172,161,179,119,239,56,246,74,67,185,184,72,131,22,253,47,87,162,13,182,
+    138,30,190,64,42,219,103,194,202,19,184,42,0,243,73,216,139,195,175,44,207,111,132,116,209,185,188,247,234,119,32,239,
+    215,123,9,8,254,85,16,126,25,205,141,35,119,18,185,0,12,115,37,210,114,41,33,29,8,99,56,229,36,183,245,29,
+    120,145,112,140,108,15,132,239,242,147,114,69,198,185,64,55,243,61,178,201,206,212,30,6,67,171,191,237,205,120,158,88,
+    69,58,48,200,46,229,148,104,69,51,238,154,199,228,144,97,244,11,240,96,196,69,7,223,74,208,45,168,201,37,233,128,
+    79,195,54,23,245,84,6,119,37,187,190,126,95,125,150,59,27,254,236,221,236,170,117,20,49,250,217,222,62,238,171,20,
+    178,64,206,10,52,82,125,212,36,231,145,123,54,242,2,84,43,198,133,35,48,119,28,174,240,29,208,197,171,145,228,60,
+    77,229,214,200,51,214,225,93,236,45,54,250,44,253,78,73,27,40,148,153,2,233,142,95,89,207,229,37,73,43,190,112,
+    31,94,241,36,83,18,253,133,89,101,155,132,8,190,126,26,114,67,133,243,178,120,186,132,239,81,142,62,156,210,209,194,
+    124,181,241,151,46,206,59,193,63,228,255,131,6,113,76,175,139,89,12,111,45,173,249,146,170,252,135,40,7,79,87,233,
+    36,86,226,152,88,237,46,167,221,20,245,208,251,27,163,141,20,160,238,217,213,243,255,15,242,182,30,22,208,168,225,95,
+    224,186,248,60,251,25,98,123,182,97,28,136,31,27,108,245,233,188,184,143,159,210,63,163,95,138,8,231,167,157,43,109,
+    211,166,203,202,177,134,211,209,3,185,152,39,208,76,76,113,132,28,137,245,82,159,53,215,207,72,117,77,125,108,107,91,
+    75,62,194,182,87,199,234,167,216,76,245,135,64,193,70,5,67,213,217,58,233,176,94,48,74,54,184,65,190,244,154,19,
+    105,159,22,96,254,139,61,175,198,52,124,31,182,139,206,101,91,121,214,253,230,85,89,254,201,156,185,245,143,114,236,111,
+    207,142,22,156,247,107,144,104,199,216,139,20,255,48,66,22,202,210,12,75,74,34,7,112,36,181,224,172,103,190,44,75,
+    13,200,237,216,118,108,244,154,9,55,193,171,253,48,238,160,240,16,38,242,191,206,23,166,202,17,22,14,253,56,87,23,
+    17,244,16,103,61,117,201,214,148,220,58,231,69,121,119,28,163,77,88,191,109,70,177,80,103,235,14,77,131,115,137,240,
+    246,6,191,76,150,167,255,220,112,7,170,145,179,180,37,220,132,249,76,134,205,1,37,129,114,58,200,78,228,99,162,213,
+    62,31,121,195,23,161,149,31,245,185,88,192,79,191,151,12,206,249,84,217,47,90,113,21,153,124,104,12,92,133,21,21,
+    51,44,212,248,149,209,54,95,189,19,10,162,32,212,244,224,224,130,180,174,24,72,205,58,234,141,189,182,134,3,47,144,
+    159,48,21,89,150,4,47,179,137,254,17,51,84,42,68,93,148,225,87,125,58,70,156,90,251,8,43,153,183,147,201,94,
+    197,59,26,42,41,246,115,31,207,220,225,192,177,59,230,82,70,51,32,168,115,19,105,91,20,55,83,174,100,237,248,131,
+    229,198,199,150,196,217,214,41,114,71,215,147,249,151,251,184,98,120,208,249,48,80,9,46,35,244,40,193,157,218,19,102,
+    112,5,151,196,135,35,76,244,138,191,36,197,54,32,238,41,190,89,216,95,139,158,79,23,206,167,221,71,144,180,7,157,
+    111,15,199,77,17,191,42,79,106,28,20,195,57,101,125,73,62,98,204,35,187,130,203,87,203,208,209,244,65,115,102,172,
+    194,228,76,81,220,121,181,226,214,75,88,50,112,171,12,254,113,111,129,197,152,90,40,182,168,72,231,47,246,233,234,178,
+    130,68,18,54,230,35,62,238,223,187,210,60,122,181,18,185,51,200,31,133,187,10,164,158,208,223,182,48,3,42,171,151,
+    205,253,18,99,225,51,218,96,24,104,212,170,36,85,34,201,218,175,150,105,254,22,9,197,46,44,165,64,240,144,165,232,
+    213,248,101,26,175,27,212,237,192,17,168,104,151,56,25,162,75,37,174,67,236,141,115,167,69,40,130,204,114,148,115,101,
+    202,231,107,76,127,24,90,130,55,158,84,220,105,17,30,118,26,57,78,246,174,41,65,183,106,182,71,197,190,63,201,156,
+    130,215,14,142,71,15,173,50,63,163,21,129,90,46,138,84,243,49,107,16,79,214,133,209,224,160,32,6,235,249,182,223,
+    220,211,36,140,162,215,180,235,213,76,37,77,208,66,21,110,97,126,233,67,111,159,134,177,246,96,232,43,194,91,110,177,
+    194,149,245,112,32,91,19,55,68,21,231,119,27,218,122,127,159,160,227,104,211,72,184,122,194,52,21,222,116,135,91,235,
+    211,10,147,247,18,139,77,137,224,221,47,31,99,21,123,192,132,193,58,243,15,159,242,63,149,43,7,160,225,119,39,193,
+    10,39,11,109,205,78,107,233,60,122,61,240,202,253,115,122,71,225,113,58,164,119,44,14,77,52,229,74,195,124,153,149,
+    255,225,235,81,37,117,75,235,200,110,255,125,85,221,129,143,23,133,143,237,197,126,46,64,178,128,151,227,153,149,48,155,
+    62,186,36,16,245,117,242,141,53,189,183,96,77,121,135,78,4,225,123,120,39,157,192,252,33,226,228,199,55,121,122,221,
+    33,248,15,207,176,210,229,79,82,219,12,2,94,126,21,35,36,245,134,118,106,49,128,209,249,18,106,42,67,102,129,200,
+    93,20,194,194,148,222,95,51,91,109,114,39,129,217,206,204,30,59,140,74,153,255,122,132,75,206,173,97,14,145,96,26,
+    146,94,186,252,54,15,157,158,211,91,139,130,74,32,97,231,234,37,116,228,156,69,156,136,122,194,167,243,30,171,4,57,
+    24,222,56,191,222,232,85,69,59,245,59,122,33,181,230,102,28,201,9,166,39,202,86,9,27,179,253,146,22,180,202,113,
+    30,246,61,93,177,196,146,47,246,187,25,26,166,27,139,177,155,0,30,10,194,234,249,27,224,251,29,65,252,131,169,53,
+    48,174,225,234,208,195,176,90,188,104,106,226,24,185,238,209,212,143,177,159,205,247,143,185,93,154,208,111,128,55,101,191,
+    75,21,23,145,195,139,40,139,142,155,9,127,118,137,13,202,23,186,91,67,107,164,176,47,108,45,79,145,150,165,73,212,
+    117,85,71,140,159,217,125,223,144,76,162,82,223,113,83,56,210,195,191,138,208,22,213,11,211,235,20,112,165,30,87,174,
+    12,11,90,93,240,125,94,175,127,163,154,23,235,68,52,170,239,247,142,26,186,215,223,25,231,158,102,81,187,111,94,38,
+    27,192,180,61,64,253,159,50,236,198,141,218,88,3,7,17,225,204,203,55,91,48,1,234,101,166,208,59,120,126,2,194,
+    67,232,245,5,159,163,89,218,14,223,89,62,224,209,215,187,46,235,121,162,52,102,243,179,148,45,22,192,230,244,174,129,
+    252,28,31,57,115,168,29,136,249,213,9,233,180,175,159,46,232,64,91,116,157,105,11,37,138,184,14,7,160,128,156,181,
+    134,232,17,11,120,92,251,34,44,154,221,7,190,173,72,59,46,81,196,10,180,60,254,130,72,113,101,16,113,150,104,190,
+    249,251,202,4,4,131,85,13,55,164,209,217,33,217,125,24,113,85,147,156,228,92,143,136,157,8,119,76,232,32,160,135,
+    48,110,120,133,137,253,132,140,241,59,232,211,55,222,62,101,121,15,24,18,146,215,100,98,204,145,22,171,41,43,115,220,
+    48,29,217,123,1,239,128,41,25,187,201,122,36,127,66,64,128,20,71,173,147,96,158,62,14,189,10,67,90,125,8,68,
+    200,50,166,18,37,98,132,72,194,214,227,14,84,223,40,30,71,47,60,124,86,114,249,32,193,22,41,172,126,15,112,87,
+    207,27,76,126,10,142,69,34,99,97,148,40,25,129,234,182,159,162,199,31,60,229,249,169,174,244,156,10,127,197,35,110,
+    164,129,113,200,229,162,227,131,138,172,249,228,32,253,102,142,158,103,195,234,76,115,235,176,182,244,181,15,94,109,36,255,
+    205,84,229,104,18,0,144,224,3,166,60,131,36,149,76,248,89,68,153,223,171,71,127,90,73,211,94,95,94,84,208,146,
+    81,145,89,232,204,152,83,248,114,227,86,45,66,178,114,212,118,246,141,211,9,116,22,63,241,202,251,43,221,139,190,196,
+    57,241,70,128,238,36,96,234,223,170,253,169,244,220,250,188,222,66,152,147,64,183,224,66,219,84,188,146,50,233,61,199,
+    205,216,208,182,24,205,104,6,221,188,176,41,230,127,60,242,210,231,128,2,32,150,190,164,40,57,161,139,199,87,175,94,
+    244,154,101,214,162,130,72,137,202,25,175,166,199,15,31,140,95,38,32,247,119,172,72,229,77,33,60,32,116,2,46,149,
+    78,61,151,201,50,153,243,4,48,148,77,237,25,152,195,226,56,150,92,19,47,88,241,26,240,189,28,221,124,216,166,192,
+    248,62,118,121,87,63,167,88,240,47,174,50,77,11,144,59,200,131,190,18,106,207,183,51,45,89,182,15,69,204,62,244,
+    200,143,103,181,119,232,148,33,255,134,29,110,249,32,177,187,101,106,135,182,225,50,160,163,155,248,19,166,100,231,44,82,
+    154,234,174,251,235,246,60,61,229,3,189,155,254,30,132,72,239,188,190,95,228,235,183,203,232,175,33,223,92,36,21,27,
+    209,96,22,112,147,118,84,150,160,133,202,0,146,41,75,88,136,205,204,17,101,133,221,161,246,84,86,16,23,185,221,196,
+    69,17,171,111,168,133,237,229,35,246,196,58,180,124,223,47,71,0,47,46,29,20,187,135,51,94,158,27,123,215,186,190,
+    244,235,59,15,88,118,237,136,198,233,151,3,238,106,232,212,25,4,121,252,194,52,186,67,33,223,115,55,78,51,188,74,
+    124,227,64,81,226,184,131,39,204,236,61,173,234,188,246,33,26,231,23,144,91,186,233,69,234,172,1,146,76,175,193,221,
+    80,153,63,223,191,181,131,221,180,130,39,112,148,4,139,216,219,184,46,108,189,114,41,97,60,162,17,3,148,165,42,153,
+    90,5,35,87,47,158,229,138,145,67,182,103,152,219,127,168,128,170,38,107,133,226,4,118,149,155,53,109,57,71,129,85,
+    150,179,96,108,208,141,236,225,47,17,123,183,94,241,182,116,213,81,97,225,200,25,34,229,73,145,88,87,180,145,36,233,
+    68,155,36,62,176,218,139,126,187,191,149,63,182,183,194,72,8,177,143,233,174,136,109,104,12,203,76,69,190,162,80,244,
+    8,33,37,220,185,195,99,121,130,120,39,28,24,110,212,31,235,76,13,33,16,8,128,141,6,81,51,198,73,3,107,50,
+    68,206,156,252,75,139,48,222,66,223,147,55,29,128,214,222,75,13,204,80,23,235,67,175,215,20,185,105,96,40,43,173,
+    198,167,205,183,120,223,105,139,139,138,87,104,137,120,162,136,227,46,72,190,171,146,182,244,80,90,4,176,181,106,106,56,
+    78,35,89,1,41,150,3,56,148,54,173,158,41,58,234,175,205,76,133,23,51,193,173,174,10,28,198,117,199,203,148,233,
+    216,167,70,91,93,74,152,41,208,165,199,102,199,144,7,74,101,247,208,100,198,240,75,23,27,142,156,30,106,219,92,54,
+    99,234,149,218,115,255,207,186,30,203,16,87,25,11,64,195,29,222,12,88,31,131,161,100,101,176,168,92,114,197,230,146,
+    220,112,224,231,130,154,189,249,13,65,46,248,62,23,61,246,14,120,37,227,68,124,235,173,14,109,119,97,231,133,131,169,
+    154,34,83,233,94,84,6,138,158,233,216,88,32,97,202,59,248,254,143,66,144,127,228,32,41,42,41,37,151,62,94,238,
+    34,36,156,7,62,161,116,47,39,40,73,28,33,166,38,232,115,112,74,239,75,181,97,36,113,45,87,50,90,189,101,50,
+    77,140,145,39,192,102,38,143,244,28,138,241,57,220,101,140,108,248,194,110,113,2,123,224,38,226,233,224,151,18,35,99,
+    101,196,249,228,100,5,200,205,225,61,29,0,103,177,68,245,240,14,251,208,151,168,82,69,151,246,126,147,31,18,221,50,
+    158,255,114,92,101,46,72,62,54,19,72,48,108,73,126,26,218,25,21,109,132,98,229,56,44,133,21,158,164,88,202,138,
+    13,169,94,105,190,115,132,154,59,225,75,106,130,34,34,35,166,51,1,199,114,164,127,179,195,143,12,215,145,59,60,178,
+    195,251,197,132,140,2,245,126,115,98,208,85,61,74,62,38,87,207,217,16,8,163,169,170,167,115,157,195,122,172,117,32,
+    162,29,112,9,128,229,235,249,206,124,142,112,251,147,210,242,178,228,226,235,53,4,43,94,185,152,251,58,41,247,40,61,
+    93,165,244,182,124,40,253,225,93,89,58,68,159,34,52,162,117,74,153,176,19,60,233,98,112,202,59,25,204,188,109,159,
+    13,5,50,152,222,174,162,214,3,60,52,90,85,168,56,185,182,53,124,223,22,66,59,99,38,147,99,209,47,21,132,51,
+    33,55,17,248,213,226,201,213,19,180,82,135,152,116,184,209,166,63,115,44,85,188,58,147,168,55,237,136,121,58,116,140,
+    70,158,187,190,32,243,170,203,217,121,182,164,57,131,24,196,24,200,194,149,62,167,217,54,50,254,176,141,201,3,93,236,
+    57,248,110,30,109,146,65,198,49,245,66,88,86,238,87,207,212,240,73,153,144,96,6,17,213,217,132,35,198,196,24,107,
+    118,171,157,45,55,223,108,162,15,60,75,193,50,189,174,46,173,81,63,100,1,97,254,40,208,145,18,204,72,24,147,25,
+    221,157,181,53,42,12,96,5,198,142,236,45,144,59,158,61,30,100,180,213,187,207,48,218,45,114,104,167,93,228,179,66,
+    252,140,184,27,236,252,43,76,199,116,84,93,214,28,143,244,0,150,224,137,237,116,185,56,112,152,140,173,225,12,63,93,
+    123,150,91,233,18,71,41,49,6,4,253,1,241,27,199,230,65,101,59,1,205,80,92,17,229,246,243,215,87,85,160,212,
+    167,144,51,239,174,118,91,157,89,124,79,204,3,88,186,113,40,29,86,64,102,61,254,115,220,70,173,162,90,212,156,27,
+    39,27,175,100,12,72,22,126,41,204,184,110,2,231,153,0,229,223,206,248,178,94,127,119,12,164,61,40,120,89,186,165,
+    43,37,7,219,152,18,184,172,78,92,158,133,82,22,178,52,16,13,136,88,250,187,254,132,33,200,182,29,230,220,62,151,
+    155,204,89,141,51,185,76,220,139,232,44,113,249,115,73,142,194,108,125,100,193,123,31,29,230,165,40,218,215,169,48,104,
+    48,93,195,70,130,202,151,98,53,79,222,178,8,0,174,188,231,214,47,68,183,255,37,108,74,167,38,95,58,83,61,143,
+    233,168,59,140,52,90,249,178,153,149,98,177,91,91,210,251,152,78,13,185,129,221,111,112,253,171,147,175,150,249,128,200,
+    43,73,136,81,208,15,205,128,61,16,156,137,220,12,35,186,69,18,99,185,79,226,186,4,24,171,114,180,83,5,250,189,
+    86,189,36,252,36,16,117,122,226,183,181,116,62,210,244,66,9,137,164,163,33,228,64,7,131,105,114,77,48,11,32,236,
+    22,95,41,199,11,68,130,159,91,71,4,98,41,192,79,155,221,160,190,254,29,70,64,20,122,164,185,244,30,4,225,236,
+    44,38,227,137,119,168,193,201,241,87,244,58,109,151,96,20,254,96,210,138,66,42,195,42,219,28,166,109,72,132,58,235,
+    247,110,177,94,64,245,2,184,90,105,82,96,81,235,142,87,190,41,62,173,119,92,87,47,248,206,248,175,108,111,11,61,
+    240,193,158,191,115,135,96,57,195,126,37,92,44,23,100,153,100,62,32,83,53,17,67,147,7,64,14,171,43,248,165,35,
+    15,2,218,85,67,208,233,127,7,176,199,142,76,74,141,183,109,242,182,21,104,123,123,223,102,249,115,84,148,142,153,143,
+    98,251,177,179,127,162,153,225,126,112,161,57,25,184,0,199,115,139,79,135,15,98,33,2,36,72,45,67,223,87,20,140,
+    234,149,205,111,104,181,105,212,79,184,192,118,96,54,176,206,64,177,87,197,97,98,13,193,159,40,225,239,253,160,1,128,
+    179,255,222,72,176,205,169,163,107,166,141,18,153,224,168,63,95,251,30,144,81,229,90,226,47,55,46,63,58,22,250,163,
+    39,62,182,129,114,204,89,1,236,111,219,205,168,117,151,188,120,120,170,99,253,170,204,44,157,228,203,22,238,166,81,140,
+    18,220,144,238,151,224,105,57,20,30,228,153,158,114,212,243,225,26,149,40,38,226,213,212,145,235,203,164,237,56,148,209,
+    64,3,137,167,236,125,68,84,70,17,195,207,38,51,148,115,254,99,252,31,224,231,201,35,125,126,125,241,242,255,28,174,
+    55,11,154,246,15,19,217,109,171,119,184,106,3,189,7,173,181,115,88,96,121,147,230,172,64,81,85,166,4,22,46,24,
+    246,217,167,11,5,81,33,17,180,208,19,229,157,251,33,150,182,75,74,123,47,240,39,133,250,98,85,168,61,24,112,117,
+    116,245,198,220,184,224,35,141,180,70,198,207,133,128,110,174,128,197,147,90,5,21,210,163,61,209,182,30,236,56,60,73,
+    79,210,178,11,131,161,141,213,171,44,138,193,169,116,211,17,177,148,143,97,124,13,230,252,206,93,60,202,102,243,43,32,
+    202,150,50,223,131,216,100,56,115,81,72,227,81,48,161,172,141,147,144,124,225,124,101,107,230,98,245,253,209,160,170,90,
+    48,252,55,1,90,226,108,189,49,98,143,69,163,47,216,229,37,134,140,133,51,255,30,231,108,150,228,223,77,217,241,40,
+    17,167,230,19,135,117,191,135,174,54,105,248,201,37,178,26,34,30,219,152,132,70,145,212,7,152,229,144,98,224,121,56,
+    74,148,182,87,84,253,227,194,64,119,115,6,41,150,39,49,42,119,133,26,175,170,124,223,38,114,139,105,165,202,56,239,
+    238,129,234,5,104,209,93,205,40,227,131,234,94,115,70,110,114,223,197,18,207,146,225,79,219,211,6,58,194,150,191,101,
+    183,124,22,220,228,48,60,157,188,118,154,234,251,22,56,141,62,134,38,20,95,23,241,50,162,60,37,111,90,61,64,60,
+    220,56,44,212,109,59,122,198,242,103,37,19,110,85,170,50,132,109,230,57,138,224,46,212,98,239,138,172,253,57,156,213,
+    27,123,146,125,250,234,144,163,178,126,91,79,204,235,244,126,85,105,71,226,29,29,219,228,107,230,89,62,197,211,236,206,
+    232,61,90,241,204,158,166,177,244,126,210,80,198,222,230,27,255,125,226,10,175,246,229,58,210,127,17,111,38,146,184,79,
+    16,254,14,189,83,132,105,255,30,249,169,51,89,225,62,106,34,140,182,52,11,230,205,24,35,153,84,80,90,111,238,126,
+    3,187,164,189,225,251,12,165,39,9,190,96,186,0,144,113,10,178,3,31,13,20,240,163,6,90,48,58,179,217,107,240,
+    182,201,201,234,151,114,177,24,52,211,142,180,230,97,154,17,194,4,28,15,222,0,56,58,196,19,93,55,232,180,56,158,
+    149,197,49,77,41,139,6,247,216,58,57,135,80,22,96,208,133,92,102,203,80,94,65,219,150,175,112,19,150,51,70,6,
+    203,73,221,73,153,63,35,48,43,191,198,98,156,148,164,59,50,223,40,89,47,136,32,232,204,159,44,156,56,248,36,249,
+    238,162,8,188,63,67,65,60,222,79,1,118,87,48,101,52,215,57,121,186,149,200,121,87,244,165,129,119,45,140,138,132,
+    59,183,182,35,221,143,241,100,63,194,170,251,146,160,220,110,60,94,187,248,213,79,77,25,95,185,57,39,249,153,205,207,
+    55,86,218,194,64,245,40,215,19,87,178,103,143,39,27,70,135,168,169,7,154,60,78,8,138,99,96,72,73,163,5,247,
+    92,250,132,38,86,136,164,214,90,236,148,45,125,70,174,17,232,6,189,237,103,121,41,234,217,94,176,238,41,184,242,81,
+    220,169,234,237,246,236,29,86,75,239,106,144,245,175,111,87,76,250,60,170,58,97,164,60,236,148,182,111,58,199,93,120,
+    8,241,60,101,56,30,161,34,126,141,71,183,52,26,178,70,63,59,10,205,46,200,236,181,209,147,55,179,187,139,227,186,
+    139,245,148,164,135,53,113,178,153,240,34,65,189,218,232,143,133,72,37,72,163,50,100,65,139,68,147,21,80,204,184,184,
+    10,72,192,217,53,96,226,47,145,118,185,166,123,75,183,40,235,62,224,19,53,215,184,19,0,61,243,20,149,61,28,235,
+    195,56,87,100,189,128,12,134,11,143,75,181,45,20,127,71,245,148,80,140,194,106,158,43,234,93,205,13,157,179,152,252,
+    239,134,3,239,108,63,164,214,37,92,207,181,167,101,187,170,110,129,153,16,58,145,182,160,233,167,16,188,182,107,212,54,
+    249,165,228,247,224,116,190,104,243,168,121,39,44,19,122,235,130,230,8,163,129,206,223,181,57,76,30,122,110,13,120,197,
+    40,77,173,143,32,36,215,59,127,115,69,223,182,97,89,126,180,250,174,231,227,161,58,141,134,250,160,166,201,97,232,170,
+    213,220,194,221,241,174,102,206,218,213,246,67,216,151,33,231,251,6,70,24,216,55,76,106,227,208,36,193,103,255,13,109,
+    144,250,159,163,60,17,224,71,79,53,249,163,66,61,221,90,73,37,75,118,81,245,202,221,173,126,35,93,36,173,21,163,
+    164,115,42,153,226,215,95,185,36,63,189,172,155,85,159,68,79,95,91,23,234,209,44,74,35,215,9,217,194,228,46,122,
+    209,216,4,195,200,111,192,132,214,209,27,254,239,114,195,74,235,170,11,212,116,242,90,161,255,169,80,141,143,231,34,229,
+    206,90,150,206,162,205,81,226,132,182,238,1,98,40,91,229,132,24,155,65,137,248,200,109,119,150,102,70,176,3,41,66,
+    25,38,147,135,230,112,88,210,181,239,25,247,176,185,26,79,181,248,230,79,191,161,95,141,193,108,149,110,247,220,190,45,
+    37,120,30,86,246,132,77,153,252,238,156,205,31,67,41,152,151,137,67,34,86,120,73,154,235,209,215,64,194,123,169,249,
+    193,250,238,42,161,177,220,31,41,146,49,56,120,43,212,148,44,131,10,28,91,195,94,228,153,154,45,213,114,185,96,223,
+    197,234,181,20,158,64,45,11,51,232,182,6,171,233,145,74,43,23,218,81,173,86,76,78,3,143,127,5,166,93,149,197,
+    230,19,121,20,184,160,57,63,232,31,242,85,106,91,43,246,0,97,130,171,90,165,232,66,32,99,177,60,31,249,229,3,
+    31,107,133,164,73,119,224,85,67,88,235,30,224,86,228,66,83,92,165,112,152,10,73,135,197,241,166,16,205,196,229,38,
+    201,34,1,189,72,20,101,46,239,35,18,102,186,208,96,59,222,32,109,34,55,10,193,140,2,189,49,99,81,118,195,30,
+    8,185,103,237,133,12,236,207,190,122,4,161,78,194,155,43,191,229,95,106,103,47,255,212,100,252,60,207,225,195,46,182,
+    64,145,162,235,32,55,39,75,247,114,177,208,249,126,131,68,141,94,255,81,206,176,160,224,141,158,234,142,193,224,4,161,
+    159,107,176,46,13,169,197,183,246,221,202,93,184,245,53,63,122,127,96,149,88,43,46,8,112,126,8,181,38,215,34,60,
+    14,253,51,195,9,214,101,176,11,251,52,11,19,53,40,13,4,253,97,70,237,120,185,146,207,206,120,231,237,231,25,186,
+    10,59,183,93,241,217,98,162,10,253,172,184,133,100,181,162,15,138,5,10,191,89,117,178,55,89,204,44,244,95,23,198,
+    216,27,80,15,63,24,156,63,167,203,64,101,239,201,109,175,74,198,73,239,120,150,108,204,107,30,148,152,69,0,47,199,
+    95,29,218,149,84,61,248,196,49,249,99,219,254,234,154,106,110,130,158,176,42,175,52,127,189,70,195,148,9,104,32,148,
+    238,95,223,6,12,58,164,20,250,254,197,9,11,187,15,182,245,120,236,55,41,40,58,245,251,150,176,31,138,84,7,183,
+    138,93,34,91,52,252,238,69,140,73,9,85,8,62,106,140,209,66,211,75,196,45,117,90,111,37,130,39,149,83,84,43,
+    63,72,45,252,57,99,248,88,58,223,10,206,134,166,127,39,80,183,178,117,215,8,230,190,15,180,176,186,240,233,148,206,
+    17,71,221,8,110,107,169,77,48,201,182,170,100,210,40,133,145,172,177,8,79,136,117,41,14,8,178,241,86,180,231,157,
+    139,145,170,248,163,135,41,11,27,159,224,186,84,45,31,147,22,148,164,238,65,101,192,144,112,205,239,254,48,102,49,21,
+    52,232,58,56,243,159,62,103,223,239,106,251,160,215,26,191,198,242,52,178,171,72,87,3,239,133,38,177,43,29,115,163,
+    16,142,185,148,56,68,213,58,227,135,54,173,190,166,113,137,150,167,21,19,177,51,102,213,175,75,235,168,92,165,237,101,
+    230,244,199,168,131,111,80,184,212,138,226,156,157,13,217,130,139,201,38,87,151,111,232,77,94,81,15,199,150,182,239,214,
+    181,216,205,253,146,234,228,251,146,215,129,247,65,28,50,252,113,50,245,17,53,89,226,232,103,189,86,137,164,118,131,31,
+    201,14,177,57,97,144,211,221,92,78,234,175,37,124,208,191,126,97,84,151,226,142,235,30,226,136,47,131,160,218,105,52,
+    116,136,203,22,249,78,35,49,124,134,31,225,92,72,150,183,148,240,135,27,217,77,222,55,193,65,206,173,43,102,158,54,
+    87,108,221,88,226,23,69,144,84,232,111,33,49,198,134,238,164,239,22,124,45,37,103,254,138,236,23,185,247,2,143,39,
+    253,166,134,218,237,32,228,90,132,131,131,253,164,109,115,163,177,142,165,32,99,67,174,201,82,232,0,219,38,136,248,26,
+    104,96,1,54,49,131,115,77,189,215,48,6,45,153,14,206,251,21,53,27,241,3,56,175,50,59,89,42,233,56,171,163,
+    22,115,141,165,202,56,68,79,232,5,198,9,243,212,0,131,237,108,106,240,55,138,14,242,26,221,91,173,105,222,200,14,
+    10,220,33,176,124,193,6,122,40,52,46,169,251,36,111,237,157,250,94,210,36,31,216,121,114,252,92,30,57,229,42,170,
+    216,218,161,24,232,81,195,173,227,221,41,253,245,92,85,103,225,173,47,72,114,200,158,98,204,124,235,49,101,229,161,55,
+    225,117,254,231,129,160,155,115,252,214,68,88,122,58,93,235,101,145,226,140,190,125,77,116,63,116,218,179,238,31,72,100,
+    98,7,113,67,51,55,16,13,224,137,139,94,40,25,187,209,8,236,238,84,167,131,242,152,44,249,78,2,19,146,248,0,
+    47,230,235,206,141,188,4,224,226,75,138,206,226,167,66,147,154,90,197,204,234,253,37,37,171,144,81,116,119,104,92,32,
+    223,230,65,123,112,69,93,68,7,85,200,200,3,169,29,140,238,82,47,53,73,251,201,35,198,252,76,48,86,210,237,229,
+    48,120,45,197,111,133,243,35,51,248,42,253,108,211,179,165,54,228,81,125,174,192,154,72,220,163,74,115,38,176,227,137,
+    228,189,227,132,153,142,155,139,38,126,68,243,84,20,37,253,0,206,142,221,87,183,123,253,33,116,117,25,81,42,49,234,
+    92,96,176,117,252,127,196,223,197,124,169,171,83,73,67,246,235,145,187,118,139,38,35,218,28,117,75,50,93,236,97,69,
+    9,112,22,203,163,227,1,7,251,33,46,137,42,54,239,52,3,67,42,97,247,113,232,232,170,58,134,195,234,66,200,17,
+    15,179,185,33,151,25,194,52,185,109,62,219,74,178,12,127,169,60,6,233,108,114,241,150,186,169,77,110,164,196,144,229,
+    72,22,176,55,178,205,69,226,21,187,217,215,53,254,134,75,20,146,97,204,178,147,197,165,153,103,125,26,1,205,163,11,
+    150,108,173,247,165,152,219,8,246,174,16,71,162,212,95,15,133,16,17,93,3,198,147,54,143,26,17,177,12,70,104,191,
+    22,225,72,7,0,194,172,71,168,248,132,65,254,171,224,42,140,37,166,160,6,148,46,31,3,237,117,38,26,67,30,105,
+    72,249,172,132,83,41,51,12,141,29,202,32,134,195,152,125,244,188,223,250,14,81,160,28,208,160,248,207,83,86,101,28,
+    214,171,75,1,233,124,111,80,40,201,72,170,166,19,194,248,95,195,118,238,222,82,81,195,84,201,36,153,106,82,61,71,
+    54,93,36,84,234,223,133,147,82,32,144,171,42,242,201,219,43,185,104,111,187,14,34,218,155,144,118,180,159,167,115,124,
+    129,96,37,130,35,40,199,203,33,84,234,161,149,32,35,142,143,146,229,252,161,230,130,190,150,29,21,242,138,58,10,124,
+    196,70,28,58,1,73,222,122,244,224,19,81,77,150,151,142,175,162,128,50,81,190,41,191,116,62,218,142,192,103,142,50,
+    139,64,13,1,176,105,205,186,57,69,9,43,163,125,241,83,113,76,28,65,132,157,233,183,105,79,133,159,64,85,90,74,
+    158,69,0,4,20,46,112,21,10,165,1,30,20,140,250,175,185,72,136,29,111,90,242,163,184,63,36,152,43,163,112,59,
+    133,157,78,240,178,97,176,221,28,8,64,52,63,101,101,220,208,170,81,253,37,77,140,30,204,208,237,56,71,48,102,16,
+    153,236,34,48,239,94,204,96,194,235,106,128,210,180,249,224,72,21,97,12,218,169,12,4,216,141,162,159,217,205,198,168,
+    9,58,57,182,210,166,116,254,99,241,110,3,75,195,215,244,217,230,109,200,83,197,208,234,164,70,216,164,168,183,138,121,
+    31,216,153,181,72,180,21,48,221,185,159,4,134,236,27,62,153,179,11,234,88,191,8,187,131,66,71,21,191,1,169,180,
+    88,170,82,197,59,62,163,189,68,141,187,97,91,40,191,233,134,94,83,223,120,217,122,251,125,105,30,185,119,64,9,23,
+    203,27,172,62,60,26,50,193,186,181,245,124,79,67,113,17,120,168,80,34,196,249,88,57,116,152,206,120,78,228,175,94,
+    29,152,166,157,83,29,0,42,99,134,34,156,73,162,182,121,202,69,203,187,202,153,185,75,217,71,27,171,59,175,206,111,
+    124,246,47,250,241,239,85,235,95,107,88,2,229,35,118,155,183,236,129,35,18,90,8,64,72,252,129,199,139,78,121,121,
+    88,255,132,54,42,173,118,13,128,141,16,195,57,146,39,233,68,147,24,15,3,96,220,22,76,153,213,186,0,37,159,78,
+    142,19,3,245,88,49,75,147,118,102,46,79,21,234,29,192,168,108,101,67,2,237,89,117,78,126,63,29,33,232,6,155,
+    192,123,251,231,107,143,70,152,92,129,226,114,200,110,227,41,164,34,109,111,91,8,182,108,92,216,237,229,67,24,48,14,
+    94,203,236,173,189,144,42,24,245,47,245,93,8,159,131,109,170,217,229,136,87,21,220,93,35,151,152,245,15,232,211,126,
+    65,185,230,69,246,113,193,10,89,187,161,218,200,58,119,229,251,106,31,211,98,16,246,64,194,116,70,82,223,71,255,199,
+    130,180,93,80,204,102,117,137,232,120,64,72,181,13,218,128,195,237,252,141,61,138,108,140,61,7,129,156,43,140,86,100,
+    236,12,141,84,38,9,205,122,238,4,134,77,52,21,234,250,189,36,65,26,141,55,172,106,37,145,24,71,9,186,235,92,
+    119,9,161,100,0,183,132,5,91,90,23,211,142,203,201,225,189,78,64,57,214,150,243,194,248,53,220,16,121,201,51,195,
+    112,157,85,100,55,3,61,178,45,125,74,182,58,137,241,74,6,112,120,36,19,138,120,235,31,130,99,253,236,234,243,234,
+    44,221,219,205,67,234,35,90,69,142,48,240,44,234,211,43,55,242,242,70,239,172,187,172,70,162,255,85,143,125,131,136,
+    105,188,79,105,99,168,239,139,131,205,76,55,124,156,46,121,120,122,147,11,68,252,43,117,36,105,124,223,116,63,27,250,
+    91,250,22,69,106,52,36,118,244,95,135,189,6,60,185,175,199,92,41,31,232,28,20,64,11,99,83,60,16,233,26,68,
+    14,119,10,240,165,147,36,195,0,120,43,154,192,65,1,162,19,66,128,14,39,127,252,120,179,172,134,26,216,145,77,114,
+    253,101,140,211,54,133,232,97,88,250,12,188,35,155,105,174,168,227,36,221,234,91,232,10,161,62,45,26,108,214,244,55,
+    77,137,129,26,228,86,71,221,196,95,131,235,1,137,137,60,158,213,141,42,27,164,193,188,4,160,93,53,1,84,194,173,
+    71,169,166,239,189,118,93,41,235,197,54,177,133,192,89,0,164,183,43,102,77,234,85,67,180,110,90,0,84,216,214,14};
+static const uint8_t rankingTile_256spp_u8[128*128*4] = {
+    73,255,189,229,51,199,9,224,188,251,208,50,253,231,150,198,166,239,26,104,70,53,64,68,199,27,37,231,196,32,70,131,
+    49,247,132,56,49,180,212,73,160,101,119,7,128,82,219,96,176,116,63,121,155,140,161,13,65,193,200,232,202,8,52,58,
+    122,68,61,59,150,6,219,92,17,58,105,111,68,130,157,168,221,108,220,9,46,80,50,104,42,70,182,176,86,76,147,117,
+    197,232,17,202,179,162,26,183,4,47,137,85,229,56,103,31,253,242,134,176,22,144,178,96,42,138,228,155,53,25,234,91,
+    154,233,58,100,247,207,117,56,198,122,4,165,150,31,148,88,219,73,88,8,206,6,134,200,97,125,154,66,214,216,134,66,
+    47,48,131,115,145,56,215,175,90,166,28,6,254,10,154,114,122,243,17,119,248,232,61,11,114,65,41,123,185,115,91,236,
+    145,131,2,27,142,148,87,99,23,78,175,210,103,153,164,18,173,243,43,44,114,46,31,77,187,22,49,80,150,95,15,140,
+    208,164,214,73,170,156,146,167,185,208,16,130,23,77,88,83,198,117,98,113,201,237,47,198,129,214,235,201,200,133,164,212,
+    239,83,198,79,144,156,31,229,241,155,198,242,141,62,54,170,23,3,168,117,170,94,37,81,15,110,193,214,76,72,19,171,
+    218,250,19,90,169,133,254,204,198,227,164,74,141,11,83,47,205,15,91,147,192,59,125,242,156,100,93,215,39,12,179,109,
+    56,228,207,44,151,97,166,131,41,203,14,223,1,21,21,77,62,151,128,35,104,102,112,237,185,100,21,36,63,189,180,71,
+    182,127,65,209,133,198,227,43,66,148,90,51,254,247,4,175,222,104,132,173,19,177,113,158,190,198,156,149,22,60,130,88,
+    7,98,78,136,29,218,112,43,96,129,225,174,83,185,70,129,255,83,123,67,40,3,28,185,96,28,236,0,34,162,89,214,
+    238,50,69,152,48,58,205,114,124,185,51,55,138,162,35,147,84,236,16,108,206,145,63,44,118,18,146,11,44,70,156,16,
+    98,10,38,198,59,244,94,9,203,88,117,213,12,115,112,240,155,155,150,218,15,246,31,250,133,171,175,193,99,205,118,133,
+    73,67,236,70,63,31,250,42,147,91,211,201,21,192,43,241,98,149,37,132,230,5,155,132,36,134,34,250,228,37,233,106,
+    66,38,128,42,82,226,195,93,94,15,48,237,37,205,10,10,139,210,153,46,236,7,4,64,236,39,39,0,156,69,91,189,
+    214,13,18,19,247,108,39,37,115,232,13,151,249,110,235,122,130,226,125,52,20,162,129,243,225,167,207,192,62,79,46,4,
+    197,126,136,85,57,197,210,27,151,52,210,0,14,28,11,79,167,148,165,180,227,58,186,212,210,232,173,143,151,34,236,182,
+    36,228,96,108,94,134,113,102,6,65,33,17,187,184,62,162,208,16,161,40,20,5,111,44,10,152,122,119,106,113,143,202,
+    120,114,173,11,13,209,149,12,120,182,207,55,242,225,219,33,118,96,120,62,204,185,9,109,106,43,40,133,148,180,234,197,
+    75,55,76,106,161,152,173,11,5,85,113,70,138,250,160,225,136,55,232,173,126,149,172,253,9,171,238,156,149,103,23,110,
+    197,123,134,50,15,186,155,175,24,253,81,1,42,141,165,2,75,32,9,26,248,88,74,7,56,65,7,110,157,5,17,51,
+    27,50,57,8,4,193,70,92,110,195,254,86,124,233,41,244,228,156,180,41,158,14,57,159,73,65,205,53,25,3,192,9,
+    91,110,177,95,5,12,204,200,132,130,254,60,46,10,232,187,147,58,97,137,66,7,14,6,224,191,99,173,158,165,44,36,
+    27,162,98,69,45,59,42,10,67,126,3,14,66,100,32,9,100,103,57,134,8,245,21,0,236,54,177,18,226,170,214,143,
+    243,149,134,101,140,26,57,94,186,23,1,74,22,244,31,88,187,248,99,51,231,18,237,126,16,2,83,191,89,163,35,241,
+    78,103,156,196,0,133,70,72,75,61,79,156,249,91,243,240,255,24,97,28,88,33,41,34,168,200,129,162,228,233,62,39,
+    248,169,141,174,24,132,216,221,131,98,57,105,86,220,217,251,0,196,15,2,162,111,175,252,29,235,203,94,33,218,150,148,
+    112,205,83,220,119,128,123,83,140,237,42,52,182,223,161,163,35,206,41,108,32,139,79,198,69,178,50,86,135,99,113,211,
+    98,136,203,18,248,132,91,124,58,129,120,99,8,52,23,134,54,223,89,10,18,224,101,87,165,146,148,194,79,203,73,238,
+    10,161,222,203,131,2,66,104,166,24,142,35,127,209,202,73,98,233,17,242,162,158,1,137,0,199,141,71,51,30,241,251,
+    245,209,18,66,54,14,22,102,136,94,176,200,105,228,28,32,41,234,143,78,202,200,136,41,108,155,163,103,154,169,144,159,
+    33,45,146,85,247,151,187,214,125,18,68,217,119,229,96,29,169,74,64,110,133,56,156,144,200,7,99,127,37,112,197,232,
+    125,90,28,214,54,61,59,18,89,56,122,152,95,149,250,160,190,207,253,39,105,45,49,140,223,55,211,147,145,27,212,175,
+    180,171,101,219,18,208,234,81,152,50,126,139,82,157,227,203,20,26,139,223,32,113,81,41,128,84,120,145,100,42,144,142,
+    187,48,74,72,228,86,195,183,49,240,141,247,23,141,100,99,159,84,250,197,43,120,102,65,106,227,105,3,248,43,142,67,
+    172,73,236,37,253,173,141,221,127,126,137,25,78,159,210,75,143,139,235,113,97,216,225,29,188,19,206,161,157,203,124,61,
+    10,199,55,8,229,217,169,171,174,176,19,135,17,216,209,22,101,106,116,8,199,187,52,235,102,98,160,232,177,233,71,170,
+    30,68,153,251,46,34,86,165,193,31,231,140,40,188,214,45,57,79,156,21,106,157,160,255,35,248,163,11,140,16,1,220,
+    5,88,252,28,255,20,0,34,2,8,167,225,115,149,122,157,10,64,3,17,192,199,162,242,73,77,140,116,67,156,0,65,
+    156,88,153,14,209,119,231,168,111,114,198,170,20,171,64,171,34,90,158,65,187,103,232,164,79,102,70,41,158,186,159,19,
+    137,59,60,154,235,169,41,249,189,124,23,216,219,202,78,144,144,146,127,170,134,90,11,164,132,80,207,83,38,57,165,69,
+    147,36,223,148,152,84,97,171,173,126,95,5,31,168,33,125,246,118,95,115,118,42,115,156,89,102,22,193,45,56,117,36,
+    174,20,58,59,220,74,22,65,57,199,80,75,248,216,156,212,171,27,75,164,209,167,43,176,44,38,85,152,46,235,234,103,
+    250,91,94,44,156,228,52,26,189,233,126,19,232,183,171,2,196,218,40,54,11,152,98,140,70,65,11,8,38,239,39,134,
+    237,208,194,77,140,51,137,255,226,84,244,40,15,137,186,46,30,97,200,7,231,10,91,32,15,168,80,226,184,77,88,12,
+    26,25,42,149,28,60,125,217,94,94,46,201,168,176,18,27,129,108,151,227,197,16,31,72,150,130,83,120,213,80,144,253,
+    167,97,48,63,248,48,42,166,18,147,255,97,240,247,250,130,124,4,0,8,194,6,43,215,179,230,3,148,99,234,169,129,
+    33,104,12,192,173,107,223,254,175,50,104,20,38,138,116,22,242,24,149,130,141,30,163,29,228,193,219,3,16,217,4,49,
+    35,9,193,78,129,159,104,96,108,34,105,162,206,38,53,172,110,100,41,211,50,148,93,126,240,68,73,215,226,131,168,223,
+    208,60,56,207,198,55,182,41,148,173,249,171,245,122,200,182,226,61,48,74,95,214,11,8,192,110,189,30,10,129,66,5,
+    138,46,104,40,63,26,212,191,137,132,155,167,159,57,110,67,168,122,127,14,208,41,146,65,7,166,242,5,172,45,157,195,
+    198,193,74,247,203,39,188,214,164,52,125,220,60,196,198,232,131,175,75,75,64,9,16,209,112,105,12,43,208,36,61,201,
+    78,67,70,100,242,114,152,202,204,231,240,234,58,198,67,163,222,75,222,173,63,129,74,172,53,102,163,245,94,146,30,40,
+    128,18,69,73,76,63,3,32,105,230,38,92,198,149,100,37,242,76,77,47,219,147,250,220,43,85,58,131,179,174,19,239,
+    192,149,58,60,194,176,16,121,140,227,19,41,16,243,2,230,180,208,95,236,244,150,129,212,103,216,11,79,110,131,200,50,
+    34,98,73,217,220,63,156,176,62,197,47,214,210,61,152,162,52,25,97,25,98,217,222,181,75,44,240,248,158,228,91,226,
+    159,44,244,153,15,76,16,11,20,204,118,177,171,7,2,175,95,184,38,141,136,178,82,0,54,251,238,71,83,220,240,84,
+    92,108,176,104,200,65,122,16,38,108,58,230,8,58,56,124,38,215,208,176,137,211,65,71,14,112,19,39,220,204,144,0,
+    26,236,89,4,126,234,32,31,19,100,127,227,102,234,92,102,61,219,207,12,124,163,40,1,144,186,128,94,248,0,47,241,
+    5,118,248,97,247,119,0,39,216,13,39,207,247,58,132,29,177,204,72,84,121,136,140,136,138,212,121,206,135,12,163,208,
+    23,44,207,244,84,208,178,112,233,163,105,177,1,44,83,78,151,5,47,64,10,33,145,140,34,36,218,55,82,3,130,84,
+    60,82,106,26,167,181,115,17,58,124,154,26,233,225,88,200,147,87,222,29,248,40,247,74,8,153,8,15,26,247,118,9,
+    60,68,175,120,242,124,176,230,89,7,109,37,69,250,124,54,248,58,30,120,27,54,188,73,223,2,3,171,231,99,118,87,
+    136,10,78,72,142,40,205,143,14,164,207,62,110,77,80,116,184,155,27,147,130,75,33,10,159,9,25,183,20,67,101,84,
+    117,14,64,35,122,128,19,61,250,115,4,45,251,104,249,118,163,76,129,134,183,116,23,182,89,161,54,41,63,35,225,148,
+    188,114,31,25,87,26,25,41,235,81,39,64,152,134,159,84,168,174,246,43,47,237,241,12,116,205,142,189,112,113,185,95,
+    80,31,58,74,46,126,113,211,57,161,131,186,241,64,48,88,34,139,67,212,135,71,154,124,186,209,76,106,39,203,162,48,
+    203,195,192,23,140,26,167,180,3,147,216,219,169,33,114,84,199,233,132,254,127,12,148,62,108,123,163,75,140,21,25,22,
+    165,230,219,129,193,105,128,153,188,187,229,70,150,57,64,80,77,154,181,162,35,37,7,137,63,150,28,5,19,60,142,71,
+    68,131,37,88,66,144,167,46,255,108,203,171,74,65,59,23,188,104,237,16,89,225,234,246,116,46,114,139,137,72,2,129,
+    95,127,6,98,22,6,142,150,200,9,46,26,103,186,190,37,247,129,255,252,57,161,91,9,128,203,70,154,213,175,115,252,
+    136,197,246,126,128,240,235,40,95,74,31,197,83,64,160,7,174,118,144,218,201,106,231,11,4,165,185,153,108,63,145,14,
+    21,246,192,79,74,84,26,151,1,14,172,208,126,66,75,199,60,220,58,146,133,54,172,159,103,21,48,185,219,242,180,230,
+    157,103,236,159,202,243,220,154,126,65,96,91,115,1,133,35,96,120,7,148,10,221,42,186,67,120,237,251,105,236,56,244,
+    135,19,228,20,240,210,152,227,105,196,124,250,49,202,222,124,199,219,30,77,76,17,21,144,19,109,129,79,178,149,1,69,
+    226,98,188,97,178,249,157,253,137,234,145,38,32,131,181,137,32,254,234,10,134,223,148,231,16,163,144,56,58,39,53,51,
+    202,249,48,41,61,147,70,109,99,162,28,224,123,40,44,226,11,73,154,151,32,163,166,239,172,203,148,41,62,11,136,208,
+    200,156,224,208,37,53,59,140,16,71,74,83,53,217,116,144,119,92,202,230,81,148,165,52,128,228,199,176,178,106,7,235,
+    203,89,171,148,36,128,54,92,98,214,79,55,77,112,232,243,99,179,228,125,156,64,106,231,248,79,157,40,255,44,145,121,
+    185,101,8,30,105,28,69,216,156,201,76,62,195,180,37,166,156,0,24,233,2,217,183,210,157,236,246,90,199,181,0,250,
+    227,242,34,226,242,134,182,165,148,87,239,249,176,24,81,147,154,73,242,73,216,140,128,220,108,212,115,30,195,117,9,72,
+    218,28,3,117,103,185,147,8,96,65,203,7,226,182,8,61,16,244,229,96,82,55,104,52,112,12,147,73,10,151,30,247,
+    243,136,112,158,204,249,2,146,205,187,23,37,161,90,83,208,200,66,156,58,112,2,220,31,211,220,61,97,236,2,103,194,
+    69,162,134,213,45,235,126,88,144,89,30,27,143,183,151,217,167,43,243,89,106,207,137,214,166,241,253,223,251,89,247,159,
+    66,61,246,86,118,237,8,179,102,222,104,28,75,17,167,5,184,170,73,219,149,217,93,233,200,9,142,228,12,14,156,17,
+    214,222,146,144,7,2,122,140,87,220,8,200,195,252,116,199,245,9,53,252,112,124,117,208,247,219,71,8,111,0,32,53,
+    10,240,0,32,56,56,102,139,232,68,42,45,52,253,222,114,66,182,114,247,184,71,194,49,90,188,241,73,145,104,224,200,
+    252,85,201,64,242,137,61,208,56,63,1,26,214,170,16,68,118,172,16,38,132,70,202,28,141,24,215,237,171,165,77,104,
+    90,54,45,227,160,156,122,247,112,23,226,203,201,46,57,161,56,9,74,43,84,129,130,221,86,70,123,15,10,162,0,64,
+    20,10,20,197,28,25,163,64,225,92,62,82,83,134,191,154,15,227,184,220,3,141,189,222,127,112,32,19,205,114,90,135,
+    194,214,253,85,15,220,103,218,139,140,198,145,145,143,168,232,132,156,228,129,99,52,205,129,159,97,46,138,100,75,202,134,
+    167,2,233,129,183,145,88,217,193,97,23,136,93,249,130,246,157,161,236,73,199,28,51,118,72,222,115,7,166,111,12,48,
+    142,213,228,183,245,179,70,183,177,23,39,18,2,119,44,47,56,160,197,115,206,137,145,212,131,43,209,199,113,32,58,129,
+    168,27,161,179,203,253,182,213,211,16,52,189,163,41,152,153,244,102,75,126,88,255,92,66,110,141,131,49,179,18,41,41,
+    91,2,55,92,149,47,170,214,242,47,12,165,129,242,32,125,187,16,80,119,241,28,157,239,181,89,47,208,245,246,206,146,
+    185,44,103,17,238,204,37,249,133,224,19,39,111,162,3,252,209,103,119,154,76,20,83,190,119,220,101,192,21,10,2,150,
+    170,229,92,168,114,83,184,171,109,88,111,26,249,217,202,107,169,204,233,216,156,224,66,42,247,138,155,2,157,218,16,25,
+    5,4,110,71,175,104,221,221,67,247,194,129,22,236,221,19,199,217,95,112,217,57,70,106,158,243,3,216,197,176,167,239,
+    106,3,40,72,117,47,251,24,74,108,125,148,111,170,218,2,156,205,0,26,133,23,4,144,155,84,58,6,246,152,76,45,
+    191,252,48,205,91,48,252,200,7,65,139,95,89,159,36,6,46,250,107,143,30,177,4,157,105,156,232,130,37,118,101,51,
+    80,1,135,184,121,38,200,170,70,28,8,61,148,195,130,38,108,47,48,67,176,174,248,16,80,13,101,0,234,214,172,103,
+    177,216,123,240,200,1,101,129,195,150,63,76,144,5,78,127,108,159,219,38,173,162,33,48,233,141,80,245,129,57,89,70,
+    127,181,4,4,68,75,175,100,181,93,148,104,240,141,246,104,43,240,198,124,171,106,187,252,53,145,141,96,115,197,75,4,
+    187,16,255,67,251,165,171,236,111,108,5,60,234,161,140,26,149,33,140,223,26,10,207,122,39,5,24,170,10,9,144,200,
+    25,10,74,228,80,0,235,129,170,86,145,220,173,98,13,74,111,36,48,178,204,33,82,50,100,92,88,0,6,180,5,151,
+    105,199,188,113,11,131,97,194,53,7,83,134,157,81,70,141,14,205,11,205,69,26,163,225,130,117,54,208,33,20,128,53,
+    45,153,233,59,233,85,134,72,13,129,14,153,103,86,42,179,217,138,142,0,93,94,125,85,96,243,140,27,192,115,61,42,
+    147,43,128,39,191,202,9,165,104,232,118,249,131,127,7,224,151,37,245,100,76,127,25,55,97,180,207,126,104,143,229,151,
+    172,219,188,82,81,155,20,126,166,79,212,8,207,248,93,123,237,136,217,101,28,173,204,100,54,228,14,44,41,232,55,6,
+    110,62,177,55,22,198,253,13,113,81,69,177,32,184,55,114,166,24,100,208,204,208,208,255,31,185,245,72,190,141,178,114,
+    163,153,107,253,211,117,26,27,21,245,216,196,136,72,65,207,197,70,168,173,247,140,111,122,18,91,226,70,250,15,101,108,
+    36,244,136,147,150,64,142,216,223,81,43,156,79,177,112,163,224,193,249,229,22,183,63,156,128,252,168,164,153,15,142,153,
+    126,232,16,162,250,51,62,200,193,169,47,139,64,87,82,200,177,166,146,158,76,40,235,1,172,81,106,88,91,158,57,99,
+    78,87,83,84,203,179,2,145,34,214,171,79,92,13,52,73,117,172,203,214,91,3,172,42,23,1,53,160,103,116,73,177,
+    150,214,79,11,33,58,122,98,121,46,84,187,250,219,172,3,244,113,18,49,35,98,10,215,105,244,113,239,125,101,65,133,
+    55,171,39,218,196,203,195,48,210,130,88,177,143,56,124,31,66,17,139,203,23,132,177,127,198,176,55,207,169,92,77,48,
+    219,202,214,231,194,152,163,131,76,167,23,108,194,114,121,150,194,28,220,44,127,121,129,138,227,72,92,6,138,34,2,79,
+    120,129,80,133,67,21,131,184,95,113,157,225,136,80,42,142,191,2,36,205,240,112,247,113,233,144,6,214,91,33,128,101,
+    111,147,79,143,69,153,151,221,213,251,252,82,35,40,71,64,129,219,139,176,165,70,44,248,94,197,44,5,179,110,122,104,
+    228,63,11,190,168,33,151,29,123,163,133,187,229,136,93,229,170,5,164,161,189,169,157,200,1,235,152,181,1,74,130,170,
+    147,210,17,246,87,178,59,79,56,191,82,207,27,208,51,243,121,138,139,41,52,137,179,103,226,109,93,212,1,96,7,58,
+    4,195,27,102,106,135,71,171,220,193,219,142,66,129,145,16,144,222,128,4,114,62,100,50,173,179,4,224,23,110,184,177,
+    229,8,35,55,199,93,175,43,58,22,79,222,127,43,235,61,41,20,202,115,25,17,177,211,71,41,172,3,109,235,83,204,
+    205,202,177,205,228,98,41,239,226,135,8,186,37,121,196,138,227,81,63,198,36,120,216,110,235,205,125,25,54,232,126,29,
+    182,223,217,11,246,210,232,0,243,159,5,42,72,158,60,1,154,20,46,51,99,33,253,126,250,239,15,200,70,229,102,136,
+    150,214,185,106,67,124,220,50,137,26,129,75,228,181,26,245,96,174,126,63,57,92,119,186,133,202,123,49,209,68,83,140,
+    127,169,247,29,29,241,38,20,63,237,151,99,213,250,172,198,150,132,216,98,101,68,185,114,77,170,140,160,13,106,215,59,
+    37,38,184,114,123,93,98,74,87,174,204,176,248,183,190,107,242,104,149,127,23,221,235,169,247,206,173,185,82,58,159,44,
+    85,113,50,0,72,45,195,156,91,182,2,145,17,198,172,200,10,159,177,82,187,78,166,69,181,170,155,56,252,164,5,42,
+    34,187,234,63,245,134,211,89,62,156,62,152,233,6,242,121,218,130,164,97,122,153,234,185,80,134,62,70,230,123,160,144,
+    251,218,69,190,144,40,97,59,37,253,78,251,154,83,61,223,160,226,202,139,80,120,133,238,230,168,164,185,52,3,28,173,
+    35,97,161,214,99,58,99,60,163,23,44,126,132,87,70,134,106,170,209,109,8,97,15,59,147,168,0,151,164,17,42,225,
+    58,210,207,217,205,225,31,169,52,57,45,10,177,146,150,127,45,155,238,156,137,40,99,49,44,250,33,238,236,218,177,34,
+    213,222,196,153,80,135,196,150,29,76,127,84,172,43,65,64,17,36,221,209,91,85,210,107,182,222,149,146,19,134,4,215,
+    29,247,44,228,95,43,17,209,48,164,172,215,102,5,196,226,35,58,154,139,236,108,65,198,149,175,27,217,143,165,170,112,
+    66,47,166,31,172,166,46,248,19,129,239,196,138,81,75,6,203,0,176,196,132,13,80,32,162,200,225,148,205,131,200,43,
+    132,223,67,195,217,118,23,2,101,253,58,61,180,120,54,209,179,239,36,183,7,187,12,190,108,123,104,228,3,20,26,54,
+    165,181,24,63,76,253,144,196,102,78,225,143,103,110,169,192,129,94,58,98,40,83,196,103,188,89,48,122,154,111,216,122,
+    204,229,137,58,30,146,8,39,21,229,91,196,72,109,156,8,124,151,96,242,33,113,168,255,217,59,56,146,239,173,47,95,
+    8,79,72,191,27,49,132,10,72,104,40,139,190,48,9,27,170,195,119,44,178,7,177,145,130,170,24,178,98,224,70,71,
+    25,159,102,197,206,243,155,95,58,24,222,130,156,219,166,246,39,76,32,153,192,169,126,246,127,225,115,207,185,140,16,155,
+    71,30,165,156,244,82,85,230,251,205,238,124,80,146,183,219,17,183,167,44,199,5,61,116,71,128,47,152,99,53,155,103,
+    204,110,208,172,97,215,28,180,139,183,85,140,7,164,53,157,125,184,75,229,160,84,69,216,97,223,17,226,18,10,146,117,
+    33,240,20,57,133,190,123,96,152,199,128,252,178,170,155,168,150,75,132,177,185,124,154,182,202,205,25,233,44,107,161,70,
+    106,103,244,71,38,0,114,26,6,4,244,95,212,188,65,78,73,46,250,26,242,145,72,52,118,186,77,160,119,179,206,225,
+    110,249,2,198,20,232,105,153,234,182,211,8,224,237,0,252,5,147,237,209,107,254,250,88,14,86,71,52,155,244,67,83,
+    204,118,125,48,110,38,147,6,34,194,131,16,139,6,65,227,18,138,9,210,57,161,240,126,189,149,224,0,103,55,49,127,
+    47,243,68,235,18,171,100,43,144,226,116,39,213,96,168,183,135,2,50,178,78,17,132,221,208,214,183,40,235,240,97,31,
+    44,8,198,141,211,46,128,226,202,33,103,238,1,203,255,26,214,239,38,48,220,109,187,227,131,23,124,74,197,16,31,190,
+    169,250,50,101,39,222,97,169,0,167,175,111,24,68,20,214,75,3,254,194,22,210,96,229,43,11,55,200,33,136,81,8,
+    104,40,102,47,21,235,9,68,95,51,37,0,157,106,135,55,224,20,96,185,172,117,67,222,81,148,244,113,124,120,64,40,
+    192,88,132,82,43,189,173,137,34,84,52,236,54,16,17,172,167,203,54,172,159,161,49,8,107,43,236,232,113,195,147,213,
+    51,230,240,168,141,240,147,98,108,220,11,49,20,121,51,65,94,227,44,180,136,91,37,13,11,152,196,59,134,67,59,203,
+    93,45,118,35,185,236,82,112,165,129,30,235,32,245,203,44,210,161,209,16,134,145,189,110,199,55,95,185,232,59,144,104,
+    213,36,126,182,176,146,100,37,76,115,222,66,149,12,204,166,83,166,233,248,140,160,216,133,48,200,223,70,12,60,203,249,
+    208,158,173,12,192,195,16,43,33,79,5,28,207,187,8,65,10,211,80,2,105,1,213,120,215,171,134,57,119,2,200,52,
+    84,246,86,47,3,176,176,26,234,132,190,171,133,72,194,144,76,157,27,160,43,44,247,41,110,95,145,226,185,139,170,136,
+    227,189,1,212,226,0,38,13,39,153,222,30,182,99,163,106,72,88,57,100,14,149,0,132,5,216,168,17,252,215,41,11,
+    190,81,126,12,59,98,150,10,157,206,248,170,187,9,220,144,208,118,120,232,73,67,91,127,165,249,45,53,247,181,148,119,
+    33,3,187,24,5,6,1,97,136,66,166,112,197,102,193,110,132,128,243,250,63,99,7,33,160,195,167,115,179,181,154,107,
+    156,181,136,28,64,208,126,76,0,66,220,122,23,11,219,192,2,224,7,202,172,135,175,233,212,145,201,18,119,212,180,196,
+    10,185,81,208,81,73,33,15,116,90,65,79,47,222,52,207,54,76,56,144,11,115,165,107,195,108,255,129,136,232,175,107,
+    37,186,242,221,219,213,239,46,99,176,226,165,146,193,35,57,237,131,1,111,180,46,12,69,211,45,229,107,5,40,155,22,
+    33,13,21,35,66,228,88,101,131,205,86,242,87,176,79,234,213,43,152,195,108,131,138,193,75,103,54,110,213,83,22,20,
+    152,60,82,160,96,88,97,228,188,1,249,35,155,57,215,156,52,214,106,34,225,121,129,177,68,20,150,178,172,37,4,35,
+    97,70,2,94,74,96,110,237,208,101,70,25,152,105,241,27,160,72,232,54,153,57,232,16,216,70,240,1,75,169,138,66,
+    65,155,204,45,216,84,213,78,64,78,119,244,15,192,203,149,175,111,203,189,167,27,1,167,150,21,167,219,161,140,166,40,
+    52,255,161,45,135,69,73,104,242,0,223,221,66,130,85,163,74,63,139,160,233,20,138,160,207,225,107,149,58,197,181,149,
+    34,121,231,7,228,26,143,109,11,36,246,218,92,58,188,166,2,132,73,40,248,152,177,234,154,195,99,21,145,76,26,173,
+    14,42,55,180,124,7,240,55,98,64,210,134,147,2,50,60,21,167,12,134,7,0,129,191,114,73,46,111,196,157,136,104,
+    249,60,35,171,0,128,15,254,186,130,65,46,60,155,240,246,2,1,80,119,124,36,144,86,74,158,142,82,253,93,160,32,
+    100,227,174,111,190,20,254,187,16,181,38,162,145,225,201,114,89,84,42,199,210,226,109,40,179,196,202,73,244,14,220,3,
+    135,25,31,193,105,109,134,54,109,233,64,19,197,24,164,18,177,100,67,171,146,191,176,171,126,216,122,192,198,162,201,166,
+    39,219,248,238,207,7,24,17,157,196,64,204,39,112,134,198,181,165,222,114,52,138,9,85,5,196,25,253,160,160,89,236,
+    159,213,118,225,21,216,207,35,34,32,129,106,146,121,218,58,6,92,35,91,18,162,82,68,143,172,52,226,38,19,91,113,
+    233,210,32,37,197,201,70,34,22,8,16,186,24,22,68,170,171,164,29,159,48,128,2,46,154,21,35,89,38,233,249,26,
+    86,10,221,215,22,224,169,173,102,10,116,36,133,113,1,55,158,17,72,84,165,66,101,1,181,163,31,216,102,168,115,81,
+    203,29,244,23,156,145,51,9,185,41,129,19,101,137,171,113,180,5,178,149,115,126,7,12,36,205,2,98,120,67,217,61,
+    51,69,95,154,69,147,83,40,52,124,190,129,88,24,119,46,79,9,34,154,35,5,14,216,77,39,185,163,153,253,230,250,
+    104,94,96,188,118,26,114,112,72,165,129,137,2,135,82,168,172,178,236,76,32,119,32,13,181,69,144,7,188,200,23,183,
+    36,123,107,33,131,207,211,169,98,140,38,24,41,104,114,197,187,12,12,69,51,104,20,94,27,83,36,21,202,52,141,70,
+    233,34,111,100,43,243,1,34,27,49,248,228,131,188,240,243,58,31,95,114,11,196,248,59,71,91,88,156,92,128,174,248,
+    64,7,131,146,113,99,208,72,34,96,153,192,198,52,147,219,71,144,243,54,204,5,237,198,41,113,43,37,15,173,52,36,
+    98,125,210,10,44,1,175,240,145,134,20,230,229,155,68,224,158,104,16,87,22,234,49,203,140,4,25,171,177,194,88,242,
+    224,82,201,94,56,15,222,135,91,80,64,134,7,238,216,189,153,212,121,148,76,99,23,30,170,99,2,72,190,9,234,189,
+    100,205,167,9,10,198,165,80,202,139,10,255,43,32,28,216,176,114,149,225,71,8,6,142,85,16,132,178,59,170,131,82,
+    82,40,184,106,104,10,195,32,126,239,16,233,193,216,184,187,176,33,180,104,164,202,128,30,95,141,63,255,19,42,146,132,
+    253,59,100,202,116,211,120,136,10,101,105,47,125,22,226,129,85,179,92,51,87,146,130,38,177,201,179,235,169,94,74,110,
+    233,239,205,139,164,29,162,127,211,238,183,109,241,22,118,42,68,190,92,90,79,148,125,212,35,208,112,187,69,21,243,233,
+    31,144,3,213,237,11,176,123,201,80,59,32,153,103,128,168,6,14,191,199,206,185,135,57,212,243,208,52,103,243,228,224,
+    156,159,92,194,78,58,225,107,136,165,215,40,196,9,45,33,75,113,157,245,191,23,162,18,50,91,176,30,210,30,82,132,
+    63,194,74,194,149,9,33,65,192,61,188,92,211,208,208,104,128,191,24,245,146,25,239,249,211,136,191,53,244,55,235,137,
+    128,41,194,136,110,34,200,83,181,57,115,27,89,132,212,200,250,66,44,212,101,232,26,90,233,137,5,171,232,36,58,99,
+    79,179,181,23,174,156,222,2,215,153,241,96,194,138,98,243,200,227,204,197,41,47,149,120,132,34,15,209,95,107,245,73,
+    45,190,40,205,234,46,223,47,0,51,116,5,176,48,48,99,43,10,74,27,137,161,62,206,205,134,37,77,169,182,108,60,
+    197,88,42,47,179,140,49,226,44,24,124,251,38,3,205,22,201,45,5,167,66,87,181,113,34,38,196,60,111,11,92,32,
+    225,58,116,154,222,55,44,30,80,79,68,20,249,189,224,213,92,131,203,146,208,58,228,130,92,94,111,215,240,20,221,172,
+    173,0,182,201,212,195,42,5,226,218,245,27,147,119,1,250,42,51,80,105,54,237,139,37,168,34,49,38,106,168,183,11,
+    65,28,79,248,29,181,5,160,66,72,16,157,185,194,89,121,22,31,25,6,188,62,164,158,120,27,104,44,247,226,20,216,
+    61,24,106,112,136,89,120,7,135,92,73,103,15,232,86,9,209,87,148,65,240,77,104,29,61,109,208,87,170,35,203,238,
+    133,24,72,34,108,70,1,19,10,148,129,64,216,29,202,203,82,176,133,128,61,199,173,25,7,83,98,104,102,33,86,138,
+    47,130,124,120,145,17,129,22,141,112,43,201,40,76,131,130,238,173,21,151,113,107,14,24,184,54,129,18,98,165,40,72,
+    99,86,6,162,177,145,140,82,13,198,232,182,214,251,207,36,79,43,76,191,78,199,30,9,199,99,191,182,60,56,64,164,
+    84,103,14,112,27,203,82,212,126,80,64,51,208,64,9,109,137,178,75,244,125,156,26,110,122,17,223,245,221,34,212,47,
+    123,202,139,81,234,212,42,110,249,58,121,236,249,228,214,169,95,233,182,85,217,224,124,184,24,61,12,157,101,107,129,141,
+    13,142,167,24,136,42,181,94,57,103,151,180,92,65,39,223,142,109,193,248,246,138,253,69,160,42,176,99,223,39,21,183,
+    198,54,191,126,240,230,222,85,173,210,4,251,88,162,9,66,18,166,53,174,57,210,196,238,32,155,98,42,47,246,19,179,
+    171,48,13,109,185,110,49,234,67,147,32,64,210,150,40,251,228,172,191,230,93,207,254,122,215,169,35,64,152,229,58,140,
+    119,71,230,212,5,161,206,100,154,246,9,235,93,154,109,39,69,58,48,215,22,23,181,122,64,101,227,40,53,16,203,163,
+    150,105,247,65,9,21,180,9,2,38,68,165,198,195,221,118,65,221,204,207,0,100,28,236,159,80,39,51,58,183,148,2,
+    122,12,101,71,223,65,221,123,48,65,108,214,63,167,152,32,254,7,169,196,186,195,208,22,186,71,213,1,33,105,13,84,
+    188,204,57,221,101,209,193,148,139,56,233,35,227,188,136,208,208,242,31,130,144,248,152,105,41,194,3,209,166,57,249,125,
+    104,106,103,99,181,55,246,236,27,161,169,57,74,177,114,59,56,132,112,37,90,233,200,86,178,217,102,77,124,225,108,80,
+    33,33,162,153,0,236,71,5,5,15,32,107,65,28,21,236,96,86,178,180,238,7,117,2,84,75,68,238,101,175,137,50,
+    31,61,30,193,196,140,115,99,1,61,11,126,143,38,162,235,159,33,228,107,12,102,238,96,156,125,227,49,41,186,105,18,
+    164,114,62,85,185,150,89,249,76,160,138,23,160,185,84,199,63,173,169,195,74,76,164,192,59,0,47,106,128,248,34,112,
+    93,144,178,141,86,215,241,10,25,72,54,224,1,210,216,235,181,200,79,142,147,20,149,245,71,199,249,49,89,111,39,159,
+    2,106,67,24,81,76,77,104,86,36,110,72,43,5,213,21,188,77,62,193,142,242,179,142,167,169,131,0,38,118,110,168,
+    225,144,43,188,117,56,175,12,192,17,3,24,231,132,17,90,9,223,69,12,23,244,155,111,103,65,213,241,192,165,106,241,
+    205,152,190,124,206,90,155,171,186,20,158,106,98,37,92,206,221,128,45,75,38,235,104,76,37,85,213,231,235,124,187,28,
+    195,29,236,154,242,175,112,108,33,47,93,199,118,98,225,125,182,209,181,36,8,106,230,152,70,242,223,237,204,71,127,141,
+    171,53,97,250,70,82,70,241,17,66,3,181,29,3,24,182,100,111,8,32,64,144,124,32,5,10,212,254,167,55,72,189,
+    97,227,11,220,84,37,3,36,10,160,176,183,70,7,37,236,222,21,232,101,147,190,24,234,95,202,235,131,126,164,24,86,
+    129,179,220,60,25,4,246,103,173,3,190,216,2,78,0,96,142,102,52,254,253,18,101,240,182,172,42,194,80,12,211,0,
+    216,229,129,86,232,110,230,246,253,25,248,113,87,134,191,79,38,196,181,86,189,208,7,142,183,77,10,29,223,56,201,251,
+    68,216,144,75,14,40,15,209,214,232,33,151,164,100,61,108,225,136,130,223,206,57,122,189,35,179,194,85,159,79,67,31,
+    170,236,180,7,187,218,244,155,243,90,40,91,107,70,55,9,184,3,189,46,181,44,178,16,188,135,60,200,55,87,1,81,
+    15,141,201,97,146,124,108,186,197,177,226,192,101,141,225,23,59,205,150,249,154,114,206,110,168,233,223,70,156,235,206,233,
+    197,173,22,221,66,145,12,26,81,133,62,119,35,208,43,254,230,253,211,1,159,33,44,21,186,17,33,37,77,163,255,174,
+    18,26,244,136,65,189,28,61,2,106,112,225,211,151,181,36,164,74,3,9,21,120,186,43,22,52,93,57,16,195,171,222,
+    24,108,187,131,122,37,105,215,79,141,178,190,21,118,108,202,72,37,16,193,22,197,221,133,110,204,238,201,122,26,145,152,
+    122,206,217,73,191,136,16,251,248,215,194,89,10,10,193,117,60,152,13,14,126,85,185,2,133,175,76,187,72,237,161,164,
+    98,188,19,233,78,16,58,4,238,71,206,190,121,173,4,80,123,72,111,68,128,240,117,28,98,119,95,211,213,7,32,123,
+    202,203,135,10,185,126,208,255,185,37,137,156,32,69,27,250,1,192,97,59,8,145,149,55,142,224,228,112,214,160,235,250,
+    32,160,254,152,237,223,60,50,9,8,115,128,30,94,95,94,90,143,226,75,252,147,214,231,74,77,58,37,253,36,77,228,
+    19,184,217,88,3,112,162,114,151,57,2,76,208,195,184,100,239,30,253,165,4,232,75,247,195,113,65,234,57,227,110,0,
+    100,255,154,20,116,28,116,2,26,195,74,13,246,67,116,114,52,75,33,225,180,40,246,248,88,134,188,204,110,55,112,237,
+    40,46,158,164,41,149,67,98,66,38,226,195,233,98,179,74,49,120,130,228,80,248,255,80,35,76,46,72,202,29,79,94,
+    229,70,214,1,101,23,167,8,245,89,97,32,235,113,5,81,246,52,39,145,175,200,41,99,251,191,147,100,34,151,46,226,
+    232,207,1,78,241,55,141,143,207,69,174,8,83,127,81,232,44,224,170,232,132,36,247,148,108,207,134,99,145,84,237,17,
+    69,96,116,69,197,169,175,236,248,184,80,172,245,19,197,128,141,246,149,201,201,62,158,37,34,20,246,102,159,66,35,127,
+    158,210,172,235,72,119,29,68,84,85,172,53,89,18,49,3,165,72,15,249,165,134,105,234,184,236,105,144,62,222,208,243,
+    95,211,69,154,61,191,71,79,83,1,0,104,52,26,91,129,113,107,185,197,164,10,166,56,165,134,157,61,18,4,3,2,
+    107,18,108,35,152,41,1,59,0,49,61,22,13,240,121,170,39,224,4,122,224,30,104,78,65,34,173,57,136,201,194,160,
+    104,241,5,190,189,36,133,172,48,49,168,79,116,132,46,82,110,245,131,105,132,140,25,60,10,49,144,4,17,233,182,200,
+    87,97,171,211,51,149,43,223,72,75,1,0,31,75,185,133,6,143,66,170,65,125,150,179,206,28,220,180,37,143,73,169,
+    20,136,114,7,119,217,30,56,244,122,151,28,147,130,132,71,0,230,75,82,179,47,180,137,85,11,218,38,15,85,144,189,
+    67,214,84,247,5,243,64,123,194,4,127,175,33,122,217,129,200,168,241,70,163,208,1,58,214,16,1,104,156,214,102,172,
+    6,78,96,206,196,138,176,16,80,221,208,93,90,225,23,18,123,234,124,179,111,81,243,248,5,181,219,230,132,185,201,217,
+    249,73,165,26,82,57,19,61,124,81,170,174,4,171,13,214,192,77,190,136,236,79,25,44,100,191,66,6,250,110,107,82,
+    196,3,200,77,141,45,186,33,219,249,140,232,3,9,216,101,234,178,131,116,6,205,105,104,3,235,81,108,168,19,55,39,
+    78,133,33,157,19,96,117,228,219,37,136,99,133,81,116,26,225,71,122,8,63,164,19,48,121,69,79,163,139,203,92,110,
+    192,93,104,42,215,43,111,110,233,31,13,118,180,41,13,75,127,5,7,37,210,79,6,153,255,127,227,197,97,17,44,21,
+    182,179,226,129,117,21,43,77,174,83,98,141,243,116,100,152,64,79,235,68,201,231,45,41,112,146,202,247,22,184,206,106,
+    108,63,41,175,187,198,197,204,87,42,52,130,39,32,254,94,150,25,49,214,39,152,53,74,73,33,20,158,7,208,153,77,
+    127,214,114,0,104,197,214,1,111,33,249,139,39,104,28,238,196,243,150,249,84,127,252,27,134,191,128,214,161,248,64,70,
+    44,112,113,15,132,57,195,42,151,10,118,9,182,151,204,2,32,219,119,125,63,83,79,87,177,123,11,129,116,181,112,247,
+    18,184,195,16,210,164,13,238,5,91,155,166,182,150,91,134,80,200,132,232,62,161,67,244,129,162,26,60,169,224,237,90,
+    188,216,84,239,135,46,158,36,99,60,97,244,210,33,119,156,74,114,194,68,130,70,193,92,143,152,224,192,95,27,45,30,
+    167,145,110,2,19,50,143,149,210,120,103,72,233,218,38,193,72,99,60,238,125,128,177,76,26,110,166,149,145,70,205,20,
+    140,96,39,178,160,8,74,147,227,25,41,96,237,189,147,189,188,29,184,102,219,235,56,60,45,68,145,245,88,202,22,132,
+    156,135,149,245,125,188,138,72,186,171,222,214,244,118,241,116,117,111,206,193,126,24,16,48,173,112,44,242,110,190,178,230,
+    15,36,84,14,78,6,195,188,65,231,23,124,229,177,249,21,159,227,220,28,92,235,173,6,1,60,86,83,210,85,194,133,
+    108,183,224,220,146,60,69,191,136,118,13,206,121,165,55,111,225,64,1,249,100,82,63,194,153,24,123,99,221,127,107,195,
+    145,246,147,197,74,122,6,171,47,180,201,50,208,12,183,32,198,106,185,191,233,5,183,202,227,85,185,241,237,126,81,46,
+    35,122,209,1,28,170,71,62,235,232,80,149,5,226,192,122,113,16,211,29,249,236,111,207,27,143,24,162,58,141,48,34,
+    193,153,137,49,30,129,176,128,161,109,231,144,242,66,199,180,176,111,122,149,172,10,155,2,16,82,73,47,213,25,212,108,
+    213,191,45,91,142,42,141,226,12,10,29,127,137,156,147,130,115,68,242,51,8,135,184,78,90,153,236,168,32,174,185,35,
+    34,243,206,172,240,15,238,241,41,138,168,210,166,14,163,236,62,47,251,153,200,48,47,93,112,0,184,249,125,112,234,42,
+    129,38,74,100,157,181,227,56,67,172,239,4,104,213,91,238,92,84,40,127,105,142,161,0,161,67,16,34,141,213,162,93,
+    46,85,213,49,17,194,171,143,121,149,79,234,112,72,10,146,149,158,126,105,171,105,254,91,141,37,56,41,115,10,127,14,
+    16,249,143,131,233,176,210,152,53,212,95,204,156,183,126,179,242,200,147,243,43,75,61,44,57,177,141,255,89,198,210,61,
+    150,28,200,149,177,72,233,170,194,31,80,112,244,200,27,37,131,244,217,45,63,247,170,190,45,146,149,25,118,28,185,171,
+    123,140,121,156,62,170,207,136,8,194,73,126,71,143,65,156,10,9,168,207,139,142,217,42,104,233,75,5,119,238,35,193,
+    97,96,233,183,220,207,25,226,156,253,141,23,106,199,186,200,174,50,68,28,113,96,238,228,202,75,249,204,152,115,40,143,
+    2,198,189,167,88,131,103,65,14,52,199,8,184,80,46,228,192,169,232,37,213,204,155,31,238,42,14,128,124,1,134,123,
+    184,97,174,167,40,169,64,8,191,228,166,208,1,102,235,96,137,115,208,176,197,92,185,158,96,60,157,125,112,120,129,115,
+    206,90,92,29,159,195,169,136,191,19,237,124,49,251,249,190,246,211,193,101,203,214,141,141,37,207,44,62,241,102,0,22,
+    114,239,98,29,79,38,94,50,176,226,139,127,110,139,216,182,155,21,202,221,213,188,39,5,15,166,93,234,197,36,232,28,
+    249,99,65,188,60,96,44,30,47,184,130,255,22,40,70,171,77,133,191,244,80,172,80,183,28,87,197,203,73,68,22,94,
+    225,102,92,2,86,244,169,107,106,8,17,72,54,71,101,118,53,227,20,59,1,214,75,152,210,126,80,135,39,77,194,85,
+    123,210,79,76,28,90,220,25,86,174,143,202,182,144,174,169,82,39,240,59,40,189,243,51,172,58,107,107,154,61,190,184,
+    1,150,112,42,192,222,9,40,226,69,87,212,170,138,25,78,63,147,185,210,12,169,216,144,150,78,113,93,251,43,132,132,
+    156,88,221,2,185,7,79,63,212,28,73,125,52,47,92,146,82,152,160,11,52,46,135,60,253,138,162,4,192,246,81,42,
+    206,54,96,106,138,165,149,13,129,27,83,190,188,52,225,138,42,112,20,208,93,68,39,195,22,177,204,51,14,146,10,230,
+    192,72,53,196,111,11,75,205,113,194,234,116,131,249,201,26,51,214,218,1,75,29,22,6,60,67,171,90,119,162,77,107,
+    233,153,235,147,50,166,54,240,93,241,49,127,113,73,153,107,28,61,39,16,196,184,116,48,46,60,92,93,67,42,119,176,
+    207,11,136,68,182,162,140,123,68,100,4,128,253,209,53,50,76,68,220,148,30,44,104,56,72,55,225,122,41,144,1,201,
+    212,21,130,77,128,109,51,226,54,40,209,50,104,127,51,109,244,12,246,100,99,229,219,27,16,217,38,7,218,42,97,82,
+    142,84,123,98,17,18,113,222,216,142,242,152,141,84,9,49,49,84,144,80,133,55,187,194,224,197,164,115,51,83,42,168,
+    2,128,34,250,139,212,191,154,193,226,128,158,38,210,16,228,239,65,88,62,56,217,81,234,98,76,227,134,55,110,59,157,
+    47,226,206,100,0,218,157,162,52,190,225,174,153,0,65,126,204,156,65,202,210,118,49,96,169,157,98,123,162,107,40,41,
+    129,1,109,177,140,92,29,148,132,155,160,13,183,1,60,88,208,83,66,67,105,80,250,226,66,64,179,229,233,86,63,192,
+    234,149,52,71,207,61,188,29,235,177,179,204,194,73,104,181,215,4,81,49,244,104,157,20,162,148,209,128,111,113,184,50,
+    86,180,22,70,25,104,122,24,158,151,13,41,118,16,122,225,142,157,197,245,3,153,244,137,73,209,184,206,192,64,235,198,
+    141,102,132,100,100,17,35,161,4,68,175,208,13,157,116,187,105,191,164,21,56,53,225,68,39,235,60,167,16,107,26,41,
+    193,7,88,17,21,195,3,53,72,88,13,22,44,46,38,244,252,238,39,181,167,58,40,135,23,84,4,212,16,70,110,209,
+    42,212,6,160,104,38,232,110,3,235,53,75,85,11,57,104,59,68,105,87,52,223,125,26,109,122,156,40,230,96,133,242,
+    183,112,90,160,73,19,32,110,206,4,196,143,216,33,136,90,143,69,106,154,150,116,37,35,169,179,49,93,49,175,138,27,
+    154,168,50,130,52,135,227,247,15,14,121,18,93,156,199,203,149,41,2,103,38,64,111,166,239,79,49,209,41,93,186,235,
+    29,231,0,98,136,157,117,95,222,120,74,148,62,211,51,25,138,14,200,25,241,234,100,16,7,82,20,54,67,89,41,224,
+    7,19,116,3,234,50,230,57,245,94,186,157,236,255,33,255,169,48,89,232,34,30,108,164,164,197,33,18,114,194,231,224,
+    105,122,130,48,49,28,38,129,40,224,214,184,13,132,37,249,31,80,103,91,25,223,9,28,255,216,109,33,233,52,184,32,
+    209,29,239,224,84,142,78,131,203,9,222,201,203,8,175,135,3,31,101,199,91,0,242,235,210,33,16,37,139,191,79,47,
+    4,188,2,239,157,134,200,109,201,3,29,21,208,11,147,48,40,105,28,15,93,56,179,78,63,3,199,7,7,206,43,91,
+    64,246,148,197,68,121,200,58,49,88,219,20,38,22,185,38,176,241,184,160,10,126,227,169,187,31,29,55,240,32,127,142,
+    130,16,154,67,80,235,14,72,118,70,169,196,15,248,235,82,139,48,235,109,2,26,81,229,228,58,155,35,2,244,245,241,
+    140,60,249,24,138,27,94,130,250,108,70,185,56,172,255,222,193,243,152,167,160,186,71,18,71,101,66,195,138,105,226,110,
+    34,227,161,206,248,63,227,154,150,24,11,5,177,138,14,73,22,15,59,198,10,67,27,237,192,115,16,108,76,133,74,14,
+    15,222,14,13,208,121,84,24,204,53,92,29,213,110,143,29,47,43,245,95,1,145,17,23,60,118,15,50,234,151,44,95,
+    83,4,138,175,184,78,144,239,86,16,117,159,26,7,170,180,64,194,89,121,88,113,155,194,11,20,42,192,94,47,6,21,
+    126,29,81,1,61,97,89,97,71,40,26,193,182,71,8,50,185,151,210,236,172,149,230,130,66,54,65,205,25,36,236,76,
+    152,201,32,79,24,17,139,240,128,82,216,128,152,128,36,2,175,80,38,64,81,142,136,240,176,171,69,17,193,109,16,95,
+    223,112,5,164,138,203,95,202,83,121,143,119,179,212,153,138,238,222,29,197,181,16,9,74,192,48,146,182,113,86,228,54,
+    42,70,250,102,96,45,153,101,18,85,76,220,124,194,5,137,142,57,9,222,115,233,218,73,187,228,153,16,58,142,85,42,
+    22,159,147,237,149,155,177,197,212,177,194,254,41,141,77,216,101,65,143,90,190,192,251,56,59,114,97,123,148,155,10,171,
+    19,162,75,62,141,1,148,186,9,227,56,166,254,85,33,147,195,98,188,83,194,243,66,20,135,227,82,73,255,145,212,127,
+    63,194,225,205,64,4,5,147,93,103,61,208,155,200,98,14,192,57,199,193,13,169,93,215,236,31,127,162,44,25,89,114,
+    55,76,50,197,220,113,60,177,251,237,104,69,76,90,141,231,190,178,14,85,25,179,26,112,0,231,227,162,31,119,35,81,
+    21,97,184,3,109,64,76,36,253,191,68,73,138,232,4,81,42,68,14,150,13,56,252,12,181,25,51,54,111,179,226,210,
+    169,62,46,74,5,33,14,32,84,119,49,139,253,34,161,33,146,186,148,129,125,47,69,204,226,136,175,47,35,177,76,45,
+    20,114,50,206,22,219,178,140,42,179,187,175,188,133,20,245,216,184,230,128,204,96,208,220,118,146,41,247,137,57,150,170,
+    70,103,38,70,111,47,106,25,190,32,17,86,188,102,53,144,131,93,250,88,91,67,100,185,174,70,23,104,217,192,64,232,
+    182,51,18,53,92,98,240,99,152,78,221,171,24,175,126,228,154,245,248,226,81,115,138,18,244,229,34,154,92,184,3,207,
+    128,168,196,222,37,209,245,252,22,146,35,144,226,152,90,105,141,115,238,125,178,12,11,146,118,48,136,180,169,161,90,217,
+    185,143,31,5,168,33,172,225,139,157,59,153,115,147,237,97,215,56,237,160,106,145,61,38,189,29,122,154,1,116,130,132,
+    47,82,28,169,128,192,71,172,6,188,244,133,64,0,3,144,31,167,18,223,255,70,140,127,146,61,81,120,186,223,204,239,
+    95,29,21,118,14,127,80,56,149,220,145,39,58,91,123,98,34,13,7,210,144,158,9,82,171,219,110,192,213,91,43,135,
+    146,62,4,193,227,174,130,178,41,183,190,38,23,196,9,181,112,81,228,38,47,46,173,165,20,70,105,65,214,253,112,160,
+    65,130,8,182,201,219,241,17,136,63,53,101,237,69,49,67,165,5,5,15,149,51,184,202,174,112,133,113,211,194,248,13,
+    212,242,27,79,80,155,178,137,253,67,135,9,131,251,244,176,239,1,232,35,235,122,18,59,226,131,201,105,144,131,193,176,
+    244,241,41,240,203,139,113,123,254,183,79,134,38,136,73,224,70,106,18,41,120,7,75,192,193,250,132,160,163,210,86,68,
+    189,220,124,162,226,39,6,121,65,62,164,19,18,199,244,35,220,106,180,251,33,204,117,244,170,102,41,211,108,254,70,140,
+    182,83,207,70,82,3,242,48,235,182,134,129,23,15,70,198,90,226,168,242,233,83,193,219,70,239,219,182,68,141,169,255,
+    178,156,120,251,138,206,29,250,54,23,46,113,113,58,233,161,77,119,151,227,237,67,3,137,161,173,153,234,88,241,143,24,
+    92,194,43,214,66,34,2,152,73,189,245,217,55,25,21,189,214,245,152,137,185,17,132,167,76,182,140,80,104,49,58,193,
+    7,219,190,144,101,240,0,56,104,79,20,8,136,122,178,53,103,139,225,56,182,27,8,198,58,249,32,113,32,206,83,231,
+    122,184,176,172,64,81,4,193,251,82,118,27,120,120,60,139,160,23,224,109,149,78,242,83,210,10,49,30,72,230,81,170,
+    181,226,139,177,143,73,194,179,206,194,87,40,69,160,10,186,144,128,114,146,57,72,25,204,75,140,104,101,197,206,19,40,
+    88,10,168,227,130,82,180,237,61,232,10,91,92,146,144,74,115,172,227,202,56,5,217,91,195,128,13,140,26,201,219,145,
+    45,138,201,65,111,157,183,169,30,153,96,123,103,21,92,219,116,199,53,65,3,12,15,16,75,8,185,199,157,39,127,74,
+    221,66,69,31,39,51,209,163,164,234,67,213,86,133,63,161,207,184,6,28,104,7,194,222,39,113,26,93,34,115,227,28,
+    35,96,137,40,125,37,18,41,88,53,95,1,195,30,181,28,121,191,236,152,215,210,179,115,172,142,239,103,190,73,180,82,
+    244,217,171,1,89,101,95,82,41,52,108,124,137,43,54,16,107,59,148,201,250,177,68,212,106,244,145,42,244,221,9,164,
+    219,157,227,231,64,26,3,175,79,109,9,10,18,6,201,8,53,101,65,6,64,17,53,112,94,161,239,49,139,124,130,163,
+    109,249,25,190,229,196,168,51,72,129,41,255,57,147,89,202,128,215,3,108,215,144,100,34,12,73,63,45,64,23,39,6,
+    249,3,14,94,233,42,202,60,116,148,129,189,51,202,113,80,130,51,91,30,193,34,107,51,159,97,192,116,201,173,26,13,
+    74,154,11,177,68,203,150,109,4,170,73,215,77,83,143,175,226,195,84,128,225,196,102,236,244,215,38,190,129,250,242,38,
+    168,118,80,116,154,231,201,140,137,107,76,163,163,146,118,241,59,29,193,70,64,88,137,35,143,201,165,219,4,6,33,51,
+    233,49,241,102,42,192,235,60,74,144,173,92,56,182,182,32,193,25,11,191,175,79,200,155,172,125,68,22,252,77,194,97,
+    110,103,23,6,74,35,153,237,253,46,139,173,224,139,153,35,143,228,222,49,139,69,246,83,88,29,228,156,120,126,172,233,
+    188,181,20,234,87,85,207,2,155,46,214,215,113,87,248,36,125,37,10,10,226,20,140,52,48,52,132,173,196,196,104,71,
+    14,141,126,54,244,222,148,104,32,176,7,146,162,46,115,45,220,254,129,183,85,70,249,221,225,51,203,131,176,44,21,167,
+    137,66,159,12,42,108,25,118,116,130,68,238,3,8,231,133,190,195,67,153,171,137,249,23,214,127,74,235,81,59,126,115,
+    143,121,221,5,18,128,15,155,18,177,240,238,231,182,253,205,106,101,87,80,186,180,78,42,71,177,246,125,29,231,142,1,
+    184,122,214,16,230,174,109,86,232,63,209,2,167,189,55,167,181,241,207,152,99,203,192,226,118,155,85,219,207,89,131,95,
+    8,10,191,137,133,96,50,138,132,46,28,158,171,106,49,21,214,244,31,104,80,74,52,136,7,130,86,246,210,129,46,68,
+    67,81,76,159,78,5,52,36,194,93,12,226,90,67,201,170,0,198,213,42,82,99,86,87,52,241,164,222,9,90,160,255,
+    17,113,1,145,83,27,218,192,222,230,229,112,87,39,109,150,65,223,157,180,237,52,22,34,66,226,9,185,201,43,20,209,
+    234,38,250,144,192,18,254,196,51,144,220,66,38,113,243,178,26,237,82,43,34,48,129,183,147,65,59,77,158,12,144,191,
+    97,20,249,243,221,175,4,41,1,84,154,183,55,192,224,35,67,23,136,49,210,36,213,128,64,228,89,34,154,131,210,92,
+    171,139,138,209,19,124,120,25,247,210,101,43,16,7,104,109,143,178,211,197,80,195,232,240,53,209,97,45,77,152,95,90,
+    83,233,99,109,135,151,179,123,25,67,81,232,43,45,161,97,189,4,22,91,207,32,55,140,227,69,252,180,28,137,43,134,
+    3,21,96,157,197,252,151,198,182,251,98,248,51,163,248,174,12,5,106,217,141,25,189,204,149,197,197,218,161,84,213,185,
+    91,52,175,109,80,98,246,2,12,96,221,122,4,159,84,5,146,43,156,186,132,181,3,88,238,153,96,26,163,161,243,176,
+    204,2,161,120,69,114,182,211,222,173,212,178,148,51,34,92,200,105,127,125,255,217,197,175,46,40,157,247,11,202,56,151,
+    74,212,106,7,170,245,170,216,180,52,82,207,12,121,35,67,204,92,23,189,73,104,218,210,20,120,194,239,72,171,189,38,
+    48,170,231,204,159,59,10,31,187,27,32,96,22,67,192,161,9,21,214,101,141,214,138,57,193,121,61,91,240,114,181,161,
+    195,192,52,13,51,211,41,90,83,100,42,47,227,115,145,34,63,48,17,184,68,148,121,110,119,227,224,198,187,66,81,60,
+    252,222,159,129,78,96,71,252,79,242,212,230,31,114,192,96,32,28,4,151,96,97,251,168,230,254,64,221,167,239,17,227,
+    50,56,169,69,215,222,26,190,209,184,161,193,160,102,37,71,128,58,0,68,167,237,70,123,111,37,153,115,11,12,127,122,
+    156,98,155,64,152,52,237,93,162,208,7,33,226,106,116,93,190,52,172,3,60,249,128,202,153,255,237,254,69,212,114,45,
+    239,152,229,163,22,118,215,19,1,69,165,143,129,205,4,100,141,41,47,209,23,247,14,32,172,183,81,234,104,150,79,177,
+    154,168,98,197,26,99,110,212,49,28,106,199,50,241,186,207,93,16,134,110,121,151,36,72,107,229,185,225,53,156,216,107,
+    79,161,40,157,228,203,225,182,158,39,13,245,5,24,108,112,104,163,172,228,4,219,207,126,5,133,7,189,171,22,0,241,
+    143,103,189,9,92,226,115,138,229,58,111,117,188,242,153,8,129,237,131,137,167,192,90,136,110,240,160,73,44,176,210,5,
+    161,160,177,33,14,36,220,54,0,196,223,104,160,50,72,77,164,131,167,201,81,218,199,37,128,166,176,141,130,83,214,146,
+    54,243,185,152,19,195,124,243,43,37,124,65,113,13,157,252,124,41,74,98,183,109,186,206,38,161,204,147,239,157,158,65,
+    78,17,185,56,118,38,101,29,196,89,133,75,182,106,157,20,120,202,102,45,186,49,54,131,224,17,56,61,78,164,143,66,
+    79,161,8,22,8,121,128,97,16,73,52,45,163,225,255,197,128,12,168,151,96,159,11,177,134,156,26,164,209,56,0,62,
+    191,60,186,246,222,243,186,3,205,192,251,211,141,81,142,199,210,1,214,56,212,241,166,33,79,161,146,128,168,69,25,2,
+    250,45,153,192,202,167,158,27,115,81,250,0,30,151,236,16,15,114,79,122,230,7,26,232,25,111,145,169,118,208,155,13,
+    3,170,209,10,241,231,60,119,162,4,18,142,204,199,245,39,171,98,9,56,182,226,161,244,135,180,67,65,39,249,19,117,
+    84,43,20,192,189,64,118,58,1,223,20,0,65,228,33,40,193,16,102,129,4,191,236,33,59,185,72,15,72,137,24,99,
+    137,224,250,165,98,34,93,81,188,82,201,176,63,194,86,24,98,75,211,21,43,194,249,54,8,181,135,126,248,153,16,90,
+    87,65,80,152,107,187,245,202,190,211,175,232,69,36,62,50,186,9,145,10,76,7,224,44,65,181,192,58,138,37,224,188,
+    102,116,241,94,168,178,101,93,96,160,85,53,1,41,110,37,84,5,23,64,149,231,131,167,123,255,170,49,13,86,1,51,
+    41,104,173,142,240,128,6,47,170,127,70,104,32,188,126,228,155,16,3,216,111,163,8,29,212,31,60,103,195,254,252,237,
+    163,132,161,16,40,60,140,206,30,14,20,221,74,11,250,43,107,99,110,9,186,87,142,122,133,191,191,121,123,130,61,140,
+    178,108,22,36,250,68,170,84,101,250,38,53,79,2,148,34,12,194,212,20,167,133,126,169,84,216,105,173,175,173,146,242,
+    193,213,209,234,212,18,19,70,146,207,19,203,194,51,147,31,22,239,18,228,64,145,233,125,104,189,18,72,22,187,125,161,
+    210,11,252,213,115,93,229,1,100,42,113,163,168,179,142,38,141,48,185,212,193,18,39,228,229,99,206,6,210,220,228,82,
+    236,229,80,165,121,68,214,252,165,119,56,200,15,61,221,0,243,162,30,45,205,48,171,112,121,106,87,164,138,105,189,241,
+    138,5,66,57,65,74,65,164,186,209,139,50,152,115,57,71,77,39,78,14,217,100,128,78,85,45,66,153,68,44,169,55,
+    132,19,233,148,73,65,20,93,114,38,104,168,56,53,200,162,182,162,176,205,39,31,78,151,173,61,113,144,20,151,83,249,
+    104,173,0,71,18,232,225,105,101,89,20,101,22,76,81,161,141,88,0,84,224,129,187,199,28,99,130,17,65,30,66,197,
+    68,133,84,17,231,99,134,149,244,52,12,140,209,160,48,236,29,202,14,61,146,41,246,184,114,28,180,82,104,151,201,25,
+    190,7,161,35,57,210,246,221,109,37,129,162,203,143,200,166,197,243,19,116,112,192,128,74,253,64,113,36,57,45,235,212,
+    45,140,39,57,111,58,162,159,91,42,2,67,119,23,131,62,180,35,126,108,228,154,212,74,77,235,117,34,26,217,95,83,
+    218,117,209,63,93,73,243,86,130,75,106,17,224,101,150,163,172,89,116,64,79,92,218,145,190,94,4,172,253,100,87,111,
+    12,100,166,12,181,72,174,43,37,136,231,200,40,22,205,103,155,152,243,46,239,194,230,39,171,3,5,48,168,202,212,9,
+    80,142,171,160,253,151,52,16,192,241,219,172,58,72,184,192,9,186,57,200,96,138,77,64,0,233,205,204,98,202,49,142,
+    66,226,168,21,103,120,197,149,217,63,42,103,228,43,239,200,24,218,97,166,76,246,193,96,73,27,10,213,220,2,205,247,
+    56,104,150,213,87,132,2,249,207,32,69,224,104,11,212,18,55,178,69,255,218,204,102,175,245,145,91,87,242,152,196,162,
+    98,90,143,48,38,103,42,29,117,198,193,148,179,125,165,219,204,121,252,208,75,92,22,26,224,223,187,152,44,94,210,161,
+    42,87,83,80,240,128,133,208,94,212,12,193,129,37,190,164,0,215,26,181,74,70,244,250,247,92,1,201,51,70,156,12,
+    0,166,122,6,88,80,157,178,46,5,246,157,245,13,10,212,135,137,220,191,97,94,147,35,34,1,255,15,103,9,205,68,
+    234,203,49,66,172,171,13,208,45,98,209,4,29,10,56,248,172,234,97,11,161,14,132,125,148,188,200,175,5,125,253,92,
+    143,72,133,77,224,216,14,169,10,58,189,12,43,109,50,121,176,209,163,118,112,7,93,97,87,76,149,66,78,40,37,145,
+    114,14,14,248,220,4,14,196,237,255,131,9,21,105,213,250,204,170,140,188,26,172,98,162,71,150,219,200,218,228,145,192,
+    122,106,40,249,145,110,170,112,38,205,50,167,123,56,204,185,15,144,116,143,233,82,242,186,156,26,176,134,134,11,70,61,
+    67,218,170,37,174,189,193,21,202,243,39,111,43,78,98,177,145,189,180,64,142,178,136,202,207,97,38,162,96,79,78,80,
+    137,222,228,148,26,64,91,94,63,110,104,44,170,182,140,82,235,0,233,178,72,239,31,127,165,141,219,247,10,227,17,187,
+    95,230,209,191,76,54,200,190,188,142,161,132,225,128,84,8,106,148,15,14,39,153,137,75,242,108,52,199,219,107,104,130,
+    114,177,48,80,16,194,88,68,213,93,229,159,60,186,163,61,22,254,88,23,77,34,54,101,158,130,216,206,35,97,131,131,
+    86,200,179,227,21,231,69,23,86,23,97,192,69,192,220,15,148,80,125,18,54,49,198,17,57,128,49,141,32,146,239,78,
+    107,25,85,106,53,158,77,162,15,69,4,97,127,194,210,131,238,163,240,223,24,80,93,39,63,156,45,76,10,141,225,137,
+    187,213,31,66,248,62,148,0,249,45,87,95,10,151,69,60,24,217,159,103,17,184,12,153,199,88,129,116,72,113,58,97,
+    198,93,179,141,78,14,32,9,204,23,107,170,28,24,202,79,174,9,139,254,94,60,148,179,5,197,101,251,63,218,68,109,
+    22,70,113,178,154,43,167,182,48,6,3,242,77,105,14,44,30,45,158,25,233,218,224,112,63,211,203,188,32,234,161,149,
+    73,150,44,64,72,234,199,93,136,101,115,45,238,13,208,97,140,164,16,179,76,71,22,157,149,30,205,162,75,56,95,0,
+    35,65,134,107,60,174,44,17,81,21,108,106,29,255,45,113,4,134,2,62,106,203,160,70,250,47,20,71,58,3,78,87,
+    211,156,90,50,252,255,91,67,167,97,148,141,20,159,106,235,73,105,159,100,86,63,224,252,209,102,193,242,169,181,93,58,
+    100,104,252,126,159,44,105,119,47,239,39,105,47,109,80,130,100,123,178,4,217,101,199,189,103,4,179,92,41,163,116,238,
+    180,36,169,228,178,163,182,166,142,140,86,121,49,25,188,206,105,246,77,206,207,131,201,44,72,174,66,228,124,6,153,3,
+    33,241,115,209,54,113,238,44,168,17,184,6,128,129,76,112,28,42,79,13,166,26,139,173,168,121,233,8,252,154,54,79,
+    30,42,125,146,244,208,140,236,37,62,125,37,206,42,14,40,254,7,78,133,145,45,205,245,119,96,91,171,97,72,105,88,
+    210,155,200,33,108,41,1,65,252,106,186,177,250,75,170,32,80,137,52,206,13,195,243,177,225,255,199,121,20,255,159,208,
+    242,128,231,145,244,34,189,227,193,234,13,57,209,75,153,187,230,193,240,140,162,132,166,215,104,57,112,24,78,250,126,234,
+    233,183,97,116,39,211,9,18,72,178,88,128,125,214,213,199,91,254,89,197,38,143,6,204,123,85,55,226,176,240,184,199,
+    255,103,112,240,18,231,204,153,70,117,151,38,27,144,255,72,1,162,187,161,249,19,69,48,132,2,60,52,214,178,10,34,
+    85,190,113,114,182,34,40,64,221,245,214,134,44,100,95,57,93,228,75,67,82,152,77,255,203,37,228,21,169,220,235,103,
+    180,70,20,155,86,98,143,166,181,52,1,97,0,196,41,121,118,109,209,99,26,2,181,182,194,95,60,201,143,57,95,41,
+    132,72,120,100,220,7,120,73,108,124,144,80,179,35,3,67,255,40,229,133,161,102,116,97,233,61,40,234,240,145,19,67,
+    94,177,145,140,80,188,173,127,110,0,134,10,27,158,230,206,213,19,240,120,169,146,70,183,99,240,23,27,72,248,153,1,
+    134,223,188,195,236,136,17,218,142,47,70,187,86,132,17,124,5,13,51,96,253,52,39,78,116,180,243,178,203,126,130,232,
+    136,137,88,47,133,183,0,126,176,176,41,82,23,195,40,168,150,234,14,54,126,175,88,75,39,113,228,176,157,25,184,218,
+    62,73,50,165,55,105,55,43,197,11,219,108,136,233,64,129,39,153,219,216,110,151,41,157,2,14,86,29,84,115,179,0,
+    66,191,250,154,47,186,103,136,233,146,29,16,12,216,78,7,122,241,110,162,157,150,158,16,150,163,162,253,150,136,102,5,
+    61,28,60,250,197,84,161,108,86,43,13,171,142,147,159,94,48,9,46,231,125,11,157,32,119,141,125,224,95,248,60,113,
+    51,136,136,237,56,129,238,118,58,114,155,222,238,48,163,72,43,58,68,169,244,158,38,84,223,144,69,177,90,224,112,42,
+    4,138,74,10,252,43,228,99,43,16,237,148,21,54,100,26,39,49,120,154,16,193,53,233,163,219,141,176,130,150,97,69,
+    129,108,121,66,181,53,99,207,54,147,48,76,65,150,152,240,45,16,53,192,218,39,24,0,210,205,3,99,67,13,244,229,
+    98,32,188,52,49,196,91,75,202,67,231,130,29,137,124,142,98,5,188,236,163,60,93,102,227,173,133,120,142,108,235,144,
+    206,81,42,95,120,165,19,26,36,150,227,125,48,17,232,234,171,112,9,183,231,2,56,101,200,187,9,150,42,211,30,166,
+    87,188,12,33,60,131,40,18,68,136,71,59,223,198,25,129,119,43,143,173,49,31,113,80,71,160,39,63,48,44,123,22,
+    21,235,86,117,47,26,9,39,145,45,252,209,218,167,223,213,33,52,152,169,25,86,253,134,160,83,228,42,184,195,57,140,
+    100,169,154,150,98,160,32,35,129,76,211,122,163,57,217,241,205,209,138,127,81,77,13,157,237,173,17,7,76,55,1,66,
+    69,91,97,83,195,32,126,182,4,111,20,173,64,106,142,56,112,220,166,7,157,227,219,219,28,59,240,216,242,199,56,159,
+    240,16,32,147,57,237,33,209,3,88,96,32,177,97,251,170,227,63,91,24,216,35,140,9,198,190,203,133,87,192,10,0,
+    83,238,41,111,35,85,193,69,254,99,0,225,115,188,199,204,230,193,98,35,44,175,136,116,32,137,16,92,56,0,155,22,
+    5,17,93,128,10,146,153,171,74,72,141,95,174,60,230,32,2,62,11,94,111,5,19,216,221,97,174,185,210,229,232,9,
+    61,217,142,136,180,66,176,184,85,228,6,245,165,125,226,24,212,214,63,174,56,204,99,113,209,18,202,224,122,101,208,178,
+    20,30,25,121,0,133,12,6,0,64,180,187,161,50,132,172,179,191,129,28,76,149,253,5,34,39,200,8,3,65,15,117,
+    41,13,142,64,131,189,59,4,212,120,147,166,160,186,196,64,182,62,251,7,66,160,209,219,200,162,190,130,191,168,114,30,
+    245,139,70,116,41,159,146,41,217,220,245,113,71,92,131,226,110,136,93,20,162,142,154,105,196,50,103,159,116,123,88,80,
+    224,8,23,68,245,48,51,132,215,150,248,105,2,54,187,0,37,92,62,71,196,204,20,179,74,218,198,13,68,98,167,54,
+    135,146,219,149,4,166,19,120,39,68,114,110,64,30,168,59,167,144,50,67,136,218,138,24,233,185,146,29,131,144,11,86,
+    211,67,131,104,60,23,78,215,88,245,2,161,225,46,124,199,13,241,39,13,44,23,163,175,170,215,188,68,134,2,254,112,
+    244,217,150,158,155,206,212,34,180,13,55,135,146,91,246,77,58,150,219,61,54,153,88,107,47,145,205,36,78,60,203,208,
+    77,80,224,136,23,150,95,55,149,209,10,20,66,86,164,240,108,51,203,177,161,74,16,41,171,34,86,174,114,96,34,141,
+    204,26,135,176,251,232,42,69,88,81,52,71,106,36,173,222,5,58,77,171,94,71,107,78,50,226,10,154,120,80,158,84,
+    65,219,201,55,210,161,201,29,130,80,141,27,225,7,158,58,137,149,137,187,55,107,46,216,43,207,105,98,35,25,131,224,
+    128,80,73,47,167,206,245,62,198,37,83,146,176,229,133,12,22,68,52,124,248,111,244,110,202,242,109,16,58,42,8,27,
+    226,3,232,244,44,90,153,166,97,84,88,188,206,75,146,25,4,106,5,134,159,160,96,220,142,148,88,36,182,59,54,208,
+    253,251,97,216,239,198,219,169,63,26,146,84,108,254,228,204,29,106,82,203,112,39,180,197,124,222,188,227,43,90,4,167,
+    45,169,22,253,185,225,28,160,225,45,22,45,192,91,154,87,101,100,6,167,171,169,160,191,216,229,254,31,19,200,74,93,
+    191,26,143,54,228,166,220,117,102,65,72,131,43,178,155,0,96,16,117,25,39,204,234,26,10,59,71,131,135,5,138,140,
+    104,249,56,72,61,78,127,16,0,0,89,7,115,189,125,164,194,67,228,17,30,79,170,52,24,24,22,202,139,18,171,190,
+    11,179,30,36,3,169,180,55,141,36,53,120,169,117,185,16,59,158,76,208,187,88,72,153,40,40,223,66,215,187,118,1,
+    112,245,163,117,133,240,156,167,30,216,91,233,29,181,87,101,115,14,157,74,31,252,132,136,235,182,20,251,156,89,101,250,
+    4,74,53,136,99,81,143,154,96,13,6,152,12,50,113,132,132,249,32,76,35,122,216,232,190,217,76,37,58,201,21,115,
+    129,19,91,248,65,141,229,128,63,140,252,227,116,76,190,226,179,97,244,0,115,155,187,108,238,161,242,78,20,250,211,195,
+    206,34,28,247,143,172,38,5,26,160,60,252,167,112,162,121,112,172,178,64,34,3,13,177,185,6,221,146,26,47,12,69,
+    235,83,20,102,16,28,64,148,131,232,238,29,142,163,66,214,171,47,183,35,113,23,39,222,191,204,138,24,163,133,111,15,
+    2,131,34,50,188,101,193,199,1,0,173,35,167,98,70,140,46,162,41,192,22,36,160,153,160,225,132,108,143,176,128,38,
+    95,126,212,49,153,182,162,101,165,98,250,104,213,56,125,88,133,229,164,104,218,248,96,38,183,156,88,202,81,227,104,233,
+    133,102,160,79,90,3,71,94,133,200,52,67,196,131,82,52,65,234,169,100,107,65,74,100,143,45,63,216,180,73,106,229,
+    239,76,153,139,44,43,184,164,37,108,140,113,160,19,176,255,170,251,235,103,93,119,146,70,73,192,109,2,254,156,189,236,
+    197,130,114,191,172,6,216,181,163,2,79,206,139,161,234,182,75,223,39,116,128,86,253,61,134,246,138,4,35,222,184,188,
+    143,212,60,224,8,146,190,29,215,232,192,151,25,198,119,251,30,53,69,8,0,158,171,223,117,38,24,124,72,113,128,122,
+    4,8,179,53,100,110,112,225,42,13,220,80,59,166,233,166,83,2,227,240,92,69,224,231,149,170,85,51,144,23,88,62,
+    233,165,42,52,54,35,235,136,98,219,13,121,64,155,126,123,64,210,212,102,203,106,87,209,177,224,199,184,6,129,95,67,
+    91,159,84,34,64,93,239,16,131,193,48,177,7,29,63,231,162,222,141,42,100,48,125,72,51,32,0,216,8,104,92,18,
+    207,187,152,18,105,96,144,45,101,6,36,121,234,58,89,176,5,108,177,230,200,186,4,1,36,51,184,83,50,27,86,154,
+    235,19,149,76,57,80,209,17,192,183,114,148,204,39,135,100,203,14,188,160,147,101,192,15,58,205,180,34,111,140,134,207,
+    103,151,89,221,206,104,156,123,82,143,52,41,174,36,197,144,33,5,108,239,132,101,181,122,163,12,128,179,239,45,174,53,
+    232,118,125,53,81,84,190,33,133,35,145,185,220,146,223,26,68,181,217,210,113,113,89,90,44,67,174,128,63,138,11,144,
+    208,196,85,244,135,193,134,205,40,91,49,153,78,3,81,119,24,196,142,82,14,97,159,251,112,150,100,164,241,198,103,142,
+    25,94,222,147,146,105,132,159,60,234,147,50,96,180,176,105,146,152,228,112,195,1,28,22,178,87,135,216,188,19,123,146,
+    225,146,219,157,18,64,237,216,66,219,106,60,240,63,130,209,221,114,242,18,143,121,97,155,228,82,220,15,90,169,216,99,
+    186,114,95,70,176,221,129,161,0,201,12,228,97,161,3,186,251,218,131,176,217,81,45,1,137,245,16,2,216,30,63,110,
+    31,17,168,217,110,52,135,225,177,125,22,27,98,224,53,68,239,96,37,134,67,68,36,36,159,222,215,26,74,111,67,211,
+    36,5,149,253,16,105,10,141,183,196,10,83,19,196,141,47,171,114,144,68,18,13,134,51,171,103,175,163,43,125,178,131,
+    166,177,168,24,69,120,46,29,101,76,171,49,100,88,93,156,59,177,82,155,150,213,75,198,53,69,227,207,58,183,62,163,
+    228,149,34,209,154,34,248,240,125,164,37,22,112,88,204,176,22,178,48,43,44,249,114,219,8,203,217,122,30,156,72,94,
+    45,186,196,37,108,129,61,69,104,26,235,9,188,184,135,122,197,185,52,42,70,44,212,60,104,8,68,42,249,183,181,168,
+    204,124,13,198,130,124,207,95,54,174,183,135,224,161,116,178,98,149,222,226,16,233,56,161,79,146,179,43,205,212,212,255,
+    198,9,198,215,42,229,219,107,217,227,49,12,196,213,120,26,28,54,33,82,93,214,92,207,130,124,161,27,219,138,139,103,
+    116,171,18,223,101,108,245,116,215,49,58,74,183,148,194,226,152,9,161,218,41,21,143,74,133,88,101,20,244,77,128,12,
+    28,15,71,110,251,84,16,35,44,193,165,18,54,73,127,213,198,147,16,116,143,64,61,172,56,53,206,57,47,154,175,32,
+    46,67,239,135,115,59,244,41,164,129,250,250,100,246,163,45,159,15,159,14,37,75,98,189,110,95,181,242,46,45,40,203,
+    72,78,218,213,4,107,254,40,10,250,231,203,205,29,193,25,74,108,235,64,169,199,176,98,187,111,209,143,2,86,6,36,
+    92,24,163,37,141,208,133,177,90,60,173,79,201,80,239,249,1,68,135,137,84,236,8,75,142,38,20,192,247,102,159,255,
+    254,152,197,12,58,10,182,176,225,189,131,124,88,188,158,166,211,117,13,225,244,160,49,78,92,231,24,128,239,126,141,180,
+    113,101,23,88,63,230,110,37,160,204,10,151,46,176,34,163,129,148,147,169,221,27,165,175,94,18,5,212,176,0,246,149,
+    134,28,15,158,234,69,48,78,107,101,72,214,161,36,103,85,206,90,96,170,20,233,211,241,123,81,191,220,18,215,244,74,
+    126,38,186,126,109,4,35,197,80,57,160,180,30,15,88,87,153,142,63,13,194,191,11,101,218,65,202,124,26,207,26,130,
+    23,87,22,160,201,178,51,161,102,146,217,142,127,12,186,25,248,62,27,32,86,226,56,66,16,93,133,20,192,129,221,249,
+    7,146,81,14,137,57,4,199,157,32,12,214,91,49,99,222,52,91,108,163,100,13,227,172,63,197,47,57,136,105,187,23,
+    126,179,159,129,128,99,46,184,178,109,125,22,73,76,45,226,51,170,146,33,23,217,18,171,80,99,14,195,63,92,137,52,
+    68,158,241,177,172,148,24,250,41,41,70,216,100,160,100,64,103,24,168,240,189,89,178,161,87,137,127,183,146,37,216,202,
+    117,103,36,172,214,194,152,78,232,72,166,107,5,107,138,67,4,64,3,186,192,166,147,131,60,139,91,46,128,162,97,138,
+    242,18,136,159,202,1,22,34,1,194,118,238,32,76,25,207,154,21,166,44,252,4,220,69,218,46,102,3,16,220,106,208,
+    240,3,110,26,147,179,133,170,65,156,231,72,135,253,234,220,115,116,82,202,83,163,57,176,26,48,168,209,106,177,229,35,
+    117,112,197,8,47,85,158,159,141,48,247,173,225,161,44,162,234,6,6,132,97,209,175,89,2,31,225,232,68,143,49,87,
+    148,133,133,46,68,145,0,192,91,35,1,234,90,167,134,181,171,192,149,197,199,84,217,250,137,96,169,106,112,175,82,236,
+    43,56,5,253,53,36,184,111,103,194,93,153,121,168,108,10,230,102,28,50,105,90,177,246,247,23,110,44,136,246,144,202,
+    244,84,172,211,187,133,167,202,28,106,224,17,163,193,31,200,5,196,226,251,200,49,68,6,238,160,172,49,27,75,250,80,
+    208,16,204,9,28,138,22,177,81,244,141,232,204,143,168,218,35,12,122,208,143,13,84,22,133,93,0,180,153,65,116,169,
+    216,179,234,206,80,118,134,57,138,173,217,137,98,116,24,103,255,209,174,90,131,83,232,230,145,9,72,65,183,66,104,153,
+    34,211,133,88,181,71,65,223,134,44,241,14,123,82,39,252,141,51,34,7,175,179,176,153,40,7,193,13,33,160,129,223,
+    143,54,205,105,29,80,222,70,151,109,236,57,65,23,13,24,40,171,5,153,138,66,92,50,158,184,22,202,147,171,15,34,
+    82,240,246,97,251,149,207,58,205,229,105,117,88,96,228,233,199,226,186,113,157,28,227,184,77,169,198,30,55,80,212,99,
+    80,136,186,126,206,68,206,64,241,243,27,62,240,220,208,74,208,176,49,188,43,34,204,226,2,77,16,16,132,181,187,85,
+    128,173,67,164,138,39,73,227,46,32,34,8,9,44,190,231,2,115,210,68,170,90,99,152,32,215,99,142,79,253,253,177,
+    194,230,248,64,35,231,74,224,159,139,0,205,122,26,168,52,51,112,109,192,44,123,38,237,244,224,196,1,29,36,37,178,
+    95,4,0,176,72,144,34,229,189,167,74,65,26,112,87,49,234,27,128,8,236,243,231,180,218,167,212,54,253,193,156,175,
+    53,196,112,30,110,210,117,27,157,40,63,117,42,108,31,21,38,145,216,186,224,161,107,151,84,109,198,74,102,143,53,113,
+    173,146,170,206,43,115,98,246,24,27,130,129,17,191,41,60,205,138,197,136,181,69,72,4,66,189,11,171,135,142,196,255,
+    23,147,203,89,121,173,30,6,223,210,198,70,221,2,237,147,2,38,29,24,223,204,228,202,173,26,6,214,45,223,146,29,
+    20,122,65,118,84,112,228,32,196,63,124,128,67,244,215,181,18,251,117,239,23,98,249,176,139,38,111,104,112,130,226,186,
+    33,221,229,238,113,2,19,167,164,217,200,168,20,57,45,82,199,243,107,37,52,179,197,143,47,25,119,117,93,24,93,189,
+    223,106,144,52,116,149,53,17,127,190,183,164,29,231,59,40,126,145,85,76,8,220,245,40,164,208,193,70,52,248,100,140,
+    108,140,162,64,191,48,189,205,32,48,96,147,204,100,63,6,125,61,168,224,183,33,150,244,139,84,254,19,118,201,23,2,
+    46,15,10,104,99,147,2,52,221,115,65,54,36,187,128,68,126,243,207,65,4,253,143,103,120,233,94,17,29,126,248,37,
+    36,56,11,162,79,11,50,48,5,66,1,87,82,165,25,12,11,191,103,121,116,194,25,178,240,33,239,243,244,54,90,25,
+    211,100,176,148,162,0,248,254,196,24,206,117,240,238,9,242,50,26,86,67,185,61,133,109,37,113,99,169,130,3,59,42,
+    17,168,70,33,57,192,67,115,129,38,28,170,95,155,3,142,20,141,77,217,98,44,11,85,211,27,23,170,174,106,138,124,
+    51,54,145,247,155,120,72,113,180,196,112,132,50,180,25,28,185,178,202,242,143,76,53,197,47,155,21,4,202,39,63,33,
+    77,16,38,174,133,76,72,153,189,129,47,151,213,155,85,235,126,160,15,76,110,165,203,34,12,90,24,45,221,96,157,73,
+    46,105,174,176,30,71,162,89,69,74,41,35,199,231,82,150,204,63,134,75,245,97,126,190,82,50,1,231,164,82,252,82,
+    77,204,112,7,49,85,200,193,214,128,71,85,253,86,34,102,42,7,61,77,5,234,196,222,40,219,22,49,88,204,30,140,
+    168,24,234,153,21,165,175,70,252,11,106,248,147,115,48,237,166,14,22,141,243,66,78,5,43,227,95,83,208,81,101,238,
+    74,249,71,184,167,200,97,222,169,99,96,139,193,221,10,25,200,141,94,16,4,203,103,194,167,135,113,17,186,19,168,197,
+    169,163,58,192,245,16,238,52,105,119,39,106,90,66,26,133,92,9,129,97,68,187,193,140,86,33,55,188,96,186,252,164,
+    6,21,33,129,108,72,11,172,126,157,142,46,92,187,122,5,107,75,207,134,205,58,198,96,213,15,210,178,80,46,186,202,
+    200,172,62,141,30,58,77,40,234,78,116,130,56,185,104,127,224,96,180,157,251,9,220,220,106,18,54,131,20,68,96,4,
+    114,31,180,220,188,4,113,226,139,4,73,215,87,4,180,164,138,28,246,33,74,168,114,158,28,137,81,195,72,20,66,242,
+    226,66,78,84,96,26,221,182,197,48,198,246,109,141,224,189,57,250,73,67,92,36,240,110,38,187,202,150,163,162,15,130,
+    45,228,60,128,106,158,224,81,54,242,183,129,123,105,224,29,152,153,14,57,239,31,201,252,57,4,132,53,241,69,252,158,
+    118,157,32,199,217,24,20,178,148,8,217,33,117,166,53,68,3,249,89,197,73,175,64,155,215,111,44,142,73,89,80,205,
+    130,196,156,63,128,219,175,126,33,190,85,39,19,48,85,85,71,0,125,176,176,182,197,134,187,56,189,206,142,147,110,35,
+    243,181,254,157,89,117,84,45,16,143,90,74,133,48,146,53,84,194,20,220,23,48,5,41,152,81,206,1,90,197,34,90,
+    69,199,131,123,154,87,239,40,181,110,33,171,57,29,155,172,51,46,21,227,65,38,9,142,154,109,100,7,161,214,172,12,
+    149,62,78,171,0,156,96,54,5,238,235,147,207,243,51,27,201,148,71,0,63,21,138,13,228,151,192,204,67,158,114,239,
+    84,253,7,51,174,91,101,184,219,15,58,46,83,185,100,45,144,47,148,203,25,245,98,97,142,45,217,13,212,114,175,93,
+    221,192,195,221,11,60,249,197,152,103,39,79,86,0,124,14,172,146,121,180,79,45,184,156,206,20,51,169,170,30,158,193,
+    78,35,63,201,200,206,212,179,94,93,86,1,106,104,61,96,156,85,136,200,134,230,87,235,111,142,230,98,233,138,101,197,
+    129,198,197,104,130,255,134,201,175,41,57,222,187,147,77,66,121,22,37,92,0,74,1,4,253,234,77,141,224,51,47,89,
+    140,218,202,199,4,75,52,104,37,216,108,208,210,219,198,221,118,93,17,156,21,104,49,219,249,236,140,16,204,188,105,14,
+    7,178,84,97,25,124,10,227,206,109,155,94,19,253,170,204,136,81,96,170,66,151,47,228,134,35,170,118,226,200,23,114,
+    71,129,160,206,129,187,253,165,168,0,51,218,223,121,9,211,101,40,103,32,165,186,110,120,2,68,9,166,167,236,227,147,
+    89,67,9,197,195,92,39,234,139,30,228,251,148,75,72,5,40,226,230,31,17,76,4,160,184,251,105,94,26,192,19,75,
+    92,126,246,50,197,52,174,136,218,4,134,59,248,78,8,171,42,190,82,211,192,83,204,197,202,42,22,35,239,100,117,255,
+    111,117,8,164,128,70,154,87,76,89,178,225,176,66,242,88,3,97,83,139,92,249,33,59,115,215,71,198,40,222,161,161,
+    139,213,132,197,138,156,31,15,24,2,233,93,175,198,99,16,27,137,124,194,204,181,31,48,109,173,185,57,197,113,183,69,
+    194,50,58,205,138,37,117,176,242,114,163,178,109,241,201,114,91,105,33,72,243,159,202,2,245,47,135,134,226,178,223,155,
+    194,150,232,11,195,213,51,92,6,204,167,102,163,156,199,242,245,114,72,160,24,120,57,80,36,122,84,137,252,45,32,94,
+    243,230,26,128,47,178,236,32,231,96,139,114,49,111,84,109,61,62,131,92,76,110,36,52,13,74,212,32,32,214,204,224,
+    37,3,7,135,170,160,91,126,68,198,143,63,249,80,243,48,131,92,157,184,147,228,174,163,49,100,129,224,120,20,89,76,
+    108,198,193,255,160,1,119,201,202,190,65,16,137,20,156,235,211,15,9,178,210,42,67,115,139,58,60,55,106,78,106,222,
+    223,37,208,45,184,110,194,251,35,122,220,148,181,70,76,249,96,253,149,173,117,22,11,69,84,33,28,28,27,150,16,71,
+    111,53,241,176,181,156,99,205,98,193,114,73,223,191,178,200,249,185,38,164,208,158,251,94,160,50,201,43,209,254,231,254,
+    237,125,125,130,19,118,251,54,9,53,65,244,229,2,9,19,177,170,115,253,49,31,9,176,165,9,219,73,22,163,65,107,
+    214,234,192,136,184,59,56,183,15,65,110,170,107,177,77,227,255,223,211,197,46,233,124,220,215,89,72,68,132,53,187,177,
+    85,165,97,64,198,197,245,197,196,229,203,22,190,192,188,20,254,177,182,126,10,138,210,233,20,14,14,182,39,46,223,151,
+    249,151,84,243,67,241,118,48,206,219,76,65,27,184,62,194,203,209,0,0,185,112,146,4,0,38,149,140,38,145,66,52,
+    107,41,200,102,15,69,196,243,241,34,242,148,50,127,35,209,23,92,107,64,153,235,63,229,184,17,107,39,51,16,64,185,
+    102,37,42,82,252,200,174,95,195,175,94,44,222,168,49,88,1,237,192,144,182,212,230,106,179,183,97,166,37,72,122,165,
+    196,148,22,149,88,62,67,166,129,173,117,90,90,97,217,92,133,7,165,10,118,185,236,36,194,178,84,230,133,180,137,96,
+    247,93,150,19,92,224,216,148,151,11,172,57,61,133,27,12,170,214,166,199,95,130,114,32,29,166,210,18,124,94,174,249,
+    228,108,102,43,51,65,36,234,51,1,68,84,111,142,18,105,135,135,241,50,43,212,3,255,82,236,53,74,166,249,159,149,
+    9,131,115,4,17,107,126,118,111,113,38,193,219,145,20,174,203,176,106,149,43,163,93,162,4,33,79,75,32,119,72,84,
+    46,4,53,219,148,118,125,198,246,70,44,124,91,4,187,52,52,86,50,109,170,72,148,48,190,197,249,111,81,24,214,192,
+    110,57,250,189,15,102,247,44,72,111,141,59,108,48,193,48,56,105,91,178,161,61,7,172,109,89,150,77,11,56,246,100,
+    252,149,95,98,203,226,93,92,206,13,16,79,140,37,243,219,183,20,223,17,174,206,76,88,41,212,192,104,29,136,124,10,
+    246,191,106,174,168,209,23,13,136,45,213,181,245,75,144,131,145,69,138,108,233,137,126,28,82,57,122,247,245,9,21,221,
+    41,87,226,176,67,13,117,207,127,38,112,79,215,7,54,158,123,5,69,111,176,13,150,164,61,79,40,40,180,111,189,7,
+    104,57,25,53,92,101,79,194,92,185,227,116,64,208,163,130,19,44,180,155,220,62,213,95,185,19,88,190,58,176,178,41,
+    183,42,109,141,0,84,55,234,164,149,71,156,194,161,229,98,85,102,245,49,25,197,53,214,64,30,232,145,98,202,241,234,
+    109,62,104,36,18,43,67,49,50,58,31,185,48,168,54,24,218,12,0,4,31,3,80,33,77,40,5,203,40,190,68,46,
+    252,42,64,110,30,49,154,192,35,106,43,81,102,32,129,3,152,57,135,55,90,156,153,156,96,172,63,135,59,63,219,22,
+    69,160,113,47,51,200,92,211,103,102,238,213,122,143,166,142,230,193,14,47,244,238,47,207,10,64,165,122,194,214,176,73,
+    235,153,245,49,113,183,140,21,145,135,94,183,19,24,64,9,125,55,67,56,188,35,107,71,32,163,5,249,109,6,172,251,
+    18,202,98,38,217,198,228,103,255,12,181,177,245,48,20,160,229,233,185,58,120,35,66,227,252,1,218,203,234,218,233,83,
+    76,34,172,7,193,236,5,43,73,87,28,7,150,10,208,131,7,46,0,0,139,90,191,113,198,34,241,230,42,227,92,2,
+    181,82,121,47,34,135,40,146,129,140,144,83,94,46,79,143,203,156,96,33,187,24,200,83,109,148,246,53,38,236,32,97,
+    168,162,52,98,157,37,135,129,209,30,42,87,233,49,5,206,233,163,212,110,234,213,76,14,132,7,86,5,87,236,106,64,
+    127,189,78,221,157,59,187,129,184,81,73,38,134,158,163,177,139,39,234,224,130,7,239,158,59,115,95,225,108,236,138,40,
+    74,4,33,30,73,156,59,213,129,179,21,220,146,35,108,235,196,200,163,61,17,223,83,169,52,168,189,170,227,24,233,61,
+    127,60,199,180,213,65,109,202,5,156,98,45,211,89,19,17,164,171,116,6,45,161,182,96,84,8,16,107,74,66,116,32,
+    79,254,47,168,19,113,127,32,189,155,124,231,229,35,148,249,42,93,175,213,85,128,5,187,140,100,96,98,20,14,210,1,
+    10,176,154,33,66,43,16,184,99,110,204,188,130,2,44,149,40,57,17,56,16,18,68,203,110,120,144,179,242,92,180,192,
+    228,98,183,84,88,214,164,80,22,45,198,207,227,160,227,221,111,195,133,194,204,135,134,146,192,132,71,85,202,45,104,141,
+    40,61,179,198,146,57,14,40,76,72,115,163,107,104,222,142,166,133,159,32,220,120,16,47,28,153,20,240,212,58,52,102,
+    58,44,2,21,18,147,126,201,165,45,202,112,71,230,183,99,86,42,192,180,133,65,181,58,230,10,172,92,3,27,168,133,
+    113,211,252,62,141,80,180,96,214,0,158,75,192,147,101,163,148,51,47,190,69,42,5,252,124,36,99,250,11,17,27,131,
+    173,144,57,166,85,236,239,11,69,115,108,91,177,179,183,34,61,248,232,55,105,205,129,67,125,246,153,172,99,55,186,215,
+    169,36,67,128,4,23,48,60,150,178,47,144,215,64,71,207,138,13,127,114,79,31,221,23,92,251,23,99,184,160,114,255,
+    245,228,154,19,203,114,69,7,184,233,108,244,194,151,104,250,123,44,49,126,165,183,170,90,215,156,32,167,61,139,104,12,
+    11,102,64,38,82,167,225,193,153,27,99,74,200,200,237,125,143,36,96,229,34,47,208,112,61,228,114,173,49,201,166,148,
+    35,232,125,68,79,72,128,102,23,82,172,230,79,113,28,10,79,212,83,230,153,116,253,174,183,7,186,78,65,117,229,134,
+    46,92,100,88,129,157,189,68,238,139,168,196,0,34,20,195,139,245,122,172,32,51,30,93,193,141,2,84,241,126,248,140,
+    227,33,145,64,197,18,243,105,137,59,184,227,143,95,119,64,175,198,147,252,35,72,1,117,48,142,78,114,247,216,126,209,
+    194,16,119,167,215,100,24,163,43,167,154,141,139,128,170,54,115,175,49,198,58,203,13,197,22,173,83,140,208,239,137,1,
+    211,240,10,96,135,208,216,85,150,0,18,88,73,102,118,94,123,202,254,201,72,155,89,178,157,37,112,195,180,6,237,10,
+    112,128,255,166,78,120,239,154,180,145,85,47,11,247,20,113,186,128,114,42,11,143,150,141,219,98,50,7,61,34,248,22,
+    132,213,32,156,42,46,188,121,64,160,142,155,155,120,163,52,34,219,247,177,240,54,199,182,58,200,79,188,39,234,248,238,
+    233,94,222,34,10,161,93,224,104,171,212,152,217,193,168,145,96,154,59,147,180,250,37,207,145,51,146,255,3,29,145,123,
+    40,48,205,112,169,247,178,2,112,143,118,73,198,128,160,239,234,202,147,43,251,239,212,130,225,73,251,201,247,111,251,16,
+    204,166,93,149,178,235,144,0,45,243,11,182,210,122,194,103,180,17,160,38,19,12,228,91,200,82,109,237,93,9,213,177,
+    195,38,147,206,14,161,19,169,155,113,185,161,191,211,255,238,134,188,41,114,38,193,7,62,137,139,133,132,233,224,41,116,
+    172,77,39,196,134,197,124,64,202,224,173,159,148,204,79,99,90,172,27,25,22,19,195,61,38,202,22,112,33,150,108,181,
+    171,172,94,185,55,141,198,245,32,225,217,135,200,90,18,101,187,66,83,9,96,227,36,19,61,78,194,208,176,65,19,153,
+    127,240,23,223,39,45,60,14,12,78,204,37,144,102,21,172,117,209,201,148,56,13,235,201,113,124,69,120,186,140,254,90,
+    44,124,57,128,140,167,183,135,20,116,107,216,200,6,185,146,240,14,105,22,247,6,96,165,103,97,101,205,21,77,233,52,
+    14,47,18,236,177,48,17,6,38,73,135,140,24,39,110,87,0,237,182,120,4,62,120,38,33,118,183,139,210,74,195,45,
+    53,16,8,31,242,10,84,231,117,117,192,160,49,66,65,252,23,193,130,48,230,222,204,225,51,5,183,196,250,158,242,7,
+    179,218,74,163,192,69,182,0,14,208,8,226,118,249,110,220,239,133,200,74,229,18,123,54,46,72,71,124,144,233,120,159,
+    172,67,49,45,200,167,132,33,236,104,5,146,190,120,110,150,129,117,223,82,154,234,177,3,255,201,115,98,216,200,240,163,
+    109,151,138,145,205,104,101,101,109,11,89,225,166,87,75,154,177,228,101,170,54,145,238,92,150,193,202,99,201,152,35,135,
+    76,73,39,11,121,242,81,2,42,125,197,135,73,118,113,148,123,244,117,86,28,119,156,140,171,156,128,47,217,108,117,164,
+    34,175,114,53,109,138,159,10,107,12,67,148,223,232,162,85,130,177,90,227,23,65,47,118,1,206,76,20,135,188,147,2,
+    170,19,53,58,85,83,190,106,101,118,24,58,126,14,65,165,32,72,233,50,6,135,127,86,135,97,248,158,7,174,184,224,
+    5,165,100,221,122,203,64,84,191,206,168,104,171,130,2,201,45,13,142,113,188,33,251,250,79,101,146,167,81,22,74,249,
+    179,51,215,9,51,32,69,97,6,73,194,12,37,78,99,96,88,19,208,224,56,48,212,89,80,157,184,140,17,57,21,72,
+    3,5,153,196,18,53,50,19,129,45,255,145,164,217,158,243,95,244,32,191,2,113,247,115,6,44,62,19,35,179,199,131,
+    111,81,196,200,124,104,210,161,205,104,12,108,226,192,17,210,227,68,160,128,100,132,211,0,6,3,118,38,84,29,129,78,
+    93,133,4,95,160,70,193,45,251,67,146,160,148,1,144,165,240,32,80,155,89,38,236,111,103,200,116,57,24,252,65,178,
+    1,196,241,32,208,190,225,14,185,233,2,83,185,217,17,242,42,82,192,52,53,77,1,111,56,170,166,44,28,40,12,106,
+    125,192,12,252,125,176,130,97,59,86,41,131,130,110,57,202,186,47,86,0,46,214,156,56,137,101,92,7,28,201,121,80,
+    234,212,37,141,80,15,217,183,201,56,216,26,253,124,40,116,157,210,189,30,130,96,152,196,68,139,225,128,76,38,101,200,
+    192,118,99,130,66,233,77,8,21,230,179,5,76,186,155,107,89,203,188,143,59,231,59,34,86,146,107,129,250,85,101,89,
+    94,48,70,134,166,57,214,241,204,179,100,163,244,33,220,137,79,17,159,164,9,199,183,129,156,33,60,239,16,225,41,12,
+    80,25,153,62,152,76,36,4,186,185,22,98,145,213,155,99,39,6,118,175,21,157,75,34,217,83,210,226,128,250,139,228,
+    144,252,104,20,72,4,112,249,73,226,109,25,27,120,122,189,134,42,146,4,209,137,68,3,151,73,160,105,91,247,120,1,
+    228,97,172,43,83,205,191,144,20,6,45,129,49,81,99,249,52,45,102,8,152,130,192,180,89,5,251,249,71,113,213,241,
+    180,242,168,99,56,232,175,95,206,25,175,252,30,65,100,18,192,135,4,122,80,183,61,208,202,205,149,136,224,210,76,5,
+    80,191,19,102,4,6,237,123,1,40,208,1,137,185,132,244,237,91,132,250,58,128,117,148,139,217,149,110,228,14,179,147,
+    231,94,48,51,18,129,82,203,46,226,194,67,28,25,77,188,189,56,42,14,67,22,105,60,209,8,138,11,124,66,1,162,
+    70,228,117,175,44,64,129,216,181,106,91,125,162,14,94,73,27,30,192,217,182,77,123,16,61,24,245,112,22,89,175,78,
+    129,110,104,101,188,199,3,92,216,124,90,242,20,57,24,98,89,87,31,72,227,100,87,96,63,73,196,140,3,136,223,210,
+    1,3,102,7,140,32,8,91,220,49,59,16,120,193,194,65,144,148,38,79,67,54,252,9,238,40,248,82,239,137,124,8,
+    182,42,68,3,82,128,193,122,164,60,126,108,137,132,128,84,104,226,176,18,110,121,149,186,216,226,26,101,239,21,96,53,
+    168,138,139,98,222,87,145,163,98,154,96,240,126,168,67,124,161,75,83,245,67,23,48,118,226,17,79,228,54,134,15,29,
+    73,62,200,86,60,94,40,129,64,122,172,30,105,200,9,36,4,99,122,246,71,29,28,0,18,134,48,97,97,205,72,213,
+    76,100,74,219,64,20,175,36,24,34,241,81,122,1,57,227,122,230,86,41,16,98,198,209,17,242,44,44,80,115,85,131,
+    226,12,125,254,128,139,24,173,61,254,26,133,32,252,92,1,99,209,76,30,117,121,154,90,175,81,125,246,114,237,16,136,
+    69,249,61,164,178,48,204,78,79,7,34,15,50,29,105,65,157,157,168,42,109,239,32,91,116,10,85,110,181,99,220,213,
+    177,149,111,24,76,210,56,78,152,113,7,175,180,53,164,140,59,189,253,114,118,98,64,144,24,192,66,2,169,14,145,69,
+    111,156,112,165,96,113,237,205,216,209,202,16,33,165,115,176,18,14,246,225,64,162,5,72,76,116,155,114,41,80,136,169,
+    56,113,192,220,116,5,99,169,49,194,18,49,200,169,28,200,139,128,45,167,123,255,83,63,62,58,124,46,3,132,237,156,
+    54,188,134,72,62,51,84,212,210,50,124,218,84,154,115,52,231,215,12,153,104,122,10,132,226,86,179,37,246,80,127,41,
+    103,154,74,42,135,140,33,223,116,201,216,81,212,58,64,53,55,17,70,1,106,112,178,78,135,112,223,14,216,58,76,21,
+    48,215,22,10,97,46,95,198,223,170,114,70,46,20,81,44,162,66,248,216,161,159,121,19,140,112,163,117,178,148,120,96,
+    220,114,242,185,80,134,186,130,235,115,219,3,42,103,253,46,20,3,2,54,74,213,213,102,64,10,95,171,247,235,93,46,
+    137,164,188,131,212,109,159,162,40,40,108,254,231,208,255,182,165,233,11,99,194,225,215,89,225,213,75,208,155,247,17,113,
+    234,6,87,220,15,177,209,116,115,57,170,250,114,235,146,121,80,121,32,75,135,244,55,206,228,104,224,66,111,236,133,22,
+    245,169,56,182,104,57,233,193,111,132,249,102,220,160,125,125,35,124,103,27,185,127,62,7,114,45,250,94,92,163,157,211,
+    50,235,185,84,142,218,65,163,52,145,152,215,36,125,191,59,115,161,215,182,101,26,216,241,58,204,221,230,172,244,89,135,
+    128,17,190,198,233,221,107,197,89,193,3,0,230,31,144,14,199,13,8,106,153,64,238,73,9,136,129,54,59,138,149,125,
+    159,83,219,101,237,121,120,17,60,99,122,179,18,47,243,120,63,80,166,248,126,241,38,38,32,247,208,1,214,18,194,50,
+    14,36,224,188,178,45,242,96,37,66,219,190,181,148,170,147,51,36,29,49,159,52,74,238,247,142,111,97,51,254,159,17,
+    205,173,117,169,66,228,14,199,190,30,29,123,36,227,154,223,9,19,159,90,48,121,139,244,14,117,59,51,113,5,232,54,
+    173,4,174,222,58,180,174,86,96,20,196,245,80,10,88,68,183,124,182,0,206,124,133,222,121,5,56,152,86,146,215,214,
+    3,160,35,31,121,83,186,116,40,65,227,73,115,47,194,172,59,74,19,192,83,132,143,52,61,189,135,149,213,251,58,113,
+    156,47,171,215,42,125,169,154,137,224,194,82,243,61,23,238,158,130,1,166,41,204,170,135,169,213,122,153,244,54,115,111,
+    122,70,166,15,155,224,174,165,15,210,57,65,133,210,227,54,158,62,19,233,56,12,238,57,35,66,173,167,204,7,4,0,
+    125,136,164,109,201,69,232,153,250,0,77,2,73,68,99,113,185,19,75,224,69,240,50,50,207,62,177,11,34,252,71,39,
+    80,78,195,72,7,44,17,24,42,203,182,4,126,250,14,152,30,10,225,62,108,146,122,185,118,129,37,167,140,210,163,111,
+    19,80,233,96,151,249,186,202,83,86,20,163,108,232,165,77,74,162,225,192,214,36,44,209,233,173,10,38,82,240,172,136,
+    192,169,228,217,195,35,82,150,47,103,83,143,154,81,167,76,223,19,168,42,106,125,235,16,87,121,157,3,209,21,126,22,
+    220,199,87,187,227,206,22,33,182,197,42,152,146,167,99,224,145,4,148,240,115,43,190,144,234,217,132,153,6,177,86,19,
+    64,136,109,210,54,8,114,226,203,129,136,221,36,175,249,168,99,211,4,186,226,75,191,145,219,240,13,16,6,50,19,32,
+    77,170,195,127,194,207,17,50,230,27,97,230,244,197,112,92,69,228,190,129,253,134,186,11,254,71,232,18,125,249,126,73,
+    32,91,112,131,196,79,190,21,129,74,71,218,45,108,24,9,219,6,139,200,116,106,84,223,82,178,201,129,238,142,54,106,
+    182,153,164,178,223,177,247,244,112,46,115,4,148,151,98,152,241,159,205,14,23,42,76,117,243,76,100,61,61,109,83,166,
+    131,220,139,194,78,55,60,135,73,130,69,42,24,184,204,142,26,102,222,9,76,106,144,94,80,107,99,136,178,176,102,137,
+    103,179,131,184,31,35,223,224,206,154,33,62,133,101,35,25,244,104,131,95,155,251,134,229,200,202,35,91,201,165,140,158,
+    215,63,201,75,126,155,85,237,12,197,114,106,165,114,82,172,148,110,90,101,11,59,215,124,72,232,78,172,210,96,195,66,
+    233,56,31,47,40,44,115,250,154,145,224,0,28,90,85,198,215,9,20,18,174,194,47,217,115,215,72,155,6,254,161,244,
+    87,178,178,219,24,201,106,88,50,161,66,129,39,69,96,45,122,14,247,41,38,246,178,35,161,153,221,103,203,129,45,82,
+    170,74,214,118,117,87,158,1,58,162,53,105,35,78,83,230,5,0,126,132,23,188,255,172,44,186,129,225,122,25,166,233,
+    60,226,62,41,138,79,176,33,112,78,184,32,1,32,248,212,55,183,166,54,67,88,227,94,94,238,77,100,39,96,28,66,
+    25,233,18,133,157,76,157,108,55,173,104,27,30,169,215,150,55,245,175,197,237,135,69,1,176,121,171,163,37,12,165,182,
+    13,96,142,184,103,101,1,87,85,193,157,5,28,143,164,165,110,25,182,76,220,32,20,54,70,180,32,99,18,9,186,249,
+    210,228,116,178,81,160,5,19,207,85,222,65,98,139,133,40,30,142,149,140,254,96,192,132,236,77,18,249,37,93,115,54,
+    229,145,21,76,144,232,146,147,198,247,26,218,161,175,78,33,130,128,217,218,160,101,32,212,36,177,45,31,84,112,118,172,
+    75,25,210,239,102,71,32,199,254,80,0,72,218,156,115,21,1,194,0,28,73,66,7,96,133,172,112,102,96,33,213,71,
+    119,174,55,193,224,35,62,155,182,8,115,161,224,137,78,192,151,86,33,87,84,31,108,41,44,215,5,130,134,83,226,38,
+    102,232,215,57,168,184,73,193,3,63,136,24,43,78,0,35,128,163,34,85,104,236,2,20,160,171,11,4,74,101,44,144,
+    129,180,16,193,254,19,54,156,7,201,75,163,210,24,35,182,111,23,196,102,53,136,145,85,92,168,142,22,127,93,35,165,
+    35,60,218,110,112,98,212,104,44,34,112,228,103,90,84,201,205,32,114,190,115,200,106,71,103,66,0,135,254,54,120,223,
+    44,59,209,127,6,35,29,127,55,204,129,102,38,67,81,101,53,96,206,229,61,35,251,235,0,188,55,49,188,167,245,235,
+    92,21,63,250,179,124,38,191,169,126,190,101,136,139,133,201,197,96,31,150,32,219,60,70,180,28,46,210,245,253,65,132,
+    59,144,27,5,61,170,71,181,240,209,245,24,110,201,113,47,89,151,184,60,143,239,76,44,207,124,73,189,25,233,153,237,
+    120,4,113,46,71,122,8,85,138,136,155,193,7,18,30,173,30,208,23,232,101,41,242,36,31,16,158,241,18,158,114,16,
+    82,186,50,93,160,71,158,140,118,153,82,195,102,229,250,133,23,66,41,147,75,226,129,61,128,123,66,66,120,145,162,213,
+    231,59,86,145,76,11,235,101,92,226,131,85,52,106,82,228,212,10,119,224,4,80,44,99,202,11,76,37,42,36,72,73,
+    128,31,15,42,226,3,174,41,252,186,210,29,157,145,80,160,110,57,105,102,210,112,202,54,134,17,46,119,68,10,244,210,
+    58,157,209,253,235,226,238,146,88,113,238,49,138,219,217,200,40,232,224,157,87,93,43,12,128,57,216,160,190,102,25,66,
+    30,84,187,67,78,132,118,63,87,125,166,74,181,33,196,31,222,79,183,105,107,209,67,24,195,48,140,190,217,246,125,168,
+    137,42,32,91,18,91,105,19,65,101,129,34,241,195,48,180,210,61,107,194,197,129,251,52,193,171,79,192,122,156,189,177,
+    194,157,106,0,144,35,179,120,51,154,221,150,80,40,137,47,185,24,208,253,135,254,126,24,246,117,76,52,211,188,101,86,
+    5,92,69,143,29,112,224,110,180,168,205,69,153,8,231,76,160,89,162,66,200,130,107,238,178,17,177,218,75,233,159,116,
+    37,102,11,8,127,60,216,4,156,224,202,141,98,131,147,62,232,203,13,204,212,232,125,58,172,86,192,234,213,210,126,129,
+    180,44,48,170,27,70,203,68,100,129,169,35,27,169,240,20,79,214,228,205,6,43,156,217,50,98,95,117,5,107,158,33,
+    163,94,109,177,6,34,26,93,148,131,76,112,47,180,244,97,164,198,95,132,125,174,92,223,241,14,140,154,66,43,47,98,
+    12,47,236,102,213,123,192,171,76,12,63,25,147,42,87,66,20,232,114,18,93,83,141,60,161,110,248,41,69,200,194,12,
+    89,131,1,12,1,137,220,45,49,42,106,34,69,24,53,239,130,45,64,28,35,197,131,174,53,62,215,34,172,235,211,69,
+    127,177,29,229,170,155,189,196,225,25,141,236,96,103,139,250,104,73,148,193,105,32,234,176,161,181,175,163,33,210,173,64,
+    0,127,224,228,155,216,142,150,219,23,139,16,106,239,110,217,32,197,54,200,3,186,39,99,101,14,194,174,242,51,65,178,
+    232,33,65,134,109,114,218,16,10,239,139,88,19,206,155,149,109,114,208,209,54,157,134,93,238,49,231,216,107,45,2,33,
+    22,61,12,204,245,140,174,17,91,17,241,116,160,102,43,70,135,200,240,212,168,250,192,230,40,73,42,178,33,64,74,116,
+    73,120,67,38,133,36,124,14,76,14,56,0,232,212,158,40,134,208,236,152,231,25,205,226,103,196,44,4,87,115,249,40,
+    43,61,204,75,151,228,70,242,168,8,3,247,18,59,172,147,246,158,74,36,135,160,148,68,204,29,99,120,22,241,130,224,
+    161,209,82,218,36,100,204,183,187,99,56,126,170,124,173,31,1,82,44,121,169,221,8,82,184,78,127,99,218,43,153,195,
+    250,223,91,103,13,37,172,161,184,232,160,96,4,49,103,55,45,159,35,3,83,69,34,247,139,153,136,240,167,149,0,154,
+    144,229,82,51,68,234,140,66,27,198,193,49,25,123,217,235,235,30,154,230,64,94,20,174,126,24,210,38,67,44,207,254,
+    126,150,98,31,244,115,15,10,217,29,25,93,30,66,224,57,49,157,193,36,255,155,130,209,220,75,252,40,147,153,111,38,
+    192,56,239,144,88,124,96,78,247,111,117,220,130,32,92,26,142,143,163,69,85,35,95,96,43,60,10,209,123,63,5,78,
+    9,135,170,1,218,129,100,189,150,201,78,217,164,96,88,195,194,166,220,153,208,182,69,250,165,87,161,99,243,224,40,49,
+    181,22,141,162,189,253,214,145,41,230,176,205,63,254,71,63,191,211,33,3,215,11,8,158,174,124,182,38,1,40,170,132,
+    212,219,1,184,151,65,136,249,36,115,204,55,51,209,52,45,63,186,68,115,9,221,64,251,109,240,247,139,137,15,7,165,
+    199,233,0,128,58,41,145,197,203,61,61,215,4,33,162,30,240,192,224,64,65,28,110,49,66,2,81,172,227,130,84,236,
+    6,79,142,245,203,99,117,16,53,140,205,108,175,48,142,48,236,29,89,64,50,60,121,72,18,237,93,198,17,125,216,107,
+    218,84,197,6,227,9,221,0,144,165,1,235,14,206,206,1,195,152,85,59,85,170,152,148,189,249,127,214,56,130,232,76,
+    154,41,143,6,146,175,201,20,226,172,92,212,228,3,198,136,181,52,162,25,29,12,98,12,18,121,161,131,162,175,21,133,
+    31,153,145,252,65,144,56,170,30,200,236,129,187,133,130,130,28,190,248,203,0,96,223,63,235,153,59,171,178,236,160,136,
+    189,45,138,211,138,67,26,216,196,206,94,197,61,75,122,72,89,74,145,179,225,58,219,65,104,77,76,221,241,107,157,61,
+    193,93,20,210,117,201,232,65,22,90,206,138,203,193,110,67,16,90,196,242,171,84,57,230,65,204,136,15,100,135,48,113,
+    61,86,200,140,99,105,219,94,39,93,172,84,27,197,43,54,73,201,136,76,97,194,34,169,217,131,164,232,29,208,80,29,
+    46,38,175,135,69,187,145,197,185,96,121,197,56,118,162,117,207,16,222,173,8,86,97,2,83,185,36,156,217,225,186,158,
+    163,172,214,147,228,5,168,67,67,159,135,5,104,198,179,1,165,45,163,28,134,104,120,70,76,240,182,13,154,114,167,10,
+    196,50,36,130,0,136,154,147,103,193,30,127,218,186,220,54,63,48,229,168,108,184,88,36,56,84,96,235,148,73,105,43,
+    166,252,92,149,35,155,68,192,68,185,59,241,127,91,222,162,137,83,186,235,34,248,191,20,81,36,16,105,128,20,144,212,
+    50,243,243,173,10,18,39,138,31,45,234,230,200,107,27,57,209,106,60,61,157,248,222,129,68,75,180,111,229,84,184,172,
+    254,30,59,7,107,137,123,48,69,141,144,113,132,168,168,101,12,70,225,108,22,218,135,188,249,133,130,118,85,202,253,207,
+    147,72,32,142,101,56,48,51,0,49,172,30,44,131,209,34,29,245,223,89,93,137,239,246,138,199,170,126,154,40,189,97,
+    4,64,189,127,87,235,94,162,88,248,185,136,2,41,134,137,157,115,204,48,84,183,146,75,95,168,124,235,82,23,178,193,
+    24,201,12,31,98,201,68,94,199,84,169,159,160,140,242,116,8,106,47,196,91,227,43,23,100,156,172,61,124,195,164,44,
+    224,216,174,101,254,219,173,86,73,13,60,112,33,245,217,132,238,140,209,118,137,61,130,9,216,242,2,157,40,227,182,150,
+    58,18,60,70,164,157,0,33,227,231,64,115,146,125,103,86,175,6,86,89,83,46,6,152,172,12,32,81,155,40,249,176,
+    243,245,149,123,241,228,146,232,234,100,0,184,202,168,176,59,143,93,201,75,68,228,42,57,24,24,174,213,28,32,0,63,
+    150,9,15,98,82,222,110,9,119,10,231,203,145,211,23,38,169,65,24,91,70,174,206,169,194,104,210,6,36,99,38,90,
+    120,59,96,18,107,151,117,188,66,67,130,108,159,132,172,253,131,93,128,45,212,43,19,68,113,33,214,7,49,81,211,249,
+    139,215,204,221,165,114,18,1,44,14,86,139,50,144,106,221,113,124,186,151,197,199,197,222,151,233,0,83,97,34,144,22,
+    103,13,57,81,121,48,124,75,40,23,252,3,86,111,165,224,72,8,177,40,36,87,137,99,106,181,234,70,139,231,153,187,
+    26,111,187,210,174,245,237,112,0,193,143,163,144,43,102,13,239,217,207,224,58,136,104,223,101,89,64,0,189,54,102,43,
+    15,222,112,33,5,252,14,192,41,87,212,61,89,136,74,173,231,100,232,109,200,184,35,134,231,162,158,54,54,184,230,114,
+    89,236,84,16,242,117,214,91,239,9,129,19,116,54,220,181,67,117,29,33,215,68,6,141,48,196,201,85,43,116,49,141,
+    163,240,68,147,12,69,168,218,112,231,38,244,253,117,8,141,29,97,174,208,243,177,135,175,96,19,232,1,132,252,176,111,
+    106,179,169,154,79,132,240,81,170,2,209,212,187,114,77,130,142,231,64,29,15,88,46,1,155,184,144,176,56,18,57,162,
+    199,24,190,213,156,168,104,209,122,92,166,33,254,228,36,181,217,94,184,106,196,29,235,29,185,67,253,219,180,138,28,56,
+    128,139,31,36,121,89,44,233,75,30,151,88,123,242,75,63,250,79,131,234,177,233,39,226,68,12,91,114,59,161,109,147,
+    147,160,202,168,235,12,212,128,15,181,82,233,2,114,104,25,133,82,52,164,192,30,171,185,208,9,177,98,240,218,137,8,
+    74,78,167,57,199,44,130,38,100,214,39,216,92,105,126,4,225,200,0,138,153,189,38,113,186,32,226,138,229,59,86,239,
+    165,154,155,179,235,65,142,57,107,99,16,248,190,155,144,94,113,3,219,200,225,179,29,230,114,40,51,60,122,166,186,108,
+    152,122,53,170,5,12,78,86,89,32,243,70,109,81,205,1,175,200,83,66,25,142,63,37,168,13,229,205,119,168,141,155,
+    223,137,50,106,219,182,152,129,124,98,233,128,113,4,178,171,235,187,166,102,251,45,219,97,87,228,151,5,22,180,99,199,
+    222,227,22,214,199,204,56,114,194,16,127,52,36,147,240,166,52,129,4,26,150,70,116,156,177,232,64,24,156,50,152,228,
+    224,120,14,141,131,2,225,36,71,254,227,14,220,57,17,196,4,241,222,12,144,125,46,3,254,184,134,175,37,192,47,128,
+    54,208,8,195,77,54,218,13,56,8,91,199,114,167,178,207,86,25,161,150,237,222,48,167,28,217,202,75,241,165,8,241,
+    153,215,220,100,8,52,164,82,49,119,154,33,111,109,36,249,112,222,46,97,45,219,21,8,255,149,203,204,127,94,131,250,
+    163,176,249,36,177,222,243,15,26,175,253,129,75,117,228,214,248,140,136,38,12,230,148,20,71,199,195,242,55,177,65,57,
+    18,6,69,63,235,56,57,108,189,53,200,168,114,112,74,244,100,0,160,23,102,117,76,196,155,189,104,148,167,242,179,241,
+    19,226,13,114,103,115,162,247,9,139,144,50,199,222,49,19,157,217,170,119,169,40,226,111,127,102,64,50,92,219,37,119,
+    172,8,95,41,161,212,225,200,151,248,156,26,212,115,55,32,203,245,41,189,187,74,138,199,102,220,156,191,165,36,169,61,
+    214,154,187,188,90,11,224,58,224,50,173,204,28,81,36,96,205,159,36,39,231,0,237,9,100,89,180,47,195,189,131,102,
+    48,177,104,62,67,203,217,12,64,201,82,82,197,91,78,16,183,146,103,202,47,205,125,106,50,29,132,215,188,117,64,183,
+    8,169,35,125,123,160,59,128,172,63,127,247,70,231,72,216,127,62,54,241,245,161,122,146,128,14,161,185,101,53,70,152,
+    138,193,236,8,50,150,228,21,64,14,88,25,223,65,172,82,118,165,3,94,131,35,184,177,36,176,194,79,48,12,71,207,
+    201,75,40,19,56,144,0,251,248,58,135,107,32,157,26,213,118,112,201,114,189,170,21,92,166,238,187,143,39,144,95,174,
+    93,8,243,88,90,0,160,209,248,105,116,209,240,149,72,33,236,68,118,125,207,119,104,207,140,152,2,34,150,226,116,40,
+    236,248,146,168,230,164,17,19,156,204,158,109,52,74,217,53,234,181,79,160,97,248,72,210,174,127,149,18,51,19,193,140,
+    106,3,72,244,86,177,61,175,253,217,25,85,171,142,50,12,74,53,151,18,4,156,162,97,41,245,213,22,16,100,84,168,
+    70,145,53,85,170,41,220,219,252,223,108,16,165,107,147,13,59,192,190,12,113,14,32,177,251,132,226,189,14,128,153,17,
+    41,244,131,56,98,80,218,90,138,62,62,169,171,170,186,17,221,9,232,129,136,127,134,184,196,111,26,247,83,250,196,63,
+    42,159,169,4,102,80,172,167,211,232,124,208,36,195,39,178,213,195,10,153,71,14,33,83,85,42,184,205,211,238,26,132,
+    211,136,107,96,172,60,116,159,26,90,39,131,14,77,9,240,61,172,89,227,101,24,20,127,217,254,144,236,134,237,46,172,
+    38,22,152,248,157,149,21,227,212,95,254,198,147,45,72,124,128,18,236,83,113,95,80,105,238,28,34,132,138,183,57,107,
+    253,22,216,95,117,194,93,81,46,144,27,230,227,227,3,143,11,209,248,6,39,172,2,39,139,188,75,144,189,18,163,154,
+    252,31,224,13,246,243,94,103,12,12,190,65,195,168,174,2,255,155,111,136,207,3,212,94,161,25,112,181,59,183,222,26,
+    101,200,46,96,235,45,66,34,81,129,218,198,162,21,57,229,147,60,134,196,61,49,49,171,114,207,144,11,28,120,90,175,
+    52,234,208,159,116,52,236,178,25,41,23,208,142,31,249,171,42,76,230,204,229,64,193,242,35,127,69,162,20,137,246,131,
+    53,2,174,94,80,77,197,104,158,227,253,110,154,115,142,16,166,180,19,32,69,11,61,82,132,80,17,35,120,169,85,135,
+    95,233,124,248,171,217,69,215,247,221,60,143,135,128,153,147,219,160,161,65,190,10,141,229,70,43,207,62,200,157,246,177,
+    250,147,134,44,203,93,172,201,160,173,96,218,144,105,22,160,120,100,212,185,52,1,68,245,156,175,160,60,1,67,226,102,
+    189,20,102,56,251,249,121,235,24,28,238,166,227,243,7,48,214,136,236,21,131,102,66,211,24,160,243,185,36,93,95,172,
+    83,165,157,204,160,92,62,84,130,187,244,29,187,145,133,187,62,94,131,98,61,238,199,101,67,144,22,22,242,180,243,144,
+    220,49,167,161,3,171,21,73,142,0,217,16,33,141,26,96,183,19,36,183,51,253,94,247,188,48,100,136,33,4,177,155,
+    188,2,103,5,79,69,160,11,25,243,183,71,83,200,55,61,2,35,68,208,160,119,12,72,37,135,108,178,145,159,42,79,
+    2,219,222,92,73,178,74,250,128,130,36,127,201,118,238,222,60,175,242,225,230,123,57,71,218,238,182,49,164,0,177,109,
+    199,20,181,67,128,198,220,48,255,184,172,9,253,239,33,8,41,177,18,202,195,33,129,231,255,90,128,73,140,83,106,70,
+    82,120,19,85,122,79,85,59,56,67,36,161,225,114,248,236,139,65,67,115,110,123,96,97,110,222,211,168,168,197,160,139,
+    54,25,210,200,53,40,92,91,4,80,4,203,176,104,49,72,143,120,24,54,67,191,18,187,80,96,86,170,103,200,129,116,
+    228,86,62,60,184,228,5,222,4,131,13,131,175,102,157,124,3,145,137,117,22,80,57,162,89,91,108,97,23,62,44,118,
+    216,212,36,120,81,93,49,103,126,10,162,48,180,34,252,0,216,204,208,35,227,218,19,161,54,96,225,94,138,93,142,36,
+    222,238,24,230,173,212,222,46,41,248,9,86,144,225,236,14,55,214,94,17,69,63,76,174,98,66,121,101,82,130,68,33,
+    246,240,128,166,238,50,83,180,33,80,144,52,79,250,0,16,208,225,12,228,102,95,48,118,59,212,229,228,75,61,194,151,
+    216,163,48,14,108,15,93,127,230,242,77,149,190,122,197,130,184,168,114,206,165,51,188,167,132,173,192,152,225,72,10,160,
+    194,227,84,78,21,0,56,63,192,108,25,68,10,90,226,43,152,140,199,146,230,80,7,180,70,0,6,15,231,87,55,39,
+    6,19,43,18,249,31,105,19,96,175,125,73,160,179,168,155,172,176,11,192,152,247,8,198,10,26,241,230,161,196,28,105,
+    57,209,222,233,146,66,106,11,49,26,192,177,248,33,172,124,117,143,108,12,153,128,81,250,188,12,230,232,3,215,213,247,
+    164,127,1,16,160,192,39,41,32,98,135,30,125,18,26,118,197,139,144,93,169,1,164,187,122,92,127,67,247,7,165,114,
+    0,58,16,234,12,237,242,25,139,196,241,110,232,117,114,75,208,86,6,77,226,165,138,145,65,22,182,176,136,210,156,195,
+    174,249,187,212,5,1,2,164,67,77,196,219,105,151,217,58,146,1,158,37,25,247,121,3,255,25,73,103,237,39,90,107,
+    130,232,231,65,245,42,0,160,188,30,204,57,9,134,207,14,18,207,115,80,178,82,175,146,73,237,45,131,58,5,215,80,
+    135,206,145,36,249,151,112,17,168,67,202,179,146,133,234,107,224,145,46,209,121,116,96,225,144,219,238,103,8,117,55,48,
+    155,146,196,143,225,22,196,226,48,222,50,222,210,54,153,144,53,233,225,52,243,141,42,227,34,169,147,38,101,209,143,20,
+    93,182,194,8,252,79,185,209,113,120,5,28,178,152,86,125,3,222,30,71,218,99,115,78,120,77,140,232,115,26,57,168,
+    200,154,126,157,149,162,197,172,218,249,17,208,66,41,115,120,220,70,182,124,233,227,44,150,246,221,61,181,220,85,30,146,
+    19,211,35,1,184,65,28,248,119,223,114,224,92,241,88,1,88,101,97,187,30,29,27,31,196,48,21,52,99,110,166,153,
+    77,109,6,95,181,27,236,60,42,114,250,152,242,21,150,113,43,111,68,185,106,248,168,255,120,19,204,192,30,13,203,248,
+    3,89,104,225,104,142,123,183,95,184,211,30,157,74,74,161,104,206,230,167,4,221,177,108,63,34,58,201,105,80,56,176,
+    11,24,176,216,137,167,166,41,46,239,205,144,155,228,69,217,185,10,37,179,182,176,72,181,27,5,41,81,87,138,138,67,
+    200,159,77,121,114,149,107,252,173,56,122,152,143,63,99,209,19,232,170,63,120,80,172,143,59,179,197,144,24,88,119,30,
+    117,32,58,217,244,123,130,97,201,125,202,18,166,194,112,47,152,94,253,224,30,234,232,176,182,82,208,73,146,164,229,88,
+    112,203,153,131,103,138,128,93,10,245,140,156,117,255,164,10,209,42,18,91,22,2,68,185,39,24,84,4,51,196,215,42,
+    152,168,116,132,104,168,224,118,134,152,140,89,167,135,228,48,235,241,186,49,26,194,168,165,255,42,147,87,159,21,95,49,
+    26,112,226,177,155,74,221,233,251,186,4,44,102,64,196,137,157,65,17,162,119,216,126,112,107,127,228,248,66,237,222,219,
+    29,182,67,188,201,31,231,148,82,150,213,222,115,124,0,164,42,120,169,213,41,100,91,13,217,32,110,13,131,166,113,202,
+    54,52,39,113,129,57,186,135,253,227,240,9,240,187,63,32,157,146,3,149,180,50,161,0,21,39,9,79,234,102,102,38,
+    118,150,56,26,54,133,126,107,182,183,92,84,137,42,222,32,76,153,246,137,102,221,137,208,5,132,139,12,149,64,88,63,
+    239,129,64,167,142,28,208,171,94,0,29,180,2,177,248,58,80,57,3,43,93,32,159,30,142,34,60,166,173,13,49,218,
+    49,198,176,134,57,126,196,69,165,238,198,140,60,1,106,89,108,52,76,65,41,236,102,117,110,162,2,37,112,136,175,199,
+    87,107,217,238,14,42,37,182,77,171,208,2,157,145,163,233,129,237,245,26,38,189,113,107,46,165,160,229,206,236,179,159,
+    65,242,49,119,200,11,65,128,133,189,185,165,229,240,78,218,130,67,112,32,217,22,68,107,235,129,27,134,251,175,20,216,
+    191,135,10,182,45,29,24,34,111,247,225,162,42,16,196,197,146,39,152,66,86,223,158,86,1,44,165,164,107,201,129,186,
+    251,231,134,25,180,246,108,31,216,225,150,63,96,226,139,154,46,174,29,245,23,67,161,116,165,128,34,155,52,136,48,90,
+    137,247,49,181,126,26,240,48,31,39,228,140,200,222,40,66,87,255,0,62,38,135,105,56,59,248,220,133,128,7,157,46,
+    246,58,202,55,147,69,238,47,123,119,193,96,205,64,104,69,225,139,216,112,233,198,232,191,138,98,42,196,78,195,55,110,
+    3,91,10,96,73,43,78,153,205,154,225,42,224,182,202,27,88,51,10,107,42,30,13,158,137,246,17,51,92,26,18,244,
+    114,57,188,193,108,176,185,217,240,236,97,166,250,48,61,96,27,39,199,108,232,143,200,124,178,6,84,47,246,171,112,138,
+    160,42,153,106,194,241,60,49,223,1,150,1,225,1,97,136,170,184,196,157,199,78,169,9,227,152,105,55,112,15,33,37,
+    100,61,224,82,231,31,150,189,126,203,2,130,250,84,121,209,3,153,226,93,188,143,34,248,1,24,165,226,206,69,75,175,
+    69,198,185,204,43,38,141,150,64,216,127,146,57,147,198,246,252,75,117,186,50,192,9,224,53,58,33,83,254,254,229,138,
+    145,83,93,149,0,80,16,138,37,160,140,193,194,89,26,79,121,23,218,155,60,142,210,143,31,8,111,56,64,113,200,65,
+    80,21,49,102,96,103,194,104,46,142,177,14,185,112,21,52,50,14,155,65,25,167,152,50,125,10,185,70,236,150,48,122,
+    24,58,35,0,1,14,26,19,126,35,61,76,155,92,64,240,235,130,157,100,205,85,237,6,126,210,233,83,57,43,136,149,
+    184,31,22,242,117,210,172,215,177,33,200,252,31,192,207,46,70,15,163,225,47,20,19,87,166,140,91,160,228,219,182,207,
+    134,144,216,221,142,39,86,161,254,118,196,107,192,51,207,117,36,32,21,83,96,95,12,176,70,188,115,57,252,133,17,143,
+    98,192,106,81,93,83,149,2,166,20,182,101,52,129,20,149,19,224,76,2,44,141,29,17,85,141,150,23,80,63,119,59,
+    158,148,200,193,111,141,252,255,3,113,52,159,216,146,65,34,82,2,180,120,135,203,91,207,134,194,14,227,245,58,2,234,
+    36,117,10,114,91,162,170,108,153,205,22,202,62,239,165,22,70,202,149,33,9,8,73,225,85,29,78,58,161,68,122,78,
+    58,84,68,3,50,170,203,48,134,235,27,183,90,2,121,191,34,196,90,233,49,247,123,192,57,59,14,160,9,187,74,85,
+    102,144,112,63,241,147,227,16,81,30,99,82,178,230,244,131,70,234,170,133,24,121,209,45,109,38,41,38,208,170,73,252,
+    99,225,187,102,110,151,236,252,53,190,209,190,121,211,223,243,50,232,34,235,36,140,130,38,195,208,139,4,88,115,12,252,
+    219,40,2,63,124,65,235,220,126,172,234,127,202,175,226,160,147,32,70,6,226,171,68,12,213,107,7,233,73,112,193,4,
+    185,153,243,117,202,43,42,10,213,64,104,104,116,104,8,218,228,88,16,184,49,70,248,113,232,7,146,27,27,3,148,211,
+    216,29,94,229,247,1,167,160,88,111,23,159,21,197,55,167,210,47,15,156,141,63,80,41,65,132,161,162,136,126,0,36,
+    171,88,140,162,229,109,240,83,204,144,26,159,95,61,111,114,95,128,96,206,68,189,69,197,42,161,100,238,170,230,64,30,
+    64,13,225,76,98,108,49,107,17,246,243,58,143,160,254,196,244,219,138,116,65,71,93,30,4,69,206,9,171,15,84,29,
+    89,129,26,208,138,200,130,175,97,215,14,12,111,22,83,44,205,80,132,192,43,167,66,84,40,179,5,58,5,17,83,14,
+    45,239,153,101,42,167,121,226,149,85,196,223,92,123,238,179,246,66,150,146,109,124,46,162,179,25,59,191,236,134,225,193,
+    147,105,101,208,35,187,54,34,166,218,253,209,87,87,250,14,78,89,132,82,145,47,80,212,167,121,48,224,84,234,155,147,
+    153,48,225,221,253,101,97,173,28,154,64,57,114,115,122,2,195,51,22,235,179,92,76,136,75,153,198,155,161,116,76,115,
+    144,6,17,24,61,204,212,61,141,66,202,17,42,129,153,230,122,119,85,208,8,98,79,203,116,200,251,2,165,156,190,115,
+    29,234,220,164,76,98,69,107,191,163,42,31,97,145,58,76,24,222,40,149,13,150,24,231,57,18,99,111,156,8,44,208,
+    136,78,117,33,47,14,236,80,21,34,21,24,190,17,191,158,19,7,84,85,41,176,214,222,47,30,125,78,14,172,113,198,
+    209,229,68,48,128,192,183,132,161,220,37,200,235,184,100,86,96,17,233,25,18,155,20,80,233,34,216,162,67,46,248,210,
+    89,218,88,14,190,113,221,133,171,115,17,221,9,215,65,136,214,155,143,237,27,27,72,140,196,26,40,127,144,173,209,146,
+    179,224,90,22,29,19,42,24,76,197,22,132,29,34,66,100,1,76,143,198,146,92,139,34,172,237,182,69,192,94,22,92,
+    115,86,161,116,212,232,127,92,80,84,127,19,106,44,26,141,218,35,87,188,146,157,250,237,44,96,152,229,91,232,188,177,
+    253,161,60,103,194,141,106,174,30,15,68,111,31,162,8,13,201,144,68,209,140,132,34,122,42,71,2,42,30,204,39,177,
+    87,253,51,147,229,97,41,86,100,30,33,229,179,163,119,126,100,123,147,192,24,65,68,123,167,139,42,78,65,91,188,14,
+    229,194,35,1,81,21,52,111,142,93,241,15,23,209,12,45,68,99,180,208,26,78,242,114,202,0,118,193,65,42,6,30,
+    98,138,176,41,252,127,69,5,212,113,189,168,235,134,125,127,43,78,148,206,199,35,5,231,4,223,62,59,94,42,80,33,
+    162,225,227,86,133,164,248,95,178,140,121,172,123,69,200,208,83,207,182,166,69,65,67,163,140,57,61,168,213,43,232,166,
+    128,24,186,153,144,60,160,0,100,224,146,9,16,99,9,36,34,69,98,27,103,33,4,128,26,170,18,212,0,65,97,92,
+    141,165,126,60,81,25,216,216,148,11,205,208,60,33,245,139,19,50,102,234,216,156,116,30,89,52,146,111,44,49,113,134,
+    47,156,43,103,24,67,171,103,116,3,67,40,16,120,48,136,158,221,124,158,143,62,180,209,0,161,45,219,159,66,12,144,
+    81,104,240,129,43,69,82,244,39,124,88,144,22,75,91,51,206,21,163,117,65,229,6,61,14,116,184,166,171,122,75,190,
+    224,202,165,195,114,14,198,146,252,248,103,166,168,21,127,177,26,219,24,7,107,38,34,240,58,76,123,71,14,63,115,23,
+    110,23,28,172,1,47,32,212,120,241,101,71,227,151,12,8,254,174,76,78,206,17,127,25,92,164,77,2,143,58,228,237,
+    129,61,171,134,6,145,32,79,16,33,64,117,141,102,57,36,129,60,151,30,41,225,240,175,139,48,75,148,108,7,133,78,
+    159,40,55,152,133,169,153,18,200,89,71,70,162,2,205,187,62,99,144,19,3,209,222,6,69,170,162,218,71,86,39,60,
+    171,181,51,32,104,76,239,19,228,127,68,8,110,47,219,125,149,68,67,174,206,69,208,171,139,171,97,163,139,189,197,201,
+    238,19,105,202,232,221,220,205,172,167,211,202,223,236,54,140,200,170,5,197,44,50,58,24,29,35,138,254,60,48,37,217,
+    191,60,242,132,110,153,22,44,157,69,67,221,5,62,75,107,197,76,188,109,196,235,182,131,117,18,161,189,109,175,22,121,
+    140,134,124,57,134,97,202,96,1,14,84,136,130,177,12,225,9,42,54,80,111,107,29,194,90,130,182,229,99,139,63,100,
+    88,202,186,34,23,142,130,137,38,115,240,105,203,68,172,88,190,51,187,44,50,83,244,118,218,217,165,192,49,10,229,200,
+    201,114,158,213,246,82,95,33,31,32,41,156,64,66,153,88,239,4,154,39,187,69,145,118,36,2,71,241,227,110,138,36,
+    12,63,35,8,95,174,67,59,91,84,113,120,14,172,129,194,69,69,12,81,165,39,56,49,223,109,54,251,169,2,28,251,
+    164,170,23,244,23,195,153,144,84,127,199,225,203,187,96,72,108,41,42,71,39,15,174,191,84,6,124,22,150,65,188,5,
+    74,81,192,251,208,252,249,140,163,180,37,177,46,153,128,54,232,158,27,70,103,166,53,71,242,140,60,235,212,26,171,163,
+    18,217,154,113,47,164,9,22,201,94,255,146,71,83,6,101,199,170,53,63,141,8,136,55,189,215,50,201,173,24,154,152,
+    10,108,249,165,54,176,240,172,2,89,55,78,145,8,115,30,199,34,251,90,136,98,254,54,224,153,67,157,45,231,219,244,
+    94,203,193,175,143,152,58,117,164,232,28,161,240,36,129,205,117,184,150,93,99,209,164,219,80,43,238,176,239,153,61,146,
+    66,131,229,197,54,128,181,48,99,230,51,25,129,144,232,50,178,53,98,146,20,156,124,211,137,128,8,163,7,189,108,192,
+    149,76,189,220,0,249,197,124,183,134,8,31,165,200,83,250,75,249,163,157,91,23,196,230,3,17,78,43,116,36,93,57,
+    241,138,16,128,99,3,192,155,131,12,1,92,115,8,30,244,214,43,228,241,31,193,117,166,8,68,177,235,106,43,167,211,
+    68,251,59,70,93,183,249,165,215,180,22,54,107,146,231,90,240,24,0,13,125,56,179,77,81,117,78,85,76,67,238,20,
+    226,0,209,182,194,57,45,67,73,252,178,204,154,51,198,1,143,84,197,97,45,181,145,84,164,198,225,176,110,164,20,117,
+    59,58,59,101,144,82,159,168,153,23,76,72,62,123,166,113,157,245,179,88,23,214,140,25,55,193,65,173,20,5,34,250,
+    44,216,74,70,179,61,227,74,129,214,40,122,162,16,184,51,1,132,191,24,85,26,194,121,168,49,212,50,129,175,235,117,
+    160,38,50,179,203,164,81,96,14,64,197,72,84,224,215,115,4,5,84,98,139,211,124,1,211,52,63,164,253,13,179,148,
+    136,44,229,199,64,237,20,45,210,52,28,168,184,107,104,156,231,104,19,43,4,91,7,150,71,10,5,76,80,71,21,94,
+    26,204,240,225,160,55,60,40,209,32,198,135,114,106,130,121,219,48,214,71,0,118,68,215,189,99,209,90,146,0,108,236,
+    166,207,49,85,61,21,177,105,144,103,253,248,87,27,178,77,116,37,155,170,173,190,127,116,86,124,97,105,25,36,15,102,
+    115,5,137,33,132,78,5,19,88,124,241,148,185,170,202,62,63,113,98,114,114,66,62,145,40,190,67,86,6,203,40,29,
+    65,97,118,71,249,177,142,151,17,125,109,69,210,56,108,224,248,16,32,4,33,82,118,201,68,221,182,80,86,111,104,26,
+    217,254,166,198,98,6,100,98,253,181,181,19,28,42,196,103,43,210,161,52,166,2,35,71,86,148,141,20,15,166,56,99,
+    77,23,44,211,38,110,105,130,99,23,155,46,11,56,49,18,216,110,98,197,23,77,160,247,241,213,81,61,121,166,46,117,
+    98,183,51,181,123,233,224,169,250,54,108,145,25,108,24,129,139,29,150,194,67,197,186,135,75,253,100,94,177,198,203,99,
+    60,166,169,106,101,45,149,165,248,203,186,98,63,167,170,139,44,151,160,220,195,220,209,54,168,21,84,4,187,202,144,65,
+    147,245,161,23,122,93,178,138,251,70,240,68,36,5,209,147,9,179,24,186,235,94,40,189,167,253,18,94,255,98,165,192,
+    224,52,185,87,77,69,126,193,103,45,91,228,43,216,87,159,49,87,107,153,114,42,139,129,168,229,162,247,176,106,104,167,
+    152,197,24,144,210,115,8,254,138,221,11,1,30,45,99,130,193,5,91,92,63,232,130,120,174,44,88,104,97,132,115,226,
+    241,253,136,244,169,218,246,195,146,83,68,104,194,158,24,140,208,14,206,212,56,1,144,235,20,151,211,51,210,164,213,201,
+    247,101,13,59,177,148,123,246,55,106,225,197,18,181,35,4,145,44,62,113,103,223,121,17,20,74,141,234,244,89,215,34,
+    212,238,26,105,7,28,32,78,189,9,162,164,135,43,138,230,207,65,40,218,70,8,40,196,223,248,225,61,180,51,223,53,
+    82,114,90,250,107,108,94,118,34,195,138,71,179,62,197,108,82,199,17,11,18,74,234,173,247,111,227,42,17,15,100,30,
+    218,9,8,25,107,241,146,43,65,128,22,220,186,15,254,217,161,134,226,143,45,186,80,126,238,25,21,14,206,252,244,56,
+    69,50,157,238,255,107,89,224,52,239,31,43,124,34,150,109,50,144,22,148,206,29,95,121,149,130,33,109,194,208,126,42,
+    162,48,81,170,102,50,9,209,35,8,90,35,18,23,58,41,197,155,120,152,49,22,254,9,124,62,61,1,11,127,83,180,
+    73,119,177,25,130,73,201,132,5,199,61,28,207,68,50,123,39,194,205,224,100,252,238,176,9,54,230,44,15,46,69,102,
+    199,221,160,18,56,233,239,30,217,69,152,61,23,223,49,211,121,251,226,200,253,250,222,103,161,128,20,109,69,84,157,16,
+    152,93,90,96,199,147,147,112,223,248,209,208,116,110,143,10,71,206,216,41,176,218,149,136,66,60,57,247,228,240,192,107,
+    84,97,148,127,34,7,209,215,244,254,177,111,98,17,208,227,67,8,114,106,28,254,193,17,239,88,184,166,47,124,107,27,
+    16,146,79,107,71,25,47,255,22,204,163,156,191,10,247,25,130,181,140,31,70,186,73,241,145,52,1,13,251,66,17,64,
+    212,204,88,195,65,160,6,242,221,96,109,101,168,101,98,205,205,7,252,60,61,12,157,3,2,92,223,208,99,53,18,0,
+    166,142,72,131,196,97,0,189,31,40,241,6,99,28,106,105,138,83,1,74,81,107,102,97,79,145,97,28,72,47,11,9,
+    27,28,208,106,226,172,199,16,194,10,69,165,104,247,36,145,242,120,171,87,155,235,238,76,93,69,239,15,126,235,1,23,
+    142,86,248,195,169,12,237,38,53,160,57,138,83,13,202,155,227,132,91,147,180,154,212,195,166,137,174,19,15,129,13,10,
+    189,163,100,70,141,6,64,159,32,141,68,152,77,193,217,222,32,56,52,24,97,208,146,112,13,121,120,207,238,20,147,73,
+    151,181,145,60,46,123,1,75,231,154,228,45,87,93,120,93,72,95,229,146,60,174,214,249,163,171,135,88,95,206,197,142,
+    141,66,26,179,49,169,97,73,73,152,64,140,32,166,52,186,225,177,246,56,17,104,233,152,180,37,54,106,81,129,250,201,
+    10,186,24,46,97,110,188,181,226,240,250,222,89,207,25,212,225,255,20,142,69,126,114,80,234,71,80,146,45,46,185,226,
+    72,129,78,39,35,73,253,56,46,154,17,109,104,181,3,202,10,173,72,31,65,221,227,68,0,9,171,168,35,3,186,84,
+    24,3,85,64,229,88,186,55,190,225,205,29,133,208,37,63,106,254,198,68,66,16,144,25,151,176,89,27,185,75,17,145,
+    90,65,72,62,119,116,169,6,218,112,12,152,217,169,21,13,64,158,140,243,215,113,39,109,137,175,147,24,228,43,132,99,
+    70,199,29,246,240,0,16,82,49,89,29,194,93,241,128,229,155,163,252,16,141,123,202,237,243,149,148,121,167,122,42,35,
+    9,144,136,255,50,74,212,81,87,8,148,131,30,5,176,96,37,89,54,105,187,218,3,2,132,140,177,146,96,178,100,196,
+    5,74,216,79,15,194,175,107,136,108,130,33,67,90,202,157,124,88,15,33,237,240,170,200,124,163,225,208,96,78,44,129,
+    210,88,210,204,13,32,120,183,11,28,157,228,15,80,133,40,78,10,47,95,158,2,105,73,104,105,137,127,31,192,66,136,
+    212,8,250,18,51,9,28,163,100,121,11,162,189,239,97,131,229,100,182,169,180,43,185,16,204,165,114,250,89,38,56,64,
+    217,129,15,195,34,246,91,24,53,68,29,137,174,15,240,238,137,193,152,203,167,37,150,3,221,105,89,175,9,144,195,48,
+    222,59,246,160,23,115,53,20,199,117,54,63,51,21,95,118,171,220,241,70,140,75,61,35,156,68,26,17,127,16,122,208,
+    75,48,78,157,13,223,170,214,37,24,218,159,92,54,231,90,73,235,251,188,160,137,183,189,40,211,64,90,15,202,52,138,
+    233,45,95,83,151,245,192,159,221,123,121,166,149,161,50,23,181,5,1,28,69,68,136,108,83,20,119,28,112,215,167,228,
+    2,216,229,7,155,80,191,246,188,74,255,86,12,157,188,54,70,67,183,20,168,144,35,231,19,69,173,123,91,201,142,254,
+    202,97,22,224,210,218,119,41,231,46,26,252,34,5,72,178,67,224,206,115,147,131,71,155,53,207,144,52,164,179,247,6,
+    229,74,102,89,137,140,4,93,243,211,241,98,57,76,186,60,62,90,87,90,218,223,34,174,179,162,54,188,135,111,99,38,
+    1,240,18,92,177,202,121,44,177,136,93,203,46,57,117,90,227,13,92,88,1,41,71,226,14,23,173,106,200,72,4,72,
+    13,160,43,111,94,113,119,110,113,244,4,209,105,95,21,135,152,136,169,102,53,19,189,231,252,163,137,10,192,181,241,8,
+    10,135,9,65,59,119,166,76,13,48,208,212,120,235,135,34,39,193,37,72,195,88,179,24,191,144,107,186,151,63,17,24,
+    133,209,60,28,218,19,61,86,202,100,153,204,70,92,113,27,223,64,149,29,18,70,240,112,145,99,183,0,153,58,157,199,
+    37,231,21,192,126,8,82,141,93,49,183,60,59,253,149,0,175,34,184,93,21,44,108,46,145,141,37,121,239,105,181,19,
+    93,64,176,200,166,161,52,178,82,135,73,106,75,133,224,27,161,82,78,122,208,10,220,226,71,95,106,216,188,25,206,245,
+    205,80,144,54,96,172,98,108,237,209,147,30,115,171,29,166,187,144,93,46,204,227,39,144,202,86,191,225,65,9,189,16,
+    118,9,166,76,140,216,20,21,103,52,171,200,223,213,14,4,97,212,193,30,161,162,25,46,202,185,246,28,15,66,61,113,
+    76,29,171,85,19,216,197,44,2,235,204,206,44,132,19,56,53,45,194,224,108,172,76,230,3,128,199,119,213,60,102,7,
+    212,196,94,197,4,156,95,26,248,209,63,125,40,156,255,12,20,56,28,32,182,116,9,16,89,150,166,154,42,39,248,160,
+    204,90,160,171,64,236,125,61,254,220,46,181,180,138,179,169,165,233,242,58,139,118,83,84,82,12,93,120,8,190,69,79,
+    6,232,20,169,127,214,88,157,139,144,41,195,234,194,237,171,105,4,181,215,134,6,251,251,244,151,117,49,23,214,204,243,
+    124,67,109,84,136,208,255,111,108,12,17,5,137,24,2,73,184,82,174,140,208,223,178,56,197,196,28,163,253,11,182,1,
+    65,4,231,194,169,96,84,18,156,136,114,80,16,223,249,157,217,236,100,65,21,158,8,104,162,226,26,24,204,70,145,128,
+    35,217,72,63,165,157,74,207,72,92,7,56,80,69,222,193,38,57,138,23,241,173,44,132,164,13,75,198,145,47,189,144,
+    134,103,226,144,5,1,20,152,242,233,216,54,245,47,25,45,195,205,118,242,93,85,83,8,141,216,149,149,231,88,229,53,
+    233,62,45,218,9,84,15,252,205,193,146,56,39,136,104,142,80,106,48,16,6,66,120,46,104,218,165,37,66,184,241,73,
+    37,160,13,105,131,70,28,3,72,121,56,164,58,4,75,38,131,196,173,107,213,160,210,254,207,8,175,60,154,227,244,226,
+    185,162,45,114,10,221,56,39,178,139,106,123,42,45,4,60,58,19,166,41,45,7,51,74,65,208,31,244,130,204,3,55,
+    45,166,65,136,226,23,2,38,48,71,91,73,19,131,209,80,238,42,99,126,37,104,180,11,161,42,66,203,114,110,59,7,
+    149,123,10,144,136,205,39,217,199,61,254,121,232,64,70,158,154,24,164,155,231,121,180,149,188,224,69,16,105,102,154,21,
+    41,107,79,183,174,236,108,199,185,242,11,21,129,111,200,102,26,33,76,160,210,8,121,27,22,107,84,22,85,123,176,58,
+    49,79,68,230,121,152,6,20,99,94,58,168,222,57,18,23,64,176,147,1,8,12,127,150,30,12,189,14,178,119,89,180,
+    218,67,68,56,193,192,36,18,49,209,129,98,88,3,29,4,250,2,33,51,37,39,48,6,128,19,175,10,60,142,90,150,
+    52,122,205,193,95,154,18,184,131,25,255,215,70,7,123,41,22,2,170,32,74,46,1,218,19,116,216,17,141,78,164,246,
+    35,95,23,184,47,147,144,209,219,252,189,91,88,32,205,241,126,115,141,142,7,18,228,78,38,32,67,5,204,150,175,88,
+    77,95,145,236,208,88,10,244,29,224,249,196,155,219,109,40,142,78,59,184,180,142,186,228,9,188,87,74,94,64,19,151,
+    97,114,37,105,144,46,178,51,43,160,19,214,237,112,254,122,187,2,75,122,155,219,199,135,107,231,210,150,3,233,107,172,
+    28,219,208,200,112,63,218,113,119,41,248,243,201,182,16,93,88,10,182,235,40,189,217,80,162,46,129,2,20,217,43,60,
+    251,198,142,196,178,195,229,42,56,224,187,124,122,119,216,30,112,225,51,19,27,58,131,51,74,167,174,233,46,157,153,137,
+    234,211,229,93,182,218,63,71,127,20,106,38,17,12,88,1,61,186,11,149,15,232,148,232,208,103,118,98,228,20,131,240,
+    214,6,145,121,205,253,42,12,178,151,64,211,79,188,19,178,86,28,1,64,223,18,84,87,248,105,69,66,218,217,84,13,
+    67,171,123,90,152,105,5,35,234,168,119,143,197,141,52,48,180,15,32,99,122,147,176,143,80,65,44,161,127,158,201,70,
+    132,185,93,73,112,58,81,167,193,2,221,130,104,119,133,165,1,153,65,41,74,234,227,250,126,43,92,119,89,30,46,14,
+    55,128,63,24,242,210,99,73,149,254,18,40,54,183,226,186,224,222,131,153,203,192,67,161,236,132,174,177,26,208,13,45,
+    78,166,230,182,120,249,5,240,23,124,132,53,70,17,6,248,185,224,218,120,52,11,203,161,233,140,42,123,222,202,111,17,
+    71,214,124,141,53,59,3,135,67,63,166,138,1,164,89,110,137,5,161,255,233,211,54,172,233,90,240,74,54,116,168,128,
+    79,11,45,119,232,222,82,120,29,185,128,196,85,182,223,101,87,157,121,134,212,144,30,106,204,131,144,8,224,123,20,168,
+    96,193,160,38,59,203,41,139,139,144,56,159,225,59,218,157,78,9,65,131,7,26,48,32,37,248,225,9,120,13,129,139,
+    88,116,98,202,60,203,80,203,65,11,68,215,202,188,249,180,29,108,149,195,195,136,148,68,122,131,241,161,227,158,97,13,
+    184,126,75,149,17,27,225,140,25,105,59,19,138,208,82,163,163,45,145,22,86,230,222,16,224,43,7,158,177,191,52,123,
+    134,148,70,137,106,245,139,229,171,95,243,216,93,150,236,155,127,199,69,2,145,247,137,192,1,160,63,75,229,237,149,223,
+    144,202,77,191,46,119,56,63,50,172,37,224,147,143,196,189,161,70,107,197,82,53,64,252,208,176,180,213,75,74,171,82,
+    31,56,147,129,6,66,7,77,175,32,135,205,134,46,254,166,38,190,108,119,224,60,36,173,54,245,82,172,168,243,2,42,
+    160,53,62,207,0,220,67,69,35,157,56,154,193,33,75,213,53,208,185,64,179,47,26,229,75,96,29,37,236,230,27,135,
+    230,252,162,92,169,152,177,4,13,185,217,14,222,83,87,72,165,195,208,116,11,18,195,227,234,3,132,10,123,22,106,157,
+    245,180,246,137,44,0,168,53,131,197,23,181,188,114,118,224,112,214,144,82,84,28,180,204,159,20,152,102,192,89,27,127,
+    58,191,33,6,196,201,66,60,183,110,132,64,243,228,232,87,238,229,8,204,65,171,240,153,2,104,117,204,131,72,104,28,
+    140,123,222,86,183,44,138,17,48,218,219,74,143,238,11,152,181,98,47,88,224,96,3,10,65,167,58,169,190,43,180,99,
+    161,103,105,123,26,210,3,255,211,200,145,139,246,224,17,203,154,123,30,50,22,51,162,64,107,40,169,54,193,136,9,116,
+    69,97,157,248,140,204,183,207,68,54,113,126,139,153,19,135,102,73,34,177,113,31,147,4,71,124,4,112,150,97,9,36,
+    192,64,136,59,159,104,154,92,66,2,248,68,170,239,17,188,25,117,208,84,185,79,204,86,188,13,74,247,10,23,51,16,
+    234,14,255,150,103,113,248,0,193,22,33,4,187,193,175,82,169,108,69,135,134,30,90,209,153,136,108,8,34,6,208,0,
+    159,2,112,92,21,70,80,10,139,230,217,232,140,99,105,152,210,166,165,52,204,147,171,218,175,98,130,69,7,102,227,79,
+    214,2,105,56,29,26,95,71,51,52,50,164,35,119,207,90,36,92,159,65,200,166,71,81,23,72,8,75,247,138,141,206,
+    179,126,3,4,100,226,113,129,216,62,92,207,99,47,52,111,9,83,213,22,189,85,12,7,212,139,191,132,88,45,143,12,
+    25,132,34,208,0,164,165,247,114,47,82,179,35,117,240,109,6,63,178,231,42,31,213,15,226,195,232,7,41,217,114,149,
+    142,43,123,210,27,237,47,182,180,156,212,124,90,195,93,141,1,9,179,202,24,168,92,148,118,17,21,214,116,136,80,146,
+    141,70,39,187,210,188,165,236,71,189,128,58,234,108,122,214,105,141,79,4,73,54,150,220,21,81,64,239,63,61,13,54,
+    199,214,2,116,210,51,130,9,113,198,85,252,194,158,233,215,30,26,110,161,178,33,234,156,211,98,115,27,167,12,229,76,
+    101,175,147,148,232,7,155,16,198,53,253,214,169,218,192,81,60,202,32,180,115,164,4,41,47,96,49,10,180,47,196,18,
+    111,8,171,22,73,191,205,138,167,200,216,230,49,224,184,5,218,41,192,208,121,29,231,48,46,240,118,97,39,32,105,142,
+    205,140,162,96,68,21,171,198,147,195,117,105,16,100,233,179,98,69,200,115,134,165,189,44,16,10,48,222,26,10,220,25,
+    73,42,200,188,33,1,173,3,106,144,69,180,1,254,1,109,164,177,19,197,15,196,111,222,141,59,219,83,34,201,202,21,
+    193,113,154,56,205,155,241,193,170,158,185,64,226,223,208,27,20,198,57,71,147,22,36,58,71,152,93,21,117,172,33,161,
+    143,24,234,164,161,150,91,198,0,129,201,42,168,151,27,66,200,112,209,19,139,183,42,251,207,101,144,6,145,121,133,38,
+    36,221,171,168,104,35,59,251,110,10,138,68,44,233,129,213,110,122,191,46,13,115,164,78,8,8,26,111,120,21,105,21,
+    251,127,84,99,212,119,21,17,33,170,130,25,42,168,165,124,147,134,136,118,243,232,245,17,172,114,51,140,205,128,246,130,
+    252,100,105,9,96,228,151,10,216,159,72,152,28,70,134,130,247,176,231,153,94,167,54,92,82,196,105,63,140,127,14,203,
+    71,224,192,69,41,146,122,52,114,13,61,190,134,214,122,100,211,216,78,100,202,63,158,65,130,14,212,108,123,220,112,34,
+    12,117,220,182,172,102,202,136,136,81,25,71,107,114,60,179,15,98,44,144,208,5,140,45,135,204,7,246,202,1,104,30,
+    231,240,53,82,94,60,7,9,118,255,154,140,221,55,252,13,208,37,240,51,119,117,17,240,43,203,182,203,48,115,154,1,
+    85,24,99,130,9,77,97,229,195,156,118,176,161,7,233,19,62,69,190,133,153,159,119,155,197,67,159,69,118,232,53,147,
+    181,174,95,49,61,0,29,115,135,39,145,66,123,236,99,46,4,7,211,46,140,182,192,6,80,189,8,64,41,17,56,36,
+    142,190,180,0,91,214,164,176,39,90,225,181,130,214,220,120,195,240,196,95,9,184,174,181,71,18,39,161,36,108,93,60,
+    75,186,49,248,39,32,56,69,138,200,148,199,53,63,135,88,66,187,20,196,253,244,101,58,67,212,142,30,57,179,34,85,
+    243,7,137,151,74,95,9,152,109,126,175,163,57,202,220,143,223,137,98,164,165,150,97,88,114,183,161,56,0,17,124,235,
+    165,61,19,112,56,148,195,253,20,222,181,150,8,36,252,243,10,139,17,219,103,199,245,131,223,39,138,210,148,51,191,4,
+    11,92,4,227,75,30,208,227,129,206,162,44,215,91,51,52,117,104,124,38,59,58,86,44,43,29,22,110,107,103,70,35,
+    11,14,68,28,74,238,55,73,189,139,110,156,205,166,100,168,0,124,112,194,75,162,241,101,223,249,105,210,153,215,28,235,
+    211,68,168,166,230,217,171,23,15,196,2,65,106,208,165,21,64,249,20,98,193,187,123,124,204,179,218,167,60,56,82,210,
+    149,198,47,55,25,46,72,84,23,85,61,145,199,58,210,127,15,128,113,193,38,117,1,250,227,50,158,122,171,110,202,71,
+    225,73,199,106,199,9,192,188,146,87,88,131,240,157,210,95,207,162,120,230,144,215,129,30,167,26,148,103,54,25,191,198,
+    70,124,130,146,172,164,56,124,74,95,70,200,106,225,146,157,215,12,45,61,152,233,209,62,100,138,73,246,197,182,53,252,
+    22,107,117,125,155,77,139,115,141,209,2,144,13,13,224,159,254,228,91,154,221,128,201,184,215,142,193,101,175,9,1,87,
+    165,64,249,40,197,230,175,92,77,171,38,235,241,0,44,165,134,75,165,49,80,229,157,94,120,96,131,29,238,36,121,237,
+    131,202,215,241,101,228,248,120,130,211,173,167,187,166,151,146,85,232,79,165,204,87,71,100,192,53,28,219,5,2,26,47,
+    43,216,170,223,61,239,254,104,87,200,67,81,87,152,0,248,237,222,138,115,158,102,19,182,185,123,177,6,228,33,214,36,
+    122,60,195,10,4,166,15,208,25,103,17,233,40,194,84,238,113,236,51,151,44,249,149,210,91,163,15,219,43,196,11,71,
+    186,58,121,208,227,129,104,254,11,34,103,208,14,166,240,123,151,88,134,52,105,184,201,192,224,148,81,202,155,163,196,56,
+    210,13,27,60,123,44,18,191,105,170,24,6,160,249,199,190,102,184,178,169,81,6,7,32,231,88,108,75,31,69,128,150,
+    215,153,132,81,151,40,153,122,208,68,192,124,132,126,105,189,221,158,79,56,203,20,170,208,148,91,208,88,154,153,133,173,
+    247,209,49,143,117,103,174,204,92,112,176,21,164,59,5,128,108,66,31,87,215,82,121,81,112,4,244,29,166,145,20,86,
+    153,13,177,46,253,83,0,248,8,50,120,88,77,83,174,29,110,122,4,155,131,94,198,254,247,241,41,21,163,53,174,176,
+    108,160,25,217,149,227,147,140,177,58,5,102,240,8,140,40,29,190,227,90,23,191,106,193,194,233,93,198,45,32,8,82,
+    36,95,75,198,37,248,20,120,44,185,54,193,147,60,76,158,196,1,61,39,94,70,230,91,197,156,97,54,217,144,160,138,
+    188,22,54,238,38,123,39,122,96,91,221,232,86,199,230,33,146,209,199,45,24,230,134,54,112,8,77,68,211,108,112,64,
+    192,69,113,51,0,105,238,97,35,24,196,242,115,57,245,68,226,112,120,193,134,159,68,24,208,32,175,153,150,33,47,190,
+    122,8,39,98,195,103,163,183,195,25,159,108,143,139,187,193,58,164,106,149,221,94,152,164,26,172,147,66,7,149,139,149,
+    73,228,113,144,5,144,19,251,172,12,128,208,225,35,215,34,104,1,1,5,149,254,7,43,149,249,146,224,144,7,184,59,
+    117,128,22,209,30,177,192,69,46,27,5,159,38,62,108,142,105,58,38,67,132,63,253,113,112,224,9,181,73,7,30,234,
+    122,91,237,210,156,123,0,216,202,237,236,166,224,196,158,229,54,112,243,103,48,195,164,175,37,213,190,64,241,8,16,100,
+    126,104,39,167,104,16,10,94,129,130,166,58,199,123,200,102,183,12,24,112,190,164,192,21,78,236,221,136,71,243,205,165,
+    154,38,51,177,58,198,211,238,92,108,46,223,244,154,252,48,14,130,234,156,64,146,196,119,130,209,7,212,101,74,51,196,
+    255,199,197,28,66,135,120,70,32,67,213,184,177,113,144,154,134,240,58,66,41,16,212,162,130,122,81,107,99,212,219,189,
+    174,171,61,2,50,69,173,241,27,136,101,152,196,240,214,234,152,242,29,29,28,22,8,94,71,73,148,61,178,211,23,123,
+    2,252,182,64,132,30,33,39,20,179,105,60,105,34,51,76,48,34,250,15,82,252,28,109,214,157,49,5,243,44,195,89,
+    49,119,239,49,139,251,1,63,91,154,49,76,59,200,10,209,133,216,54,44,185,128,242,47,127,81,101,19,85,193,13,103,
+    221,119,31,188,228,248,200,44,35,80,21,112,228,145,53,246,53,222,255,73,242,182,202,187,217,61,66,21,186,8,126,243,
+    197,146,106,153,248,232,140,36,204,23,43,38,110,204,142,1,176,191,116,65,212,201,214,254,152,31,251,95,19,48,146,234,
+    211,42,231,225,231,44,60,207,217,140,147,123,158,79,58,22,13,45,18,56,190,67,132,193,134,215,70,114,67,111,54,19,
+    130,123,17,116,130,97,68,181,60,24,209,112,250,106,203,184,14,37,32,220,108,240,18,175,115,220,210,48,84,23,0,232,
+    3,206,112,238,80,179,219,153,121,229,115,128,112,141,75,126,217,220,105,89,134,114,15,241,68,17,113,154,92,152,48,12,
+    204,110,180,104,192,176,19,55,151,157,220,106,158,106,85,17,64,200,148,212,236,11,5,21,225,93,26,27,43,137,54,0,
+    18,192,134,214,20,9,90,176,222,3,61,69,66,2,17,136,87,117,175,46,72,145,50,234,86,70,148,192,205,238,179,204,
+    64,89,11,112,218,161,199,161,82,0,178,211,10,16,14,69,128,57,4,38,254,86,255,18,186,128,175,33,97,57,82,4,
+    251,96,245,3,95,34,27,111,211,92,173,26,110,234,185,169,200,172,39,154,32,0,205,70,72,14,22,64,110,101,131,41,
+    24,12,231,85,72,220,141,58,26,196,77,229,26,238,140,203,192,184,99,114,211,132,88,42,52,225,22,69,196,229,226,139,
+    60,215,89,65,220,51,107,54,136,24,96,54,19,157,92,200,231,66,45,17,209,250,22,59,31,85,103,114,147,224,138,43,
+    233,215,177,169,58,133,37,35,165,190,43,236,78,151,88,187,120,137,213,34,61,238,129,102,205,184,150,121,50,18,110,136,
+    218,113,40,32,127,89,224,10,99,204,202,44,192,103,77,126,93,193,169,40,76,113,194,220,25,181,238,157,236,92,241,51,
+    129,32,209,138,172,179,6,93,138,12,121,205,212,172,104,194,204,138,11,241,38,243,40,26,223,2,3,51,62,27,204,226,
+    91,67,180,8,225,59,246,4,108,97,33,46,120,80,146,95,56,169,162,142,163,63,87,124,240,47,84,8,19,112,88,211,
+    174,103,69,215,137,109,74,236,123,194,20,12,109,200,216,1,64,82,110,203,74,129,207,130,46,96,25,205,115,184,232,46,
+    191,203,152,213,16,200,145,128,210,50,6,190,107,6,25,116,92,192,238,139,34,33,165,202,186,103,28,198,193,148,232,244,
+    122,197,128,232,126,136,70,58,181,114,110,181,20,97,231,231,84,217,192,132,82,191,113,30,60,121,199,77,115,234,223,129,
+    48,142,197,239,205,126,120,28,42,35,155,103,132,200,45,93,132,140,4,111,167,189,158,103,34,228,136,83,3,65,231,173,
+    169,27,243,204,193,251,45,127,39,249,208,42,252,208,18,63,151,207,68,39,80,231,214,192,201,20,41,149,17,96,93,113,
+    137,243,168,182,148,76,162,88,36,181,80,74,111,15,233,249,67,107,241,67,234,9,112,81,37,31,76,9,72,24,42,190,
+    140,102,121,152,241,109,195,114,8,62,155,190,100,70,144,150,254,13,180,81,82,191,138,184,215,27,218,86,98,79,201,66,
+    105,103,70,144,79,209,43,248,152,16,216,65,134,90,116,85,84,34,139,59,231,106,18,13,15,196,103,240,15,184,199,189,
+    193,34,216,164,87,179,132,28,106,130,105,20,104,164,47,221,236,214,229,98,211,232,58,155,96,94,208,36,211,49,194,181,
+    117,103,179,9,9,27,89,219,244,140,40,172,175,100,197,231,214,140,56,100,27,239,127,15,139,102,200,108,191,232,133,95,
+    5,210,249,115,147,140,76,23,164,179,9,12,138,99,158,62,217,5,27,60,169,56,22,247,39,137,208,25,75,235,80,21,
+    146,77,98,27,96,225,85,8,106,137,47,140,161,44,21,172,203,16,53,5,52,72,32,192,213,161,228,176,11,19,229,4,
+    230,26,215,216,60,217,102,177,100,253,87,130,56,86,169,190,90,139,60,115,117,8,80,49,237,230,6,21,241,111,72,170,
+    249,186,196,110,185,24,171,168,180,234,205,216,18,2,143,72,181,45,207,131,118,120,59,211,126,83,159,85,211,175,18,77,
+    134,152,4,127,210,166,218,152,94,31,115,128,238,20,173,239,60,187,192,84,35,64,122,109,73,241,157,212,150,89,61,0,
+    231,50,62,170,188,159,194,150,14,57,102,242,149,14,138,152,53,10,186,113,64,5,144,153,152,30,2,232,72,213,150,65,
+    85,8,117,25,137,147,126,198,150,78,9,133,42,79,202,200,150,135,179,20,9,23,103,48,243,18,242,57,32,112,241,194,
+    191,128,84,66,105,113,117,149,177,238,165,209,52,226,67,18,248,2,123,242,139,21,131,22,123,136,99,22,83,55,116,101,
+    105,84,95,183,165,180,31,130,156,100,147,22,220,246,200,198,179,157,92,92,27,103,188,57,17,172,157,241,133,197,221,68,
+    4,243,38,146,219,224,12,199,72,181,173,24,26,234,16,16,218,134,76,105,243,219,209,69,161,146,226,236,203,158,216,73,
+    158,40,208,73,222,235,118,96,122,215,193,142,65,106,119,5,1,35,87,128,117,96,80,169,5,140,10,22,255,16,149,142,
+    255,220,148,68,81,155,132,137,209,143,103,138,175,22,131,199,69,205,201,84,36,143,172,116,253,84,197,147,158,11,74,50,
+    239,170,55,228,35,216,127,44,162,85,202,80,142,63,136,162,123,125,203,0,209,154,71,230,175,128,149,64,180,178,2,13,
+    80,227,134,114,77,197,181,125,83,45,137,64,169,12,165,25,29,186,204,142,11,109,185,239,85,99,107,158,35,77,228,162,
+    245,29,144,42,58,66,123,200,98,65,104,40,106,95,21,44,188,254,217,40,139,128,213,240,138,30,218,183,237,2,62,253,
+    123,119,108,141,9,200,162,191,30,192,219,97,97,182,197,221,222,86,186,196,194,7,217,210,173,37,96,105,136,163,216,157,
+    247,196,27,1,246,45,42,11,241,239,155,49,203,19,117,248,23,6,189,121,198,227,58,51,128,254,73,145,214,27,228,107,
+    212,13,71,55,133,132,221,93,165,129,110,40,25,41,85,113,69,140,49,250,215,151,206,171,229,92,240,238,174,107,75,131,
+    115,24,52,79,235,252,12,199,14,68,34,114,153,45,36,23,203,80,31,16,245,2,0,68,135,18,210,27,102,131,208,30,
+    148,1,12,108,244,126,53,136,42,222,125,236,34,5,22,52,65,253,202,184,119,0,177,145,27,74,109,234,161,0,89,55,
+    76,91,25,106,148,30,184,73,246,133,127,103,248,152,180,142,33,233,125,166,83,210,140,199,56,27,129,213,162,173,110,232,
+    234,188,137,4,146,229,59,157,186,117,229,242,32,140,133,131,253,15,62,219,139,233,245,124,63,55,109,145,199,36,192,37,
+    57,17,126,243,23,20,210,114,22,36,132,45,124,223,242,108,223,28,181,38,80,94,255,152,82,60,218,132,209,184,141,164,
+    146,80,181,113,137,1,244,22,194,7,48,20,175,81,135,146,186,150,98,132,83,101,212,245,106,241,72,27,19,217,144,72,
+    141,71,126,17,223,17,108,29,244,116,129,33,33,188,12,123,3,127,224,151,67,155,178,104,246,33,162,93,44,230,78,243,
+    21,196,72,129,56,129,67,217,164,30,61,202,79,167,177,201,196,89,40,158,151,249,229,154,146,10,231,151,90,43,4,199,
+    70,208,38,202,220,114,221,6,6,129,70,165,45,250,158,202,142,122,131,2,58,70,92,243,95,245,45,185,235,126,10,199,
+    79,198,159,110,162,121,206,72,163,160,60,144,83,208,199,126,2,16,179,25,52,120,59,142,120,210,87,196,86,208,168,56,
+    132,18,128,252,3,160,84,60,197,121,253,108,156,47,231,226,210,183,215,144,230,150,187,11,21,154,16,84,14,152,210,198,
+    31,181,164,209,208,191,61,73,214,63,168,232,137,253,105,18,83,46,195,219,156,146,90,175,242,61,214,170,30,172,149,95,
+    236,196,132,79,164,224,46,237,86,145,31,102,171,169,37,212,0,15,4,103,146,122,73,125,108,219,137,163,174,64,159,188,
+    213,154,197,169,17,72,192,48,237,193,10,198,71,108,167,13,14,137,251,128,240,177,51,20,224,34,245,103,5,114,32,33,
+    129,131,178,197,157,184,128,246,185,141,195,15,105,119,246,158,234,178,125,215,224,154,33,165,166,73,128,32,3,202,201,56,
+    22,214,44,190,147,117,84,176,68,9,7,1,210,32,0,253,239,118,96,184,16,153,230,255,196,210,98,22,213,208,136,43,
+    129,251,20,81,44,191,83,7,76,0,16,22,49,130,90,52,30,98,165,68,205,70,162,22,192,42,18,1,226,168,10,129,
+    62,150,25,224,206,131,107,66,131,20,89,176,61,228,221,218,90,134,172,170,94,207,80,237,146,2,133,189,241,10,54,61,
+    156,154,239,217,205,215,47,162,84,57,42,157,150,129,78,79,208,47,77,116,113,220,175,71,30,170,141,83,84,221,16,98,
+    145,92,248,83,15,204,24,24,189,187,84,152,227,232,35,227,24,21,65,8,92,210,50,18,145,251,31,99,73,75,171,124,
+    104,23,84,10,91,156,19,75,247,140,213,72,48,235,114,226,97,98,248,78,133,25,169,122,241,236,121,165,177,92,246,31,
+    61,68,225,26,168,234,3,78,111,21,108,244,95,125,20,171,122,124,226,248,220,202,73,211,11,128,97,245,113,38,160,61,
+    224,98,32,22,75,229,249,11,174,55,93,254,39,149,126,145,15,171,167,244,154,190,50,100,81,6,186,128,240,136,150,145,
+    6,160,63,36,37,174,129,13,109,191,200,163,203,119,78,252,34,244,17,254,69,168,150,95,211,85,217,226,0,82,29,237,
+    84,175,162,140,203,146,189,203,49,1,131,233,41,8,134,52,136,168,208,90,7,107,120,75,40,156,234,92,15,126,220,250,
+    72,131,130,225,210,213,134,200,5,52,0,97,17,51,169,155,144,126,161,185,231,207,168,19,166,111,37,87,198,171,116,242,
+    198,29,135,92,27,11,252,174,51,183,13,196,45,161,103,226,145,153,244,109,212,85,110,161,16,11,188,90,210,172,77,197,
+    88,75,100,224,204,246,153,84,105,56,138,83,142,24,162,99,160,175,211,128,125,137,176,18,60,104,0,130,161,15,148,226,
+    58,29,140,125,81,244,53,115,11,220,48,97,246,160,90,217,246,39,76,114,198,72,76,180,152,217,33,9,156,64,144,151,
+    72,105,164,38,70,102,206,63,216,29,162,105,138,197,226,40,26,152,146,194,158,54,128,179,17,66,18,193,149,149,14,97,
+    106,11,160,123,66,133,242,55,164,46,150,65,10,12,164,8,19,75,193,68,225,244,45,179,184,118,88,215,8,176,130,136,
+    187,194,37,217,212,148,217,94,82,159,68,117,168,9,55,81,66,30,140,2,43,61,172,16,211,32,80,146,234,156,142,18,
+    6,152,170,44,220,86,29,1,252,111,32,20,2,167,189,161,232,135,170,48,148,232,57,220,25,51,216,238,64,68,229,27,
+    247,223,165,32,155,195,154,78,147,89,145,244,80,96,119,149,248,120,66,33,20,46,226,133,207,148,254,222,246,180,35,13,
+    59,176,255,163,52,70,120,21,202,77,249,238,34,108,123,159,28,81,81,206,216,22,15,188,10,170,41,24,157,249,13,52,
+    94,245,144,5,181,122,35,18,228,131,210,242,96,124,204,131,87,168,124,225,108,153,221,168,97,120,92,157,125,37,7,20,
+    47,140,4,20,102,163,135,42,126,9,1,187,101,136,164,181,45,190,138,58,246,129,182,112,204,7,58,248,241,249,161,31,
+    243,134,210,175,31,117,179,161,54,212,42,194,90,15,58,242,204,7,129,56,81,142,57,222,10,161,2,14,39,1,51,122,
+    54,94,71,85,120,232,30,54,130,250,93,169,154,7,47,240,100,152,211,51,219,32,154,17,97,97,218,68,11,81,21,80,
+    231,61,94,105,153,237,13,113,206,56,63,215,53,176,201,37,196,240,8,160,148,182,118,201,134,22,100,82,254,86,118,149,
+    30,116,20,45,203,218,54,185,123,187,164,209,77,198,219,252,60,24,13,107,161,19,14,13,111,174,82,60,203,141,9,228,
+    219,104,200,234,26,144,156,185,72,9,160,80,181,129,18,85,22,148,60,242,115,244,210,26,88,49,120,192,169,239,19,214,
+    146,209,179,11,182,161,97,130,105,105,154,218,76,112,232,204,189,193,42,238,251,255,183,234,209,205,142,148,99,115,114,16,
+    132,240,169,72,70,84,172,89,57,229,60,107,250,130,214,234,253,11,104,127,245,83,157,77,213,168,149,124,50,46,206,101,
+    178,201,168,10,78,176,21,73,167,158,106,75,103,115,5,137,188,117,236,251,218,204,176,134,180,212,10,79,78,152,30,33,
+    82,18,1,147,109,1,57,38,236,117,103,98,69,223,249,92,82,93,1,95,81,160,174,140,174,146,150,248,90,99,30,219,
+    117,230,133,53,237,99,63,31,98,130,115,86,230,214,176,145,189,164,102,35,225,82,64,37,38,230,117,76,83,88,52,107,
+    105,17,21,219,65,184,72,119,14,24,137,49,6,25,16,203,230,47,196,25,158,5,70,134,243,254,128,57,52,13,98,79,
+    101,149,61,178,25,132,70,174,84,216,129,247,137,102,121,196,119,3,251,41,176,231,199,52,93,202,66,211,8,12,193,135,
+    196,35,216,28,62,176,123,206,98,154,231,119,19,169,204,96,18,132,123,209,85,82,254,154,14,113,216,117,214,27,132,49,
+    238,234,80,136,49,72,12,34,131,146,32,174,98,237,120,88,229,129,153,25,31,103,51,56,146,147,99,140,73,169,67,106,
+    143,74,243,112,57,239,6,28,248,125,69,19,235,80,63,100,29,40,23,139,2,176,161,237,77,230,3,67,154,200,81,58,
+    195,43,194,133,204,155,113,117,71,82,29,4,214,46,82,66,184,99,17,58,208,90,84,160,180,199,26,81,179,73,180,80,
+    64,236,122,26,99,217,144,81,0,0,145,36,159,163,63,34,118,201,161,165,61,19,141,248,120,231,124,215,22,55,111,170,
+    59,143,219,46,24,204,117,200,123,29,68,102,209,204,176,120,229,179,229,191,72,152,5,225,135,110,123,165,145,169,147,69,
+    78,54,186,108,6,27,173,162,152,100,176,96,243,234,200,97,23,85,51,113,62,92,121,94,110,150,166,175,149,207,213,156,
+    36,126,4,56,80,197,41,202,214,24,45,132,3,185,118,79,15,132,254,226,24,160,10,166,74,153,163,129,205,28,219,137,
+    182,249,65,198,131,189,135,58,192,250,72,116,61,169,97,23,208,236,127,155,104,144,56,220,222,90,42,63,126,156,12,96,
+    16,57,121,189,53,6,174,84,13,103,49,108,213,10,31,26,14,46,121,38,139,244,168,252,214,41,89,184,142,72,108,11,
+    149,146,170,132,204,28,14,241,168,28,43,33,149,248,44,150,65,35,19,49,202,46,88,241,31,16,202,21,101,202,16,66,
+    4,225,73,92,198,157,217,90,172,171,29,13,22,167,9,88,34,198,98,242,5,137,160,149,156,165,166,85,127,29,202,6,
+    64,165,212,166,131,64,226,178,6,138,214,133,162,165,81,74,94,253,137,124,13,230,68,48,125,170,60,54,140,204,123,205,
+    136,82,117,107,70,144,244,32,67,224,141,239,161,171,76,100,149,230,151,249,119,140,26,240,111,178,110,115,184,14,224,45,
+    141,65,13,58,11,213,45,254,215,67,153,240,37,103,124,208,10,129,244,10,205,236,195,241,171,48,129,164,12,175,37,124,
+    218,181,75,171,239,17,151,118,34,141,139,129,99,236,20,57,66,246,65,92,5,76,112,122,61,88,127,2,134,227,3,48,
+    246,194,57,33,84,108,225,214,153,194,199,114,239,199,34,115,98,138,80,142,144,164,85,184,93,233,67,230,102,86,119,54,
+    7,141,20,139,53,177,163,48,75,138,38,146,212,49,186,129,122,174,133,58,135,40,105,235,12,65,253,158,64,102,120,237,
+    223,208,149,175,165,58,43,64,117,104,32,254,7,180,120,129,154,202,234,128,115,203,142,238,179,181,46,193,238,28,22,22,
+    56,91,176,18,172,235,70,123,120,71,179,190,15,103,48,219,20,243,217,232,169,72,14,14,37,37,217,176,43,235,56,82,
+    59,254,191,164,237,30,131,8,182,169,60,82,25,117,110,32,179,240,207,179,180,3,201,225,189,91,61,56,102,231,245,154,
+    169,200,163,127,124,171,107,96,207,23,97,128,233,67,111,113,124,220,178,179,32,189,122,118,22,135,20,60,71,33,0,151,
+    28,87,86,246,89,132,142,53,223,138,144,137,165,95,108,103,31,6,140,16,71,142,163,223,31,171,243,254,235,196,107,108,
+    213,208,112,98,187,118,180,62,177,30,49,129,59,202,128,92,108,176,220,80,113,172,151,200,194,219,137,93,159,135,210,111,
+    154,187,22,95,190,110,75,229,232,246,8,129,24,186,127,104,214,113,147,28,220,136,46,180,148,106,205,209,70,156,156,42,
+    100,90,233,90,151,240,10,227,227,87,229,173,128,78,254,200,103,186,32,104,140,146,241,107,169,80,38,33,29,130,242,240,
+    97,154,188,64,198,5,46,24,143,218,62,53,97,193,95,129,9,23,184,96,68,142,197,172,34,190,164,53,169,143,207,234,
+    117,41,205,180,120,1,61,237,25,90,126,36,209,15,8,178,206,183,75,184,216,42,99,39,76,236,99,70,3,39,222,115,
+    65,252,78,169,227,242,132,58,181,53,36,34,99,127,125,73,78,253,46,183,94,9,31,65,55,248,157,71,22,130,56,143,
+    206,248,232,16,243,177,119,209,148,7,88,233,233,39,55,253,105,233,2,10,32,87,197,129,199,78,104,34,74,148,126,165,
+    174,20,11,250,165,34,10,163,3,165,234,203,11,196,28,211,201,72,66,195,209,89,126,2,228,124,241,122,139,232,90,60,
+    130,135,40,7,45,65,179,197,65,94,21,189,175,186,235,201,112,42,104,128,51,202,72,105,59,174,141,80,64,251,130,52,
+    234,140,216,9,21,253,233,67,71,64,125,15,18,195,46,221,246,135,89,74,27,214,181,126,136,174,185,36,216,54,234,38,
+    0,45,169,41,91,103,50,161,68,107,120,186,39,12,126,98,90,107,247,103,7,9,49,135,25,167,137,79,124,129,228,243,
+    6,163,26,170,58,89,73,102,6,36,150,35,205,148,215,43,104,120,251,176,18,153,50,43,125,166,248,69,100,239,162,123,
+    26,37,58,134,25,31,173,154,212,10,3,146,194,178,47,179,41,170,81,179,31,149,139,183,125,146,129,44,183,26,140,95,
+    176,214,4,86,19,165,198,77,36,1,42,189,66,6,32,105,217,138,205,112,40,108,101,144,189,71,76,10,133,63,118,205,
+    100,195,216,102,148,140,16,147,72,210,180,74,193,51,71,186,128,223,14,52,215,100,170,224,146,199,107,137,155,160,41,250,
+    20,90,28,134,125,84,201,2,209,238,48,11,138,217,155,203,148,85,238,173,211,254,205,161,123,91,24,76,197,88,144,193,
+    14,187,111,25,6,6,69,17,207,64,39,197,153,16,75,108,229,195,95,13,8,8,83,150,23,16,205,102,227,153,9,199,
+    28,125,185,108,171,187,94,178,179,39,130,85,248,79,227,67,178,178,191,192,5,26,193,47,24,222,204,32,167,96,205,147,
+    72,79,112,5,77,2,45,209,68,127,186,247,251,138,146,164,66,1,250,108,221,0,40,171,240,180,56,136,50,73,150,80,
+    149,55,34,14,50,65,181,169,166,3,17,60,121,168,95,68,130,1,179,152,218,49,35,133,66,126,95,16,120,29,142,63,
+    55,87,134,178,131,236,173,41,150,4,210,89,160,240,92,88,115,75,13,155,101,175,243,25,117,35,10,48,45,34,212,145,
+    150,54,118,59,113,12,192,239,106,49,165,222,254,165,152,150,44,252,100,247,92,106,217,92,72,49,156,215,162,16,128,120,
+    255,209,234,240,108,247,116,62,38,195,133,202,19,163,224,100,15,66,246,189,149,38,2,171,158,138,178,186,120,42,189,37,
+    178,219,89,160,86,248,60,225,8,253,231,187,94,227,239,17,119,38,232,138,200,34,143,155,107,172,173,51,128,79,14,188,
+    237,105,156,100,228,244,56,169,209,18,7,158,171,29,99,119,98,217,164,10,9,130,22,30,77,118,28,121,13,34,222,166,
+    127,62,122,248,6,112,202,158,106,13,171,189,84,195,9,181,3,70,130,101,3,20,169,108,2,45,55,5,6,230,64,137,
+    174,183,14,76,200,243,146,178,100,64,195,202,141,220,142,214,159,38,121,171,106,19,133,17,36,92,115,160,15,225,69,95,
+    208,95,125,173,107,210,241,242,148,181,75,83,45,163,170,120,12,120,44,22,234,24,180,51,61,78,190,136,72,246,197,206,
+    13,73,214,131,55,9,210,21,85,14,5,35,26,91,2,232,5,53,70,244,243,37,31,188,50,68,221,48,221,146,228,169,
+    74,100,18,146,68,99,204,249,9,168,85,184,110,244,130,130,11,173,132,233,186,216,131,112,96,203,247,128,179,48,72,210,
+    81,53,218,150,28,151,170,121,94,196,100,101,18,40,192,153,86,134,233,93,134,99,130,168,9,25,17,153,27,127,249,185,
+    194,25,34,199,186,162,19,103,148,203,156,149,148,67,46,165,175,111,193,184,196,246,89,1,30,223,189,213,223,51,182,48,
+    144,86,5,83,88,193,222,52,74,82,89,17,53,12,85,233,69,169,92,98,246,134,144,70,73,174,6,12,195,192,168,81,
+    79,85,23,114,114,76,228,12,202,212,4,160,225,158,3,168,228,194,159,7,75,93,4,65,119,4,30,192,168,199,83,186,
+    204,85,136,210,107,242,72,214,172,177,205,30,123,98,65,180,156,81,56,184,134,124,239,194,68,97,57,89,41,125,39,49,
+    200,189,22,143,235,4,69,27,160,120,76,49,147,255,122,201,206,87,11,228,85,89,98,4,103,77,183,236,134,44,251,168,
+    239,48,78,241,68,114,3,192,84,222,143,30,13,134,126,101,57,252,146,148,229,232,9,41,247,17,231,63,63,10,53,97,
+    105,178,227,169,127,191,241,208,58,241,17,52,22,51,166,149,186,240,190,119,35,59,104,15,17,121,96,87,22,93,40,83,
+    159,7,43,166,30,75,21,142,84,165,224,246,53,141,232,117,17,10,237,136,14,198,253,88,55,230,194,87,220,146,178,7,
+    198,242,225,125,155,175,200,130,17,196,111,201,241,197,231,138,99,42,86,24,109,234,19,199,174,195,89,112,238,172,212,15,
+    28,181,33,32,241,88,168,122,99,157,155,167,3,168,153,169,194,148,95,177,75,239,144,205,207,10,13,129,70,218,89,192,
+    90,54,111,12,31,206,146,142,160,51,143,161,55,196,135,255,220,103,39,237,145,32,212,192,22,182,25,164,217,84,64,77,
+    35,65,86,157,150,128,130,210,19,230,224,72,84,24,225,117,62,170,99,142,27,45,80,7,153,219,29,12,137,102,44,6,
+    251,108,63,207,88,245,62,148,194,155,94,244,212,18,187,59,238,60,64,152,117,157,183,157,160,90,142,195,141,65,90,247,
+    201,62,117,23,48,123,153,148,120,200,233,163,195,55,82,249,20,189,131,55,157,58,208,190,183,169,146,63,197,124,172,175,
+    154,32,227,48,60,216,224,183,53,186,159,161,86,62,36,55,38,17,50,57,183,104,107,203,200,48,193,169,70,201,179,77,
+    107,126,85,147,138,29,226,190,255,42,202,65,37,133,206,173,71,152,215,147,113,148,132,120,141,11,3,47,217,231,241,33,
+    135,122,113,26,241,124,3,27,220,77,134,7,231,53,92,199,92,226,136,176,160,93,105,81,34,9,52,25,36,154,254,172,
+    138,91,129,87,28,204,71,132,7,170,222,163,120,86,124,16,121,247,186,38,27,24,205,145,64,138,178,85,228,222,60,207,
+    163,13,156,134,177,107,76,231,182,12,220,228,239,79,14,117,188,100,34,84,236,71,132,143,47,237,17,171,162,215,71,94,
+    23,134,68,213,74,181,66,233,117,111,224,113,50,37,97,184,47,69,166,116,157,9,121,88,49,64,128,109,242,17,118,134,
+    116,69,225,229,170,176,163,244,85,97,134,98,173,13,162,234,255,169,33,200,148,9,237,248,184,92,80,164,42,158,74,118,
+    38,22,34,91,34,62,137,252,20,239,75,131,93,87,117,98,60,181,223,231,161,240,35,183,194,207,98,89,253,8,108,1,
+    73,11,20,81,39,193,44,108,102,85,157,177,50,189,7,15,89,31,39,54,250,185,121,86,195,15,98,229,223,210,208,205,
+    160,217,114,64,197,68,47,179,134,138,157,90,41,79,135,62,50,130,180,49,171,228,194,192,42,200,143,129,171,77,98,8,
+    212,67,48,164,195,16,95,133,188,127,247,211,152,20,189,102,245,70,218,76,14,64,100,248,24,60,12,165,35,153,245,35,
+    20,155,138,252,119,224,0,45,181,66,169,166,33,132,77,181,199,73,102,194,105,213,96,46,18,168,198,68,215,194,237,194,
+    173,80,119,44,14,160,208,157,133,27,18,148,41,202,93,34,253,4,169,232,146,84,228,167,135,253,97,156,41,146,79,5,
+    4,15,72,27,181,133,146,188,161,12,37,251,82,89,207,73,151,30,191,163,214,74,87,226,46,65,48,199,17,71,222,60,
+    91,234,52,150,144,194,26,224,168,93,218,218,166,251,43,164,86,90,225,60,223,51,100,73,144,215,116,114,191,30,23,20,
+    165,169,93,80,210,102,229,228,38,86,103,212,141,69,209,110,39,108,133,6,177,116,53,131,178,255,0,1,98,214,116,97,
+    175,112,182,118,147,5,35,193,160,150,66,143,91,214,63,61,150,89,2,224,98,252,180,255,69,194,113,230,52,185,82,125,
+    226,89,67,114,42,71,183,4,169,59,94,121,137,32,248,25,27,24,211,114,0,1,169,22,75,73,94,172,110,171,235,142,
+    102,48,25,12,194,51,35,8,149,220,37,192,68,158,201,243,103,175,42,193,45,128,194,147,209,187,172,75,115,128,38,46,
+    0,133,217,167,85,116,178,201,198,116,107,94,111,58,18,144,196,33,23,175,82,22,59,213,191,68,12,83,62,82,252,60,
+    85,80,55,8,93,65,87,243,151,127,166,252,82,173,220,209,128,130,177,211,39,126,102,28,88,32,207,37,166,73,58,109,
+    51,74,112,112,212,135,91,248,82,44,210,115,103,32,75,193,153,247,202,243,90,235,136,187,31,53,51,30,1,2,208,34,
+    65,42,14,126,255,73,23,190,46,166,144,247,214,4,170,150,105,68,230,60,196,115,166,176,179,245,153,32,91,107,59,249,
+    145,162,30,132,55,82,74,162,36,80,145,229,222,52,65,37,192,130,116,6,95,35,41,137,50,214,169,42,96,35,200,133,
+    13,231,38,30,84,1,214,127,197,115,1,24,73,41,225,51,99,117,14,183,34,225,36,157,44,177,71,0,191,136,224,106,
+    226,135,18,62,25,162,215,106,65,228,99,88,210,18,39,158,180,19,159,189,120,235,10,24,159,1,250,62,198,160,101,197,
+    10,138,98,77,209,209,201,198,229,155,254,86,151,4,94,15,192,69,187,204,253,5,233,169,86,130,4,41,73,50,52,51,
+    34,197,85,252,70,97,107,158,212,57,217,19,59,38,215,242,199,135,210,204,201,132,48,7,211,109,20,232,128,13,93,120,
+    209,216,58,37,156,193,188,17,65,78,253,224,214,5,6,210,9,157,73,148,45,194,143,154,254,122,141,111,218,0,63,86,
+    185,105,190,133,1,198,173,110,213,152,70,192,73,228,24,56,132,138,14,82,68,122,209,27,25,192,224,68,51,98,234,144,
+    25,25,62,249,164,170,131,236,4,207,169,22,184,98,80,192,120,87,248,72,199,141,54,206,120,168,97,153,17,46,168,255,
+    19,40,192,160,152,210,4,189,58,133,122,181,63,161,3,149,112,5,24,172,44,40,127,103,184,172,53,183,9,194,15,53,
+    49,0,75,147,56,116,248,20,1,160,246,20,92,113,126,182,115,79,223,160,36,29,114,12,104,218,121,2,209,129,102,11,
+    98,23,86,203,190,148,212,154,194,104,72,203,163,137,37,236,244,216,104,191,127,19,170,135,206,56,3,109,68,11,41,68,
+    49,228,45,1,178,25,165,65,104,77,133,96,148,26,105,207,219,94,205,146,169,47,53,78,191,201,207,109,179,232,89,209,
+    248,63,200,232,192,203,8,154,172,48,18,229,136,4,208,252,193,60,219,89,142,9,13,178,27,134,213,130,147,151,98,121,
+    161,127,58,213,236,253,174,50,76,145,88,142,195,40,171,245,28,72,236,34,74,174,82,192,90,89,39,31,68,147,50,143,
+    12,86,189,170,25,133,162,232,76,31,146,209,89,81,8,98,6,121,200,57,147,71,10,157,113,217,61,55,204,104,74,100,
+    202,26,179,203,70,174,155,161,7,83,135,47,160,94,203,161,225,189,152,208,183,24,111,78,242,109,245,208,119,55,145,86,
+    245,213,87,139,145,21,80,161,150,211,249,184,228,141,150,98,164,178,152,147,2,16,36,80,132,138,1,122,185,66,223,144,
+    134,95,5,132,17,105,207,145,242,173,77,44,186,130,79,189,112,254,247,67,159,193,55,77,58,242,38,207,203,130,9,51,
+    127,117,50,24,66,92,83,61,177,7,222,166,157,206,49,11,216,182,108,53,54,91,47,86,47,110,6,140,184,110,171,121,
+    200,78,100,65,13,20,56,128,87,61,96,55,160,66,69,223,58,128,9,133,147,33,241,42,29,70,222,68,0,56,71,160,
+    61,212,86,166,153,138,51,227,214,51,170,162,101,233,130,43,188,49,86,168,65,52,0,204,88,59,23,24,202,88,23,150,
+    183,238,28,221,59,43,23,25,88,179,36,227,247,110,72,5,10,138,230,209,182,74,146,41,139,166,224,65,125,177,33,154,
+    36,180,52,132,52,225,191,227,144,172,234,220,17,177,57,71,154,10,4,32,144,74,112,52,104,223,67,48,8,143,223,32,
+    136,155,207,239,33,69,204,25,197,140,37,136,112,6,95,196,150,244,91,16,142,29,152,76,254,233,183,128,148,156,46,138,
+    199,195,208,168,136,228,182,117,204,197,64,192,27,229,20,64,137,48,178,110,75,192,76,255,21,164,182,57,151,26,80,38,
+    134,104,115,251,138,150,121,159,215,231,32,7,206,85,176,223,122,194,155,149,12,228,19,52,87,43,167,60,223,61,170,114,
+    172,107,11,50,168,217,41,198,1,39,225,34,68,109,14,77,127,192,252,108,105,141,124,3,248,162,162,29,218,147,228,38,
+    161,38,33,123,32,84,130,113,93,67,47,160,127,108,25,159,34,45,20,115,63,219,181,70,41,174,54,247,203,14,209,228,
+    182,116,135,24,240,49,24,109,247,31,129,99,201,17,66,80,91,16,161,13,85,61,255,236,130,52,109,194,236,191,189,141,
+    226,241,57,216,67,6,112,157,93,137,58,244,11,154,172,130,122,38,254,128,72,47,230,24,198,94,206,92,234,174,153,148,
+    88,212,208,244,122,206,93,138,121,71,10,42,106,241,243,12,212,20,78,115,184,148,199,234,179,47,139,215,76,178,82,29,
+    85,162,106,143,145,247,180,130,31,161,218,239,97,20,26,101,25,217,34,203,210,155,154,126,162,192,170,146,54,132,87,156,
+    145,141,4,206,23,251,150,111,58,250,70,164,165,76,127,9,222,75,246,153,77,71,232,117,212,137,115,174,139,233,237,29,
+    108,49,104,132,221,108,51,24,97,105,67,73,148,214,212,113,144,13,67,226,80,184,211,158,154,213,3,62,64,214,128,78,
+    243,70,254,81,112,0,155,75,177,50,171,11,93,180,239,19,60,186,16,140,85,18,30,123,48,92,24,206,180,128,227,181,
+    128,222,138,240,46,113,138,223,200,65,70,184,212,68,111,212,31,95,99,44,131,209,228,0,76,102,193,69,35,161,85,176,
+    221,46,94,83,12,64,161,206,240,173,26,155,77,152,247,232,73,64,157,117,252,218,7,162,4,16,31,148,74,211,109,224,
+    63,249,192,14,57,105,10,230,167,194,229,89,154,252,233,142,53,31,75,36,245,228,213,33,74,209,248,70,106,112,31,109,
+    196,162,211,129,208,29,246,3,144,12,236,147,224,123,218,193,236,112,152,67,232,182,147,30,168,95,17,32,82,159,198,49,
+    165,83,181,94,123,182,195,44,62,11,59,128,250,180,96,255,81,66,79,43,14,130,34,227,11,190,245,154,160,173,55,242,
+    46,100,96,0,66,116,188,123,70,6,177,32,210,168,220,51,27,184,193,104,89,34,226,74,24,98,203,194,58,138,155,176,
+    9,52,186,246,20,47,32,28,81,114,177,89,12,231,192,100,24,130,242,70,121,132,31,148,223,120,54,152,3,38,47,173,
+    144,66,142,2,152,17,8,13,200,13,128,207,127,75,40,65,64,157,91,183,218,183,197,7,170,179,97,62,38,50,49,239,
+    254,137,212,24,226,175,39,29,196,164,98,128,71,133,120,99,163,147,53,232,195,98,249,209,77,103,125,76,27,213,144,17,
+    245,22,130,150,28,173,247,107,74,12,68,220,240,156,232,138,190,109,167,181,25,108,253,32,254,105,138,238,9,15,244,142,
+    97,23,50,43,92,176,161,179,78,152,178,12,137,204,70,221,109,176,12,8,195,21,219,91,131,25,136,21,236,106,126,35,
+    8,60,65,125,147,167,72,35,119,46,47,95,208,218,216,204,16,95,196,83,159,82,132,106,128,103,214,145,27,32,28,35,
+    10,111,100,35,145,240,238,121,51,119,140,225,44,210,1,60,36,152,76,238,69,14,146,7,149,120,24,17,80,89,250,20,
+    204,231,233,217,81,170,100,160,20,35,153,23,67,192,209,190,27,164,204,218,146,170,232,46,223,122,204,156,7,54,64,56,
+    46,176,128,208,196,42,100,107,236,142,198,221,75,171,254,137,79,158,82,137,214,13,49,71,247,42,228,22,11,123,38,123,
+    162,80,126,0,198,194,43,24,153,236,247,192,213,47,160,135,24,33,34,224,193,38,136,14,213,227,95,252,68,121,18,144,
+    157,228,141,100,183,191,252,6,119,32,0,69,180,62,118,172,242,221,57,30,72,64,251,136,230,198,8,16,100,220,107,110,
+    131,226,90,183,213,64,200,10,162,148,158,37,107,120,239,251,41,149,19,57,239,75,81,85,38,32,225,3,193,57,202,179,
+    188,46,23,116,61,180,47,23,85,162,101,228,204,103,147,36,118,100,233,204,217,233,135,41,73,141,193,162,226,53,192,209,
+    68,242,158,41,0,135,1,74,39,192,243,25,79,227,245,71,123,207,229,6,181,20,63,65,180,211,166,29,137,235,131,156,
+    130,117,26,53,96,108,199,144,46,198,151,0,103,14,81,24,96,204,242,110,88,190,157,54,141,22,88,91,120,61,129,153,
+    12,185,171,144,100,165,251,194,151,189,55,193,165,64,16,163,79,224,39,80,207,88,66,195,132,102,24,193,15,71,82,201,
+    233,121,164,213,215,85,242,74,149,166,99,45,217,94,115,49,177,133,35,102,194,136,181,162,48,212,190,204,111,104,195,185,
+    117,68,62,28,175,222,159,66,56,20,23,26,16,26,162,156,84,57,148,179,87,209,10,182,77,235,23,42,4,223,73,37,
+    47,128,196,166,45,24,188,226,239,203,189,132,172,97,192,140,49,119,233,41,85,56,183,21,170,234,20,197,8,33,140,54,
+    7,166,213,26,35,199,10,123,193,210,239,184,200,130,99,241,181,223,1,168,153,10,201,122,61,109,76,174,200,192,142,103,
+    13,79,42,23,58,138,57,207,12,76,54,110,190,243,195,56,142,167,139,16,85,236,120,215,201,3,6,49,220,87,142,185,
+    159,70,181,201,59,118,186,226,50,196,244,165,117,192,181,118,132,185,224,10,8,94,12,73,37,95,56,147,175,58,233,159,
+    73,247,241,151,17,106,138,98,202,190,223,189,245,60,179,114,65,48,75,9,208,133,120,120,86,99,2,229,117,28,221,186,
+    84,9,51,175,242,93,252,105,32,104,63,23,79,166,85,131,164,8,104,104,203,196,1,103,161,146,204,114,220,116,28,234,
+    185,60,81,3,0,8,148,169,157,4,136,10,204,32,167,0,57,105,51,4,14,176,240,135,78,245,115,27,236,235,129,97,
+    58,56,39,20,95,223,203,126,17,78,122,223,160,160,216,188,199,137,88,28,94,53,12,195,151,11,207,142,162,26,233,42,
+    48,182,202,14,109,36,162,151,32,137,65,91,40,125,90,106,118,80,185,106,166,66,69,16,198,85,243,93,6,152,193,22,
+    231,251,3,100,50,118,165,189,88,68,96,94,62,38,2,237,108,251,131,64,113,58,34,235,173,176,221,122,28,254,102,131,
+    66,99,46,9,171,132,218,248,53,209,210,117,183,204,39,9,222,40,149,152,142,6,219,246,61,235,1,150,160,138,244,154,
+    170,202,204,112,7,215,24,221,221,138,18,241,37,66,229,60,20,14,144,236,144,132,106,50,72,17,46,144,219,94,117,6,
+    8,116,80,29,235,136,230,47,159,8,14,216,155,134,211,246,160,100,94,137,6,232,57,4,2,5,120,86,22,106,84,186,
+    198,172,122,148,236,98,137,66,227,240,247,224,111,232,91,168,32,161,223,90,198,189,109,92,235,166,14,2,99,128,191,2,
+    23,153,30,27,146,71,83,27,77,6,226,249,74,236,240,64,181,105,88,68,153,58,243,3,14,177,148,7,68,17,217,146,
+    189,131,16,39,74,177,106,10,161,34,44,13,233,158,212,49,162,240,138,4,62,42,67,195,184,244,29,130,139,87,71,138,
+    168,142,130,159,177,225,81,186,10,192,228,211,22,0,94,140,153,143,56,233,37,143,79,164,108,66,141,250,47,36,185,57,
+    245,123,148,120,250,23,43,208,129,66,89,84,145,166,232,105,30,122,105,250,232,2,87,187,76,49,224,56,157,226,32,237,
+    4,133,223,182,5,58,216,36,137,241,118,161,231,136,106,144,165,66,206,80,8,185,49,32,237,102,93,141,150,132,225,150,
+    252,105,196,95,37,111,235,80,168,136,161,7,217,9,14,39,80,145,131,242,162,117,94,191,130,233,193,107,127,89,213,182,
+    144,197,222,83,64,231,0,190,227,57,14,198,140,112,89,182,2,143,145,209,162,85,65,53,13,84,145,0,163,45,93,84,
+    77,193,52,12,33,186,198,30,111,100,198,14,93,32,133,13,144,106,176,83,22,171,81,143,113,176,105,112,14,205,130,128,
+    24,33,144,216,100,19,48,192,78,177,242,187,209,65,60,2,84,156,2,30,144,248,181,46,60,10,183,44,221,32,3,67,
+    119,60,155,212,12,112,40,87,152,23,70,251,181,162,247,7,96,155,171,140,253,24,73,157,211,214,146,200,73,87,97,74,
+    46,224,56,174,105,132,145,213,222,190,203,52,201,100,59,47,14,16,239,135,16,41,93,34,255,161,47,187,100,185,205,7,
+    64,182,23,208,245,54,0,156,160,125,185,121,102,101,55,209,14,167,87,185,13,99,8,228,130,153,37,110,232,16,10,197,
+    190,102,65,165,175,43,160,165,106,223,29,212,224,75,221,160,106,64,208,58,67,25,77,124,90,103,3,169,212,234,126,221,
+    196,181,203,213,159,149,250,212,89,40,110,189,251,247,2,116,87,82,184,77,109,146,234,49,71,4,25,192,228,49,51,87,
+    195,71,78,248,17,65,67,61,46,11,28,209,35,65,201,85,196,172,72,43,205,2,74,217,93,34,1,131,12,130,219,108,
+    141,147,101,97,22,235,117,230,9,183,40,78,106,93,17,52,69,14,41,174,145,155,174,217,251,152,147,16,167,96,117,67,
+    69,27,54,117,0,105,79,57,172,191,18,233,85,114,88,0,183,163,218,34,53,0,176,193,218,209,8,97,131,205,53,230,
+    9,135,21,124,246,12,187,158,49,84,200,97,53,12,68,81,171,7,46,72,229,64,55,13,152,112,86,141,67,217,131,82,
+    134,83,154,169,18,94,9,171,245,105,68,72,46,213,203,186,167,232,2,117,139,44,80,203,127,73,43,31,119,51,3,224,
+    160,243,32,209,98,156,182,147,105,4,231,46,242,37,227,39,16,45,250,81,89,135,182,55,172,33,155,77,102,144,50,49,
+    191,56,146,196,48,97,68,65,129,190,95,108,171,74,95,1,38,153,176,144,176,2,71,121,23,141,58,46,119,212,142,165,
+    242,202,210,170,237,8,216,70,58,159,35,255,197,196,3,57,7,207,65,69,150,172,174,192,47,33,156,103,235,22,89,187,
+    162,66,61,27,154,202,34,32,223,61,126,219,248,75,174,162,4,216,193,141,88,165,37,194,1,27,94,96,110,97,207,165,
+    148,242,89,160,128,7,58,4,179,79,63,146,82,138,61,77,118,231,37,104,155,42,143,38,8,71,50,72,181,208,178,179,
+    208,128,226,211,177,43,71,207,82,161,253,32,196,19,241,217,132,84,78,0,82,28,119,145,11,9,64,193,191,57,50,91,
+    212,39,226,197,251,120,220,111,219,32,47,192,76,129,25,183,151,216,73,38,121,56,103,27,67,253,85,57,210,38,30,179,
+    25,246,220,104,23,136,0,124,119,179,94,228,161,11,222,137,245,191,103,234,237,48,76,165,94,96,17,165,125,190,129,232,
+    208,207,211,0,240,31,43,148,239,14,95,177,138,189,3,215,171,53,67,170,109,83,59,58,109,14,31,167,197,71,166,48,
+    20,23,100,47,83,204,12,153,33,37,66,29,1,158,169,216,166,145,198,123,121,108,37,196,196,203,6,203,136,32,215,121,
+    134,126,37,201,47,191,2,226,255,181,211,19,56,154,97,239,74,50,234,137,11,230,65,92,219,150,81,100,148,92,159,44,
+    35,14,68,152,124,128,67,12,233,116,37,140,71,166,232,157,111,223,212,84,4,103,32,37,58,137,253,139,149,0,37,30,
+    22,43,167,125,70,37,164,170,103,196,171,0,120,135,207,107,64,99,147,79,224,42,253,73,218,2,13,113,233,161,38,79,
+    10,40,202,22,202,132,66,219,147,18,100,214,34,45,132,209,1,67,0,107,159,254,0,15,180,141,72,83,166,30,90,1,
+    49,139,72,164,160,198,182,16,251,229,70,50,73,42,254,181,34,16,58,116,167,215,52,76,202,30,42,124,178,34,146,51,
+    53,172,199,91,247,96,200,114,37,200,247,167,225,174,139,33,162,26,37,108,245,96,134,27,179,216,239,196,122,249,220,54,
+    176,249,171,131,12,180,27,11,169,246,205,134,131,62,14,69,217,33,200,78,144,162,64,157,240,16,70,86,41,168,101,205,
+    231,190,107,137,84,105,167,0,239,9,57,87,52,86,217,246,136,48,145,127,19,204,32,168,109,76,37,24,102,16,163,56,
+    85,165,41,177,138,222,181,33,175,24,7,240,89,36,138,40,161,200,145,195,2,215,160,90,182,168,252,92,40,14,50,188,
+    209,243,246,246,237,80,193,181,227,98,159,249,224,125,47,252,119,159,105,249,204,172,59,238,136,215,25,102,56,12,88,81,
+    9,186,115,185,113,129,155,227,30,171,147,228,204,198,1,210,13,230,162,151,130,195,125,68,69,41,222,87,37,177,135,77,
+    0,65,196,229,117,142,157,11,27,33,94,96,58,151,156,251,0,78,56,97,63,47,20,18,61,214,221,128,55,54,188,3,
+    146,34,239,143,119,112,25,156,90,15,83,188,37,169,96,46,227,151,192,164,198,52,54,119,55,139,100,34,145,130,213,233,
+    35,92,44,30,208,41,242,70,18,94,140,137,213,144,30,80,26,229,248,162,141,197,153,60,35,29,194,170,150,117,210,20,
+    178,115,30,182,185,196,66,15,4,162,210,47,123,138,176,112,101,90,116,99,30,195,165,60,40,52,123,156,168,48,56,156,
+    53,28,29,47,44,190,5,208,26,110,8,185,11,186,24,11,131,127,233,33,57,196,251,218,119,27,12,211,223,34,152,213,
+    251,244,16,173,1,209,194,249,231,63,234,25,76,115,5,122,132,138,124,164,11,8,189,128,53,106,113,203,6,211,199,123,
+    193,136,170,135,27,252,53,30,194,175,35,177,34,115,138,171,145,128,9,223,144,17,136,79,7,6,83,137,110,217,253,230,
+    181,241,83,167,18,203,252,77,75,235,251,30,148,90,188,89,30,47,16,48,172,4,175,11,81,165,87,160,189,182,14,228,
+    242,224,16,198,252,238,46,76,161,212,170,21,145,30,78,192,48,20,30,205,144,43,17,163,159,120,37,211,177,21,202,119,
+    121,207,96,34,117,65,76,199,34,96,156,59,0,200,165,149,7,184,22,68,114,0,161,28,48,90,149,145,224,61,32,255,
+    98,80,79,241,0,40,139,27,184,161,214,158,197,225,242,193,16,56,4,156,175,56,241,114,252,246,209,189,189,68,90,122,
+    64,194,114,164,99,50,105,241,61,210,70,9,5,47,12,144,138,161,230,38,17,8,10,106,44,214,247,219,255,2,105,196,
+    220,9,171,74,33,160,48,71,141,113,113,128,99,29,241,28,10,165,100,42,94,22,193,132,214,87,111,244,125,247,219,80,
+    190,205,75,92,152,35,245,113,178,178,225,29,42,42,216,39,75,47,249,94,120,161,80,205,229,148,166,129,71,196,220,154,
+    214,125,154,209,174,165,195,192,155,26,124,158,68,99,208,153,178,170,46,203,181,167,84,74,249,1,122,69,5,51,251,168,
+    194,4,75,89,146,215,158,44,21,209,233,117,88,34,225,219,12,195,79,196,62,244,219,109,130,14,91,178,24,205,34,228,
+    0,161,146,168,149,237,66,110,38,127,237,96,145,194,172,252,169,86,149,128,236,132,53,109,60,30,61,92,104,206,33,2,
+    230,161,126,48,91,67,53,123,92,77,3,14,241,199,27,64,30,74,71,76,9,160,60,210,245,166,11,33,169,229,4,81,
+    18,58,50,141,151,55,112,201,214,249,148,192,231,179,82,164,159,144,49,60,243,90,161,219,62,24,107,214,52,177,192,61,
+    156,93,27,255,87,100,184,185,146,113,130,255,103,199,123,160,212,124,33,237,110,249,43,196,19,88,62,110,15,75,22,12,
+    124,188,67,84,190,76,8,249,226,242,21,177,212,38,142,118,24,3,117,26,46,28,4,252,30,211,109,20,218,14,161,14,
+    29,234,50,71,231,52,157,108,158,20,81,224,77,146,22,117,2,63,205,225,30,108,140,226,168,72,209,62,220,42,101,1,
+    108,43,121,226,27,136,109,33,243,193,60,48,61,197,106,179,173,152,2,73,214,106,85,29,173,25,32,89,6,0,241,219,
+    185,86,129,0,0,136,235,13,106,163,100,222,207,29,3,244,49,156,135,13,5,168,179,34,156,24,105,192,231,243,253,101,
+    88,117,192,218,132,56,99,170,35,138,84,123,42,86,135,132,158,132,23,254,175,26,164,109,167,132,115,71,9,117,185,75,
+    211,104,137,21,253,187,181,171,123,212,181,166,0,4,24,43,130,70,84,218,34,65,73,170,4,67,16,246,135,42,45,252,
+    89,143,114,76,28,33,241,22,238,200,141,7,7,226,249,168,204,227,146,92,26,182,124,254,140,232,74,172,107,32,120,128,
+    176,217,64,224,123,29,81,163,101,151,114,4,12,112,144,89,108,35,128,134,250,244,194,226,242,246,190,73,130,200,45,89,
+    89,42,166,202,191,188,218,197,176,225,48,178,158,67,154,108,198,230,24,141,170,131,15,177,66,211,160,196,21,101,254,14,
+    232,95,220,19,196,198,12,69,117,81,41,157,109,166,217,79,11,146,36,152,23,87,34,211,199,108,169,39,82,100,162,106,
+    246,174,69,1,252,215,18,80,221,145,247,173,121,90,169,193,162,131,143,76,77,184,120,140,57,108,2,151,215,136,122,44,
+    229,94,37,161,227,80,155,157,33,254,33,207,234,42,89,139,253,206,64,202,245,24,155,224,173,29,29,244,167,201,155,202,
+    5,32,174,226,48,52,186,236,19,164,31,170,101,87,14,46,93,193,5,68,51,233,73,78,250,73,17,153,1,102,147,151,
+    193,86,186,33,57,146,41,138,99,243,119,44,206,164,180,109,158,132,124,216,162,90,181,5,147,118,101,67,131,52,225,171,
+    68,180,175,188,85,80,57,170,41,35,64,175,104,25,189,140,28,3,35,108,133,14,124,142,85,240,176,48,34,254,179,196,
+    222,242,131,146,88,251,255,54,37,20,226,254,204,139,93,138,211,94,219,107,157,21,68,3,161,10,241,217,174,211,70,35,
+    65,246,43,34,223,10,2,12,201,37,52,179,44,200,192,176,139,76,18,242,46,50,182,14,43,83,4,161,132,232,78,225,
+    214,107,45,215,73,248,242,103,215,32,223,31,37,9,120,199,133,19,97,79,228,145,184,45,186,5,7,169,155,150,109,227,
+    5,45,21,253,104,33,181,82,15,200,207,52,219,159,232,22,239,148,60,34,110,20,192,0,169,82,172,218,130,183,144,246,
+    11,144,64,229,237,60,105,252,130,74,201,232,158,146,76,12,1,135,173,24,183,12,47,129,131,91,70,141,74,228,227,216,
+    61,208,96,190,73,216,114,228,9,137,182,105,18,210,176,142,69,129,117,185,133,241,147,129,49,102,54,36,25,139,107,198,
+    45,72,188,105,69,242,144,177,105,108,33,194,153,207,34,229,91,70,143,125,30,108,140,129,72,54,217,170,196,44,20,116,
+    153,99,124,229,159,78,48,236,24,205,159,165,224,196,71,218,217,17,221,74,77,86,137,34,214,93,141,171,0,101,167,183,
+    202,97,10,133,62,156,156,8,202,101,50,145,25,65,13,92,194,25,72,220,102,62,50,4,162,113,232,239,52,118,242,83,
+    234,153,197,195,133,153,70,209,255,212,56,137,53,153,178,17,54,118,179,128,37,8,217,248,50,137,176,174,165,93,108,133,
+    231,39,232,94,207,78,74,221,38,238,219,207,60,208,233,125,105,148,126,201,55,68,232,212,97,218,172,142,126,119,204,128,
+    3,180,98,253,243,135,73,5,133,186,212,134,218,70,116,246,241,20,102,163,48,65,160,225,69,147,251,126,173,96,223,116,
+    32,227,97,138,2,178,79,130,24,57,103,43,222,23,63,81,57,116,92,73,67,164,86,200,160,227,194,161,51,89,42,83,
+    229,136,122,200,21,15,75,218,30,2,61,218,11,27,80,154,4,24,125,229,200,197,158,130,11,108,30,209,140,227,47,84,
+    13,125,23,71,50,208,121,219,10,137,89,162,223,155,55,170,132,214,64,208,187,71,9,23,206,39,87,16,29,219,139,49,
+    59,7,180,102,62,252,51,90,42,26,183,98,199,64,161,1,195,245,14,168,228,141,235,90,233,141,146,206,62,183,49,232,
+    246,2,148,123,189,159,223,42,18,214,49,205,137,85,33,77,51,150,163,96,28,40,46,131,45,214,90,64,158,220,225,6,
+    15,152,1,24,215,56,238,166,178,28,120,163,14,93,252,65,250,106,230,236,17,40,112,248,8,88,245,15,135,19,104,70,
+    203,158,45,144,162,134,213,152,154,114,47,107,93,77,226,95,11,194,224,101,221,227,160,5,104,57,101,117,211,207,248,240,
+    122,178,225,207,199,239,241,232,105,46,206,122,228,13,246,226,1,95,118,4,137,10,118,13,243,68,57,196,21,47,54,156,
+    87,232,115,180,178,79,210,116,139,73,48,119,190,78,8,10,2,217,96,86,20,33,2,133,71,193,131,29,172,140,175,177,
+    62,112,200,38,84,235,225,183,93,48,83,208,198,24,140,92,124,200,120,29,34,119,110,231,69,37,180,52,185,94,126,26,
+    38,158,27,152,153,203,44,159,218,188,180,59,159,111,30,75,46,213,153,183,232,25,96,153,26,23,40,165,198,181,170,187,
+    54,16,9,36,65,115,153,220,43,10,230,102,81,5,227,111,68,77,176,95,65,227,103,195,156,81,18,200,22,214,135,128,
+    255,33,163,163,146,236,160,184,180,60,162,170,211,32,215,145,201,159,220,196,94,187,177,15,55,239,129,150,133,246,88,147,
+    33,125,55,47,132,65,10,55,76,189,70,133,93,244,164,219,160,37,103,123,53,195,223,21,197,214,162,132,104,217,54,95,
+    32,140,232,71,31,117,252,134,82,105,24,194,120,166,1,144,232,55,120,25,57,219,1,211,177,81,190,96,136,115,171,133,
+    201,23,61,211,82,164,165,234,210,135,98,230,33,32,71,221,254,176,25,134,143,247,7,160,77,242,196,151,33,20,72,21,
+    110,249,32,192,100,121,68,115,3,108,239,218,110,194,9,198,181,112,27,17,60,190,36,152,214,174,221,203,180,101,112,29,
+    148,137,0,2,50,221,30,78,194,112,181,194,106,246,193,219,22,145,190,88,145,215,188,208,203,67,223,175,239,7,225,80,
+    17,165,125,52,252,11,150,239,116,145,110,103,254,171,182,132,22,126,203,60,143,156,254,87,27,178,195,224,3,43,144,51,
+    98,145,240,60,111,57,27,104,186,228,131,131,17,62,61,116,34,59,166,48,184,155,33,182,164,162,112,130,153,224,8,112,
+    127,156,135,14,3,38,180,174,99,34,109,186,251,240,10,13,33,136,44,43,75,208,134,95,97,251,172,57,33,100,135,0,
+    33,44,214,232,181,100,31,98,109,58,25,38,249,162,247,95,215,174,36,60,253,106,34,248,38,242,38,160,190,245,62,134,
+    26,180,175,251,164,249,63,12,204,147,59,198,250,183,157,237,92,161,66,45,47,0,31,161,10,133,94,247,173,52,208,55,
+    29,214,84,102,96,140,102,5,77,33,57,97,223,183,141,108,114,52,105,136,194,101,118,206,217,49,116,209,138,223,219,111,
+    132,236,157,171,106,78,60,30,116,233,55,142,163,65,120,13,220,224,148,147,153,100,73,11,84,145,195,65,98,33,250,33,
+    81,145,120,117,144,210,72,238,166,195,206,140,26,69,38,122,48,91,124,241,211,61,124,196,227,3,188,93,156,217,62,8,
+    247,131,240,16,51,209,112,79,56,163,176,32,161,90,201,171,99,151,100,78,62,202,168,6,115,143,177,3,137,77,146,219,
+    133,22,253,139,184,58,201,43,252,250,210,181,64,179,215,248,164,107,96,206,67,16,46,39,146,111,50,41,144,126,13,67,
+    110,204,38,92,15,30,41,192,186,109,98,237,15,157,180,176,23,132,4,136,126,71,0,172,103,14,16,46,58,93,137,26,
+    165,252,131,202,233,242,92,92,128,185,236,108,80,98,171,117,185,208,12,33,147,212,89,192,155,106,211,147,5,154,3,149,
+    162,113,112,194,5,137,84,68,148,26,16,1,50,214,55,34,80,72,183,49,104,130,97,221,232,205,66,35,211,20,223,239,
+    236,59,136,176,218,227,76,239,124,4,170,25,217,4,98,227,16,12,44,105,12,251,207,240,248,85,97,67,191,62,68,129,
+    152,215,1,145,110,80,10,59,148,116,235,81,82,23,181,44,25,106,244,30,140,190,217,152,48,154,2,135,42,39,101,250,
+    147,86,124,197,156,198,31,213,151,85,189,146,35,189,123,10,90,21,16,185,208,154,172,149,250,151,88,129,46,92,247,217,
+    208,117,42,180,111,236,62,27,77,199,120,180,152,168,110,183,55,174,23,87,67,54,128,76,157,46,60,101,33,253,139,248,
+    242,47,189,201,114,96,185,20,124,87,81,178,68,74,28,160,171,60,226,246,130,187,83,112,26,31,235,236,163,82,111,181,
+    62,78,190,85,11,144,119,101,244,98,211,23,97,70,197,46,20,72,135,94,177,68,24,233,117,123,142,53,4,188,125,234,
+    68,196,233,9,190,25,4,111,255,227,252,141,190,29,254,154,74,189,126,7,42,137,179,132,17,135,5,48,59,223,202,224,
+    212,186,93,44,42,19,129,113,47,245,118,59,29,233,195,61,79,70,178,165,202,201,1,171,241,170,64,133,161,39,210,232,
+    212,171,150,242,134,170,238,33,71,128,100,24,206,70,116,183,199,167,35,248,182,237,176,53,28,83,18,22,241,87,30,192,
+    236,149,111,183,218,179,144,152,14,36,127,30,210,232,38,230,161,173,218,51,243,164,49,50,251,181,233,197,113,84,28,244,
+    5,87,183,220,6,241,36,13,76,3,21,219,155,138,16,229,99,63,145,185,237,154,118,50,227,4,153,101,113,184,46,192,
+    94,147,156,132,98,124,72,155,230,243,197,153,134,228,228,198,234,33,98,59,160,12,64,188,105,71,29,214,236,130,176,247,
+    5,246,37,182,91,16,245,199,110,3,174,139,193,12,197,218,234,80,44,3,166,8,129,155,146,36,146,12,234,250,165,43,
+    1,164,148,207,43,173,22,53,39,37,225,108,103,133,175,116,197,100,209,5,221,20,22,41,226,211,17,216,21,6,35,133,
+    42,47,66,173,81,176,209,178,170,74,80,153,176,237,139,245,20,204,183,133,199,176,3,7,131,142,242,83,158,38,108,80,
+    227,137,69,177,97,163,165,34,92,78,60,242,1,158,19,81,99,122,181,224,224,78,212,86,77,201,61,32,2,133,208,32,
+    40,74,204,222,48,49,18,113,153,156,172,80,97,42,145,113,190,244,20,202,108,165,2,28,163,39,71,113,5,235,173,41,
+    5,82,175,74,95,250,50,77,1,34,64,242,91,119,252,82,47,151,254,203,47,27,22,64,34,122,14,140,125,129,5,93,
+    31,231,33,163,228,89,210,88,1,200,61,76,87,250,201,196,93,40,73,80,193,187,20,24,3,12,160,98,242,58,209,64,
+    31,227,21,124,90,82,4,4,28,15,220,56,68,68,186,21,44,98,132,12,20,69,70,155,195,162,138,81,163,65,80,10,
+    34,143,15,87,137,193,164,129,231,5,208,179,7,245,34,115,230,39,91,118,18,131,98,202,177,133,205,108,161,115,185,157,
+    98,14,144,61,7,106,137,117,147,78,171,230,139,12,114,59,168,101,170,39,199,94,52,239,216,84,59,210,110,155,47,120,
+    9,196,54,42,180,97,140,44,104,118,31,61,81,47,191,168,57,98,40,166,101,3,15,132,96,33,194,9,116,63,18,137,
+    107,52,55,214,159,172,100,128,82,243,197,48,215,38,225,179,205,40,67,108,32,143,173,121,117,248,252,213,135,100,96,193,
+    154,224,31,28,247,180,87,89,80,88,55,185,130,136,78,18,2,221,11,194,132,146,24,1,176,36,95,89,237,90,89,51,
+    128,243,123,49,25,165,192,226,116,201,55,185,206,164,115,62,199,228,203,185,49,128,112,15,136,11,14,241,192,166,71,51,
+    90,136,163,97,58,213,220,32,19,84,66,154,195,89,165,107,49,155,184,144,241,46,249,105,73,150,14,147,255,144,243,80,
+    42,64,248,85,194,140,172,133,167,180,225,145,86,206,61,132,216,56,180,44,239,106,186,254,24,43,158,239,77,7,62,39,
+    130,200,67,236,227,132,104,15,189,211,8,131,148,1,7,148,183,68,176,57,129,18,37,33,132,186,232,239,56,0,147,140,
+    166,241,0,249,107,115,230,18,252,55,161,17,35,95,161,18,216,163,165,68,85,165,31,120,130,0,210,143,196,119,34,21,
+    227,145,97,216,48,233,135,220,124,68,82,39,231,81,97,70,139,96,33,149,86,128,131,33,126,6,126,197,39,66,75,96,
+    47,127,208,83,8,80,2,98,174,165,237,60,25,150,9,128,135,20,8,137,73,145,107,3,145,61,72,103,76,155,165,117,
+    215,117,153,49,243,196,154,173,79,109,40,247,230,188,113,210,75,105,128,213,25,41,181,153,16,155,225,94,178,254,219,127,
+    130,8,206,198,56,164,165,76,49,157,190,112,76,244,35,183,25,155,151,198,229,108,40,24,223,15,36,80,136,227,86,147,
+    179,173,154,46,103,2,42,142,52,109,240,211,30,187,96,149,149,170,231,163,105,121,131,253,149,223,34,212,69,205,200,65,
+    201,107,130,72,26,239,166,201,237,146,229,139,87,46,178,180,0,102,166,241,88,172,130,248,18,226,144,32,193,27,38,81,
+    218,198,61,157,81,17,32,80,132,27,155,201,83,6,162,8,245,220,238,83,54,155,133,235,3,89,27,51,201,3,135,64,
+    90,8,69,104,177,148,98,175,103,233,99,245,205,23,12,55,136,244,147,142,81,63,162,72,169,105,57,103,61,138,48,34,
+    206,60,209,145,144,102,27,33,246,95,66,191,69,90,35,254,71,106,148,248,32,152,195,103,247,46,87,125,147,214,241,97,
+    84,144,69,98,217,24,254,189,90,215,158,33,157,233,141,186,129,107,30,207,43,201,208,35,137,29,8,18,221,187,169,210,
+    31,62,202,76,70,189,169,62,2,182,173,30,109,102,161,0,7,101,87,66,187,37,55,51,34,80,22,40,9,111,218,63,
+    245,66,104,179,160,73,40,218,177,120,46,65,214,244,216,210,31,239,94,134,193,72,111,0,114,104,152,176,89,64,15,193,
+    107,128,28,228,55,127,70,209,32,67,84,174,31,1,61,65,57,198,200,113,170,163,37,163,156,144,82,104,188,209,51,9,
+    136,131,103,199,0,197,187,19,82,118,56,3,168,131,216,116,195,17,177,225,140,96,123,109,108,210,198,156,84,3,244,249,
+    99,250,32,141,12,242,104,241,81,135,109,145,1,35,205,119,141,12,90,65,32,157,240,170,31,12,181,164,66,202,223,115,
+    225,138,172,188,68,12,82,86,118,180,38,34,117,187,226,52,140,168,191,60,138,26,129,64,59,219,150,96,240,79,72,203,
+    73,97,105,134,145,65,116,84,12,92,162,14,200,140,40,3,52,21,167,65,121,192,32,129,169,101,204,91,78,24,219,132,
+    51,116,128,123,192,92,2,237,183,164,197,204,7,161,27,163,21,57,132,96,224,172,86,223,185,57,62,244,231,139,33,103,
+    8,20,172,114,163,138,98,183,248,7,80,63,54,14,120,243,192,0,194,28,233,103,65,186,30,46,94,36,152,6,24,122,
+    99,36,112,138,223,79,33,124,102,39,25,177,172,222,167,227,223,246,191,209,118,61,59,18,183,218,247,11,113,117,107,153,
+    253,9,14,230,120,68,116,224,189,81,252,95,45,34,45,102,155,182,110,202,44,153,51,81,179,198,109,76,114,201,218,27,
+    158,5,191,166,48,244,32,119,150,41,173,127,46,221,148,24,52,114,27,242,130,61,100,232,226,89,6,52,102,153,142,124,
+    153,125,169,3,204,113,145,226,252,77,202,221,140,113,210,213,227,247,183,221,136,80,87,101,77,243,237,20,210,145,238,245,
+    75,75,88,132,52,141,56,158,249,128,215,137,137,19,69,230,21,18,86,151,70,0,208,57,206,100,6,170,103,202,91,139,
+    71,36,247,72,26,18,114,172,47,72,96,44,170,143,187,204,228,118,132,36,114,87,106,119,2,184,218,11,10,157,96,212,
+    69,180,101,24,127,235,250,8,126,21,117,65,179,172,4,68,197,80,52,112,154,138,116,74,168,160,43,14,130,199,51,10,
+    204,27,48,249,210,202,123,13,8,85,219,76,209,105,47,134,208,76,69,196,191,34,33,253,23,219,151,188,38,112,77,131,
+    1,181,95,176,165,109,204,55,223,79,25,114,48,63,34,118,243,173,107,61,61,206,95,59,222,111,79,10,132,64,9,95,
+    56,92,75,169,185,15,154,19,149,13,70,91,176,223,43,251,242,157,113,223,132,223,7,115,207,52,212,40,144,125,167,101,
+    67,164,78,26,130,252,187,81,137,128,76,36,103,211,93,114,80,67,237,75,121,6,229,186,9,28,186,236,41,41,175,112,
+    16,231,55,147,130,46,76,88,192,76,65,126,172,216,200,192,36,246,234,66,175,165,253,36,55,222,75,149,20,16,16,26,
+    132,166,37,216,241,158,0,128,55,164,203,255,203,106,186,126,207,8,43,23,220,131,29,33,121,171,176,147,20,103,140,137,
+    44,178,52,197,248,208,10,64,7,3,165,111,15,228,184,153,124,113,244,163,44,8,116,7,182,137,194,217,90,168,84,3,
+    6,133,145,172,128,242,140,178,24,160,45,119,210,167,100,185,57,155,1,136,57,122,224,147,32,79,108,38,182,220,135,93,
+    235,142,186,215,157,118,38,60,94,22,86,161,135,70,185,203,110,223,118,6,46,116,0,193,28,34,48,149,178,44,101,0,
+    22,102,77,21,231,45,154,96,44,250,238,0,2,119,115,23,175,97,241,41,10,60,83,133,219,4,163,208,97,175,165,77,
+    160,88,153,189,53,110,26,186,136,122,207,250,77,152,108,141,215,49,36,57,179,84,37,39,89,125,193,17,177,125,11,106,
+    27,52,6,169,240,227,105,69,106,20,100,239,202,169,229,167,153,79,167,241,54,155,250,153,157,252,243,40,6,174,128,108,
+    64,178,4,136,172,197,196,125,79,156,77,8,216,178,80,6,37,201,84,199,163,186,144,21,236,130,38,146,246,130,15,59,
+    31,74,186,189,71,6,68,119,58,85,208,47,182,27,59,123,24,40,70,232,138,29,70,159,116,143,7,216,174,123,197,114,
+    144,98,141,171,231,114,197,85,12,148,238,88,14,34,2,15,55,38,106,147,143,34,16,41,115,106,125,21,6,5,135,32,
+    97,225,212,236,239,187,117,161,196,67,88,132,136,196,4,178,110,111,62,232,0,186,197,99,224,121,142,92,208,96,85,130,
+    125,93,196,112,248,56,251,166,43,14,180,212,174,197,64,146,167,94,217,46,190,203,123,113,249,86,253,32,114,78,236,65,
+    165,8,4,66,33,82,228,24,109,88,210,80,174,202,190,58,115,77,137,155,135,82,230,234,181,229,170,139,94,201,130,146,
+    131,68,149,136,64,98,31,103,221,51,51,87,233,111,129,88,241,109,216,78,45,2,231,226,90,107,185,195,25,78,251,254,
+    234,84,27,242,163,72,50,42,169,121,242,90,226,96,127,126,199,254,14,89,101,97,113,190,21,249,108,197,83,90,2,169,
+    30,114,135,108,169,102,88,129,244,7,51,118,78,91,17,156,19,194,222,27,123,143,4,214,28,205,98,218,131,226,239,136,
+    134,214,200,90,21,2,128,24,209,176,80,4,218,21,167,194,14,127,27,15,35,12,52,249,60,47,145,63,111,109,37,172,
+    201,87,34,66,55,239,201,21,208,252,8,212,9,117,221,150,32,86,3,140,25,181,109,91,138,51,134,154,163,225,113,188,
+    166,137,12,48,41,77,177,185,181,80,148,128,168,82,172,150,243,161,160,146,25,71,5,145,108,152,141,223,30,38,238,165,
+    23,29,62,114,43,12,244,24,19,12,116,66,198,154,185,82,217,109,157,195,200,176,251,81,153,152,226,88,219,153,216,154,
+    220,73,129,0,243,10,222,86,106,236,192,11,249,128,122,33,135,0,11,22,73,78,64,21,39,134,71,112,62,52,201,169,
+    131,48,210,229,83,36,182,110,198,53,128,14,240,9,204,42,43,223,173,34,100,2,20,65,210,30,151,11,244,165,133,157,
+    47,25,140,118,91,69,63,67,54,5,194,197,47,172,69,85,93,212,123,245,243,44,49,156,138,9,3,73,160,59,208,49,
+    25,182,57,174,121,208,11,157,158,171,96,169,182,135,204,128,226,37,77,207,244,8,176,59,122,21,65,237,74,234,237,234,
+    87,143,192,173,129,35,127,238,122,196,226,228,208,4,212,22,216,34,177,70,67,169,10,87,41,106,128,45,194,212,217,79,
+    243,122,233,190,69,132,100,252,205,30,146,20,124,80,225,7,148,198,59,227,254,16,82,42,160,138,62,214,59,3,90,184,
+    153,189,230,23,220,33,128,144,18,254,26,69,183,68,20,76,114,138,106,4,164,17,67,122,25,62,129,76,237,25,123,6,
+    54,3,74,34,234,10,245,207,85,175,60,63,97,84,66,201,206,210,199,189,69,236,216,83,208,204,3,96,201,135,177,189,
+    39,83,248,121,244,137,34,199,215,136,110,136,164,237,210,31,0,229,69,138,116,80,125,203,48,242,66,109,122,27,20,6,
+    75,138,255,201,137,25,214,122,198,94,209,153,231,133,31,8,14,136,21,28,111,121,33,236,119,104,74,78,226,106,177,108,
+    183,186,17,78,210,190,134,101,169,206,123,215,44,169,157,135,53,208,133,37,192,88,212,135,248,54,251,251,101,1,233,165,
+    233,176,34,50,167,162,250,104,173,17,207,1,99,224,71,232,35,225,229,83,62,64,41,221,84,205,194,137,184,80,93,34,
+    40,198,58,120,130,132,51,176,250,10,77,195,67,204,45,1,156,51,243,108,207,132,70,112,207,118,16,69,96,101,87,197,
+    36,237,86,165,108,167,247,93,231,95,48,148,120,252,130,26,116,181,47,57,191,240,246,129,93,136,224,103,17,242,15,136,
+    253,77,33,35,250,91,178,41,71,20,133,245,181,238,166,122,98,22,136,220,128,38,193,21,165,159,95,194,105,46,172,152,
+    61,38,39,198,170,130,152,107,183,156,106,116,132,6,52,199,170,81,116,4,62,95,24,55,19,238,191,135,222,211,2,128,
+    6,92,45,182,187,127,246,135,37,64,190,88,196,147,163,247,174,245,230,138,174,161,151,45,174,130,35,25,12,33,132,97,
+    199,136,182,219,13,76,202,250,140,34,130,126,78,201,86,83,69,220,245,145,147,76,202,222,26,248,13,24,194,88,35,189,
+    100,108,202,160,114,154,248,14,153,162,185,18,24,94,226,61,211,118,231,251,6,6,16,55,48,73,21,125,38,3,211,219,
+    240,77,159,128,201,223,2,222,154,12,67,220,136,49,37,86,171,167,68,175,65,235,233,233,95,58,8,122,217,250,199,71,
+    98,113,130,48,201,156,53,80,171,101,6,220,98,123,82,3,243,56,200,123,184,215,191,18,162,215,7,211,111,116,99,160,
+    227,178,208,78,156,152,238,9,166,88,37,73,226,137,84,61,217,89,97,235,96,233,99,155,35,165,61,27,237,173,125,111,
+    114,109,138,99,78,205,57,220,4,209,117,40,209,109,92,187,109,46,175,193,93,67,31,54,178,56,153,18,10,189,197,72,
+    198,244,61,67,224,29,4,242,251,70,202,6,67,135,191,83,69,54,231,199,17,24,67,102,50,43,136,74,183,22,170,133,
+    233,81,236,111,5,26,233,215,162,206,42,138,132,71,178,108,188,170,124,219,251,89,252,53,159,157,155,9,179,193,1,75,
+    44,21,32,120,161,121,35,27,181,93,214,18,182,56,206,3,126,47,137,218,182,24,76,165,237,115,157,131,220,32,140,124,
+    113,165,233,233,38,169,40,109,118,135,146,156,7,86,142,29,133,1,25,155,75,78,166,97,127,121,170,214,103,196,202,169,
+    190,137,156,230,39,32,84,206,202,122,193,106,205,235,188,238,217,39,112,145,142,7,254,153,144,110,62,199,220,113,212,198,
+    122,42,73,170,56,239,71,187,172,228,255,77,83,92,14,68,149,125,221,146,19,4,254,172,37,245,68,33,73,115,44,47,
+    194,7,8,224,234,138,164,129,9,206,141,223,74,19,122,60,188,255,33,237,55,66,7,242,10,7,13,124,42,60,246,172,
+    30,10,53,99,252,204,157,32,57,146,72,44,188,68,56,26,56,228,88,123,34,72,204,30,61,23,142,100,249,40,38,99,
+    74,5,244,35,198,206,182,81,136,70,222,17,128,84,174,90,114,200,91,116,197,147,182,10,176,37,216,146,67,108,117,191,
+    84,180,26,32,214,221,159,133,5,237,232,156,226,211,6,168,23,184,155,18,181,92,101,39,92,7,154,186,152,43,173,168,
+    207,40,154,161,214,22,85,218,147,30,130,119,211,88,154,158,161,196,128,88,243,241,158,115,177,211,126,8,239,40,140,235,
+    36,182,251,26,176,4,85,60,73,150,199,165,252,65,107,16,165,214,1,240,233,6,19,47,51,136,23,49,175,63,48,96,
+    79,243,29,67,60,70,10,221,161,18,131,1,123,52,112,48,79,68,122,64,160,4,114,82,178,247,186,92,67,40,158,129,
+    59,193,202,100,249,72,115,33,52,148,63,68,205,161,30,82,87,146,56,44,114,122,218,222,55,105,142,226,35,40,222,18,
+    94,30,52,77,193,181,7,13,65,113,137,29,174,15,96,10,231,65,47,7,152,87,188,85,35,148,180,81,175,65,121,222,
+    132,87,95,179,79,216,120,177,147,31,101,116,31,107,128,129,154,24,164,35,186,159,3,134,16,172,210,222,111,1,75,57,
+    14,101,62,161,49,92,210,143,34,197,126,161,82,252,183,95,83,225,77,51,189,96,75,161,42,194,196,71,105,135,175,233,
+    94,101,254,154,185,74,192,183,51,99,224,134,139,73,30,96,211,232,241,17,254,76,52,205,112,62,168,15,3,51,159,0,
+    239,128,105,184,130,98,246,141,103,247,162,99,97,183,242,39,9,121,21,114,126,9,13,114,216,44,32,0,185,180,50,20,
+    246,62,242,194,231,141,51,176,107,196,61,234,22,130,96,19,50,46,13,80,212,180,6,225,90,195,23,222,198,226,14,78,
+    1,99,200,100,69,49,83,206,226,233,66,59,79,254,17,105,129,218,11,197,226,0,83,10,50,188,112,68,51,161,254,131,
+    203,47,21,55,34,133,197,169,16,218,158,80,131,74,87,196,127,8,48,134,104,25,68,199,121,176,37,104,179,31,42,136,
+    16,48,43,100,209,121,54,199,163,174,101,10,152,145,13,36,145,114,68,211,96,200,140,111,14,83,72,202,74,54,168,192,
+    216,18,66,41,168,229,134,167,112,34,1,215,127,226,205,157,202,214,72,199,88,140,122,80,214,112,53,40,169,89,165,91,
+    26,209,143,4,79,235,240,134,231,208,80,23,92,156,146,53,207,65,78,45,214,224,235,193,233,21,222,47,46,1,99,91,
+    110,209,154,24,111,229,31,166,4,98,21,10,154,148,243,121,189,196,225,200,2,165,231,122,150,37,235,235,224,10,138,164,
+    86,73,210,188,191,24,199,120,56,132,10,167,145,237,239,5,190,168,44,105,50,68,51,23,154,29,63,182,183,206,160,48,
+    111,12,27,51,14,136,146,104,8,120,3,19,239,254,241,56,66,213,17,236,16,83,25,195,182,113,250,154,15,191,94,35,
+    145,105,205,181,10,86,150,164,177,45,152,136,142,136,84,207,174,78,211,159,25,184,106,236,255,214,69,217,224,9,115,70,
+    226,33,196,27,245,39,16,198,126,24,36,11,144,69,147,85,7,204,213,170,191,22,99,173,230,117,133,134,64,123,29,168,
+    136,190,115,85,56,95,60,232,123,239,208,176,175,47,43,73,100,215,99,115,103,204,163,204,147,153,108,137,166,148,200,82,
+    237,238,64,27,96,209,53,107,181,167,76,6,18,73,75,2,186,221,86,235,206,247,194,5,5,244,205,206,1,214,139,168,
+    217,159,84,81,30,65,4,144,161,24,1,213,58,104,129,214,208,162,97,165,162,72,78,223,68,172,104,152,27,18,110,141,
+    44,205,212,43,5,80,37,109,174,103,30,188,110,138,249,74,82,143,49,242,135,230,130,238,49,204,29,18,234,198,248,98,
+    149,91,108,33,99,58,7,177,4,101,135,134,202,97,6,159,216,31,16,189,30,146,116,151,222,107,118,5,195,77,197,97,
+    234,177,236,144,150,136,91,98,106,177,38,17,204,140,194,126,43,61,145,1,14,230,230,54,213,156,32,198,237,155,195,8,
+    172,63,161,245,230,188,202,150,23,21,85,11,25,54,54,90,117,157,160,64,116,105,43,223,6,158,59,30,52,231,248,236,
+    15,202,177,155,12,157,156,82,215,228,232,16,19,133,114,216,195,217,172,211,144,135,189,190,75,163,198,103,0,118,249,22,
+    86,218,103,25,152,234,155,146,170,26,61,50,66,114,85,18,80,228,132,252,71,162,245,242,36,18,9,252,203,5,17,6,
+    124,253,79,80,228,204,178,171,4,129,124,115,213,105,224,216,146,6,217,139,81,129,215,137,66,188,211,142,89,229,124,234,
+    14,7,190,109,90,81,175,116,124,34,214,7,73,106,202,79,203,178,79,3,49,104,205,90,56,203,213,208,142,154,83,239,
+    176,222,239,200,74,19,241,134,18,189,28,138,148,27,88,181,95,25,53,46,4,36,253,101,172,98,170,54,44,64,212,169,
+    185,89,211,164,47,35,165,48,13,152,98,49,135,62,254,48,251,113,71,177,92,145,198,134,73,48,249,181,238,170,89,24,
+    127,195,96,247,87,53,58,239,69,70,224,201,143,230,198,136,9,145,32,193,101,149,230,77,16,63,102,69,146,135,149,51,
+    168,224,226,111,221,101,18,3,235,84,244,69,80,149,24,92,243,54,19,8,133,13,83,230,97,79,229,32,138,15,127,150,
+    167,41,117,1,178,107,221,35,136,122,16,64,104,144,138,111,114,17,110,16,181,219,47,162,243,219,166,64,155,54,117,62,
+    122,107,200,86,176,163,200,55,22,46,81,163,73,181,123,237,138,132,168,74,161,169,45,175,64,215,109,146,195,212,91,102,
+    225,150,217,212,163,44,133,236,161,168,92,107,30,129,48,13,247,174,35,36,35,38,30,92,83,227,24,201,188,153,168,95,
+    8,245,197,246,97,172,226,182,76,142,82,246,8,182,51,217,208,214,189,217,2,238,104,165,85,125,20,66,21,40,236,250,
+    83,5,155,6,245,167,170,227,45,96,243,77,24,197,248,2,135,147,45,202,96,171,211,240,90,219,204,186,103,242,101,10,
+    142,224,219,73,245,29,130,195,2,26,17,231,79,231,135,81,121,160,94,181,151,205,156,16,38,100,162,0,127,35,169,175,
+    96,73,154,105,10,45,51,196,90,92,229,9,64,227,75,71,146,91,84,30,0,103,139,240,126,138,73,121,237,238,0,253,
+    166,114,158,236,119,192,18,109,13,115,74,51,65,205,154,78,7,88,171,141,55,178,7,223,216,172,172,14,199,212,201,61,
+    239,37,139,20,72,68,147,3,238,40,22,18,57,231,202,113,121,82,180,20,25,42,163,254,171,214,229,247,50,102,41,140,
+    87,123,50,70,189,113,107,169,245,224,130,238,205,22,143,167,164,80,149,22,101,150,161,245,128,94,11,18,104,117,62,126,
+    163,103,254,228,108,160,214,172,33,210,83,161,245,237,32,3,15,60,118,143,33,231,211,76,221,48,108,250,59,61,118,37,
+    99,50,95,229,111,29,2,57,177,117,225,131,26,66,94,13,100,169,1,151,177,37,218,136,235,43,176,117,53,20,205,219,
+    7,174,70,119,189,76,144,137,87,155,92,15,10,208,84,150,137,240,29,238,167,108,179,66,243,4,239,84,115,213,80,105,
+    240,85,194,239,139,229,48,142,84,69,147,132,36,72,119,181,103,101,164,169,29,83,52,83,46,178,48,96,206,196,246,224,
+    168,235,160,185,27,66,204,43,194,37,92,211,237,228,233,115,71,101,166,178,140,178,102,208,24,224,99,233,182,226,253,168,
+    150,140,133,70,211,198,67,206,140,48,214,165,178,77,79,161,112,118,97,83,14,249,208,58,19,120,45,47,74,83,179,208,
+    130,3,75,62,65,28,170,104,216,181,244,253,62,88,253,8,125,208,230,2,43,71,220,142,146,49,216,24,217,3,204,136,
+    98,64,243,196,32,200,14,171,10,78,27,200,54,144,48,25,155,126,129,246,78,93,4,243,110,160,191,143,82,19,100,84,
+    16,165,74,143,172,185,176,42,63,208,172,47,68,252,212,44,175,9,179,239,56,2,146,76,185,30,103,197,149,185,144,97,
+    188,18,242,46,244,40,236,254,132,238,52,177,179,196,53,192,0,220,128,244,162,14,186,19,118,112,0,137,53,222,75,215,
+    254,118,13,40,56,254,14,43,222,61,156,2,243,50,14,90,93,64,136,164,43,196,245,208,147,251,153,191,206,64,165,104,
+    49,168,196,201,224,67,232,168,73,71,161,166,45,189,230,189,189,198,127,243,238,49,227,211,48,140,54,210,75,142,59,38,
+    37,172,6,199,46,198,163,122,69,133,234,215,198,80,246,64,135,0,99,114,0,250,242,245,159,219,67,212,244,153,45,215,
+    96,146,155,242,36,195,208,134,47,193,220,13,144,82,203,115,39,72,19,73,114,224,34,246,226,184,216,200,136,77,147,72,
+    84,198,76,230,243,165,208,198,96,130,137,179,228,90,11,66,35,50,97,61,189,204,108,205,199,23,139,88,133,211,137,22,
+    31,30,161,12,147,112,113,234,60,200,237,114,82,132,16,220,166,166,244,113,93,118,208,127,131,70,209,151,176,24,17,101,
+    217,61,232,20,97,140,1,13,56,72,98,34,253,174,225,128,233,105,1,216,39,133,161,170,63,117,0,133,6,26,44,3,
+    221,226,189,189,118,74,211,171,170,99,74,136,167,28,86,56,43,155,209,206,16,77,63,0,166,2,235,91,145,20,254,162,
+    226,42,224,107,48,217,49,6,20,221,183,171,226,208,18,170,29,2,231,19,119,8,72,253,212,8,94,3,244,129,80,202,
+    18,192,196,44,149,33,131,176,70,120,225,106,200,44,131,244,3,22,25,41,148,56,103,56,41,39,159,122,52,53,7,41,
+    171,231,72,72,120,122,76,6,96,4,16,61,194,127,48,176,0,183,64,145,18,54,54,56,150,211,2,152,81,112,154,167,
+    73,113,244,2,75,32,111,63,4,186,144,184,184,83,37,106,56,170,134,145,111,137,172,146,29,108,248,128,81,188,221,51,
+    56,138,157,41,115,122,121,25,101,36,189,32,108,137,246,114,131,235,210,99,150,241,120,69,237,54,251,96,113,2,80,251,
+    145,79,213,109,25,73,242,71,168,157,217,31,159,163,234,28,244,218,91,51,39,76,163,192,239,78,26,74,145,195,64,74,
+    204,201,37,117,237,86,211,82,97,254,171,102,18,165,193,19,198,20,44,163,67,62,223,68,151,124,36,189,1,14,152,229,
+    80,241,28,66,219,230,14,239,10,230,122,123,198,248,102,44,96,71,137,73,254,224,33,200,212,122,71,26,236,56,214,67,
+    205,72,188,135,99,88,128,57,105,152,170,82,58,146,131,80,83,175,232,156,248,211,81,149,18,2,4,172,2,131,27,242,
+    11,38,8,61,28,59,40,146,174,177,59,113,86,75,96,22,19,2,16,94,25,54,31,233,100,61,14,211,93,168,65,130,
+    117,244,64,52,70,92,77,67,115,60,163,183,192,199,239,5,11,21,26,233,67,192,253,115,124,194,22,123,139,84,184,102,
+    58,67,200,193,119,72,139,46,171,254,214,51,13,212,204,127,148,106,127,62,19,255,126,1,27,197,224,133,83,99,193,131,
+    78,62,158,75,77,136,21,42,96,26,4,18,147,40,67,212,239,82,62,155,108,220,251,126,84,112,123,13,59,127,215,176,
+    82,253,243,36,78,182,142,18,219,211,203,237,90,48,119,43,158,134,136,118,171,4,147,169,219,130,9,138,81,23,79,110,
+    112,142,9,240,104,201,1,82,57,154,208,68,210,243,226,33,2,128,183,15,226,151,51,186,112,220,165,157,57,71,23,97,
+    24,194,49,199,177,133,31,26,18,242,212,105,192,73,5,45,59,116,64,131,58,208,245,127,174,107,141,123,9,162,13,202,
+    67,159,149,147,86,253,134,229,177,189,90,28,37,154,208,88,158,42,101,194,108,22,226,36,231,9,164,250,241,152,227,125,
+    175,30,198,130,121,80,217,159,28,15,163,192,168,109,254,36,62,251,109,16,160,194,52,158,147,222,143,24,167,186,77,48,
+    64,213,48,49,11,143,24,192,43,211,184,34,15,119,27,84,124,77,36,252,131,227,34,9,7,25,56,210,145,1,106,71,
+    78,66,202,148,89,187,10,4,238,156,136,46,253,59,179,139,32,80,85,179,49,57,94,129,254,63,23,211,206,243,52,231,
+    143,108,54,101,0,11,80,41,149,125,145,28,225,235,208,160,34,211,192,20,179,137,14,124,202,67,157,225,249,69,119,8,
+    105,201,239,121,195,30,202,222,93,106,45,65,32,19,241,152,32,53,64,23,194,63,103,89,74,46,202,3,33,118,145,19,
+    155,237,31,133,248,18,89,114,1,25,202,228,178,179,93,215,2,13,129,240,118,154,95,87,147,180,101,40,250,26,210,121,
+    232,103,152,10,44,88,194,174,192,230,217,189,162,58,99,250,213,192,197,73,26,216,125,229,71,156,95,105,76,206,99,206,
+    36,65,247,198,49,209,197,80,169,151,41,154,75,227,141,101,17,105,138,250,16,133,57,20,89,16,186,246,88,13,211,188,
+    78,235,222,80,133,198,5,66,91,143,244,2,155,160,213,210,81,242,169,242,148,0,69,62,142,87,228,161,212,53,28,156,
+    237,118,62,159,30,0,107,93,173,158,26,124,79,150,194,70,165,134,96,216,20,35,214,234,59,26,169,88,255,150,205,7,
+    116,178,150,122,51,81,217,229,160,229,109,244,80,139,191,231,73,215,182,162,33,140,22,85,170,219,149,130,19,140,138,250,
+    144,189,89,234,61,217,107,220,185,78,249,80,137,86,50,126,34,153,10,242,143,11,131,136,208,247,236,205,254,73,86,172,
+    15,241,19,170,3,188,30,34,82,28,62,166,175,20,78,153,48,152,180,162,10,4,133,197,66,74,27,209,208,27,189,144,
+    254,8,180,185,7,177,245,111,248,176,206,46,40,158,1,35,54,61,27,132,24,3,211,10,196,152,2,94,10,69,44,10,
+    104,132,120,48,160,27,32,23,73,143,65,8,141,62,178,187,196,192,173,54,120,42,240,65,1,130,101,59,238,10,102,125,
+    68,178,53,32,231,101,164,159,230,26,220,224,70,118,197,6,50,160,171,200,167,82,11,50,173,32,35,128,130,177,4,222,
+    72,128,201,16,95,33,43,207,144,14,138,43,210,23,253,244,241,53,124,128,236,146,35,54,62,124,47,226,180,36,160,9,
+    218,131,188,252,252,20,147,41,20,111,30,46,113,197,213,204,44,56,208,172,12,141,93,208,42,146,37,89,14,171,10,50,
+    237,28,20,105,152,184,240,45,108,108,39,175,77,135,145,169,189,240,213,226,231,13,165,26,16,55,116,149,88,142,123,140,
+    119,65,136,238,65,191,146,15,60,20,242,200,223,236,117,237,170,223,210,43,32,70,108,56,173,167,75,61,148,11,124,225,
+    36,118,158,71,70,6,92,87,216,40,252,144,226,81,220,18,77,92,204,212,50,144,104,248,182,138,142,8,172,166,31,199,
+    35,215,218,149,8,204,27,51,72,208,201,0,67,44,65,151,87,240,150,155,97,8,81,145,2,98,128,246,128,40,165,21,
+    7,11,239,130,44,99,96,133,120,224,136,83,109,171,113,98,206,251,50,40,7,73,192,144,227,133,135,201,82,193,137,176,
+    12,131,11,6,124,157,209,22,80,228,48,218,44,21,35,146,136,33,66,196,110,23,185,41,154,97,142,17,38,160,7,172,
+    33,35,162,181,128,62,106,125,89,169,90,248,182,201,163,236,33,67,241,167,181,51,93,14,249,126,209,122,140,37,222,29,
+    211,3,48,161,201,43,46,35,224,173,221,149,46,201,197,2,118,45,207,38,32,195,33,98,87,23,23,10,96,190,35,246,
+    242,56,160,225,78,76,200,47,195,46,2,165,80,66,75,138,112,107,90,119,8,201,189,66,41,119,150,159,122,211,151,217,
+    133,161,152,249,182,105,67,113,8,125,101,196,230,249,201,165,176,130,187,186,79,62,68,1,149,144,146,249,190,98,59,139,
+    232,124,192,180,229,72,8,114,5,136,17,9,72,75,38,76,252,54,151,86,29,208,204,92,20,69,250,24,189,117,49,156,
+    124,199,224,28,10,238,1,179,108,72,80,71,14,110,34,246,139,0,167,136,32,144,60,161,42,186,10,211,77,124,11,48,
+    46,228,122,94,6,242,176,177,20,164,198,76,175,87,167,31,145,247,242,42,164,136,53,15,86,189,145,29,125,245,254,118,
+    67,76,110,42,110,123,17,218,145,17,69,214,198,67,245,76,167,66,34,195,29,18,177,49,94,231,15,40,111,11,170,11,
+    41,58,21,211,224,216,253,92,46,8,104,117,191,166,234,248,78,154,63,39,26,61,186,145,81,241,181,49,142,112,41,214,
+    168,18,228,185,178,222,80,99,219,176,66,37,240,87,22,24,151,138,119,108,6,228,19,104,101,240,193,60,168,42,82,36,
+    196,169,237,168,225,245,14,58,28,166,118,113,212,252,82,52,226,163,250,8,183,101,241,9,81,34,131,175,213,157,161,165,
+    166,249,92,98,138,42,76,188,212,87,131,152,203,62,132,224,157,251,182,236,219,37,182,160,51,42,1,169,88,229,101,195,
+    230,241,157,99,62,209,164,32,109,196,189,28,28,229,223,64,52,1,232,54,169,61,43,206,22,231,38,62,36,123,214,209,
+    184,253,144,208,3,213,62,169,167,36,11,176,219,191,246,96,143,195,86,157,27,152,8,234,248,142,238,228,204,28,181,230,
+    105,185,209,85,133,133,234,217,229,189,98,33,141,63,176,220,213,120,166,128,186,47,43,192,72,31,126,51,155,150,47,133,
+    51,197,117,101,206,48,99,130,155,223,237,98,189,199,165,17,30,126,172,36,182,175,142,155,159,130,164,43,18,112,4,46,
+    34,21,88,39,144,13,216,139,250,31,112,110,28,82,42,11,84,193,32,51,43,211,170,174,228,222,64,156,178,102,37,183,
+    53,249,137,81,224,58,122,85,108,52,164,85,230,177,54,185,202,252,138,205,132,196,18,73,252,89,105,107,61,134,13,19,
+    142,159,202,137,3,142,132,69,241,0,66,88,154,233,239,43,188,2,45,87,114,187,210,85,160,150,218,85,215,229,100,67,
+    97,229,48,23,122,65,165,141,246,113,217,208,108,167,195,24,75,32,234,196,128,66,87,139,64,44,144,14,7,114,16,211,
+    249,202,90,39,65,59,145,250,225,106,198,207,253,124,219,85,223,77,207,90,245,75,111,185,29,195,135,44,137,181,215,32,
+    171,118,154,167,236,4,26,148,63,15,91,139,19,205,3,39,24,158,249,223,159,104,249,73,201,56,119,211,195,43,20,217,
+    139,8,10,139,79,138,72,158,44,251,65,135,249,3,77,0,73,122,52,33,234,168,164,211,248,120,215,245,141,218,145,110,
+    144,199,12,170,72,201,149,120,59,35,14,146,93,177,102,249,251,54,204,169,64,154,113,241,7,100,97,76,1,60,25,90,
+    104,65,11,137,181,235,57,80,4,116,247,75,216,225,39,72,118,183,32,157,220,44,24,191,1,128,50,117,128,217,32,7,
+    25,52,96,109,76,206,205,151,113,58,240,137,84,74,224,69,17,134,169,36,31,193,206,49,139,251,108,242,111,100,221,79,
+    18,140,105,220,71,210,31,154,212,4,53,55,8,81,80,54,16,31,35,64,228,137,83,161,226,207,251,205,32,136,27,96,
+    86,65,176,136,14,116,205,73,10,47,218,154,169,197,8,218,0,5,194,50,97,97,79,80,36,29,27,88,66,124,81,34,
+    20,223,108,174,152,185,226,85,139,33,234,118,156,59,143,62,194,60,64,168,4,106,205,29,89,41,73,160,112,199,149,239,
+    53,106,201,83,7,188,41,241,60,61,219,3,240,151,13,255,28,24,89,103,66,9,64,32,79,108,176,18,250,224,196,86,
+    144,253,84,10,101,137,178,179,84,34,223,156,2,211,25,152,166,174,150,51,58,217,173,212,73,162,162,16,226,229,163,195,
+    30,3,30,240,179,79,178,98,218,157,42,169,105,68,185,52,62,2,164,254,30,1,158,112,97,17,254,25,194,121,124,40,
+    52,252,54,152,71,104,19,218,251,46,118,71,112,229,87,191,86,103,51,149,246,54,69,66,125,230,158,11,239,250,233,161,
+    239,241,222,14,143,161,47,50,129,101,57,244,43,127,164,132,9,15,52,18,124,48,20,204,1,147,237,15,43,94,64,142,
+    86,217,132,208,174,42,95,242,127,115,235,137,50,91,2,48,54,68,27,128,28,114,31,64,157,9,74,10,132,178,146,18,
+    214,13,34,176,197,46,90,180,80,116,182,23,34,178,185,215,253,35,51,135,170,38,184,163,98,130,136,50,22,164,227,68,
+    57,239,136,175,168,81,92,20,200,67,249,192,30,225,197,163,156,73,188,240,62,61,239,238,146,213,192,48,43,156,88,161,
+    42,122,90,138,2,191,19,247,44,42,236,205,59,183,139,53,86,192,44,26,168,240,187,98,47,147,165,219,24,255,163,168,
+    84,43,161,51,11,242,77,223,68,109,25,179,68,17,6,48,2,186,28,129,231,67,196,164,214,88,248,76,149,30,250,5,
+    59,178,40,108,133,237,4,108,140,125,132,50,67,128,37,131,171,35,224,246,248,29,208,92,202,221,127,150,167,226,216,116,
+    160,86,217,241,95,67,126,156,93,239,142,217,227,196,104,133,243,148,209,141,113,196,242,188,43,163,178,226,78,15,252,245,
+    26,16,211,147,111,214,31,72,83,107,116,99,2,13,66,229,189,93,34,77,72,137,9,177,146,198,65,19,93,103,145,246,
+    183,211,120,40,157,132,33,54,13,83,28,181,27,119,51,50,74,131,31,147,166,220,246,190,118,224,129,186,211,128,136,123,
+    236,56,220,141,212,65,227,8,132,17,47,59,78,140,110,165,254,144,28,183,82,68,192,233,195,27,193,139,202,82,220,177,
+    19,193,140,152,49,0,14,31,189,222,131,69,216,79,30,253,167,17,35,69,149,26,8,139,160,74,226,201,148,1,71,4,
+    237,170,169,100,147,168,105,230,166,89,95,222,238,248,24,168,248,174,208,241,234,106,238,38,5,89,27,64,210,15,94,204,
+    98,105,22,216,135,101,235,154,136,53,57,0,92,110,93,201,91,163,164,24,246,244,69,3,21,196,123,35,103,136,49,131,
+    58,38,196,246,221,92,28,190,2,65,174,141,212,116,182,69,48,53,11,150,126,146,125,173,41,144,189,7,66,109,20,170,
+    28,57,70,186,102,182,199,50,33,38,87,64,200,219,155,110,145,227,30,189,68,206,16,153,207,130,174,252,152,135,172,216,
+    88,126,6,82,142,17,146,19,186,45,123,201,81,7,154,66,67,5,68,129,96,137,15,221,252,134,242,188,76,233,212,94,
+    231,58,249,90,185,67,131,29,242,134,104,36,141,165,124,94,249,97,181,137,40,202,232,159,249,49,186,155,206,46,52,80,
+    151,99,216,71,224,143,24,249,142,249,42,245,178,76,14,173,210,87,40,102,63,75,56,113,84,18,152,151,188,151,19,202,
+    120,132,205,58,155,24,38,172,39,199,225,37,104,254,1,233,94,79,48,101,213,4,71,74,46,200,135,22,60,91,26,21,
+    131,184,104,138,24,115,128,19,67,37,232,21,57,53,217,71,4,180,82,65,3,209,40,177,4,112,155,140,10,129,94,90,
+    42,4,134,217,164,155,91,83,4,93,52,194,109,72,251,113,180,96,53,224,111,21,194,49,4,200,124,30,47,102,68,118,
+    236,69,155,250,192,220,148,225,89,30,44,185,22,43,229,85,61,186,22,157,172,12,164,170,47,242,63,122,157,145,138,160,
+    226,144,33,61,98,64,112,249,13,106,49,170,122,62,177,123,172,8,25,105,66,9,177,169,118,83,190,68,40,109,208,251,
+    239,63,75,80,96,61,175,248,49,251,84,25,18,153,75,215,228,159,69,173,93,162,107,48,20,168,200,109,92,170,129,136,
+    134,62,188,117,249,236,232,19,33,91,87,85,34,5,136,155,151,177,15,224,156,145,190,84,204,78,252,23,45,137,66,75,
+    242,131,15,206,135,206,99,103,143,98,164,66,68,23,163,72,234,245,214,41,48,124,94,65,111,3,240,138,70,85,182,218,
+    181,198,125,166,255,150,151,84,223,24,169,109,172,197,130,3,179,179,195,26,20,141,207,224,202,200,154,0,207,112,7,39,
+    169,20,37,103,216,121,135,1,14,129,125,23,205,213,177,207,123,147,107,73,124,153,182,210,237,79,187,82,188,33,163,119,
+    182,218,11,78,68,163,131,92,146,198,225,110,197,175,121,227,50,14,68,232,54,209,203,52,48,195,223,131,163,62,146,161,
+    238,159,247,33,176,134,160,66,31,7,217,245,102,196,25,144,50,94,122,128,144,142,115,212,165,42,121,236,27,17,171,222,
+    206,45,11,114,159,80,20,165,247,1,230,149,113,34,110,206,159,195,121,19,111,131,66,46,21,13,24,252,10,186,19,15,
+    209,132,234,16,7,59,247,6,123,82,214,12,27,89,150,218,151,200,156,23,193,95,153,196,156,54,150,146,175,145,212,33,
+    207,136,30,184,87,204,195,84,224,247,117,85,35,179,174,110,150,209,166,17,231,36,43,27,201,233,238,240,50,214,105,178,
+    70,153,43,6,213,76,202,224,139,193,233,117,64,26,104,129,67,87,4,12,46,178,196,164,245,115,80,230,165,142,34,248,
+    227,246,103,63,178,35,236,46,41,138,5,184,48,69,190,28,162,114,244,58,250,186,170,223,122,135,151,247,192,18,180,0,
+    13,102,91,2,217,193,28,76,128,95,16,139,145,6,62,249,140,65,174,99,193,66,4,240,85,192,8,124,205,178,145,57,
+    121,32,164,73,151,25,250,14,148,199,66,99,156,18,190,246,54,56,23,109,78,227,29,232,12,159,114,8,115,225,228,208,
+    146,49,177,196,132,78,102,35,46,229,69,61,225,92,194,182,228,115,88,35,1,1,160,15,16,220,238,193,155,117,123,22,
+    196,34,146,130,33,59,188,116,151,104,244,251,208,123,144,241,162,0,142,47,4,83,245,12,101,5,67,79,156,74,16,214,
+    33,175,205,23,4,59,143,105,108,39,141,213,57,184,184,251,134,65,6,185,165,214,18,27,50,224,77,16,125,154,34,80,
+    24,0,88,180,45,69,22,87,108,54,34,4,9,2,234,23,226,20,45,58,48,82,90,101,148,65,191,84,112,74,117,147,
+    185,133,230,79,130,117,83,40,10,241,147,156,56,41,74,124,15,64,97,46,110,42,61,12,188,35,137,249,23,172,163,24,
+    65,135,177,149,163,21,128,247,93,136,8,52,131,121,130,129,92,150,187,121,79,50,2,237,164,24,140,192,91,250,67,195,
+    129,84,44,136,254,24,240,96,4,254,83,57,216,70,44,7,78,46,129,177,34,46,183,207,129,157,239,160,43,105,76,174,
+    138,88,217,66,52,244,147,150,192,240,201,15,26,104,28,43,26,49,77,178,135,189,101,61,93,254,200,226,64,79,177,5,
+    7,202,175,209,200,26,48,222,33,130,6,103,224,136,29,209,44,79,223,205,182,155,140,63,72,191,87,93,196,158,12,67,
+    93,234,150,203,202,165,73,114,116,126,233,218,33,7,19,69,178,198,36,216,54,206,65,48,227,192,73,44,198,170,30,14,
+    152,117,148,0,217,112,191,104,61,84,45,213,93,66,214,46,78,0,22,92,119,169,254,78,63,103,26,243,139,118,251,224,
+    49,45,74,246,172,57,73,0,76,205,211,66,1,83,162,178,199,52,196,234,78,59,149,130,22,150,157,112,71,132,189,200,
+    39,79,170,221,15,4,129,217,242,128,234,57,46,24,222,87,106,251,18,217,107,173,182,212,11,80,133,168,228,17,24,223,
+    191,146,85,144,114,20,231,0,107,182,217,154,31,81,25,23,195,136,230,21,161,146,7,252,244,174,141,227,122,54,241,3,
+    189,124,83,163,148,221,98,34,182,90,175,29,23,132,19,17,240,120,88,69,39,144,135,181,142,101,211,237,134,197,35,227,
+    29,11,31,65,80,15,192,182,211,60,71,227,86,60,251,155,149,225,129,134,12,251,220,212,69,110,37,113,158,135,111,195,
+    11,82,155,162,112,194,196,161,150,63,25,46,34,43,146,226,112,131,117,8,8,188,228,68,111,38,210,55,178,197,193,12,
+    40,202,52,139,181,43,83,66,147,67,130,99,65,109,22,134,242,180,136,35,188,113,203,227,233,209,239,163,10,3,228,109,
+    151,45,238,103,228,2,74,90,19,53,3,211,94,8,128,201,49,2,152,190,26,47,109,183,38,248,176,143,58,22,234,239,
+    171,200,44,226,148,64,80,146,40,99,44,100,124,87,30,121,159,59,207,212,225,203,30,210,201,194,43,189,42,200,122,198,
+    185,106,43,226,54,192,234,225,136,20,222,98,183,105,238,89,82,89,224,236,245,198,141,234,209,134,163,144,92,61,225,237,
+    79,138,106,51,154,161,101,36,175,172,13,187,249,71,74,237,220,38,3,50,162,117,41,44,96,183,134,216,248,69,33,213,
+    144,2,125,219,152,44,116,39,79,61,174,164,188,77,85,211,114,35,106,19,204,27,169,215,177,171,218,156,82,35,148,138,
+    200,96,191,210,145,131,15,99,140,34,77,120,105,98,241,2,229,15,38,74,183,74,52,59,104,210,157,5,74,66,210,228,
+    99,19,61,95,217,201,80,33,200,229,72,164,134,173,0,65,217,132,74,100,18,67,91,39,226,204,192,132,144,143,129,89,
+    72,100,101,101,141,24,133,73,214,114,90,229,82,20,237,110,173,201,64,227,25,26,71,131,183,199,116,13,57,9,108,222,
+    95,222,169,79,255,96,181,228,233,134,137,101,179,216,196,41,126,7,4,15,1,164,126,173,150,193,176,63,201,190,186,127,
+    53,22,22,202,96,150,120,67,21,98,21,166,129,142,70,6,161,18,236,167,188,30,36,4,58,220,91,4,166,87,191,32,
+    241,160,112,186,230,208,130,194,239,248,203,54,242,189,183,152,159,150,167,136,120,141,109,154,11,250,168,157,70,137,85,140,
+    49,150,225,63,204,81,2,245,68,116,18,132,209,40,74,94,36,208,96,185,106,139,230,114,67,52,187,208,154,88,228,134,
+    40,230,65,197,165,111,27,182,238,31,166,43,134,48,88,115,25,246,7,28,19,164,150,247,219,211,208,243,228,111,192,240,
+    107,92,168,122,108,197,93,84,55,82,117,70,147,21,142,146,7,32,82,54,94,225,159,74,10,191,243,183,209,127,156,160,
+    140,78,47,121,7,20,134,34,11,110,142,57,13,148,93,54,82,37,84,230,36,66,67,41,113,12,204,148,69,113,132,201,
+    97,164,200,153,111,82,19,0,96,219,26,102,121,253,143,75,17,224,67,217,159,100,217,128,108,21,62,208,4,110,190,235,
+    17,23,225,30,27,84,16,217,147,151,103,25,106,219,73,71,6,45,198,150,37,193,46,228,1,23,186,14,82,61,105,161,
+    71,165,211,49,82,54,120,252,32,218,26,7,9,142,11,219,95,216,104,55,207,195,6,251,76,13,64,149,67,0,16,2,
+    98,81,3,146,133,74,53,174,97,83,245,147,168,61,94,70,198,180,245,187,79,77,46,214,224,85,19,61,189,169,134,227,
+    111,222,250,120,147,207,160,34,196,136,113,124,70,116,65,42,70,197,42,111,76,233,160,241,158,1,68,202,21,153,31,133,
+    78,249,224,83,4,80,45,86,206,248,18,133,220,43,146,38,75,24,115,90,25,124,195,180,231,162,72,215,153,128,129,237,
+    213,188,117,45,179,223,124,109,138,178,41,237,248,175,109,40,170,3,154,132,149,132,174,189,61,119,214,87,19,55,202,129,
+    219,14,32,96,6,183,24,48,104,39,169,140,61,112,64,4,31,112,71,148,185,78,110,7,126,22,17,208,89,28,27,182,
+    7,72,149,42,93,122,243,9,81,8,41,0,197,182,153,102,20,181,234,159,146,9,40,218,32,163,157,117,30,61,233,139,
+    51,112,240,148,153,64,171,55,79,20,231,26,141,143,34,4,78,182,176,34,42,145,154,210,183,11,137,211,83,100,142,124,
+    32,1,170,81,18,222,220,83,167,178,77,237,213,116,25,197,217,60,223,106,153,244,135,100,204,108,198,120,111,192,239,150,
+    116,19,189,196,244,158,83,29,5,59,241,10,88,40,202,185,70,175,236,255,11,8,113,88,246,109,244,233,224,233,150,129,
+    26,67,106,127,169,101,250,36,117,205,124,6,131,104,58,95,100,236,237,207,11,6,133,100,73,92,191,103,3,74,206,108,
+    8,75,182,123,81,150,30,251,35,147,108,138,108,71,227,5,2,124,52,34,41,167,67,204,119,131,16,107,87,48,193,58,
+    230,199,152,132,83,194,16,214,122,118,153,246,165,169,175,41,224,228,65,206,23,41,19,118,200,167,48,10,73,193,1,115,
+    102,216,175,157,140,178,168,101,210,216,122,181,153,228,113,17,81,41,24,14,167,250,245,4,25,168,98,33,218,57,252,116,
+    88,250,41,64,108,238,134,80,65,64,236,221,4,81,28,197,38,39,26,67,202,178,185,241,78,80,184,65,189,143,145,57,
+    55,20,128,178,73,248,56,165,8,152,76,90,213,67,98,41,43,160,206,229,37,179,13,207,32,189,7,40,75,90,176,131,
+    33,112,166,120,114,67,190,249,85,64,222,223,71,160,190,185,0,104,195,4,12,235,70,12,201,56,247,20,68,168,172,149,
+    45,150,56,64,72,177,27,42,11,85,218,20,254,180,102,216,43,218,205,133,118,184,47,191,119,192,100,63,226,11,34,227,
+    192,26,32,102,239,172,80,102,17,188,240,49,81,145,85,220,157,112,167,57,77,182,194,56,6,33,106,49,192,213,231,232,
+    249,24,90,224,33,10,43,192,131,180,54,132,142,15,58,49,197,154,5,163,7,222,51,4,188,18,169,130,99,229,24,230,
+    89,39,83,182,108,116,201,37,193,204,52,172,78,226,91,40,67,200,250,148,197,89,198,25,253,32,37,114,189,127,81,13,
+    146,153,111,127,21,195,165,39,42,246,230,163,102,171,224,137,32,35,138,208,219,6,0,154,21,13,35,163,32,54,116,228,
+    186,12,126,246,219,191,240,251,86,72,139,223,226,119,145,40,112,146,252,49,170,76,106,120,34,20,59,235,108,101,103,87,
+    239,153,124,84,198,165,4,153,18,27,99,111,36,96,72,40,134,25,15,145,208,167,153,204,253,26,17,214,203,96,60,186,
+    132,14,76,16,101,164,145,174,219,250,144,101,215,119,214,111,107,76,250,255,151,98,55,12,67,32,252,56,14,25,211,249,
+    163,136,136,3,89,141,81,168,175,82,176,98,88,209,102,85,68,152,156,95,220,110,99,59,211,145,186,226,154,64,29,103,
+    62,81,143,59,163,55,32,97,55,192,32,180,157,79,59,86,124,43,220,39,23,196,63,129,233,123,255,195,158,97,193,22,
+    85,17,22,26,140,208,68,153,214,116,107,32,166,147,128,25,180,235,45,56,143,48,12,132,90,42,193,132,204,7,17,224,
+    55,84,7,76,61,208,82,191,146,157,8,185,252,157,107,68,188,215,44,249,98,181,188,132,109,117,160,52,71,219,118,61,
+    9,31,71,135,155,159,71,225,229,28,236,68,18,137,177,56,35,44,136,131,138,127,218,82,56,21,151,39,27,200,35,176,
+    12,180,35,142,181,84,62,178,161,202,130,134,132,51,44,81,237,148,185,253,68,83,233,91,189,127,185,12,3,139,146,17,
+    101,225,9,193,99,122,4,147,205,151,190,201,29,13,254,111,148,80,122,101,120,73,57,244,204,125,6,52,63,195,22,62,
+    240,25,76,237,4,160,141,243,233,46,66,147,32,26,203,113,35,120,107,245,129,110,221,10,164,209,231,165,236,242,4,251,
+    186,12,141,69,167,5,110,145,232,46,102,96,203,10,128,1,2,25,36,57,77,79,128,217,99,57,109,105,58,99,100,13,
+    153,111,226,218,130,157,81,185,203,222,118,234,18,104,111,232,231,99,116,62,248,233,20,28,3,5,223,119,131,83,26,16,
+    17,208,110,77,83,37,8,0,6,34,113,112,148,156,198,53,238,83,11,198,25,100,17,193,242,212,177,174,210,244,53,174,
+    97,204,83,57,167,118,118,75,122,130,184,211,233,162,5,45,70,21,107,252,104,198,107,242,132,8,247,14,213,81,21,201,
+    2,118,97,49,77,81,32,140,151,211,50,193,148,214,68,133,163,126,56,108,153,142,93,122,247,47,87,201,65,54,109,108,
+    145,152,39,4,223,144,33,118,69,155,45,110,12,59,149,52,187,105,81,51,34,64,144,103,122,166,158,155,172,158,38,42,
+    160,203,102,17,244,156,64,187,89,249,182,195,204,97,172,112,204,221,247,179,48,20,34,130,99,127,16,155,239,222,167,60,
+    200,13,175,57,73,72,77,222,134,0,163,24,85,138,37,126,88,86,28,247,155,105,180,107,94,236,137,109,205,149,194,26,
+    0,92,87,243,217,1,135,4,213,138,132,252,19,25,97,224,181,84,96,242,22,48,23,44,200,191,170,246,26,202,158,243,
+    147,117,128,166,44,164,190,72,43,121,240,42,28,26,3,2,150,146,103,65,27,160,89,225,199,2,238,43,111,159,48,102,
+    88,123,77,139,254,217,188,150,209,181,67,44,231,38,33,67,197,132,53,4,225,242,194,114,143,0,136,50,254,40,137,196,
+    41,18,59,0,61,253,60,241,89,220,81,111,76,73,208,128,98,160,169,161,110,68,143,74,53,31,163,94,86,121,74,57,
+    163,74,187,228,96,155,5,33,74,2,208,111,37,40,45,0,228,15,0,53,118,220,96,92,7,116,144,91,11,95,82,82,
+    49,253,70,149,7,68,153,100,237,110,70,61,64,233,211,110,232,221,71,137,244,55,247,185,124,72,138,233,66,255,77,93,
+    215,143,84,204,63,186,102,198,153,102,218,156,220,51,228,10,63,77,11,234,62,62,35,164,34,28,185,251,215,175,87,56,
+    33,64,146,132,188,129,141,96,164,151,3,157,115,124,191,253,141,101,5,149,114,3,194,195,152,88,7,251,25,23,2,94,
+    81,79,152,34,16,7,44,210,204,213,197,153,166,39,19,197,208,16,68,63,48,156,76,104,37,91,47,109,99,24,112,49,
+    106,55,69,255,92,96,244,208,135,241,68,185,216,253,108,243,21,18,169,38,207,235,217,30,218,149,162,21,113,233,188,112,
+    50,143,76,229,229,25,36,162,6,235,50,201,201,254,203,176,161,30,76,157,24,84,5,1,107,168,191,245,171,105,50,234,
+    212,165,217,186,164,108,140,119,35,22,156,204,238,250,120,101,154,95,53,136,7,209,222,204,18,197,120,92,76,212,233,174,
+    193,146,155,25,79,165,61,193,174,246,174,21,252,181,44,51,115,29,53,231,144,9,47,148,64,227,129,41,31,41,3,176,
+    129,108,117,3,68,46,230,119,80,159,209,99,204,245,84,43,201,32,107,191,221,244,250,202,71,30,190,61,31,236,137,46,
+    85,63,169,237,41,164,155,114,112,196,107,21,149,238,117,52,112,20,5,179,150,236,243,203,169,160,251,125,167,247,168,133,
+    162,243,107,194,51,182,64,72,22,208,234,23,185,212,226,129,146,219,34,169,166,1,253,228,0,209,73,9,74,251,6,12,
+    173,120,32,203,38,164,198,92,98,201,135,224,29,214,239,77,9,189,152,172,159,53,42,80,185,188,163,239,237,136,1,186,
+    219,226,121,128,235,103,80,239,28,159,195,60,66,206,107,116,41,104,140,251,127,11,222,100,237,148,22,180,74,155,88,39,
+    227,73,238,209,118,54,174,206,98,89,138,24,81,140,147,10,215,40,117,246,87,99,85,192,17,68,238,240,104,74,23,200,
+    143,232,169,69,53,116,147,168,231,170,145,170,138,124,101,224,66,117,249,194,241,185,178,236,110,43,160,73,49,57,85,31,
+    217,173,64,212,37,13,82,57,39,31,60,197,124,80,161,69,225,154,94,10,51,138,16,213,62,199,33,86,156,93,39,44,
+    209,184,237,140,164,234,78,140,102,5,215,155,186,72,51,4,20,176,22,217,78,88,104,70,200,14,128,82,185,51,216,181,
+    128,240,124,28,224,94,150,24,63,48,245,81,8,217,145,13,117,234,147,75,39,122,221,229,8,215,55,101,155,188,150,128,
+    81,8,211,108,81,76,177,20,6,126,77,222,21,190,104,132,37,48,136,87,243,99,201,253,128,189,232,208,98,26,7,123,
+    137,156,53,35,147,173,128,83,46,239,222,246,201,39,120,121,216,168,29,159,152,73,66,125,49,210,87,24,141,212,80,44,
+    127,35,79,52,95,117,216,111,1,189,90,251,182,254,50,64,240,54,40,161,30,64,10,144,124,149,130,93,8,113,163,94,
+    111,211,65,130,94,210,232,127,197,101,16,32,65,241,32,26,198,74,169,224,32,249,99,104,222,27,31,17,44,104,76,171,
+    98,62,151,32,232,80,62,224,196,79,154,44,176,114,13,130,18,0,249,226,22,146,126,180,82,229,135,64,2,6,143,73,
+    160,99,173,121,235,143,109,138,77,216,182,166,225,197,124,152,49,137,138,13,249,77,241,35,75,83,159,101,54,122,205,94,
+    141,214,183,235,50,149,211,29,243,182,119,113,4,19,221,194,199,65,29,98,128,86,75,129,183,50,35,1,119,44,249,11,
+    97,33,111,86,126,95,255,120,165,186,254,184,13,167,51,170,34,147,86,130,248,99,105,254,238,172,46,22,203,51,215,151,
+    128,18,66,231,26,22,34,69,138,169,128,25,65,48,203,202,135,35,119,30,254,217,42,67,188,189,18,5,129,117,122,197,
+    148,203,68,152,21,38,150,68,123,213,186,10,222,9,0,159,34,192,205,10,6,141,6,220,228,91,102,11,146,17,4,124,
+    79,160,64,41,86,101,27,201,64,84,55,171,76,85,147,202,40,209,8,118,167,177,17,181,128,185,38,36,193,100,251,19,
+    193,168,226,213,247,204,43,231,37,218,249,127,29,154,246,185,72,108,120,163,91,96,46,181,219,209,72,144,32,218,2,138,
+    216,63,88,129,140,104,69,28,37,142,192,33,103,199,38,138,212,49,250,216,154,80,58,28,15,32,162,144,218,189,214,86,
+    84,237,117,55,231,63,43,66,60,242,164,79,110,1,15,49,194,189,172,97,23,155,128,154,72,65,109,68,115,198,200,34,
+    74,53,31,197,247,55,245,242,30,125,187,23,26,19,233,39,48,91,173,29,224,156,211,30,71,26,157,149,74,46,230,13,
+    83,159,153,147,11,19,16,92,145,194,57,43,235,44,227,62,18,212,58,228,106,141,4,22,41,196,163,35,25,97,193,105,
+    108,152,229,156,67,19,129,143,54,41,172,173,122,59,178,227,63,239,59,44,50,110,8,188,221,227,33,133,205,165,44,176,
+    220,192,88,145,19,114,33,200,170,117,131,241,165,73,93,77,10,227,102,72,244,64,7,59,126,147,119,214,94,122,92,23,
+    130,219,118,214,59,169,60,237,157,225,82,100,201,163,14,11,85,5,68,170,23,190,96,247,193,1,192,183,41,153,160,121,
+    154,139,73,233,42,230,64,228,120,213,138,198,208,234,33,64,85,219,4,222,86,164,103,240,233,86,122,229,205,157,16,52,
+    90,204,237,215,96,80,38,170,43,38,34,230,98,67,108,100,171,241,167,42,71,131,169,102,65,193,184,190,139,162,68,192,
+    130,205,72,76,205,134,23,138,188,120,161,75,151,60,138,139,4,104,111,37,213,105,84,103,35,64,2,3,4,112,56,219,
+    248,114,157,148,253,202,112,195,184,155,204,139,245,85,138,89,186,66,42,134,207,148,70,10,53,14,177,184,29,6,8,206,
+    59,5,159,208,115,38,74,230,6,60,131,180,237,139,88,171,134,75,1,239,6,240,122,249,71,66,76,53,104,89,21,35,
+    143,58,88,39,188,26,11,152,166,98,240,68,58,229,2,41,252,99,0,220,174,110,187,176,206,37,142,216,188,117,45,16,
+    244,129,75,16,29,181,172,131,226,180,36,93,112,251,6,86,8,217,165,223,166,92,221,8,175,37,37,39,103,184,134,139,
+    201,140,85,233,134,169,79,132,63,175,148,108,42,35,186,134,210,133,148,6,219,142,100,74,17,124,212,91,23,115,82,91,
+    40,152,184,77,221,134,250,26,154,132,64,42,225,104,170,99,62,216,109,41,176,96,12,35,236,253,28,18,226,178,217,234,
+    99,65,46,148,124,188,251,14,105,36,204,96,81,253,0,24,119,20,135,149,7,126,10,216,64,44,167,64,186,61,69,12,
+    12,8,228,97,123,241,83,248,69,129,135,126,109,35,199,56,31,202,14,29,78,126,205,115,9,59,144,100,103,60,33,118,
+    213,73,236,254,16,74,240,111,61,77,250,196,157,133,7,164,193,149,235,117,244,11,168,109,240,41,157,57,249,243,6,126,
+    21,125,89,9,107,58,33,109,24,13,157,177,24,17,186,129,108,104,37,160,185,59,69,144,17,103,42,170,188,214,118,64,
+    86,163,126,249,133,27,233,83,107,194,111,247,175,165,59,144,144,222,37,103,244,84,90,250,146,91,111,201,255,119,232,98,
+    194,240,59,58,66,205,255,207,121,127,10,132,91,170,99,69,207,231,10,74,138,138,204,105,181,164,6,116,107,188,165,126,
+    96,159,4,164,30,245,136,205,211,25,180,4,18,243,69,84,144,26,192,120,90,202,112,225,37,247,106,174,71,98,70,228,
+    39,80,130,205,145,205,154,134,11,251,17,218,167,131,73,28,202,229,62,161,165,158,43,15,198,127,15,89,231,118,8,20,
+    72,58,21,35,139,129,29,254,2,131,242,254,88,181,246,178,145,43,253,161,133,79,70,233,156,116,132,160,168,31,174,184,
+    116,50,98,245,8,100,73,135,248,244,45,216,224,11,239,60,252,89,1,20,197,144,19,43,216,79,59,193,18,112,93,126,
+    145,20,36,117,96,127,174,170,190,12,222,225,113,198,170,202,23,92,61,25,10,23,9,149,2,86,234,150,54,233,73,233,
+    99,12,146,5,58,249,179,195,9,195,84,130,165,16,44,124,20,169,8,20,127,179,193,3,227,99,255,30,85,181,6,39,
+    103,47,12,62,187,27,76,49,8,176,14,24,19,9,149,78,163,215,202,7,239,238,173,113,83,24,138,199,143,237,191,134,
+    183,118,111,87,104,232,16,196,136,20,222,214,185,202,200,178,75,188,188,222,117,76,238,199,79,190,54,183,210,57,57,60,
+    20,153,180,48,233,136,226,73,232,195,111,75,208,198,121,246,61,80,21,160,151,43,145,55,247,42,4,84,149,0,207,232,
+    21,204,210,235,240,241,227,25,108,143,59,42,80,22,205,77,139,27,112,99,5,134,215,162,132,168,60,29,164,47,182,152,
+    47,150,121,138,240,87,220,204,117,142,180,93,27,2,132,148,184,18,218,21,134,229,83,90,13,200,240,20,55,3,55,45,
+    30,4,194,65,76,15,217,220,71,14,121,75,210,135,78,160,55,58,4,151,175,137,70,30,153,187,205,37,176,151,26,96,
+    219,33,140,250,140,22,113,215,121,151,18,227,218,6,39,150,217,185,27,15,140,72,169,26,23,190,154,125,244,108,215,16,
+    195,44,149,60,248,85,4,136,236,211,161,102,69,118,146,248,29,29,39,218,119,217,102,134,30,192,138,7,3,229,47,109,
+    229,62,107,22,72,167,154,229,250,164,227,93,64,168,239,190,161,138,38,123,244,94,233,202,8,236,3,161,152,238,239,40,
+    160,106,194,233,38,55,28,249,72,17,20,51,247,74,46,88,97,128,41,188,8,172,109,48,172,193,55,153,153,19,182,117,
+    62,219,33,247,68,52,109,253,26,139,6,22,139,4,85,2,73,138,120,114,215,89,30,253,133,63,69,33,160,46,114,59,
+    177,40,232,242,76,75,68,38,109,7,99,16,2,86,198,140,107,171,195,27,36,60,24,10,167,184,103,123,185,114,22,14,
+    80,5,250,225,12,93,135,189,34,206,146,133,32,166,58,155,6,159,19,156,60,163,242,208,107,148,49,37,186,25,215,87,
+    184,126,196,213,6,144,7,171,89,168,22,22,187,159,136,11,22,45,212,89,64,90,191,0,102,8,225,93,27,3,72,175,
+    20,140,66,250,216,138,58,228,195,13,61,11,232,94,202,58,78,193,36,238,218,210,27,160,167,82,165,96,102,75,186,220,
+    37,30,3,98,31,252,76,61,254,160,203,162,247,230,221,215,86,129,72,215,205,86,120,147,97,83,230,26,107,143,249,199,
+    93,158,47,14,76,180,22,102,80,165,24,224,205,62,209,1,26,28,36,234,160,165,25,48,253,138,147,29,46,167,117,130,
+    204,234,190,194,12,94,95,94,52,24,179,167,11,224,145,73,38,184,82,185,142,232,128,68,16,192,17,69,151,178,29,116,
+    136,154,76,165,49,3,68,229,132,176,92,121,21,38,33,76,228,7,158,182,57,219,69,56,167,48,192,124,38,133,26,144,
+    200,225,19,46,6,45,16,131,183,162,252,64,140,188,155,68,10,155,3,160,81,162,23,15,132,104,189,174,161,21,128,126,
+    251,102,80,228,16,103,230,208,65,49,255,173,49,19,149,17,243,181,155,87,158,208,133,37,10,230,22,61,182,205,252,4,
+    147,246,34,96,159,195,211,8,10,202,43,204,158,193,139,121,46,97,220,116,9,25,179,92,127,200,14,180,63,243,27,137,
+    52,5,139,36,101,188,255,21,195,32,231,158,66,109,163,153,222,151,87,112,123,179,171,33,126,144,90,62,119,20,218,193,
+    152,42,227,193,1,18,39,219,15,185,168,207,251,28,156,195,198,97,34,222,162,44,153,180,43,120,7,2,92,247,174,148,
+    223,233,196,251,140,20,0,11,1,50,75,163,157,41,231,228,235,10,56,202,70,169,147,169,239,218,224,187,141,222,116,19,
+    78,55,27,70,42,41,90,200,74,232,112,74,128,71,59,108,62,7,51,9,126,77,20,32,55,72,172,171,118,75,114,135,
+    115,135,134,24,6,86,146,255,82,65,22,220,17,131,149,154,25,126,107,213,53,241,246,164,102,103,33,57,206,208,11,41,
+    44,8,1,105,65,159,102,241,65,95,96,208,172,209,197,156,14,197,172,75,42,106,7,135,33,130,225,164,208,148,7,175,
+    89,214,110,254,57,172,88,238,80,109,69,132,217,213,80,109,203,223,163,226,85,25,197,94,229,125,134,80,69,37,90,29,
+    115,249,71,168,0,181,0,113,249,164,100,153,129,50,232,201,66,115,225,193,106,72,144,168,103,152,146,85,123,237,156,61,
+    234,197,194,183,13,146,196,148,152,211,40,227,223,95,26,101,124,112,99,98,242,73,216,228,8,153,74,192,10,139,212,84,
+    100,229,160,160,106,113,240,114,52,58,207,180,49,207,213,148,27,186,86,64,108,183,15,64,71,61,66,242,48,210,227,190,
+    252,37,173,32,9,14,103,78,122,253,84,127,109,123,204,196,129,41,230,14,109,104,124,173,139,243,99,12,35,46,37,4,
+    254,171,208,169,180,207,205,38,155,8,16,227,212,134,188,70,163,60,140,170,112,198,216,81,43,138,150,14,6,10,48,17,
+    73,229,146,119,247,201,93,221,161,229,209,236,128,118,247,183,10,55,255,194,138,99,1,177,11,29,139,207,48,170,147,96,
+    129,216,212,85,179,253,50,53,168,216,238,6,40,218,184,47,143,138,201,134,223,131,114,57,196,145,46,255,231,34,24,61,
+    215,151,118,129,183,4,174,239,94,149,147,246,18,104,20,2,217,150,237,23,182,91,77,187,207,105,203,84,227,3,107,90,
+    41,111,152,165,59,79,177,108,5,216,47,205,241,211,251,96,231,45,4,41,139,133,100,141,193,227,199,205,25,245,58,219,
+    74,79,147,117,146,200,137,59,36,176,81,63,73,249,209,20,109,140,163,190,109,132,97,215,38,58,56,76,96,8,150,207,
+    82,98,47,138,51,147,114,19,131,222,28,220,30,240,166,212,173,98,33,195,131,8,164,173,5,49,69,65,255,194,251,6,
+    164,166,171,92,183,12,107,17,223,11,229,97,201,41,112,90,205,162,136,170,248,14,217,127,80,50,39,46,243,206,90,91,
+    71,152,236,171,195,152,131,173,253,155,100,25,52,190,104,203,154,105,117,27,155,188,251,126,176,1,61,47,119,232,2,52,
+    103,12,254,193,245,96,47,11,187,239,0,201,166,25,29,117,39,162,239,139,137,138,79,39,35,35,22,233,76,145,249,121,
+    34,83,73,66,9,63,159,244,31,180,215,170,49,157,43,85,62,110,98,33,4,68,54,44,227,197,49,32,116,73,137,57,
+    11,105,230,5,94,22,104,181,21,183,112,158,15,12,84,121,125,66,161,243,39,53,193,89,215,1,75,234,227,238,171,91,
+    178,153,48,188,90,210,108,101,151,233,234,76,77,91,13,54,243,182,27,68,171,195,254,97,192,203,160,101,8,134,192,229,
+    129,64,90,20,219,235,216,211,61,192,49,109,121,5,208,130,130,135,161,233,225,86,62,90,18,73,238,129,1,228,76,102,
+    34,230,163,110,48,32,198,187,168,196,196,82,188,72,168,247,41,157,65,151,91,155,144,88,42,190,250,54,22,107,67,143,
+    127,153,43,39,134,154,159,12,226,126,65,102,231,209,163,158,83,245,132,233,163,236,167,129,134,238,242,174,13,150,253,154,
+    178,89,62,208,196,160,20,172,166,28,98,79,189,240,112,199,46,130,234,21,199,131,234,128,10,223,120,26,69,143,66,193,
+    83,156,166,40,182,89,168,161,229,175,123,246,26,199,38,137,234,118,34,123,48,240,164,39,217,104,67,203,37,29,146,19,
+    178,240,138,222,37,200,150,11,49,229,107,165,215,73,70,67,207,67,0,126,152,168,92,232,238,138,73,63,231,190,76,225,
+    98,144,73,174,194,86,138,163,59,44,61,198,13,26,32,10,101,226,79,102,35,24,105,128,104,227,49,84,202,206,200,112,
+    248,82,62,106,24,141,189,150,84,175,221,88,54,213,68,112,117,74,213,184,134,242,95,34,186,236,251,101,194,8,41,95,
+    131,146,140,70,53,126,33,108,10,9,120,86,241,148,235,181,180,163,69,94,104,12,91,81,202,75,25,151,104,208,84,82,
+    186,10,103,16,58,118,255,195,20,245,120,113,176,170,233,225,3,12,76,57,90,236,58,233,24,0,113,221,115,59,160,213,
+    0,166,244,137,227,104,170,240,1,133,50,171,83,35,37,87,108,138,54,188,70,152,36,77,162,136,100,142,109,19,216,157,
+    15,228,153,136,157,188,218,201,105,195,229,41,128,76,187,71,255,140,89,93,67,3,77,138,136,73,253,232,145,120,29,73,
+    233,131,204,90,110,176,235,49,186,148,224,130,140,185,187,232,161,17,51,250,14,54,16,216,226,11,188,57,255,19,235,95,
+    199,151,77,32,96,240,52,171,188,224,180,100,122,105,206,217,35,46,161,74,124,206,236,146,165,228,255,168,92,117,151,120,
+    149,134,11,67,43,210,51,39,148,221,37,139,190,87,221,96,247,180,49,78,109,2,229,208,155,60,184,120,182,23,218,203,
+    201,199,45,220,153,107,179,104,236,241,3,126,163,209,2,60,157,154,30,100,208,210,187,220,237,200,79,161,42,212,45,181,
+    134,42,73,203,251,250,108,240,40,201,32,25,254,7,24,158,132,78,184,177,209,193,19,92,73,4,217,88,201,211,2,76,
+    103,181,7,96,82,21,83,174,243,57,3,221,15,35,11,199,139,215,61,206,86,0,171,85,226,30,233,47,12,165,241,241,
+    90,79,14,48,78,51,43,106,187,162,197,64,145,200,180,63,62,169,239,202,81,160,84,9,123,36,11,40,46,47,163,24,
+    242,141,76,221,232,235,19,224,107,75,39,11,222,12,17,217,210,24,176,149,89,110,130,110,73,17,70,57,202,185,144,183,
+    161,25,64,18,176,137,142,235,69,29,35,34,62,13,27,3,106,199,148,150,247,14,78,131,64,47,248,62,15,19,221,144,
+    54,46,88,107,212,208,166,217,155,224,75,40,106,85,131,233,133,137,45,176,185,41,48,100,124,112,85,190,26,10,142,125,
+    82,136,88,222,187,6,172,73,246,88,194,236,31,48,3,58,165,250,114,69,20,72,233,71,125,12,202,23,19,35,7,50,
+    25,235,128,83,181,207,170,6,240,21,124,227,166,230,165,234,154,25,10,83,118,220,139,3,57,192,127,206,87,72,135,204,
+    226,200,179,109,79,86,186,138,212,187,106,30,92,49,26,67,122,71,103,132,73,94,55,236,15,67,243,89,21,4,244,24,
+    152,195,113,122,75,37,118,246,193,119,141,37,136,162,66,162,87,128,171,206,44,199,13,37,163,223,183,76,80,107,231,186,
+    114,176,179,221,33,183,112,209,154,6,124,121,84,55,5,58,119,19,199,220,203,73,43,90,100,167,125,24,197,171,168,150,
+    92,99,56,157,116,184,216,240,36,98,219,145,10,50,56,147,61,240,54,117,190,237,219,169,111,79,228,237,7,165,148,68,
+    124,59,232,197,33,77,70,198,25,242,86,33,4,253,56,142,6,1,66,250,248,189,13,9,217,62,152,160,185,195,69,157,
+    144,25,9,71,74,81,239,40,216,225,144,90,26,33,36,149,128,80,188,96,215,25,115,48,110,212,69,109,54,56,235,48,
+    252,198,130,31,69,88,176,173,189,107,30,219,27,198,4,61,27,15,234,149,147,111,38,49,195,81,188,125,96,84,31,231,
+    222,49,230,5,30,90,27,186,10,185,152,202,4,252,5,4,149,101,28,130,209,0,104,208,236,205,76,43,139,107,142,44,
+    141,38,77,207,166,18,140,68,27,129,163,148,166,75,32,59,100,113,61,31,77,140,112,252,146,33,113,157,248,166,222,19,
+    129,198,84,169,191,43,77,172,59,109,13,50,175,226,60,253,102,150,44,40,163,62,167,119,21,198,71,14,249,61,183,95,
+    144,233,95,206,117,8,22,157,110,74,33,150,225,231,176,116,174,90,26,188,9,9,73,39,65,20,136,59,96,173,193,243,
+    163,96,104,30,197,112,76,82,168,153,2,224,96,200,157,19,75,235,12,69,50,241,157,40,28,184,182,170,232,208,8,95,
+    108,33,136,70,22,165,204,141,230,66,153,166,217,221,98,160,179,227,78,95,88,117,212,245,70,120,211,214,114,172,53,72,
+    179,161,137,212,239,253,86,55,194,240,146,201,167,86,157,194,210,78,6,5,168,102,154,160,12,10,145,86,41,155,198,101,
+    41,112,38,69,28,107,245,163,79,72,81,144,156,243,25,239,69,65,33,98,179,26,8,195,235,193,199,10,159,8,201,141,
+    237,207,80,108,202,230,182,192,250,72,254,66,178,143,254,104,235,124,178,32,160,41,22,66,135,101,75,72,89,148,194,116,
+    12,33,228,196,11,230,77,190,182,190,123,207,216,132,20,254,182,253,84,1,27,177,18,78,192,77,52,49,223,29,24,159,
+    68,253,85,217,162,69,26,76,222,17,46,250,55,56,31,4,12,144,19,71,86,12,225,142,252,47,179,73,11,128,246,3,
+    210,121,254,154,223,100,3,29,185,179,235,64,142,14,22,113,181,25,1,167,144,222,170,68,146,125,79,84,66,185,165,211,
+    71,49,52,4,252,14,28,1,240,171,167,250,45,20,178,147,41,14,106,149,2,249,164,240,78,115,138,253,20,140,92,65,
+    132,27,31,131,87,168,89,39,125,121,157,52,135,29,95,53,6,129,255,152,255,120,17,11,28,78,140,6,3,177,81,159,
+    5,3,72,95,8,122,138,45,107,38,27,163,100,77,39,152,207,216,215,9,151,124,144,81,12,144,24,5,1,236,176,56,
+    83,192,192,27,110,225,141,0,79,160,92,41,205,93,70,146,184,49,245,82,218,142,227,122,186,253,250,102,42,80,113,208,
+    68,117,16,59,67,113,35,100,200,73,55,85,160,217,111,40,58,90,220,47,196,53,150,163,27,188,160,100,69,100,187,87,
+    61,82,57,226,113,44,64,75,65,214,2,15,243,82,201,243,190,222,246,165,174,231,131,164,40,209,155,88,166,133,208,113,
+    48,218,71,251,23,176,107,244,117,161,186,13,157,84,47,65,33,21,19,221,172,53,35,68,254,81,105,147,20,102,17,248,
+    201,56,1,1,243,157,69,190,45,253,148,184,248,202,117,228,220,135,91,247,140,98,10,66,62,147,62,231,160,32,83,108,
+    229,55,224,57,21,70,83,206,95,73,122,100,178,24,51,205,150,179,166,18,159,0,30,91,12,230,14,26,35,233,107,85,
+    11,109,118,250,170,249,144,13,184,71,222,198,149,66,150,134,85,114,214,149,225,236,43,208,164,30,172,168,145,8,109,97,
+    61,152,56,187,48,58,162,170,153,216,103,41,73,75,58,89,22,80,60,57,91,192,88,137,170,12,97,21,97,63,102,52,
+    17,204,236,141,138,78,28,80,210,211,8,180,65,243,215,147,31,199,23,254,194,126,66,115,134,115,194,20,192,72,121,248,
+    72,240,112,163,149,227,165,91,181,150,138,114,177,90,40,140,143,121,248,229,228,116,41,214,168,46,93,102,40,169,179,222,
+    120,86,163,134,254,25,114,176,74,105,124,131,127,187,40,66,30,144,177,185,158,173,62,75,210,59,252,42,179,132,30,12,
+    248,241,88,103,170,211,230,24,196,54,59,33,159,130,163,108,67,170,219,93,102,28,112,89,197,179,2,112,86,230,73,224,
+    109,21,92,192,253,20,68,9,8,124,205,158,97,195,106,105,68,77,229,137,92,138,199,57,98,120,200,226,37,5,117,237,
+    175,193,151,187,153,117,206,239,11,195,23,133,95,66,109,99,26,206,232,78,3,19,171,237,120,243,33,252,179,18,229,9,
+    128,233,239,196,24,247,97,101,185,9,15,184,169,85,84,174,159,102,182,129,239,122,49,11,2,140,35,50,16,101,12,228,
+    10,220,230,35,164,65,166,187,212,198,43,122,23,31,199,254,236,204,120,242,30,231,187,102,76,252,157,238,32,45,253,89,
+    208,91,83,67,16,24,166,135,205,208,41,218,155,63,147,250,209,128,179,42,177,117,147,254,205,168,94,252,152,137,0,223,
+    246,48,227,227,36,67,140,138,3,101,19,242,44,12,180,169,45,25,66,6,5,248,231,128,156,227,123,114,168,22,21,72,
+    29,71,127,13,39,250,1,29,140,17,174,72,69,227,206,198,242,100,61,128,13,143,33,74,163,131,127,90,89,235,128,54,
+    137,158,138,176,26,88,191,78,47,124,33,227,42,67,251,165,106,3,14,130,186,248,165,154,228,29,36,64,12,47,219,217,
+    133,53,206,37,66,32,139,169,70,181,121,61,72,213,240,228,50,165,192,81,144,40,167,52,220,67,97,239,123,26,250,227,
+    142,250,67,130,100,252,27,154,231,239,46,147,160,198,252,202,207,89,11,52,29,17,189,41,75,168,181,225,7,16,157,246,
+    205,196,35,151,47,252,193,208,126,38,138,46,98,109,62,66,216,48,116,89,177,176,203,148,254,67,22,15,196,156,69,107,
+    118,203,239,137,57,32,55,2,191,180,116,31,51,96,44,71,124,6,116,180,157,42,9,214,111,56,96,181,127,133,109,31,
+    110,44,191,75,73,153,147,117,35,49,169,152,177,145,202,199,151,53,224,134,94,92,36,230,80,113,170,70,199,74,246,88,
+    222,183,41,200,244,111,194,118,9,194,243,181,42,139,200,82,223,58,216,147,25,109,103,24,181,77,44,37,24,61,44,118,
+    43,94,241,141,26,216,206,3,20,233,226,105,195,1,80,42,14,34,210,127,157,131,169,162,5,171,15,0,168,123,11,14,
+    105,89,134,214,56,184,177,9,31,43,0,116,108,206,199,60,73,171,109,74,65,32,73,236,200,135,65,117,70,157,229,58,
+    174,118,99,231,170,87,202,167,235,7,189,121,169,68,68,6,4,14,28,112,134,201,76,160,245,46,19,53,185,245,212,132,
+    238,231,18,223,19,124,211,60,97,65,220,181,99,56,116,213,224,20,119,62,241,41,230,252,6,2,220,219,194,206,246,7,
+    44,2,169,226,95,146,160,104,85,193,71,0,204,244,68,105,23,183,237,7,201,139,41,9,123,165,183,0,78,252,38,145,
+    150,44,30,46,184,69,7,79,163,237,245,169,6,129,254,248,186,79,183,37,141,126,199,115,103,44,116,104,33,29,94,188,
+    19,138,132,174,49,49,4,75,20,58,12,235,20,113,88,229,241,55,187,239,229,77,99,101,173,189,118,25,133,41,233,213,
+    169,130,108,160,52,233,87,174,165,152,63,31,133,237,152,97,121,78,251,235,182,159,196,206,56,220,250,211,44,173,205,74,
+    236,160,214,141,207,57,12,243,37,138,64,16,40,19,138,76,129,170,84,196,67,222,3,63,183,221,100,72,181,246,193,178,
+    94,126,200,70,48,115,155,92,10,129,222,38,191,119,158,212,17,57,214,135,129,41,79,169,142,245,212,107,148,234,147,125,
+    85,72,59,72,112,138,162,33,7,157,96,35,73,238,0,10,68,130,12,254,183,252,35,97,142,223,79,213,166,203,11,48,
+    175,195,3,249,192,86,130,186,141,89,150,83,100,166,232,227,127,41,51,149,149,100,94,155,152,176,253,63,27,70,160,105,
+    231,4,170,10,24,108,10,135,159,153,35,131,240,176,23,6,142,152,80,43,103,123,178,71,62,96,209,172,1,100,118,100,
+    203,198,181,136,186,227,135,225,32,190,7,48,194,144,209,71,114,156,154,205,117,122,226,222,41,124,236,117,98,148,35,221,
+    164,101,200,162,200,192,184,67,4,50,146,253,31,232,162,20,195,137,236,242,131,64,245,113,16,115,197,115,151,212,157,233,
+    181,20,17,162,208,68,45,110,229,232,240,217,178,171,163,210,248,245,240,26,137,33,101,110,118,128,112,5,43,33,85,67,
+    212,109,195,25,242,76,95,127,146,83,200,54,49,205,13,216,97,246,141,52,152,48,188,119,168,144,255,200,250,134,238,94,
+    179,35,141,255,47,53,231,176,113,165,50,205,146,173,130,62,149,1,219,153,220,146,132,21,177,121,97,243,138,237,97,227,
+    20,108,162,186,57,1,137,156,15,168,203,157,174,149,127,4,66,250,168,104,82,98,96,229,98,238,179,110,237,206,70,1,
+    247,25,80,156,180,94,61,28,34,155,104,111,192,96,34,41,240,115,24,101,224,181,10,78,247,194,132,133,197,124,141,37,
+    52,57,63,93,4,46,163,89,26,161,21,106,68,36,88,44,61,83,9,140,98,106,100,136,140,12,79,161,250,196,5,215,
+    61,137,136,143,169,175,115,143,106,118,15,44,99,35,196,226,28,209,169,225,96,54,161,195,48,100,95,106,205,68,123,114,
+    201,25,94,135,91,137,25,53,207,55,12,246,229,139,60,147,195,161,33,194,172,204,246,178,133,95,165,113,92,232,155,42,
+    138,146,229,247,126,79,177,227,83,91,67,68,102,125,71,128,58,2,40,159,91,45,162,95,148,228,112,62,53,116,104,94,
+    74,24,196,100,0,179,250,247,94,142,146,105,134,192,245,13,32,204,27,40,153,211,12,36,194,108,76,188,66,174,11,130,
+    65,136,14,238,227,150,204,126,163,155,56,211,143,120,130,199,12,160,137,23,51,27,101,72,187,188,237,119,241,140,237,49,
+    44,153,105,71,157,172,251,173,3,167,13,37,198,176,43,25,0,81,58,254,91,187,156,50,77,252,235,90,167,84,165,20,
+    242,63,139,31,155,99,191,78,212,84,53,130,150,22,184,80,60,131,97,115,126,218,48,117,49,84,204,237,67,60,129,121,
+    217,21,252,65,114,48,110,69,16,163,45,198,191,48,35,102,26,129,114,130,99,235,74,73,69,165,48,107,147,200,183,28,
+    26,195,11,189,106,244,58,78,2,40,99,253,2,226,55,76,95,179,74,209,241,73,100,244,60,13,113,2,32,80,78,215,
+    185,148,212,156,70,107,59,64,63,91,32,214,23,115,40,208,88,32,172,61,157,29,133,201,53,195,55,76,155,251,39,237,
+    111,155,78,18,140,1,59,2,195,173,180,98,253,92,230,89,177,211,237,154,185,37,10,180,10,188,4,124,179,210,225,248,
+    35,165,226,68,194,139,159,146,4,137,162,118,94,193,114,122,119,72,106,126,172,31,119,0,115,170,107,212,225,228,132,156,
+    230,132,34,188,211,173,222,107,125,59,92,7,3,178,83,228,90,18,27,27,29,155,203,115,230,149,84,43,133,19,243,249,
+    122,194,3,126,144,116,206,254,200,171,151,0,86,57,165,90,17,8,168,46,18,11,57,56,86,203,7,156,126,13,156,113,
+    154,49,115,46,225,10,234,179,190,74,166,69,119,59,227,81,212,27,44,10,201,78,58,160,87,98,252,248,120,202,155,249,
+    228,142,90,150,64,236,135,24,100,199,73,163,4,121,68,16,189,96,119,188,156,99,87,24,57,215,205,42,132,241,143,77,
+    221,3,197,215,178,5,2,228,81,207,12,16,0,74,203,24,147,83,209,99,39,146,1,152,238,184,137,178,182,108,247,33,
+    135,150,56,11,232,57,130,187,236,97,23,73,132,101,142,30,203,208,38,0,216,75,199,26,107,167,126,59,28,228,48,252,
+    60,202,163,80,199,211,203,44,236,164,240,159,107,127,82,12,112,109,52,222,225,154,142,188,46,91,125,22,144,23,152,158,
+    208,68,232,61,162,111,61,154,0,162,236,13,79,236,183,19,112,96,209,83,231,179,15,248,238,170,29,135,234,58,218,13,
+    206,193,198,217,64,205,205,89,253,158,125,58,244,135,183,172,84,24,17,194,122,204,169,193,195,85,252,120,124,108,89,32,
+    79,180,69,62,188,107,113,72,23,3,203,242,69,226,220,159,6,62,190,103,76,21,50,184,130,33,34,122,171,230,152,142,
+    23,206,80,206,73,220,11,38,21,122,168,180,107,64,11,16,144,33,233,10,213,8,125,165,158,223,251,168,13,148,193,149,
+    215,94,238,210,229,15,223,29,125,8,132,162,18,3,193,254,215,3,9,136,253,108,183,12,227,121,34,86,221,205,19,45,
+    63,79,61,49,127,114,192,116,150,102,152,251,107,8,149,57,185,50,161,209,201,194,239,170,190,157,34,160,50,67,130,79,
+    2,47,10,125,147,88,112,139,93,144,24,122,201,32,241,215,14,41,143,192,141,34,82,11,217,199,125,149,149,65,227,86,
+    106,3,181,217,98,53,161,229,32,8,215,82,142,84,150,83,142,9,94,183,82,159,179,99,171,98,9,101,200,173,248,97,
+    19,242,13,198,13,137,174,54,37,103,215,73,3,148,122,100,75,230,142,167,132,147,207,120,47,171,67,156,15,91,7,166,
+    43,23,176,208,251,166,50,59,246,203,222,226,137,16,78,44,212,210,148,82,6,118,27,55,245,170,77,211,85,101,194,211,
+    249,7,194,101,217,252,230,41,149,74,67,105,67,150,57,207,214,140,36,128,128,86,222,141,164,21,118,219,209,60,25,165,
+    195,19,51,224,17,68,95,21,135,187,150,130,117,170,223,225,61,210,119,231,252,224,53,90,131,163,181,226,138,154,130,105,
+    186,132,87,241,38,14,69,232,40,173,200,4,166,58,99,0,92,10,93,214,96,21,100,21,13,156,165,167,34,176,53,196,
+    133,71,198,175,48,172,93,68,160,247,137,236,82,54,140,215,208,136,239,133,47,38,160,107,72,91,86,54,177,108,176,205,
+    100,9,129,34,188,216,3,160,59,77,233,18,215,253,52,156,56,37,138,54,123,148,167,163,77,88,231,195,135,17,53,64,
+    161,71,82,231,20,57,133,132,60,137,94,5,82,1,130,78,243,105,204,178,73,21,161,245,46,181,211,140,40,185,229,65,
+    151,58,62,9,138,84,108,206,234,108,168,108,136,146,73,96,200,191,66,178,129,151,33,58,45,34,226,184,31,104,97,88,
+    5,140,2,21,226,214,78,12,254,149,119,40,37,119,80,33,185,180,87,169,253,2,160,138,75,184,123,253,130,180,216,206,
+    238,6,30,16,3,51,199,27,94,195,241,0,42,105,44,245,19,77,16,94,85,225,20,246,3,58,44,163,74,217,89,50,
+    233,74,222,112,238,13,159,191,119,214,2,143,173,198,99,96,150,146,27,240,41,82,73,7,0,251,136,125,43,205,73,180,
+    241,123,149,101,203,87,13,182,245,240,240,17,136,40,30,234,32,185,53,254,182,69,207,207,15,87,155,60,74,221,54,78,
+    131,77,35,3,233,162,80,164,183,222,222,112,68,14,106,185,196,211,6,59,72,109,12,222,144,23,89,48,27,205,93,0,
+    204,192,40,243,2,130,55,36,35,201,98,54,24,231,13,203,103,26,140,120,64,209,176,200,7,128,74,189,160,222,62,34};
@@ -0,0 +1,92 @@
+#include "Animation.hpp"
+
+#include <cmath>
+#include <algorithm>
+
+float Animator::Duration(const EntityAnimation& animation)
+{
+    return std::max(
+        animation.position.Duration(),
+        animation.orientation.Duration());
+}
+
+void Animator::Apply(
+    EntityAnimation& animation,
+    EntityStore& entities)
+{
+    const float duration = Duration(animation);
+
+    float time = animation.time;
+
+    if (animation.loop && duration > 0.0f)
+    {
+        time = std::fmod(time, duration);
+
+        if (time < 0.0f)
+            time += duration;
+
+        // Wrapped so long running loops keep their precision.
+        animation.time = time;
+    }
+
+    if (animation.position.KeyCount() != 0)
+        entities.SetPosition(animation.entity, animation.position.Sample(time));
+
+    if (animation.orientation.KeyCount() != 0)
+        entities.SetOrientation(animation.entity, animation.orientation.Sample(time));
+}
+
+void Animator::Add(EntityAnimation&& animation)
+{
+    animations.push_back(std::move(animation));
+}
+
+void Animator::Update(
+    EntityStore& entities,
+    const float time_step)
+{
+    for (auto& animation : animations)
+    {
+        animation.time += time_step;
+        Apply(animation, entities);
+    }
+}
+
+void Animator::Update(
+    EntityStore& entities,
+    const float time_step,
+    cpu::Scheduler& scheduler)
+{
+    // Animations per job, each samples two tracks.
+    const uint32_t chunk_size = 1024;
+
+    const uint32_t count = static_cast<uint32_t>(animations.size());
+    const uint32_t chunks = (count + chunk_size - 1) / chunk_size;
+
+    scheduler.ParallelFor(chunks, [&](const uint32_t chunk)
+    {
+        const uint32_t last = std::min(count, (chunk + 1) * chunk_size);
+
+        for (uint32_t i = chunk * chunk_size; i < last; i++)
+        {
+            animations[i].time += time_step;
+            Apply(animations[i], entities);
+        }
+    });
+}
+
+void Animator::Seek(
+    EntityStore& entities,
+    const float time)
+{
+    for (auto& animation : animations)
+    {
+        animation.time = time;
+        Apply(animation, entities);
+    }
+}
+
+size_t Animator::Size() const
+{
+    return animations.size();
+}
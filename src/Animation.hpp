@@ -0,0 +1,57 @@
+#pragma once
+
+#include <vector>
+
+#include "Entities.hpp"
+#include "cpu/Scheduler.hpp"
+#include "properties/Track.hpp"
+
+// Keyframe tracks bound to one entity's position and orientation. Either
+// track may be left without keys to leave that part of the entity alone.
+struct EntityAnimation
+{
+    size_t entity = 0;
+
+    Properties::Track<glm::vec3> position;
+    Properties::Track<glm::quat> orientation;
+
+    float time = 0.0f;
+    bool loop = true;
+};
+
+class Animator
+{
+private:
+    std::vector<EntityAnimation> animations;
+
+    static float Duration(const EntityAnimation& animation);
+
+    static void Apply(
+        EntityAnimation& animation,
+        EntityStore& entities);
+
+public:
+    Animator() = default;
+    Animator(const Animator&) = delete;
+
+    void Add(EntityAnimation&& animation);
+
+    // Advances every animation and writes the sampled tracks into entities.
+    void Update(
+        EntityStore& entities,
+        const float time_step);
+
+    // Update in chunks on scheduler, animations must target distinct
+    // entities.
+    void Update(
+        EntityStore& entities,
+        const float time_step,
+        cpu::Scheduler& scheduler);
+
+    // Jumps every animation to time, for scrubbing.
+    void Seek(
+        EntityStore& entities,
+        const float time);
+
+    size_t Size() const;
+};
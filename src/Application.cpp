@@ -1,18 +1,33 @@
 #include "Application.hpp"
 
 #include "Input.hpp"
+#include "Import.hpp"
 #include "imgui.h"
 #include "math/Random.hpp"
 
 #include <array>
 #include <iostream>
+#include <stdexcept>
 
 #include "sdl/Main.hpp"
+#include "cpu/Main.hpp"
+
+static const char* SCENE_CACHE_DIRECTORY = "cache";
 
 int main(int argc, char* argv[])
 {
+    cpu::Options options;
+    if (!cpu::ParseOptions(argc, argv, options))
+        return 1;
+
     std::unique_ptr<IApplication> app = std::make_unique<Application>();
-    return sdl_init(app);
+    app->scene_path = options.scene;
+
+#if defined(_WIN32)
+    if (!options.headless)
+        return sdl_init(app);
+#endif
+    return cpu_init(app, options);
 }
 
 Application::Application() :
@@ -24,6 +39,8 @@ void Application::Init(std::shared_ptr<IRenderer> new_renderer)
 {
     renderer = new_renderer;
 
+    update_stage = std::make_unique<UpdateStage>(*context->scheduler);
+
     key_down_callback = [=](Scancode key)
     {
         switch (key)
@@ -68,27 +85,43 @@ void Application::Init(std::shared_ptr<IRenderer> new_renderer)
 
     fps_time = timer_start();
 
-    prop.Animate(
-        context->property_manager,
-        0, 1.0f, 1.0f,
+    context->property_engine.Animate(
+        &prop,
+        0.0f, 1.0f, 1.0f,
         Properties::EasingFunction::Linear,
         []() {
             std::cout << "Complete!\n";
         }
     );
 
-    entities.resize(3);
-    entities[0].scale = glm::vec3(1000, 1000, 1000);
-    entities[0].position = glm::vec3(0, 0, 2);
-    entities[0].instance_id = 0;
+    if (!scene_path.empty())
+    {
+        // Models are converted to a scene file once and mapped after.
+        const std::string path = Import::supported(scene_path) ?
+            Import::convert(scene_path, SCENE_CACHE_DIRECTORY, *context->scheduler, renderer->ImportOrder()) :
+            scene_path;
+
+        scene = Scenes::map(path);
+
+        // The renderer sees the meshes first so a scene it cannot draw
+        // adds no entities.
+        if (!scene || !renderer->SetScene(*scene) || !scene->Instantiate(entities))
+        {
+            std::cout << "Could not load scene " << scene_path
+                      << ", using the default scene\n";
+            scene = nullptr;
+        }
+    }
+
+    if (!scene)
+    {
+        scene = Scenes::load_default(SCENE_CACHE_DIRECTORY);
 
-    entities[1].scale = glm::vec3(0.5, 0.5, 0.5);
-    entities[1].position = glm::vec3(-1.5, 2, 2);
-    entities[1].instance_id = 1;
+        if (!scene || !renderer->SetScene(*scene) || !scene->Instantiate(entities))
+            throw std::runtime_error("Could not load the default scene");
 
-    entities[2].scale = glm::vec3(0.5, 0.5, 0.5);
-    entities[2].position = glm::vec3(2, 2, 2);
-    entities[2].instance_id = 1;
+        default_scene = true;
+    }
 }
 
 void Application::Deinit()
@@ -114,11 +147,26 @@ void updateQuaternion(
 
 void Application::Update()
 {
-    entities[1].position.y = static_cast<float>(2.0 + sin(ticks * 0.01));
-    entities[2].position.z = static_cast<float>(2.0 + sin(ticks * 0.003));
+    // Animates the cubes of the default scene, entities 1 and 2 there.
+    if (default_scene)
+    {
+        glm::vec3 position = entities.Position(1);
+        position.y = static_cast<float>(2.0 + sin(ticks * 0.01));
+        entities.SetPosition(1, position);
+
+        position = entities.Position(2);
+        position.z = static_cast<float>(2.0 + sin(ticks * 0.003));
+        entities.SetPosition(2, position);
+
+        glm::quat orientation = entities.Orientation(1);
+        updateQuaternion(orientation, 1.0f, glm::vec3(0, 1, 0), 1.0f);
+        entities.SetOrientation(1, orientation);
+
+        orientation = entities.Orientation(2);
+        updateQuaternion(orientation, 1.0f, glm::vec3(1, 0, 0), 1.0f);
+        entities.SetOrientation(2, orientation);
+    }
 
-    updateQuaternion(entities[1].orientation, 1.0f, glm::vec3(0, 1, 0), 1.0f);
-    updateQuaternion(entities[2].orientation, 1.0f, glm::vec3(1, 0, 0), 1.0f);
     ticks++;
 
     const float time_ms = timer_end(fps_time);
@@ -131,6 +179,12 @@ void Application::Update()
     context->property_manager.Update(
         time_ms / 1000.0f);
 
+    update_stage->Run(
+        context->property_engine,
+        animator,
+        entities,
+        time_ms / 1000.0f);
+
     GuiUpdate();
 
     const float window_aspect_ratio =
@@ -166,6 +220,10 @@ bool Application::GuiUpdate()
 
     ImGui::Begin("Camera Controls");
     ImGui::SliderFloat("Float Value", &zoomValue, 0.25, 4.0f);
+
+    const UpdateTimings& timings = update_stage->Timings();
+    ImGui::Text("Update %.3f ms (properties %.3f, entities %.3f, hierarchy %.3f)",
+        timings.total, timings.properties, timings.entities, timings.hierarchy);
     ImGui::End();
 
     return false;
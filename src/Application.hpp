@@ -5,8 +5,10 @@
 #include "Timing.hpp"
 #include "Camera.hpp"
 #include "Entities.hpp"
+#include "Animation.hpp"
+#include "SceneFile.hpp"
+#include "UpdateStage.hpp"
 
-#include "properties/Property.hpp"
 #include "interfaces/IApplication.hpp"
 #include "interfaces/IRenderer.hpp"
 
@@ -24,9 +26,16 @@ private:
     float right_speed = 0.0f;
 
     Camera camera;
-    EntityList entities;
+    EntityStore entities;
+    std::unique_ptr<Scenes::SceneFile> scene;
+    Animator animator;
 
-    Properties::Property<float> prop;
+    // Set when the built-in scene was loaded, whose two cubes Update moves.
+    bool default_scene = false;
+
+    std::unique_ptr<UpdateStage> update_stage;
+
+    float prop = 0.0f;
 
     std::shared_ptr<IRenderer> renderer;
 
@@ -0,0 +1,10 @@
+#include "Context.hpp"
+
+#include <thread>
+#include <algorithm>
+
+Context::Context() :
+    scheduler(std::make_shared<cpu::Scheduler>(
+        std::max<uint32_t>(std::thread::hardware_concurrency(), 1)))
+{
+}
@@ -1,11 +1,20 @@
 #pragma once
 
+#include <memory>
+
+#include "cpu/Scheduler.hpp"
+#include "properties/Engine.hpp"
 #include "properties/Manager.hpp"
 
 class Context
 {
 public:
     Properties::Manager property_manager;
+    Properties::Engine property_engine;
+
+    // The one set of workers, shared by the update stage, the CPU renderer
+    // and noise generation. The calling thread is one of them.
+    std::shared_ptr<cpu::Scheduler> scheduler;
 
-    Context() = default;
+    Context();
 };
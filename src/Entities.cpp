@@ -0,0 +1,306 @@
+#include "Entities.hpp"
+
+#include <bit>
+#include <cassert>
+#include <cstring>
+#include <algorithm>
+
+// Marks an entity whose world transform the running Propagate already
+// recomputed, so its children follow. Cleared to WORLD_CHANGED at the end.
+static constexpr uint8_t PROPAGATED = 3;
+
+static constexpr uint64_t LOW_BITS = 0x0101010101010101ull;
+
+// Entities per propagation job.
+static constexpr uint32_t CHUNK_SIZE = 1024;
+
+// Entities transformed per InstanceTransforms batch, kept on the stack.
+static constexpr size_t BLOCK_SIZE = 256;
+
+size_t EntityStore::Add(
+    const Entity& entity,
+    const uint32_t parent)
+{
+    assert(parent == NO_PARENT || (parent < positions.size() && alive[parent]));
+
+    // Freed slots are roots already, so reuse leaves the levels as built.
+    if (parent == NO_PARENT && !free_slots.empty())
+    {
+        const uint32_t index = free_slots.back();
+        free_slots.pop_back();
+
+        Set(index, entity);
+        alive[index] = 1;
+
+        return index;
+    }
+
+    scales.push_back(entity.scale);
+    positions.push_back(entity.position);
+    orientations.push_back(entity.orientation);
+    instance_ids.push_back(static_cast<uint32_t>(entity.instance_id));
+    meshes.push_back(entity.mesh);
+    parents.push_back(parent);
+    alive.push_back(1);
+    world.push_back(Transform3x4());
+    dirty.push_back(LOCAL_CHANGED);
+
+    hierarchy_changed = true;
+
+    return positions.size() - 1;
+}
+
+void EntityStore::Remove(const size_t index)
+{
+    assert(alive[index]);
+    assert(std::find(parents.begin(), parents.end(), index) == parents.end());
+
+    alive[index] = 0;
+    dirty[index] = LOCAL_CHANGED;
+    free_slots.push_back(static_cast<uint32_t>(index));
+
+    if (parents[index] != NO_PARENT)
+    {
+        parents[index] = NO_PARENT;
+        hierarchy_changed = true;
+    }
+}
+
+Entity EntityStore::Get(const size_t index) const
+{
+    Entity entity;
+    entity.scale = scales[index];
+    entity.position = positions[index];
+    entity.orientation = orientations[index];
+    entity.instance_id = instance_ids[index];
+    entity.mesh = meshes[index];
+    return entity;
+}
+
+void EntityStore::Set(const size_t index, const Entity& entity)
+{
+    scales[index] = entity.scale;
+    positions[index] = entity.position;
+    orientations[index] = entity.orientation;
+    instance_ids[index] = static_cast<uint32_t>(entity.instance_id);
+    meshes[index] = entity.mesh;
+    dirty[index] = LOCAL_CHANGED;
+}
+
+void EntityStore::SetParent(const size_t index, const uint32_t parent)
+{
+    assert(parent == NO_PARENT || (parent < index && alive[parent]));
+
+    parents[index] = parent;
+    dirty[index] = LOCAL_CHANGED;
+    hierarchy_changed = true;
+}
+
+void EntityStore::BuildLevels()
+{
+    const size_t count = parents.size();
+
+    // Parents precede their children, so one pass finds every depth.
+    std::vector<uint32_t> depth(count);
+    uint32_t max_depth = 0;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        depth[i] = parents[i] == NO_PARENT ? 0 : depth[parents[i]] + 1;
+        max_depth = std::max(max_depth, depth[i]);
+    }
+
+    levels.assign(max_depth + 2, 0);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        levels[depth[i] + 1]++;
+    }
+
+    for (size_t d = 1; d < levels.size(); d++)
+    {
+        levels[d] += levels[d - 1];
+    }
+
+    order.resize(count);
+    std::vector<uint32_t> next(levels.begin(), levels.end() - 1);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        order[next[depth[i]]++] = static_cast<uint32_t>(i);
+    }
+
+    hierarchy_changed = false;
+}
+
+bool EntityStore::LocalChanges() const
+{
+    const size_t count = dirty.size();
+    const uint8_t* bytes = dirty.data();
+
+    size_t i = 0;
+
+    for (; i + 8 <= count; i += 8)
+    {
+        uint64_t word;
+        std::memcpy(&word, bytes + i, sizeof(word));
+
+        // Bit 0 set and bit 1 clear is a byte of LOCAL_CHANGED.
+        if ((word & ~(word >> 1) & LOW_BITS) != 0)
+            return true;
+    }
+
+    for (; i < count; i++)
+    {
+        if (bytes[i] == LOCAL_CHANGED)
+            return true;
+    }
+
+    return false;
+}
+
+void EntityStore::PropagateRange(
+    const uint32_t first,
+    const uint32_t last)
+{
+    uint32_t pending[BLOCK_SIZE];
+    Transform3x4 local[BLOCK_SIZE];
+    size_t pending_count = 0;
+
+    auto flush = [&]()
+    {
+        InstanceTransforms(
+            positions.data(),
+            orientations.data(),
+            scales.data(),
+            pending,
+            pending_count,
+            local);
+
+        for (size_t k = 0; k < pending_count; k++)
+        {
+            const uint32_t e = pending[k];
+            const uint32_t parent = parents[e];
+
+            world[e] = parent == NO_PARENT ?
+                local[k] : Multiply(world[parent], local[k]);
+
+            dirty[e] = PROPAGATED;
+        }
+
+        pending_count = 0;
+    };
+
+    for (uint32_t k = first; k < last; k++)
+    {
+        const uint32_t e = order[k];
+        const uint32_t parent = parents[e];
+
+        if (dirty[e] != LOCAL_CHANGED &&
+            (parent == NO_PARENT || dirty[parent] != PROPAGATED))
+            continue;
+
+        pending[pending_count++] = e;
+
+        if (pending_count == BLOCK_SIZE)
+            flush();
+    }
+
+    if (pending_count != 0)
+        flush();
+}
+
+void EntityStore::Propagate(cpu::Scheduler& scheduler)
+{
+    if (hierarchy_changed)
+        BuildLevels();
+
+    if (!LocalChanges())
+        return;
+
+    for (size_t d = 0; d + 1 < levels.size(); d++)
+    {
+        const uint32_t first = levels[d];
+        const uint32_t count = levels[d + 1] - first;
+        const uint32_t chunks = (count + CHUNK_SIZE - 1) / CHUNK_SIZE;
+
+        // Each level reads only the finished level above it.
+        scheduler.ParallelFor(chunks, [&](const uint32_t chunk)
+        {
+            PropagateRange(
+                first + chunk * CHUNK_SIZE,
+                first + std::min(count, (chunk + 1) * CHUNK_SIZE));
+        });
+    }
+
+    for (uint8_t& byte : dirty)
+    {
+        byte &= ~LOCAL_CHANGED;
+    }
+}
+
+void EntityStore::Propagate()
+{
+    if (hierarchy_changed)
+        BuildLevels();
+
+    if (!LocalChanges())
+        return;
+
+    for (size_t d = 0; d + 1 < levels.size(); d++)
+    {
+        PropagateRange(levels[d], levels[d + 1]);
+    }
+
+    for (uint8_t& byte : dirty)
+    {
+        byte &= ~LOCAL_CHANGED;
+    }
+}
+
+const std::vector<uint32_t>& EntityStore::Changes()
+{
+    Propagate();
+
+    changes.clear();
+
+    const size_t count = dirty.size();
+    const uint8_t* bytes = dirty.data();
+
+    size_t i = 0;
+
+    for (; i + 8 <= count; i += 8)
+    {
+        uint64_t word;
+        std::memcpy(&word, bytes + i, sizeof(word));
+
+        // Propagated bytes are 0 or WORLD_CHANGED, bit 1 marks the changes.
+        word = (word >> 1) & LOW_BITS;
+
+        while (word != 0)
+        {
+            const int bit = std::countr_zero(word);
+            word &= word - 1;
+
+            changes.push_back(static_cast<uint32_t>(i + bit / 8));
+        }
+    }
+
+    for (; i < count; i++)
+    {
+        if (bytes[i] != 0)
+            changes.push_back(static_cast<uint32_t>(i));
+    }
+
+    return changes;
+}
+
+void EntityStore::ClearChanges()
+{
+    for (const uint32_t index : Changes())
+    {
+        dirty[index] = 0;
+    }
+
+    changes.clear();
+}
@@ -1,18 +1,166 @@
 #pragma once
 
 #include <vector>
+#include <cstdint>
 
 #include "math/Math.hpp"
+#include "math/Transform.hpp"
+#include "cpu/Scheduler.hpp"
 
 struct Entity
 {
     glm::vec3 scale = glm::vec3(1, 1, 1);
     glm::vec3 position;
     glm::quat orientation;
+
+    // InstanceID seen by the hit shaders, the material of the entity.
     size_t instance_id = 0;
+
+    // Index of the bottom structure the entity instances.
+    uint32_t mesh = 0;
 };
 
-class EntityList : public std::vector<Entity>
+// Entities as parallel arrays with a dirty byte each. Position,
+// orientation and scale are relative to the entity's parent, or to the
+// world for roots. Setters mark the entity changed, Propagate recomputes
+// the world transforms of changed entities and their descendants and
+// marks those changed too, so consumers such as the instance upload only
+// revisit Changes() and then call ClearChanges(). Removed entities leave
+// their slot dead rather than shifting the ones after it, so indices held
+// elsewhere stay valid, and the next root added takes the slot back.
+// Setters on distinct entities may run concurrently, every other call is
+// single threaded.
+class EntityStore
 {
+public:
+    static constexpr uint32_t NO_PARENT = UINT32_MAX;
+
+private:
+    std::vector<glm::vec3> scales;
+    std::vector<glm::vec3> positions;
+    std::vector<glm::quat> orientations;
+    std::vector<uint32_t> instance_ids;
+    std::vector<uint32_t> meshes;
+    std::vector<uint32_t> parents;
+    std::vector<uint8_t> alive;
+
+    std::vector<Transform3x4> world;
+
+    // Dead slots, the most recently freed last.
+    std::vector<uint32_t> free_slots;
+
+    // LOCAL_CHANGED from the setters, WORLD_CHANGED once propagated.
+    static constexpr uint8_t LOCAL_CHANGED = 1;
+    static constexpr uint8_t WORLD_CHANGED = 2;
+
+    std::vector<uint8_t> dirty;
+    std::vector<uint32_t> changes;
+
+    // Entity indices breadth first, depth d in [levels[d], levels[d + 1]).
+    std::vector<uint32_t> order;
+    std::vector<uint32_t> levels;
+    bool hierarchy_changed = false;
+
+    void BuildLevels();
+
+    bool LocalChanges() const;
+
+    void PropagateRange(
+        const uint32_t first,
+        const uint32_t last);
+
+public:
+    EntityStore() = default;
+    EntityStore(const EntityStore&) = delete;
+
+    // Adds entity under parent, returning its index. Roots take the most
+    // recently freed slot when there is one, children are appended so
+    // parents still precede them. New entities start changed.
+    size_t Add(
+        const Entity& entity,
+        const uint32_t parent = NO_PARENT);
+
+    // Frees the slot of a live entity with no live children. It is marked
+    // changed so consumers see it go, and becomes a root whose fields
+    // stay readable until the slot is reused.
+    void Remove(const size_t index);
+
+    // Slots, live or dead.
+    size_t Size() const
+    {
+        return positions.size();
+    }
+
+    size_t LiveCount() const
+    {
+        return positions.size() - free_slots.size();
+    }
+
+    bool Alive(const size_t index) const
+    {
+        return alive[index] != 0;
+    }
+
+    Entity Get(const size_t index) const;
+
+    void Set(const size_t index, const Entity& entity);
+
+    // Moves index under parent, keeping its local transform. parent must
+    // be NO_PARENT or an entity added before index.
+    void SetParent(const size_t index, const uint32_t parent);
+
+    const glm::vec3& Scale(const size_t index) const { return scales[index]; }
+    const glm::vec3& Position(const size_t index) const { return positions[index]; }
+    const glm::quat& Orientation(const size_t index) const { return orientations[index]; }
+    uint32_t InstanceId(const size_t index) const { return instance_ids[index]; }
+    uint32_t Mesh(const size_t index) const { return meshes[index]; }
+    uint32_t Parent(const size_t index) const { return parents[index]; }
+
+    // Local to world as of the last Propagate.
+    const Transform3x4& World(const size_t index) const { return world[index]; }
+
+    void SetScale(const size_t index, const glm::vec3& scale)
+    {
+        scales[index] = scale;
+        dirty[index] = LOCAL_CHANGED;
+    }
+
+    void SetPosition(const size_t index, const glm::vec3& position)
+    {
+        positions[index] = position;
+        dirty[index] = LOCAL_CHANGED;
+    }
+
+    void SetOrientation(const size_t index, const glm::quat& orientation)
+    {
+        orientations[index] = orientation;
+        dirty[index] = LOCAL_CHANGED;
+    }
+
+    // Contiguous views of each field, Size() long.
+    const glm::vec3* Scales() const { return scales.data(); }
+    const glm::vec3* Positions() const { return positions.data(); }
+    const glm::quat* Orientations() const { return orientations.data(); }
+    const uint32_t* InstanceIds() const { return instance_ids.data(); }
+
+    bool Changed(const size_t index) const
+    {
+        return dirty[index] != 0;
+    }
+
+    // Recomputes world transforms one depth level at a time, each level in
+    // chunks on scheduler, visiting only changed entities and the subtrees
+    // below them. Returns at once when nothing changed.
+    void Propagate(cpu::Scheduler& scheduler);
+
+    // Propagate on the calling thread.
+    void Propagate();
+
+    // Indices of the entities whose world transform changed since the last
+    // ClearChanges, in ascending order, propagating first. Gathered from the
+    // dirty bytes a word at a time, so a mostly static store costs about a
+    // byte per entity to scan.
+    const std::vector<uint32_t>& Changes();
 
+    void ClearChanges();
 };
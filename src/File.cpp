@@ -3,7 +3,7 @@
 #include <iostream>
 #include <assert.h>
 
-#if defined(EMSCRIPTEN)
+#if defined(EMSCRIPTEN) || !defined(_WIN32)
 
 File::File(std::string path, std::string mode)
 {
@@ -0,0 +1,347 @@
+#include "Generator.hpp"
+
+#include <cmath>
+#include <cassert>
+#include <string>
+#include <algorithm>
+
+namespace Scenes
+{
+    // Units of floor each uniformly spread instance gets to itself.
+    static constexpr float INSTANCE_SPACING = 6.0f;
+
+    // Buildings per block side, their pitch and the street between blocks.
+    static constexpr uint32_t BLOCK_SIZE = 4;
+    static constexpr float BUILDING_PITCH = 3.0f;
+    static constexpr float STREET_WIDTH = 4.0f;
+
+    static constexpr float MIRROR_FRACTION = 0.05f;
+
+    // Bumps pushed out of each blob mesh.
+    static constexpr uint32_t BUMP_COUNT = 6;
+
+    // Independent random streams of an instance, a cluster or a mesh, all
+    // below 64.
+    enum Channel : uint64_t
+    {
+        CLUSTER,
+        POSITION_X,
+        POSITION_Z,
+        CLUSTER_X,
+        CLUSTER_Z,
+        SCALE,
+        HEIGHT,
+        YAW_W,
+        YAW_Y,
+        MESH,
+        MATERIAL,
+        ANIMATED,
+        GAUSSIAN,
+        BUMP = 16
+    };
+
+    static uint64_t splitmix(uint64_t x)
+    {
+        x += 0x9E3779B97F4A7C15ull;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+        return x ^ (x >> 31);
+    }
+
+    // Uniform in [0, 1) from the seed, an index and a channel, so every
+    // value is independent of how many others were drawn before it.
+    static float uniform(
+        const uint64_t seed,
+        const uint64_t index,
+        const uint64_t channel)
+    {
+        const uint64_t bits = splitmix(seed ^ splitmix(index * 64 + channel));
+        return static_cast<float>(bits >> 40) * (1.0f / 16777216.0f);
+    }
+
+    // Irwin-Hall approximation of a unit Gaussian, exact in IEEE arithmetic
+    // unlike Box-Muller's log and cos.
+    static float gaussian(
+        const uint64_t seed,
+        const uint64_t index,
+        const uint64_t channel)
+    {
+        float sum = 0.0f;
+        for (uint64_t k = 0; k < 4; k++)
+        {
+            sum += uniform(seed, index, channel * 4 + k);
+        }
+        return (sum - 2.0f) * 1.7320508f;
+    }
+
+    // 12 * k * k triangles on the faces of the [-1, 1] cube, pushed out to
+    // a bumpy sphere when blob is set.
+    static Meshes::Mesh generate_mesh(
+        const uint64_t seed,
+        const uint32_t index,
+        const uint32_t k,
+        const bool blob)
+    {
+        // Face normal, then u and v with u x v = normal.
+        static const glm::vec3 faces[6][3] =
+        {
+            { {  1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } },
+            { { -1, 0, 0 }, { 0, 0, 1 }, { 0, 1, 0 } },
+            { { 0,  1, 0 }, { 0, 0, 1 }, { 1, 0, 0 } },
+            { { 0, -1, 0 }, { 1, 0, 0 }, { 0, 0, 1 } },
+            { { 0, 0,  1 }, { 1, 0, 0 }, { 0, 1, 0 } },
+            { { 0, 0, -1 }, { 0, 1, 0 }, { 1, 0, 0 } }
+        };
+
+        glm::vec3 bumps[BUMP_COUNT];
+        float heights[BUMP_COUNT];
+
+        for (uint32_t b = 0; b < BUMP_COUNT; b++)
+        {
+            const glm::vec3 direction = glm::vec3(
+                uniform(seed, index, BUMP + b * 4 + 0),
+                uniform(seed, index, BUMP + b * 4 + 1),
+                uniform(seed, index, BUMP + b * 4 + 2)) * 2.0f - 1.0f;
+
+            bumps[b] = direction / std::max(glm::length(direction), 1e-6f);
+            heights[b] = 0.5f * uniform(seed, index, BUMP + b * 4 + 3);
+        }
+
+        Meshes::Mesh mesh;
+        mesh.name = (blob ? "blob " : "building ") + std::to_string(index);
+
+        const uint32_t side = k + 1;
+
+        for (const auto& face : faces)
+        {
+            const uint32_t base = static_cast<uint32_t>(mesh.vertices.size() / 3);
+
+            for (uint32_t j = 0; j <= k; j++)
+            {
+                for (uint32_t i = 0; i <= k; i++)
+                {
+                    glm::vec3 p = face[0] +
+                        face[1] * (2.0f * i / k - 1.0f) +
+                        face[2] * (2.0f * j / k - 1.0f);
+
+                    if (blob)
+                    {
+                        const glm::vec3 direction = p / glm::length(p);
+                        float radius = 1.0f;
+
+                        for (uint32_t b = 0; b < BUMP_COUNT; b++)
+                        {
+                            const float d = std::max(glm::dot(direction, bumps[b]) - 0.6f, 0.0f) * 2.5f;
+                            radius += heights[b] * d * d;
+                        }
+
+                        p = direction * radius;
+                    }
+
+                    mesh.vertices.insert(mesh.vertices.end(), { p.x, p.y, p.z });
+                }
+            }
+
+            for (uint32_t j = 0; j < k; j++)
+            {
+                for (uint32_t i = 0; i < k; i++)
+                {
+                    const uint32_t a = base + j * side + i;
+                    mesh.indices.insert(mesh.indices.end(), { a, a + 1, a + side + 1, a, a + side + 1, a + side });
+                }
+            }
+        }
+
+        return mesh;
+    }
+
+    GeneratedScene generate(
+        const GeneratorOptions& options)
+    {
+        const uint64_t seed = splitmix(options.seed);
+        const bool city = options.distribution == Distribution::CityGrid;
+
+        GeneratedScene scene;
+
+        const uint32_t k = std::max(static_cast<uint32_t>(
+            std::lround(std::sqrt(options.triangles_per_mesh / 12.0))), 1u);
+
+        const uint32_t mesh_count = std::max(options.meshes, 1u);
+
+        for (uint32_t m = 0; m < mesh_count; m++)
+        {
+            scene.meshes.push_back(generate_mesh(seed, m, k, !city));
+        }
+
+        const uint32_t count = options.instances;
+        const float side = std::sqrt(static_cast<float>(count)) * INSTANCE_SPACING;
+
+        const uint32_t columns = static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<float>(count))));
+        const float block = BLOCK_SIZE * BUILDING_PITCH + STREET_WIDTH;
+        const float city_side = columns / BLOCK_SIZE * block + columns % BLOCK_SIZE * BUILDING_PITCH;
+
+        const uint32_t clusters = std::max((count + CLUSTER_SIZE - 1) / CLUSTER_SIZE, 1u);
+        const float cluster_sigma = std::sqrt(static_cast<float>(CLUSTER_SIZE)) * 1.5f;
+
+        scene.entities.resize(count);
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            Entity& entity = scene.entities[i];
+
+            entity.mesh = std::min(static_cast<uint32_t>(uniform(seed, i, MESH) * mesh_count), mesh_count - 1);
+            entity.instance_id = uniform(seed, i, MATERIAL) < MIRROR_FRACTION ?
+                MIRROR_MATERIAL : DIFFUSE_MATERIAL;
+
+            switch (options.distribution)
+            {
+            case Distribution::Uniform:
+            {
+                entity.position.x = (uniform(seed, i, POSITION_X) - 0.5f) * side;
+                entity.position.z = (uniform(seed, i, POSITION_Z) - 0.5f) * side;
+                break;
+            }
+            case Distribution::Clustered:
+            {
+                const uint32_t cluster = std::min(static_cast<uint32_t>(uniform(seed, i, CLUSTER) * clusters), clusters - 1);
+
+                entity.position.x = (uniform(seed, cluster, CLUSTER_X) - 0.5f) * side + gaussian(seed, i, GAUSSIAN) * cluster_sigma;
+                entity.position.z = (uniform(seed, cluster, CLUSTER_Z) - 0.5f) * side + gaussian(seed, i, GAUSSIAN + 1) * cluster_sigma;
+                break;
+            }
+            case Distribution::CityGrid:
+            {
+                const uint32_t x = i % columns;
+                const uint32_t z = i / columns;
+
+                entity.position.x = x / BLOCK_SIZE * block + x % BLOCK_SIZE * BUILDING_PITCH - 0.5f * city_side;
+                entity.position.z = z / BLOCK_SIZE * block + z % BLOCK_SIZE * BUILDING_PITCH - 0.5f * city_side;
+                break;
+            }
+            }
+
+            if (city)
+            {
+                // Mostly low rise with the odd tower.
+                const float h = uniform(seed, i, HEIGHT);
+                entity.scale = glm::vec3(1.0f, 1.0f + 9.0f * h * h * h, 1.0f);
+            }
+            else
+            {
+                entity.scale = glm::vec3(0.5f + uniform(seed, i, SCALE));
+
+                // A random turn about y, normalised with a square root only.
+                const glm::quat yaw(
+                    uniform(seed, i, YAW_W) * 2.0f - 1.0f + 1e-6f, 0.0f,
+                    uniform(seed, i, YAW_Y) * 2.0f - 1.0f, 0.0f);
+                entity.orientation = yaw / std::sqrt(yaw.w * yaw.w + yaw.y * yaw.y);
+            }
+
+            entity.position.y = entity.scale.y;
+
+            if (uniform(seed, i, ANIMATED) < options.animated_fraction)
+                scene.animated.push_back(i);
+        }
+
+        return scene;
+    }
+
+    uint32_t GeneratedScene::Instantiate(EntityStore& store) const
+    {
+        assert(store.LiveCount() == store.Size());
+
+        const uint32_t first = static_cast<uint32_t>(store.Size());
+
+        for (const Entity& entity : entities)
+        {
+            store.Add(entity);
+        }
+
+        return first;
+    }
+
+    SceneBuilder GeneratedScene::Builder() const
+    {
+        SceneBuilder scene = floor_scene();
+
+        const uint32_t first_mesh = static_cast<uint32_t>(scene.MeshCount());
+
+        for (const Meshes::Mesh& mesh : meshes)
+        {
+            scene.AddMesh(mesh, DIFFUSE_MATERIAL);
+        }
+
+        for (Entity entity : entities)
+        {
+            entity.mesh += first_mesh;
+            scene.AddInstance(entity);
+        }
+
+        return scene;
+    }
+
+    uint64_t GeneratedScene::Hash() const
+    {
+        uint64_t hash = 0xCBF29CE484222325ull;
+
+        auto add = [&](const void* data, const size_t size)
+        {
+            const uint8_t* bytes = static_cast<const uint8_t*>(data);
+            for (size_t i = 0; i < size; i++)
+            {
+                hash = (hash ^ bytes[i]) * 0x100000001B3ull;
+            }
+        };
+
+        for (const Meshes::Mesh& mesh : meshes)
+        {
+            add(mesh.vertices.data(), mesh.vertices.size() * sizeof(float));
+            add(mesh.indices.data(), mesh.indices.size() * sizeof(uint32_t));
+        }
+
+        for (const Entity& entity : entities)
+        {
+            const uint32_t ids[2] = { static_cast<uint32_t>(entity.instance_id), entity.mesh };
+
+            add(&entity.position, sizeof(entity.position));
+            add(&entity.orientation, sizeof(entity.orientation));
+            add(&entity.scale, sizeof(entity.scale));
+            add(ids, sizeof(ids));
+        }
+
+        add(animated.data(), animated.size() * sizeof(uint32_t));
+        return hash;
+    }
+
+    void animate(
+        const GeneratedScene& scene,
+        EntityStore& store,
+        const uint32_t first,
+        const float time)
+    {
+        for (const uint32_t i : scene.animated)
+        {
+            const Entity& entity = scene.entities[i];
+
+            // One of four rates, by index.
+            const float rate = 0.5f + 0.25f * (i % 4);
+            const float angle = time * rate;
+
+            store.SetPosition(first + i, entity.position + glm::vec3(0.0f, 0.25f * std::sin(angle), 0.0f));
+            store.SetOrientation(first + i, glm::angleAxis(angle, glm::vec3(0, 1, 0)) * entity.orientation);
+        }
+    }
+
+    const char* distribution_name(
+        const Distribution distribution)
+    {
+        switch (distribution)
+        {
+        case Distribution::Uniform: return "uniform";
+        case Distribution::Clustered: return "clustered";
+        case Distribution::CityGrid: return "city";
+        }
+
+        return "unknown";
+    }
+}
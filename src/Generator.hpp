@@ -0,0 +1,80 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include "Meshes.hpp"
+#include "Entities.hpp"
+#include "SceneFile.hpp"
+
+namespace Scenes
+{
+    enum class Distribution
+    {
+        // Spread evenly over a square.
+        Uniform,
+        // Gaussian clumps of about CLUSTER_SIZE instances.
+        Clustered,
+        // Blocks of buildings between streets, axis aligned.
+        CityGrid
+    };
+
+    constexpr uint32_t CLUSTER_SIZE = 1000;
+
+    struct GeneratorOptions
+    {
+        uint64_t seed = 1;
+        uint32_t instances = 1000;
+        uint32_t meshes = 8;
+
+        // Rounded to the nearest 12 * k * k, the subdivided cube every
+        // mesh starts from.
+        uint32_t triangles_per_mesh = 768;
+
+        Distribution distribution = Distribution::Uniform;
+
+        // Fraction of instances listed in GeneratedScene::animated.
+        float animated_fraction = 0.1f;
+    };
+
+    // Meshes and root entities the renderers and the acceleration
+    // structures take directly, or through Builder as a scene file.
+    struct GeneratedScene
+    {
+        std::vector<Meshes::Mesh> meshes;
+        std::vector<Entity> entities;
+
+        // Indices into entities, ascending.
+        std::vector<uint32_t> animated;
+
+        // Appends entities to store, returning the index of the first. The
+        // store must have no free slots, so the indices are consecutive.
+        uint32_t Instantiate(EntityStore& store) const;
+
+        // floor_scene with the meshes and entities after it, so entity i
+        // becomes instance i + 1 and mesh m becomes mesh m + 1.
+        SceneBuilder Builder() const;
+
+        // FNV-1a over every mesh and entity, the same for the same options
+        // on every platform and standard library. That holds only while
+        // Generator.cpp is built without FMA contraction.
+        uint64_t Hash() const;
+    };
+
+    // A pure function of options. Randomness comes from a counter based
+    // generator rather than <random>, whose distributions differ between
+    // standard libraries, so workloads reproduce anywhere.
+    GeneratedScene generate(
+        const GeneratorOptions& options);
+
+    // Spins and bobs the animated entities, offset by first, to their pose
+    // at time seconds.
+    void animate(
+        const GeneratedScene& scene,
+        EntityStore& store,
+        const uint32_t first,
+        const float time);
+
+    const char* distribution_name(
+        const Distribution distribution);
+}
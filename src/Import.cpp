@@ -0,0 +1,1180 @@
+#include "Import.hpp"
+
+#include "Timing.hpp"
+#include "MappedFile.hpp"
+
+#include <bit>
+#include <cctype>
+#include <memory>
+#include <iterator>
+#include <cstring>
+#include <charconv>
+#include <iostream>
+#include <algorithm>
+#include <filesystem>
+
+namespace Import
+{
+    // Bytes of OBJ text per parse job, the last line of each running over.
+    static constexpr size_t CHUNK_SIZE = 1 << 20;
+
+    static constexpr uint32_t EMPTY_SLOT = UINT32_MAX;
+
+    static constexpr int MAX_JSON_DEPTH = 64;
+
+    // Appends corner_count corners to mesh, corner k reading position
+    // index(k) of source_count, keeping one vertex per distinct bit
+    // pattern in an open addressed table at most half full. -0 is stored
+    // as 0 so the two merge. False when an index is out of range.
+    template<typename Position, typename Index>
+    static bool deduplicate(
+        const size_t corner_count,
+        const size_t source_count,
+        const Position& position,
+        const Index& index,
+        Mesh& mesh)
+    {
+        const size_t most = std::min(corner_count, source_count);
+
+        int table_bits = 4;
+        while ((size_t(1) << table_bits) < 2 * most)
+            table_bits++;
+
+        std::vector<uint32_t> table(size_t(1) << table_bits, EMPTY_SLOT);
+        const size_t mask = table.size() - 1;
+
+        mesh.vertices.reserve(most * 3);
+        mesh.indices.resize(corner_count);
+
+        for (size_t k = 0; k < corner_count; k++)
+        {
+            const uint32_t source = index(k);
+
+            if (source >= source_count)
+                return false;
+
+            float p[3];
+            position(source, p);
+
+            uint32_t bits[3];
+            for (int a = 0; a < 3; a++)
+            {
+                p[a] += 0.0f;
+                bits[a] = std::bit_cast<uint32_t>(p[a]);
+            }
+
+            // Multiplying carries every bit upwards, so the table is
+            // indexed by the top bits.
+            uint64_t hash = bits[0] * 0x9E3779B97F4A7C15ull;
+            hash = (hash ^ bits[1]) * 0xC2B2AE3D27D4EB4Full;
+            hash = (hash ^ bits[2]) * 0x165667B19E3779F9ull;
+
+            size_t slot = static_cast<size_t>(hash >> (64 - table_bits));
+
+            for (;;)
+            {
+                uint32_t& entry = table[slot];
+
+                if (entry == EMPTY_SLOT)
+                {
+                    entry = static_cast<uint32_t>(mesh.vertices.size() / 3);
+                    mesh.vertices.insert(mesh.vertices.end(), p, p + 3);
+                    break;
+                }
+
+                if (std::memcmp(&mesh.vertices[entry * size_t(3)], p, sizeof(p)) == 0)
+                    break;
+
+                slot = (slot + 1) & mask;
+            }
+
+            mesh.indices[k] = table[slot];
+        }
+
+        return true;
+    }
+
+    static const char* skip_space(
+        const char* p,
+        const char* end)
+    {
+        while (p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
+            p++;
+        return p;
+    }
+
+    static const char* skip_token(
+        const char* p,
+        const char* end)
+    {
+        while (p < end && *p != ' ' && *p != '\t' && *p != '\r')
+            p++;
+        return p;
+    }
+
+    // True when the line at p starts with keyword followed by a space or
+    // the end of the line.
+    static bool keyword(
+        const char* p,
+        const char* end,
+        const char* word)
+    {
+        const size_t length = std::strlen(word);
+
+        return static_cast<size_t>(end - p) >= length &&
+            std::memcmp(p, word, length) == 0 &&
+            (p + length == end || p[length] == ' ' || p[length] == '\t' || p[length] == '\r');
+    }
+
+    static bool parse_float(
+        const char*& p,
+        const char* end,
+        float& value)
+    {
+        p = skip_space(p, end);
+
+        // from_chars takes no leading plus.
+        if (p < end && *p == '+')
+            p++;
+
+        const auto result = std::from_chars(p, end, value);
+        if (result.ec != std::errc())
+            return false;
+
+        p = result.ptr;
+        return true;
+    }
+
+    // An OBJ byte range parsed on its own. Negative face indices count back
+    // from the vertices seen so far, which before the chunks are joined are
+    // known only relative to the chunk, so those corners are listed in
+    // relative to be offset by the vertices of the earlier chunks.
+    struct ObjChunk
+    {
+        std::vector<float> positions;
+        std::vector<int64_t> corners;
+        std::vector<size_t> relative;
+
+        // First triangle and name of each o or g line.
+        std::vector<std::pair<size_t, std::string>> objects;
+
+        std::vector<int64_t> polygon;
+        std::vector<bool> polygon_relative;
+
+        bool valid = true;
+    };
+
+    static bool parse_obj_line(
+        const char* p,
+        const char* end,
+        ObjChunk& chunk)
+    {
+        p = skip_space(p, end);
+
+        if (keyword(p, end, "v"))
+        {
+            p++;
+
+            float position[3];
+            for (int a = 0; a < 3; a++)
+            {
+                if (!parse_float(p, end, position[a]))
+                    return false;
+            }
+
+            chunk.positions.insert(chunk.positions.end(), position, position + 3);
+        }
+        else if (keyword(p, end, "f"))
+        {
+            p++;
+
+            const int64_t local_count = static_cast<int64_t>(chunk.positions.size() / 3);
+
+            chunk.polygon.clear();
+            chunk.polygon_relative.clear();
+
+            for (p = skip_space(p, end); p < end; p = skip_space(p, end))
+            {
+                // v, v/vt, v//vn or v/vt/vn, only v is kept.
+                int64_t index = 0;
+                const auto result = std::from_chars(p, end, index);
+
+                if (result.ec != std::errc() || index == 0)
+                    return false;
+
+                chunk.polygon.push_back(index > 0 ? index - 1 : local_count + index);
+                chunk.polygon_relative.push_back(index < 0);
+
+                p = skip_token(result.ptr, end);
+            }
+
+            if (chunk.polygon.size() < 3)
+                return false;
+
+            for (size_t i = 2; i < chunk.polygon.size(); i++)
+            {
+                for (const size_t c : { size_t(0), i - 1, i })
+                {
+                    if (chunk.polygon_relative[c])
+                        chunk.relative.push_back(chunk.corners.size());
+
+                    chunk.corners.push_back(chunk.polygon[c]);
+                }
+            }
+        }
+        else if (keyword(p, end, "o") || keyword(p, end, "g"))
+        {
+            const char* name = skip_space(p + 1, end);
+            const char* name_end = end;
+
+            while (name_end > name && (name_end[-1] == ' ' || name_end[-1] == '\t' || name_end[-1] == '\r'))
+                name_end--;
+
+            chunk.objects.emplace_back(chunk.corners.size() / 3, std::string(name, name_end));
+        }
+
+        // Comments, texture coordinates, normals, materials and smoothing
+        // groups carry nothing the renderers use.
+        return true;
+    }
+
+    static void parse_obj_chunk(
+        const char* p,
+        const char* end,
+        ObjChunk& chunk)
+    {
+        while (p < end)
+        {
+            const char* line_end = static_cast<const char*>(std::memchr(p, '\n', end - p));
+            if (!line_end)
+                line_end = end;
+
+            if (!parse_obj_line(p, line_end, chunk))
+            {
+                chunk.valid = false;
+                return;
+            }
+
+            p = line_end + 1;
+        }
+    }
+
+    static bool import_obj(
+        const std::string& path,
+        cpu::Scheduler& scheduler,
+        std::vector<Mesh>& meshes,
+        Stats& stats)
+    {
+        auto parse_start = timer_start();
+
+        const MappedFile file(path);
+        const char* text = static_cast<const char*>(file.Data());
+        const size_t length = file.Length();
+
+        // Chunk boundaries just past a line end, so no line is split.
+        std::vector<size_t> bounds = { 0 };
+
+        for (size_t at = CHUNK_SIZE; at < length; at += CHUNK_SIZE)
+        {
+            const void* line_end = std::memchr(text + at, '\n', length - at);
+            if (!line_end)
+                break;
+
+            const size_t next = static_cast<const char*>(line_end) - text + 1;
+            if (next > bounds.back() && next < length)
+                bounds.push_back(next);
+
+            at = std::max(at, next);
+        }
+
+        bounds.push_back(length);
+
+        const uint32_t chunk_count = static_cast<uint32_t>(bounds.size() - 1);
+        std::vector<ObjChunk> chunks(chunk_count);
+
+        scheduler.ParallelFor(chunk_count, [&](const uint32_t c)
+        {
+            parse_obj_chunk(text + bounds[c], text + bounds[c + 1], chunks[c]);
+        });
+
+        std::vector<size_t> vertex_base(chunk_count + 1, 0);
+        std::vector<size_t> corner_base(chunk_count + 1, 0);
+
+        for (uint32_t c = 0; c < chunk_count; c++)
+        {
+            if (!chunks[c].valid)
+                return false;
+
+            vertex_base[c + 1] = vertex_base[c] + chunks[c].positions.size() / 3;
+            corner_base[c + 1] = corner_base[c] + chunks[c].corners.size();
+        }
+
+        const size_t vertex_count = vertex_base[chunk_count];
+
+        if (vertex_count > UINT32_MAX)
+            return false;
+
+        std::vector<float> positions(vertex_count * 3);
+        std::vector<uint32_t> corners(corner_base[chunk_count]);
+
+        scheduler.ParallelFor(chunk_count, [&](const uint32_t c)
+        {
+            ObjChunk& chunk = chunks[c];
+
+            for (const size_t r : chunk.relative)
+            {
+                chunk.corners[r] += vertex_base[c];
+            }
+
+            std::copy(chunk.positions.begin(), chunk.positions.end(), positions.begin() + vertex_base[c] * 3);
+
+            for (size_t k = 0; k < chunk.corners.size(); k++)
+            {
+                const int64_t corner = chunk.corners[k];
+
+                if (corner < 0 || corner >= static_cast<int64_t>(vertex_count))
+                {
+                    chunk.valid = false;
+                    return;
+                }
+
+                corners[corner_base[c] + k] = static_cast<uint32_t>(corner);
+            }
+
+            chunk.positions = std::vector<float>();
+            chunk.corners = std::vector<int64_t>();
+        });
+
+        // Triangle ranges of the meshes, in file order.
+        std::vector<std::pair<size_t, std::string>> objects = { { 0, std::string() } };
+
+        for (uint32_t c = 0; c < chunk_count; c++)
+        {
+            if (!chunks[c].valid)
+                return false;
+
+            for (auto& object : chunks[c].objects)
+            {
+                objects.emplace_back(corner_base[c] / 3 + object.first, std::move(object.second));
+            }
+        }
+
+        const size_t triangle_count = corners.size() / 3;
+        objects.emplace_back(triangle_count, std::string());
+
+        stats.parse_time = timer_end(parse_start);
+        stats.bytes = length;
+        stats.corners = corners.size();
+        stats.triangles = triangle_count;
+
+        auto deduplicate_start = timer_start();
+
+        std::vector<size_t> ranges;
+        for (size_t o = 0; o + 1 < objects.size(); o++)
+        {
+            if (objects[o + 1].first > objects[o].first)
+                ranges.push_back(o);
+        }
+
+        std::vector<Mesh> imported(ranges.size());
+        std::vector<uint8_t> valid(ranges.size(), 1);
+
+        scheduler.ParallelFor(static_cast<uint32_t>(ranges.size()), [&](const uint32_t m)
+        {
+            const size_t first = objects[ranges[m]].first * 3;
+            const size_t count = objects[ranges[m] + 1].first * 3 - first;
+
+            imported[m].name = objects[ranges[m]].second;
+
+            valid[m] = deduplicate(
+                count,
+                vertex_count,
+                [&](const uint32_t v, float* p) { std::memcpy(p, &positions[v * size_t(3)], sizeof(float) * 3); },
+                [&](const size_t k) { return corners[first + k]; },
+                imported[m]);
+        });
+
+        stats.deduplicate_time = timer_end(deduplicate_start);
+
+        if (std::find(valid.begin(), valid.end(), 0) != valid.end())
+            return false;
+
+        for (Mesh& mesh : imported)
+        {
+            stats.vertices += mesh.vertices.size() / 3;
+            meshes.push_back(std::move(mesh));
+        }
+
+        return true;
+    }
+
+    // Just enough JSON for the glTF document, numbers as doubles and
+    // strings with escapes outside ASCII replaced.
+    struct Json
+    {
+        enum class Type
+        {
+            Null,
+            Bool,
+            Number,
+            String,
+            Array,
+            Object
+        };
+
+        Type type = Type::Null;
+        bool boolean = false;
+        double number = 0.0;
+        std::string string;
+        std::vector<Json> items;
+        std::vector<std::pair<std::string, Json>> members;
+
+        const Json* Find(const char* key) const
+        {
+            for (const auto& member : members)
+            {
+                if (member.first == key)
+                    return &member.second;
+            }
+            return nullptr;
+        }
+
+        const Json* At(const size_t index) const
+        {
+            return type == Type::Array && index < items.size() ? &items[index] : nullptr;
+        }
+
+        // The non-negative integer member key, or fallback when absent.
+        // False when present but not such an integer.
+        bool Integer(const char* key, size_t& value, const size_t fallback) const
+        {
+            const Json* member = Find(key);
+
+            if (!member)
+            {
+                value = fallback;
+                return true;
+            }
+
+            if (member->type != Type::Number ||
+                member->number < 0.0 ||
+                member->number > 9007199254740992.0 ||
+                member->number != static_cast<double>(static_cast<uint64_t>(member->number)))
+                return false;
+
+            value = static_cast<size_t>(member->number);
+            return true;
+        }
+    };
+
+    class JsonParser
+    {
+    private:
+        const char* p;
+        const char* end;
+
+        void Skip()
+        {
+            while (p < end && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n'))
+                p++;
+        }
+
+        bool Literal(const char* word)
+        {
+            const size_t length = std::strlen(word);
+
+            if (static_cast<size_t>(end - p) < length || std::memcmp(p, word, length) != 0)
+                return false;
+
+            p += length;
+            return true;
+        }
+
+        bool String(std::string& value)
+        {
+            if (p >= end || *p != '"')
+                return false;
+
+            p++;
+
+            while (p < end && *p != '"')
+            {
+                if (*p != '\\')
+                {
+                    value.push_back(*p++);
+                    continue;
+                }
+
+                if (++p >= end)
+                    return false;
+
+                switch (*p++)
+                {
+                case '"': value.push_back('"'); break;
+                case '\\': value.push_back('\\'); break;
+                case '/': value.push_back('/'); break;
+                case 'b': value.push_back('\b'); break;
+                case 'f': value.push_back('\f'); break;
+                case 'n': value.push_back('\n'); break;
+                case 'r': value.push_back('\r'); break;
+                case 't': value.push_back('\t'); break;
+                case 'u':
+                {
+                    uint32_t code = 0;
+                    const auto result = std::from_chars(p, std::min(p + 4, end), code, 16);
+
+                    if (result.ec != std::errc() || result.ptr != p + 4)
+                        return false;
+
+                    value.push_back(code < 0x80 ? static_cast<char>(code) : '?');
+                    p += 4;
+                    break;
+                }
+                default:
+                    return false;
+                }
+            }
+
+            if (p >= end)
+                return false;
+
+            p++;
+            return true;
+        }
+
+        bool Value(Json& value, const int depth)
+        {
+            if (depth > MAX_JSON_DEPTH)
+                return false;
+
+            Skip();
+
+            if (p >= end)
+                return false;
+
+            switch (*p)
+            {
+            case '{':
+            {
+                value.type = Json::Type::Object;
+                p++;
+                Skip();
+
+                if (p < end && *p == '}')
+                {
+                    p++;
+                    return true;
+                }
+
+                for (;;)
+                {
+                    Skip();
+
+                    std::pair<std::string, Json> member;
+                    if (!String(member.first))
+                        return false;
+
+                    Skip();
+                    if (p >= end || *p++ != ':')
+                        return false;
+
+                    if (!Value(member.second, depth + 1))
+                        return false;
+
+                    value.members.push_back(std::move(member));
+
+                    Skip();
+                    if (p >= end)
+                        return false;
+
+                    if (*p == '}')
+                    {
+                        p++;
+                        return true;
+                    }
+
+                    if (*p++ != ',')
+                        return false;
+                }
+            }
+            case '[':
+            {
+                value.type = Json::Type::Array;
+                p++;
+                Skip();
+
+                if (p < end && *p == ']')
+                {
+                    p++;
+                    return true;
+                }
+
+                for (;;)
+                {
+                    value.items.emplace_back();
+                    if (!Value(value.items.back(), depth + 1))
+                        return false;
+
+                    Skip();
+                    if (p >= end)
+                        return false;
+
+                    if (*p == ']')
+                    {
+                        p++;
+                        return true;
+                    }
+
+                    if (*p++ != ',')
+                        return false;
+                }
+            }
+            case '"':
+                value.type = Json::Type::String;
+                return String(value.string);
+            case 't':
+                value.type = Json::Type::Bool;
+                value.boolean = true;
+                return Literal("true");
+            case 'f':
+                value.type = Json::Type::Bool;
+                return Literal("false");
+            case 'n':
+                return Literal("null");
+            default:
+            {
+                value.type = Json::Type::Number;
+                const auto result = std::from_chars(p, end, value.number);
+
+                if (result.ec != std::errc())
+                    return false;
+
+                p = result.ptr;
+                return true;
+            }
+            }
+        }
+
+    public:
+        JsonParser(const char* begin, const char* end) :
+            p(begin),
+            end(end)
+        {
+        }
+
+        bool Parse(Json& value)
+        {
+            if (!Value(value, 0))
+                return false;
+
+            Skip();
+            return p == end;
+        }
+    };
+
+    static constexpr uint32_t GLB_MAGIC = 0x46546C67;
+    static constexpr uint32_t GLB_JSON = 0x4E4F534A;
+    static constexpr uint32_t GLB_BIN = 0x004E4942;
+
+    static constexpr size_t GL_UNSIGNED_BYTE = 5121;
+    static constexpr size_t GL_UNSIGNED_SHORT = 5123;
+    static constexpr size_t GL_UNSIGNED_INT = 5125;
+    static constexpr size_t GL_FLOAT = 5126;
+    static constexpr size_t GL_TRIANGLES = 4;
+
+    struct Buffer
+    {
+        const uint8_t* data = nullptr;
+        size_t length = 0;
+    };
+
+    // count elements of size bytes, stride apart.
+    struct Accessor
+    {
+        const uint8_t* data = nullptr;
+        size_t count = 0;
+        size_t stride = 0;
+        size_t component_type = 0;
+    };
+
+    // Resolves accessor index of document, checking every element lies in
+    // its buffer view and the view in its buffer.
+    static bool resolve_accessor(
+        const Json& document,
+        const std::vector<Buffer>& buffers,
+        const size_t index,
+        const char* type,
+        Accessor& accessor)
+    {
+        const Json* accessors = document.Find("accessors");
+        const Json* json = accessors ? accessors->At(index) : nullptr;
+
+        if (!json || json->Find("sparse"))
+            return false;
+
+        const Json* json_type = json->Find("type");
+        if (!json_type || json_type->string != type)
+            return false;
+
+        size_t view_index, offset, component_type;
+        if (!json->Integer("bufferView", view_index, SIZE_MAX) || view_index == SIZE_MAX ||
+            !json->Integer("byteOffset", offset, 0) ||
+            !json->Integer("componentType", component_type, 0) ||
+            !json->Integer("count", accessor.count, 0))
+            return false;
+
+        size_t component_size;
+        switch (component_type)
+        {
+        case GL_UNSIGNED_BYTE: component_size = 1; break;
+        case GL_UNSIGNED_SHORT: component_size = 2; break;
+        case GL_UNSIGNED_INT:
+        case GL_FLOAT: component_size = 4; break;
+        default: return false;
+        }
+
+        const size_t element_size = component_size * (std::strcmp(type, "VEC3") == 0 ? 3 : 1);
+
+        const Json* views = document.Find("bufferViews");
+        const Json* view = views ? views->At(view_index) : nullptr;
+
+        size_t buffer_index, view_offset, view_length, stride;
+        if (!view ||
+            !view->Integer("buffer", buffer_index, 0) ||
+            !view->Integer("byteOffset", view_offset, 0) ||
+            !view->Integer("byteLength", view_length, 0) ||
+            !view->Integer("byteStride", stride, element_size) ||
+            buffer_index >= buffers.size() ||
+            stride < element_size)
+            return false;
+
+        const Buffer& buffer = buffers[buffer_index];
+
+        if (view_offset > buffer.length || view_length > buffer.length - view_offset)
+            return false;
+
+        // offset + (count - 1) * stride + element_size <= view_length.
+        if (accessor.count > 0 &&
+            (offset > view_length ||
+             element_size > view_length - offset ||
+             accessor.count - 1 > (view_length - offset - element_size) / stride))
+            return false;
+
+        accessor.data = buffer.data + view_offset + offset;
+        accessor.stride = stride;
+        accessor.component_type = component_type;
+        return true;
+    }
+
+    static bool import_gltf(
+        const std::string& path,
+        cpu::Scheduler& scheduler,
+        std::vector<Mesh>& meshes,
+        Stats& stats)
+    {
+        auto parse_start = timer_start();
+
+        const MappedFile file(path);
+        const uint8_t* data = static_cast<const uint8_t*>(file.Data());
+        const size_t length = file.Length();
+
+        const char* json_begin = reinterpret_cast<const char*>(data);
+        const char* json_end = json_begin + length;
+
+        std::vector<Buffer> buffers;
+        std::vector<std::unique_ptr<MappedFile>> buffer_files;
+        Buffer binary;
+
+        uint32_t magic = 0;
+        if (length >= sizeof(magic))
+            std::memcpy(&magic, data, sizeof(magic));
+
+        if (magic == GLB_MAGIC)
+        {
+            // Header of magic, version and length, then chunks of length,
+            // type and data, the JSON first and an optional binary buffer.
+            uint32_t header[3];
+            uint32_t chunk[2];
+
+            if (length < sizeof(header) + sizeof(chunk))
+                return false;
+
+            std::memcpy(header, data, sizeof(header));
+            std::memcpy(chunk, data + sizeof(header), sizeof(chunk));
+
+            size_t at = sizeof(header) + sizeof(chunk);
+
+            // The declared length must cover the first chunk header before
+            // it bounds anything, or the subtractions below wrap.
+            if (header[1] != 2 || header[2] > length || header[2] < at ||
+                chunk[1] != GLB_JSON || chunk[0] > header[2] - at)
+                return false;
+
+            json_begin = reinterpret_cast<const char*>(data + at);
+            json_end = json_begin + chunk[0];
+            at += chunk[0];
+
+            if (header[2] - at >= sizeof(chunk))
+            {
+                std::memcpy(chunk, data + at, sizeof(chunk));
+                at += sizeof(chunk);
+
+                if (chunk[1] == GLB_BIN && chunk[0] <= header[2] - at)
+                {
+                    binary.data = data + at;
+                    binary.length = chunk[0];
+                }
+            }
+        }
+
+        Json document;
+        if (!JsonParser(json_begin, json_end).Parse(document))
+            return false;
+
+        const Json* json_buffers = document.Find("buffers");
+
+        for (size_t b = 0; json_buffers && b < json_buffers->items.size(); b++)
+        {
+            const Json& json = json_buffers->items[b];
+            const Json* uri = json.Find("uri");
+
+            size_t byte_length;
+            if (!json.Integer("byteLength", byte_length, 0))
+                return false;
+
+            Buffer buffer;
+
+            if (!uri)
+            {
+                // Only the first buffer of a .glb may have no uri.
+                if (b != 0 || !binary.data)
+                    return false;
+
+                buffer = binary;
+            }
+            else
+            {
+                if (uri->string.rfind("data:", 0) == 0)
+                    return false;
+
+                const std::filesystem::path buffer_path =
+                    std::filesystem::path(path).parent_path() / uri->string;
+
+                buffer_files.push_back(std::make_unique<MappedFile>(buffer_path.string()));
+                buffer.data = static_cast<const uint8_t*>(buffer_files.back()->Data());
+                buffer.length = buffer_files.back()->Length();
+            }
+
+            if (byte_length > buffer.length)
+                return false;
+
+            buffer.length = byte_length;
+            buffers.push_back(buffer);
+        }
+
+        struct Primitive
+        {
+            std::string name;
+            Accessor positions;
+            Accessor indices;
+            bool indexed = false;
+        };
+
+        std::vector<Primitive> primitives;
+        const Json* json_meshes = document.Find("meshes");
+
+        for (size_t m = 0; json_meshes && m < json_meshes->items.size(); m++)
+        {
+            const Json& json_mesh = json_meshes->items[m];
+            const Json* name = json_mesh.Find("name");
+            const Json* json_primitives = json_mesh.Find("primitives");
+
+            for (size_t p = 0; json_primitives && p < json_primitives->items.size(); p++)
+            {
+                const Json& json = json_primitives->items[p];
+                const Json* attributes = json.Find("attributes");
+
+                size_t mode, position, indices;
+                if (!attributes ||
+                    !json.Integer("mode", mode, GL_TRIANGLES) ||
+                    !attributes->Integer("POSITION", position, SIZE_MAX) ||
+                    !json.Integer("indices", indices, SIZE_MAX))
+                    return false;
+
+                if (mode != GL_TRIANGLES || position == SIZE_MAX)
+                    continue;
+
+                Primitive primitive;
+                primitive.name = name ? name->string : std::string();
+
+                if (json_primitives->items.size() > 1)
+                    primitive.name += "." + std::to_string(p);
+
+                if (!resolve_accessor(document, buffers, position, "VEC3", primitive.positions) ||
+                    primitive.positions.component_type != GL_FLOAT ||
+                    primitive.positions.count > UINT32_MAX)
+                    return false;
+
+                if (indices != SIZE_MAX)
+                {
+                    if (!resolve_accessor(document, buffers, indices, "SCALAR", primitive.indices) ||
+                        primitive.indices.component_type == GL_FLOAT)
+                        return false;
+
+                    primitive.indexed = true;
+                }
+
+                const size_t corners = primitive.indexed ?
+                    primitive.indices.count : primitive.positions.count;
+
+                stats.corners += corners - corners % 3;
+                stats.triangles += corners / 3;
+
+                primitives.push_back(std::move(primitive));
+            }
+        }
+
+        stats.parse_time = timer_end(parse_start);
+        stats.bytes = length;
+
+        for (const Buffer& buffer : buffers)
+        {
+            if (buffer.data < data || buffer.data >= data + length)
+                stats.bytes += buffer.length;
+        }
+
+        auto deduplicate_start = timer_start();
+
+        std::vector<Mesh> imported(primitives.size());
+        std::vector<uint8_t> valid(primitives.size(), 1);
+
+        scheduler.ParallelFor(static_cast<uint32_t>(primitives.size()), [&](const uint32_t m)
+        {
+            const Primitive& primitive = primitives[m];
+            const Accessor& positions = primitive.positions;
+            const Accessor& indices = primitive.indices;
+
+            auto position = [&](const uint32_t v, float* p)
+            {
+                std::memcpy(p, positions.data + v * positions.stride, sizeof(float) * 3);
+            };
+
+            imported[m].name = primitive.name;
+
+            if (!primitive.indexed)
+            {
+                valid[m] = deduplicate(
+                    positions.count - positions.count % 3,
+                    positions.count,
+                    position,
+                    [](const size_t k) { return static_cast<uint32_t>(k); },
+                    imported[m]);
+                return;
+            }
+
+            const size_t count = indices.count - indices.count % 3;
+
+            auto index = [&](const size_t k) -> uint32_t
+            {
+                const uint8_t* at = indices.data + k * indices.stride;
+
+                if (indices.component_type == GL_UNSIGNED_BYTE)
+                    return *at;
+
+                if (indices.component_type == GL_UNSIGNED_SHORT)
+                {
+                    uint16_t value;
+                    std::memcpy(&value, at, sizeof(value));
+                    return value;
+                }
+
+                uint32_t value;
+                std::memcpy(&value, at, sizeof(value));
+                return value;
+            };
+
+            valid[m] = deduplicate(count, positions.count, position, index, imported[m]);
+        });
+
+        stats.deduplicate_time = timer_end(deduplicate_start);
+
+        if (std::find(valid.begin(), valid.end(), 0) != valid.end())
+            return false;
+
+        for (Mesh& mesh : imported)
+        {
+            if (mesh.indices.empty())
+                continue;
+
+            stats.vertices += mesh.vertices.size() / 3;
+            meshes.push_back(std::move(mesh));
+        }
+
+        return true;
+    }
+
+    static std::string extension(
+        const std::string& path)
+    {
+        std::string value = std::filesystem::path(path).extension().string();
+
+        for (char& c : value)
+        {
+            c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        }
+
+        return value;
+    }
+
+    bool obj(
+        const std::string& path,
+        cpu::Scheduler& scheduler,
+        std::vector<Mesh>& meshes,
+        Stats* stats)
+    {
+        std::vector<Mesh> imported;
+        Stats local;
+
+        try
+        {
+            if (!import_obj(path, scheduler, imported, local))
+            {
+                std::cout << "Malformed OBJ: " << path << std::endl;
+                return false;
+            }
+        }
+        catch (const std::exception&)
+        {
+            std::cout << "Could not open OBJ: " << path << std::endl;
+            return false;
+        }
+
+        std::move(imported.begin(), imported.end(), std::back_inserter(meshes));
+
+        if (stats)
+            *stats = local;
+
+        return true;
+    }
+
+    bool gltf(
+        const std::string& path,
+        cpu::Scheduler& scheduler,
+        std::vector<Mesh>& meshes,
+        Stats* stats)
+    {
+        std::vector<Mesh> imported;
+        Stats local;
+
+        try
+        {
+            if (!import_gltf(path, scheduler, imported, local))
+            {
+                std::cout << "Malformed or unsupported glTF: " << path << std::endl;
+                return false;
+            }
+        }
+        catch (const std::exception&)
+        {
+            std::cout << "Could not open glTF: " << path << std::endl;
+            return false;
+        }
+
+        std::move(imported.begin(), imported.end(), std::back_inserter(meshes));
+
+        if (stats)
+            *stats = local;
+
+        return true;
+    }
+
+    bool supported(
+        const std::string& path)
+    {
+        const std::string type = extension(path);
+        return type == ".obj" || type == ".gltf" || type == ".glb";
+    }
+
+    bool load(
+        const std::string& path,
+        cpu::Scheduler& scheduler,
+        std::vector<Mesh>& meshes,
+        Stats* stats)
+    {
+        if (extension(path) == ".obj")
+            return obj(path, scheduler, meshes, stats);
+
+        if (supported(path))
+            return gltf(path, scheduler, meshes, stats);
+
+        std::cout << "Unsupported model: " << path << std::endl;
+        return false;
+    }
+
+    Scenes::SceneBuilder scene(
+        const std::vector<Mesh>& meshes)
+    {
+        Scenes::SceneBuilder scene = Scenes::floor_scene();
+
+        for (const Mesh& mesh : meshes)
+        {
+            Entity entity;
+            entity.instance_id = Scenes::DIFFUSE_MATERIAL;
+            entity.mesh = scene.AddMesh(mesh, Scenes::DIFFUSE_MATERIAL);
+            scene.AddInstance(entity);
+        }
+
+        return scene;
+    }
+
+    std::string convert(
+        const std::string& path,
+        const std::string& cache_directory,
+        cpu::Scheduler& scheduler,
+        const Meshes::TriangleOrder order)
+    {
+        const char* suffixes[] = { ".bin", ".cache.bin", ".morton.bin" };
+
+        const std::filesystem::path source(path);
+        const std::string target = (std::filesystem::path(cache_directory) /
+            (source.filename().string() + suffixes[static_cast<int>(order)])).string();
+
+        std::error_code source_error;
+        std::error_code target_error;
+        const auto source_time = std::filesystem::last_write_time(source, source_error);
+        const auto target_time = std::filesystem::last_write_time(target, target_error);
+
+        if (source_error)
+        {
+            std::cout << "Could not open model: " << path << std::endl;
+            return std::string();
+        }
+
+        if (!target_error && target_time >= source_time && Scenes::map(target))
+            return target;
+
+        std::vector<Mesh> meshes;
+        if (!load(path, scheduler, meshes))
+            return std::string();
+
+        for (Mesh& mesh : meshes)
+        {
+            Meshes::optimize(mesh, order);
+        }
+
+        meshes.erase(
+            std::remove_if(meshes.begin(), meshes.end(), [](const Mesh& mesh) { return mesh.indices.empty(); }),
+            meshes.end());
+
+        if (meshes.empty())
+        {
+            std::cout << "No triangles in model: " << path << std::endl;
+            return std::string();
+        }
+
+        if (!Scenes::store(target, scene(meshes)))
+            return std::string();
+
+        return target;
+    }
+}
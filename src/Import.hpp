@@ -0,0 +1,74 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "Meshes.hpp"
+#include "SceneFile.hpp"
+#include "cpu/Scheduler.hpp"
+
+namespace Import
+{
+    // Imported meshes store every distinct position once.
+    using Mesh = Meshes::Mesh;
+
+    struct Stats
+    {
+        size_t bytes = 0;
+        size_t triangles = 0;
+
+        // Vertex references read, and the vertices left after merging.
+        size_t corners = 0;
+        size_t vertices = 0;
+
+        float parse_time = 0.0f;
+        float deduplicate_time = 0.0f;
+    };
+
+    // Positions and faces of a Wavefront OBJ, a mesh per o or g line.
+    // Polygons become fans. The file is split at line ends into chunks
+    // parsed on scheduler, then each mesh is deduplicated on scheduler.
+    bool obj(
+        const std::string& path,
+        cpu::Scheduler& scheduler,
+        std::vector<Mesh>& meshes,
+        Stats* stats = nullptr);
+
+    // The POSITION and indices of every triangle primitive of a .glb or a
+    // .gltf with its buffers in files beside it, a mesh per primitive,
+    // each gathered and deduplicated on scheduler. Node transforms, sparse
+    // accessors and data URIs are not supported.
+    bool gltf(
+        const std::string& path,
+        cpu::Scheduler& scheduler,
+        std::vector<Mesh>& meshes,
+        Stats* stats = nullptr);
+
+    // True for the extensions load accepts.
+    bool supported(
+        const std::string& path);
+
+    // obj or gltf by extension. False, with meshes unchanged, when the file
+    // is missing or malformed.
+    bool load(
+        const std::string& path,
+        cpu::Scheduler& scheduler,
+        std::vector<Mesh>& meshes,
+        Stats* stats = nullptr);
+
+    // The floor of the default scene with a diffuse instance of every mesh
+    // at the origin.
+    Scenes::SceneBuilder scene(
+        const std::vector<Mesh>& meshes);
+
+    // Imports path into a scene file in cache_directory unless one newer
+    // than path is there, returning its path, or empty on failure. Meshes
+    // lose their degenerate triangles on the way and are sorted in order,
+    // each order cached apart.
+    std::string convert(
+        const std::string& path,
+        const std::string& cache_directory,
+        cpu::Scheduler& scheduler,
+        const Meshes::TriangleOrder order = Meshes::TriangleOrder::None);
+}
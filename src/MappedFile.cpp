@@ -0,0 +1,116 @@
+#include "MappedFile.hpp"
+
+#include <iostream>
+#include <stdexcept>
+
+#if defined(_WIN32)
+
+#include <Windows.h>
+
+MappedFile::MappedFile(std::string path)
+{
+    HANDLE h = CreateFileA(
+        path.c_str(),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL,
+        nullptr);
+
+    if (h == INVALID_HANDLE_VALUE)
+    {
+        std::cout << "Failed to open file: " << path << std::endl;
+        throw std::runtime_error("Failed to open file.");
+    }
+
+    LARGE_INTEGER size;
+    GetFileSizeEx(h, &size);
+    length = static_cast<size_t>(size.QuadPart);
+    file = h;
+
+    if (length == 0)
+        return;
+
+    mapping = CreateFileMappingA(h, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+    if (mapping != nullptr)
+    {
+        data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    }
+
+    if (data == nullptr)
+    {
+        if (mapping != nullptr)
+            CloseHandle(mapping);
+        CloseHandle(h);
+
+        std::cout << "Failed to map file: " << path << std::endl;
+        throw std::runtime_error("Failed to map file.");
+    }
+}
+
+MappedFile::~MappedFile()
+{
+    if (data != nullptr)
+        UnmapViewOfFile(data);
+    if (mapping != nullptr)
+        CloseHandle(mapping);
+    if (file != nullptr)
+        CloseHandle(file);
+}
+
+#else
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+MappedFile::MappedFile(std::string path)
+{
+    const int fd = open(path.c_str(), O_RDONLY);
+
+    if (fd < 0)
+    {
+        std::cout << "Failed to open file: " << path << std::endl;
+        throw std::runtime_error("Failed to open file.");
+    }
+
+    struct stat info;
+    fstat(fd, &info);
+    length = static_cast<size_t>(info.st_size);
+
+    if (length > 0)
+    {
+        void* mapped = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        data = mapped == MAP_FAILED ? nullptr : mapped;
+    }
+
+    // The mapping keeps its own reference to the file.
+    close(fd);
+
+    if (length > 0 && data == nullptr)
+    {
+        std::cout << "Failed to map file: " << path << std::endl;
+        throw std::runtime_error("Failed to map file.");
+    }
+}
+
+MappedFile::~MappedFile()
+{
+    if (data != nullptr)
+        munmap(const_cast<void*>(data), length);
+}
+
+#endif
+
+const void* MappedFile::Data() const
+{
+    return data;
+}
+
+size_t MappedFile::Length() const
+{
+    return length;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+
+// Read only memory mapping of a whole file.
+class MappedFile
+{
+private:
+    size_t length = 0;
+    const void* data = nullptr;
+
+#if defined(_WIN32)
+    void* file = nullptr;
+    void* mapping = nullptr;
+#endif
+
+public:
+    MappedFile(std::string path);
+    virtual ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const void* Data() const;
+
+    size_t Length() const;
+};
@@ -0,0 +1,395 @@
+#include "Meshes.hpp"
+
+#include "Timing.hpp"
+
+#include <cmath>
+#include <limits>
+#include <iterator>
+#include <algorithm>
+
+namespace Meshes
+{
+    // Forsyth, "Linear-Speed Vertex Cache Optimisation".
+    static constexpr float CACHE_DECAY_POWER = 1.5f;
+    static constexpr float LAST_TRIANGLE_SCORE = 0.75f;
+    static constexpr float VALENCE_BOOST_SCALE = 2.0f;
+    static constexpr float VALENCE_BOOST_POWER = 0.5f;
+
+    // Valences past this score as this.
+    static constexpr uint32_t MAX_SCORED_VALENCE = 32;
+
+    uint32_t Mesh::IndexSize() const
+    {
+        return vertices.size() / 3 <= 65536 ?
+            sizeof(uint16_t) : sizeof(uint32_t);
+    }
+
+    Mesh quad()
+    {
+        Mesh mesh;
+        mesh.name = "quad";
+        mesh.vertices.assign(std::begin(quad_vtx), std::end(quad_vtx));
+
+        for (uint32_t i = 0; i < std::size(quad_vtx) / 3; i++)
+        {
+            mesh.indices.push_back(i);
+        }
+
+        return mesh;
+    }
+
+    Mesh cube()
+    {
+        Mesh mesh;
+        mesh.name = "cube";
+        mesh.vertices.assign(std::begin(cube_vtx), std::end(cube_vtx));
+        mesh.indices.assign(std::begin(cube_idx), std::end(cube_idx));
+        return mesh;
+    }
+
+    static glm::vec3 vertex(
+        const Mesh& mesh,
+        const uint32_t index)
+    {
+        return glm::vec3(
+            mesh.vertices[index * size_t(3) + 0],
+            mesh.vertices[index * size_t(3) + 1],
+            mesh.vertices[index * size_t(3) + 2]);
+    }
+
+    Bounds bounds(const Mesh& mesh)
+    {
+        Bounds result =
+        {
+            .min = glm::vec3(std::numeric_limits<float>::max()),
+            .max = glm::vec3(-std::numeric_limits<float>::max())
+        };
+
+        for (size_t v = 0; v < mesh.vertices.size() / 3; v++)
+        {
+            const glm::vec3 position = vertex(mesh, static_cast<uint32_t>(v));
+            result.min = glm::min(result.min, position);
+            result.max = glm::max(result.max, position);
+        }
+
+        return result;
+    }
+
+    float acmr(
+        const Mesh& mesh,
+        const uint32_t cache_size)
+    {
+        const size_t triangle_count = mesh.indices.size() / 3;
+
+        if (triangle_count == 0)
+            return 0.0f;
+
+        // A vertex is cached while fewer than cache_size misses followed
+        // the one that loaded it.
+        std::vector<int64_t> loaded(mesh.vertices.size() / 3, -int64_t(cache_size) - 1);
+        int64_t misses = 0;
+
+        for (const uint32_t index : mesh.indices)
+        {
+            if (misses - loaded[index] > cache_size)
+            {
+                loaded[index] = misses;
+                misses++;
+            }
+        }
+
+        return static_cast<float>(misses) / triangle_count;
+    }
+
+    size_t remove_degenerate(Mesh& mesh)
+    {
+        const size_t triangle_count = mesh.indices.size() / 3;
+        size_t kept = 0;
+
+        for (size_t t = 0; t < triangle_count; t++)
+        {
+            const uint32_t a = mesh.indices[t * 3 + 0];
+            const uint32_t b = mesh.indices[t * 3 + 1];
+            const uint32_t c = mesh.indices[t * 3 + 2];
+
+            if (a == b || b == c || c == a)
+                continue;
+
+            const glm::vec3 v0 = vertex(mesh, a);
+            const glm::vec3 normal = glm::cross(vertex(mesh, b) - v0, vertex(mesh, c) - v0);
+
+            if (normal == glm::vec3(0.0f))
+                continue;
+
+            mesh.indices[kept * 3 + 0] = a;
+            mesh.indices[kept * 3 + 1] = b;
+            mesh.indices[kept * 3 + 2] = c;
+            kept++;
+        }
+
+        mesh.indices.resize(kept * 3);
+        return triangle_count - kept;
+    }
+
+    // Spreads the low 10 bits of x to every third bit.
+    static uint32_t expand_bits(uint32_t x)
+    {
+        x = (x | (x << 16)) & 0x030000FF;
+        x = (x | (x << 8)) & 0x0300F00F;
+        x = (x | (x << 4)) & 0x030C30C3;
+        x = (x | (x << 2)) & 0x09249249;
+        return x;
+    }
+
+    static void sort_morton(Mesh& mesh)
+    {
+        const size_t triangle_count = mesh.indices.size() / 3;
+        const Bounds box = bounds(mesh);
+        const glm::vec3 scale = 1023.0f / glm::max(box.max - box.min, glm::vec3(1e-30f));
+
+        // Code above, triangle below, so sorting the keys sorts both.
+        std::vector<uint64_t> keys(triangle_count);
+
+        for (size_t t = 0; t < triangle_count; t++)
+        {
+            const glm::vec3 centroid = (
+                vertex(mesh, mesh.indices[t * 3 + 0]) +
+                vertex(mesh, mesh.indices[t * 3 + 1]) +
+                vertex(mesh, mesh.indices[t * 3 + 2])) / 3.0f;
+
+            const glm::vec3 cell = glm::clamp((centroid - box.min) * scale, 0.0f, 1023.0f);
+
+            const uint32_t code =
+                expand_bits(static_cast<uint32_t>(cell.x)) |
+                expand_bits(static_cast<uint32_t>(cell.y)) << 1 |
+                expand_bits(static_cast<uint32_t>(cell.z)) << 2;
+
+            keys[t] = static_cast<uint64_t>(code) << 32 | t;
+        }
+
+        std::sort(keys.begin(), keys.end());
+
+        std::vector<uint32_t> indices(mesh.indices.size());
+
+        for (size_t k = 0; k < triangle_count; k++)
+        {
+            const size_t t = keys[k] & 0xFFFFFFFF;
+            std::copy_n(&mesh.indices[t * 3], 3, &indices[k * 3]);
+        }
+
+        mesh.indices = std::move(indices);
+    }
+
+    static void sort_cache(Mesh& mesh)
+    {
+        const size_t vertex_count = mesh.vertices.size() / 3;
+        const size_t triangle_count = mesh.indices.size() / 3;
+
+        float cache_scores[VERTEX_CACHE_SIZE];
+        float valence_scores[MAX_SCORED_VALENCE + 1];
+
+        for (uint32_t p = 0; p < VERTEX_CACHE_SIZE; p++)
+        {
+            // The last triangle's vertices score flat, so it is not simply
+            // repeated in the other winding.
+            cache_scores[p] = p < 3 ? LAST_TRIANGLE_SCORE :
+                std::pow(1.0f - (p - 3) / float(VERTEX_CACHE_SIZE - 3), CACHE_DECAY_POWER);
+        }
+
+        for (uint32_t v = 1; v <= MAX_SCORED_VALENCE; v++)
+        {
+            valence_scores[v] = VALENCE_BOOST_SCALE * std::pow(float(v), -VALENCE_BOOST_POWER);
+        }
+
+        // Triangles of each vertex, the first remaining[v] not yet emitted.
+        std::vector<uint32_t> first(vertex_count + 1, 0);
+        std::vector<uint32_t> remaining(vertex_count, 0);
+
+        for (const uint32_t index : mesh.indices)
+        {
+            remaining[index]++;
+        }
+
+        for (size_t v = 0; v < vertex_count; v++)
+        {
+            first[v + 1] = first[v] + remaining[v];
+        }
+
+        std::vector<uint32_t> adjacency(mesh.indices.size());
+        std::vector<uint32_t> fill(first.begin(), first.end() - 1);
+
+        for (size_t i = 0; i < mesh.indices.size(); i++)
+        {
+            adjacency[fill[mesh.indices[i]]++] = static_cast<uint32_t>(i / 3);
+        }
+
+        std::vector<int32_t> cache_position(vertex_count, -1);
+        std::vector<float> vertex_scores(vertex_count);
+
+        auto score = [&](const uint32_t v)
+        {
+            if (remaining[v] == 0)
+                return -1.0f;
+
+            const int32_t p = cache_position[v];
+            return (p >= 0 ? cache_scores[p] : 0.0f) +
+                valence_scores[std::min(remaining[v], MAX_SCORED_VALENCE)];
+        };
+
+        for (uint32_t v = 0; v < vertex_count; v++)
+        {
+            vertex_scores[v] = score(v);
+        }
+
+        std::vector<uint8_t> emitted(triangle_count, 0);
+        std::vector<uint32_t> indices;
+        indices.reserve(mesh.indices.size());
+
+        uint32_t cache[VERTEX_CACHE_SIZE + 3];
+        uint32_t cache_count = 0;
+
+        size_t cursor = 0;
+        int64_t best = -1;
+
+        for (size_t n = 0; n < triangle_count; n++)
+        {
+            // Nothing in the cache has a triangle left, so take the next
+            // one in input order rather than search them all.
+            if (best < 0)
+            {
+                while (emitted[cursor])
+                    cursor++;
+                best = static_cast<int64_t>(cursor);
+            }
+
+            const uint32_t* triangle = &mesh.indices[best * 3];
+            emitted[best] = 1;
+
+            uint32_t next[VERTEX_CACHE_SIZE + 3];
+            uint32_t next_count = 0;
+
+            for (int k = 0; k < 3; k++)
+            {
+                const uint32_t v = triangle[k];
+                indices.push_back(v);
+
+                uint32_t* list = &adjacency[first[v]];
+                const uint32_t* end = list + remaining[v];
+                uint32_t* found = std::find(list, list + remaining[v], static_cast<uint32_t>(best));
+
+                if (found != end)
+                {
+                    std::swap(*found, list[remaining[v] - 1]);
+                    remaining[v]--;
+                }
+
+                if (std::find(next, next + next_count, v) == next + next_count)
+                    next[next_count++] = v;
+            }
+
+            for (uint32_t c = 0; c < cache_count; c++)
+            {
+                if (std::find(next, next + next_count, cache[c]) == next + next_count)
+                    next[next_count++] = cache[c];
+            }
+
+            for (uint32_t c = 0; c < next_count; c++)
+            {
+                const uint32_t v = next[c];
+                cache_position[v] = c < VERTEX_CACHE_SIZE ? static_cast<int32_t>(c) : -1;
+                vertex_scores[v] = score(v);
+            }
+
+            best = -1;
+            float best_score = -1.0f;
+
+            for (uint32_t c = 0; c < next_count; c++)
+            {
+                const uint32_t v = next[c];
+
+                for (uint32_t a = 0; a < remaining[v]; a++)
+                {
+                    const uint32_t t = adjacency[first[v] + a];
+                    const uint32_t* corners = &mesh.indices[t * size_t(3)];
+
+                    const float triangle_score =
+                        vertex_scores[corners[0]] +
+                        vertex_scores[corners[1]] +
+                        vertex_scores[corners[2]];
+
+                    if (triangle_score > best_score)
+                    {
+                        best_score = triangle_score;
+                        best = t;
+                    }
+                }
+            }
+
+            cache_count = std::min(next_count, VERTEX_CACHE_SIZE);
+            std::copy_n(next, cache_count, cache);
+        }
+
+        mesh.indices = std::move(indices);
+    }
+
+    void sort_triangles(
+        Mesh& mesh,
+        const TriangleOrder order)
+    {
+        switch (order)
+        {
+        case TriangleOrder::Cache:
+            sort_cache(mesh);
+            break;
+        case TriangleOrder::Morton:
+            sort_morton(mesh);
+            break;
+        case TriangleOrder::None:
+            break;
+        }
+    }
+
+    size_t remap_vertices(Mesh& mesh)
+    {
+        const size_t vertex_count = mesh.vertices.size() / 3;
+
+        std::vector<uint32_t> remap(vertex_count, UINT32_MAX);
+        std::vector<float> vertices;
+        vertices.reserve(mesh.vertices.size());
+
+        for (uint32_t& index : mesh.indices)
+        {
+            if (remap[index] == UINT32_MAX)
+            {
+                remap[index] = static_cast<uint32_t>(vertices.size() / 3);
+                vertices.insert(vertices.end(), &mesh.vertices[index * size_t(3)], &mesh.vertices[index * size_t(3)] + 3);
+            }
+
+            index = remap[index];
+        }
+
+        mesh.vertices = std::move(vertices);
+        return vertex_count - mesh.vertices.size() / 3;
+    }
+
+    OptimizeStats optimize(
+        Mesh& mesh,
+        const TriangleOrder order)
+    {
+        auto start = timer_start();
+
+        OptimizeStats stats;
+        stats.acmr_before = acmr(mesh);
+
+        stats.degenerate = remove_degenerate(mesh);
+        sort_triangles(mesh, order);
+        stats.unreferenced = remap_vertices(mesh);
+
+        stats.triangles = mesh.indices.size() / 3;
+        stats.vertices = mesh.vertices.size() / 3;
+        stats.acmr_after = acmr(mesh);
+
+        stats.time = timer_end(start);
+        return stats;
+    }
+}
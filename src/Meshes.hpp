@@ -0,0 +1,103 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "math/Math.hpp"
+
+namespace Meshes
+{
+    // Geometry of the default scene, see Scenes::default_scene.
+    constexpr float quad_vtx[] =
+    {
+        -1, 0, -1, -1, 0,  1, 1, 0, 1,
+        -1, 0, -1,  1, 0, -1, 1, 0, 1
+    };
+
+    constexpr float cube_vtx[] =
+    {
+        -1, -1, -1, 1, -1, -1, -1, 1, -1, 1, 1, -1,
+        -1, -1,  1, 1, -1,  1, -1, 1,  1, 1, 1,  1
+    };
+
+    constexpr short cube_idx[] =
+    {
+        4, 6, 0, 2, 0, 6, 0, 1, 4, 5, 4, 1,
+        0, 2, 1, 3, 1, 2, 1, 3, 5, 7, 5, 3,
+        2, 6, 3, 7, 3, 6, 4, 5, 6, 7, 6, 5
+    };
+
+    // Packed float3 positions and a triangle list indexing them.
+    struct Mesh
+    {
+        std::string name;
+        std::vector<float> vertices;
+        std::vector<uint32_t> indices;
+
+        // sizeof(uint16_t) when every index fits, else sizeof(uint32_t).
+        uint32_t IndexSize() const;
+    };
+
+    struct Bounds
+    {
+        glm::vec3 min;
+        glm::vec3 max;
+    };
+
+    enum class TriangleOrder
+    {
+        // Input order.
+        None,
+        // Forsyth's vertex cache optimiser, for rasterisers and hardware
+        // builders that read the index buffer in order.
+        Cache,
+        // Centroids along a Morton curve, for BVH builders.
+        Morton
+    };
+
+    struct OptimizeStats
+    {
+        size_t triangles = 0;
+        size_t degenerate = 0;
+        size_t vertices = 0;
+        size_t unreferenced = 0;
+
+        // Average cache miss ratio, transformed vertices per triangle
+        // through a FIFO of VERTEX_CACHE_SIZE, before and after.
+        float acmr_before = 0.0f;
+        float acmr_after = 0.0f;
+
+        float time = 0.0f;
+    };
+
+    constexpr uint32_t VERTEX_CACHE_SIZE = 32;
+
+    Mesh quad();
+    Mesh cube();
+
+    Bounds bounds(const Mesh& mesh);
+
+    float acmr(
+        const Mesh& mesh,
+        const uint32_t cache_size = VERTEX_CACHE_SIZE);
+
+    // Drops triangles repeating a vertex or of zero area, returning how
+    // many.
+    size_t remove_degenerate(Mesh& mesh);
+
+    void sort_triangles(
+        Mesh& mesh,
+        const TriangleOrder order);
+
+    // Renumbers vertices in order of first use so that fetches walk the
+    // vertex buffer forwards, dropping unreferenced ones. Returns how many
+    // were dropped.
+    size_t remap_vertices(Mesh& mesh);
+
+    // remove_degenerate, sort_triangles and remap_vertices. PrimitiveIndex()
+    // changes, so not for meshes whose shading depends on it.
+    OptimizeStats optimize(
+        Mesh& mesh,
+        const TriangleOrder order = TriangleOrder::Morton);
+}
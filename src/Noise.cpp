@@ -1,79 +1,248 @@
 #include "Noise.hpp"
+#include "OwenSobol.hpp"
 
-#include <noise/sobol.h>
-#include <noise/samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_1spp.h>
-#include <noise/samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_2spp.h>
-#include <noise/samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_4spp.h>
-#include <noise/samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_8spp.h>
-#include <noise/samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_16spp.h>
-#include <noise/samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_32spp.h>
-#include <noise/samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_64spp.h>
-#include <noise/samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_128spp.h>
-#include <noise/samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_256spp.h>
+#include <noise/sobol_u8.h>
+#include <noise/samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_1spp_u8.h>
+#include <noise/samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_2spp_u8.h>
+#include <noise/samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_4spp_u8.h>
+#include <noise/samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_8spp_u8.h>
+#include <noise/samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_16spp_u8.h>
+#include <noise/samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_32spp_u8.h>
+#include <noise/samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_64spp_u8.h>
+#include <noise/samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_128spp_u8.h>
+#include <noise/samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_256spp_u8.h>
+
+#include <array>
+#include <vector>
+#include <cassert>
+#include <algorithm>
+#include <stdexcept>
 
 #define DIM 128
 
 namespace Noise
 {
-    static uint8_t bsample(
-        const uint32_t x, const uint32_t y, const uint32_t s,
-        const uint16_t m, const uint32_t d)
+    // Every sampler ends in static_cast<uint8_t>((0.5f + value) / 256.0f * 255)
+    // of a byte value, so the whole conversion is one table.
+    static constexpr std::array<uint8_t, 256> byte_values = []()
+    {
+        std::array<uint8_t, 256> values = {};
+        for (int value = 0; value < 256; value++)
+        {
+            const float v = (0.5f + value) / 256.0f;
+            values[value] = static_cast<uint8_t>(v * 255);
+        }
+        return values;
+    }();
+
+    template<uint16_t SPP>
+    struct Tables;
+
+#define NOISE_TABLES(n) \
+    template<> \
+    struct Tables<n> \
+    { \
+        static const uint8_t* Ranking() { return rankingTile_##n##spp_u8; } \
+        static const uint8_t* Scrambling() { return scramblingTile_##n##spp_u8; } \
+    };
+
+    NOISE_TABLES(1)
+    NOISE_TABLES(2)
+    NOISE_TABLES(4)
+    NOISE_TABLES(8)
+    NOISE_TABLES(16)
+    NOISE_TABLES(32)
+    NOISE_TABLES(64)
+    NOISE_TABLES(128)
+    NOISE_TABLES(256)
+
+#undef NOISE_TABLES
+
+    // Slices [first, last) into texels, which points at slice first.
+    //
+    // sbned_128x128_2d2d2d2d_<SPP>spp for dimensions 0 to 3 at once, from the
+    // uint8 tables written by tools/NoisePack.cpp. Ranking keys are stored
+    // once per pair of dimensions. The x loop has no dependencies so it
+    // vectorises into gathers.
+    template<uint16_t SPP>
+    static void generate_slices(
+        TexDataByteRGBA* texels,
+        const uint32_t first,
+        const uint32_t last)
+    {
+        const uint8_t* ranking = Tables<SPP>::Ranking();
+        const uint8_t* scrambling = Tables<SPP>::Scrambling();
+
+        for (uint32_t sample = first; sample < last; sample++)
+        {
+            const int s = static_cast<int>(sample & 255);
+            TexDataByteRGBA* slice = texels + static_cast<size_t>(sample - first) * DIM * DIM;
+
+            for (uint32_t y = 0; y < DIM; y++)
+            {
+                const uint8_t* ranking_row = ranking + y * DIM * 4;
+                const uint8_t* scrambling_row = scrambling + y * DIM * 8;
+                TexDataByteRGBA* row = slice + y * DIM;
+
+                for (uint32_t x = 0; x < DIM; x++)
+                {
+                    const uint32_t k = x * 4;
+                    const uint32_t p = x * 8;
+
+                    const int rank_rg = s ^ ranking_row[k + 0];
+                    const int rank_ba = s ^ ranking_row[k + 1];
+
+                    const int r = sobol_256spp_256d_u8[0 + rank_rg * 256] ^ scrambling_row[p + 0];
+                    const int g = sobol_256spp_256d_u8[1 + rank_rg * 256] ^ scrambling_row[p + 1];
+                    const int b = sobol_256spp_256d_u8[2 + rank_ba * 256] ^ scrambling_row[p + 2];
+                    const int a = sobol_256spp_256d_u8[3 + rank_ba * 256] ^ scrambling_row[p + 3];
+
+                    row[x] =
+                    {
+                        byte_values[r],
+                        byte_values[g],
+                        byte_values[b],
+                        byte_values[a]
+                    };
+                }
+            }
+        }
+    }
+
+    static void generate_owen_slices(
+        TexDataByteRGBA* texels,
+        const uint32_t first,
+        const uint32_t last)
+    {
+        for (uint32_t sample = first; sample < last; sample++)
+        {
+            TexDataByteRGBA* slice = texels + static_cast<size_t>(sample - first) * DIM * DIM;
+
+            for (uint32_t y = 0; y < DIM; y++)
+            {
+                for (uint32_t x = 0; x < DIM; x++)
+                {
+                    uint32_t values[4];
+                    owen_sobol4(pixel_seed(x, y), sample, 0, values);
+
+                    slice[x + y * DIM] =
+                    {
+                        byte_values[values[0] >> 24],
+                        byte_values[values[1] >> 24],
+                        byte_values[values[2] >> 24],
+                        byte_values[values[3] >> 24]
+                    };
+                }
+            }
+        }
+    }
+
+    template<uint16_t SPP>
+    static float blue_noise_sample(
+        const uint32_t x,
+        const uint32_t y,
+        const uint32_t sample,
+        const uint32_t dimension)
+    {
+        const uint32_t p = (x & 127) + (y & 127) * DIM;
+        const uint32_t d = dimension & 7;
+
+        const int ranked = static_cast<int>(sample & 255) ^ Tables<SPP>::Ranking()[(d >> 1) + p * 4];
+        const int value = sobol_256spp_256d_u8[d + ranked * 256] ^ Tables<SPP>::Scrambling()[d + p * 8];
+
+        return (0.5f + value) / 256.0f;
+    }
+
+    float blue_noise(
+        const uint32_t x,
+        const uint32_t y,
+        const uint32_t sample,
+        const uint32_t dimension,
+        const uint16_t spp)
     {
-        float v;
+        assert(dimension < 8);
 
-        switch (m)
+        switch (spp)
         {
-        case 1:
-            v = sbned_128x128_2d2d2d2d_1spp(x, y, s, d);
-            break;
-        case 2:
-            v = sbned_128x128_2d2d2d2d_2spp(x, y, s, d);
-            break;
-        case 4:
-            v = sbned_128x128_2d2d2d2d_4spp(x, y, s, d);
-            break;
-        case 8:
-            v = sbned_128x128_2d2d2d2d_8spp(x, y, s, d);
-            break;
-        case 16:
-            v = sbned_128x128_2d2d2d2d_16spp(x, y, s, d);
-            break;
-        case 32:
-            v = sbned_128x128_2d2d2d2d_32spp(x, y, s, d);
-            break;
-        case 64:
-            v = sbned_128x128_2d2d2d2d_64spp(x, y, s, d);
-            break;
-        case 128:
-            v = sbned_128x128_2d2d2d2d_128spp(x, y, s, d);
-            break;
-        case 256:
-            v = sbned_128x128_2d2d2d2d_256spp(x, y, s, d);
-            break;
+        case 1: return blue_noise_sample<1>(x, y, sample, dimension);
+        case 2: return blue_noise_sample<2>(x, y, sample, dimension);
+        case 4: return blue_noise_sample<4>(x, y, sample, dimension);
+        case 8: return blue_noise_sample<8>(x, y, sample, dimension);
+        case 16: return blue_noise_sample<16>(x, y, sample, dimension);
+        case 32: return blue_noise_sample<32>(x, y, sample, dimension);
+        case 64: return blue_noise_sample<64>(x, y, sample, dimension);
+        case 128: return blue_noise_sample<128>(x, y, sample, dimension);
+        case 256: return blue_noise_sample<256>(x, y, sample, dimension);
         }
 
-        return static_cast<uint8_t>(v * 255);
+        throw std::runtime_error("Unsupported noise sample count.");
+    }
+
+    using SliceGenerator = void(*)(TexDataByteRGBA*, const uint32_t, const uint32_t);
+
+    static SliceGenerator slice_generator(
+        const uint16_t max_samples,
+        const Sampler sampler)
+    {
+        if (sampler == Sampler::OwenSobol)
+            return generate_owen_slices;
+
+        switch (max_samples)
+        {
+        case 1: return generate_slices<1>;
+        case 2: return generate_slices<2>;
+        case 4: return generate_slices<4>;
+        case 8: return generate_slices<8>;
+        case 16: return generate_slices<16>;
+        case 32: return generate_slices<32>;
+        case 64: return generate_slices<64>;
+        case 128: return generate_slices<128>;
+        case 256: return generate_slices<256>;
+        }
+
+        throw std::runtime_error("Unsupported noise sample count.");
     }
 
     void generate(
         std::unique_ptr<std::vector<TexDataByteRGBA>>& texture_data,
         const uint16_t sample,
-        const uint16_t max_samples)
+        const uint16_t max_samples,
+        const Sampler sampler)
     {
         assert(texture_data->size() == DIM * DIM * max_samples);
 
-        for (uint32_t y = 0; y < DIM; y++)
-        {
-            for (uint32_t x = 0; x < DIM; x++)
-            {
-                const uint8_t r = bsample(x, y, sample, max_samples, 0);
-                const uint8_t g = bsample(x, y, sample, max_samples, 1);
-                const uint8_t b = bsample(x, y, sample, max_samples, 2);
-                const uint8_t a = bsample(x, y, sample, max_samples, 3);
+        generate_slice(
+            texture_data->data() + static_cast<size_t>(sample) * DIM * DIM,
+            sample,
+            max_samples,
+            sampler);
+    }
 
-                const size_t i = x + (y * DIM) + (sample * DIM * DIM);
-                (*texture_data)[i] = { r, g, b, a };
-            }
-        }
+    void generate_slice(
+        TexDataByteRGBA* slice,
+        const uint16_t sample,
+        const uint16_t max_samples,
+        const Sampler sampler)
+    {
+        assert(sample < max_samples);
+
+        slice_generator(max_samples, sampler)(slice, sample, sample + 1u);
+    }
+
+    void generate_all(
+        std::unique_ptr<std::vector<TexDataByteRGBA>>& texture_data,
+        const uint16_t max_samples,
+        cpu::Scheduler& scheduler,
+        const Sampler sampler)
+    {
+        assert(texture_data->size() == DIM * DIM * max_samples);
+
+        const SliceGenerator generator = slice_generator(max_samples, sampler);
+        TexDataByteRGBA* texels = texture_data->data();
+
+        scheduler.ParallelFor(max_samples, [&](const uint32_t sample)
+        {
+            generator(texels + static_cast<size_t>(sample) * DIM * DIM, sample, sample + 1);
+        });
     }
 }
@@ -4,11 +4,46 @@
 #include <memory>
 
 #include "math/Math.hpp"
+#include "cpu/Scheduler.hpp"
 
 namespace Noise
 {
+    enum class Sampler
+    {
+        // Tables optimised for max_samples in 1, 2, 4, ... 256, indices wrap at 256.
+        BlueNoise,
+        // Runtime Owen scrambled Sobol, any max_samples, see OwenSobol.hpp.
+        OwenSobol
+    };
+
+    // One slice, sample, of the max_samples slices in texture_data.
     void generate(
         std::unique_ptr<std::vector<TexDataByteRGBA>>& texture_data,
         const uint16_t sample,
-        const uint16_t max_samples);
+        const uint16_t max_samples,
+        const Sampler sampler = Sampler::BlueNoise);
+
+    // Slice sample of max_samples into the 128x128 texels at slice,
+    // without the rest of the texture.
+    void generate_slice(
+        TexDataByteRGBA* slice,
+        const uint16_t sample,
+        const uint16_t max_samples,
+        const Sampler sampler = Sampler::BlueNoise);
+
+    // All max_samples slices, one scheduler job each.
+    void generate_all(
+        std::unique_ptr<std::vector<TexDataByteRGBA>>& texture_data,
+        const uint16_t max_samples,
+        cpu::Scheduler& scheduler,
+        const Sampler sampler = Sampler::BlueNoise);
+
+    // sbned_128x128_2d2d2d2d_<spp>spp from the packed tables for one of the
+    // eight optimised dimensions.
+    float blue_noise(
+        const uint32_t x,
+        const uint32_t y,
+        const uint32_t sample,
+        const uint32_t dimension,
+        const uint16_t spp);
 }
@@ -0,0 +1,210 @@
+#include "NoiseCache.hpp"
+
+#include "Noise.hpp"
+
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <filesystem>
+
+namespace Noise
+{
+    // Padded so the texels that follow stay 64 byte aligned in the mapping.
+    struct alignas(64) CacheHeader
+    {
+        char magic[4];
+        uint32_t version;
+        uint32_t dimension;
+        uint16_t samples;
+        uint16_t bounces;
+        uint64_t texel_count;
+    };
+
+    static constexpr char CACHE_MAGIC[4] = { 'R', 'P', 'N', 'Z' };
+
+    Texture::Texture(
+        std::vector<TexDataByteRGBA>&& new_texels) :
+        texels(std::move(new_texels))
+    {
+        data = texels.data();
+        size = texels.size();
+    }
+
+    Texture::Texture(
+        std::unique_ptr<MappedFile>&& new_mapping,
+        const size_t offset,
+        const size_t new_size) :
+        mapping(std::move(new_mapping))
+    {
+        data = reinterpret_cast<const TexDataByteRGBA*>(
+            static_cast<const uint8_t*>(mapping->Data()) + offset);
+        size = new_size;
+    }
+
+    const TexDataByteRGBA* Texture::Data() const
+    {
+        return data;
+    }
+
+    size_t Texture::Size() const
+    {
+        return size;
+    }
+
+    bool Texture::Mapped() const
+    {
+        return mapping != nullptr;
+    }
+
+    std::string cache_path(
+        const std::string& cache_directory,
+        const uint16_t samples,
+        const uint16_t bounces)
+    {
+        return (std::filesystem::path(cache_directory) /
+            ("noise_" + std::to_string(samples) + "x" + std::to_string(bounces) + ".bin")).string();
+    }
+
+    static CacheHeader make_header(
+        const uint16_t samples,
+        const uint16_t bounces)
+    {
+        CacheHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+        header.version = CACHE_VERSION;
+        header.dimension = TEXTURE_DIM;
+        header.samples = samples;
+        header.bounces = bounces;
+        header.texel_count = static_cast<uint64_t>(TEXTURE_DIM) * TEXTURE_DIM * samples * bounces;
+        return header;
+    }
+
+    static std::unique_ptr<Texture> map_cache(
+        const std::string& path,
+        const CacheHeader& expected)
+    {
+        if (!std::filesystem::exists(path))
+            return nullptr;
+
+        auto mapping = std::make_unique<MappedFile>(path);
+
+        const size_t data_size = expected.texel_count * sizeof(TexDataByteRGBA);
+
+        const CacheHeader* header = static_cast<const CacheHeader*>(mapping->Data());
+
+        if (mapping->Length() != sizeof(CacheHeader) + data_size ||
+            std::memcmp(header->magic, expected.magic, sizeof(CACHE_MAGIC)) != 0 ||
+            header->version != expected.version ||
+            header->dimension != expected.dimension ||
+            header->samples != expected.samples ||
+            header->bounces != expected.bounces ||
+            header->texel_count != expected.texel_count)
+        {
+            std::cout << "Stale noise cache: " << path << std::endl;
+            return nullptr;
+        }
+
+        return std::make_unique<Texture>(
+            std::move(mapping),
+            sizeof(CacheHeader),
+            static_cast<size_t>(expected.texel_count));
+    }
+
+    static bool write_cache(
+        const std::string& path,
+        const CacheHeader& header,
+        const std::vector<const TexDataByteRGBA*>& slices)
+    {
+        std::error_code error;
+        const std::filesystem::path target(path);
+
+        if (target.has_parent_path())
+            std::filesystem::create_directories(target.parent_path(), error);
+
+        // Written aside and renamed so readers never map a partial file.
+        const std::string temporary = path + ".tmp";
+
+        {
+            std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+            for (const TexDataByteRGBA* slice : slices)
+            {
+                file.write(
+                    reinterpret_cast<const char*>(slice),
+                    static_cast<size_t>(TEXTURE_DIM) * TEXTURE_DIM * sizeof(TexDataByteRGBA));
+            }
+
+            if (!file)
+            {
+                std::cout << "Failed to write noise cache: " << temporary << std::endl;
+                return false;
+            }
+        }
+
+        std::filesystem::rename(temporary, target, error);
+        return !error;
+    }
+
+    std::unique_ptr<Texture> map(
+        const std::string& cache_directory,
+        const uint16_t samples,
+        const uint16_t bounces)
+    {
+        try
+        {
+            return map_cache(
+                cache_path(cache_directory, samples, bounces),
+                make_header(samples, bounces));
+        }
+        catch (const std::exception&)
+        {
+            // Unreadable cache, the caller regenerates.
+            return nullptr;
+        }
+    }
+
+    bool store(
+        const std::string& cache_directory,
+        const uint16_t samples,
+        const uint16_t bounces,
+        const std::vector<const TexDataByteRGBA*>& slices)
+    {
+        assert(slices.size() == static_cast<size_t>(samples) * bounces);
+
+        return write_cache(
+            cache_path(cache_directory, samples, bounces),
+            make_header(samples, bounces),
+            slices);
+    }
+
+    std::unique_ptr<Texture> load(
+        const std::string& cache_directory,
+        const uint16_t samples,
+        const uint16_t bounces,
+        cpu::Scheduler& scheduler)
+    {
+        if (auto texture = map(cache_directory, samples, bounces))
+            return texture;
+
+        const uint16_t noise_samples = samples * bounces;
+
+        auto texels = std::make_unique<std::vector<TexDataByteRGBA>>(
+            static_cast<size_t>(TEXTURE_DIM) * TEXTURE_DIM * noise_samples);
+
+        generate_all(texels, noise_samples, scheduler);
+
+        std::vector<const TexDataByteRGBA*> slices(noise_samples);
+        for (uint16_t i = 0; i < noise_samples; i++)
+        {
+            slices[i] = texels->data() + static_cast<size_t>(i) * TEXTURE_DIM * TEXTURE_DIM;
+        }
+
+        store(cache_directory, samples, bounces, slices);
+
+        return std::make_unique<Texture>(std::move(*texels));
+    }
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+
+#include "MappedFile.hpp"
+#include "math/Math.hpp"
+#include "cpu/Scheduler.hpp"
+
+namespace Noise
+{
+    // Bump whenever generate() would produce different texels.
+    constexpr uint32_t CACHE_VERSION = 1;
+
+    constexpr uint32_t TEXTURE_DIM = 128;
+
+    // samples * bounces slices of TEXTURE_DIM squared texels, either
+    // generated in memory or mapped from the cache file.
+    class Texture
+    {
+    private:
+        std::vector<TexDataByteRGBA> texels;
+        std::unique_ptr<MappedFile> mapping;
+
+        const TexDataByteRGBA* data = nullptr;
+        size_t size = 0;
+
+    public:
+        explicit Texture(
+            std::vector<TexDataByteRGBA>&& texels);
+
+        Texture(
+            std::unique_ptr<MappedFile>&& mapping,
+            const size_t offset,
+            const size_t size);
+
+        const TexDataByteRGBA* Data() const;
+
+        size_t Size() const;
+
+        bool Mapped() const;
+    };
+
+    // Maps the cache file for (samples, bounces) from cache_directory,
+    // nullptr when it is missing, unreadable or stale.
+    std::unique_ptr<Texture> map(
+        const std::string& cache_directory,
+        const uint16_t samples,
+        const uint16_t bounces);
+
+    // Writes the samples * bounces slices, TEXTURE_DIM squared texels each,
+    // as the cache file for (samples, bounces).
+    bool store(
+        const std::string& cache_directory,
+        const uint16_t samples,
+        const uint16_t bounces,
+        const std::vector<const TexDataByteRGBA*>& slices);
+
+    // Maps the cache file for (samples, bounces) from cache_directory,
+    // generating and writing it first on scheduler when it is missing or
+    // stale.
+    std::unique_ptr<Texture> load(
+        const std::string& cache_directory,
+        const uint16_t samples,
+        const uint16_t bounces,
+        cpu::Scheduler& scheduler);
+
+    std::string cache_path(
+        const std::string& cache_directory,
+        const uint16_t samples,
+        const uint16_t bounces);
+}
@@ -0,0 +1,208 @@
+#include "NoiseStream.hpp"
+
+#include "Noise.hpp"
+
+#include <algorithm>
+
+namespace Noise
+{
+    static constexpr size_t SLICE_TEXELS = static_cast<size_t>(TEXTURE_DIM) * TEXTURE_DIM;
+
+    Stream::Stream(
+        const std::string& cache_directory,
+        const uint16_t samples,
+        const uint16_t bounces,
+        const uint32_t lookahead) :
+        cache_directory(cache_directory),
+        samples(samples),
+        bounces(bounces),
+        slice_count(static_cast<uint32_t>(samples) * bounces),
+        lookahead(std::min(lookahead, slice_count)),
+        mapped(map(cache_directory, samples, bounces))
+    {
+        if (mapped)
+        {
+            states.assign(slice_count, State::Resident);
+            resident_count = slice_count;
+            return;
+        }
+
+        slices.resize(slice_count);
+        states.assign(slice_count, State::Empty);
+
+        worker = std::thread(&Stream::Run, this);
+
+        for (uint32_t i = 0; i < this->lookahead; i++)
+        {
+            Prefetch(i);
+        }
+    }
+
+    Stream::~Stream()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+
+        queued.notify_one();
+
+        if (worker.joinable())
+            worker.join();
+    }
+
+    void Stream::Run()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        while (true)
+        {
+            queued.wait(lock, [&]() { return stopping || !queue.empty(); });
+
+            if (stopping)
+                return;
+
+            const uint32_t index = queue.front();
+            queue.pop_front();
+
+            lock.unlock();
+
+            std::vector<TexDataByteRGBA> slice(SLICE_TEXELS);
+            std::exception_ptr failure;
+
+            try
+            {
+                generate_slice(
+                    slice.data(),
+                    static_cast<uint16_t>(index),
+                    static_cast<uint16_t>(slice_count));
+            }
+            catch (...)
+            {
+                failure = std::current_exception();
+            }
+
+            lock.lock();
+
+            if (failure)
+            {
+                error = failure;
+                queue.clear();
+                resident.notify_all();
+                return;
+            }
+
+            slices[index] = std::move(slice);
+            states[index] = State::Resident;
+            resident_count++;
+
+            resident.notify_all();
+
+            if (resident_count == slice_count)
+                break;
+        }
+
+        lock.unlock();
+
+        // Resident slices are never written again, so no lock is needed.
+        std::vector<const TexDataByteRGBA*> texels(slice_count);
+        for (uint32_t i = 0; i < slice_count; i++)
+        {
+            texels[i] = slices[i].data();
+        }
+
+        store(cache_directory, samples, bounces, texels);
+    }
+
+    void Stream::Enqueue(
+        const uint32_t index,
+        const bool urgent)
+    {
+        if (states[index] == State::Resident)
+            return;
+
+        if (states[index] == State::Queued)
+        {
+            if (!urgent)
+                return;
+
+            // Not in the queue means the worker is already generating it.
+            const auto queued_index = std::find(queue.begin(), queue.end(), index);
+
+            if (queued_index == queue.end())
+                return;
+
+            queue.erase(queued_index);
+        }
+
+        states[index] = State::Queued;
+
+        if (urgent)
+            queue.push_front(index);
+        else
+            queue.push_back(index);
+
+        queued.notify_one();
+    }
+
+    const TexDataByteRGBA* Stream::Slice(
+        const uint32_t index)
+    {
+        const uint32_t slice = index % slice_count;
+
+        if (mapped)
+            return mapped->Data() + slice * SLICE_TEXELS;
+
+        std::unique_lock<std::mutex> lock(mutex);
+
+        Enqueue(slice, true);
+
+        resident.wait(lock, [&]() { return error || states[slice] == State::Resident; });
+
+        if (error)
+            std::rethrow_exception(error);
+
+        for (uint32_t i = 1; i <= lookahead; i++)
+        {
+            Enqueue((slice + i) % slice_count, false);
+        }
+
+        return slices[slice].data();
+    }
+
+    void Stream::Prefetch(
+        const uint32_t index)
+    {
+        if (mapped)
+            return;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        Enqueue(index % slice_count, false);
+    }
+
+    bool Stream::Resident(
+        const uint32_t index) const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return states[index % slice_count] == State::Resident;
+    }
+
+    uint32_t Stream::SliceCount() const
+    {
+        return slice_count;
+    }
+
+    size_t Stream::ResidentBytes() const
+    {
+        if (mapped)
+            return 0;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        return resident_count * SLICE_TEXELS * sizeof(TexDataByteRGBA);
+    }
+
+    bool Stream::Mapped() const
+    {
+        return mapped != nullptr;
+    }
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <memory>
+#include <exception>
+#include <condition_variable>
+
+#include "NoiseCache.hpp"
+
+namespace Noise
+{
+    // The samples * bounces slices of a noise texture, made resident one at
+    // a time. A valid cache file is mapped and paged in as slices are read.
+    // Otherwise slices are generated on a background thread, in request
+    // order, and the cache file is written once every slice exists, so a
+    // consumer that wants it written must request or prefetch them all.
+    // Memory held is one slice per slice requested so far.
+    class Stream
+    {
+    private:
+        enum class State : uint8_t
+        {
+            Empty,
+            Queued,
+            Resident
+        };
+
+        const std::string cache_directory;
+        const uint16_t samples;
+        const uint16_t bounces;
+        const uint32_t slice_count;
+        const uint32_t lookahead;
+
+        std::unique_ptr<Texture> mapped;
+
+        std::vector<std::vector<TexDataByteRGBA>> slices;
+        std::vector<State> states;
+        std::deque<uint32_t> queue;
+        uint32_t resident_count = 0;
+        std::exception_ptr error;
+
+        mutable std::mutex mutex;
+        std::condition_variable queued;
+        std::condition_variable resident;
+        bool stopping = false;
+
+        std::thread worker;
+
+        void Run();
+
+        void Enqueue(
+            const uint32_t index,
+            const bool urgent);
+
+    public:
+        Stream(
+            const std::string& cache_directory,
+            const uint16_t samples,
+            const uint16_t bounces,
+            const uint32_t lookahead = 4);
+
+        ~Stream();
+
+        Stream(const Stream&) = delete;
+        Stream& operator=(const Stream&) = delete;
+
+        // Slice index modulo SliceCount(), blocking until it is resident,
+        // then queues the lookahead slices after it.
+        const TexDataByteRGBA* Slice(
+            const uint32_t index);
+
+        // Queues slice index modulo SliceCount() without waiting.
+        void Prefetch(
+            const uint32_t index);
+
+        bool Resident(
+            const uint32_t index) const;
+
+        uint32_t SliceCount() const;
+
+        // Bytes of generated slices held, zero when mapped.
+        size_t ResidentBytes() const;
+
+        bool Mapped() const;
+    };
+}
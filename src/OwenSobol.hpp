@@ -0,0 +1,161 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace Noise
+{
+    // Hash based Owen scrambled Sobol sampler after Burley, "Practical
+    // Hash-based Owen Scrambling", JCGT 2020. Sobol points are generated
+    // from 4 dimensions of direction numbers, higher dimensions pad with
+    // independently seeded groups of four. No tables beyond 4x32 words and
+    // no wrap around, so sample index and dimension are unbounded. Only
+    // integer arithmetic without branches, loops over pixels vectorise.
+
+    // Joe and Kuo direction numbers for the first four Sobol dimensions.
+    constexpr std::array<std::array<uint32_t, 32>, 4> sobol_directions = []()
+    {
+        struct Polynomial
+        {
+            uint32_t s;
+            uint32_t a;
+            uint32_t m[3];
+        };
+
+        constexpr Polynomial polynomials[3] =
+        {
+            { 1, 0, { 1, 0, 0 } },
+            { 2, 1, { 1, 3, 0 } },
+            { 3, 1, { 1, 3, 1 } }
+        };
+
+        std::array<std::array<uint32_t, 32>, 4> directions = {};
+
+        for (uint32_t i = 0; i < 32; i++)
+        {
+            directions[0][i] = 1u << (31 - i);
+        }
+
+        for (uint32_t d = 1; d < 4; d++)
+        {
+            const Polynomial& p = polynomials[d - 1];
+            auto& v = directions[d];
+
+            for (uint32_t i = 0; i < 32; i++)
+            {
+                if (i < p.s)
+                {
+                    v[i] = p.m[i] << (31 - i);
+                    continue;
+                }
+
+                v[i] = v[i - p.s] ^ (v[i - p.s] >> p.s);
+
+                for (uint32_t k = 1; k < p.s; k++)
+                {
+                    v[i] ^= ((p.a >> (p.s - 1 - k)) & 1) * v[i - k];
+                }
+            }
+        }
+
+        return directions;
+    }();
+
+    inline uint32_t hash(uint32_t x)
+    {
+        x ^= x >> 16;
+        x *= 0x7feb352du;
+        x ^= x >> 15;
+        x *= 0x846ca68bu;
+        x ^= x >> 16;
+        return x;
+    }
+
+    inline uint32_t hash_combine(
+        const uint32_t seed,
+        const uint32_t v)
+    {
+        return seed ^ (v + (seed << 6) + (seed >> 2));
+    }
+
+    inline uint32_t reverse_bits(uint32_t x)
+    {
+        x = ((x >> 1) & 0x55555555u) | ((x & 0x55555555u) << 1);
+        x = ((x >> 2) & 0x33333333u) | ((x & 0x33333333u) << 2);
+        x = ((x >> 4) & 0x0f0f0f0fu) | ((x & 0x0f0f0f0fu) << 4);
+        x = ((x >> 8) & 0x00ff00ffu) | ((x & 0x00ff00ffu) << 8);
+        return (x >> 16) | (x << 16);
+    }
+
+    inline uint32_t laine_karras_permutation(
+        uint32_t x,
+        const uint32_t seed)
+    {
+        x += seed;
+        x ^= x * 0x6c50b47cu;
+        x ^= x * 0xb82f1e52u;
+        x ^= x * 0xc7afe638u;
+        x ^= x * 0x8d22f6e6u;
+        return x;
+    }
+
+    inline uint32_t nested_uniform_scramble(
+        const uint32_t x,
+        const uint32_t seed)
+    {
+        return reverse_bits(laine_karras_permutation(reverse_bits(x), seed));
+    }
+
+    inline uint32_t sobol(
+        const uint32_t index,
+        const uint32_t dimension)
+    {
+        const auto& v = sobol_directions[dimension];
+
+        uint32_t x = 0;
+        for (uint32_t bit = 0; bit < 32; bit++)
+        {
+            x ^= v[bit] & (0u - ((index >> bit) & 1u));
+        }
+        return x;
+    }
+
+    inline uint32_t pixel_seed(
+        const uint32_t x,
+        const uint32_t y)
+    {
+        return hash(x ^ hash(y));
+    }
+
+    // Dimensions [4 * group, 4 * group + 4) of point index as 32 bit fixed
+    // point, the index is shuffled with the same group seed.
+    inline void owen_sobol4(
+        const uint32_t seed,
+        const uint32_t index,
+        const uint32_t group,
+        uint32_t result[4])
+    {
+        const uint32_t group_seed = hash_combine(seed, hash(group));
+        const uint32_t shuffled = nested_uniform_scramble(index, group_seed);
+
+        for (uint32_t d = 0; d < 4; d++)
+        {
+            result[d] = nested_uniform_scramble(
+                sobol(shuffled, d),
+                hash_combine(group_seed, d));
+        }
+    }
+
+    // Dimension of point index for pixel (x, y), in [0, 1).
+    inline float owen_sobol(
+        const uint32_t x,
+        const uint32_t y,
+        const uint32_t index,
+        const uint32_t dimension)
+    {
+        uint32_t values[4];
+        owen_sobol4(pixel_seed(x, y), index, dimension / 4, values);
+
+        return static_cast<float>(values[dimension % 4] >> 8) * (1.0f / 16777216.0f);
+    }
+}
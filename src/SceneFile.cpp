@@ -0,0 +1,437 @@
+#include "SceneFile.hpp"
+
+#include "Meshes.hpp"
+
+#include <limits>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <algorithm>
+#include <filesystem>
+
+namespace Scenes
+{
+    // Padded so the tables that follow start on BLOB_ALIGNMENT.
+    struct alignas(64) FileHeader
+    {
+        char magic[4];
+        uint32_t version;
+        uint64_t file_size;
+        uint32_t mesh_count;
+        uint32_t instance_count;
+        uint64_t meshes_offset;
+        uint64_t instances_offset;
+    };
+
+    static_assert(sizeof(FileHeader) == BLOB_ALIGNMENT);
+
+    static constexpr char FILE_MAGIC[4] = { 'R', 'P', 'S', 'C' };
+
+    static constexpr const char* DEFAULT_SCENE_FILE = "scene_default.bin";
+
+    static uint64_t align(const uint64_t offset)
+    {
+        return (offset + BLOB_ALIGNMENT - 1) & ~(BLOB_ALIGNMENT - 1);
+    }
+
+    // True when count elements of size bytes at offset lie inside length.
+    static bool within(
+        const uint64_t length,
+        const uint64_t offset,
+        const uint64_t count,
+        const uint64_t size)
+    {
+        return offset <= length && count <= (length - offset) / size;
+    }
+
+    uint32_t SceneBuilder::AddMesh(
+        const float* vertices,
+        const size_t vertex_floats,
+        const uint16_t* indices,
+        const size_t index_count,
+        const uint32_t material)
+    {
+        Mesh mesh;
+        mesh.vertices.assign(vertices, vertices + vertex_floats);
+        mesh.index_size = indices ? sizeof(uint16_t) : 0;
+        mesh.material = material;
+
+        if (indices)
+        {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(indices);
+            mesh.indices.assign(bytes, bytes + index_count * sizeof(uint16_t));
+        }
+
+        meshes.push_back(std::move(mesh));
+        return static_cast<uint32_t>(meshes.size() - 1);
+    }
+
+    uint32_t SceneBuilder::AddMesh(
+        const float* vertices,
+        const size_t vertex_floats,
+        const uint32_t* indices,
+        const size_t index_count,
+        const uint32_t material)
+    {
+        Mesh mesh;
+        mesh.vertices.assign(vertices, vertices + vertex_floats);
+        mesh.index_size = indices ? sizeof(uint32_t) : 0;
+        mesh.material = material;
+
+        if (indices)
+        {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(indices);
+            mesh.indices.assign(bytes, bytes + index_count * sizeof(uint32_t));
+        }
+
+        meshes.push_back(std::move(mesh));
+        return static_cast<uint32_t>(meshes.size() - 1);
+    }
+
+    uint32_t SceneBuilder::AddMesh(
+        const Meshes::Mesh& mesh,
+        const uint32_t material)
+    {
+        if (mesh.IndexSize() == sizeof(uint32_t))
+        {
+            return AddMesh(
+                mesh.vertices.data(),
+                mesh.vertices.size(),
+                mesh.indices.data(),
+                mesh.indices.size(),
+                material);
+        }
+
+        const std::vector<uint16_t> narrow(mesh.indices.begin(), mesh.indices.end());
+
+        return AddMesh(
+            mesh.vertices.data(),
+            mesh.vertices.size(),
+            narrow.data(),
+            narrow.size(),
+            material);
+    }
+
+    uint32_t SceneBuilder::AddInstance(
+        const Entity& entity,
+        const uint32_t parent)
+    {
+        InstanceRecord instance =
+        {
+            .position = { entity.position.x, entity.position.y, entity.position.z },
+            .orientation = { entity.orientation.x, entity.orientation.y, entity.orientation.z, entity.orientation.w },
+            .scale = { entity.scale.x, entity.scale.y, entity.scale.z },
+            .mesh = entity.mesh,
+            .material = static_cast<uint32_t>(entity.instance_id),
+            .parent = parent
+        };
+
+        instances.push_back(instance);
+        return static_cast<uint32_t>(instances.size() - 1);
+    }
+
+    size_t SceneBuilder::MeshCount() const
+    {
+        return meshes.size();
+    }
+
+    size_t SceneBuilder::InstanceCount() const
+    {
+        return instances.size();
+    }
+
+    SceneFile::SceneFile(
+        std::unique_ptr<MappedFile>&& new_mapping,
+        const uint32_t new_mesh_count,
+        const uint32_t new_instance_count,
+        const uint64_t meshes_offset,
+        const uint64_t instances_offset) :
+        mapping(std::move(new_mapping)),
+        mesh_count(new_mesh_count),
+        instance_count(new_instance_count)
+    {
+        base = static_cast<const uint8_t*>(mapping->Data());
+
+        meshes = reinterpret_cast<const MeshRecord*>(base + meshes_offset);
+        instances = reinterpret_cast<const InstanceRecord*>(base + instances_offset);
+    }
+
+    const float* SceneFile::Vertices(const uint32_t mesh) const
+    {
+        return reinterpret_cast<const float*>(base + meshes[mesh].vertex_offset);
+    }
+
+    const void* SceneFile::Indices(const uint32_t mesh) const
+    {
+        return meshes[mesh].index_size == 0 ?
+            nullptr : base + meshes[mesh].index_offset;
+    }
+
+    size_t SceneFile::Size() const
+    {
+        return mapping->Length();
+    }
+
+    bool SceneFile::Instantiate(EntityStore& entities) const
+    {
+        for (uint32_t i = 0; i < instance_count; i++)
+        {
+            const InstanceRecord& instance = instances[i];
+
+            if (instance.mesh >= mesh_count ||
+                instance.material >= MATERIAL_COUNT ||
+                (instance.parent != NO_PARENT && instance.parent >= i))
+            {
+                std::cout << "Invalid scene instance: " << i << std::endl;
+                return false;
+            }
+        }
+
+        // Roots may reuse freed slots, so parents are looked up by what
+        // Add returned rather than offset from the first.
+        std::vector<uint32_t> added(instance_count);
+
+        for (uint32_t i = 0; i < instance_count; i++)
+        {
+            const InstanceRecord& instance = instances[i];
+
+            Entity entity;
+            entity.position = glm::vec3(instance.position[0], instance.position[1], instance.position[2]);
+            entity.orientation = glm::quat(instance.orientation[3], instance.orientation[0], instance.orientation[1], instance.orientation[2]);
+            entity.scale = glm::vec3(instance.scale[0], instance.scale[1], instance.scale[2]);
+            entity.instance_id = instance.material;
+            entity.mesh = instance.mesh;
+
+            added[i] = static_cast<uint32_t>(entities.Add(entity, instance.parent == NO_PARENT ?
+                EntityStore::NO_PARENT : added[instance.parent]));
+        }
+
+        return true;
+    }
+
+    bool store(
+        const std::string& path,
+        const SceneBuilder& scene)
+    {
+        FileHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+        header.version = FILE_VERSION;
+        header.mesh_count = static_cast<uint32_t>(scene.meshes.size());
+        header.instance_count = static_cast<uint32_t>(scene.instances.size());
+
+        header.meshes_offset = sizeof(FileHeader);
+        header.instances_offset = align(header.meshes_offset + scene.meshes.size() * sizeof(MeshRecord));
+
+        uint64_t offset = align(header.instances_offset + scene.instances.size() * sizeof(InstanceRecord));
+
+        std::vector<MeshRecord> records(scene.meshes.size());
+
+        for (size_t i = 0; i < scene.meshes.size(); i++)
+        {
+            const auto& mesh = scene.meshes[i];
+            MeshRecord& record = records[i];
+
+            std::memset(&record, 0, sizeof(record));
+            record.vertex_count = static_cast<uint32_t>(mesh.vertices.size() / 3);
+            record.index_size = mesh.index_size;
+            record.index_count = mesh.index_size == 0 ? 0 :
+                static_cast<uint32_t>(mesh.indices.size() / mesh.index_size);
+            record.material = mesh.material;
+
+            for (int a = 0; a < 3; a++)
+            {
+                record.bounds_min[a] = std::numeric_limits<float>::max();
+                record.bounds_max[a] = -std::numeric_limits<float>::max();
+            }
+
+            for (size_t v = 0; v + 2 < mesh.vertices.size(); v += 3)
+            {
+                for (int a = 0; a < 3; a++)
+                {
+                    record.bounds_min[a] = std::min(record.bounds_min[a], mesh.vertices[v + a]);
+                    record.bounds_max[a] = std::max(record.bounds_max[a], mesh.vertices[v + a]);
+                }
+            }
+
+            record.vertex_offset = offset;
+            offset = align(offset + mesh.vertices.size() * sizeof(float));
+
+            record.index_offset = offset;
+            offset = align(offset + mesh.indices.size());
+        }
+
+        header.file_size = offset;
+
+        std::error_code error;
+        const std::filesystem::path target(path);
+
+        if (target.has_parent_path())
+            std::filesystem::create_directories(target.parent_path(), error);
+
+        const std::string temporary = path + ".tmp";
+
+        {
+            std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+
+            const char padding[BLOB_ALIGNMENT] = {};
+            uint64_t written = 0;
+
+            auto write = [&](const uint64_t at, const void* data, const uint64_t size)
+            {
+                file.write(padding, static_cast<std::streamsize>(at - written));
+                file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+                written = at + size;
+            };
+
+            write(0, &header, sizeof(header));
+            write(header.meshes_offset, records.data(), records.size() * sizeof(MeshRecord));
+            write(header.instances_offset, scene.instances.data(), scene.instances.size() * sizeof(InstanceRecord));
+
+            for (size_t i = 0; i < scene.meshes.size(); i++)
+            {
+                const auto& mesh = scene.meshes[i];
+
+                write(records[i].vertex_offset, mesh.vertices.data(), mesh.vertices.size() * sizeof(float));
+                write(records[i].index_offset, mesh.indices.data(), mesh.indices.size());
+            }
+
+            write(header.file_size, nullptr, 0);
+
+            if (!file)
+            {
+                std::cout << "Failed to write scene: " << temporary << std::endl;
+                return false;
+            }
+        }
+
+        std::filesystem::rename(temporary, target, error);
+        return !error;
+    }
+
+    static std::unique_ptr<SceneFile> map_scene(
+        const std::string& path)
+    {
+        if (!std::filesystem::exists(path))
+            return nullptr;
+
+        auto mapping = std::make_unique<MappedFile>(path);
+
+        const uint64_t length = mapping->Length();
+        const uint8_t* base = static_cast<const uint8_t*>(mapping->Data());
+        const FileHeader* header = reinterpret_cast<const FileHeader*>(base);
+
+        if (length < sizeof(FileHeader) ||
+            std::memcmp(header->magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0 ||
+            header->version != FILE_VERSION ||
+            header->file_size != length ||
+            header->meshes_offset % alignof(MeshRecord) != 0 ||
+            header->instances_offset % alignof(InstanceRecord) != 0 ||
+            !within(length, header->meshes_offset, header->mesh_count, sizeof(MeshRecord)) ||
+            !within(length, header->instances_offset, header->instance_count, sizeof(InstanceRecord)))
+        {
+            std::cout << "Invalid or stale scene: " << path << std::endl;
+            return nullptr;
+        }
+
+        const MeshRecord* meshes = reinterpret_cast<const MeshRecord*>(base + header->meshes_offset);
+
+        for (uint32_t i = 0; i < header->mesh_count; i++)
+        {
+            const MeshRecord& mesh = meshes[i];
+
+            const bool indexed = mesh.index_size != 0;
+            const uint32_t primitive_vertices = indexed ? mesh.index_count : mesh.vertex_count;
+
+            if ((mesh.index_size != 0 && mesh.index_size != 2 && mesh.index_size != 4) ||
+                primitive_vertices % 3 != 0 ||
+                mesh.vertex_offset % alignof(float) != 0 ||
+                mesh.index_offset % std::max<uint32_t>(mesh.index_size, 1) != 0 ||
+                mesh.material >= MATERIAL_COUNT ||
+                !within(length, mesh.vertex_offset, mesh.vertex_count, 3 * sizeof(float)) ||
+                (indexed && !within(length, mesh.index_offset, mesh.index_count, mesh.index_size)))
+            {
+                std::cout << "Invalid scene mesh " << i << ": " << path << std::endl;
+                return nullptr;
+            }
+        }
+
+        return std::make_unique<SceneFile>(
+            std::move(mapping),
+            header->mesh_count,
+            header->instance_count,
+            header->meshes_offset,
+            header->instances_offset);
+    }
+
+    std::unique_ptr<SceneFile> map(
+        const std::string& path)
+    {
+        try
+        {
+            return map_scene(path);
+        }
+        catch (const std::exception&)
+        {
+            return nullptr;
+        }
+    }
+
+    SceneBuilder floor_scene()
+    {
+        SceneBuilder scene;
+
+        Entity entity;
+        entity.scale = glm::vec3(1000, 1000, 1000);
+        entity.position = glm::vec3(0, 0, 2);
+        entity.instance_id = FLOOR_MATERIAL;
+        entity.mesh = scene.AddMesh(
+            Meshes::quad_vtx,
+            std::size(Meshes::quad_vtx),
+            static_cast<const uint16_t*>(nullptr),
+            0,
+            FLOOR_MATERIAL);
+        scene.AddInstance(entity);
+
+        return scene;
+    }
+
+    SceneBuilder default_scene()
+    {
+        SceneBuilder scene = floor_scene();
+
+        const uint32_t cube = scene.AddMesh(
+            Meshes::cube_vtx,
+            std::size(Meshes::cube_vtx),
+            reinterpret_cast<const uint16_t*>(Meshes::cube_idx),
+            std::size(Meshes::cube_idx),
+            CUBE_MATERIAL);
+
+        Entity entity;
+        entity.scale = glm::vec3(0.5, 0.5, 0.5);
+        entity.position = glm::vec3(-1.5, 2, 2);
+        entity.instance_id = CUBE_MATERIAL;
+        entity.mesh = cube;
+        scene.AddInstance(entity);
+
+        entity.position = glm::vec3(2, 2, 2);
+        scene.AddInstance(entity);
+
+        return scene;
+    }
+
+    std::unique_ptr<SceneFile> load_default(
+        const std::string& cache_directory)
+    {
+        const std::string path = (std::filesystem::path(cache_directory) / DEFAULT_SCENE_FILE).string();
+
+        if (auto scene = map(path))
+            return scene;
+
+        if (!store(path, default_scene()))
+            return nullptr;
+
+        return map(path);
+    }
+}
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+#include "Meshes.hpp"
+#include "Entities.hpp"
+#include "MappedFile.hpp"
+
+namespace Scenes
+{
+    // Bump whenever a record or the layout of the file changes.
+    constexpr uint32_t FILE_VERSION = 3;
+
+    constexpr uint32_t NO_PARENT = UINT32_MAX;
+
+    // The InstanceIDs the hit shaders switch on, a material is its hit
+    // shader. CUBE_MATERIAL looks its normals up by the triangle order of
+    // Meshes::cube and is for the built-in cube only, MIRROR_MATERIAL and
+    // DIFFUSE_MATERIAL use the normal of the triangle hit on any mesh.
+    constexpr uint32_t FLOOR_MATERIAL = 0;
+    constexpr uint32_t CUBE_MATERIAL = 1;
+    constexpr uint32_t MIRROR_MATERIAL = 2;
+    constexpr uint32_t DIFFUSE_MATERIAL = 3;
+    constexpr uint32_t MATERIAL_COUNT = 4;
+
+    // Blobs start on this boundary in the file, and so in the mapping.
+    constexpr uint64_t BLOB_ALIGNMENT = 64;
+
+    // Offsets are from the start of the file. Vertices are packed float3
+    // positions, indices uint16 or uint32 per index_size.
+    struct MeshRecord
+    {
+        uint64_t vertex_offset;
+        uint64_t index_offset;
+        uint32_t vertex_count;
+        uint32_t index_count;
+        uint32_t index_size;
+        uint32_t material;
+        float bounds_min[3];
+        float bounds_max[3];
+    };
+
+    // Transform relative to parent, an earlier instance or NO_PARENT.
+    // material becomes the InstanceID the hit shaders switch on.
+    struct InstanceRecord
+    {
+        float position[3];
+        float orientation[4];
+        float scale[3];
+        uint32_t mesh;
+        uint32_t material;
+        uint32_t parent;
+    };
+
+    // A scene in memory, written out by store.
+    class SceneBuilder
+    {
+    private:
+        struct Mesh
+        {
+            std::vector<float> vertices;
+            std::vector<uint8_t> indices;
+            uint32_t index_size = 0;
+            uint32_t material = 0;
+        };
+
+        std::vector<Mesh> meshes;
+        std::vector<InstanceRecord> instances;
+
+        friend bool store(
+            const std::string& path,
+            const SceneBuilder& scene);
+
+    public:
+        // vertex_floats / 3 positions, a triangle list when indices is
+        // null. Returns the mesh index.
+        uint32_t AddMesh(
+            const float* vertices,
+            const size_t vertex_floats,
+            const uint16_t* indices,
+            const size_t index_count,
+            const uint32_t material);
+
+        uint32_t AddMesh(
+            const float* vertices,
+            const size_t vertex_floats,
+            const uint32_t* indices,
+            const size_t index_count,
+            const uint32_t material);
+
+        // With the narrowest indices that hold mesh.
+        uint32_t AddMesh(
+            const Meshes::Mesh& mesh,
+            const uint32_t material);
+
+        // entity.mesh and entity.instance_id, as the material, select the
+        // records. Returns the instance index.
+        uint32_t AddInstance(
+            const Entity& entity,
+            const uint32_t parent = NO_PARENT);
+
+        size_t MeshCount() const;
+        size_t InstanceCount() const;
+    };
+
+    // A scene file mapped read only. Every accessor points into the
+    // mapping, opening one validates the header and the mesh table and
+    // touches nothing else, so the cost does not grow with the blobs.
+    class SceneFile
+    {
+    private:
+        std::unique_ptr<MappedFile> mapping;
+        const uint8_t* base = nullptr;
+
+        const MeshRecord* meshes = nullptr;
+        const InstanceRecord* instances = nullptr;
+
+        uint32_t mesh_count = 0;
+        uint32_t instance_count = 0;
+
+    public:
+        SceneFile(
+            std::unique_ptr<MappedFile>&& mapping,
+            const uint32_t mesh_count,
+            const uint32_t instance_count,
+            const uint64_t meshes_offset,
+            const uint64_t instances_offset);
+
+        uint32_t MeshCount() const { return mesh_count; }
+        uint32_t InstanceCount() const { return instance_count; }
+
+        const MeshRecord& Mesh(const uint32_t index) const { return meshes[index]; }
+        const InstanceRecord& Instance(const uint32_t index) const { return instances[index]; }
+
+        const float* Vertices(const uint32_t mesh) const;
+
+        // Null for a triangle list, else index_size bytes per index.
+        const void* Indices(const uint32_t mesh) const;
+
+        size_t Size() const;
+
+        // Adds every instance to entities, keeping the hierarchy. False,
+        // with nothing added, when an instance names a missing mesh, a
+        // material past MATERIAL_COUNT or a parent that does not precede it.
+        bool Instantiate(EntityStore& entities) const;
+    };
+
+    // Writes scene to path, aside and renamed so readers never map a
+    // partial file.
+    bool store(
+        const std::string& path,
+        const SceneBuilder& scene);
+
+    // Maps the scene at path, nullptr when it is missing, malformed or of
+    // another version.
+    std::unique_ptr<SceneFile> map(
+        const std::string& path);
+
+    // An instance of the quad floor, the start of every scene the demo
+    // builds.
+    SceneBuilder floor_scene();
+
+    // floor_scene and the two cubes of the demo.
+    SceneBuilder default_scene();
+
+    // Maps the default scene from cache_directory, writing it first when
+    // it is missing or stale.
+    std::unique_ptr<SceneFile> load_default(
+        const std::string& cache_directory);
+}
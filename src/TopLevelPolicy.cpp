@@ -0,0 +1,48 @@
+#include "TopLevelPolicy.hpp"
+
+#include <algorithm>
+
+TopLevelPolicy::TopLevelPolicy(
+    const float rebuild_fraction) :
+    rebuild_fraction(rebuild_fraction)
+{
+}
+
+uint32_t TopLevelPolicy::Grow(const uint32_t slot_count) const
+{
+    uint32_t grown = std::max(capacity, MIN_CAPACITY);
+
+    while (grown < slot_count)
+    {
+        grown = grown > UINT32_MAX / GROWTH_FACTOR ?
+            slot_count : grown * GROWTH_FACTOR;
+    }
+
+    return grown;
+}
+
+TopLevelAction TopLevelPolicy::Next(
+    const uint32_t slot_count,
+    const uint32_t live_count,
+    const uint32_t changed_count)
+{
+    if (capacity == 0 || slot_count > capacity)
+    {
+        capacity = Grow(slot_count);
+        updates = 0;
+        return TopLevelAction::Reallocate;
+    }
+
+    if (changed_count == 0)
+        return TopLevelAction::None;
+
+    if (changed_count > live_count * rebuild_fraction ||
+        updates >= MAX_UPDATES)
+    {
+        updates = 0;
+        return TopLevelAction::Rebuild;
+    }
+
+    updates++;
+    return TopLevelAction::Update;
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+
+// What a top level structure does with this frame's entity changes.
+enum class TopLevelAction
+{
+    // Nothing changed, last frame's structure holds.
+    None,
+    // Rewrite the changed instances and refit in place.
+    Update,
+    // Rewrite the changed instances and build again, same buffers.
+    Rebuild,
+    // The slots outgrew the instance buffer, allocate Capacity() and
+    // build from scratch.
+    Reallocate
+};
+
+// Bookkeeping both top level structures share, free of any device so it
+// runs anywhere. Instance buffers are sized to Capacity(), which grows
+// geometrically past the slot count so adding entities one at a time
+// reallocates O(log n) times. Every slot up to Capacity() stays in the
+// tree, a dead one as an instance that cannot be hit, so a slot coming or
+// going is one more changed instance and only outgrowing the buffer forces
+// a build. Changing more than rebuild_fraction of the live instances also
+// rebuilds, where a refit would loosen the tree more than a build costs,
+// and after MAX_UPDATES refits in a row a rebuild restores the tree
+// whatever moved.
+class TopLevelPolicy
+{
+public:
+    static constexpr uint32_t MIN_CAPACITY = 64;
+    static constexpr uint32_t GROWTH_FACTOR = 2;
+    static constexpr float REBUILD_FRACTION = 0.25f;
+    static constexpr uint32_t MAX_UPDATES = 256;
+
+private:
+    float rebuild_fraction;
+    uint32_t capacity = 0;
+    uint32_t updates = 0;
+
+public:
+    explicit TopLevelPolicy(
+        const float rebuild_fraction = REBUILD_FRACTION);
+
+    // The capacity for slot_count slots, at least MIN_CAPACITY and at
+    // least GROWTH_FACTOR times the current one when it must grow.
+    uint32_t Grow(const uint32_t slot_count) const;
+
+    // The action for a frame with slot_count slots, live_count of them
+    // live and changed_count changed, added and removed slots included,
+    // counting it as taken.
+    TopLevelAction Next(
+        const uint32_t slot_count,
+        const uint32_t live_count,
+        const uint32_t changed_count);
+
+    uint32_t Capacity() const
+    {
+        return capacity;
+    }
+
+    // Refits since the last build.
+    uint32_t Updates() const
+    {
+        return updates;
+    }
+};
@@ -0,0 +1,42 @@
+#include "UpdateStage.hpp"
+
+UpdateStage::UpdateStage(
+    cpu::Scheduler& scheduler) :
+    scheduler(scheduler)
+{
+}
+
+void UpdateStage::Run(
+    Properties::Engine& engine,
+    Animator& animator,
+    EntityStore& entities,
+    const float time_step)
+{
+    auto start = timer_start();
+
+    engine.Advance(time_step, scheduler);
+    timings.properties = timer_end(start);
+
+    auto compaction_start = timer_start();
+    engine.Compact();
+    timings.compaction = timer_end(compaction_start);
+
+    auto entities_start = timer_start();
+    animator.Update(entities, time_step, scheduler);
+    timings.entities = timer_end(entities_start);
+
+    auto hierarchy_start = timer_start();
+    entities.Propagate(scheduler);
+    timings.hierarchy = timer_end(hierarchy_start);
+
+    auto callbacks_start = timer_start();
+    engine.DispatchEvents();
+    timings.callbacks = timer_end(callbacks_start);
+
+    timings.total = timer_end(start);
+}
+
+const UpdateTimings& UpdateStage::Timings() const
+{
+    return timings;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Entities.hpp"
+#include "Animation.hpp"
+#include "cpu/Scheduler.hpp"
+#include "properties/Engine.hpp"
+
+// Times in ms of the last UpdateStage::Run.
+struct UpdateTimings
+{
+    float properties = 0.0f;
+    float compaction = 0.0f;
+    float entities = 0.0f;
+    float hierarchy = 0.0f;
+    float callbacks = 0.0f;
+    float total = 0.0f;
+};
+
+// The per frame animation update ahead of rendering. Property tweens and
+// entity tracks are split into chunks on the scheduler's workers, then
+// world transforms propagate one hierarchy level at a time, each stage
+// ending in the ParallelFor barrier, so every entity is final when Run
+// returns and the renderer uploads instances. Completion callbacks run
+// last, on the calling thread.
+class UpdateStage
+{
+private:
+    cpu::Scheduler& scheduler;
+    UpdateTimings timings;
+
+public:
+    explicit UpdateStage(
+        cpu::Scheduler& scheduler);
+
+    UpdateStage(const UpdateStage&) = delete;
+
+    void Run(
+        Properties::Engine& engine,
+        Animator& animator,
+        EntityStore& entities,
+        const float time_step);
+
+    const UpdateTimings& Timings() const;
+};
@@ -0,0 +1,1924 @@
+#include "Benchmarks.hpp"
+
+#include "../Noise.hpp"
+#include "../NoiseCache.hpp"
+#include "../math/Transform.hpp"
+#include "../Meshes.hpp"
+#include "../SceneFile.hpp"
+#include "../Import.hpp"
+#include "../Generator.hpp"
+#include "../Animation.hpp"
+#include "../NoiseStream.hpp"
+#include "../UpdateStage.hpp"
+#include "../OwenSobol.hpp"
+#include "../properties/Engine.hpp"
+#include "../properties/Interpolate.hpp"
+#include "../properties/Property.hpp"
+#include "../cpu/raytracing/TopStructure.hpp"
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <numeric>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <filesystem>
+
+// Scratch space for the files the benchmarks write and delete, away from
+// the cache directory the renderer keeps its noise and scenes in.
+static std::string benchmark_directory()
+{
+    std::error_code error;
+    const std::filesystem::path directory =
+        std::filesystem::temp_directory_path(error) / "rayproj_benchmarks";
+
+    std::filesystem::create_directories(directory, error);
+    return directory.string();
+}
+
+static bool cpu_benchmark_noise_generate(
+    cpu::Scheduler& scheduler)
+{
+    using Texels = std::unique_ptr<std::vector<TexDataByteRGBA>>;
+
+    bool passed = true;
+
+    // tools/NoisePack.cpp checks the output against the original samplers.
+    for (uint16_t spp = 1; spp <= 256; spp *= 2)
+    {
+        const size_t size = static_cast<size_t>(Noise::TEXTURE_DIM) * Noise::TEXTURE_DIM * spp;
+
+        Texels serial = std::make_unique<std::vector<TexDataByteRGBA>>(size);
+        Texels parallel = std::make_unique<std::vector<TexDataByteRGBA>>(size);
+
+        auto serial_start = timer_start();
+        for (uint16_t i = 0; i < spp; i++)
+        {
+            Noise::generate(serial, i, spp);
+        }
+        const float serial_time = timer_end(serial_start);
+
+        auto parallel_start = timer_start();
+        Noise::generate_all(parallel, spp, scheduler);
+        const float parallel_time = timer_end(parallel_start);
+
+        const bool exact = std::memcmp(
+            serial->data(), parallel->data(), size * sizeof(TexDataByteRGBA)) == 0;
+
+        std::cout << "noise: " << spp << " spp, per slice " << serial_time
+                  << " ms, parallel " << parallel_time << " ms"
+                  << (exact ? "" : ", MISMATCH") << std::endl;
+
+        passed &= exact;
+    }
+
+    return passed;
+}
+
+static bool cpu_benchmark_noise(
+    cpu::Scheduler& scheduler)
+{
+    bool passed = cpu_benchmark_noise_generate(scheduler);
+
+    const std::string directory = benchmark_directory();
+    const uint16_t samples = 16;
+    const uint16_t bounces = 4;
+
+    std::error_code error;
+    std::filesystem::remove(Noise::cache_path(directory, samples, bounces), error);
+
+    // Touch every texel so the mapped load pays for its page faults.
+    auto checksum = [](const Noise::Texture& texture)
+    {
+        uint32_t sum = 0;
+        for (size_t i = 0; i < texture.Size(); i++)
+        {
+            sum += texture.Data()[i].r + texture.Data()[i].a;
+        }
+        return sum;
+    };
+
+    auto cold_start = timer_start();
+    const auto cold = Noise::load(directory, samples, bounces, scheduler);
+    const uint32_t cold_sum = checksum(*cold);
+    const float cold_time = timer_end(cold_start);
+
+    auto warm_start = timer_start();
+    const auto warm = Noise::load(directory, samples, bounces, scheduler);
+    const uint32_t warm_sum = checksum(*warm);
+    const float warm_time = timer_end(warm_start);
+
+    std::cout << "noise: " << samples << "x" << bounces << " slices, generate "
+              << cold_time << " ms, cached " << warm_time << " ms"
+              << (warm->Mapped() ? " (mapped)" : " (not mapped)")
+              << (cold_sum == warm_sum ? "" : ", MISMATCH") << std::endl;
+
+    passed &= cold_sum == warm_sum;
+
+    std::filesystem::remove(Noise::cache_path(directory, samples, bounces), error);
+
+    const size_t slice_texels = static_cast<size_t>(Noise::TEXTURE_DIM) * Noise::TEXTURE_DIM;
+    bool exact = true;
+
+    size_t first_bytes = 0;
+    float first_time = 0.0f;
+
+    {
+        auto stream_start = timer_start();
+        Noise::Stream stream(directory, samples, bounces);
+        const TexDataByteRGBA* first = stream.Slice(0);
+        first_time = timer_end(stream_start);
+        first_bytes = stream.ResidentBytes();
+
+        exact &= std::memcmp(first, warm->Data(), slice_texels * sizeof(TexDataByteRGBA)) == 0;
+
+        for (uint32_t i = 1; i < stream.SliceCount(); i++)
+        {
+            exact &= std::memcmp(
+                stream.Slice(i),
+                warm->Data() + i * slice_texels,
+                slice_texels * sizeof(TexDataByteRGBA)) == 0;
+        }
+    }
+
+    // The stream writes the cache once its last slice is resident.
+    const auto streamed = Noise::map(directory, samples, bounces);
+
+    std::cout << "noise: streamed first slice " << first_time << " ms, "
+              << first_bytes / 1024 << " KiB resident of "
+              << warm->Size() * sizeof(TexDataByteRGBA) / 1024 << " KiB"
+              << (streamed ? ", cache written" : ", cache not written")
+              << (exact ? "" : ", MISMATCH") << std::endl;
+
+    std::filesystem::remove(Noise::cache_path(directory, samples, bounces), error);
+
+    return passed && exact && streamed;
+}
+
+// Per pixel RMSE over the 128x128 tile of integrating a quarter disc and a
+// Gaussian over the unit square with spp points from dimensions 0 and 1.
+template<typename Sample>
+static void cpu_benchmark_sampler_quality(
+    const char* name,
+    const uint32_t spp,
+    const Sample& sample)
+{
+    const double disc_reference = 0.785398163397448;
+    const double gaussian_reference = 0.557746285351034;
+
+    double disc_error = 0.0;
+    double gaussian_error = 0.0;
+
+    for (uint32_t y = 0; y < Noise::TEXTURE_DIM; y++)
+    {
+        for (uint32_t x = 0; x < Noise::TEXTURE_DIM; x++)
+        {
+            double disc = 0.0;
+            double gaussian = 0.0;
+
+            for (uint32_t i = 0; i < spp; i++)
+            {
+                const double u = sample(x, y, i, 0);
+                const double v = sample(x, y, i, 1);
+                const double r2 = u * u + v * v;
+
+                disc += r2 < 1.0 ? 1.0 : 0.0;
+                gaussian += std::exp(-r2);
+            }
+
+            disc_error += std::pow(disc / spp - disc_reference, 2.0);
+            gaussian_error += std::pow(gaussian / spp - gaussian_reference, 2.0);
+        }
+    }
+
+    const double pixels = static_cast<double>(Noise::TEXTURE_DIM) * Noise::TEXTURE_DIM;
+
+    std::cout << "sampler: " << name << ", " << spp << " spp, disc rmse "
+              << std::sqrt(disc_error / pixels) << ", gaussian rmse "
+              << std::sqrt(gaussian_error / pixels) << std::endl;
+}
+
+static void cpu_benchmark_sampler()
+{
+    using Texels = std::unique_ptr<std::vector<TexDataByteRGBA>>;
+
+    const uint16_t spp = 256;
+    const size_t size = static_cast<size_t>(Noise::TEXTURE_DIM) * Noise::TEXTURE_DIM * spp;
+
+    Texels texels = std::make_unique<std::vector<TexDataByteRGBA>>(size);
+    cpu::Scheduler scheduler(1);
+
+    auto table_start = timer_start();
+    Noise::generate_all(texels, spp, scheduler, Noise::Sampler::BlueNoise);
+    const float table_time = timer_end(table_start);
+
+    auto owen_start = timer_start();
+    Noise::generate_all(texels, spp, scheduler, Noise::Sampler::OwenSobol);
+    const float owen_time = timer_end(owen_start);
+
+    std::cout << "sampler: " << spp << " slices on one thread, blue noise "
+              << size / (table_time * 1000.0f) << " Mtexels/s, owen sobol "
+              << size / (owen_time * 1000.0f) << " Mtexels/s" << std::endl;
+
+    auto blue_noise = [](uint32_t x, uint32_t y, uint32_t i, uint32_t d)
+    {
+        return Noise::blue_noise(x, y, i, d, spp);
+    };
+
+    auto owen_sobol = [](uint32_t x, uint32_t y, uint32_t i, uint32_t d)
+    {
+        return Noise::owen_sobol(x, y, i, d);
+    };
+
+    for (uint32_t samples = 1; samples <= 256; samples *= 4)
+    {
+        auto table = [samples](uint32_t x, uint32_t y, uint32_t i, uint32_t d)
+        {
+            return Noise::blue_noise(x, y, i, d, static_cast<uint16_t>(samples));
+        };
+
+        cpu_benchmark_sampler_quality("blue noise", samples, table);
+        cpu_benchmark_sampler_quality("owen sobol", samples, owen_sobol);
+    }
+
+    // The tables wrap at 256 samples, the runtime sampler keeps converging.
+    cpu_benchmark_sampler_quality("blue noise", 1024, blue_noise);
+    cpu_benchmark_sampler_quality("owen sobol", 1024, owen_sobol);
+    cpu_benchmark_sampler_quality("owen sobol", 4096, owen_sobol);
+}
+
+static bool cpu_benchmark_properties()
+{
+    const uint32_t frames = 60;
+    const float time_step = 1.0f / 60.0f;
+
+    bool passed = true;
+
+    for (uint32_t count = 1000; count <= 100000; count *= 10)
+    {
+        // Long enough that nothing completes, both sides do the same work.
+        auto duration = [](uint32_t i) { return 10.0f + (i % 7); };
+        auto easing = [&](uint32_t i) { return static_cast<Properties::EasingFunction>(i % Properties::EASING_COUNT); };
+
+        Properties::Manager manager;
+        std::vector<std::unique_ptr<Properties::Property<float>>> properties(count);
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            properties[i] = std::make_unique<Properties::Property<float>>(0.0f);
+            properties[i]->Animate(manager, 0.0f, 1.0f, duration(i), easing(i), []() {});
+        }
+
+        auto manager_start = timer_start();
+        for (uint32_t f = 0; f < frames; f++)
+        {
+            manager.Update(time_step);
+        }
+        const float manager_time = timer_end(manager_start);
+
+        Properties::Engine engine;
+        std::vector<float> values(count);
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            engine.Animate(&values[i], 0.0f, 1.0f, duration(i), easing(i), []() {});
+        }
+
+        auto engine_start = timer_start();
+        for (uint32_t f = 0; f < frames; f++)
+        {
+            engine.Update(time_step);
+        }
+        const float engine_time = timer_end(engine_start);
+
+        // The engine eases in batches with fused multiply adds.
+        bool exact = true;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            exact &= std::abs(properties[i]->Value() - values[i]) <= 1e-6f;
+        }
+
+        const float updates = static_cast<float>(count) * frames;
+
+        std::cout << "properties: " << count << " tweens, manager "
+                  << manager_time * 1e6f / updates << " ns/tween, engine "
+                  << engine_time * 1e6f / updates << " ns/tween"
+                  << (exact ? "" : ", MISMATCH") << std::endl;
+
+        passed &= exact;
+    }
+
+    return passed;
+}
+
+// count short lived tweens finishing over a second, run until every one has
+// completed. Checks each ends on its end value with its callback called
+// exactly once, and the time per tween should not grow with count.
+static bool cpu_benchmark_properties_stress()
+{
+    const uint32_t max_frames = 120;
+    const float time_step = 1.0f / 60.0f;
+
+    bool passed = true;
+
+    auto duration = [](uint32_t i) { return (1 + i % 60) / 60.0f; };
+    auto easing = [&](uint32_t i) { return static_cast<Properties::EasingFunction>(i % Properties::EASING_COUNT); };
+
+    auto report = [&passed](const char* name, uint32_t count, float time, bool valid)
+    {
+        passed &= valid;
+
+        std::cout << "properties: " << name << ", " << count << " short lived tweens, "
+                  << time << " ms, " << time * 1e6f / count << " ns/tween"
+                  << (valid ? "" : ", INVALID") << std::endl;
+    };
+
+    for (uint32_t count = 250000; count <= 1000000; count *= 2)
+    {
+        std::vector<uint8_t> completions(count, 0);
+
+        {
+            Properties::Manager manager;
+            std::vector<std::unique_ptr<Properties::Property<float>>> properties(count);
+
+            for (uint32_t i = 0; i < count; i++)
+            {
+                properties[i] = std::make_unique<Properties::Property<float>>(0.0f);
+                properties[i]->Animate(manager, 0.0f, 1.0f, duration(i), easing(i),
+                    [&completions, i]() { completions[i]++; });
+            }
+
+            auto start = timer_start();
+            for (uint32_t f = 0; f < max_frames && manager.PropertyCount() != 0; f++)
+            {
+                manager.Update(time_step);
+            }
+            const float time = timer_end(start);
+
+            bool valid = manager.PropertyCount() == 0;
+            for (uint32_t i = 0; i < count; i++)
+            {
+                valid &= completions[i] == 1 && properties[i]->Value() == 1.0f &&
+                    properties[i]->InterpolatorCount() == 0;
+            }
+
+            report("manager", count, time, valid);
+        }
+
+        std::fill(completions.begin(), completions.end(), 0);
+
+        {
+            Properties::Engine engine;
+            std::vector<float> values(count, 0.0f);
+
+            for (uint32_t i = 0; i < count; i++)
+            {
+                engine.Animate(&values[i], 0.0f, 1.0f, duration(i), easing(i),
+                    [&completions, i]() { completions[i]++; });
+            }
+
+            auto start = timer_start();
+            for (uint32_t f = 0; f < max_frames && engine.TweenCount() != 0; f++)
+            {
+                engine.Update(time_step);
+            }
+            const float time = timer_end(start);
+
+            bool valid = engine.TweenCount() == 0;
+            for (uint32_t i = 0; i < count; i++)
+            {
+                valid &= completions[i] == 1 && values[i] == 1.0f;
+            }
+
+            report("engine", count, time, valid);
+        }
+    }
+
+    return passed;
+}
+
+// Scalar Ease and Interpolate per value against the batch versions.
+static void cpu_benchmark_easing()
+{
+    const size_t count = 1 << 20;
+    const uint32_t repeats = 8;
+
+    std::mt19937 random(1);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::uniform_real_distribution<float> range(-10.0f, 10.0f);
+
+    // Each repeat reads t from the next offset so no pass can be skipped.
+    std::vector<float> t(count + repeats);
+    for (float& value : t)
+    {
+        value = unit(random);
+    }
+
+    std::vector<float> scalar(count);
+    std::vector<float> batch(count);
+
+    auto report = [&](const std::string& name, uint32_t passes, float scalar_time, float batch_time, float error)
+    {
+        const float evaluations = static_cast<float>(count) * passes;
+
+        std::cout << "easing: " << name << ", scalar "
+                  << evaluations / (scalar_time * 1000.0f) << " M/s, batch "
+                  << evaluations / (batch_time * 1000.0f) << " M/s, "
+                  << scalar_time / batch_time << "x, max error " << error << std::endl;
+    };
+
+    for (size_t f = 0; f < Properties::EASING_COUNT; f++)
+    {
+        const auto func = static_cast<Properties::EasingFunction>(f);
+
+        auto scalar_start = timer_start();
+        for (uint32_t r = 0; r < repeats; r++)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                scalar[i] = Properties::Ease(func, t[i + r]);
+            }
+        }
+        const float scalar_time = timer_end(scalar_start);
+
+        auto batch_start = timer_start();
+        for (uint32_t r = 0; r < repeats; r++)
+        {
+            Properties::Ease(func, t.data() + r, batch.data(), count);
+        }
+        const float batch_time = timer_end(batch_start);
+
+        float error = 0.0f;
+        for (size_t i = 0; i < count; i++)
+        {
+            error = std::max(error, std::abs(scalar[i] - batch[i]));
+        }
+
+        report("ease " + std::to_string(f), repeats, scalar_time, batch_time, error);
+    }
+
+    // One pass of scalar and batch interpolation of one type, repeating
+    // lets the compiler interchange the scalar loops and skip passes.
+    auto compare = [&](const std::string& name, const auto& origin, const auto& target, auto& scalar_values, auto& batch_values, const auto& error)
+    {
+        auto scalar_start = timer_start();
+        for (size_t i = 0; i < count; i++)
+        {
+            scalar_values[i] = Properties::Interpolate(origin[i], target[i], t[i]);
+        }
+        const float scalar_time = timer_end(scalar_start);
+
+        auto batch_start = timer_start();
+        Properties::Interpolate(origin.data(), target.data(), t.data(), batch_values.data(), count);
+        const float batch_time = timer_end(batch_start);
+
+        float max_error = 0.0f;
+        for (size_t i = 0; i < count; i++)
+        {
+            max_error = std::max(max_error, error(scalar_values[i], batch_values[i]));
+        }
+
+        report(name, 1, scalar_time, batch_time, max_error);
+    };
+
+    {
+        std::vector<float> origin(count), target(count), scalar_values(count), batch_values(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            origin[i] = range(random);
+            target[i] = range(random);
+        }
+
+        compare("interpolate float", origin, target, scalar_values, batch_values,
+            [](const float a, const float b) { return std::abs(a - b); });
+    }
+
+    {
+        std::vector<glm::vec3> origin(count), target(count), scalar_values(count), batch_values(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            origin[i] = glm::vec3(range(random), range(random), range(random));
+            target[i] = glm::vec3(range(random), range(random), range(random));
+        }
+
+        compare("interpolate vec3", origin, target, scalar_values, batch_values,
+            [](const glm::vec3& a, const glm::vec3& b) { return glm::length(a - b); });
+    }
+
+    // Rotation angle between the scalar slerp and the batch result, from the
+    // chord between the quaternions, acos of a dot near 1 is all rounding.
+    auto angle = [](const glm::quat& a, const glm::quat& b)
+    {
+        const float sign = glm::dot(a, b) < 0.0f ? -1.0f : 1.0f;
+        const glm::vec4 chord(a.x - sign * b.x, a.y - sign * b.y, a.z - sign * b.z, a.w - sign * b.w);
+        return 4.0f * std::asin(std::min(glm::length(chord) * 0.5f, 1.0f));
+    };
+
+    auto random_rotation = [&]()
+    {
+        return glm::normalize(glm::quat(range(random), range(random), range(random), range(random)));
+    };
+
+    for (const float spread : { 0.2f, 3.0f })
+    {
+        // Targets within spread radians of the origin, a typical per tween
+        // step, or anywhere which mostly takes the slerp fallback.
+        std::vector<glm::quat> origin(count), target(count), scalar_values(count), batch_values(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            origin[i] = random_rotation();
+            const glm::vec3 axis = glm::normalize(glm::vec3(range(random), range(random), range(random)));
+            target[i] = glm::angleAxis(spread * unit(random), axis) * origin[i];
+        }
+
+        compare("interpolate quat within " + std::to_string(spread) + " rad",
+            origin, target, scalar_values, batch_values, angle);
+    }
+}
+
+// Entities with a Hermite position and a linear orientation track each,
+// played forward at frame rate then scrubbed to random times.
+static bool cpu_benchmark_tracks()
+{
+    bool passed = true;
+
+    const uint32_t keys = 32;
+    const uint32_t frames = 600;
+
+    std::mt19937 random(1);
+    std::uniform_real_distribution<float> range(-10.0f, 10.0f);
+    std::uniform_real_distribution<float> spacing(0.1f, 0.5f);
+
+    for (uint32_t count = 1000; count <= 100000; count *= 10)
+    {
+        EntityStore entities;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            entities.Add(Entity());
+        }
+
+        Animator animator;
+        float duration = 0.0f;
+        bool exact = true;
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            EntityAnimation animation;
+            animation.entity = i;
+            animation.position = Properties::Track<glm::vec3>(Properties::KeyInterpolation::Hermite);
+            animation.orientation = Properties::Track<glm::quat>(Properties::KeyInterpolation::Linear);
+
+            std::vector<std::pair<float, glm::vec3>> samples;
+
+            // Orientation keys turn up to 0.5 radians about random axes.
+            glm::quat orientation = glm::quat(1, 0, 0, 0);
+
+            float time = 0.0f;
+            for (uint32_t k = 0; k < keys; k++)
+            {
+                const glm::vec3 position(range(random), range(random), range(random));
+                const glm::vec3 axis = glm::normalize(glm::vec3(range(random), range(random), range(random)));
+                orientation = glm::normalize(glm::angleAxis(0.05f * std::abs(range(random)), axis) * orientation);
+
+                animation.position.Add(time, position);
+                animation.orientation.Add(time, orientation);
+                samples.emplace_back(time, position);
+
+                time += spacing(random);
+            }
+
+            // Every curve passes through its keys.
+            for (const auto& [key_time, position] : samples)
+            {
+                exact &= animation.position.Sample(key_time) == position;
+            }
+
+            duration = std::max(duration, animation.position.Duration());
+            animator.Add(std::move(animation));
+        }
+
+        animator.Seek(entities, 0.0f);
+
+        auto play_start = timer_start();
+        for (uint32_t f = 0; f < frames; f++)
+        {
+            animator.Update(entities, 1.0f / 60.0f);
+        }
+        const float play_time = timer_end(play_start);
+
+        std::uniform_real_distribution<float> seek(0.0f, duration);
+
+        auto scrub_start = timer_start();
+        for (uint32_t f = 0; f < frames; f++)
+        {
+            animator.Seek(entities, seek(random));
+        }
+        const float scrub_time = timer_end(scrub_start);
+
+        const float samples = static_cast<float>(count) * frames;
+
+        std::cout << "tracks: " << count << " entities, " << keys << " keys, play "
+                  << play_time * 1e6f / samples << " ns/entity, scrub "
+                  << scrub_time * 1e6f / samples << " ns/entity"
+                  << (exact ? "" : ", MISMATCH") << std::endl;
+
+        passed &= exact;
+    }
+
+    return passed;
+}
+
+// count entities on four key position and orientation tracks, each with a
+// float tween that restarts from its callback. Runs the update stage on
+// scheduler and, up to 100k, the serial path on a copy of the
+// same scene to check the results match.
+static bool cpu_benchmark_update(
+    cpu::Scheduler& scheduler)
+{
+    bool passed = true;
+
+    const uint32_t frames = 60;
+    const float time_step = 1.0f / 60.0f;
+
+    struct Scene
+    {
+        EntityStore entities;
+        Animator animator;
+        Properties::Engine engine;
+        std::vector<float> values;
+        uint64_t completions = 0;
+    };
+
+    auto build = [](Scene& scene, const uint32_t count)
+    {
+        std::mt19937 random(1);
+        std::uniform_real_distribution<float> range(-10.0f, 10.0f);
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            scene.entities.Add(Entity());
+        }
+
+        scene.values.assign(count, 0.0f);
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            EntityAnimation animation;
+            animation.entity = i;
+            animation.position = Properties::Track<glm::vec3>(Properties::KeyInterpolation::Hermite);
+
+            for (uint32_t k = 0; k < 4; k++)
+            {
+                const glm::vec3 axis = glm::normalize(glm::vec3(range(random), range(random), range(random)));
+                animation.position.Add(k * 0.5f, glm::vec3(range(random), range(random), range(random)));
+                animation.orientation.Add(k * 0.5f, glm::angleAxis(0.1f * k, axis));
+            }
+
+            scene.animator.Add(std::move(animation));
+
+            // Restarts itself from the deferred callback.
+            std::function<void()> restart;
+            const float duration = 0.1f + (i % 30) / 60.0f;
+            const auto easing = static_cast<Properties::EasingFunction>(i % Properties::EASING_COUNT);
+
+            restart = [&scene, i, duration, easing]()
+            {
+                scene.completions++;
+                scene.engine.Animate(&scene.values[i], 0.0f, 1.0f, duration, easing, Properties::Callback());
+            };
+
+            scene.engine.Animate(&scene.values[i], 0.0f, 1.0f, duration, easing, restart);
+        }
+    };
+
+    for (uint32_t count = 10000; count <= 1000000; count *= 10)
+    {
+        auto parallel = std::make_unique<Scene>();
+        build(*parallel, count);
+
+        UpdateStage stage(scheduler);
+        UpdateTimings total;
+
+        for (uint32_t f = 0; f < frames; f++)
+        {
+            stage.Run(parallel->engine, parallel->animator, parallel->entities, time_step);
+
+            total.properties += stage.Timings().properties;
+            total.compaction += stage.Timings().compaction;
+            total.entities += stage.Timings().entities;
+            total.hierarchy += stage.Timings().hierarchy;
+            total.callbacks += stage.Timings().callbacks;
+            total.total += stage.Timings().total;
+        }
+
+        std::cout << "update: " << count << " entities, " << scheduler.ThreadCount() << " threads, "
+                  << total.total / frames << " ms/frame (properties " << total.properties / frames
+                  << ", compaction " << total.compaction / frames
+                  << ", entities " << total.entities / frames
+                  << ", hierarchy " << total.hierarchy / frames
+                  << ", callbacks " << total.callbacks / frames << ")";
+
+        if (count <= 100000)
+        {
+            auto serial = std::make_unique<Scene>();
+            build(*serial, count);
+
+            auto serial_start = timer_start();
+            for (uint32_t f = 0; f < frames; f++)
+            {
+                serial->engine.Update(time_step);
+                serial->animator.Update(serial->entities, time_step);
+                serial->entities.Propagate();
+            }
+            const float serial_time = timer_end(serial_start);
+
+            bool exact = serial->completions == parallel->completions;
+            for (uint32_t i = 0; i < count; i++)
+            {
+                exact &= serial->values[i] == parallel->values[i];
+                exact &= serial->entities.Position(i) == parallel->entities.Position(i);
+                exact &= serial->entities.Orientation(i) == parallel->entities.Orientation(i);
+                exact &= std::memcmp(&serial->entities.World(i), &parallel->entities.World(i), sizeof(Transform3x4)) == 0;
+            }
+
+            std::cout << ", serial " << serial_time / frames << " ms/frame"
+                      << (exact ? "" : ", MISMATCH");
+
+            passed &= exact;
+        }
+
+        std::cout << std::endl;
+    }
+
+    return passed;
+}
+
+// Instance upload of a scattered cube field where moving percent of the
+// entities each frame, against moving all of them, which is what every
+// frame cost before the store tracked changes.
+static bool cpu_benchmark_instances()
+{
+    bool passed = true;
+
+    const uint32_t frames = 30;
+
+    std::vector<std::shared_ptr<cpu::raytracing::BottomStructure>> blas_list;
+    blas_list.push_back(std::make_shared<cpu::raytracing::BottomStructure>(
+        Meshes::cube_vtx,
+        std::size(Meshes::cube_vtx),
+        reinterpret_cast<const uint16_t*>(Meshes::cube_idx),
+        std::size(Meshes::cube_idx)));
+
+    for (uint32_t count = 10000; count <= 1000000; count *= 10)
+    {
+        std::mt19937 random(1);
+        std::uniform_real_distribution<float> range(-1000.0f, 1000.0f);
+        std::uniform_int_distribution<uint32_t> pick(0, count - 1);
+
+        EntityStore entities;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            Entity entity;
+            entity.position = glm::vec3(range(random), range(random), range(random));
+            entities.Add(entity);
+        }
+
+        cpu::raytracing::TopStructure tlas;
+        tlas.Initialize(blas_list, entities);
+
+        std::cout << "instances: " << count << " entities";
+
+        for (const uint32_t percent : { 0u, 5u, 100u })
+        {
+            const uint32_t moved = count / 100 * percent;
+            float time = 0.0f;
+
+            for (uint32_t f = 0; f < frames; f++)
+            {
+                for (uint32_t m = 0; m < moved; m++)
+                {
+                    const uint32_t i = percent == 100 ? m : pick(random);
+                    entities.SetPosition(i, entities.Position(i) + glm::vec3(0.0f, 0.01f, 0.0f));
+                }
+
+                auto start = timer_start();
+                tlas.Update(entities);
+                time += timer_end(start);
+            }
+
+            std::cout << ", " << percent << "% moved " << time / frames << " ms";
+        }
+
+        // A store initialised from scratch must see the same instances.
+        cpu::raytracing::TopStructure reference;
+        reference.Initialize(blas_list, entities);
+
+        bool exact = true;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            exact &= tlas.GetInstance(i).object_to_world == reference.GetInstance(i).object_to_world;
+        }
+
+        std::cout << (exact ? "" : ", MISMATCH") << std::endl;
+
+        passed &= exact;
+    }
+
+    return passed;
+}
+
+// InstanceTransforms against the glm translate, mat4_cast, scale chain the
+// instance upload used before, stored as 3x4 rows the way XMStoreFloat3x4
+// did. The forward rows must match exactly and the inverse must be within
+// inverse_tolerance of the old world_to_object chain.
+static bool cpu_benchmark_transforms()
+{
+    const float inverse_tolerance = 1e-5f;
+
+    bool passed = true;
+
+    for (uint32_t count = 10000; count <= 1000000; count *= 10)
+    {
+        std::mt19937 random(1);
+        std::uniform_real_distribution<float> range(-100.0f, 100.0f);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> size(0.1f, 10.0f);
+
+        std::vector<glm::vec3> positions(count);
+        std::vector<glm::quat> orientations(count);
+        std::vector<glm::vec3> scales(count);
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            positions[i] = glm::vec3(range(random), range(random), range(random));
+            orientations[i] = glm::normalize(glm::quat(unit(random), unit(random), unit(random), unit(random)));
+            scales[i] = glm::vec3(size(random), size(random), size(random));
+        }
+
+        std::vector<Transform3x4> reference(count);
+        std::vector<Transform3x4> reference_inverse(count);
+        std::vector<Transform3x4> batch(count);
+        std::vector<Transform3x4> batch_inverse(count);
+
+        auto to_rows = [](const glm::mat4& transform, Transform3x4& rows)
+        {
+            for (int r = 0; r < 3; r++)
+            {
+                for (int c = 0; c < 4; c++)
+                {
+                    rows.m[r][c] = transform[c][r];
+                }
+            }
+        };
+
+        auto reference_start = timer_start();
+        for (uint32_t i = 0; i < count; i++)
+        {
+            glm::mat4 transform;
+            transform = glm::translate(transform, positions[i]);
+            transform *= mat4_cast(orientations[i]);
+            transform = glm::scale(transform, scales[i]);
+
+            to_rows(transform, reference[i]);
+        }
+        const float reference_time = timer_end(reference_start);
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            glm::mat4 inverse;
+            inverse = glm::scale(inverse, 1.0f / scales[i]);
+            inverse *= mat4_cast(glm::conjugate(orientations[i]));
+            inverse = glm::translate(inverse, -positions[i]);
+
+            to_rows(inverse, reference_inverse[i]);
+        }
+
+        auto batch_start = timer_start();
+        InstanceTransforms(
+            positions.data(), orientations.data(), scales.data(),
+            nullptr, count, batch.data());
+        const float batch_time = timer_end(batch_start);
+
+        auto inverse_start = timer_start();
+        InstanceTransforms(
+            positions.data(), orientations.data(), scales.data(),
+            nullptr, count, batch.data(), batch_inverse.data());
+        const float inverse_time = timer_end(inverse_start);
+
+        // Error relative to the largest element of the row.
+        auto error = [](const Transform3x4& a, const Transform3x4& b)
+        {
+            float worst = 0.0f;
+
+            for (int r = 0; r < 3; r++)
+            {
+                float magnitude = 1.0f;
+                for (int c = 0; c < 4; c++)
+                {
+                    magnitude = std::max(magnitude, std::abs(b.m[r][c]));
+                }
+
+                for (int c = 0; c < 4; c++)
+                {
+                    worst = std::max(worst, std::abs(a.m[r][c] - b.m[r][c]) / magnitude);
+                }
+            }
+
+            return worst;
+        };
+
+        float max_error = 0.0f;
+        float max_inverse_error = 0.0f;
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            max_error = std::max(max_error, error(batch[i], reference[i]));
+            max_inverse_error = std::max(max_inverse_error, error(batch_inverse[i], reference_inverse[i]));
+        }
+
+        // The forward rows repeat the glm chain's arithmetic, the inverse
+        // is built another way round.
+        const bool exact = max_error == 0.0f && max_inverse_error <= inverse_tolerance;
+
+        std::cout << "transforms: " << count << " instances, glm "
+                  << reference_time * 1e6f / count << " ns, batch "
+                  << batch_time * 1e6f / count << " ns ("
+                  << reference_time / batch_time << "x), with inverse "
+                  << inverse_time * 1e6f / count << " ns, max error "
+                  << max_error << ", inverse " << max_inverse_error
+                  << (exact ? "" : ", MISMATCH") << std::endl;
+
+        passed &= exact;
+    }
+
+    return passed;
+}
+
+// count entities as rigs of a root with three six link chains, every
+// local transform random. Propagates everything once, then moves 5% of the
+// roots per frame, on one thread and on scheduler, and checks the world
+// transforms against composing each entity's parent chain directly.
+static bool cpu_benchmark_hierarchy(
+    cpu::Scheduler& scheduler)
+{
+    bool passed = true;
+
+    const uint32_t frames = 30;
+    const uint32_t rig_size = 1 + 3 * 6;
+
+    for (uint32_t count = 10000; count <= 1000000; count *= 10)
+    {
+        std::mt19937 random(1);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+        const uint32_t rigs = count / rig_size;
+        std::vector<uint32_t> roots;
+
+        EntityStore serial;
+        EntityStore parallel;
+
+        for (uint32_t r = 0; r < rigs; r++)
+        {
+            for (uint32_t k = 0; k < rig_size; k++)
+            {
+                Entity entity;
+                entity.position = glm::vec3(unit(random), unit(random), unit(random)) * (k == 0 ? 1000.0f : 1.0f);
+                entity.orientation = glm::normalize(glm::quat(unit(random), unit(random), unit(random), unit(random)));
+                entity.scale = glm::vec3(1.0f + 0.1f * unit(random));
+
+                // Link one of each chain hangs off the root.
+                const uint32_t root = static_cast<uint32_t>(serial.Size()) - k;
+                const uint32_t parent = k == 0 ? EntityStore::NO_PARENT : k <= 3 ? root : root + k - 3;
+
+                if (k == 0)
+                    roots.push_back(root);
+
+                serial.Add(entity, parent);
+                parallel.Add(entity, parent);
+            }
+        }
+
+        auto serial_start = timer_start();
+        serial.Propagate();
+        const float serial_full = timer_end(serial_start);
+
+        auto parallel_start = timer_start();
+        parallel.Propagate(scheduler);
+        const float parallel_full = timer_end(parallel_start);
+
+        float serial_time = 0.0f;
+        float parallel_time = 0.0f;
+
+        std::uniform_int_distribution<uint32_t> pick(0, rigs - 1);
+
+        for (uint32_t f = 0; f < frames; f++)
+        {
+            serial.ClearChanges();
+            parallel.ClearChanges();
+
+            for (uint32_t m = 0; m < rigs / 20; m++)
+            {
+                const uint32_t root = roots[pick(random)];
+                const glm::vec3 position = serial.Position(root) + glm::vec3(0.0f, 0.01f, 0.0f);
+
+                serial.SetPosition(root, position);
+                parallel.SetPosition(root, position);
+            }
+
+            auto serial_frame = timer_start();
+            serial.Propagate();
+            serial_time += timer_end(serial_frame);
+
+            auto parallel_frame = timer_start();
+            parallel.Propagate(scheduler);
+            parallel_time += timer_end(parallel_frame);
+        }
+
+        bool exact = true;
+        std::vector<Transform3x4> reference(serial.Size());
+
+        for (size_t i = 0; i < serial.Size(); i++)
+        {
+            const Transform3x4 local = InstanceTransform(
+                serial.Position(i), serial.Orientation(i), serial.Scale(i));
+
+            const uint32_t parent = serial.Parent(i);
+            reference[i] = parent == EntityStore::NO_PARENT ? local : Multiply(reference[parent], local);
+
+            exact &= std::memcmp(&reference[i], &serial.World(i), sizeof(Transform3x4)) == 0;
+            exact &= std::memcmp(&reference[i], &parallel.World(i), sizeof(Transform3x4)) == 0;
+        }
+
+        std::cout << "hierarchy: " << serial.Size() << " entities, " << rigs << " rigs, full "
+                  << serial_full << " ms (" << scheduler.ThreadCount() << " threads "
+                  << parallel_full << " ms), 5% of rigs moved "
+                  << serial_time / frames << " ms (" << parallel_time / frames << " ms), changed "
+                  << serial.Changes().size() << (exact ? "" : ", MISMATCH") << std::endl;
+
+        passed &= exact;
+    }
+
+    return passed;
+}
+
+// Writes scenes of growing size and maps them back. Opening validates only
+// the header and the mesh table, so its cost should not follow the size.
+static bool cpu_benchmark_scene()
+{
+    bool passed = true;
+
+    const std::string path = benchmark_directory() + "/scene_benchmark.bin";
+    const uint32_t vertex_count = 65536;
+    const uint32_t index_count = 3 * 128 * 1024;
+    const uint32_t instance_count = 10000;
+    const uint32_t opens = 20;
+
+    std::mt19937 random(1);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    std::uniform_int_distribution<uint32_t> vertex(0, vertex_count - 1);
+
+    std::vector<float> vertices(vertex_count * 3);
+    for (float& v : vertices)
+    {
+        v = unit(random);
+    }
+
+    std::vector<uint32_t> indices(index_count);
+    for (uint32_t& i : indices)
+    {
+        i = vertex(random);
+    }
+
+    for (uint32_t mesh_count = 4; mesh_count <= 400; mesh_count *= 10)
+    {
+        Scenes::SceneBuilder builder;
+
+        for (uint32_t m = 0; m < mesh_count; m++)
+        {
+            builder.AddMesh(vertices.data(), vertices.size(), indices.data(), indices.size(), 0);
+        }
+
+        std::vector<Entity> expected;
+
+        for (uint32_t i = 0; i < instance_count; i++)
+        {
+            Entity entity;
+            entity.position = glm::vec3(unit(random), unit(random), unit(random)) * 100.0f;
+            entity.orientation = glm::normalize(glm::quat(unit(random), unit(random), unit(random), unit(random)));
+            entity.scale = glm::vec3(1.0f + 0.1f * unit(random));
+            entity.mesh = i % mesh_count;
+
+            builder.AddInstance(entity, i == 0 ? Scenes::NO_PARENT : i / 2);
+            expected.push_back(entity);
+        }
+
+        auto store_start = timer_start();
+        const bool stored = Scenes::store(path, builder);
+        const float store_time = timer_end(store_start);
+
+        if (!stored)
+        {
+            std::cout << "scene: could not write " << path << std::endl;
+            return false;
+        }
+
+        std::unique_ptr<Scenes::SceneFile> scene;
+
+        auto open_start = timer_start();
+        for (uint32_t o = 0; o < opens; o++)
+        {
+            scene = Scenes::map(path);
+        }
+        const float open_time = timer_end(open_start) / opens;
+
+        EntityStore entities;
+
+        auto instantiate_start = timer_start();
+        const bool instantiated = scene && scene->Instantiate(entities);
+        const float instantiate_time = timer_end(instantiate_start);
+
+        bool exact = instantiated && entities.Size() == instance_count;
+
+        for (size_t i = 0; exact && i < instance_count; i++)
+        {
+            const Entity entity = entities.Get(i);
+
+            exact &= entity.position == expected[i].position;
+            exact &= entity.orientation == expected[i].orientation;
+            exact &= entity.scale == expected[i].scale;
+            exact &= entity.mesh == expected[i].mesh;
+            exact &= entities.Parent(i) == (i == 0 ? EntityStore::NO_PARENT : i / 2);
+        }
+
+        // Touches every blob, so this is the cost open skipped.
+        auto touch_start = timer_start();
+        for (uint32_t m = 0; exact && m < scene->MeshCount(); m++)
+        {
+            exact &= std::memcmp(scene->Vertices(m), vertices.data(), vertices.size() * sizeof(float)) == 0;
+            exact &= std::memcmp(scene->Indices(m), indices.data(), indices.size() * sizeof(uint32_t)) == 0;
+        }
+        const float touch_time = timer_end(touch_start);
+
+        const float megabytes = (scene ? scene->Size() : 0) / (1024.0f * 1024.0f);
+
+        std::cout << "scene: " << mesh_count << " meshes, " << instance_count << " instances, "
+                  << megabytes << " MiB, store " << megabytes * 1000.0f / store_time << " MiB/s, open "
+                  << open_time << " ms, instantiate " << instantiate_time << " ms, read blobs "
+                  << touch_time << " ms" << (exact ? "" : ", MISMATCH") << std::endl;
+
+        passed &= exact;
+
+        scene = nullptr;
+    }
+
+    std::error_code error;
+    std::filesystem::remove(path, error);
+
+    return passed;
+}
+
+// Writes an n by n height field as an OBJ, each row of quads repeating
+// the vertices it shares with the last and every other row indexing them
+// from the end, and as a .glb triangle list of the same triangles, then
+// imports both. Merging must leave n * n vertices, and since both files
+// list the triangles in the same order the two meshes must be identical.
+// Then .glb files whose header lies about their length must be rejected.
+static bool cpu_benchmark_import(
+    cpu::Scheduler& scheduler)
+{
+    bool passed = true;
+
+    const std::string directory = benchmark_directory();
+    const std::string obj_path = directory + "/import_benchmark.obj";
+    const std::string glb_path = directory + "/import_benchmark.glb";
+
+    for (const uint32_t n : { 128u, 1024u })
+    {
+        auto vertex = [n](const uint32_t row, const uint32_t column)
+        {
+            return glm::vec3(
+                column * 0.01f,
+                0.001f * ((row * 7 + column * 13) % 17),
+                row * 0.01f);
+        };
+
+        std::vector<glm::vec3> triangles;
+
+        {
+            std::ofstream obj(obj_path, std::ios::trunc);
+            obj << "# " << n << "x" << n << " height field\no grid\n";
+
+            char line[128];
+
+            for (uint32_t row = 0; row + 1 < n; row++)
+            {
+                for (uint32_t r = row; r <= row + 1; r++)
+                {
+                    for (uint32_t column = 0; column < n; column++)
+                    {
+                        const glm::vec3 v = vertex(r, column);
+                        std::snprintf(line, sizeof(line), "v %.9g %.9g %.9g\n", v.x, v.y, v.z);
+                        obj << line;
+                    }
+                }
+
+                // Positive indices count from 1 at the start of the file.
+                const int64_t first = row % 2 == 0 ? int64_t(row) * 2 * n + 1 : -2 * int64_t(n);
+
+                for (uint32_t column = 0; column + 1 < n; column++)
+                {
+                    const int64_t a = first + column;
+                    const int64_t b = first + column + 1;
+                    const int64_t c = first + n + column + 1;
+                    const int64_t d = first + n + column;
+
+                    std::snprintf(line, sizeof(line), "f %lld %lld/1 %lld//1 %lld/1/1\n",
+                        static_cast<long long>(a), static_cast<long long>(b),
+                        static_cast<long long>(c), static_cast<long long>(d));
+                    obj << line;
+
+                    // The fan of the quad.
+                    for (const glm::vec3& corner : {
+                        vertex(row, column), vertex(row, column + 1), vertex(row + 1, column + 1),
+                        vertex(row, column), vertex(row + 1, column + 1), vertex(row + 1, column) })
+                    {
+                        triangles.push_back(corner);
+                    }
+                }
+            }
+        }
+
+        {
+            const uint32_t bin_length = static_cast<uint32_t>(triangles.size() * sizeof(glm::vec3));
+
+            std::string json =
+                "{\"asset\":{\"version\":\"2.0\"},"
+                "\"buffers\":[{\"byteLength\":" + std::to_string(bin_length) + "}],"
+                "\"bufferViews\":[{\"buffer\":0,\"byteLength\":" + std::to_string(bin_length) + "}],"
+                "\"accessors\":[{\"bufferView\":0,\"componentType\":5126,\"count\":" +
+                std::to_string(triangles.size()) + ",\"type\":\"VEC3\"}],"
+                "\"meshes\":[{\"name\":\"grid\",\"primitives\":[{\"attributes\":{\"POSITION\":0}}]}]}";
+
+            while (json.size() % 4 != 0)
+                json.push_back(' ');
+
+            const uint32_t json_length = static_cast<uint32_t>(json.size());
+            const uint32_t header[3] = { 0x46546C67, 2, 12 + 8 + json_length + 8 + bin_length };
+            const uint32_t json_chunk[2] = { json_length, 0x4E4F534A };
+            const uint32_t bin_chunk[2] = { bin_length, 0x004E4942 };
+
+            std::ofstream glb(glb_path, std::ios::binary | std::ios::trunc);
+            glb.write(reinterpret_cast<const char*>(header), sizeof(header));
+            glb.write(reinterpret_cast<const char*>(json_chunk), sizeof(json_chunk));
+            glb.write(json.data(), json.size());
+            glb.write(reinterpret_cast<const char*>(bin_chunk), sizeof(bin_chunk));
+            glb.write(reinterpret_cast<const char*>(triangles.data()), bin_length);
+        }
+
+        std::vector<Meshes::Mesh> reference;
+
+        cpu::Scheduler single(1);
+
+        for (cpu::Scheduler* pass : { &single, &scheduler })
+        {
+            const uint32_t threads = pass->ThreadCount();
+
+            for (const std::string& path : { obj_path, glb_path })
+            {
+                std::vector<Meshes::Mesh> meshes;
+                Import::Stats stats;
+
+                const bool imported = Import::load(path, *pass, meshes, &stats);
+
+                bool exact = imported && meshes.size() == 1 &&
+                    meshes[0].vertices.size() == size_t(3) * n * n &&
+                    meshes[0].indices.size() == triangles.size();
+
+                if (exact && reference.empty())
+                    reference = meshes;
+
+                exact = exact &&
+                    meshes[0].vertices == reference[0].vertices &&
+                    meshes[0].indices == reference[0].indices;
+
+                const float time = stats.parse_time + stats.deduplicate_time;
+
+                std::cout << "import: " << std::filesystem::path(path).extension().string().substr(1) << " "
+                          << n << "x" << n << ", " << threads << " threads, "
+                          << stats.bytes / (1024.0f * 1024.0f) << " MiB, parse "
+                          << stats.parse_time << " ms, merge " << stats.deduplicate_time << " ms, "
+                          << stats.bytes / (1024.0f * 1024.0f) * 1000.0f / time << " MiB/s, "
+                          << stats.triangles / (time * 1000.0f) << " Mtris/s, "
+                          << stats.corners << " corners to " << stats.vertices << " vertices, "
+                          << (meshes.empty() ? 0 : meshes[0].IndexSize() * 8) << " bit indices"
+                          << (exact ? "" : ", MISMATCH") << std::endl;
+
+                passed &= exact;
+            }
+
+            if (threads == 1 && scheduler.ThreadCount() == 1)
+                break;
+        }
+    }
+
+    // Truncated and lying headers must be refused without reading past
+    // the file, a declared length shorter than the headers included.
+    const uint32_t json_chunk_length = 0xFFFFFF00;
+
+    for (const uint32_t declared : { 0u, 19u, 90u })
+    {
+        const uint32_t header[3] = { 0x46546C67, 2, declared };
+        const uint32_t json_chunk[2] = { json_chunk_length, 0x4E4F534A };
+        const std::string padding(90 - sizeof(header) - sizeof(json_chunk), ' ');
+
+        {
+            std::ofstream glb(glb_path, std::ios::binary | std::ios::trunc);
+            glb.write(reinterpret_cast<const char*>(header), sizeof(header));
+            glb.write(reinterpret_cast<const char*>(json_chunk), sizeof(json_chunk));
+            glb.write(padding.data(), padding.size());
+        }
+
+        std::vector<Meshes::Mesh> meshes;
+        const bool rejected = !Import::load(glb_path, scheduler, meshes);
+
+        std::cout << "import: malformed glb, length " << declared
+                  << (rejected ? ", rejected" : ", MISMATCH") << std::endl;
+
+        passed &= rejected;
+    }
+
+    std::error_code error;
+    std::filesystem::remove(obj_path, error);
+    std::filesystem::remove(glb_path, error);
+
+    return passed;
+}
+
+// Optimises a shuffled height field with 1% degenerate triangles in each
+// order and times building and tracing a bottom structure over the result.
+// The bottom structure copies triangles into leaf order, so the order
+// matters to the build rather than to traversal.
+static bool cpu_benchmark_optimize()
+{
+    bool passed = true;
+
+    const uint32_t n = 512;
+    const uint32_t ray_count = 1000000;
+    const uint32_t builds = 3;
+
+    std::mt19937 random(1);
+
+    Meshes::Mesh shuffled;
+    shuffled.name = "height field";
+
+    for (uint32_t row = 0; row < n; row++)
+    {
+        for (uint32_t column = 0; column < n; column++)
+        {
+            const float x = column * 0.01f;
+            const float z = row * 0.01f;
+            shuffled.vertices.insert(shuffled.vertices.end(), { x, 0.05f * std::sin(x * 20.0f) * std::cos(z * 20.0f), z });
+        }
+    }
+
+    std::vector<uint32_t> triangles;
+
+    for (uint32_t row = 0; row + 1 < n; row++)
+    {
+        for (uint32_t column = 0; column + 1 < n; column++)
+        {
+            const uint32_t a = row * n + column;
+            triangles.insert(triangles.end(), { a, a + 1, a + n + 1, a, a + n + 1, a + n });
+        }
+    }
+
+    std::vector<uint32_t> order(triangles.size() / 3);
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), random);
+
+    std::vector<uint32_t> permutation(n * n);
+    std::iota(permutation.begin(), permutation.end(), 0);
+    std::shuffle(permutation.begin(), permutation.end(), random);
+
+    std::vector<float> vertices(shuffled.vertices.size());
+    for (uint32_t v = 0; v < n * n; v++)
+    {
+        std::copy_n(&shuffled.vertices[v * 3], 3, &vertices[permutation[v] * 3]);
+    }
+    shuffled.vertices = std::move(vertices);
+
+    std::uniform_int_distribution<uint32_t> percent(0, 99);
+
+    for (const uint32_t t : order)
+    {
+        for (uint32_t k = 0; k < 3; k++)
+        {
+            shuffled.indices.push_back(permutation[triangles[t * 3 + k]]);
+        }
+
+        if (percent(random) == 0)
+            shuffled.indices.insert(shuffled.indices.end(), { permutation[triangles[t * 3]], permutation[triangles[t * 3]], permutation[triangles[t * 3 + 1]] });
+    }
+
+    std::vector<cpu::raytracing::Ray> rays(ray_count);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    for (cpu::raytracing::Ray& ray : rays)
+    {
+        ray.origin = glm::vec3(unit(random), 0.0f, unit(random)) * ((n - 1) * 0.01f) + glm::vec3(0.0f, 1.0f, 0.0f);
+        ray.direction = glm::normalize(glm::vec3(unit(random) - 0.5f, -1.0f, unit(random) - 0.5f));
+        ray.t_max = 10.0f;
+    }
+
+    uint32_t reference_hits = 0;
+    double reference_t = 0.0;
+
+    auto measure = [&](const Meshes::Mesh& mesh, const char* label, const Meshes::OptimizeStats* stats)
+    {
+        float build_time = 0.0f;
+        std::unique_ptr<cpu::raytracing::BottomStructure> blas;
+
+        for (uint32_t b = 0; b < builds; b++)
+        {
+            auto build_start = timer_start();
+            blas = std::make_unique<cpu::raytracing::BottomStructure>(
+                mesh.vertices.data(), mesh.vertices.size(), mesh.indices.data(), mesh.indices.size());
+            build_time += timer_end(build_start);
+        }
+
+        uint32_t hits = 0;
+        double t_sum = 0.0;
+
+        auto trace_start = timer_start();
+        for (const cpu::raytracing::Ray& ray : rays)
+        {
+            cpu::raytracing::Hit hit;
+            if (blas->Intersect(ray, hit))
+            {
+                hits++;
+                t_sum += hit.t;
+            }
+        }
+        const float trace_time = timer_end(trace_start);
+
+        if (!stats)
+        {
+            reference_hits = hits;
+            reference_t = t_sum;
+        }
+
+        const bool exact = hits == reference_hits && std::abs(t_sum - reference_t) <= 1e-6 * reference_t;
+
+        std::cout << "optimize: " << label << ", " << blas->PrimitiveCount() << " triangles, "
+                  << mesh.vertices.size() / 3 << " vertices, acmr " << Meshes::acmr(mesh);
+
+        if (stats)
+        {
+            std::cout << ", " << stats->degenerate << " degenerate dropped in " << stats->time << " ms";
+        }
+
+        std::cout << ", build " << build_time / builds << " ms, trace "
+                  << ray_count / (trace_time * 1000.0f) << " Mrays/s, " << hits << " hits"
+                  << (exact ? "" : ", MISMATCH") << std::endl;
+
+        passed &= exact;
+    };
+
+    measure(shuffled, "shuffled", nullptr);
+
+    const char* names[] = { "input order", "cache order", "morton order" };
+
+    for (const Meshes::TriangleOrder triangle_order : {
+        Meshes::TriangleOrder::None, Meshes::TriangleOrder::Cache, Meshes::TriangleOrder::Morton })
+    {
+        Meshes::Mesh mesh = shuffled;
+        const Meshes::OptimizeStats stats = Meshes::optimize(mesh, triangle_order);
+
+        measure(mesh, names[static_cast<int>(triangle_order)], &stats);
+    }
+
+    // The cube keeps its order in the default scene, where the hit shaders
+    // derive face normals from PrimitiveIndex().
+    Meshes::Mesh cube = Meshes::cube();
+    const Meshes::OptimizeStats cube_stats = Meshes::optimize(cube, Meshes::TriangleOrder::Cache);
+    const Meshes::Bounds cube_bounds = Meshes::bounds(cube);
+
+    std::cout << "optimize: cube, " << cube_stats.triangles << " triangles, acmr "
+              << cube_stats.acmr_before << " to " << cube_stats.acmr_after << ", bounds ("
+              << cube_bounds.min.x << ", " << cube_bounds.min.y << ", " << cube_bounds.min.z << ") to ("
+              << cube_bounds.max.x << ", " << cube_bounds.max.y << ", " << cube_bounds.max.z << ")" << std::endl;
+
+    return passed;
+}
+
+// The reproducible workloads, 1k, 100k and 1M instances of each
+// distribution. Every line carries the scene hash, which must not change
+// between runs, builds or machines for the same options, so the 1k scenes
+// are also checked against hashes recorded from an unfused build.
+static bool cpu_benchmark_generate(
+    cpu::Scheduler& scheduler)
+{
+    const uint32_t frames = 10;
+    const uint32_t ray_count = 100000;
+
+    struct Expected
+    {
+        Scenes::Distribution distribution;
+        uint64_t hash;
+    };
+
+    static const Expected expected_hashes[] =
+    {
+        { Scenes::Distribution::Uniform, 0xfae0fd872a89ed29ull },
+        { Scenes::Distribution::Clustered, 0xf24403c1ed04bb3aull },
+        { Scenes::Distribution::CityGrid, 0x7399d61f45fd8e2eull }
+    };
+
+    bool passed = true;
+
+    for (const Scenes::Distribution distribution : {
+        Scenes::Distribution::Uniform, Scenes::Distribution::Clustered, Scenes::Distribution::CityGrid })
+    {
+        for (const uint32_t count : { 1000u, 100000u, 1000000u })
+        {
+            Scenes::GeneratorOptions options;
+            options.instances = count;
+            options.distribution = distribution;
+
+            auto generate_start = timer_start();
+            const Scenes::GeneratedScene scene = Scenes::generate(options);
+            const float generate_time = timer_end(generate_start);
+
+            const uint64_t hash = scene.Hash();
+            bool reproducible = Scenes::generate(options).Hash() == hash;
+
+            for (const Expected& expected : expected_hashes)
+            {
+                if (count == 1000 && expected.distribution == distribution)
+                    reproducible &= expected.hash == hash;
+            }
+
+            auto blas_start = timer_start();
+            std::vector<std::shared_ptr<cpu::raytracing::BottomStructure>> blas_list;
+            for (const Meshes::Mesh& mesh : scene.meshes)
+            {
+                blas_list.push_back(std::make_shared<cpu::raytracing::BottomStructure>(
+                    mesh.vertices.data(), mesh.vertices.size(), mesh.indices.data(), mesh.indices.size()));
+            }
+            const float blas_time = timer_end(blas_start);
+
+            EntityStore entities;
+            const uint32_t first = scene.Instantiate(entities);
+
+            auto tlas_start = timer_start();
+            cpu::raytracing::TopStructure tlas;
+            tlas.Initialize(blas_list, entities, &scheduler);
+            const float tlas_time = timer_end(tlas_start);
+
+            float update_time = 0.0f;
+
+            for (uint32_t f = 1; f <= frames; f++)
+            {
+                Scenes::animate(scene, entities, first, f / 60.0f);
+
+                auto update_start = timer_start();
+                tlas.Update(entities);
+                update_time += timer_end(update_start);
+            }
+
+            glm::vec3 low(std::numeric_limits<float>::max());
+            glm::vec3 high(-std::numeric_limits<float>::max());
+            for (const Entity& entity : scene.entities)
+            {
+                low = glm::min(low, entity.position);
+                high = glm::max(high, entity.position);
+            }
+
+            std::mt19937 random(1);
+            std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+            uint32_t hits = 0;
+
+            auto trace_start = timer_start();
+            for (uint32_t r = 0; r < ray_count; r++)
+            {
+                cpu::raytracing::Ray ray;
+                ray.origin = glm::vec3(
+                    low.x + unit(random) * (high.x - low.x), 30.0f,
+                    low.z + unit(random) * (high.z - low.z));
+                ray.direction = glm::normalize(glm::vec3(unit(random) - 0.5f, -1.0f, unit(random) - 0.5f));
+                ray.t_max = 100.0f;
+
+                cpu::raytracing::Hit hit;
+                hits += tlas.Intersect(ray, hit) ? 1 : 0;
+            }
+            const float trace_time = timer_end(trace_start);
+
+            size_t triangles = 0;
+            for (const Meshes::Mesh& mesh : scene.meshes)
+            {
+                triangles += mesh.indices.size() / 3;
+            }
+
+            char hash_text[32];
+            std::snprintf(hash_text, sizeof(hash_text), "%016llx", static_cast<unsigned long long>(hash));
+
+            std::cout << "generate: " << Scenes::distribution_name(distribution) << " " << count << " instances, "
+                      << scene.meshes.size() << " meshes, " << triangles << " triangles, "
+                      << scene.animated.size() << " animated, hash " << hash_text
+                      << (reproducible ? "" : " NOT REPRODUCIBLE") << ", generate " << generate_time
+                      << " ms, blas " << blas_time << " ms, tlas " << tlas_time << " ms, update "
+                      << update_time / frames << " ms, trace " << ray_count / (trace_time * 1000.0f)
+                      << " Mrays/s, " << hits << " hits" << std::endl;
+
+            passed &= reproducible;
+        }
+    }
+
+    return passed;
+}
+
+// Entities added one at a time and then churned, a percent of them
+// removed and replaced each frame, through a TopStructure initialised
+// once. Counts the TopLevelPolicy decisions a device would see and checks
+// growth stays logarithmic, churn with small moves refits, freed slots are
+// reused rather than appended, survivors keep their slots and the result
+// traces like a structure built from scratch.
+static bool cpu_benchmark_churn()
+{
+    bool passed = true;
+
+    const uint32_t frames = 30;
+    const uint32_t ray_count = 10000;
+
+    std::vector<std::shared_ptr<cpu::raytracing::BottomStructure>> blas_list;
+    blas_list.push_back(std::make_shared<cpu::raytracing::BottomStructure>(
+        Meshes::cube_vtx,
+        std::size(Meshes::cube_vtx),
+        reinterpret_cast<const uint16_t*>(Meshes::cube_idx),
+        std::size(Meshes::cube_idx)));
+
+    for (const uint32_t count : { 1000u, 10000u, 100000u })
+    {
+        std::mt19937 random(1);
+        std::uniform_real_distribution<float> range(-100.0f, 100.0f);
+
+        auto make_entity = [&]()
+        {
+            Entity entity;
+            entity.position = glm::vec3(range(random), range(random), range(random));
+            return entity;
+        };
+
+        EntityStore entities;
+        cpu::raytracing::TopStructure tlas;
+        tlas.Initialize(blas_list, entities);
+
+        // The default policy, as the DXR structure runs it, fed the same
+        // frames. Only the CPU structure's rebuild fraction differs.
+        TopLevelPolicy policy;
+        policy.Next(0, 0, 0);
+
+        uint32_t actions[4] = {};
+
+        auto update = [&]()
+        {
+            const uint32_t changed = static_cast<uint32_t>(entities.Changes().size());
+
+            actions[static_cast<int>(policy.Next(
+                static_cast<uint32_t>(entities.Size()),
+                static_cast<uint32_t>(entities.LiveCount()),
+                changed))]++;
+
+            tlas.Update(entities);
+        };
+
+        // A hundred frames of growth, each adding a hundredth.
+        const uint32_t step = std::max(count / 100, 1u);
+
+        auto grow_start = timer_start();
+        for (uint32_t i = 0; i < count; i++)
+        {
+            entities.Add(make_entity());
+
+            if (i % step == step - 1)
+                update();
+        }
+        update();
+        const float grow_time = timer_end(grow_start);
+
+        const uint32_t reallocations = actions[static_cast<int>(TopLevelAction::Reallocate)];
+
+        uint32_t bound = 0;
+        while ((TopLevelPolicy::MIN_CAPACITY << bound) < count)
+        {
+            bound++;
+        }
+
+        bool correct = reallocations <= bound &&
+            tlas.Policy().Capacity() == policy.Capacity() &&
+            policy.Capacity() >= count &&
+            policy.Capacity() < count * TopLevelPolicy::GROWTH_FACTOR + TopLevelPolicy::MIN_CAPACITY;
+
+        // Churn percent of the live entities each frame, then move some.
+        std::vector<uint32_t> live(count);
+        std::iota(live.begin(), live.end(), 0);
+
+        const uint32_t grow_updates = actions[static_cast<int>(TopLevelAction::Update)];
+        float churn_time = 0.0f;
+
+        for (uint32_t f = 0; f < frames; f++)
+        {
+            const uint32_t churned = count / 100;
+
+            for (uint32_t c = 0; c < churned; c++)
+            {
+                const uint32_t k = std::uniform_int_distribution<uint32_t>(0, count - 1)(random);
+                entities.Remove(live[k]);
+                live[k] = static_cast<uint32_t>(entities.Add(make_entity()));
+            }
+
+            // A small move refits, a large one rebuilds.
+            const uint32_t moved = count / 100 * (f % 2 == 0 ? 5 : 50);
+
+            for (uint32_t m = 0; m < moved; m++)
+            {
+                const uint32_t i = live[std::uniform_int_distribution<uint32_t>(0, count - 1)(random)];
+                entities.SetPosition(i, entities.Position(i) + glm::vec3(0.0f, 0.01f, 0.0f));
+            }
+
+            auto start = timer_start();
+            update();
+
+            // Moves alone, without churn.
+            for (uint32_t m = 0; m < moved; m++)
+            {
+                const uint32_t i = live[m];
+                entities.SetPosition(i, entities.Position(i) - glm::vec3(0.0f, 0.01f, 0.0f));
+            }
+
+            update();
+            churn_time += timer_end(start);
+        }
+
+        // Replaced slots count as changed like moved ones, so the frames
+        // with a small move refit both times, the large ones rebuild.
+        correct &= actions[static_cast<int>(TopLevelAction::Update)] - grow_updates == frames;
+        correct &= entities.Size() == count && entities.LiveCount() == count;
+
+        cpu::raytracing::TopStructure reference;
+        reference.Initialize(blas_list, entities);
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            correct &= tlas.GetInstance(i).object_to_world == reference.GetInstance(i).object_to_world;
+            correct &= tlas.GetInstance(i).object_to_world == ToMat4(entities.World(i));
+        }
+
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        uint32_t hits = 0;
+
+        for (uint32_t r = 0; r < ray_count; r++)
+        {
+            cpu::raytracing::Ray ray;
+            ray.origin = glm::vec3(range(random), range(random), range(random));
+            ray.direction = glm::normalize(glm::vec3(unit(random), unit(random), unit(random)) + glm::vec3(1e-3f));
+            ray.t_max = 1000.0f;
+
+            cpu::raytracing::Hit hit;
+            cpu::raytracing::Hit expected;
+            const bool found = tlas.Intersect(ray, hit);
+
+            correct &= found == reference.Intersect(ray, expected);
+            correct &= !found || (hit.t == expected.t && hit.instance_index == expected.instance_index);
+            hits += found ? 1 : 0;
+        }
+
+        std::cout << "churn: " << count << " entities, capacity " << policy.Capacity()
+                  << ", " << reallocations << " reallocations, "
+                  << actions[static_cast<int>(TopLevelAction::Rebuild)] << " rebuilds, "
+                  << actions[static_cast<int>(TopLevelAction::Update)] << " updates, grow "
+                  << grow_time << " ms, churn " << churn_time / frames << " ms/frame, "
+                  << hits << " hits" << (correct ? "" : ", MISMATCH") << std::endl;
+
+        passed &= correct;
+    }
+
+    return passed;
+}
+
+bool cpu_run_benchmarks(
+    const cpu::Options& options,
+    const cpu::Renderer& renderer,
+    cpu::Scheduler& scheduler)
+{
+    bool passed = true;
+
+    for (const std::string& name : options.benchmarks)
+    {
+        if (name == "shadows")
+        {
+            const cpu::ShadowBenchmark shadow = renderer.BenchmarkShadowRays();
+
+            if (shadow.ray_count == 0)
+                continue;
+
+            std::cout << "shadows: " << shadow.ray_count << " rays, "
+                      << shadow.occluded_count << " occluded, any hit "
+                      << shadow.ray_count / (shadow.occluded_time * 1000.0f) << " Mrays/s, closest hit "
+                      << shadow.ray_count / (shadow.closest_hit_time * 1000.0f) << " Mrays/s" << std::endl;
+        }
+        else if (name == "scheduler")
+        {
+            const std::vector<cpu::SchedulerStats> stats = renderer.ThreadStats();
+
+            float busy_time = 0.0f;
+            float wall_time = 0.0f;
+
+            for (size_t t = 0; t < stats.size(); t++)
+            {
+                const float thread_time = stats[t].busy_time + stats[t].idle_time;
+
+                std::cout << "scheduler: thread " << t << ", "
+                          << stats[t].busy_time << " ms busy, "
+                          << stats[t].idle_time << " ms idle, "
+                          << 100.0f * stats[t].busy_time / thread_time << "% busy, "
+                          << stats[t].jobs << " tiles, "
+                          << stats[t].steals << " stolen" << std::endl;
+
+                busy_time += stats[t].busy_time;
+                wall_time += thread_time;
+            }
+
+            std::cout << "scheduler: " << stats.size() << " threads, "
+                      << 100.0f * busy_time / wall_time << "% efficiency" << std::endl;
+        }
+        else if (name == "noise")
+        {
+            passed &= cpu_benchmark_noise(scheduler);
+        }
+        else if (name == "sampler")
+        {
+            cpu_benchmark_sampler();
+        }
+        else if (name == "easing")
+        {
+            cpu_benchmark_easing();
+        }
+        else if (name == "tracks")
+        {
+            passed &= cpu_benchmark_tracks();
+        }
+        else if (name == "transforms")
+        {
+            passed &= cpu_benchmark_transforms();
+        }
+        else if (name == "hierarchy")
+        {
+            passed &= cpu_benchmark_hierarchy(scheduler);
+        }
+        else if (name == "instances")
+        {
+            passed &= cpu_benchmark_instances();
+        }
+        else if (name == "update")
+        {
+            passed &= cpu_benchmark_update(scheduler);
+        }
+        else if (name == "generate")
+        {
+            passed &= cpu_benchmark_generate(scheduler);
+        }
+        else if (name == "churn")
+        {
+            passed &= cpu_benchmark_churn();
+        }
+        else if (name == "optimize")
+        {
+            passed &= cpu_benchmark_optimize();
+        }
+        else if (name == "import")
+        {
+            passed &= cpu_benchmark_import(scheduler);
+        }
+        else if (name == "scene")
+        {
+            passed &= cpu_benchmark_scene();
+        }
+        else if (name == "properties")
+        {
+            passed &= cpu_benchmark_properties();
+            passed &= cpu_benchmark_properties_stress();
+        }
+        else
+        {
+            std::cout << "Unknown benchmark: " << name << std::endl;
+            passed = false;
+        }
+    }
+
+    return passed;
+}
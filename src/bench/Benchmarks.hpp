@@ -0,0 +1,14 @@
+#pragma once
+
+#include "../cpu/Options.hpp"
+#include "../cpu/Renderer.hpp"
+#include "../cpu/Scheduler.hpp"
+
+// Runs options.benchmarks in order after the frames are rendered. Every
+// benchmark that checks its own results reports MISMATCH or INVALID on the
+// line that failed, and false is returned when any of them did, or when a
+// name is not a benchmark.
+bool cpu_run_benchmarks(
+    const cpu::Options& options,
+    const cpu::Renderer& renderer,
+    cpu::Scheduler& scheduler);
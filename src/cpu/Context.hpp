@@ -0,0 +1,26 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+#include "Scheduler.hpp"
+#include "../math/Math.hpp"
+
+namespace cpu
+{
+    struct Context
+    {
+        uint32_t width = 0;
+        uint32_t height = 0;
+
+        uint32_t samples = 1;
+
+        std::shared_ptr<Scheduler> scheduler;
+
+        std::vector<TexDataByteRGBA> frame_buffer;
+
+        // Linear color averaged over the samples, before UNORM conversion.
+        std::vector<glm::vec3> radiance_buffer;
+    };
+}
@@ -0,0 +1,43 @@
+#include "Image.hpp"
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "stb/stb_image_write.h"
+
+namespace cpu
+{
+    bool WritePng(
+        const std::string& path,
+        const uint32_t width,
+        const uint32_t height,
+        const std::vector<TexDataByteRGBA>& pixels)
+    {
+        static_assert(sizeof(TexDataByteRGBA) == 4);
+
+        return stbi_write_png(
+            path.c_str(),
+            static_cast<int>(width),
+            static_cast<int>(height),
+            4,
+            pixels.data(),
+            static_cast<int>(width * sizeof(TexDataByteRGBA))) != 0;
+    }
+
+    bool WriteHdr(
+        const std::string& path,
+        const uint32_t width,
+        const uint32_t height,
+        const std::vector<glm::vec3>& pixels)
+    {
+        static_assert(sizeof(glm::vec3) == 3 * sizeof(float));
+
+        if (pixels.empty())
+            return false;
+
+        return stbi_write_hdr(
+            path.c_str(),
+            static_cast<int>(width),
+            static_cast<int>(height),
+            3,
+            glm::value_ptr(pixels[0])) != 0;
+    }
+}
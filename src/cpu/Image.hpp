@@ -0,0 +1,24 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "../math/Math.hpp"
+
+namespace cpu
+{
+    // 8 bit RGBA, the display frame buffer as it would be presented.
+    bool WritePng(
+        const std::string& path,
+        const uint32_t width,
+        const uint32_t height,
+        const std::vector<TexDataByteRGBA>& pixels);
+
+    // Linear float RGB before the UNORM conversion, as Radiance .hdr.
+    bool WriteHdr(
+        const std::string& path,
+        const uint32_t width,
+        const uint32_t height,
+        const std::vector<glm::vec3>& pixels);
+}
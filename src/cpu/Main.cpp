@@ -0,0 +1,117 @@
+#include "Main.hpp"
+
+#include "Image.hpp"
+#include "Renderer.hpp"
+
+#include "../bench/Benchmarks.hpp"
+
+#include "imgui.h"
+
+#include <cstdio>
+#include <iostream>
+
+static void cpu_imgui_initialise(
+    const uint32_t width,
+    const uint32_t height)
+{
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(
+        static_cast<float>(width),
+        static_cast<float>(height));
+    io.DeltaTime = 1.0f / 60.0f;
+    io.IniFilename = nullptr;
+
+    // NewFrame requires a built atlas even when nothing is drawn.
+    unsigned char* pixels;
+    int atlas_width, atlas_height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &atlas_width, &atlas_height);
+}
+
+static bool cpu_write_frame(
+    const cpu::Options& options,
+    const cpu::Renderer& renderer,
+    const uint32_t frame)
+{
+    char index[16];
+    std::snprintf(index, sizeof(index), "_%04u.", frame);
+
+    const std::string path = options.output + index + options.format;
+
+    const bool written = options.format == "hdr" ?
+        cpu::WriteHdr(path, options.width, options.height, renderer.RadianceBuffer()) :
+        cpu::WritePng(path, options.width, options.height, renderer.FrameBuffer());
+
+    if (!written)
+    {
+        std::cout << "Failed to write image: " << path << std::endl;
+    }
+
+    return written;
+}
+
+int cpu_init(
+    std::unique_ptr<IApplication>& app,
+    const cpu::Options& options)
+{
+    std::unique_ptr<IApplication> application = std::move(app);
+
+    cpu_imgui_initialise(options.width, options.height);
+
+    // Replaced before anything holds it, the update stage, renderer and
+    // noise all run on the application's one scheduler.
+    if (options.threads > 0)
+    {
+        application->context->scheduler = std::make_shared<cpu::Scheduler>(options.threads);
+    }
+
+    auto renderer = std::make_shared<cpu::Renderer>(application->context->scheduler);
+    renderer->Initialize(options.width, options.height);
+    renderer->SetSamples(options.samples);
+
+    application->window_width = static_cast<int>(options.width);
+    application->window_height = static_cast<int>(options.height);
+    application->captured_mouse_delta_x = 0.0f;
+    application->captured_mouse_delta_y = 0.0f;
+
+    application->Init(renderer);
+
+    int result = 0;
+    float total_time = 0.0f;
+    uint64_t total_rays = 0;
+
+    renderer->ResetThreadStats();
+
+    for (uint32_t i = 0; i < options.frames; i++)
+    {
+        application->Update();
+        total_time += renderer->FrameTime();
+        total_rays += renderer->RayCount();
+
+        if (!options.output.empty() && !cpu_write_frame(options, *renderer, i))
+        {
+            result = 1;
+            break;
+        }
+    }
+
+    std::cout << "cpu: " << options.width << "x" << options.height << ", "
+              << renderer->Samples() << " spp, "
+              << renderer->ThreadCount() << " threads, "
+              << total_time / options.frames << " ms/frame, "
+              << total_rays / (total_time * 1000.0) << " Mrays/s" << std::endl;
+
+    if (!cpu_run_benchmarks(options, *renderer, *application->context->scheduler))
+    {
+        result = 1;
+    }
+
+    application->Deinit();
+
+    renderer->Destroy();
+
+    ImGui::DestroyContext();
+
+    return result;
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <memory>
+
+#include "Options.hpp"
+#include "../interfaces/IApplication.hpp"
+
+// Windowless loop driving the application with the CPU renderer.
+int cpu_init(
+    std::unique_ptr<IApplication>& app,
+    const cpu::Options& options);
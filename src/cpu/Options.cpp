@@ -0,0 +1,112 @@
+#include "Options.hpp"
+
+#include <iostream>
+
+namespace cpu
+{
+    static bool ParseCount(
+        const char* value,
+        uint32_t& count)
+    {
+        try
+        {
+            const unsigned long parsed = std::stoul(value);
+            if (parsed == 0 || parsed > UINT32_MAX)
+                return false;
+            count = static_cast<uint32_t>(parsed);
+            return true;
+        }
+        catch (const std::exception&)
+        {
+            return false;
+        }
+    }
+
+    bool ParseOptions(
+        const int argc,
+        char* argv[],
+        Options& options)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            const std::string arg = argv[i];
+
+            if (arg == "--headless")
+            {
+                options.headless = true;
+                continue;
+            }
+
+            if (i + 1 >= argc)
+            {
+                Usage(argv[0]);
+                return false;
+            }
+
+            const char* value = argv[++i];
+            bool valid = true;
+
+            if (arg == "--width")
+                valid = ParseCount(value, options.width);
+            else if (arg == "--height")
+                valid = ParseCount(value, options.height);
+            else if (arg == "--frames")
+                valid = ParseCount(value, options.frames);
+            else if (arg == "--spp")
+                valid = ParseCount(value, options.samples);
+            else if (arg == "--threads")
+                valid = ParseCount(value, options.threads);
+            else if (arg == "--output")
+                options.output = value;
+            else if (arg == "--format")
+            {
+                options.format = value;
+                valid = options.format == "png" || options.format == "hdr";
+            }
+            else if (arg == "--scene")
+            {
+                options.scene = value;
+                continue;
+            }
+            else if (arg == "--bench")
+                options.benchmarks.push_back(value);
+            else
+                valid = false;
+
+            if (!valid)
+            {
+                std::cout << "Invalid argument: " << arg << " " << value << std::endl;
+                Usage(argv[0]);
+                return false;
+            }
+
+            // Every option but --scene implies the windowless renderer.
+            options.headless = true;
+        }
+
+        return true;
+    }
+
+    void Usage(
+        const char* program)
+    {
+        std::cout
+            << "usage: " << program << " [options]\n"
+            << "  --headless       render with the CPU renderer, no window\n"
+            << "  --width N        image width (1280)\n"
+            << "  --height N       image height (720)\n"
+            << "  --frames N       number of frames to render (10)\n"
+            << "  --spp N          samples per pixel (1)\n"
+            << "  --threads N      render threads (hardware concurrency)\n"
+            << "  --output PREFIX  write PREFIX_0000.png, ... per frame\n"
+            << "  --format F       png or hdr (png)\n"
+            << "  --scene PATH     scene file, .obj, .gltf or .glb to load\n"
+            << "                   (the default scene)\n"
+            << "  --bench NAME     run a benchmark after rendering:\n"
+            << "                   shadows, scheduler, noise, sampler,\n"
+            << "                   properties, easing, tracks, update,\n"
+            << "                   instances, transforms, hierarchy,\n"
+            << "                   scene, import, optimize, generate,\n"
+            << "                   churn\n";
+    }
+}
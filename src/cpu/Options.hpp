@@ -0,0 +1,32 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace cpu
+{
+    // Command line of the windowless CPU path, see Usage().
+    struct Options
+    {
+        bool headless = false;
+        uint32_t width = 1280;
+        uint32_t height = 720;
+        uint32_t frames = 10;
+        uint32_t samples = 1;
+        uint32_t threads = 0;
+        std::string output;
+        std::string format = "png";
+        std::string scene;
+        std::vector<std::string> benchmarks;
+    };
+
+    // Returns false and prints the usage on a malformed command line.
+    bool ParseOptions(
+        const int argc,
+        char* argv[],
+        Options& options);
+
+    void Usage(
+        const char* program);
+}
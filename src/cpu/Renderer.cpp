@@ -0,0 +1,121 @@
+#include "Renderer.hpp"
+
+#include "../Timing.hpp"
+
+#include "imgui.h"
+
+#include <algorithm>
+
+namespace cpu
+{
+    Renderer::Renderer(std::shared_ptr<Scheduler> scheduler) :
+        context(std::make_shared<cpu::Context>())
+    {
+        context->scheduler = std::move(scheduler);
+    }
+
+    void Renderer::Initialize(const uint32_t w, const uint32_t h)
+    {
+        context->width = w;
+        context->height = h;
+
+        scene = std::make_unique<cpu::Scene>(context);
+        scene->Initialize();
+    }
+
+    void Renderer::SetSize(const uint32_t w, const uint32_t h)
+    {
+        context->width = w;
+        context->height = h;
+        resize_frame_buffer = true;
+    }
+
+    bool Renderer::SetScene(const Scenes::SceneFile& file)
+    {
+        scene->SetMeshes(file);
+        return true;
+    }
+
+    Meshes::TriangleOrder Renderer::ImportOrder() const
+    {
+        // BottomStructure copies the triangles into leaf order, so the
+        // input order cannot help traversal.
+        return Meshes::TriangleOrder::None;
+    }
+
+    void Renderer::Render(Camera& camera, EntityStore& entities)
+    {
+        if (resize_frame_buffer)
+        {
+            scene->Resize();
+            resize_frame_buffer = false;
+        }
+
+        auto frame_start = timer_start();
+
+        scene->Render(camera, entities);
+
+        frame_time = timer_end(frame_start);
+
+        // There is no overlay on the CPU path, but the frame must be closed.
+        if (ImGui::GetCurrentContext())
+        {
+            ImGui::Render();
+        }
+    }
+
+    void Renderer::Destroy()
+    {
+        scene = nullptr;
+    }
+
+    const std::vector<TexDataByteRGBA>& Renderer::FrameBuffer() const
+    {
+        return context->frame_buffer;
+    }
+
+    const std::vector<glm::vec3>& Renderer::RadianceBuffer() const
+    {
+        return context->radiance_buffer;
+    }
+
+    uint32_t Renderer::ThreadCount() const
+    {
+        return context->scheduler->ThreadCount();
+    }
+
+    std::vector<SchedulerStats> Renderer::ThreadStats() const
+    {
+        return context->scheduler->Stats();
+    }
+
+    void Renderer::ResetThreadStats()
+    {
+        context->scheduler->ResetStats();
+    }
+
+    uint32_t Renderer::Samples() const
+    {
+        return context->samples;
+    }
+
+    void Renderer::SetSamples(const uint32_t count)
+    {
+        context->samples = std::max<uint32_t>(count, 1);
+    }
+
+    uint64_t Renderer::RayCount() const
+    {
+        return scene->RayCount();
+    }
+
+    float Renderer::FrameTime() const
+    {
+        return frame_time;
+    }
+
+    ShadowBenchmark Renderer::BenchmarkShadowRays() const
+    {
+        return scene->BenchmarkShadowRays();
+    }
+}
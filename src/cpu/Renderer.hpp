@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+
+#include "Context.hpp"
+#include "Scene.hpp"
+
+#include "../Camera.hpp"
+#include "../math/Math.hpp"
+#include "../interfaces/IRenderer.hpp"
+
+namespace cpu
+{
+    class Renderer : public IRenderer
+    {
+    public:
+        // Renders on scheduler, which the application shares.
+        explicit Renderer(std::shared_ptr<Scheduler> scheduler);
+        virtual ~Renderer() = default;
+
+        void Initialize(const uint32_t width, const uint32_t height);
+        void SetSize(const uint32_t width, const uint32_t height);
+        bool SetScene(const Scenes::SceneFile& scene);
+        Meshes::TriangleOrder ImportOrder() const;
+        void Render(Camera& camera, EntityStore& entities);
+        void Destroy();
+
+        const std::vector<TexDataByteRGBA>& FrameBuffer() const;
+        const std::vector<glm::vec3>& RadianceBuffer() const;
+
+        uint32_t ThreadCount() const;
+
+        std::vector<SchedulerStats> ThreadStats() const;
+        void ResetThreadStats();
+
+        uint32_t Samples() const;
+        void SetSamples(const uint32_t count);
+
+        uint64_t RayCount() const;
+
+        // Wall time of the last Render call in milliseconds.
+        float FrameTime() const;
+
+        ShadowBenchmark BenchmarkShadowRays() const;
+
+    private:
+        std::shared_ptr<cpu::Context> context;
+        std::unique_ptr<cpu::Scene> scene;
+
+        bool resize_frame_buffer = false;
+
+        float frame_time = 0.0f;
+    };
+}
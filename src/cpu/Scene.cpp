@@ -0,0 +1,501 @@
+#include "Scene.hpp"
+
+#include "../Timing.hpp"
+
+#include <cassert>
+#include <algorithm>
+
+namespace cpu
+{
+    static const glm::vec3 light = glm::vec3(0, 200, 200);
+    static const glm::vec3 sky_top = glm::vec3(0.24, 0.44, 0.72);
+    static const glm::vec3 sky_bottom = glm::vec3(0.75, 0.86, 0.93);
+
+    // Rays traced by this thread since its last tile was flushed.
+    static thread_local uint64_t traced_rays = 0;
+
+    static uint32_t MortonCode(
+        const uint32_t x,
+        const uint32_t y)
+    {
+        auto spread = [](uint32_t v)
+        {
+            v &= 0x0000ffff;
+            v = (v | (v << 8)) & 0x00ff00ff;
+            v = (v | (v << 4)) & 0x0f0f0f0f;
+            v = (v | (v << 2)) & 0x33333333;
+            v = (v | (v << 1)) & 0x55555555;
+            return v;
+        };
+
+        return spread(x) | (spread(y) << 1);
+    }
+
+    Scene::Scene(
+        std::shared_ptr<cpu::Context> context) :
+        context(context)
+    {
+    }
+
+    void Scene::Initialize()
+    {
+        Resize();
+    }
+
+    void Scene::SetMeshes(
+        const Scenes::SceneFile& scene)
+    {
+        blas_list.clear();
+        tlas = nullptr;
+
+        for (uint32_t i = 0; i < scene.MeshCount(); i++)
+        {
+            const Scenes::MeshRecord& mesh = scene.Mesh(i);
+            const size_t vertex_floats = static_cast<size_t>(mesh.vertex_count) * 3;
+
+            if (mesh.index_size == sizeof(uint32_t))
+            {
+                blas_list.push_back(std::make_shared<raytracing::BottomStructure>(
+                    scene.Vertices(i),
+                    vertex_floats,
+                    static_cast<const uint32_t*>(scene.Indices(i)),
+                    mesh.index_count,
+                    context->scheduler.get()));
+            }
+            else
+            {
+                blas_list.push_back(std::make_shared<raytracing::BottomStructure>(
+                    scene.Vertices(i),
+                    vertex_floats,
+                    static_cast<const uint16_t*>(scene.Indices(i)),
+                    mesh.index_count,
+                    context->scheduler.get()));
+            }
+        }
+    }
+
+    void Scene::Resize()
+    {
+        const size_t pixel_count =
+            static_cast<size_t>(context->width) * context->height;
+
+        context->frame_buffer.resize(pixel_count);
+        context->radiance_buffer.resize(pixel_count);
+
+        tiles_x = (context->width + TILE_SIZE - 1) / TILE_SIZE;
+        const uint32_t tiles_y = (context->height + TILE_SIZE - 1) / TILE_SIZE;
+
+        // Each worker starts on a contiguous run of this order, which keeps
+        // its tiles, and the geometry they touch, close together.
+        tile_order.resize(tiles_x * tiles_y);
+        for (uint32_t i = 0; i < tile_order.size(); i++)
+        {
+            tile_order[i] = i;
+        }
+
+        std::sort(tile_order.begin(), tile_order.end(),
+            [&](const uint32_t a, const uint32_t b)
+            {
+                return MortonCode(a % tiles_x, a / tiles_x) <
+                       MortonCode(b % tiles_x, b / tiles_x);
+            });
+    }
+
+    void Scene::Render(
+        Camera& camera,
+        EntityStore& entities)
+    {
+        if (!tlas)
+        {
+            tlas = std::make_shared<raytracing::TopStructure>();
+
+            tlas->Initialize(
+                blas_list,
+                entities,
+                context->scheduler.get());
+        }
+        else
+        {
+            tlas->Update(entities);
+        }
+
+        Uniforms uniforms;
+        uniforms.position = camera.Position();
+        uniforms.view = camera.View();
+        uniforms.aspect = camera.Aspect();
+        uniforms.t_min = camera.Near();
+        uniforms.t_max = camera.Far();
+        uniforms.zoom = camera.Zoom();
+
+        last_uniforms = uniforms;
+        ray_count = 0;
+
+        context->scheduler->ParallelFor(
+            static_cast<uint32_t>(tile_order.size()),
+            [&](const uint32_t index)
+            {
+                const uint32_t tile = tile_order[index];
+                RenderTile(tile % tiles_x, tile / tiles_x, uniforms);
+            });
+    }
+
+    void Scene::RenderTile(
+        const uint32_t tile_x,
+        const uint32_t tile_y,
+        const Uniforms& uniforms) const
+    {
+        const uint32_t x0 = tile_x * TILE_SIZE;
+        const uint32_t y0 = tile_y * TILE_SIZE;
+        const uint32_t x1 = std::min(x0 + TILE_SIZE, context->width);
+        const uint32_t y1 = std::min(y0 + TILE_SIZE, context->height);
+
+        constexpr uint32_t packet_size = raytracing::PACKET_SIZE;
+
+        for (uint32_t y = y0; y < y1; y++)
+        {
+            for (uint32_t x = x0; x < x1; x += packet_size)
+            {
+                RayGeneration(uniforms, x, y, std::min(packet_size, x1 - x));
+            }
+        }
+
+        ray_count += traced_rays;
+        traced_rays = 0;
+    }
+
+    glm::vec3 Scene::RayScreen(
+        const Uniforms& uniforms,
+        glm::vec2 coords) const
+    {
+        coords = glm::vec2(coords.x, 1.0f - coords.y);
+
+        const float size = 1.0f / uniforms.zoom;
+
+        // HLSL mul(row, View) is a row vector times the matrix.
+        glm::vec4 h = glm::vec4(size * 2.0f, 0.0f, 0.0f, 1.0f);
+        glm::vec4 v = glm::vec4(0.0f, size * 2.0f * uniforms.aspect, 0.0f, 1.0f);
+        glm::vec4 c = glm::vec4(-size, -size * uniforms.aspect, -1.5f, 1.0f);
+
+        h = h * uniforms.view;
+        v = v * uniforms.view;
+        c = c * uniforms.view;
+
+        return glm::normalize(
+            glm::vec3(c + coords.x * h + coords.y * v));
+    }
+
+    void Scene::TraceRay(
+        const raytracing::Ray& ray,
+        Payload& payload) const
+    {
+        raytracing::Hit hit;
+
+        if (tlas->Intersect(ray, hit))
+        {
+            ClosestHit(ray, hit, payload);
+        }
+        else
+        {
+            Miss(ray, payload);
+        }
+    }
+
+    raytracing::Ray Scene::PrimaryRay(
+        const Uniforms& uniforms,
+        const uint32_t x,
+        const uint32_t y,
+        const glm::vec2 offset) const
+    {
+        const glm::vec2 size = glm::vec2(
+            context->width,
+            context->height);
+
+        const glm::vec2 uv = (glm::vec2(x, y) + offset) / size;
+
+        raytracing::Ray ray;
+        ray.origin = uniforms.position;
+        ray.direction = RayScreen(uniforms, uv);
+        ray.t_min = uniforms.t_min;
+        ray.t_max = uniforms.t_max;
+        return ray;
+    }
+
+    glm::vec2 Scene::SampleOffset(
+        const uint32_t sample) const
+    {
+        // A single sample stays on the pixel corner like the shader.
+        if (context->samples == 1)
+            return glm::vec2(0.0f);
+
+        // R2 sequence, the same offsets for every pixel keep packets coherent.
+        const glm::vec2 alpha = glm::vec2(0.7548776662f, 0.5698402910f);
+        return glm::fract(glm::vec2(0.5f) + alpha * static_cast<float>(sample));
+    }
+
+    void Scene::RayGeneration(
+        const Uniforms& uniforms,
+        const uint32_t x,
+        const uint32_t y,
+        const uint32_t count) const
+    {
+        raytracing::RayPacket packet;
+        raytracing::HitPacket hits;
+        raytracing::Ray rays[raytracing::PACKET_SIZE];
+
+        glm::vec3 radiance[raytracing::PACKET_SIZE] = {};
+        glm::vec3 display[raytracing::PACKET_SIZE] = {};
+
+        const uint32_t samples = context->samples;
+
+        for (uint32_t sample = 0; sample < samples; sample++)
+        {
+            const glm::vec2 offset = SampleOffset(sample);
+
+            // Unused lanes repeat the last ray and are masked off.
+            for (uint32_t i = 0; i < raytracing::PACKET_SIZE; i++)
+            {
+                rays[i] = PrimaryRay(uniforms, x + std::min(i, count - 1), y, offset);
+                packet.SetLane(i, rays[i]);
+            }
+
+            hits.Reset(uniforms.t_max);
+
+            tlas->IntersectPacket(packet, hits, (1 << count) - 1);
+            traced_rays += count;
+
+            for (uint32_t i = 0; i < count; i++)
+            {
+                Payload payload;
+                payload.color = glm::vec3(0, 0, 0);
+                payload.allow_reflection = true;
+                payload.missed = false;
+
+                const raytracing::Hit hit = hits.Lane(i);
+
+                if (hit.Valid())
+                {
+                    ClosestHit(rays[i], hit, payload);
+                }
+                else
+                {
+                    Miss(rays[i], payload);
+                }
+
+                radiance[i] += payload.color;
+                display[i] += glm::clamp(payload.color, 0.0f, 1.0f);
+            }
+        }
+
+        const float weight = 1.0f / samples;
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            WritePixel(x + i, y, radiance[i] * weight, display[i] * weight);
+        }
+    }
+
+    void Scene::WritePixel(
+        const uint32_t x,
+        const uint32_t y,
+        const glm::vec3& radiance,
+        const glm::vec3& display) const
+    {
+        const size_t index = x + static_cast<size_t>(y) * context->width;
+
+        // R8G8B8A8_UNORM conversion of the UAV write.
+        const glm::vec3 color = glm::round(
+            glm::clamp(display, 0.0f, 1.0f) * 255.0f);
+
+        context->frame_buffer[index] =
+        {
+            static_cast<uint8_t>(color.r),
+            static_cast<uint8_t>(color.g),
+            static_cast<uint8_t>(color.b),
+            255
+        };
+
+        context->radiance_buffer[index] = radiance;
+    }
+
+    void Scene::Miss(
+        const raytracing::Ray& ray,
+        Payload& payload) const
+    {
+        const float slope = glm::normalize(ray.direction).y;
+        const float t = glm::clamp(slope * 5.0f + 0.5f, 0.0f, 1.0f);
+        payload.color = glm::mix(sky_bottom, sky_top, t);
+
+        payload.missed = true;
+    }
+
+    void Scene::ClosestHit(
+        const raytracing::Ray& ray,
+        const raytracing::Hit& hit,
+        Payload& payload) const
+    {
+        switch (tlas->GetInstance(hit.instance_index).instance_id)
+        {
+            case 0: HitFloor(ray, hit, payload); break;
+            case 1: HitCube(ray, hit, payload); break;
+            case 2: HitMirror(ray, hit, payload); break;
+            case 3: HitDiffuse(ray, hit, payload); break;
+
+            default: payload.color = glm::vec3(1, 0, 1); break;
+        }
+    }
+
+    void Scene::HitCube(
+        const raytracing::Ray&,
+        const raytracing::Hit& hit,
+        Payload& payload) const
+    {
+        const uint32_t tri = hit.primitive_index / 2;
+
+        const glm::vec3 normal = glm::vec3(
+            tri % 3 == 0,
+            tri % 3 == 1,
+            tri % 3 == 2) * (tri < 3 ? -1.0f : 1.0f);
+
+        const glm::mat3 object_to_world = glm::mat3(
+            tlas->GetInstance(hit.instance_index).object_to_world);
+
+        const glm::vec3 world_normal = glm::normalize(
+            object_to_world * normal);
+
+        glm::vec3 color = glm::vec3(1, 1, 1);
+
+        color *= glm::clamp(glm::dot(world_normal, glm::normalize(light)), 0.0f, 1.0f) + 0.33f;
+        payload.color = color;
+    }
+
+    void Scene::HitDiffuse(
+        const raytracing::Ray& ray,
+        const raytracing::Hit& hit,
+        Payload& payload) const
+    {
+        const raytracing::Instance& instance = tlas->GetInstance(hit.instance_index);
+
+        // Normals go through the inverse transpose, the scale may not be
+        // uniform. Facing the ray lights either winding the same.
+        const glm::vec3 normal = glm::transpose(glm::mat3(instance.world_to_object)) *
+            instance.blas->Normal(hit.primitive_index);
+
+        const glm::vec3 world_normal = glm::faceforward(
+            glm::normalize(normal), ray.direction, normal);
+
+        glm::vec3 color = glm::vec3(1, 1, 1);
+
+        color *= glm::clamp(glm::dot(world_normal, glm::normalize(light)), 0.0f, 1.0f) + 0.33f;
+        payload.color = color;
+    }
+
+    void Scene::HitMirror(
+        const raytracing::Ray& ray,
+        const raytracing::Hit& hit,
+        Payload& payload) const
+    {
+        if (!payload.allow_reflection)
+            return;
+
+        const raytracing::Instance& instance = tlas->GetInstance(hit.instance_index);
+
+        // Either side of the triangle reflects the same.
+        const glm::vec3 pos = ray.origin + ray.direction * hit.t;
+        const glm::vec3 normal = glm::normalize(glm::transpose(glm::mat3(instance.world_to_object)) *
+            instance.blas->Normal(hit.primitive_index));
+        const glm::vec3 reflected = glm::reflect(glm::normalize(ray.direction), normal);
+
+        raytracing::Ray mirror_ray;
+        mirror_ray.origin = pos;
+        mirror_ray.direction = reflected;
+        mirror_ray.t_min = 0.001f;
+        mirror_ray.t_max = 1000.0f;
+
+        payload.allow_reflection = false;
+        TraceRay(mirror_ray, payload);
+        traced_rays++;
+    }
+
+    void Scene::HitFloor(
+        const raytracing::Ray& ray,
+        const raytracing::Hit& hit,
+        Payload& payload) const
+    {
+        const glm::vec3 pos = ray.origin + ray.direction * hit.t;
+
+        const glm::vec2 cell = glm::fract(glm::vec2(pos.x, pos.z));
+        const bool pattern_x = cell.x > 0.5f;
+        const bool pattern_y = cell.y > 0.5f;
+        payload.color = pattern_x ^ pattern_y ? glm::vec3(0.6f) : glm::vec3(0.4f);
+
+        if (tlas->Occluded(ShadowRay(pos)))
+            payload.color /= 2;
+        traced_rays++;
+    }
+
+    raytracing::Ray Scene::ShadowRay(
+        const glm::vec3& position) const
+    {
+        raytracing::Ray shadow_ray;
+        shadow_ray.origin = position;
+        shadow_ray.direction = light - position;
+        shadow_ray.t_min = 0.001f;
+        shadow_ray.t_max = 1.0f;
+        return shadow_ray;
+    }
+
+    uint64_t Scene::RayCount() const
+    {
+        return ray_count;
+    }
+
+    ShadowBenchmark Scene::BenchmarkShadowRays() const
+    {
+        ShadowBenchmark result;
+
+        if (!tlas)
+            return result;
+
+        std::vector<raytracing::Ray> shadow_rays;
+
+        for (uint32_t y = 0; y < context->height; y++)
+        {
+            for (uint32_t x = 0; x < context->width; x++)
+            {
+                const raytracing::Ray ray = PrimaryRay(last_uniforms, x, y);
+                raytracing::Hit hit;
+
+                if (tlas->Intersect(ray, hit) &&
+                    tlas->GetInstance(hit.instance_index).instance_id == 0)
+                {
+                    shadow_rays.push_back(
+                        ShadowRay(ray.origin + ray.direction * hit.t));
+                }
+            }
+        }
+
+        uint32_t occluded_count = 0;
+        uint32_t closest_hit_count = 0;
+
+        auto occluded_start = timer_start();
+        for (const auto& ray : shadow_rays)
+        {
+            occluded_count += tlas->Occluded(ray);
+        }
+        result.occluded_time = timer_end(occluded_start);
+
+        auto closest_hit_start = timer_start();
+        for (const auto& ray : shadow_rays)
+        {
+            raytracing::Hit hit;
+            closest_hit_count += tlas->Intersect(ray, hit);
+        }
+        result.closest_hit_time = timer_end(closest_hit_start);
+
+        assert(occluded_count == closest_hit_count);
+
+        result.ray_count = static_cast<uint32_t>(shadow_rays.size());
+        result.occluded_count = occluded_count;
+        return result;
+    }
+}
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include "../Camera.hpp"
+#include "../Entities.hpp"
+#include "../SceneFile.hpp"
+#include "Context.hpp"
+
+#include "raytracing/TopStructure.hpp"
+#include "raytracing/BottomStructure.hpp"
+
+namespace cpu
+{
+    struct Uniforms
+    {
+        glm::vec3 position;
+        float t_min;
+        float t_max;
+        float aspect;
+        float zoom;
+        glm::mat4 view;
+    };
+
+    struct Payload
+    {
+        glm::vec3 color;
+        bool allow_reflection;
+        bool missed;
+    };
+
+    struct ShadowBenchmark
+    {
+        uint32_t ray_count = 0;
+        uint32_t occluded_count = 0;
+        float occluded_time = 0.0f;
+        float closest_hit_time = 0.0f;
+    };
+
+    // CPU port of shaders/shader.hlsl, one method per shader entry point.
+    class Scene
+    {
+    public:
+        static constexpr uint32_t TILE_SIZE = 16;
+
+        Scene(
+            std::shared_ptr<cpu::Context> context);
+        virtual ~Scene() = default;
+
+        void Initialize();
+
+        // Builds a bottom structure per mesh of scene, replacing any from
+        // an earlier scene. Must precede the first Render.
+        void SetMeshes(
+            const Scenes::SceneFile& scene);
+
+        void Render(
+            Camera& camera,
+            EntityStore& entities);
+        void Resize();
+
+        // Single threaded timing of the floor shadow rays seen by the last
+        // rendered frame, once as any hit queries and once as closest hit.
+        ShadowBenchmark BenchmarkShadowRays() const;
+
+        // Primary, reflection and shadow rays traced by the last Render.
+        uint64_t RayCount() const;
+
+    private:
+        std::shared_ptr<cpu::Context> context;
+
+        std::shared_ptr<raytracing::TopStructure> tlas;
+
+        // One per scene mesh, indexed by Entity::mesh.
+        std::vector<std::shared_ptr<raytracing::BottomStructure>> blas_list;
+
+        Uniforms last_uniforms;
+
+        // Tile indices in Morton order, rebuilt on Resize.
+        std::vector<uint32_t> tile_order;
+        uint32_t tiles_x = 0;
+
+        mutable std::atomic<uint64_t> ray_count = 0;
+
+        void RenderTile(
+            const uint32_t tile_x,
+            const uint32_t tile_y,
+            const Uniforms& uniforms) const;
+
+        glm::vec3 RayScreen(
+            const Uniforms& uniforms,
+            glm::vec2 coords) const;
+
+        void TraceRay(
+            const raytracing::Ray& ray,
+            Payload& payload) const;
+
+        raytracing::Ray PrimaryRay(
+            const Uniforms& uniforms,
+            const uint32_t x,
+            const uint32_t y,
+            const glm::vec2 offset = glm::vec2(0.0f)) const;
+
+        glm::vec2 SampleOffset(
+            const uint32_t sample) const;
+
+        // Traces count <= PACKET_SIZE pixels of row y as one packet per
+        // sample.
+        void RayGeneration(
+            const Uniforms& uniforms,
+            const uint32_t x,
+            const uint32_t y,
+            const uint32_t count) const;
+
+        void WritePixel(
+            const uint32_t x,
+            const uint32_t y,
+            const glm::vec3& radiance,
+            const glm::vec3& display) const;
+
+        void Miss(
+            const raytracing::Ray& ray,
+            Payload& payload) const;
+
+        void ClosestHit(
+            const raytracing::Ray& ray,
+            const raytracing::Hit& hit,
+            Payload& payload) const;
+
+        void HitCube(
+            const raytracing::Ray& ray,
+            const raytracing::Hit& hit,
+            Payload& payload) const;
+
+        void HitMirror(
+            const raytracing::Ray& ray,
+            const raytracing::Hit& hit,
+            Payload& payload) const;
+
+        void HitDiffuse(
+            const raytracing::Ray& ray,
+            const raytracing::Hit& hit,
+            Payload& payload) const;
+
+        raytracing::Ray ShadowRay(
+            const glm::vec3& position) const;
+
+        void HitFloor(
+            const raytracing::Ray& ray,
+            const raytracing::Hit& hit,
+            Payload& payload) const;
+    };
+}
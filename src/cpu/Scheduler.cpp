@@ -0,0 +1,201 @@
+#include "Scheduler.hpp"
+
+#include <algorithm>
+
+namespace cpu
+{
+    Scheduler::Scheduler(
+        const uint32_t thread_count)
+    {
+        const uint32_t count = std::max<uint32_t>(thread_count, 1);
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            workers.push_back(std::make_unique<Worker>());
+        }
+
+        for (uint32_t i = 1; i < count; i++)
+        {
+            threads.emplace_back(&Scheduler::WorkerLoop, this, i);
+        }
+    }
+
+    Scheduler::~Scheduler()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            quit = true;
+        }
+        start_condition.notify_all();
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    uint32_t Scheduler::ThreadCount() const
+    {
+        return static_cast<uint32_t>(workers.size());
+    }
+
+    void Scheduler::ParallelFor(
+        const uint32_t count,
+        const Job& new_job)
+    {
+        if (count == 0)
+            return;
+
+        const uint32_t worker_count = ThreadCount();
+
+        for (uint32_t t = 0; t < worker_count; t++)
+        {
+            const uint32_t begin = static_cast<uint32_t>(
+                static_cast<uint64_t>(count) * t / worker_count);
+            const uint32_t end = static_cast<uint32_t>(
+                static_cast<uint64_t>(count) * (t + 1) / worker_count);
+
+            Worker& worker = *workers[t];
+            std::lock_guard<std::mutex> lock(worker.mutex);
+
+            for (uint32_t i = begin; i < end; i++)
+            {
+                worker.queue.push_back(i);
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            job = &new_job;
+            remaining = count;
+            batch_start = timer_start();
+            running = static_cast<uint32_t>(threads.size());
+            generation++;
+        }
+        start_condition.notify_all();
+
+        Run(0);
+
+        std::unique_lock<std::mutex> lock(mutex);
+        done_condition.wait(lock, [&]() { return running == 0; });
+        job = nullptr;
+    }
+
+    void Scheduler::WorkerLoop(
+        const uint32_t index)
+    {
+        uint64_t seen = 0;
+
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                start_condition.wait(lock, [&]() { return quit || generation != seen; });
+
+                if (quit)
+                    return;
+
+                seen = generation;
+            }
+
+            Run(index);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (--running == 0)
+                    done_condition.notify_one();
+            }
+        }
+    }
+
+    void Scheduler::Run(
+        const uint32_t index)
+    {
+        SchedulerStats& stats = workers[index]->stats;
+        float busy_time = 0.0f;
+
+        while (remaining.load(std::memory_order_acquire) > 0)
+        {
+            uint32_t item;
+
+            if (Pop(index, item) || Steal(index, item))
+            {
+                auto job_start = timer_start();
+                (*job)(item);
+                busy_time += timer_end(job_start);
+
+                stats.jobs++;
+                remaining.fetch_sub(1, std::memory_order_release);
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        const float wall_time = timer_end(batch_start);
+
+        stats.busy_time += busy_time;
+        stats.idle_time += std::max(wall_time - busy_time, 0.0f);
+    }
+
+    bool Scheduler::Pop(
+        const uint32_t index,
+        uint32_t& item)
+    {
+        Worker& worker = *workers[index];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+
+        if (worker.queue.empty())
+            return false;
+
+        item = worker.queue.front();
+        worker.queue.pop_front();
+        return true;
+    }
+
+    bool Scheduler::Steal(
+        const uint32_t index,
+        uint32_t& item)
+    {
+        const uint32_t worker_count = ThreadCount();
+
+        for (uint32_t i = 1; i < worker_count; i++)
+        {
+            Worker& victim = *workers[(index + i) % worker_count];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+
+            if (victim.queue.empty())
+                continue;
+
+            // The back is furthest from where the owner is working.
+            item = victim.queue.back();
+            victim.queue.pop_back();
+
+            workers[index]->stats.steals++;
+            return true;
+        }
+
+        return false;
+    }
+
+    std::vector<SchedulerStats> Scheduler::Stats() const
+    {
+        std::vector<SchedulerStats> stats;
+
+        for (const auto& worker : workers)
+        {
+            stats.push_back(worker->stats);
+        }
+
+        return stats;
+    }
+
+    void Scheduler::ResetStats()
+    {
+        for (auto& worker : workers)
+        {
+            worker->stats = SchedulerStats();
+        }
+    }
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <functional>
+#include <condition_variable>
+
+#include "../Timing.hpp"
+
+namespace cpu
+{
+    struct SchedulerStats
+    {
+        float busy_time = 0.0f;
+        float idle_time = 0.0f;
+        uint64_t jobs = 0;
+        uint64_t steals = 0;
+    };
+
+    // Persistent workers with one deque each. ParallelFor hands every worker
+    // a contiguous range of the indices, owners pop from the front in order
+    // and idle workers steal from the back of the others. The calling thread
+    // is worker 0, so ThreadCount() - 1 threads are spawned.
+    class Scheduler
+    {
+    public:
+        using Job = std::function<void(const uint32_t index)>;
+
+        explicit Scheduler(
+            const uint32_t thread_count);
+        virtual ~Scheduler();
+
+        // Blocks until job has run for every index in [0, count). Not
+        // reentrant, jobs must not call ParallelFor.
+        void ParallelFor(
+            const uint32_t count,
+            const Job& job);
+
+        uint32_t ThreadCount() const;
+
+        // Per worker totals since the last ResetStats, times in ms. Idle
+        // time is wall time of a ParallelFor not spent in jobs.
+        std::vector<SchedulerStats> Stats() const;
+
+        void ResetStats();
+
+    private:
+        struct Worker
+        {
+            std::mutex mutex;
+            std::deque<uint32_t> queue;
+            SchedulerStats stats;
+        };
+
+        std::vector<std::unique_ptr<Worker>> workers;
+        std::vector<std::thread> threads;
+
+        std::mutex mutex;
+        std::condition_variable start_condition;
+        std::condition_variable done_condition;
+
+        uint64_t generation = 0;
+        uint32_t running = 0;
+        bool quit = false;
+
+        const Job* job = nullptr;
+        std::atomic<uint32_t> remaining = 0;
+        hrc::time_point batch_start;
+
+        void WorkerLoop(
+            const uint32_t index);
+
+        void Run(
+            const uint32_t index);
+
+        bool Pop(
+            const uint32_t index,
+            uint32_t& item);
+
+        bool Steal(
+            const uint32_t index,
+            uint32_t& item);
+    };
+}
@@ -0,0 +1,272 @@
+#include "BottomStructure.hpp"
+
+namespace cpu
+{
+namespace raytracing
+{
+    BottomStructure::BottomStructure(
+        const float* vertices,
+        const size_t vertex_floats,
+        const uint16_t* indices,
+        const size_t index_count,
+        Scheduler* scheduler)
+    {
+        Build(vertices, vertex_floats, indices, index_count, scheduler);
+    }
+
+    BottomStructure::BottomStructure(
+        const float* vertices,
+        const size_t vertex_floats,
+        const uint32_t* indices,
+        const size_t index_count,
+        Scheduler* scheduler)
+    {
+        Build(vertices, vertex_floats, indices, index_count, scheduler);
+    }
+
+    template<typename Index>
+    void BottomStructure::Build(
+        const float* vertices,
+        const size_t vertex_floats,
+        const Index* indices,
+        const size_t index_count,
+        Scheduler* scheduler)
+    {
+        auto vertex = [&](const size_t i)
+        {
+            return glm::vec3(
+                vertices[i * 3 + 0],
+                vertices[i * 3 + 1],
+                vertices[i * 3 + 2]);
+        };
+
+        const size_t vertex_count = vertex_floats / 3;
+
+        const size_t triangle_count = indices ?
+            index_count / 3 :
+            vertex_floats / 9;
+
+        std::vector<Triangle> source;
+        std::vector<Aabb> primitive_bounds;
+        std::vector<uint32_t> source_ids;
+
+        source.reserve(triangle_count);
+        primitive_bounds.reserve(triangle_count);
+        source_ids.reserve(triangle_count);
+        normals.assign(triangle_count, glm::vec3(0.0f));
+
+        for (size_t i = 0; i < triangle_count; i++)
+        {
+            const size_t i0 = indices ? indices[i * 3 + 0] : i * 3 + 0;
+            const size_t i1 = indices ? indices[i * 3 + 1] : i * 3 + 1;
+            const size_t i2 = indices ? indices[i * 3 + 2] : i * 3 + 2;
+
+            if (i0 >= vertex_count || i1 >= vertex_count || i2 >= vertex_count)
+                continue;
+
+            const glm::vec3 v0 = vertex(i0);
+            const glm::vec3 v1 = vertex(i1);
+            const glm::vec3 v2 = vertex(i2);
+
+            source.push_back(
+            {
+                .v0 = v0,
+                .e1 = v1 - v0,
+                .e2 = v2 - v0
+            });
+
+            Aabb primitive;
+            primitive.Grow(v0);
+            primitive.Grow(v1);
+            primitive.Grow(v2);
+
+            primitive_bounds.push_back(primitive);
+            source_ids.push_back(static_cast<uint32_t>(i));
+
+            const glm::vec3 normal = glm::cross(v1 - v0, v2 - v0);
+            const float length = glm::length(normal);
+
+            if (length > 0.0f)
+                normals[i] = normal / length;
+        }
+
+        bvh.Build(primitive_bounds, scheduler);
+
+        const std::vector<uint32_t>& order = bvh.PrimitiveIndices();
+        const size_t primitive_count = order.size();
+
+        if (!bvh.Empty())
+        {
+            bounds.min = bvh.Nodes()[0].min;
+            bounds.max = bvh.Nodes()[0].max;
+        }
+
+        // PrimitiveIndex() stays the index of the triangle in the input.
+        triangles.resize(primitive_count);
+        primitive_ids.resize(primitive_count);
+
+        for (size_t i = 0; i < primitive_count; i++)
+        {
+            triangles[i] = source[order[i]];
+            primitive_ids[i] = source_ids[order[i]];
+        }
+    }
+
+    size_t BottomStructure::PrimitiveCount() const
+    {
+        return triangles.size();
+    }
+
+    const BvhStats& BottomStructure::Stats() const
+    {
+        return bvh.Stats();
+    }
+
+    const Aabb& BottomStructure::Bounds() const
+    {
+        return bounds;
+    }
+
+    const glm::vec3& BottomStructure::Normal(
+        const uint32_t primitive_index) const
+    {
+        return normals[primitive_index];
+    }
+
+    bool BottomStructure::IntersectLeaf(
+        const Ray& ray,
+        const uint32_t first,
+        const uint32_t count,
+        float& t_max,
+        Hit& hit) const
+    {
+        bool found = false;
+
+        // Moller-Trumbore, double sided as the geometry is not culled.
+        for (uint32_t i = first; i < first + count; i++)
+        {
+            const Triangle& tri = triangles[i];
+
+            const glm::vec3 p = glm::cross(ray.direction, tri.e2);
+            const float det = glm::dot(tri.e1, p);
+
+            if (std::abs(det) < 1e-12f)
+                continue;
+
+            const float inv_det = 1.0f / det;
+
+            const glm::vec3 s = ray.origin - tri.v0;
+            const float u = glm::dot(s, p) * inv_det;
+
+            if (u < 0.0f || u > 1.0f)
+                continue;
+
+            const glm::vec3 q = glm::cross(s, tri.e1);
+            const float v = glm::dot(ray.direction, q) * inv_det;
+
+            if (v < 0.0f || u + v > 1.0f)
+                continue;
+
+            const float t = glm::dot(tri.e2, q) * inv_det;
+
+            if (t < ray.t_min || t > t_max)
+                continue;
+
+            t_max = t;
+            hit.t = t;
+            hit.primitive_index = primitive_ids[i];
+            hit.barycentrics = glm::vec2(u, v);
+            found = true;
+        }
+
+        return found;
+    }
+
+    bool BottomStructure::Intersect(
+        const Ray& ray,
+        Hit& hit) const
+    {
+        float t_max = ray.t_max;
+
+        return bvh.Intersect(ray, t_max,
+            [&](const uint32_t first, const uint32_t count, float& t_leaf)
+            {
+                return IntersectLeaf(ray, first, count, t_leaf, hit);
+            });
+    }
+
+    bool BottomStructure::Occluded(
+        const Ray& ray) const
+    {
+        return bvh.Occluded(ray,
+            [&](const uint32_t first, const uint32_t count)
+            {
+                float t_max = ray.t_max;
+                Hit hit;
+
+                return IntersectLeaf(ray, first, count, t_max, hit);
+            });
+    }
+
+    int BottomStructure::IntersectPacket(
+        const RayPacket& packet,
+        HitPacket& hits,
+        const int active) const
+    {
+        const PacketRays rays(packet);
+
+        int found = 0;
+
+        bvh.IntersectPacket(packet, rays, hits.t, active,
+            [&](const uint32_t first, const uint32_t count, const int mask)
+            {
+                __m256 t = _mm256_load_ps(hits.t);
+                __m256 u = _mm256_load_ps(hits.u);
+                __m256 v = _mm256_load_ps(hits.v);
+
+                for (uint32_t i = first; i < first + count; i++)
+                {
+                    const Triangle& tri = triangles[i];
+
+                    int hit_mask = IntersectTriangle8(
+                        tri.v0, tri.e1, tri.e2, rays, mask, t, u, v);
+
+                    found |= hit_mask;
+
+                    while (hit_mask)
+                    {
+                        const uint32_t lane = std::countr_zero(static_cast<uint32_t>(hit_mask));
+                        hit_mask &= hit_mask - 1;
+
+                        hits.primitive_index[lane] = primitive_ids[i];
+                    }
+                }
+
+                _mm256_store_ps(hits.t, t);
+                _mm256_store_ps(hits.u, u);
+                _mm256_store_ps(hits.v, v);
+            },
+            [&](const uint32_t lane, const uint32_t node)
+            {
+                const Ray ray = packet.Lane(lane, hits.t[lane]);
+                Hit hit = hits.Lane(lane);
+                float t_max = ray.t_max;
+
+                const bool hit_found = bvh.Intersect(ray, t_max,
+                    [&](const uint32_t first, const uint32_t count, float& t_leaf)
+                    {
+                        return IntersectLeaf(ray, first, count, t_leaf, hit);
+                    },
+                    node);
+
+                if (hit_found)
+                {
+                    hits.SetLane(lane, hit);
+                    found |= 1 << lane;
+                }
+            });
+
+        return found;
+    }
+}
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include "Ray.hpp"
+#include "Bvh.hpp"
+#include "Packet.hpp"
+
+namespace cpu
+{
+namespace raytracing
+{
+    struct Triangle
+    {
+        glm::vec3 v0;
+        glm::vec3 e1;
+        glm::vec3 e2;
+    };
+
+    class BottomStructure
+    {
+    private:
+        // Stored in leaf order, primitive_ids maps back to PrimitiveIndex().
+        std::vector<Triangle> triangles;
+        std::vector<uint32_t> primitive_ids;
+
+        // Unit object space normal per input triangle, by PrimitiveIndex(),
+        // zero for dropped and degenerate triangles.
+        std::vector<glm::vec3> normals;
+
+        Bvh bvh;
+        Aabb bounds;
+
+        template<typename Index>
+        void Build(
+            const float* vertices,
+            const size_t vertex_floats,
+            const Index* indices,
+            const size_t index_count,
+            Scheduler* scheduler);
+
+        bool IntersectLeaf(
+            const Ray& ray,
+            const uint32_t first,
+            const uint32_t count,
+            float& t_max,
+            Hit& hit) const;
+
+    public:
+        // Triangles from indices into vertex_floats / 3 positions, or a
+        // triangle list when indices is null. Triangles with an index past
+        // the last vertex are dropped. The BVH builds on scheduler when one
+        // is given.
+        BottomStructure(
+            const float* vertices,
+            const size_t vertex_floats,
+            const uint16_t* indices = nullptr,
+            const size_t index_count = 0,
+            Scheduler* scheduler = nullptr);
+
+        BottomStructure(
+            const float* vertices,
+            const size_t vertex_floats,
+            const uint32_t* indices,
+            const size_t index_count,
+            Scheduler* scheduler = nullptr);
+        virtual ~BottomStructure() = default;
+
+        size_t PrimitiveCount() const;
+
+        const BvhStats& Stats() const;
+
+        const Aabb& Bounds() const;
+
+        // Object space geometric normal of triangle primitive_index, wound
+        // as the input lists it.
+        const glm::vec3& Normal(
+            const uint32_t primitive_index) const;
+
+        // Object space ray, hit.t is only written when closer than ray.t_max.
+        bool Intersect(
+            const Ray& ray,
+            Hit& hit) const;
+
+        // True on the first triangle between ray.t_min and ray.t_max.
+        bool Occluded(
+            const Ray& ray) const;
+
+        // Object space packet, hits.t is the per lane t_max. Returns the
+        // lanes that found a closer hit, instance_index is left untouched.
+        int IntersectPacket(
+            const RayPacket& packet,
+            HitPacket& hits,
+            const int active) const;
+    };
+}
+}
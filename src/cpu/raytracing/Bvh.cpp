@@ -0,0 +1,376 @@
+#include "Bvh.hpp"
+
+#include "../../Timing.hpp"
+
+#include <numeric>
+#include <algorithm>
+
+namespace cpu
+{
+namespace raytracing
+{
+    std::ostream& operator<<(std::ostream& os, const BvhStats& stats)
+    {
+        os << stats.primitive_count << " primitives, "
+           << stats.node_count << " nodes, "
+           << stats.leaf_count << " leaves, "
+           << "sah " << stats.sah_cost << ", "
+           << stats.build_time << " ms";
+        return os;
+    }
+
+    void Bvh::Build(
+        const std::vector<Aabb>& primitive_bounds,
+        Scheduler* scheduler)
+    {
+        auto build_start = timer_start();
+
+        const uint32_t count = static_cast<uint32_t>(primitive_bounds.size());
+
+        bounds = &primitive_bounds;
+
+        indices.resize(count);
+        std::iota(indices.begin(), indices.end(), 0);
+
+        centroids.resize(count);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            centroids[i] = primitive_bounds[i].Center();
+        }
+
+        // Root at 0, 1 is padding so that every child pair starts on an
+        // even index and so on a 64 byte boundary.
+        nodes.resize(std::max<size_t>(static_cast<size_t>(count) * 2, 2));
+        node_count = 2;
+
+        BvhNode& root = nodes[0];
+        root.min = Aabb().min;
+        root.max = Aabb().max;
+        root.left_first = 0;
+        root.count = count;
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            root.min = glm::min(root.min, primitive_bounds[i].min);
+            root.max = glm::max(root.max, primitive_bounds[i].max);
+        }
+
+        if (scheduler && scheduler->ThreadCount() > 1 && count > PARALLEL_THRESHOLD)
+        {
+            SubdivideParallel(*scheduler);
+        }
+        else if (count > 0)
+        {
+            Subdivide(0, 0);
+        }
+
+        nodes.resize(node_count);
+        centroids.clear();
+        centroids.shrink_to_fit();
+        bounds = nullptr;
+
+        stats.primitive_count = count;
+        stats.node_count = node_count - 1;
+        stats.leaf_count = 0;
+        for (uint32_t i = 0; i < node_count; i++)
+        {
+            stats.leaf_count += (i != 1 && nodes[i].Leaf()) ? 1 : 0;
+        }
+        stats.sah_cost = Cost();
+        stats.build_time = timer_end(build_start);
+    }
+
+    void Bvh::Refit(
+        const std::vector<Aabb>& primitive_bounds)
+    {
+        if (indices.empty())
+            return;
+
+        // Children are always allocated after their parent.
+        for (size_t i = nodes.size() - 1; i != static_cast<size_t>(-1); i--)
+        {
+            if (i == 1)
+                continue;
+
+            BvhNode& node = nodes[i];
+
+            if (node.Leaf())
+            {
+                Aabb box;
+                for (uint32_t j = node.left_first; j < node.left_first + node.count; j++)
+                {
+                    box.Grow(primitive_bounds[indices[j]]);
+                }
+                node.min = box.min;
+                node.max = box.max;
+            }
+            else
+            {
+                const BvhNode& left = nodes[node.left_first];
+                const BvhNode& right = nodes[node.left_first + 1];
+                node.min = glm::min(left.min, right.min);
+                node.max = glm::max(left.max, right.max);
+            }
+        }
+
+        stats.sah_cost = Cost();
+    }
+
+    float Bvh::Cost() const
+    {
+        if (indices.empty())
+            return 0.0f;
+
+        auto area = [&](const BvhNode& node)
+        {
+            Aabb box;
+            box.min = node.min;
+            box.max = node.max;
+            return box.Area();
+        };
+
+        const float root_area = area(nodes[0]);
+
+        if (root_area <= 0.0f)
+            return INTERSECT_COST * nodes[0].count;
+
+        float cost = 0.0f;
+
+        for (size_t i = 0; i < nodes.size(); i++)
+        {
+            if (i == 1)
+                continue;
+
+            const BvhNode& node = nodes[i];
+            const float weight = area(node) / root_area;
+
+            cost += node.Leaf() ?
+                weight * node.count * INTERSECT_COST :
+                weight * TRAVERSAL_COST;
+        }
+
+        return cost;
+    }
+
+    void Bvh::SubdivideParallel(
+        Scheduler& scheduler)
+    {
+        // Enough subtrees for every worker to steal from twice over.
+        uint32_t parallel_depth = 0;
+        while ((1u << parallel_depth) < scheduler.ThreadCount() * 2)
+        {
+            parallel_depth++;
+        }
+
+        // Child pairs of frontier[i] go to next[2 * i], next[2 * i + 1] and
+        // leaves leave theirs at 0, which is never a child.
+        std::vector<uint32_t> frontier = { 0 };
+        std::vector<uint32_t> next;
+
+        for (uint32_t depth = 0; depth < parallel_depth && !frontier.empty(); depth++)
+        {
+            next.assign(frontier.size() * 2, 0);
+
+            scheduler.ParallelFor(
+                static_cast<uint32_t>(frontier.size()),
+                [&](const uint32_t i)
+                {
+                    const uint32_t node_index = frontier[i];
+
+                    // Too small to be worth another round, finish it here.
+                    if (nodes[node_index].count <= PARALLEL_THRESHOLD)
+                    {
+                        Subdivide(node_index, depth);
+                    }
+                    else if (Split(node_index, depth))
+                    {
+                        next[2 * i] = nodes[node_index].left_first;
+                        next[2 * i + 1] = nodes[node_index].left_first + 1;
+                    }
+                });
+
+            frontier.clear();
+            for (const uint32_t node_index : next)
+            {
+                if (node_index != 0)
+                    frontier.push_back(node_index);
+            }
+        }
+
+        scheduler.ParallelFor(
+            static_cast<uint32_t>(frontier.size()),
+            [&](const uint32_t i)
+            {
+                Subdivide(frontier[i], parallel_depth);
+            });
+    }
+
+    void Bvh::Subdivide(
+        const uint32_t node_index,
+        const uint32_t depth)
+    {
+        if (!Split(node_index, depth))
+            return;
+
+        const uint32_t left = nodes[node_index].left_first;
+
+        Subdivide(left, depth + 1);
+        Subdivide(left + 1, depth + 1);
+    }
+
+    bool Bvh::Split(
+        const uint32_t node_index,
+        const uint32_t depth)
+    {
+        BvhNode& node = nodes[node_index];
+
+        const uint32_t first = node.left_first;
+        const uint32_t count = node.count;
+
+        if (count <= 1 || depth >= MAX_DEPTH)
+            return false;
+
+        Aabb centroid_bounds;
+        for (uint32_t i = first; i < first + count; i++)
+        {
+            centroid_bounds.Grow(centroids[indices[i]]);
+        }
+
+        struct Bin
+        {
+            Aabb bounds;
+            uint32_t count = 0;
+        };
+
+        float best_cost = std::numeric_limits<float>::max();
+        int best_axis = -1;
+        uint32_t best_split = 0;
+        Aabb best_left;
+        Aabb best_right;
+
+        const glm::vec3 extent = centroid_bounds.max - centroid_bounds.min;
+
+        for (int axis = 0; axis < 3; axis++)
+        {
+            if (extent[axis] <= 0.0f)
+                continue;
+
+            Bin bins[BIN_COUNT];
+            const float scale = BIN_COUNT / extent[axis];
+
+            for (uint32_t i = first; i < first + count; i++)
+            {
+                const uint32_t p = indices[i];
+                const uint32_t b = std::min(
+                    BIN_COUNT - 1,
+                    static_cast<uint32_t>((centroids[p][axis] - centroid_bounds.min[axis]) * scale));
+
+                bins[b].count++;
+                bins[b].bounds.Grow((*bounds)[p]);
+            }
+
+            float left_area[BIN_COUNT - 1];
+            uint32_t left_count[BIN_COUNT - 1];
+            Aabb left_box[BIN_COUNT - 1];
+
+            Aabb box;
+            uint32_t sum = 0;
+            for (uint32_t b = 0; b < BIN_COUNT - 1; b++)
+            {
+                sum += bins[b].count;
+                box.Grow(bins[b].bounds);
+                left_count[b] = sum;
+                left_area[b] = box.Area();
+                left_box[b] = box;
+            }
+
+            box = Aabb();
+            sum = 0;
+            for (uint32_t b = BIN_COUNT - 1; b > 0; b--)
+            {
+                sum += bins[b].count;
+                box.Grow(bins[b].bounds);
+
+                if (left_count[b - 1] == 0 || sum == 0)
+                    continue;
+
+                const float cost =
+                    left_count[b - 1] * left_area[b - 1] +
+                    sum * box.Area();
+
+                if (cost < best_cost)
+                {
+                    best_cost = cost;
+                    best_axis = axis;
+                    best_split = b;
+                    best_left = left_box[b - 1];
+                    best_right = box;
+                }
+            }
+        }
+
+        Aabb node_box;
+        node_box.min = node.min;
+        node_box.max = node.max;
+        const float node_area = node_box.Area();
+
+        const float leaf_cost = INTERSECT_COST * count * node_area;
+        const float split_cost = TRAVERSAL_COST * node_area + INTERSECT_COST * best_cost;
+
+        uint32_t left_count = 0;
+
+        if (best_axis >= 0 && (split_cost < leaf_cost || count > MAX_LEAF_SIZE))
+        {
+            const float scale = BIN_COUNT / extent[best_axis];
+            const float origin = centroid_bounds.min[best_axis];
+
+            auto middle = std::partition(
+                indices.begin() + first,
+                indices.begin() + first + count,
+                [&](const uint32_t p)
+                {
+                    const uint32_t b = std::min(
+                        BIN_COUNT - 1,
+                        static_cast<uint32_t>((centroids[p][best_axis] - origin) * scale));
+                    return b < best_split;
+                });
+
+            left_count = static_cast<uint32_t>(middle - (indices.begin() + first));
+        }
+        else if (count > MAX_LEAF_SIZE)
+        {
+            // Coincident centroids, any split is as good as another.
+            left_count = count / 2;
+
+            best_left = Aabb();
+            best_right = Aabb();
+            for (uint32_t i = first; i < first + count; i++)
+            {
+                (i < first + left_count ? best_left : best_right).Grow((*bounds)[indices[i]]);
+            }
+        }
+        else
+        {
+            return false;
+        }
+
+        const uint32_t left = node_count.fetch_add(2);
+        const uint32_t right = left + 1;
+
+        nodes[left].min = best_left.min;
+        nodes[left].max = best_left.max;
+        nodes[left].left_first = first;
+        nodes[left].count = left_count;
+
+        nodes[right].min = best_right.min;
+        nodes[right].max = best_right.max;
+        nodes[right].left_first = first + left_count;
+        nodes[right].count = count - left_count;
+
+        node.left_first = left;
+        node.count = 0;
+
+        return true;
+    }
+}
+}
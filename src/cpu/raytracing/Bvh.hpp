@@ -0,0 +1,422 @@
+#pragma once
+
+#include <bit>
+#include <atomic>
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <cstdlib>
+#include <ostream>
+
+#include "Ray.hpp"
+#include "Packet.hpp"
+#include "../Scheduler.hpp"
+
+namespace cpu
+{
+namespace raytracing
+{
+    struct Aabb
+    {
+        glm::vec3 min = glm::vec3(std::numeric_limits<float>::max());
+        glm::vec3 max = glm::vec3(-std::numeric_limits<float>::max());
+
+        void Grow(const glm::vec3& point)
+        {
+            min = glm::min(min, point);
+            max = glm::max(max, point);
+        }
+
+        void Grow(const Aabb& other)
+        {
+            min = glm::min(min, other.min);
+            max = glm::max(max, other.max);
+        }
+
+        glm::vec3 Center() const
+        {
+            return (min + max) * 0.5f;
+        }
+
+        float Area() const
+        {
+            const glm::vec3 e = max - min;
+            return e.x < 0.0f ? 0.0f : 2.0f * (e.x * e.y + e.y * e.z + e.z * e.x);
+        }
+    };
+
+    // Children are allocated in pairs so siblings share a cache line.
+    struct alignas(32) BvhNode
+    {
+        glm::vec3 min;
+        uint32_t left_first = 0;
+        glm::vec3 max;
+        uint32_t count = 0;
+
+        bool Leaf() const
+        {
+            return count != 0;
+        }
+    };
+
+    template<typename T, size_t Alignment>
+    struct AlignedAllocator
+    {
+        using value_type = T;
+
+        template<typename U>
+        struct rebind
+        {
+            using other = AlignedAllocator<U, Alignment>;
+        };
+
+        AlignedAllocator() = default;
+
+        template<typename U>
+        AlignedAllocator(const AlignedAllocator<U, Alignment>&) {}
+
+        T* allocate(const size_t n)
+        {
+            const size_t size = (n * sizeof(T) + Alignment - 1) & ~(Alignment - 1);
+            return static_cast<T*>(::operator new(size, std::align_val_t(Alignment)));
+        }
+
+        void deallocate(T* p, const size_t)
+        {
+            ::operator delete(p, std::align_val_t(Alignment));
+        }
+
+        template<typename U>
+        bool operator==(const AlignedAllocator<U, Alignment>&) const { return true; }
+
+        template<typename U>
+        bool operator!=(const AlignedAllocator<U, Alignment>&) const { return false; }
+    };
+
+    struct BvhStats
+    {
+        float build_time = 0.0f;
+        uint32_t primitive_count = 0;
+        uint32_t node_count = 0;
+        uint32_t leaf_count = 0;
+        float sah_cost = 0.0f;
+    };
+
+    std::ostream& operator<<(std::ostream& os, const BvhStats& stats);
+
+    class Bvh
+    {
+    public:
+        static constexpr uint32_t BIN_COUNT = 16;
+        static constexpr uint32_t MAX_LEAF_SIZE = 4;
+        static constexpr uint32_t MAX_DEPTH = 56;
+        static constexpr uint32_t STACK_SIZE = 64;
+        static constexpr uint32_t PARALLEL_THRESHOLD = 16 * 1024;
+
+        static constexpr float TRAVERSAL_COST = 1.0f;
+        static constexpr float INTERSECT_COST = 1.0f;
+
+        Bvh() = default;
+
+        // Reorders nothing in the input, leaves reference PrimitiveIndices().
+        // With a scheduler, past PARALLEL_THRESHOLD primitives the top
+        // levels split one level per ParallelFor and the subtrees below
+        // them are jobs of a last one, so Build must not run inside a job.
+        void Build(
+            const std::vector<Aabb>& primitive_bounds,
+            Scheduler* scheduler = nullptr);
+
+        // Recomputes node bounds bottom up keeping the topology, O(nodes).
+        void Refit(
+            const std::vector<Aabb>& primitive_bounds);
+
+        const BvhNode* Nodes() const
+        {
+            return nodes.data();
+        }
+
+        const std::vector<uint32_t>& PrimitiveIndices() const
+        {
+            return indices;
+        }
+
+        const BvhStats& Stats() const
+        {
+            return stats;
+        }
+
+        bool Empty() const
+        {
+            return indices.empty();
+        }
+
+        float Cost() const;
+
+        // Calls intersect_leaf(first, count, t_max) for leaves along the ray,
+        // front to back. It returns true when it shortened t_max. Traversal
+        // starts at root, which lets a packet hand a subtree to one ray.
+        template<typename F>
+        bool Intersect(
+            const Ray& ray,
+            float& t_max,
+            F&& intersect_leaf,
+            const uint32_t root = 0) const;
+
+        // Any hit query, occluded_leaf(first, count) returns true to stop.
+        // Children are visited in stored order since any hit will do.
+        template<typename F>
+        bool Occluded(
+            const Ray& ray,
+            F&& occluded_leaf) const;
+
+        // Traverses with all active lanes of the packet at once, t holds the
+        // per lane t_max. Leaves go to intersect_leaf(first, count, mask).
+        // Once fewer than PACKET_COHERENCE lanes reach a node the rest of
+        // that subtree is left to intersect_single(lane, node) per lane.
+        template<typename FLeaf, typename FSingle>
+        void IntersectPacket(
+            const RayPacket& packet,
+            const PacketRays& rays,
+            const float* t,
+            const int active,
+            FLeaf&& intersect_leaf,
+            FSingle&& intersect_single) const;
+
+    private:
+        std::vector<BvhNode, AlignedAllocator<BvhNode, 64>> nodes;
+        std::vector<uint32_t> indices;
+        std::vector<glm::vec3> centroids;
+        const std::vector<Aabb>* bounds = nullptr;
+
+        std::atomic<uint32_t> node_count = 0;
+
+        BvhStats stats;
+
+        // Splits the node in two, or leaves it a leaf and returns false.
+        bool Split(
+            const uint32_t node_index,
+            const uint32_t depth);
+
+        void Subdivide(
+            const uint32_t node_index,
+            const uint32_t depth);
+
+        void SubdivideParallel(
+            Scheduler& scheduler);
+    };
+
+    inline float IntersectAabb(
+        const BvhNode& node,
+        const glm::vec3& origin,
+        const glm::vec3& inv_direction,
+        const float t_min,
+        const float t_max)
+    {
+        const glm::vec3 t0 = (node.min - origin) * inv_direction;
+        const glm::vec3 t1 = (node.max - origin) * inv_direction;
+
+        const glm::vec3 near = glm::min(t0, t1);
+        const glm::vec3 far = glm::max(t0, t1);
+
+        const float t_enter = std::max(std::max(near.x, near.y), std::max(near.z, t_min));
+        const float t_exit = std::min(std::min(far.x, far.y), std::min(far.z, t_max));
+
+        return t_enter <= t_exit ? t_enter : std::numeric_limits<float>::max();
+    }
+
+    template<typename F>
+    bool Bvh::Intersect(
+        const Ray& ray,
+        float& t_max,
+        F&& intersect_leaf,
+        const uint32_t root) const
+    {
+        if (indices.empty())
+            return false;
+
+        const glm::vec3 inv_direction = 1.0f / ray.direction;
+        constexpr float miss = std::numeric_limits<float>::max();
+
+        uint32_t stack[STACK_SIZE];
+        uint32_t stack_size = 0;
+
+        bool found = false;
+        uint32_t node_index = root;
+
+        if (IntersectAabb(nodes[root], ray.origin, inv_direction, ray.t_min, t_max) == miss)
+            return false;
+
+        while (true)
+        {
+            const BvhNode& node = nodes[node_index];
+
+            if (node.Leaf())
+            {
+                found |= intersect_leaf(node.left_first, node.count, t_max);
+            }
+            else
+            {
+                const uint32_t left = node.left_first;
+                const uint32_t right = node.left_first + 1;
+
+                float t_left = IntersectAabb(nodes[left], ray.origin, inv_direction, ray.t_min, t_max);
+                float t_right = IntersectAabb(nodes[right], ray.origin, inv_direction, ray.t_min, t_max);
+
+                if (t_left != miss || t_right != miss)
+                {
+                    uint32_t near_index = left;
+                    uint32_t far_index = right;
+
+                    if (t_right < t_left)
+                    {
+                        std::swap(t_left, t_right);
+                        std::swap(near_index, far_index);
+                    }
+
+                    if (t_right != miss)
+                    {
+                        stack[stack_size++] = far_index;
+                    }
+
+                    node_index = near_index;
+                    continue;
+                }
+            }
+
+            // Entries pushed before t_max shrank may now be culled.
+            bool popped = false;
+            while (stack_size > 0)
+            {
+                node_index = stack[--stack_size];
+                const BvhNode& next = nodes[node_index];
+                if (IntersectAabb(next, ray.origin, inv_direction, ray.t_min, t_max) != miss)
+                {
+                    popped = true;
+                    break;
+                }
+            }
+
+            if (!popped)
+                break;
+        }
+
+        return found;
+    }
+
+    template<typename F>
+    bool Bvh::Occluded(
+        const Ray& ray,
+        F&& occluded_leaf) const
+    {
+        if (indices.empty())
+            return false;
+
+        const glm::vec3 inv_direction = 1.0f / ray.direction;
+        constexpr float miss = std::numeric_limits<float>::max();
+
+        uint32_t stack[STACK_SIZE];
+        uint32_t stack_size = 0;
+
+        if (IntersectAabb(nodes[0], ray.origin, inv_direction, ray.t_min, ray.t_max) == miss)
+            return false;
+
+        stack[stack_size++] = 0;
+
+        while (stack_size > 0)
+        {
+            const BvhNode& node = nodes[stack[--stack_size]];
+
+            if (node.Leaf())
+            {
+                if (occluded_leaf(node.left_first, node.count))
+                    return true;
+                continue;
+            }
+
+            const uint32_t left = node.left_first;
+            const uint32_t right = node.left_first + 1;
+
+            if (IntersectAabb(nodes[right], ray.origin, inv_direction, ray.t_min, ray.t_max) != miss)
+                stack[stack_size++] = right;
+
+            if (IntersectAabb(nodes[left], ray.origin, inv_direction, ray.t_min, ray.t_max) != miss)
+                stack[stack_size++] = left;
+        }
+
+        return false;
+    }
+
+    template<typename FLeaf, typename FSingle>
+    void Bvh::IntersectPacket(
+        const RayPacket& packet,
+        const PacketRays& rays,
+        const float* t,
+        const int active,
+        FLeaf&& intersect_leaf,
+        FSingle&& intersect_single) const
+    {
+        if (indices.empty() || !active)
+            return;
+
+        struct Entry
+        {
+            uint32_t node;
+            int mask;
+        };
+
+        Entry stack[STACK_SIZE];
+        uint32_t stack_size = 0;
+
+        stack[stack_size++] = { 0, active };
+
+        while (stack_size > 0)
+        {
+            const Entry entry = stack[--stack_size];
+            const BvhNode& node = nodes[entry.node];
+
+            int mask = entry.mask & IntersectAabb8(
+                node.min, node.max, rays, _mm256_load_ps(t));
+
+            if (!mask)
+                continue;
+
+            if (std::popcount(static_cast<uint32_t>(mask)) < PACKET_COHERENCE)
+            {
+                while (mask)
+                {
+                    const uint32_t lane = std::countr_zero(static_cast<uint32_t>(mask));
+                    mask &= mask - 1;
+
+                    intersect_single(lane, entry.node);
+                }
+                continue;
+            }
+
+            if (node.Leaf())
+            {
+                intersect_leaf(node.left_first, node.count, mask);
+                continue;
+            }
+
+            // Order children along the direction of the first active lane.
+            const uint32_t lane = std::countr_zero(static_cast<uint32_t>(mask));
+            const glm::vec3 direction = glm::vec3(
+                packet.direction[0][lane],
+                packet.direction[1][lane],
+                packet.direction[2][lane]);
+
+            const BvhNode& left = nodes[node.left_first];
+            const BvhNode& right = nodes[node.left_first + 1];
+
+            const float order = glm::dot(
+                (right.min + right.max) - (left.min + left.max), direction);
+
+            const uint32_t near_index = order < 0.0f ? node.left_first + 1 : node.left_first;
+            const uint32_t far_index = order < 0.0f ? node.left_first : node.left_first + 1;
+
+            stack[stack_size++] = { far_index, mask };
+            stack[stack_size++] = { near_index, mask };
+        }
+    }
+}
+}
@@ -0,0 +1 @@
+#include "Packet.hpp"
@@ -0,0 +1,219 @@
+#pragma once
+
+#include <immintrin.h>
+
+#include "Ray.hpp"
+
+namespace cpu
+{
+namespace raytracing
+{
+    constexpr uint32_t PACKET_SIZE = 8;
+    constexpr uint32_t PACKET_MASK = (1u << PACKET_SIZE) - 1;
+
+    // Lanes below this many active rays fall back to single ray traversal.
+    constexpr int PACKET_COHERENCE = 3;
+
+    struct alignas(32) RayPacket
+    {
+        float origin[3][PACKET_SIZE];
+        float direction[3][PACKET_SIZE];
+        float t_min[PACKET_SIZE];
+
+        Ray Lane(
+            const uint32_t i,
+            const float t_max) const
+        {
+            Ray ray;
+            ray.origin = glm::vec3(origin[0][i], origin[1][i], origin[2][i]);
+            ray.direction = glm::vec3(direction[0][i], direction[1][i], direction[2][i]);
+            ray.t_min = t_min[i];
+            ray.t_max = t_max;
+            return ray;
+        }
+
+        void SetLane(
+            const uint32_t i,
+            const Ray& ray)
+        {
+            for (int a = 0; a < 3; a++)
+            {
+                origin[a][i] = ray.origin[a];
+                direction[a][i] = ray.direction[a];
+            }
+            t_min[i] = ray.t_min;
+        }
+    };
+
+    // t holds the current closest distance and doubles as the lane t_max.
+    struct alignas(32) HitPacket
+    {
+        float t[PACKET_SIZE];
+        float u[PACKET_SIZE];
+        float v[PACKET_SIZE];
+        uint32_t instance_index[PACKET_SIZE];
+        uint32_t primitive_index[PACKET_SIZE];
+
+        void Reset(const float t_max)
+        {
+            for (uint32_t i = 0; i < PACKET_SIZE; i++)
+            {
+                t[i] = t_max;
+                u[i] = 0.0f;
+                v[i] = 0.0f;
+                instance_index[i] = INVALID_INDEX;
+                primitive_index[i] = INVALID_INDEX;
+            }
+        }
+
+        Hit Lane(const uint32_t i) const
+        {
+            Hit hit;
+            hit.t = t[i];
+            hit.instance_index = instance_index[i];
+            hit.primitive_index = primitive_index[i];
+            hit.barycentrics = glm::vec2(u[i], v[i]);
+            return hit;
+        }
+
+        void SetLane(
+            const uint32_t i,
+            const Hit& hit)
+        {
+            t[i] = hit.t;
+            u[i] = hit.barycentrics.x;
+            v[i] = hit.barycentrics.y;
+            instance_index[i] = hit.instance_index;
+            primitive_index[i] = hit.primitive_index;
+        }
+    };
+
+    struct PacketRays
+    {
+        __m256 origin[3];
+        __m256 direction[3];
+        __m256 inv_direction[3];
+        __m256 t_min;
+
+        explicit PacketRays(const RayPacket& packet)
+        {
+            const __m256 one = _mm256_set1_ps(1.0f);
+
+            for (int a = 0; a < 3; a++)
+            {
+                origin[a] = _mm256_load_ps(packet.origin[a]);
+                direction[a] = _mm256_load_ps(packet.direction[a]);
+                inv_direction[a] = _mm256_div_ps(one, direction[a]);
+            }
+            t_min = _mm256_load_ps(packet.t_min);
+        }
+    };
+
+    inline int IntersectAabb8(
+        const glm::vec3& box_min,
+        const glm::vec3& box_max,
+        const PacketRays& rays,
+        const __m256 t_max)
+    {
+        __m256 t_enter = rays.t_min;
+        __m256 t_exit = t_max;
+
+        for (int a = 0; a < 3; a++)
+        {
+            const __m256 t0 = _mm256_mul_ps(
+                _mm256_sub_ps(_mm256_set1_ps(box_min[a]), rays.origin[a]),
+                rays.inv_direction[a]);
+            const __m256 t1 = _mm256_mul_ps(
+                _mm256_sub_ps(_mm256_set1_ps(box_max[a]), rays.origin[a]),
+                rays.inv_direction[a]);
+
+            t_enter = _mm256_max_ps(t_enter, _mm256_min_ps(t0, t1));
+            t_exit = _mm256_min_ps(t_exit, _mm256_max_ps(t0, t1));
+        }
+
+        return _mm256_movemask_ps(_mm256_cmp_ps(t_enter, t_exit, _CMP_LE_OQ));
+    }
+
+    // One triangle against eight rays, Moller-Trumbore with the same
+    // acceptance rules as the single ray test. Returns the lanes that hit
+    // closer than t, and updates t, u and v for them.
+    inline int IntersectTriangle8(
+        const glm::vec3& v0,
+        const glm::vec3& e1,
+        const glm::vec3& e2,
+        const PacketRays& rays,
+        const int active,
+        __m256& t,
+        __m256& u,
+        __m256& v)
+    {
+        const __m256 e1x = _mm256_set1_ps(e1.x);
+        const __m256 e1y = _mm256_set1_ps(e1.y);
+        const __m256 e1z = _mm256_set1_ps(e1.z);
+        const __m256 e2x = _mm256_set1_ps(e2.x);
+        const __m256 e2y = _mm256_set1_ps(e2.y);
+        const __m256 e2z = _mm256_set1_ps(e2.z);
+
+        const __m256 dx = rays.direction[0];
+        const __m256 dy = rays.direction[1];
+        const __m256 dz = rays.direction[2];
+
+        // p = cross(d, e2)
+        const __m256 px = _mm256_sub_ps(_mm256_mul_ps(dy, e2z), _mm256_mul_ps(dz, e2y));
+        const __m256 py = _mm256_sub_ps(_mm256_mul_ps(dz, e2x), _mm256_mul_ps(dx, e2z));
+        const __m256 pz = _mm256_sub_ps(_mm256_mul_ps(dx, e2y), _mm256_mul_ps(dy, e2x));
+
+        const __m256 det = _mm256_add_ps(_mm256_add_ps(
+            _mm256_mul_ps(e1x, px), _mm256_mul_ps(e1y, py)), _mm256_mul_ps(e1z, pz));
+
+        const __m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+        __m256 valid = _mm256_cmp_ps(
+            _mm256_and_ps(det, abs_mask), _mm256_set1_ps(1e-12f), _CMP_GE_OQ);
+
+        const __m256 inv_det = _mm256_div_ps(_mm256_set1_ps(1.0f), det);
+
+        const __m256 sx = _mm256_sub_ps(rays.origin[0], _mm256_set1_ps(v0.x));
+        const __m256 sy = _mm256_sub_ps(rays.origin[1], _mm256_set1_ps(v0.y));
+        const __m256 sz = _mm256_sub_ps(rays.origin[2], _mm256_set1_ps(v0.z));
+
+        const __m256 hit_u = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(
+            _mm256_mul_ps(sx, px), _mm256_mul_ps(sy, py)), _mm256_mul_ps(sz, pz)), inv_det);
+
+        // q = cross(s, e1)
+        const __m256 qx = _mm256_sub_ps(_mm256_mul_ps(sy, e1z), _mm256_mul_ps(sz, e1y));
+        const __m256 qy = _mm256_sub_ps(_mm256_mul_ps(sz, e1x), _mm256_mul_ps(sx, e1z));
+        const __m256 qz = _mm256_sub_ps(_mm256_mul_ps(sx, e1y), _mm256_mul_ps(sy, e1x));
+
+        const __m256 hit_v = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(
+            _mm256_mul_ps(dx, qx), _mm256_mul_ps(dy, qy)), _mm256_mul_ps(dz, qz)), inv_det);
+
+        const __m256 hit_t = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(
+            _mm256_mul_ps(e2x, qx), _mm256_mul_ps(e2y, qy)), _mm256_mul_ps(e2z, qz)), inv_det);
+
+        const __m256 zero = _mm256_setzero_ps();
+        const __m256 one = _mm256_set1_ps(1.0f);
+
+        valid = _mm256_and_ps(valid, _mm256_cmp_ps(hit_u, zero, _CMP_GE_OQ));
+        valid = _mm256_and_ps(valid, _mm256_cmp_ps(hit_u, one, _CMP_LE_OQ));
+        valid = _mm256_and_ps(valid, _mm256_cmp_ps(hit_v, zero, _CMP_GE_OQ));
+        valid = _mm256_and_ps(valid, _mm256_cmp_ps(_mm256_add_ps(hit_u, hit_v), one, _CMP_LE_OQ));
+        valid = _mm256_and_ps(valid, _mm256_cmp_ps(hit_t, rays.t_min, _CMP_GE_OQ));
+        valid = _mm256_and_ps(valid, _mm256_cmp_ps(hit_t, t, _CMP_LE_OQ));
+
+        const int mask = _mm256_movemask_ps(valid) & active;
+
+        if (mask)
+        {
+            const __m256 lanes = _mm256_castsi256_ps(_mm256_cmpgt_epi32(
+                _mm256_and_si256(_mm256_set1_epi32(mask), _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128)),
+                _mm256_setzero_si256()));
+
+            t = _mm256_blendv_ps(t, hit_t, lanes);
+            u = _mm256_blendv_ps(u, hit_u, lanes);
+            v = _mm256_blendv_ps(v, hit_v, lanes);
+        }
+
+        return mask;
+    }
+}
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <limits>
+#include <cstdint>
+
+#include "../../math/Math.hpp"
+
+namespace cpu
+{
+namespace raytracing
+{
+    constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+    struct Ray
+    {
+        glm::vec3 origin;
+        glm::vec3 direction;
+        float t_min = 0.0f;
+        float t_max = 0.0f;
+    };
+
+    struct Hit
+    {
+        float t = 0.0f;
+        uint32_t instance_index = INVALID_INDEX;
+        uint32_t primitive_index = INVALID_INDEX;
+        glm::vec2 barycentrics;
+
+        bool Valid() const
+        {
+            return instance_index != INVALID_INDEX;
+        }
+    };
+}
+}
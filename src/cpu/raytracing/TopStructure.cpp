@@ -0,0 +1,313 @@
+#include "TopStructure.hpp"
+
+namespace cpu
+{
+namespace raytracing
+{
+    void TopStructure::Initialize(
+        std::vector<std::shared_ptr<BottomStructure>>& new_blas_list,
+        EntityStore& entities,
+        Scheduler* new_scheduler)
+    {
+        blas_list = new_blas_list;
+        scheduler = new_scheduler;
+        policy = TopLevelPolicy(1.0f);
+        rebuild_count = 0;
+
+        Update(entities);
+    }
+
+    void TopStructure::UpdateInstances(
+        EntityStore& entities,
+        const uint32_t* indices,
+        const size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            const size_t index = indices ? indices[i] : i;
+            Instance& instance = instances[index];
+
+            if (index >= entities.Size() || !entities.Alive(index))
+            {
+                // Dead slots stay leaves, shrunk to a point where they were
+                // so a refit keeps the tree tight, and are never hit.
+                const glm::vec3 center = index < entities.Size() ?
+                    instance_bounds[index].Center() : glm::vec3(0.0f);
+
+                instance.blas = nullptr;
+                instance_bounds[index].min = center;
+                instance_bounds[index].max = center;
+                continue;
+            }
+
+            // A reused slot may hold another mesh or material.
+            instance.instance_id = entities.InstanceId(index);
+            instance.blas = blas_list[entities.Mesh(index)].get();
+
+            const Transform3x4& world = entities.World(index);
+            const glm::mat4 transform = ToMat4(world);
+
+            instance.object_to_world = transform;
+            instance.world_to_object = ToMat4(Inverse(world));
+
+            const Aabb& local = instance.blas->Bounds();
+            const glm::vec3 center = glm::vec3(
+                transform * glm::vec4(local.Center(), 1.0f));
+
+            const glm::mat3 basis = glm::mat3(transform);
+            const glm::mat3 abs_basis = glm::mat3(
+                glm::abs(basis[0]),
+                glm::abs(basis[1]),
+                glm::abs(basis[2]));
+            const glm::vec3 extent = abs_basis * ((local.max - local.min) * 0.5f);
+
+            instance_bounds[index].min = center - extent;
+            instance_bounds[index].max = center + extent;
+        }
+    }
+
+    void TopStructure::Build()
+    {
+        bvh.Build(instance_bounds, scheduler);
+        build_cost = bvh.Stats().sah_cost;
+    }
+
+    void TopStructure::Update(
+        EntityStore& entities)
+    {
+        const std::vector<uint32_t>& changes = entities.Changes();
+
+        const TopLevelAction action = policy.Next(
+            static_cast<uint32_t>(entities.Size()),
+            static_cast<uint32_t>(entities.LiveCount()),
+            static_cast<uint32_t>(changes.size()));
+
+        if (action == TopLevelAction::None)
+        {
+            // Static frames keep the instances and the tree as they are.
+            return;
+        }
+
+        // A new buffer takes every slot up to the capacity, whoever
+        // consumed the changes, the ones past the entities dead.
+        if (action == TopLevelAction::Reallocate)
+        {
+            instances.resize(policy.Capacity());
+            instance_bounds.resize(policy.Capacity());
+            UpdateInstances(entities, nullptr, instances.size());
+        }
+        else
+        {
+            UpdateInstances(entities, changes.data(), changes.size());
+        }
+
+        entities.ClearChanges();
+
+        if (action != TopLevelAction::Update)
+        {
+            rebuild_count += action == TopLevelAction::Rebuild ? 1 : 0;
+            Build();
+            return;
+        }
+
+        bvh.Refit(instance_bounds);
+
+        if (bvh.Stats().sah_cost > build_cost * REBUILD_THRESHOLD)
+        {
+            Build();
+            rebuild_count++;
+        }
+    }
+
+    bool TopStructure::IntersectLeaf(
+        const Ray& ray,
+        const uint32_t first,
+        const uint32_t count,
+        float& t_max,
+        Hit& hit) const
+    {
+        const std::vector<uint32_t>& order = bvh.PrimitiveIndices();
+
+        bool found = false;
+        Ray object_ray = ray;
+        object_ray.t_max = t_max;
+
+        for (uint32_t j = first; j < first + count; j++)
+        {
+            const uint32_t i = order[j];
+            const Instance& instance = instances[i];
+
+            if (!instance.blas)
+                continue;
+
+            // Direction is not normalized so t is shared between spaces.
+            object_ray.origin = glm::vec3(
+                instance.world_to_object * glm::vec4(ray.origin, 1.0f));
+            object_ray.direction = glm::mat3(
+                instance.world_to_object) * ray.direction;
+
+            if (instance.blas->Intersect(object_ray, hit))
+            {
+                object_ray.t_max = hit.t;
+                t_max = hit.t;
+                hit.instance_index = i;
+                found = true;
+            }
+        }
+
+        return found;
+    }
+
+    bool TopStructure::Intersect(
+        const Ray& ray,
+        Hit& hit) const
+    {
+        float t_max = ray.t_max;
+
+        return bvh.Intersect(ray, t_max,
+            [&](const uint32_t first, const uint32_t count, float& t_leaf)
+            {
+                return IntersectLeaf(ray, first, count, t_leaf, hit);
+            });
+    }
+
+    bool TopStructure::Occluded(
+        const Ray& ray) const
+    {
+        const std::vector<uint32_t>& order = bvh.PrimitiveIndices();
+
+        return bvh.Occluded(ray,
+            [&](const uint32_t first, const uint32_t count)
+            {
+                Ray object_ray = ray;
+
+                for (uint32_t j = first; j < first + count; j++)
+                {
+                    const Instance& instance = instances[order[j]];
+
+                    if (!instance.blas)
+                        continue;
+
+                    object_ray.origin = glm::vec3(
+                        instance.world_to_object * glm::vec4(ray.origin, 1.0f));
+                    object_ray.direction = glm::mat3(
+                        instance.world_to_object) * ray.direction;
+
+                    if (instance.blas->Occluded(object_ray))
+                        return true;
+                }
+
+                return false;
+            });
+    }
+
+    static void TransformPacket(
+        const RayPacket& packet,
+        const glm::mat4& m,
+        RayPacket& result)
+    {
+        __m256 origin[3];
+        __m256 direction[3];
+
+        for (int a = 0; a < 3; a++)
+        {
+            origin[a] = _mm256_load_ps(packet.origin[a]);
+            direction[a] = _mm256_load_ps(packet.direction[a]);
+        }
+
+        for (int r = 0; r < 3; r++)
+        {
+            __m256 o = _mm256_set1_ps(m[3][r]);
+            __m256 d = _mm256_setzero_ps();
+
+            for (int c = 0; c < 3; c++)
+            {
+                const __m256 e = _mm256_set1_ps(m[c][r]);
+                o = _mm256_add_ps(o, _mm256_mul_ps(e, origin[c]));
+                d = _mm256_add_ps(d, _mm256_mul_ps(e, direction[c]));
+            }
+
+            _mm256_store_ps(result.origin[r], o);
+            _mm256_store_ps(result.direction[r], d);
+        }
+
+        _mm256_store_ps(result.t_min, _mm256_load_ps(packet.t_min));
+    }
+
+    void TopStructure::IntersectPacket(
+        const RayPacket& packet,
+        HitPacket& hits,
+        const int active) const
+    {
+        const std::vector<uint32_t>& order = bvh.PrimitiveIndices();
+        const PacketRays rays(packet);
+
+        bvh.IntersectPacket(packet, rays, hits.t, active,
+            [&](const uint32_t first, const uint32_t count, const int mask)
+            {
+                RayPacket object_packet;
+
+                for (uint32_t j = first; j < first + count; j++)
+                {
+                    const uint32_t i = order[j];
+                    const Instance& instance = instances[i];
+
+                    if (!instance.blas)
+                        continue;
+
+                    TransformPacket(packet, instance.world_to_object, object_packet);
+
+                    int hit_mask = instance.blas->IntersectPacket(
+                        object_packet, hits, mask);
+
+                    while (hit_mask)
+                    {
+                        const uint32_t lane = std::countr_zero(static_cast<uint32_t>(hit_mask));
+                        hit_mask &= hit_mask - 1;
+
+                        hits.instance_index[lane] = i;
+                    }
+                }
+            },
+            [&](const uint32_t lane, const uint32_t node)
+            {
+                const Ray ray = packet.Lane(lane, hits.t[lane]);
+                Hit hit = hits.Lane(lane);
+                float t_max = ray.t_max;
+
+                const bool found = bvh.Intersect(ray, t_max,
+                    [&](const uint32_t first, const uint32_t count, float& t_leaf)
+                    {
+                        return IntersectLeaf(ray, first, count, t_leaf, hit);
+                    },
+                    node);
+
+                if (found)
+                {
+                    hits.SetLane(lane, hit);
+                }
+            });
+    }
+
+    const Instance& TopStructure::GetInstance(
+        const uint32_t index) const
+    {
+        return instances[index];
+    }
+
+    const BvhStats& TopStructure::Stats() const
+    {
+        return bvh.Stats();
+    }
+
+    const TopLevelPolicy& TopStructure::Policy() const
+    {
+        return policy;
+    }
+
+    uint32_t TopStructure::RebuildCount() const
+    {
+        return rebuild_count;
+    }
+}
+}
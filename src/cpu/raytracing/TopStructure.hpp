@@ -0,0 +1,107 @@
+#pragma once
+
+#include "Ray.hpp"
+#include "Bvh.hpp"
+#include "BottomStructure.hpp"
+#include "Packet.hpp"
+#include "../../Entities.hpp"
+#include "../../TopLevelPolicy.hpp"
+#include "../../math/Transform.hpp"
+
+#include <vector>
+#include <memory>
+
+namespace cpu
+{
+namespace raytracing
+{
+    struct Instance
+    {
+        glm::mat4 object_to_world;
+        glm::mat4 world_to_object;
+        uint32_t instance_id = 0;
+        BottomStructure* blas = nullptr;
+    };
+
+    // Instance BVH over world space bounds of the bottom structures, an
+    // instance and a leaf per slot up to the policy's capacity, dead ones
+    // a point with no bottom structure that traversal skips. Update
+    // recomputes the instances of changed entities, consuming the changes,
+    // and lets the TopLevelPolicy pick refit or rebuild, so entities added
+    // or removed after Initialize are picked up. A refit still rebuilds
+    // once the SAH cost has grown past REBUILD_THRESHOLD times the cost of
+    // the last build, which stands in for the policy's changed count here.
+    class TopStructure
+    {
+    public:
+        static constexpr float REBUILD_THRESHOLD = 1.5f;
+
+    private:
+        std::vector<std::shared_ptr<BottomStructure>> blas_list;
+        std::vector<Instance> instances;
+        std::vector<Aabb> instance_bounds;
+
+        Bvh bvh;
+        Scheduler* scheduler = nullptr;
+        TopLevelPolicy policy = TopLevelPolicy(1.0f);
+        float build_cost = 0.0f;
+        uint32_t rebuild_count = 0;
+
+        void Build();
+
+        // Instances of entities indices[0, count), or [0, count) when
+        // indices is null.
+        void UpdateInstances(
+            EntityStore& entities,
+            const uint32_t* indices,
+            const size_t count);
+
+        bool IntersectLeaf(
+            const Ray& ray,
+            const uint32_t first,
+            const uint32_t count,
+            float& t_max,
+            Hit& hit) const;
+
+    public:
+        TopStructure() = default;
+        virtual ~TopStructure() = default;
+
+        // Rebuilds run on scheduler when one is given, so Update must not
+        // be called from its jobs.
+        void Initialize(
+            std::vector<std::shared_ptr<BottomStructure>>& blas_list,
+            EntityStore& entities,
+            Scheduler* scheduler = nullptr);
+
+        void Update(
+            EntityStore& entities);
+
+        bool Intersect(
+            const Ray& ray,
+            Hit& hit) const;
+
+        // Any hit between ray.t_min and ray.t_max, for shadow rays.
+        bool Occluded(
+            const Ray& ray) const;
+
+        // Closest hit for coherent rays, eight at a time. Lanes outside
+        // active are left as they are in hits.
+        void IntersectPacket(
+            const RayPacket& packet,
+            HitPacket& hits,
+            const int active = PACKET_MASK) const;
+
+        // The instance of entity slot index.
+        const Instance& GetInstance(
+            const uint32_t index) const;
+
+        const BvhStats& Stats() const;
+
+        const TopLevelPolicy& Policy() const;
+
+        // Builds since Initialize, by the policy or the SAH check.
+        uint32_t RebuildCount() const;
+    };
+}
+}
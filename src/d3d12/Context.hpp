@@ -12,6 +12,7 @@ using Microsoft::WRL::ComPtr;
 #include "Frame.hpp"
 #include "Allocator.hpp"
 #include "../math/Math.hpp"
+#include "../NoiseStream.hpp"
 
 namespace d3d12
 {
@@ -59,6 +60,6 @@ namespace d3d12
             return frames[frame_index];
         }
 
-        std::unique_ptr<std::vector<TexDataByteRGBA>> noise_data;
+        std::unique_ptr<Noise::Stream> noise_data;
     };
 }
@@ -3,7 +3,7 @@
 #include <Windows.h>
 #include <DirectXMath.h>
 
-#include "../Noise.hpp"
+#include "../NoiseStream.hpp"
 
 #pragma comment(lib, "user32")
 #pragma comment(lib, "d3d12")
@@ -11,6 +11,8 @@
 
 namespace d3d12
 {
+    static const char* NOISE_CACHE_DIRECTORY = "cache";
+
     Renderer::Renderer(HWND hwnd) :
         hwnd(hwnd),
         context(std::make_shared<d3d12::Context>())
@@ -44,24 +46,22 @@ namespace d3d12
     }
 
     void Renderer::LoadNoise(
-        std::unique_ptr<std::vector<TexDataByteRGBA>>& noise_data,
+        std::unique_ptr<Noise::Stream>& noise_data,
         const uint16_t samples = 16,
         const uint16_t bounces = 4)
     {
-        const uint16_t width = 128;
-        const uint16_t height = 128;
-
-        const uint16_t noise_samples = samples * bounces;
-
-        noise_data = std::make_unique<std::vector<TexDataByteRGBA>>();
-        noise_data->resize(width * height * noise_samples);
-
-        for (uint16_t i = 0; i < noise_samples; i++)
+        // Slices are mapped or generated in the background, so this returns
+        // before any noise exists. Nothing here reads slices yet, and the
+        // stream writes the cache only once every slice exists, so all of
+        // them are queued to have the next launch map it.
+        noise_data = std::make_unique<Noise::Stream>(
+            NOISE_CACHE_DIRECTORY,
+            samples,
+            bounces);
+
+        for (uint32_t i = 0; i < noise_data->SliceCount(); i++)
         {
-            Noise::generate(
-                noise_data,
-                i,
-                noise_samples);
+            noise_data->Prefetch(i);
         }
     }
 
@@ -346,7 +346,18 @@ namespace d3d12
         imgui->Resize();
     }
 
-    void Renderer::Render(Camera& camera, EntityList& entities)
+    bool Renderer::SetScene(const Scenes::SceneFile& file)
+    {
+        return scene->SetMeshes(file);
+    }
+
+    Meshes::TriangleOrder Renderer::ImportOrder() const
+    {
+        // The driver's builder reads the index buffer as given.
+        return Meshes::TriangleOrder::Morton;
+    }
+
+    void Renderer::Render(Camera& camera, EntityStore& entities)
     {
         auto barrier_0 = CD3DX12_RESOURCE_BARRIER::Transition(
             context->CurrentFrame().render_target.Get(),
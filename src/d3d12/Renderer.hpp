@@ -21,7 +21,9 @@ namespace d3d12
 
         void Initialize(const uint32_t width, const uint32_t height);
         void SetSize(const uint32_t width, const uint32_t height);
-        void Render(Camera& camera, EntityList& entities);
+        bool SetScene(const Scenes::SceneFile& scene);
+        Meshes::TriangleOrder ImportOrder() const;
+        void Render(Camera& camera, EntityStore& entities);
         void Destroy();
 
     private:
@@ -32,7 +34,7 @@ namespace d3d12
         std::unique_ptr<d3d12::Scene> scene;
 
         void LoadNoise(
-            std::unique_ptr<std::vector<TexDataByteRGBA>>& noise_data,
+            std::unique_ptr<Noise::Stream>& noise_data,
             const uint16_t samples, const uint16_t bounces);
 
         void ResizeSwapChain();
@@ -2,30 +2,44 @@
 
 #include "shaders/shader.fxh"
 
+#include <iostream>
+
 namespace d3d12
 {
     constexpr UINT64 NUM_SHADER_IDS = 3;
 
-    constexpr UINT NUM_INSTANCES = 3;
-
-    constexpr float quad_vtx[] =
+    // Unit normal of each triangle of vertices, a triangle list when
+    // indices is null, zero where degenerate.
+    template<typename Index>
+    static void append_normals(
+        std::vector<glm::vec3>& normals,
+        const float* vertices,
+        const uint32_t vertex_count,
+        const Index* indices,
+        const uint32_t index_count)
     {
-        -1, 0, -1, -1, 0,  1, 1, 0, 1,
-        -1, 0, -1,  1, 0, -1, 1, 0, 1
-    };
+        auto vertex = [&](const size_t i)
+        {
+            return glm::vec3(
+                vertices[i * 3 + 0],
+                vertices[i * 3 + 1],
+                vertices[i * 3 + 2]);
+        };
 
-    constexpr float cube_vtx[] =
-    {
-        -1, -1, -1, 1, -1, -1, -1, 1, -1, 1, 1, -1,
-        -1, -1,  1, 1, -1,  1, -1, 1,  1, 1, 1,  1
-    };
+        const uint32_t triangle_count = indices ? index_count / 3 : vertex_count / 3;
 
-    constexpr short cube_idx[] =
-    {
-        4, 6, 0, 2, 0, 6, 0, 1, 4, 5, 4, 1,
-        0, 2, 1, 3, 1, 2, 1, 3, 5, 7, 5, 3,
-        2, 6, 3, 7, 3, 6, 4, 5, 6, 7, 6, 5
-    };
+        for (uint32_t i = 0; i < triangle_count; i++)
+        {
+            const glm::vec3 v0 = vertex(indices ? indices[i * 3 + 0] : i * 3 + 0);
+            const glm::vec3 v1 = vertex(indices ? indices[i * 3 + 1] : i * 3 + 1);
+            const glm::vec3 v2 = vertex(indices ? indices[i * 3 + 2] : i * 3 + 2);
+
+            const glm::vec3 normal = glm::cross(v1 - v0, v2 - v0);
+            const float length = glm::length(normal);
+
+            normals.push_back(length > 0.0f ? normal / length : glm::vec3(0.0f));
+        }
+    }
 
     Scene::Scene(
         std::shared_ptr<d3d12::Context> context) :
@@ -35,20 +49,35 @@ namespace d3d12
 
     void Scene::Initialize()
     {
-        InitMeshes();
-        InitAccelerationStructure();
-
         InitRootSignature();
         InitPipeline();
 
         Resize();
     }
 
-    void Scene::InitMeshes()
+    bool Scene::SetMeshes(
+        const Scenes::SceneFile& scene)
     {
-        auto make_and_copy = [&](auto& data, D3D12MA::ResourcePtr& res) {
+        if (scene.MeshCount() > raytracing::MAX_MESHES)
+        {
+            std::cout << "Scene has " << scene.MeshCount() << " meshes, InstanceID holds at most "
+                      << raytracing::MAX_MESHES << std::endl;
+            return false;
+        }
+
+        Flush();
+
+        tlas = nullptr;
+        blas_list.clear();
+        blas_init_list.clear();
+        mesh_buffers.clear();
+        triangle_normals = nullptr;
+        mesh_normal_offsets = nullptr;
+
+        auto make_and_copy = [&](const void* data, const size_t size)
+        {
             auto desc = BASIC_BUFFER_DESC;
-            desc.Width = sizeof(data);
+            desc.Width = size;
 
             D3D12MA::ALLOCATION_DESC allocation_desc = {};
             allocation_desc.HeapType = D3D12_HEAP_TYPE_UPLOAD;
@@ -63,38 +92,76 @@ namespace d3d12
                 __uuidof(ID3D12Resource),
                 nullptr);
 
-            res.reset(alloc);
-
             void* ptr;
-            res->GetResource()->Map(0, nullptr, &ptr);
-            memcpy(ptr, data, sizeof(data));
-            res->GetResource()->Unmap(0, nullptr);
+            alloc->GetResource()->Map(0, nullptr, &ptr);
+            memcpy(ptr, data, size);
+            alloc->GetResource()->Unmap(0, nullptr);
+
+            mesh_buffers.emplace_back(alloc);
+
+            return alloc->GetResource();
         };
 
-        make_and_copy(quad_vtx, quad_vb);
-        make_and_copy(cube_vtx, cube_vb);
-        make_and_copy(cube_idx, cube_ib);
-    }
+        std::vector<glm::vec3> normals;
+        std::vector<uint32_t> normal_offsets;
 
-    void Scene::InitAccelerationStructure()
-    {
-        quad_blas = std::make_shared<raytracing::BottomStructure>(
-            context,
-            quad_vb->GetResource(),
-            std::size(quad_vtx));
-
-        cube_blas = std::make_shared<raytracing::BottomStructure>(
-            context,
-            cube_vb->GetResource(),
-            std::size(cube_vtx),
-            cube_ib->GetResource(),
-            std::size(cube_idx));
-
-        blas_init_list.push_back(quad_blas);
-        blas_init_list.push_back(cube_blas);
-
-        blas_list.push_back(quad_blas);
-        blas_list.push_back(cube_blas);
+        for (uint32_t i = 0; i < scene.MeshCount(); i++)
+        {
+            const Scenes::MeshRecord& mesh = scene.Mesh(i);
+            const size_t vertex_floats = static_cast<size_t>(mesh.vertex_count) * 3;
+
+            normal_offsets.push_back(static_cast<uint32_t>(normals.size()));
+
+            if (mesh.index_size == sizeof(uint32_t))
+            {
+                append_normals(normals, scene.Vertices(i), mesh.vertex_count,
+                    static_cast<const uint32_t*>(scene.Indices(i)), mesh.index_count);
+            }
+            else
+            {
+                append_normals(normals, scene.Vertices(i), mesh.vertex_count,
+                    static_cast<const uint16_t*>(scene.Indices(i)), mesh.index_count);
+            }
+
+            ID3D12Resource* vb = make_and_copy(
+                scene.Vertices(i),
+                vertex_floats * sizeof(float));
+
+            ID3D12Resource* ib = nullptr;
+
+            if (mesh.index_size != 0)
+            {
+                ib = make_and_copy(
+                    scene.Indices(i),
+                    static_cast<size_t>(mesh.index_count) * mesh.index_size);
+            }
+
+            auto blas = std::make_shared<raytracing::BottomStructure>(
+                context,
+                vb,
+                vertex_floats,
+                ib,
+                ib ? mesh.index_count : 0,
+                mesh.index_size == sizeof(uint32_t) ?
+                    DXGI_FORMAT_R32_UINT : DXGI_FORMAT_R16_UINT);
+
+            blas_init_list.push_back(blas);
+            blas_list.push_back(blas);
+        }
+
+        // Never empty, a root view needs a buffer behind it.
+        normals.emplace_back(0.0f);
+        normal_offsets.push_back(0);
+
+        triangle_normals = make_and_copy(
+            normals.data(),
+            normals.size() * sizeof(glm::vec3));
+
+        mesh_normal_offsets = make_and_copy(
+            normal_offsets.data(),
+            normal_offsets.size() * sizeof(uint32_t));
+
+        return true;
     }
 
     void Scene::InitRootSignature()
@@ -136,6 +203,26 @@ namespace d3d12
                     .ShaderRegister = 0,
                     .RegisterSpace = 0
                 }
+            },
+
+            // Slot 3: SRV, triangle normals
+            {
+                .ParameterType = D3D12_ROOT_PARAMETER_TYPE_SRV,
+                .Descriptor =
+                {
+                    .ShaderRegister = 1,
+                    .RegisterSpace = 0
+                }
+            },
+
+            // Slot 4: SRV, mesh normal offsets
+            {
+                .ParameterType = D3D12_ROOT_PARAMETER_TYPE_SRV,
+                .Descriptor =
+                {
+                    .ShaderRegister = 2,
+                    .RegisterSpace = 0
+                }
             }
         };
 
@@ -346,7 +433,7 @@ namespace d3d12
 
     void Scene::Render(
         Camera& camera,
-        EntityList& entities)
+        EntityStore& entities)
     {
         context->command_list->SetPipelineState1(
             pso);
@@ -354,6 +441,15 @@ namespace d3d12
         context->command_list->SetComputeRootSignature(
             root_signature);
 
+        if (triangle_normals)
+        {
+            context->command_list->SetComputeRootShaderResourceView(
+                3, triangle_normals->GetGPUVirtualAddress());
+
+            context->command_list->SetComputeRootShaderResourceView(
+                4, mesh_normal_offsets->GetGPUVirtualAddress());
+        }
+
         const auto rt_desc = context->CurrentFrame().render_target->GetDesc();
 
         const D3D12_DISPATCH_RAYS_DESC dispatch_desc =
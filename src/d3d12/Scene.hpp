@@ -4,6 +4,7 @@
 
 #include "../Camera.hpp"
 #include "../Entities.hpp"
+#include "../SceneFile.hpp"
 #include "Context.hpp"
 
 #include "raytracing/TopStructure.hpp"
@@ -20,9 +21,15 @@ namespace d3d12
 
         void Initialize();
 
+        // Uploads every mesh of scene and queues its bottom structure for
+        // the next Render, replacing any from an earlier scene. False, with
+        // nothing replaced, when InstanceID cannot index every mesh.
+        bool SetMeshes(
+            const Scenes::SceneFile& scene);
+
         void Render(
             Camera& camera,
-            EntityList& entities);
+            EntityStore& entities);
         void Resize();
 
     private:
@@ -38,21 +45,18 @@ namespace d3d12
         void InitRootSignature();
         void InitPipeline();
 
-        D3D12MA::ResourcePtr quad_vb = nullptr;
-        D3D12MA::ResourcePtr cube_vb = nullptr;
-        D3D12MA::ResourcePtr cube_ib = nullptr;
+        // Vertex and index buffers the bottom structures reference, and the
+        // triangle normals and per mesh offsets into them the hit shaders
+        // read at t1 and t2.
+        std::vector<D3D12MA::ResourcePtr> mesh_buffers;
+        ID3D12Resource* triangle_normals = nullptr;
+        ID3D12Resource* mesh_normal_offsets = nullptr;
 
         std::shared_ptr<raytracing::TopStructure> tlas;
 
-        std::shared_ptr<raytracing::BottomStructure> cube_blas;
-        std::shared_ptr<raytracing::BottomStructure> quad_blas;
-
         std::vector<std::shared_ptr<raytracing::BottomStructure>> blas_list;
         std::vector<std::shared_ptr<raytracing::BottomStructure>> blas_init_list;
 
-        void InitMeshes();
-        void InitAccelerationStructure();
-
         void Flush();
     };
 }
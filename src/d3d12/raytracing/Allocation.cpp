@@ -9,7 +9,8 @@ namespace raytracing
         ID3D12GraphicsCommandList4* command_list,
         const D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS& inputs,
         D3D12MA::ResourcePtr& as_resource,
-        UINT64* update_scratch_size)
+        UINT64* update_scratch_size,
+        UINT64* build_scratch_size)
     {
         auto make_buffer = [&](UINT64 size, auto initial_state, D3D12MA::ResourcePtr& res)
         {
@@ -43,6 +44,11 @@ namespace raytracing
             *update_scratch_size = pre_build_info.UpdateScratchDataSizeInBytes;
         }
 
+        if (build_scratch_size)
+        {
+            *build_scratch_size = pre_build_info.ScratchDataSizeInBytes;
+        }
+
         D3D12MA::ResourcePtr scratch_resource;
 
         make_buffer(
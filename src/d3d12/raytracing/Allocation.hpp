@@ -13,6 +13,7 @@ namespace raytracing
         ID3D12GraphicsCommandList4* command_list,
         const D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS& inputs,
         D3D12MA::ResourcePtr& as_resource,
-        UINT64* update_scratch_size = nullptr);
+        UINT64* update_scratch_size = nullptr,
+        UINT64* build_scratch_size = nullptr);
 }
 }
@@ -11,7 +11,8 @@ namespace raytracing
         ID3D12Resource* vertex_buffer,
         const size_t vertex_floats,
         ID3D12Resource* index_buffer,
-        const size_t indices) :
+        const size_t indices,
+        const DXGI_FORMAT index_format) :
         context(context)
     {
         geometry_desc =
@@ -23,7 +24,7 @@ namespace raytracing
             {
                 .Transform3x4 = 0,
 
-                .IndexFormat = index_buffer ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_UNKNOWN,
+                .IndexFormat = index_buffer ? index_format : DXGI_FORMAT_UNKNOWN,
                 .VertexFormat = DXGI_FORMAT_R32G32B32_FLOAT,
                 .IndexCount = static_cast<UINT>(indices),
                 .VertexCount = static_cast<UINT>(vertex_floats) / 3,
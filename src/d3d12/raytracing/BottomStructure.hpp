@@ -22,7 +22,8 @@ namespace raytracing
             ID3D12Resource* vertex_buffer,
             const size_t vertex_floats,
             ID3D12Resource* index_buffer = nullptr,
-            const size_t indices = 0);
+            const size_t indices = 0,
+            const DXGI_FORMAT index_format = DXGI_FORMAT_R16_UINT);
         virtual ~BottomStructure() = default;
 
         void Initialize();
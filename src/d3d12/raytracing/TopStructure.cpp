@@ -1,6 +1,8 @@
 #include "TopStructure.hpp"
 
 #include "Allocation.hpp"
+#include <cassert>
+#include <algorithm>
 #include <stdexcept>
 
 #include <DirectXMath.h>
@@ -21,8 +23,8 @@ namespace raytracing
     }
 
     void TopStructure::Initialize(
-        std::vector<std::shared_ptr<raytracing::BottomStructure>>& blas_list,
-        EntityList& entities)
+        std::vector<std::shared_ptr<raytracing::BottomStructure>>& new_blas_list,
+        EntityStore& entities)
     {
         // TODO move internal to FrameResources
         for (size_t i = 0; i < FRAME_COUNT; i++)
@@ -46,8 +48,68 @@ namespace raytracing
             frame_resources[i].constants.reset(cbv_alloc);
         }
 
+        blas_list = new_blas_list;
+        policy = TopLevelPolicy();
+
+        Update(entities);
+    }
+
+    void TopStructure::WriteInstance(
+        EntityStore& entities,
+        const uint32_t index)
+    {
+        // An update cannot make an inactive instance active or the other
+        // way round, so dead and unused slots keep an acceleration
+        // structure, shrunk to a point where they were and masked out of
+        // every ray.
+        if (index >= entities.Size() || !entities.Alive(index))
+        {
+            D3D12_RAYTRACING_INSTANCE_DESC& desc = instance_data[index];
+
+            for (UINT r = 0; r < 3; ++r)
+            {
+                desc.Transform[r][0] = 0.0f;
+                desc.Transform[r][1] = 0.0f;
+                desc.Transform[r][2] = 0.0f;
+            }
+
+            desc.InstanceID = 0;
+            desc.InstanceMask = 0;
+            desc.AccelerationStructure = blas_list.empty() ?
+                0 : blas_list.front()->GetGPUVirtualAddress();
+            return;
+        }
+
+        static_assert(sizeof(instance_data->Transform) == sizeof(Transform3x4));
+
+        assert(entities.InstanceId(index) < (1u << INSTANCE_MATERIAL_BITS));
+        assert(entities.Mesh(index) < MAX_MESHES);
+
+        instance_data[index] =
+        {
+            .InstanceID = entities.InstanceId(index) | entities.Mesh(index) << INSTANCE_MATERIAL_BITS,
+            .InstanceMask = 1,
+            .AccelerationStructure = blas_list[entities.Mesh(index)]->GetGPUVirtualAddress(),
+        };
+
+        memcpy(instance_data[index].Transform, &entities.World(index), sizeof(Transform3x4));
+    }
+
+    void TopStructure::Reallocate(
+        EntityStore& entities)
+    {
+        const UINT capacity = policy.Capacity();
+
+        // Frames in flight may still trace the old structure.
+        if (instances)
+        {
+            instances->GetResource()->Unmap(0, nullptr);
+            context->CurrentFrame().ReleaseWhenFrameComplete(std::move(instances));
+            context->CurrentFrame().ReleaseWhenFrameComplete(std::move(tlas));
+        }
+
         auto instances_desc = BASIC_BUFFER_DESC;
-        instances_desc.Width = sizeof(D3D12_RAYTRACING_INSTANCE_DESC) * entities.size();
+        instances_desc.Width = sizeof(D3D12_RAYTRACING_INSTANCE_DESC) * capacity;
 
         D3D12MA::ALLOCATION_DESC allocation_desc = {};
         allocation_desc.HeapType = D3D12_HEAP_TYPE_UPLOAD;
@@ -66,41 +128,37 @@ namespace raytracing
         instances->GetResource()->Map(0, nullptr, reinterpret_cast<void**>(
             &instance_data));
 
-        for (UINT i = 0; i < entities.size(); ++i)
-        {
-            auto& entity = entities[i];
-            auto& blas = blas_list[entity.instance_id];
+        memset(instance_data, 0, sizeof(D3D12_RAYTRACING_INSTANCE_DESC) * capacity);
 
-            instance_data[i] =
-            {
-                .InstanceID = static_cast<UINT>(entity.instance_id),
-                .InstanceMask = 1,
-                .AccelerationStructure = blas->GetGPUVirtualAddress(),
-            };
+        for (UINT i = 0; i < capacity; ++i)
+        {
+            WriteInstance(entities, i);
         }
 
         D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS inputs =
         {
             .Type = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL,
             .Flags = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_ALLOW_UPDATE,
-            .NumDescs = static_cast<UINT>(entities.size()),
+            .NumDescs = capacity,
             .DescsLayout = D3D12_ELEMENTS_LAYOUT_ARRAY,
             .InstanceDescs = instances->GetResource()->GetGPUVirtualAddress()
         };
 
         UINT64 update_scratch_size = 0;
+        UINT64 build_scratch_size = 0;
 
         MakeAccelerationStructure(
             context,
             context->command_list.Get(),
             inputs,
             tlas,
-            &update_scratch_size);
+            &update_scratch_size,
+            &build_scratch_size);
 
         for (size_t i = 0; i < FRAME_COUNT; i++)
         {
             auto desc = BASIC_BUFFER_DESC;
-            desc.Width = update_scratch_size;
+            desc.Width = std::max(update_scratch_size, build_scratch_size);
             desc.Flags = D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
 
             D3D12MA::ALLOCATION_DESC allocation_desc = {};
@@ -115,7 +173,14 @@ namespace raytracing
                 &scratch_alloc,
                 __uuidof(ID3D12Resource),
                 nullptr);
-            frame_resources[i].tlas_update_scratch.reset(scratch_alloc);
+
+            if (frame_resources[i].tlas_scratch)
+            {
+                context->CurrentFrame().ReleaseWhenFrameComplete(
+                    std::move(frame_resources[i].tlas_scratch));
+            }
+
+            frame_resources[i].tlas_scratch.reset(scratch_alloc);
         }
 
         D3D12_RESOURCE_BARRIER uavBarrier = {};
@@ -127,45 +192,54 @@ namespace raytracing
     }
 
     void TopStructure::Update(
-        EntityList& entities)
+        EntityStore& entities)
     {
-        using namespace DirectX;
-        auto set = [&](const int idx, const XMMATRIX mx)
-        {
-            auto* ptr = reinterpret_cast<XMFLOAT3X4*>(
-                &instance_data[idx].Transform);
+        const std::vector<uint32_t>& changes = entities.Changes();
 
-            XMStoreFloat3x4(ptr, mx);
-        };
+        const TopLevelAction action = policy.Next(
+            static_cast<uint32_t>(entities.Size()),
+            static_cast<uint32_t>(entities.LiveCount()),
+            static_cast<uint32_t>(changes.size()));
+
+        // Nothing moved, the structure built last frame still holds.
+        if (action == TopLevelAction::None)
+            return;
 
-        for (UINT i = 0; i < entities.size(); i++)
+        if (action == TopLevelAction::Reallocate)
         {
-            const auto& entity = entities[i];
+            Reallocate(entities);
+            entities.ClearChanges();
+            return;
+        }
 
-            glm::mat4 transform;
-            transform = glm::translate(transform, entity.position);
-            transform *= mat4_cast(entity.orientation);
-            transform = glm::scale(transform, entity.scale);
+        // New and removed entities start changed, so every slot is written
+        // once. Slots past Size() are still unused from Reallocate.
+        for (const uint32_t i : changes)
+        {
+            WriteInstance(entities, i);
+        }
 
-            const DirectX::XMMATRIX dxMatrix = DirectX::XMLoadFloat4x4(
-                reinterpret_cast<const DirectX::XMFLOAT4X4*>(&transform));
+        entities.ClearChanges();
 
-            set(i, dxMatrix);
-        }
+        const bool update = action == TopLevelAction::Update;
+        const D3D12_GPU_VIRTUAL_ADDRESS address = tlas->GetResource()->GetGPUVirtualAddress();
 
         const D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_DESC desc =
         {
-            .DestAccelerationStructureData = tlas->GetResource()->GetGPUVirtualAddress(),
+            .DestAccelerationStructureData = address,
             .Inputs =
             {
                 .Type = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL,
-                .Flags = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PERFORM_UPDATE,
-                .NumDescs = static_cast<UINT>(entities.size()),
+                .Flags = update ?
+                    D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_ALLOW_UPDATE |
+                    D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PERFORM_UPDATE :
+                    D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_ALLOW_UPDATE,
+                .NumDescs = policy.Capacity(),
                 .DescsLayout = D3D12_ELEMENTS_LAYOUT_ARRAY,
                 .InstanceDescs = instances->GetResource()->GetGPUVirtualAddress()
             },
-            .SourceAccelerationStructureData = tlas->GetResource()->GetGPUVirtualAddress(),
-            .ScratchAccelerationStructureData = FrameResources().tlas_update_scratch->GetResource()->GetGPUVirtualAddress(),
+            .SourceAccelerationStructureData = update ? address : 0,
+            .ScratchAccelerationStructureData = FrameResources().tlas_scratch->GetResource()->GetGPUVirtualAddress(),
         };
 
         context->command_list->BuildRaytracingAccelerationStructure(
@@ -187,7 +261,7 @@ namespace raytracing
 
     void TopStructure::Render(
         Camera& camera,
-        EntityList& entities,
+        EntityStore& entities,
         ComPtr<ID3D12DescriptorHeap>& uav_heap,
         const D3D12_DISPATCH_RAYS_DESC& dispatch_desc)
     {
@@ -4,6 +4,8 @@
 #include "../Allocator.hpp"
 #include "../../Camera.hpp"
 #include "../../Entities.hpp"
+#include "../../TopLevelPolicy.hpp"
+#include "../../math/Transform.hpp"
 #include "BottomStructure.hpp"
 
 #include <vector>
@@ -27,12 +29,26 @@ namespace raytracing
         glm::mat4 Padding5;
     };
 
+    // InstanceID holds the material in its low INSTANCE_MATERIAL_BITS and
+    // the mesh above them, which the hit shaders find normals by.
+    constexpr UINT INSTANCE_MATERIAL_BITS = 8;
+
+    // Meshes the 24 bit InstanceID has room for, which Scene checks.
+    constexpr UINT MAX_MESHES = 1u << (24 - INSTANCE_MATERIAL_BITS);
+
     struct CurrentFrameResources
     {
-        D3D12MA::ResourcePtr tlas_update_scratch;
+        // Large enough to build or to update.
+        D3D12MA::ResourcePtr tlas_scratch;
         D3D12MA::ResourcePtr constants;
     };
 
+    // Instance buffer and TLAS sized to the policy's capacity, an instance
+    // per entity slot. Dead and unused slots are a point no ray's mask
+    // matches, so adding or removing an entity is an update like any
+    // other change. Each frame the changed instances are rewritten and the
+    // TLAS updated, rebuilt or, once the slots outgrow it, reallocated as
+    // the TopLevelPolicy decides.
     class TopStructure
     {
     private:
@@ -41,13 +57,26 @@ namespace raytracing
         CurrentFrameResources& FrameResources();
         std::array<CurrentFrameResources, FRAME_COUNT> frame_resources;
 
+        std::vector<std::shared_ptr<raytracing::BottomStructure>> blas_list;
+
         D3D12MA::ResourcePtr instances;
         D3D12_RAYTRACING_INSTANCE_DESC* instance_data = nullptr;
 
         D3D12MA::ResourcePtr tlas;
 
+        TopLevelPolicy policy;
+
+        void WriteInstance(
+            EntityStore& entities,
+            const uint32_t index);
+
+        // Replaces the instance buffer, TLAS and scratch with ones for
+        // policy.Capacity() instances and builds from every slot.
+        void Reallocate(
+            EntityStore& entities);
+
         void Update(
-            EntityList& entities);
+            EntityStore& entities);
 
     public:
         TopStructure(
@@ -56,11 +85,11 @@ namespace raytracing
 
         void Initialize(
             std::vector<std::shared_ptr<raytracing::BottomStructure>>& blas_list,
-            EntityList& entities);
+            EntityStore& entities);
 
         void Render(
             Camera& camera,
-            EntityList& entities,
+            EntityStore& entities,
             ComPtr<ID3D12DescriptorHeap>& uav_heap,
             const D3D12_DISPATCH_RAYS_DESC& dispatch_desc);
 
@@ -21,6 +21,12 @@ cbuffer Uniforms : register(b0)
 
 RaytracingAccelerationStructure scene : register(t0);
 
+// Object space normal of every triangle, mesh after mesh, and the first
+// of each mesh. InstanceID() holds the material in its low 8 bits and the
+// mesh above them, see TopStructure::WriteInstance.
+StructuredBuffer<float3> triangleNormals : register(t1);
+StructuredBuffer<uint> meshNormalOffsets : register(t2);
+
 RWTexture2D<float4> uav : register(u0);
 
 static const float3 light = float3(0, 200, 200);
@@ -85,6 +91,7 @@ void Miss(inout Payload payload)
 
 void HitCube(inout Payload payload, float2 uv);
 void HitMirror(inout Payload payload, float2 uv);
+void HitDiffuse(inout Payload payload, float2 uv);
 void HitFloor(inout Payload payload, float2 uv);
 
 [shader("closesthit")]
@@ -92,11 +99,12 @@ void ClosestHit(inout Payload payload,
                 BuiltInTriangleIntersectionAttributes attrib)
 {
 
-    switch (InstanceID())
+    switch (InstanceID() & 0xFF)
     {
         case 0: HitFloor(payload, attrib.barycentrics); break;
         case 1: HitCube(payload, attrib.barycentrics); break;
         case 2: HitMirror(payload, attrib.barycentrics); break;
+        case 3: HitDiffuse(payload, attrib.barycentrics); break;
 
         default: payload.color = float3(1, 0, 1); break;
     }
@@ -117,13 +125,35 @@ void HitCube(inout Payload payload, float2 uv)
     payload.color = color;
 }
 
+// World space normal of the triangle hit, through the inverse transpose
+// as the scale may not be uniform.
+float3 GeometricNormal()
+{
+    uint mesh = InstanceID() >> 8;
+    float3 normal = triangleNormals[meshNormalOffsets[mesh] + PrimitiveIndex()];
+
+    return normalize(mul((float3x3)WorldToObject4x3(), normal));
+}
+
+void HitDiffuse(inout Payload payload, float2 uv)
+{
+    float3 normal = GeometricNormal();
+    float3 worldNormal = faceforward(normal, WorldRayDirection(), normal);
+
+    float3 color = float3(1, 1, 1);
+
+    color *= saturate(dot(worldNormal, normalize(light))) + 0.33;
+    payload.color = color;
+}
+
 void HitMirror(inout Payload payload, float2 uv)
 {
     if (!payload.allowReflection)
         return;
 
     float3 pos = WorldRayOrigin() + WorldRayDirection() * RayTCurrent();
-    float3 normal = normalize(mul(float3(0, 1, 0), (float3x3)ObjectToWorld4x3()));
+    // Either side of the triangle reflects the same.
+    float3 normal = GeometricNormal();
     float3 reflected = reflect(normalize(WorldRayDirection()), normal);
 
     RayDesc mirrorRay;
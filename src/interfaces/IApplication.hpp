@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <functional>
 
 #include "IRenderer.hpp"
@@ -32,6 +33,9 @@ public:
 
     virtual ~IApplication() {};
 
+    // Scene file to load, the default scene when empty.
+    std::string scene_path;
+
     int window_width;
     int window_height;
 
@@ -4,6 +4,7 @@
 
 #include "../Camera.hpp"
 #include "../Entities.hpp"
+#include "../SceneFile.hpp"
 #include "../math/Math.hpp"
 
 class IRenderer
@@ -11,6 +12,13 @@ class IRenderer
 public:
     virtual void Initialize(uint32_t width, uint32_t height) = 0;
     virtual void SetSize(uint32_t width, uint32_t height) = 0;
-    virtual void Render(Camera& camera, EntityList& entities) = 0;
+
+    // Builds the meshes of scene, which must outlive the call only. False,
+    // with the scene left unset, when the renderer cannot draw it.
+    virtual bool SetScene(const Scenes::SceneFile& scene) = 0;
+
+    // Order imported meshes are converted in for this renderer's builder.
+    virtual Meshes::TriangleOrder ImportOrder() const = 0;
+    virtual void Render(Camera& camera, EntityStore& entities) = 0;
     virtual void Destroy() = 0;
 };
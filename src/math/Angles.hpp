@@ -17,12 +17,12 @@ static glm::quat quat_from_axis_angle(
         axis.z * axis.z);
 
     // zero-div may occur.
-    float s = (std::sinf(0.5f * angle) / n);
+    float s = (std::sin(0.5f * angle) / n);
 
     dest.x *= s;
     dest.y *= s;
     dest.z *= s;
-    dest.w = std::cosf(0.5f * angle);
+    dest.w = std::cos(0.5f * angle);
 
     return dest;
 }
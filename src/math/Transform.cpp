@@ -0,0 +1,283 @@
+#include "Transform.hpp"
+
+#include <cstddef>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+Transform3x4 InstanceTransform(
+    const glm::vec3& p,
+    const glm::quat& q,
+    const glm::vec3& s)
+{
+    const float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+    const float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+    const float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+    return
+    {{
+        { (1.0f - 2.0f * (yy + zz)) * s.x, 2.0f * (xy - wz) * s.y, 2.0f * (xz + wy) * s.z, p.x },
+        { 2.0f * (xy + wz) * s.x, (1.0f - 2.0f * (xx + zz)) * s.y, 2.0f * (yz - wx) * s.z, p.y },
+        { 2.0f * (xz - wy) * s.x, 2.0f * (yz + wx) * s.y, (1.0f - 2.0f * (xx + yy)) * s.z, p.z }
+    }};
+}
+
+Transform3x4 InverseInstanceTransform(
+    const glm::vec3& p,
+    const glm::quat& q,
+    const glm::vec3& s)
+{
+    const float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+    const float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+    const float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+    // Rows of the transposed rotation over the scale, then -R^T p / s.
+    const glm::vec3 r0 = glm::vec3(1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy)) * (1.0f / s.x);
+    const glm::vec3 r1 = glm::vec3(2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx)) * (1.0f / s.y);
+    const glm::vec3 r2 = glm::vec3(2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy)) * (1.0f / s.z);
+
+    return
+    {{
+        { r0.x, r0.y, r0.z, -glm::dot(r0, p) },
+        { r1.x, r1.y, r1.z, -glm::dot(r1, p) },
+        { r2.x, r2.y, r2.z, -glm::dot(r2, p) }
+    }};
+}
+
+glm::mat4 ToMat4(const Transform3x4& t)
+{
+    return glm::mat4(
+        t.m[0][0], t.m[1][0], t.m[2][0], 0.0f,
+        t.m[0][1], t.m[1][1], t.m[2][1], 0.0f,
+        t.m[0][2], t.m[1][2], t.m[2][2], 0.0f,
+        t.m[0][3], t.m[1][3], t.m[2][3], 1.0f);
+}
+
+Transform3x4 Multiply(
+    const Transform3x4& a,
+    const Transform3x4& b)
+{
+    Transform3x4 result;
+
+    for (int r = 0; r < 3; r++)
+    {
+        for (int c = 0; c < 4; c++)
+        {
+            result.m[r][c] =
+                a.m[r][0] * b.m[0][c] +
+                a.m[r][1] * b.m[1][c] +
+                a.m[r][2] * b.m[2][c];
+        }
+
+        result.m[r][3] += a.m[r][3];
+    }
+
+    return result;
+}
+
+Transform3x4 Inverse(const Transform3x4& t)
+{
+    const float (&m)[3][4] = t.m;
+
+    // Adjugate over the determinant of the 3x3 part.
+    const float c00 = m[1][1] * m[2][2] - m[1][2] * m[2][1];
+    const float c01 = m[1][2] * m[2][0] - m[1][0] * m[2][2];
+    const float c02 = m[1][0] * m[2][1] - m[1][1] * m[2][0];
+
+    const float inverse_det = 1.0f / (m[0][0] * c00 + m[0][1] * c01 + m[0][2] * c02);
+
+    Transform3x4 result;
+
+    result.m[0][0] = c00 * inverse_det;
+    result.m[0][1] = (m[0][2] * m[2][1] - m[0][1] * m[2][2]) * inverse_det;
+    result.m[0][2] = (m[0][1] * m[1][2] - m[0][2] * m[1][1]) * inverse_det;
+    result.m[1][0] = c01 * inverse_det;
+    result.m[1][1] = (m[0][0] * m[2][2] - m[0][2] * m[2][0]) * inverse_det;
+    result.m[1][2] = (m[0][2] * m[1][0] - m[0][0] * m[1][2]) * inverse_det;
+    result.m[2][0] = c02 * inverse_det;
+    result.m[2][1] = (m[0][1] * m[2][0] - m[0][0] * m[2][1]) * inverse_det;
+    result.m[2][2] = (m[0][0] * m[1][1] - m[0][1] * m[1][0]) * inverse_det;
+
+    for (int r = 0; r < 3; r++)
+    {
+        result.m[r][3] = -(
+            result.m[r][0] * m[0][3] +
+            result.m[r][1] * m[1][3] +
+            result.m[r][2] * m[2][3]);
+    }
+
+    return result;
+}
+
+#if defined(__AVX2__)
+
+// Twelve registers of one element for eight instances to eight 3x4s.
+static void StoreTransposed(
+    const __m256 (&e)[12],
+    Transform3x4* out)
+{
+    // Rows 0 and 1 are eight contiguous floats per instance, an 8x8
+    // transpose.
+    __m256 t[8];
+    __m256 s[8];
+
+    for (int k = 0; k < 8; k += 2)
+    {
+        t[k] = _mm256_unpacklo_ps(e[k], e[k + 1]);
+        t[k + 1] = _mm256_unpackhi_ps(e[k], e[k + 1]);
+    }
+
+    for (int k = 0; k < 8; k += 4)
+    {
+        s[k] = _mm256_shuffle_ps(t[k], t[k + 2], 0x44);
+        s[k + 1] = _mm256_shuffle_ps(t[k], t[k + 2], 0xEE);
+        s[k + 2] = _mm256_shuffle_ps(t[k + 1], t[k + 3], 0x44);
+        s[k + 3] = _mm256_shuffle_ps(t[k + 1], t[k + 3], 0xEE);
+    }
+
+    for (int i = 0; i < 4; i++)
+    {
+        _mm256_storeu_ps(&out[i].m[0][0], _mm256_permute2f128_ps(s[i], s[i + 4], 0x20));
+        _mm256_storeu_ps(&out[i + 4].m[0][0], _mm256_permute2f128_ps(s[i], s[i + 4], 0x31));
+    }
+
+    // Row 2 is a 4x4 transpose in each half, instance i low, i + 4 high.
+    const __m256 lo01 = _mm256_unpacklo_ps(e[8], e[9]);
+    const __m256 hi01 = _mm256_unpackhi_ps(e[8], e[9]);
+    const __m256 lo23 = _mm256_unpacklo_ps(e[10], e[11]);
+    const __m256 hi23 = _mm256_unpackhi_ps(e[10], e[11]);
+
+    const __m256 rows[4] =
+    {
+        _mm256_shuffle_ps(lo01, lo23, 0x44),
+        _mm256_shuffle_ps(lo01, lo23, 0xEE),
+        _mm256_shuffle_ps(hi01, hi23, 0x44),
+        _mm256_shuffle_ps(hi01, hi23, 0xEE)
+    };
+
+    for (int i = 0; i < 4; i++)
+    {
+        _mm_storeu_ps(out[i].m[2], _mm256_castps256_ps128(rows[i]));
+        _mm_storeu_ps(out[i + 4].m[2], _mm256_extractf128_ps(rows[i], 1));
+    }
+}
+
+#endif
+
+void InstanceTransforms(
+    const glm::vec3* positions,
+    const glm::quat* orientations,
+    const glm::vec3* scales,
+    const uint32_t* indices,
+    const size_t count,
+    Transform3x4* object_to_world,
+    Transform3x4* world_to_object)
+{
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    static_assert(sizeof(glm::vec3) == 3 * sizeof(float));
+    static_assert(sizeof(glm::quat) == 4 * sizeof(float));
+    static_assert(offsetof(glm::quat, x) == 0 && offsetof(glm::quat, w) == 3 * sizeof(float));
+
+    const float* p = reinterpret_cast<const float*>(positions);
+    const float* q = reinterpret_cast<const float*>(orientations);
+    const float* s = reinterpret_cast<const float*>(scales);
+
+    const __m256i sequence = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i three = _mm256_set1_epi32(3);
+
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 two = _mm256_set1_ps(2.0f);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256i index = indices ?
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i)) :
+            _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(i)), sequence);
+
+        const __m256i vec3_offset = _mm256_mullo_epi32(index, three);
+        const __m256i quat_offset = _mm256_slli_epi32(index, 2);
+
+        const __m256 px = _mm256_i32gather_ps(p, vec3_offset, 4);
+        const __m256 py = _mm256_i32gather_ps(p + 1, vec3_offset, 4);
+        const __m256 pz = _mm256_i32gather_ps(p + 2, vec3_offset, 4);
+
+        const __m256 qx = _mm256_i32gather_ps(q, quat_offset, 4);
+        const __m256 qy = _mm256_i32gather_ps(q + 1, quat_offset, 4);
+        const __m256 qz = _mm256_i32gather_ps(q + 2, quat_offset, 4);
+        const __m256 qw = _mm256_i32gather_ps(q + 3, quat_offset, 4);
+
+        const __m256 sx = _mm256_i32gather_ps(s, vec3_offset, 4);
+        const __m256 sy = _mm256_i32gather_ps(s + 1, vec3_offset, 4);
+        const __m256 sz = _mm256_i32gather_ps(s + 2, vec3_offset, 4);
+
+        const __m256 xx = _mm256_mul_ps(qx, qx);
+        const __m256 yy = _mm256_mul_ps(qy, qy);
+        const __m256 zz = _mm256_mul_ps(qz, qz);
+        const __m256 xy = _mm256_mul_ps(qx, qy);
+        const __m256 xz = _mm256_mul_ps(qx, qz);
+        const __m256 yz = _mm256_mul_ps(qy, qz);
+        const __m256 wx = _mm256_mul_ps(qw, qx);
+        const __m256 wy = _mm256_mul_ps(qw, qy);
+        const __m256 wz = _mm256_mul_ps(qw, qz);
+
+        // Rotation element r, c as in InstanceTransform.
+        const __m256 r00 = _mm256_fnmadd_ps(two, _mm256_add_ps(yy, zz), one);
+        const __m256 r01 = _mm256_mul_ps(two, _mm256_sub_ps(xy, wz));
+        const __m256 r02 = _mm256_mul_ps(two, _mm256_add_ps(xz, wy));
+        const __m256 r10 = _mm256_mul_ps(two, _mm256_add_ps(xy, wz));
+        const __m256 r11 = _mm256_fnmadd_ps(two, _mm256_add_ps(xx, zz), one);
+        const __m256 r12 = _mm256_mul_ps(two, _mm256_sub_ps(yz, wx));
+        const __m256 r20 = _mm256_mul_ps(two, _mm256_sub_ps(xz, wy));
+        const __m256 r21 = _mm256_mul_ps(two, _mm256_add_ps(yz, wx));
+        const __m256 r22 = _mm256_fnmadd_ps(two, _mm256_add_ps(xx, yy), one);
+
+        const __m256 forward[12] =
+        {
+            _mm256_mul_ps(r00, sx), _mm256_mul_ps(r01, sy), _mm256_mul_ps(r02, sz), px,
+            _mm256_mul_ps(r10, sx), _mm256_mul_ps(r11, sy), _mm256_mul_ps(r12, sz), py,
+            _mm256_mul_ps(r20, sx), _mm256_mul_ps(r21, sy), _mm256_mul_ps(r22, sz), pz
+        };
+
+        StoreTransposed(forward, object_to_world + i);
+
+        if (!world_to_object)
+            continue;
+
+        // Row r is column r of the rotation over scale r.
+        const __m256 ix = _mm256_div_ps(one, sx);
+        const __m256 iy = _mm256_div_ps(one, sy);
+        const __m256 iz = _mm256_div_ps(one, sz);
+
+        __m256 inverse[12] =
+        {
+            _mm256_mul_ps(r00, ix), _mm256_mul_ps(r10, ix), _mm256_mul_ps(r20, ix), _mm256_setzero_ps(),
+            _mm256_mul_ps(r01, iy), _mm256_mul_ps(r11, iy), _mm256_mul_ps(r21, iy), _mm256_setzero_ps(),
+            _mm256_mul_ps(r02, iz), _mm256_mul_ps(r12, iz), _mm256_mul_ps(r22, iz), _mm256_setzero_ps()
+        };
+
+        for (int r = 0; r < 3; r++)
+        {
+            const __m256 dot = _mm256_fmadd_ps(inverse[r * 4], px,
+                _mm256_fmadd_ps(inverse[r * 4 + 1], py,
+                    _mm256_mul_ps(inverse[r * 4 + 2], pz)));
+
+            inverse[r * 4 + 3] = _mm256_sub_ps(_mm256_setzero_ps(), dot);
+        }
+
+        StoreTransposed(inverse, world_to_object + i);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        const size_t e = indices ? indices[i] : i;
+
+        object_to_world[i] = InstanceTransform(positions[e], orientations[e], scales[e]);
+
+        if (world_to_object)
+            world_to_object[i] = InverseInstanceTransform(positions[e], orientations[e], scales[e]);
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Math.hpp"
+
+// Row major 3x4 affine transform, the layout of the Transform member of
+// D3D12_RAYTRACING_INSTANCE_DESC.
+struct Transform3x4
+{
+    float m[3][4];
+};
+
+// translate(position) * mat4_cast(orientation) * scale(scale).
+Transform3x4 InstanceTransform(
+    const glm::vec3& position,
+    const glm::quat& orientation,
+    const glm::vec3& scale);
+
+// The inverse of InstanceTransform, scale(1 / scale) *
+// mat4_cast(conjugate(orientation)) * translate(-position).
+Transform3x4 InverseInstanceTransform(
+    const glm::vec3& position,
+    const glm::quat& orientation,
+    const glm::vec3& scale);
+
+glm::mat4 ToMat4(const Transform3x4& transform);
+
+// parent * local, local applied first.
+Transform3x4 Multiply(
+    const Transform3x4& parent,
+    const Transform3x4& local);
+
+// Inverse of any invertible affine transform, including the shear of a
+// non-uniform scale under a rotated parent.
+Transform3x4 Inverse(const Transform3x4& transform);
+
+// InstanceTransform of entity indices[i], or entity i when indices is
+// null, into object_to_world[i] for count entities, eight at a time with
+// AVX2 when the compiler targets it. world_to_object may be null.
+void InstanceTransforms(
+    const glm::vec3* positions,
+    const glm::quat* orientations,
+    const glm::vec3* scales,
+    const uint32_t* indices,
+    const size_t count,
+    Transform3x4* object_to_world,
+    Transform3x4* world_to_object = nullptr);
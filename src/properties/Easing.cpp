@@ -1,5 +1,7 @@
 #include "Easing.hpp"
 
+#include <immintrin.h>
+
 namespace Properties
 {
     float Ease(const EasingFunction func, const float t)
@@ -40,4 +42,151 @@ namespace Properties
         }
         return 0;
     }
+
+    // Same polynomials as Ease() above on eight values.
+    template<typename Curve>
+    static void EaseBatch(
+        const float* t,
+        float* eased,
+        const size_t count,
+        const EasingFunction func,
+        const Curve& curve)
+    {
+        size_t i = 0;
+
+        for (; i + 8 <= count; i += 8)
+        {
+            _mm256_storeu_ps(eased + i, curve(_mm256_loadu_ps(t + i)));
+        }
+
+        for (; i < count; i++)
+        {
+            eased[i] = Ease(func, t[i]);
+        }
+    }
+
+    void Ease(
+        const EasingFunction func,
+        const float* t,
+        float* eased,
+        const size_t count)
+    {
+        const __m256 one = _mm256_set1_ps(1.0f);
+        const __m256 two = _mm256_set1_ps(2.0f);
+        const __m256 four = _mm256_set1_ps(4.0f);
+        const __m256 eight = _mm256_set1_ps(8.0f);
+        const __m256 sixteen = _mm256_set1_ps(16.0f);
+        const __m256 half = _mm256_set1_ps(0.5f);
+
+        auto first_half = [&](const __m256 x)
+        {
+            return _mm256_cmp_ps(x, half, _CMP_LT_OQ);
+        };
+
+        switch (func)
+        {
+        case EasingFunction::Linear:
+            EaseBatch(t, eased, count, func, [&](const __m256 x)
+            {
+                return x;
+            });
+            break;
+        case EasingFunction::EaseInQuad:
+            EaseBatch(t, eased, count, func, [&](const __m256 x)
+            {
+                return _mm256_mul_ps(x, x);
+            });
+            break;
+        case EasingFunction::EaseOutQuad:
+            EaseBatch(t, eased, count, func, [&](const __m256 x)
+            {
+                return _mm256_mul_ps(x, _mm256_sub_ps(two, x));
+            });
+            break;
+        case EasingFunction::EaseInOutQuad:
+            EaseBatch(t, eased, count, func, [&](const __m256 x)
+            {
+                const __m256 in = _mm256_mul_ps(_mm256_mul_ps(two, x), x);
+                const __m256 out = _mm256_fmadd_ps(
+                    _mm256_fnmadd_ps(two, x, four), x, _mm256_set1_ps(-1.0f));
+                return _mm256_blendv_ps(out, in, first_half(x));
+            });
+            break;
+        case EasingFunction::EaseInCubic:
+            EaseBatch(t, eased, count, func, [&](const __m256 x)
+            {
+                return _mm256_mul_ps(_mm256_mul_ps(x, x), x);
+            });
+            break;
+        case EasingFunction::EaseOutCubic:
+            EaseBatch(t, eased, count, func, [&](const __m256 x)
+            {
+                const __m256 k = _mm256_sub_ps(x, one);
+                return _mm256_fmadd_ps(_mm256_mul_ps(k, k), k, one);
+            });
+            break;
+        case EasingFunction::EaseInOutCubic:
+            EaseBatch(t, eased, count, func, [&](const __m256 x)
+            {
+                const __m256 in = _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(four, x), x), x);
+                const __m256 k = _mm256_sub_ps(x, one);
+                const __m256 k2 = _mm256_fmsub_ps(two, x, two);
+                const __m256 out = _mm256_fmadd_ps(_mm256_mul_ps(k, k2), k2, one);
+                return _mm256_blendv_ps(out, in, first_half(x));
+            });
+            break;
+        case EasingFunction::EaseInQuart:
+            EaseBatch(t, eased, count, func, [&](const __m256 x)
+            {
+                const __m256 x2 = _mm256_mul_ps(x, x);
+                return _mm256_mul_ps(x2, x2);
+            });
+            break;
+        case EasingFunction::EaseOutQuart:
+            EaseBatch(t, eased, count, func, [&](const __m256 x)
+            {
+                const __m256 k = _mm256_sub_ps(x, one);
+                const __m256 k2 = _mm256_mul_ps(k, k);
+                return _mm256_fnmadd_ps(k2, k2, one);
+            });
+            break;
+        case EasingFunction::EaseInOutQuart:
+            EaseBatch(t, eased, count, func, [&](const __m256 x)
+            {
+                const __m256 x2 = _mm256_mul_ps(x, x);
+                const __m256 in = _mm256_mul_ps(_mm256_mul_ps(eight, x2), x2);
+                const __m256 k = _mm256_sub_ps(x, one);
+                const __m256 k2 = _mm256_mul_ps(k, k);
+                const __m256 out = _mm256_fnmadd_ps(_mm256_mul_ps(eight, k2), k2, one);
+                return _mm256_blendv_ps(out, in, first_half(x));
+            });
+            break;
+        case EasingFunction::EaseInQuint:
+            EaseBatch(t, eased, count, func, [&](const __m256 x)
+            {
+                const __m256 x2 = _mm256_mul_ps(x, x);
+                return _mm256_mul_ps(_mm256_mul_ps(x2, x2), x);
+            });
+            break;
+        case EasingFunction::EaseOutQuint:
+            EaseBatch(t, eased, count, func, [&](const __m256 x)
+            {
+                const __m256 k = _mm256_sub_ps(x, one);
+                const __m256 k3 = _mm256_mul_ps(_mm256_mul_ps(k, k), k);
+                return _mm256_fmadd_ps(_mm256_mul_ps(k3, x), x, one);
+            });
+            break;
+        case EasingFunction::EaseInOutQuint:
+            EaseBatch(t, eased, count, func, [&](const __m256 x)
+            {
+                const __m256 x2 = _mm256_mul_ps(x, x);
+                const __m256 in = _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(sixteen, x2), x2), x);
+                const __m256 k = _mm256_sub_ps(x, one);
+                const __m256 k2 = _mm256_mul_ps(k, k);
+                const __m256 out = _mm256_fmadd_ps(_mm256_mul_ps(_mm256_mul_ps(sixteen, k2), k2), k, one);
+                return _mm256_blendv_ps(out, in, first_half(x));
+            });
+            break;
+        }
+    }
 }
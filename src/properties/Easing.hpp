@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+
 namespace Properties
 {
     enum class EasingFunction
@@ -19,5 +21,15 @@ namespace Properties
         EaseInOutQuint
     };
 
+    constexpr size_t EASING_COUNT = static_cast<size_t>(EasingFunction::EaseInOutQuint) + 1;
+
     float Ease(const EasingFunction func, const float t);
+
+    // Ease(func, t[i]) for count values, eight at a time with AVX2. t and
+    // eased may alias.
+    void Ease(
+        const EasingFunction func,
+        const float* t,
+        float* eased,
+        const size_t count);
 }
@@ -0,0 +1,146 @@
+#include "Engine.hpp"
+
+#include <algorithm>
+
+namespace Properties
+{
+    uint32_t Engine::AddCallback(Callback&& callback)
+    {
+        if (!callback)
+            return NO_EVENT;
+
+        if (free_callbacks.empty())
+        {
+            callbacks.push_back(std::move(callback));
+            return static_cast<uint32_t>(callbacks.size() - 1);
+        }
+
+        const uint32_t id = free_callbacks.back();
+        free_callbacks.pop_back();
+        callbacks[id] = std::move(callback);
+        return id;
+    }
+
+    void Engine::DispatchEvents()
+    {
+        for (const uint32_t id : events)
+        {
+            // Moved out first, the callback may add callbacks and grow the list.
+            Callback callback = std::move(callbacks[id]);
+            callbacks[id] = nullptr;
+            free_callbacks.push_back(id);
+
+            callback();
+        }
+
+        events.clear();
+    }
+
+    // Tweens per job, large enough to amortise the scheduling of a job.
+    static constexpr uint32_t CHUNK_SIZE = 4096;
+
+    template<typename T>
+    void Engine::AddChunks(
+        const uint8_t pool_index,
+        const Pool<T>& pool)
+    {
+        for (size_t f = 0; f < EASING_COUNT; f++)
+        {
+            const uint32_t count = static_cast<uint32_t>(
+                pool.Size(static_cast<EasingFunction>(f)));
+
+            for (uint32_t first = 0; first < count; first += CHUNK_SIZE)
+            {
+                chunks.push_back({
+                    pool_index,
+                    static_cast<uint8_t>(f),
+                    first,
+                    std::min(first + CHUNK_SIZE, count) });
+            }
+        }
+    }
+
+    void Engine::Advance(
+        const float time_step,
+        cpu::Scheduler& scheduler)
+    {
+        chunks.clear();
+        AddChunks(0, floats);
+        AddChunks(1, vectors);
+        AddChunks(2, rotations);
+
+        finished.assign(chunks.size(), 0);
+
+        scheduler.ParallelFor(
+            static_cast<uint32_t>(chunks.size()),
+            [&](const uint32_t index)
+            {
+                const Chunk& chunk = chunks[index];
+                const auto func = static_cast<EasingFunction>(chunk.func);
+
+                switch (chunk.pool)
+                {
+                case 0:
+                    finished[index] = static_cast<uint32_t>(
+                        floats.Advance(func, chunk.first, chunk.last, time_step));
+                    break;
+                case 1:
+                    finished[index] = static_cast<uint32_t>(
+                        vectors.Advance(func, chunk.first, chunk.last, time_step));
+                    break;
+                case 2:
+                    finished[index] = static_cast<uint32_t>(
+                        rotations.Advance(func, chunk.first, chunk.last, time_step));
+                    break;
+                }
+            });
+    }
+
+    void Engine::Compact()
+    {
+        // Chunks of one set are consecutive, compact each set once if any
+        // of its chunks saw a tween finish.
+        for (size_t i = 0; i < chunks.size();)
+        {
+            const Chunk& chunk = chunks[i];
+            uint32_t set_finished = 0;
+
+            size_t j = i;
+            for (; j < chunks.size() && chunks[j].pool == chunk.pool && chunks[j].func == chunk.func; j++)
+            {
+                set_finished += finished[j];
+            }
+
+            if (set_finished != 0)
+            {
+                const auto func = static_cast<EasingFunction>(chunk.func);
+
+                switch (chunk.pool)
+                {
+                case 0: floats.Compact(func, events); break;
+                case 1: vectors.Compact(func, events); break;
+                case 2: rotations.Compact(func, events); break;
+                }
+            }
+
+            i = j;
+        }
+
+        chunks.clear();
+        finished.clear();
+    }
+
+    void Engine::Update(const float time_step)
+    {
+        floats.Update(time_step, events);
+        vectors.Update(time_step, events);
+        rotations.Update(time_step, events);
+
+        DispatchEvents();
+    }
+
+    size_t Engine::TweenCount() const
+    {
+        return floats.Size() + vectors.Size() + rotations.Size();
+    }
+}
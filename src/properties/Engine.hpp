@@ -0,0 +1,89 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include "Pool.hpp"
+#include "Easing.hpp"
+#include "IProperty.hpp"
+
+#include "../cpu/Scheduler.hpp"
+
+namespace Properties
+{
+    // Data oriented replacement for Manager and Property<T>. Tweens write
+    // straight into caller owned values, which must outlive them. Callbacks
+    // run after every pool has updated, so they may start new tweens.
+    class Engine
+    {
+    private:
+        Pool<float> floats;
+        Pool<glm::vec3> vectors;
+        Pool<glm::quat> rotations;
+
+        std::vector<Callback> callbacks;
+        std::vector<uint32_t> free_callbacks;
+        std::vector<uint32_t> events;
+
+        // A range of one easing set of one pool, for Advance.
+        struct Chunk
+        {
+            uint8_t pool;
+            uint8_t func;
+            uint32_t first;
+            uint32_t last;
+        };
+
+        std::vector<Chunk> chunks;
+        std::vector<uint32_t> finished;
+
+        uint32_t AddCallback(Callback&& callback);
+
+        template<typename T>
+        void AddChunks(
+            const uint8_t pool_index,
+            const Pool<T>& pool);
+
+        template<typename T>
+        Pool<T>& PoolFor();
+
+    public:
+        Engine() = default;
+        Engine(const Engine&) = delete;
+
+        template<typename T>
+        void Animate(
+            T* value,
+            const T start,
+            const T end,
+            const float seconds,
+            const EasingFunction func,
+            Callback callback = nullptr)
+        {
+            PoolFor<T>().Add(
+                value, start, end, seconds, func,
+                AddCallback(std::move(callback)));
+        }
+
+        void Update(const float time_step);
+
+        // Steps every tween in chunks on scheduler, returning once all are
+        // done. Finished tweens stay until Compact.
+        void Advance(
+            const float time_step,
+            cpu::Scheduler& scheduler);
+
+        // Drops the tweens the last Advance finished and queues their
+        // callbacks for DispatchEvents.
+        void Compact();
+
+        // Runs the callbacks of tweens finished since the last dispatch.
+        void DispatchEvents();
+
+        size_t TweenCount() const;
+    };
+
+    template<> inline Pool<float>& Engine::PoolFor<float>() { return floats; }
+    template<> inline Pool<glm::vec3>& Engine::PoolFor<glm::vec3>() { return vectors; }
+    template<> inline Pool<glm::quat>& Engine::PoolFor<glm::quat>() { return rotations; }
+}
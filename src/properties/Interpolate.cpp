@@ -0,0 +1,166 @@
+#include "Interpolate.hpp"
+
+#include <cmath>
+#include <immintrin.h>
+
+namespace Properties
+{
+    void Interpolate(
+        const float* origin,
+        const float* target,
+        const float* t,
+        float* result,
+        const size_t count)
+    {
+        size_t i = 0;
+
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256 a = _mm256_loadu_ps(origin + i);
+            const __m256 b = _mm256_loadu_ps(target + i);
+            const __m256 x = _mm256_loadu_ps(t + i);
+
+            _mm256_storeu_ps(result + i, _mm256_fmadd_ps(_mm256_sub_ps(b, a), x, a));
+        }
+
+        for (; i < count; i++)
+        {
+            result[i] = Interpolate(origin[i], target[i], t[i]);
+        }
+    }
+
+    void Interpolate(
+        const glm::vec3* origin,
+        const glm::vec3* target,
+        const float* t,
+        glm::vec3* result,
+        const size_t count)
+    {
+        static_assert(sizeof(glm::vec3) == 3 * sizeof(float));
+
+        // Eight packed vec3s span three registers, each lane takes the t of
+        // the vector it belongs to.
+        const __m256i spread[3] =
+        {
+            _mm256_setr_epi32(0, 0, 0, 1, 1, 1, 2, 2),
+            _mm256_setr_epi32(2, 3, 3, 3, 4, 4, 4, 5),
+            _mm256_setr_epi32(5, 5, 6, 6, 6, 7, 7, 7)
+        };
+
+        const float* a = reinterpret_cast<const float*>(origin);
+        const float* b = reinterpret_cast<const float*>(target);
+        float* r = reinterpret_cast<float*>(result);
+
+        size_t i = 0;
+
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256 x = _mm256_loadu_ps(t + i);
+
+            for (size_t j = 0; j < 3; j++)
+            {
+                const size_t offset = i * 3 + j * 8;
+                const __m256 va = _mm256_loadu_ps(a + offset);
+                const __m256 vb = _mm256_loadu_ps(b + offset);
+                const __m256 vx = _mm256_permutevar8x32_ps(x, spread[j]);
+
+                _mm256_storeu_ps(r + offset, _mm256_fmadd_ps(_mm256_sub_ps(vb, va), vx, va));
+            }
+        }
+
+        for (; i < count; i++)
+        {
+            result[i] = Interpolate(origin[i], target[i], t[i]);
+        }
+    }
+
+    glm::quat Nlerp(
+        const glm::quat origin,
+        const glm::quat target,
+        const float t)
+    {
+        const float cos_theta = glm::dot(origin, target);
+
+        if (std::abs(cos_theta) < NLERP_MIN_COS)
+            return glm::slerp(origin, target, t);
+
+        const glm::quat shorter = cos_theta < 0.0f ? -target : target;
+        return glm::normalize(origin * (1.0f - t) + shorter * t);
+    }
+
+    void Interpolate(
+        const glm::quat* origin,
+        const glm::quat* target,
+        const float* t,
+        glm::quat* result,
+        const size_t count)
+    {
+        static_assert(sizeof(glm::quat) == 4 * sizeof(float));
+
+        const __m256 sign_bit = _mm256_set1_ps(-0.0f);
+        const __m256 min_cos = _mm256_set1_ps(NLERP_MIN_COS);
+
+        // Two quaternions per register, four registers per eight.
+        const __m256i spread[4] =
+        {
+            _mm256_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1),
+            _mm256_setr_epi32(2, 2, 2, 2, 3, 3, 3, 3),
+            _mm256_setr_epi32(4, 4, 4, 4, 5, 5, 5, 5),
+            _mm256_setr_epi32(6, 6, 6, 6, 7, 7, 7, 7)
+        };
+
+        // Sum of each quaternion's four lanes, broadcast back to all four.
+        auto dot = [](const __m256 a, const __m256 b)
+        {
+            const __m256 m = _mm256_mul_ps(a, b);
+            const __m256 h = _mm256_hadd_ps(m, m);
+            return _mm256_hadd_ps(h, h);
+        };
+
+        const float* a = reinterpret_cast<const float*>(origin);
+        const float* b = reinterpret_cast<const float*>(target);
+        float* r = reinterpret_cast<float*>(result);
+
+        size_t i = 0;
+
+        for (; i + 8 <= count; i += 8)
+        {
+            const __m256 x = _mm256_loadu_ps(t + i);
+
+            for (size_t j = 0; j < 4; j++)
+            {
+                const size_t offset = i * 4 + j * 8;
+                const __m256 va = _mm256_loadu_ps(a + offset);
+                const __m256 vb = _mm256_loadu_ps(b + offset);
+                const __m256 vx = _mm256_permutevar8x32_ps(x, spread[j]);
+
+                const __m256 cos_theta = dot(va, vb);
+                const __m256 shorter = _mm256_xor_ps(vb, _mm256_and_ps(cos_theta, sign_bit));
+
+                const __m256 lerp = _mm256_fmadd_ps(_mm256_sub_ps(shorter, va), vx, va);
+                const __m256 length = _mm256_sqrt_ps(dot(lerp, lerp));
+
+                _mm256_storeu_ps(r + offset, _mm256_div_ps(lerp, length));
+
+                const __m256 close = _mm256_cmp_ps(
+                    _mm256_andnot_ps(sign_bit, cos_theta), min_cos, _CMP_GE_OQ);
+                const int mask = _mm256_movemask_ps(close);
+
+                // Lane 0 and 4 speak for each quaternion.
+                for (size_t q = 0; q < 2; q++)
+                {
+                    if ((mask & (1 << (q * 4))) == 0)
+                    {
+                        const size_t k = i + j * 2 + q;
+                        result[k] = glm::slerp(origin[k], target[k], t[k]);
+                    }
+                }
+            }
+        }
+
+        for (; i < count; i++)
+        {
+            result[i] = Nlerp(origin[i], target[i], t[i]);
+        }
+    }
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+
+#include "../math/Math.hpp"
+
+namespace Properties
+{
+    template<class A> A Interpolate(
+        const A origin,
+        const A target,
+        const float t)
+    {
+        return origin + ((target - origin) * t);
+    }
+
+    inline glm::quat Interpolate(
+        const glm::quat origin,
+        const glm::quat target,
+        const float t)
+    {
+        return glm::slerp(origin, target, t);
+    }
+
+    // Interpolate(origin[i], target[i], t[i]) for count values, eight at a
+    // time with AVX2. result must not alias origin or target.
+    void Interpolate(
+        const float* origin,
+        const float* target,
+        const float* t,
+        float* result,
+        const size_t count);
+
+    void Interpolate(
+        const glm::vec3* origin,
+        const glm::vec3* target,
+        const float* t,
+        glm::vec3* result,
+        const size_t count);
+
+    // Above this |dot|, rotations under about 28 degrees apart, nlerp stays
+    // within 5e-4 radians of the slerp rotation.
+    constexpr float NLERP_MIN_COS = 0.97f;
+
+    // Normalised lerp along the shorter arc for rotations closer than
+    // NLERP_MIN_COS, slerp for the ones that are not.
+    glm::quat Nlerp(
+        const glm::quat origin,
+        const glm::quat target,
+        const float t);
+
+    // Nlerp() for count values, eight at a time.
+    void Interpolate(
+        const glm::quat* origin,
+        const glm::quat* target,
+        const float* t,
+        glm::quat* result,
+        const size_t count);
+}
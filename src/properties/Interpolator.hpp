@@ -61,10 +61,14 @@ namespace Properties
         T Update(const float time_step)
         {
             time += time_step;
-            float percent = time / duration;
+
+            // Finished on time rather than on Ease() reaching 1, easings
+            // such as EaseOutQuad fall back below 1 past the end.
+            const float percent = time >= duration ?
+                1.0f : time / duration;
             float t = Ease(func, percent);
 
-            if (t >= 1.0f)
+            if (percent >= 1.0f)
             {
                 complete = true;
                 t = 1.0f;
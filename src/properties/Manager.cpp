@@ -7,26 +7,34 @@ namespace Properties
         properties.push_back(property);
     }
 
+    size_t Manager::PropertyCount() const
+    {
+        return properties.size();
+    }
+
     void Manager::Update(const float time_step)
     {
-        std::vector<size_t> removals;
+        // Stable compaction in one pass. Indexed, since callbacks may Add
+        // properties while it runs, and those are updated this frame too.
+        size_t kept = 0;
 
         for (size_t i = 0; i < properties.size(); i++)
         {
             IProperty* p = properties[i];
+
             if (p->InterpolatorCount() != 0)
             {
                 p->Update(time_step);
             }
-            else
+
+            // Dropped as soon as it finishes, so a later Animate adds it
+            // back exactly once.
+            if (p->InterpolatorCount() != 0)
             {
-                removals.push_back(i);
+                properties[kept++] = p;
             }
         }
 
-        for (auto& index : removals)
-        {
-            properties.erase(properties.begin() + index);
-        }
+        properties.erase(properties.begin() + kept, properties.end());
     }
 }
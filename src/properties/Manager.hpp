@@ -18,5 +18,7 @@ namespace Properties
 
         void Add(IProperty* property);
         void Update(const float time_step);
+
+        size_t PropertyCount() const;
     };
 }
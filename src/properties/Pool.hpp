@@ -0,0 +1,177 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#include "Easing.hpp"
+#include "Interpolate.hpp"
+
+namespace Properties
+{
+    constexpr uint32_t NO_EVENT = UINT32_MAX;
+
+    // Every running tween of one value type as parallel arrays, one set per
+    // easing function so each set eases and interpolates in batches. Advance
+    // writes through target and may run on disjoint ranges concurrently, as
+    // long as no two tweens share a target. Compact then drops finished
+    // tweens in place and reports their event ids, never calling them.
+    template<typename T>
+    class Pool
+    {
+    private:
+        struct Tweens
+        {
+            std::vector<T*> target;
+            std::vector<T> start;
+            std::vector<T> end;
+            std::vector<float> time;
+            std::vector<float> duration;
+            std::vector<uint32_t> event;
+        };
+
+        // Values eased and interpolated per batch, kept on the stack.
+        static constexpr size_t BLOCK_SIZE = 256;
+
+        std::array<Tweens, EASING_COUNT> tweens;
+
+        size_t size = 0;
+
+        void Compact(
+            Tweens& set,
+            std::vector<uint32_t>& events)
+        {
+            const size_t count = set.target.size();
+            size_t kept = 0;
+
+            for (size_t i = 0; i < count; i++)
+            {
+                if (set.time[i] >= set.duration[i])
+                {
+                    if (set.event[i] != NO_EVENT)
+                        events.push_back(set.event[i]);
+
+                    continue;
+                }
+
+                if (kept != i)
+                {
+                    set.target[kept] = set.target[i];
+                    set.start[kept] = set.start[i];
+                    set.end[kept] = set.end[i];
+                    set.time[kept] = set.time[i];
+                    set.duration[kept] = set.duration[i];
+                    set.event[kept] = set.event[i];
+                }
+
+                kept++;
+            }
+
+            set.target.resize(kept);
+            set.start.resize(kept);
+            set.end.resize(kept);
+            set.time.resize(kept);
+            set.duration.resize(kept);
+            set.event.resize(kept);
+
+            size -= count - kept;
+        }
+
+    public:
+        size_t Size() const
+        {
+            return size;
+        }
+
+        size_t Size(const EasingFunction func) const
+        {
+            return tweens[static_cast<size_t>(func)].target.size();
+        }
+
+        void Add(
+            T* value,
+            const T origin,
+            const T destination,
+            const float seconds,
+            const EasingFunction func,
+            const uint32_t event_id)
+        {
+            Tweens& set = tweens[static_cast<size_t>(func)];
+
+            set.target.push_back(value);
+            set.start.push_back(origin);
+            set.end.push_back(destination);
+            set.time.push_back(0.0f);
+            set.duration.push_back(seconds);
+            set.event.push_back(event_id);
+
+            size++;
+        }
+
+        // Steps tweens [first, last) of func and writes their values,
+        // returning how many finished.
+        size_t Advance(
+            const EasingFunction func,
+            const size_t first,
+            const size_t last,
+            const float time_step)
+        {
+            Tweens& set = tweens[static_cast<size_t>(func)];
+
+            float eased[BLOCK_SIZE];
+            T values[BLOCK_SIZE];
+
+            size_t finished = 0;
+
+            for (size_t block = first; block < last; block += BLOCK_SIZE)
+            {
+                const size_t count = std::min(BLOCK_SIZE, last - block);
+
+                for (size_t i = 0; i < count; i++)
+                {
+                    const float elapsed = set.time[block + i] + time_step;
+                    const float duration = set.duration[block + i];
+
+                    set.time[block + i] = elapsed;
+                    eased[i] = elapsed >= duration ? 1.0f : elapsed / duration;
+                    finished += elapsed >= duration;
+                }
+
+                Ease(func, eased, eased, count);
+
+                Interpolate(
+                    set.start.data() + block, set.end.data() + block, eased,
+                    values, count);
+
+                for (size_t i = 0; i < count; i++)
+                {
+                    *set.target[block + i] = values[i];
+                }
+            }
+
+            return finished;
+        }
+
+        // Drops the finished tweens of func, appending their event ids.
+        void Compact(
+            const EasingFunction func,
+            std::vector<uint32_t>& events)
+        {
+            Compact(tweens[static_cast<size_t>(func)], events);
+        }
+
+        void Update(
+            const float time_step,
+            std::vector<uint32_t>& events)
+        {
+            for (size_t f = 0; f < EASING_COUNT; f++)
+            {
+                const auto func = static_cast<EasingFunction>(f);
+
+                if (Advance(func, 0, Size(func), time_step) != 0)
+                    Compact(func, events);
+            }
+        }
+    };
+}
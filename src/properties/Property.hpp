@@ -40,23 +40,25 @@ namespace Properties
 
         void Update(const float time_step)
         {
-            std::vector<size_t> removals;
+            // Stable compaction of the running interpolators in one pass.
+            size_t kept = 0;
 
             for (size_t j = 0; j < interpolators.size(); j++)
             {
-                auto& i = interpolators[j];
-                value = i.Update(time_step);
+                value = interpolators[j].Update(time_step);
 
-                if (i.Complete())
+                if (interpolators[j].Complete())
+                    continue;
+
+                if (kept != j)
                 {
-                    removals.push_back(j);
+                    interpolators[kept] = std::move(interpolators[j]);
                 }
-            }
 
-            for (auto& index : removals)
-            {
-                interpolators.erase(interpolators.begin() + index);
+                kept++;
             }
+
+            interpolators.erase(interpolators.begin() + kept, interpolators.end());
         }
 
         void Animate(
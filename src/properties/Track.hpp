@@ -0,0 +1,189 @@
+#pragma once
+
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <algorithm>
+
+#include "Interpolate.hpp"
+
+namespace Properties
+{
+    enum class KeyInterpolation
+    {
+        Step,
+        Linear,
+        Hermite
+    };
+
+    // Keeps consecutive quaternion keys in one hemisphere so Hermite blends
+    // take the shorter arc.
+    inline glm::quat Align(const glm::quat previous, const glm::quat value)
+    {
+        return glm::dot(previous, value) < 0.0f ? value * -1.0f : value;
+    }
+
+    template<typename T>
+    T Align(const T, const T value)
+    {
+        return value;
+    }
+
+    inline glm::quat Blend(const glm::quat origin, const glm::quat target, const float t)
+    {
+        return Nlerp(origin, target, t);
+    }
+
+    template<typename T>
+    T Blend(const T origin, const T target, const float t)
+    {
+        return Interpolate(origin, target, t);
+    }
+
+    inline glm::quat Normalized(const glm::quat value)
+    {
+        return glm::normalize(value);
+    }
+
+    template<typename T>
+    T Normalized(const T value)
+    {
+        return value;
+    }
+
+    // Keyframes at increasing times with contiguous time, value and tangent
+    // arrays. Sample remembers the segment it last used, so playback in
+    // either direction at frame rate costs O(1) and only a seek pays for a
+    // binary search. Hermite tangents are in value per second, Catmull-Rom
+    // from the neighbouring keys unless given.
+    template<typename T>
+    class Track
+    {
+    private:
+        KeyInterpolation interpolation;
+
+        std::vector<float> times;
+        std::vector<T> values;
+        std::vector<T> tangents;
+        std::vector<uint8_t> automatic;
+
+        size_t segment = 0;
+
+        // Written as a + b * -1, quaternions have no operator-.
+        T Slope(const size_t from, const size_t to) const
+        {
+            return (values[to] + values[from] * -1.0f) * (1.0f / (times[to] - times[from]));
+        }
+
+        size_t FindSegment(const float time)
+        {
+            const size_t last = times.size() - 2;
+
+            if (time >= times[segment] && time < times[segment + 1])
+                return segment;
+
+            if (segment < last && time >= times[segment + 1] && time < times[segment + 2])
+                return ++segment;
+
+            if (segment > 0 && time >= times[segment - 1] && time < times[segment])
+                return --segment;
+
+            const auto next = std::upper_bound(times.begin(), times.end(), time);
+            const size_t key = static_cast<size_t>(next - times.begin());
+
+            segment = std::min(key == 0 ? 0 : key - 1, last);
+            return segment;
+        }
+
+    public:
+        explicit Track(
+            const KeyInterpolation interpolation = KeyInterpolation::Linear) :
+            interpolation(interpolation)
+        {
+        }
+
+        void Add(
+            const float time,
+            const T value)
+        {
+            assert(times.empty() || time > times.back());
+
+            times.push_back(time);
+            values.push_back(values.empty() ? value : Align(values.back(), value));
+
+            // Only Hermite tracks carry tangents.
+            if (interpolation != KeyInterpolation::Hermite)
+                return;
+
+            tangents.push_back(T());
+            automatic.push_back(1);
+
+            const size_t key = times.size() - 1;
+
+            if (key == 0)
+                return;
+
+            tangents[key] = Slope(key - 1, key);
+
+            if (automatic[key - 1])
+            {
+                tangents[key - 1] = key == 1 ?
+                    Slope(0, 1) : Slope(key - 2, key);
+            }
+        }
+
+        void Add(
+            const float time,
+            const T value,
+            const T tangent)
+        {
+            assert(interpolation == KeyInterpolation::Hermite);
+
+            Add(time, value);
+            tangents.back() = tangent;
+            automatic.back() = 0;
+        }
+
+        size_t KeyCount() const
+        {
+            return times.size();
+        }
+
+        float Duration() const
+        {
+            return times.empty() ? 0.0f : times.back();
+        }
+
+        // Clamps to the first and last key outside their times.
+        T Sample(const float time)
+        {
+            assert(!times.empty());
+
+            if (times.size() == 1 || time <= times.front())
+                return values.front();
+
+            if (time >= times.back())
+                return values.back();
+
+            const size_t k = FindSegment(time);
+
+            if (interpolation == KeyInterpolation::Step)
+                return values[k];
+
+            const float h = times[k + 1] - times[k];
+            const float s = (time - times[k]) / h;
+
+            if (interpolation == KeyInterpolation::Linear)
+                return Blend(values[k], values[k + 1], s);
+
+            const float s2 = s * s;
+            const float s3 = s2 * s;
+
+            return Normalized(
+                values[k] * (2.0f * s3 - 3.0f * s2 + 1.0f) +
+                tangents[k] * (h * (s3 - 2.0f * s2 + s)) +
+                values[k + 1] * (3.0f * s2 - 2.0f * s3) +
+                tangents[k + 1] * (h * (s3 - s2)));
+        }
+    };
+}
@@ -0,0 +1,207 @@
+// Writes the uint8 noise tables included by src/Noise.cpp, generated from
+// the int tables of the bundled samplers. Ranking keys are stored once per
+// pair of dimensions as the samplers duplicate them. With the packed tables
+// already built in, it also checks Noise::generate_all against the original
+// sampler functions for every spp.
+//
+// usage: noise_pack <lib/noise/noise directory>
+
+#include "../src/Noise.hpp"
+#include "../src/Timing.hpp"
+
+#include <noise/sobol.h>
+#include <noise/samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_1spp.h>
+#include <noise/samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_2spp.h>
+#include <noise/samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_4spp.h>
+#include <noise/samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_8spp.h>
+#include <noise/samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_16spp.h>
+#include <noise/samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_32spp.h>
+#include <noise/samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_64spp.h>
+#include <noise/samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_128spp.h>
+#include <noise/samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_256spp.h>
+
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <cstring>
+#include <iostream>
+
+#define DIM 128
+
+using Sampler = float(*)(int, int, int, int);
+
+struct Source
+{
+    uint16_t spp;
+    const int* ranking;
+    const int* scrambling;
+    Sampler sampler;
+};
+
+static const Source sources[] =
+{
+    { 1, rankingTile_1spp, scramblingTile_1spp, sbned_128x128_2d2d2d2d_1spp },
+    { 2, rankingTile_2spp, scramblingTile_2spp, sbned_128x128_2d2d2d2d_2spp },
+    { 4, rankingTile_4spp, scramblingTile_4spp, sbned_128x128_2d2d2d2d_4spp },
+    { 8, rankingTile_8spp, scramblingTile_8spp, sbned_128x128_2d2d2d2d_8spp },
+    { 16, rankingTile_16spp, scramblingTile_16spp, sbned_128x128_2d2d2d2d_16spp },
+    { 32, rankingTile_32spp, scramblingTile_32spp, sbned_128x128_2d2d2d2d_32spp },
+    { 64, rankingTile_64spp, scramblingTile_64spp, sbned_128x128_2d2d2d2d_64spp },
+    { 128, rankingTile_128spp, scramblingTile_128spp, sbned_128x128_2d2d2d2d_128spp },
+    { 256, rankingTile_256spp, scramblingTile_256spp, sbned_128x128_2d2d2d2d_256spp }
+};
+
+static bool write_table(
+    FILE* file,
+    const std::string& declaration,
+    const int* values,
+    const size_t count,
+    const size_t stride)
+{
+    std::fprintf(file, "static const uint8_t %s = {", declaration.c_str());
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const int value = values[i * stride];
+
+        if (value < 0 || value > 255)
+            return false;
+
+        std::fprintf(file, "%s%s%d", i ? "," : "", i % 32 ? "" : "\n    ", value);
+    }
+
+    std::fprintf(file, "};\n");
+    return true;
+}
+
+static bool write_header(
+    const std::string& path,
+    const std::string& source,
+    const std::function<bool(FILE*)>& write_tables)
+{
+    FILE* file = std::fopen(path.c_str(), "w");
+
+    if (file == nullptr)
+    {
+        std::cout << "Failed to open file: " << path << std::endl;
+        return false;
+    }
+
+    std::fprintf(file,
+        "#pragma once\n\n"
+        "// Generated by tools/NoisePack.cpp from %s, do not edit.\n\n"
+        "#include <cstdint>\n\n",
+        source.c_str());
+
+    const bool written = write_tables(file);
+    std::fclose(file);
+
+    if (!written)
+        std::cout << "Value out of byte range in " << source << std::endl;
+
+    return written;
+}
+
+static bool pack(
+    const std::string& directory)
+{
+    bool packed = write_header(directory + "/sobol_u8.h", "sobol.h",
+        [](FILE* file)
+        {
+            return write_table(file, "sobol_256spp_256d_u8[256*256]", sobol_256spp_256d, 256 * 256, 1);
+        });
+
+    for (const Source& source : sources)
+    {
+        const std::string spp = std::to_string(source.spp);
+        const std::string name = "samplerBlueNoiseErrorDistribution_128x128_OptimizedFor_" + spp + "spp";
+
+        for (size_t i = 0; i < DIM * DIM * 8; i += 2)
+        {
+            if (source.ranking[i] != source.ranking[i + 1])
+            {
+                std::cout << "Ranking keys are not paired in " << name << ".h" << std::endl;
+                return false;
+            }
+        }
+
+        packed &= write_header(directory + "/" + name + "_u8.h", name + ".h",
+            [&](FILE* file)
+            {
+                return
+                    write_table(file, "scramblingTile_" + spp + "spp_u8[128*128*8]", source.scrambling, DIM * DIM * 8, 1) &&
+                    write_table(file, "rankingTile_" + spp + "spp_u8[128*128*4]", source.ranking, DIM * DIM * 4, 2);
+            });
+    }
+
+    return packed;
+}
+
+static bool verify()
+{
+    bool exact = true;
+
+    // One worker, the time is compared against the serial reference.
+    cpu::Scheduler scheduler(1);
+
+    for (const Source& source : sources)
+    {
+        const size_t size = static_cast<size_t>(DIM) * DIM * source.spp;
+        auto packed = std::make_unique<std::vector<TexDataByteRGBA>>(size);
+        std::vector<TexDataByteRGBA> reference(size);
+
+        auto reference_start = timer_start();
+        for (int s = 0; s < source.spp; s++)
+        {
+            for (int y = 0; y < DIM; y++)
+            {
+                for (int x = 0; x < DIM; x++)
+                {
+                    auto byte = [&](const int d)
+                    {
+                        return static_cast<uint8_t>(source.sampler(x, y, s, d) * 255);
+                    };
+
+                    reference[x + y * DIM + s * DIM * DIM] = { byte(0), byte(1), byte(2), byte(3) };
+                }
+            }
+        }
+        const float reference_time = timer_end(reference_start);
+
+        auto packed_start = timer_start();
+        Noise::generate_all(packed, source.spp, scheduler);
+        const float packed_time = timer_end(packed_start);
+
+        bool match = std::memcmp(
+            reference.data(), packed->data(), size * sizeof(TexDataByteRGBA)) == 0;
+
+        // The float lookup covers all eight optimised dimensions.
+        for (int s = 0; s < source.spp && match; s++)
+            for (int y = 0; y < DIM; y++)
+                for (int x = 0; x < DIM; x++)
+                    for (int d = 0; d < 8; d++)
+                        match &= Noise::blue_noise(x, y, s, d, source.spp) == source.sampler(x, y, s, d);
+
+        exact &= match;
+
+        std::cout << "noise_pack: " << source.spp << " spp, reference "
+                  << reference_time << " ms, packed " << packed_time << " ms, "
+                  << (match ? "bit-exact" : "MISMATCH") << std::endl;
+    }
+
+    return exact;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2)
+    {
+        std::cout << "usage: " << argv[0] << " <lib/noise/noise directory>" << std::endl;
+        return 1;
+    }
+
+    if (!pack(argv[1]))
+        return 1;
+
+    return verify() ? 0 : 1;
+}
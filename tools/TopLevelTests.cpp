@@ -0,0 +1,152 @@
+// Checks the TopLevelPolicy decisions and EntityStore slot reuse the top
+// level structures are built on, free of any renderer. Prints each failed
+// check and exits non-zero when there is one.
+//
+// usage: toplevel_tests
+
+#include "../src/Entities.hpp"
+#include "../src/TopLevelPolicy.hpp"
+
+#include <vector>
+#include <iostream>
+
+static int failures = 0;
+
+static void check(
+    const bool passed,
+    const char* what)
+{
+    if (!passed)
+    {
+        std::cout << "FAILED: " << what << std::endl;
+        failures++;
+    }
+}
+
+static Entity make_entity(const float x)
+{
+    Entity entity;
+    entity.position = glm::vec3(x, 0.0f, 0.0f);
+    return entity;
+}
+
+static void test_grow()
+{
+    TopLevelPolicy policy;
+
+    check(policy.Grow(0) == TopLevelPolicy::MIN_CAPACITY, "Grow(0) is MIN_CAPACITY");
+    check(policy.Grow(1) == TopLevelPolicy::MIN_CAPACITY, "Grow(1) is MIN_CAPACITY");
+    check(policy.Grow(64) == 64, "Grow(64) fits exactly");
+    check(policy.Grow(65) == 128, "Grow(65) doubles");
+    check(policy.Grow(1000) == 1024, "Grow(1000) doubles until it fits");
+
+    policy.Next(100, 100, 100);
+    check(policy.Capacity() == 128, "first Next allocates Grow(slot_count)");
+    check(policy.Grow(129) == 256, "Grow doubles from the current capacity");
+    check(policy.Grow(UINT32_MAX) == UINT32_MAX, "Grow stops at the slot count on overflow");
+}
+
+static void test_next()
+{
+    TopLevelPolicy policy;
+
+    check(policy.Next(0, 0, 0) == TopLevelAction::Reallocate, "first Next reallocates");
+    check(policy.Capacity() == TopLevelPolicy::MIN_CAPACITY, "first capacity is MIN_CAPACITY");
+    check(policy.Next(10, 10, 0) == TopLevelAction::None, "nothing changed is None");
+
+    // A quarter of 10 live instances is 2.5.
+    check(policy.Next(10, 10, 2) == TopLevelAction::Update, "a few changes update");
+    check(policy.Updates() == 1, "an update is counted");
+    check(policy.Next(10, 10, 3) == TopLevelAction::Rebuild, "past rebuild_fraction rebuilds");
+    check(policy.Updates() == 0, "a rebuild resets the updates");
+
+    // Slots within the capacity are changes like any other.
+    check(policy.Next(12, 11, 2) == TopLevelAction::Update, "added and removed slots update");
+    check(policy.Next(64, 64, 1) == TopLevelAction::Update, "filling the capacity updates");
+    check(policy.Next(65, 65, 1) == TopLevelAction::Reallocate, "outgrowing the capacity reallocates");
+    check(policy.Capacity() == 128, "reallocation doubles");
+    check(policy.Updates() == 0, "a reallocation resets the updates");
+
+    for (uint32_t i = 0; i < TopLevelPolicy::MAX_UPDATES; i++)
+    {
+        policy.Next(65, 65, 1);
+    }
+
+    check(policy.Updates() == TopLevelPolicy::MAX_UPDATES, "MAX_UPDATES updates in a row");
+    check(policy.Next(65, 65, 1) == TopLevelAction::Rebuild, "after MAX_UPDATES it rebuilds");
+
+    TopLevelPolicy refit_only(1.0f);
+    refit_only.Next(10, 10, 10);
+    check(refit_only.Next(10, 10, 10) == TopLevelAction::Update, "rebuild_fraction 1 refits a full change");
+}
+
+static void test_slot_reuse()
+{
+    EntityStore entities;
+
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        check(entities.Add(make_entity(static_cast<float>(i))) == i, "roots append in order");
+    }
+
+    check(entities.Changes().size() == 4, "new entities start changed");
+    entities.ClearChanges();
+    check(entities.Changes().empty(), "ClearChanges clears");
+
+    entities.Remove(1);
+    entities.Remove(2);
+
+    check(entities.Size() == 4, "Remove keeps the slot");
+    check(entities.LiveCount() == 2, "Remove drops the live count");
+    check(!entities.Alive(1) && !entities.Alive(2), "removed slots are dead");
+    check(entities.Alive(0) && entities.Alive(3), "other slots stay live");
+    check(entities.Changes() == std::vector<uint32_t>({ 1, 2 }), "removed slots are changed");
+
+    TopLevelPolicy policy;
+    policy.Next(0, 0, 0);
+    check(policy.Next(
+        static_cast<uint32_t>(entities.Size()),
+        static_cast<uint32_t>(entities.LiveCount()),
+        static_cast<uint32_t>(entities.Changes().size())) == TopLevelAction::Rebuild,
+        "removing half the live entities rebuilds");
+    entities.ClearChanges();
+
+    check(entities.Add(make_entity(10.0f)) == 2, "a root takes the most recently freed slot");
+    check(entities.Alive(2), "a reused slot is live");
+    check(entities.Position(2).x == 10.0f, "a reused slot takes the new entity");
+    check(entities.Changes() == std::vector<uint32_t>({ 2 }), "a reused slot is changed");
+    entities.ClearChanges();
+
+    check(entities.Add(make_entity(11.0f), 0) == 4, "a child appends past a free slot");
+    check(entities.Add(make_entity(12.0f)) == 1, "the next root takes the remaining free slot");
+    check(entities.Size() == 5 && entities.LiveCount() == 5, "no free slots left");
+    check(entities.Add(make_entity(13.0f)) == 5, "roots append once no slot is free");
+    entities.ClearChanges();
+
+    // Replace one of six in place, one change against a quarter of six.
+    entities.Remove(3);
+    check(entities.Add(make_entity(14.0f)) == 3, "a replaced entity keeps its slot");
+    check(entities.Changes() == std::vector<uint32_t>({ 3 }), "a replaced slot changes once");
+    check(policy.Next(
+        static_cast<uint32_t>(entities.Size()),
+        static_cast<uint32_t>(entities.LiveCount()),
+        static_cast<uint32_t>(entities.Changes().size())) == TopLevelAction::Update,
+        "replacing one entity updates");
+    entities.ClearChanges();
+}
+
+int main()
+{
+    test_grow();
+    test_next();
+    test_slot_reuse();
+
+    if (failures != 0)
+    {
+        std::cout << failures << " checks failed" << std::endl;
+        return 1;
+    }
+
+    std::cout << "toplevel_tests: passed" << std::endl;
+    return 0;
+}